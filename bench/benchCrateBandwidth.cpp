@@ -0,0 +1,90 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+// Measures crate (.usdc) read and write bandwidth on large array-valued
+// attributes. "items" reports the raw array payload in bytes, so
+// bandwidth can be derived directly from the timings.
+//
+#include "benchmark.h"
+
+#include "pxr/pxr.h"
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/vt/array.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/sdf/types.h"
+#include "pxr/usd/usd/attribute.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/stage.h"
+
+#include <string>
+
+static const int NUM_ARRAYS = 16;
+static const size_t ARRAY_SIZE = 1u << 20;  // floats per array
+
+int
+main(int argc, char *argv[])
+{
+    // Author NUM_ARRAYS attributes each holding ARRAY_SIZE floats. The
+    // values vary per element so the payload is representative, not
+    // trivially compressible runs of a constant.
+    UsdStageRefPtr srcStage = UsdStage::CreateInMemory();
+    for (int i = 0; i < NUM_ARRAYS; ++i) {
+        VtFloatArray array(ARRAY_SIZE);
+        for (size_t j = 0; j < ARRAY_SIZE; ++j) {
+            array[j] = static_cast<float>(i) + 0.001f * (j % 1024);
+        }
+        UsdPrim prim = srcStage->DefinePrim(
+            SdfPath(TfStringPrintf("/arrays/prim%d", i)));
+        prim.CreateAttribute(TfToken("bench:data"),
+                             SdfValueTypeNames->FloatArray).Set(array);
+    }
+
+    const std::string filePath =
+        ArchMakeTmpFileName("benchCrateBandwidth", ".usdc");
+
+    BenchOptions opts;
+    opts.items = NUM_ARRAYS * ARRAY_SIZE * sizeof(float);
+
+    BenchRun("crateWrite", opts, [&srcStage, &filePath]() {
+        srcStage->Export(filePath);
+    });
+
+    BenchRun("crateRead", opts, [&filePath]() {
+        // Opening the exported file and pulling every array forces the
+        // values to be read; the stage is dropped at the end of each
+        // iteration so nothing stays warm in the layer registry.
+        UsdStageRefPtr stage = UsdStage::Open(filePath);
+        VtFloatArray array;
+        for (int i = 0; i < NUM_ARRAYS; ++i) {
+            UsdPrim prim = stage->GetPrimAtPath(
+                SdfPath(TfStringPrintf("/arrays/prim%d", i)));
+            prim.GetAttribute(TfToken("bench:data")).Get(&array);
+        }
+    });
+
+    TfDeleteFile(filePath);
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+// Measures UsdImaging playback: population of the UsdImagingDelegate from
+// an animated synthetic stage, and the per-frame SetTime + sync cost while
+// scrubbing through the animation. Uses the null render delegate, so the
+// numbers cover the USD-to-Hydra path rather than any backend. A path to
+// an existing stage may be given as the only argument.
+//
+#include "benchmark.h"
+
+#include "pxr/pxr.h"
+#include "pxr/base/gf/vec3d.h"
+#include "pxr/base/gf/vec3f.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/vt/array.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/usd/timeCode.h"
+#include "pxr/usd/usdGeom/mesh.h"
+#include "pxr/usd/usdGeom/xform.h"
+#include "pxr/usd/usdGeom/xformOp.h"
+#include "pxr/usdImaging/usdImaging/unitTestHelper.h"
+
+#include <string>
+
+static const int NUM_MESHES = 500;
+static const double START_FRAME = 1.0;
+static const double END_FRAME = 48.0;
+
+// Authors an animated quad under an animated xform.
+static void
+_AuthorAnimatedMesh(UsdStageRefPtr const &stage, int i)
+{
+    const SdfPath xformPath(TfStringPrintf("/scene/xform%d", i));
+    UsdGeomXform xform = UsdGeomXform::Define(stage, xformPath);
+    UsdGeomXformOp translateOp = xform.AddTranslateOp();
+    translateOp.Set(GfVec3d(i, 0, 0), UsdTimeCode(START_FRAME));
+    translateOp.Set(GfVec3d(i, i, 0), UsdTimeCode(END_FRAME));
+
+    UsdGeomMesh mesh =
+        UsdGeomMesh::Define(stage, xformPath.AppendChild(TfToken("mesh")));
+
+    VtVec3fArray points(4);
+    points[0] = GfVec3f(0, 0, 0);
+    points[1] = GfVec3f(1, 0, 0);
+    points[2] = GfVec3f(1, 1, 0);
+    points[3] = GfVec3f(0, 1, 0);
+    mesh.GetPointsAttr().Set(points, UsdTimeCode(START_FRAME));
+    for (size_t p = 0; p < points.size(); ++p) {
+        points[p][2] = 1.0f;
+    }
+    mesh.GetPointsAttr().Set(points, UsdTimeCode(END_FRAME));
+
+    VtIntArray faceVertexCounts(1, 4);
+    mesh.GetFaceVertexCountsAttr().Set(faceVertexCounts);
+
+    VtIntArray faceVertexIndices(4);
+    for (int v = 0; v < 4; ++v) {
+        faceVertexIndices[v] = v;
+    }
+    mesh.GetFaceVertexIndicesAttr().Set(faceVertexIndices);
+}
+
+int
+main(int argc, char *argv[])
+{
+    UsdStageRefPtr stage;
+    if (argc > 1) {
+        stage = UsdStage::Open(argv[1]);
+        if (!stage) {
+            fprintf(stderr, "Failed to open stage %s\n", argv[1]);
+            return 1;
+        }
+    } else {
+        stage = UsdStage::CreateInMemory();
+        for (int i = 0; i < NUM_MESHES; ++i) {
+            _AuthorAnimatedMesh(stage, i);
+        }
+    }
+
+    BenchOptions populateOpts;
+    populateOpts.items = NUM_MESHES;
+
+    // Population: delegate construction plus the first sync.
+    BenchRun("usdImagingPopulate", populateOpts, [&stage]() {
+        UsdImaging_TestDriver driver(stage);
+        driver.SetTime(START_FRAME);
+        driver.Draw();
+    });
+
+    // Playback: per-frame SetTime + sync over a persistent delegate,
+    // scrubbing the full frame range each iteration.
+    UsdImaging_TestDriver driver(stage);
+    driver.SetTime(START_FRAME);
+    driver.Draw();
+
+    BenchOptions playbackOpts;
+    playbackOpts.items =
+        static_cast<size_t>(END_FRAME - START_FRAME) + 1u;
+
+    BenchRun("usdImagingPlayback", playbackOpts, [&driver]() {
+        for (double frame = START_FRAME; frame <= END_FRAME; frame += 1.0) {
+            driver.SetTime(frame);
+            driver.Draw();
+        }
+    });
+
+    return 0;
+}
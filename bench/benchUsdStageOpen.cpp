@@ -0,0 +1,127 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+// Measures UsdStage::Open plus full composition (prim indexing and a
+// complete traversal) of a synthetic hierarchy, in both text and crate
+// encodings. A path to an existing file may be given as the only argument
+// to measure a real scene instead.
+//
+#include "benchmark.h"
+
+#include "pxr/pxr.h"
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/sdf/types.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/usdGeom/scope.h"
+#include "pxr/usd/usdGeom/xform.h"
+
+#include <string>
+
+static const int BRANCHING_FACTOR = 10;
+static const int DEPTH = 4;
+
+static void
+_AuthorSubtree(UsdStageRefPtr const &stage, SdfPath const &path, int depth)
+{
+    if (depth == DEPTH) {
+        UsdGeomScope scope = UsdGeomScope::Define(stage, path);
+        UsdPrim prim = scope.GetPrim();
+        prim.CreateAttribute(TfToken("bench:index"),
+                             SdfValueTypeNames->Int).Set(depth);
+        prim.CreateAttribute(TfToken("bench:name"),
+                             SdfValueTypeNames->String).Set(path.GetName());
+        return;
+    }
+
+    UsdGeomXform::Define(stage, path);
+    for (int i = 0; i < BRANCHING_FACTOR; ++i) {
+        _AuthorSubtree(
+            stage, path.AppendChild(TfToken(TfStringPrintf("child%d", i))),
+            depth + 1);
+    }
+}
+
+// Returns the number of prims composed, so the work can't be elided and
+// "items" can report the stage size.
+static size_t
+_OpenAndTraverse(std::string const &filePath)
+{
+    UsdStageRefPtr stage = UsdStage::Open(filePath);
+    size_t numPrims = 0;
+    for (UsdPrim const &prim: stage->Traverse()) {
+        if (prim) {
+            ++numPrims;
+        }
+    }
+    return numPrims;
+}
+
+int
+main(int argc, char *argv[])
+{
+    std::vector<std::string> filePaths;
+    std::vector<std::string> tmpPaths;
+
+    if (argc > 1) {
+        filePaths.push_back(argv[1]);
+    } else {
+        // Author the synthetic hierarchy once and export it in both
+        // encodings.
+        UsdStageRefPtr stage = UsdStage::CreateInMemory();
+        _AuthorSubtree(stage, SdfPath("/root"), 0);
+
+        for (const char *ext: {"usda", "usdc"}) {
+            const std::string path =
+                ArchMakeTmpFileName("benchUsdStageOpen",
+                                    TfStringPrintf(".%s", ext));
+            stage->Export(path);
+            filePaths.push_back(path);
+            tmpPaths.push_back(path);
+        }
+    }
+
+    for (std::string const &filePath: filePaths) {
+        BenchOptions opts;
+        opts.items = _OpenAndTraverse(filePath);
+
+        // The stage (and with it the layer registry entry) is dropped at
+        // the end of every iteration, so each open re-reads and
+        // re-composes from scratch.
+        BenchRun(
+            TfStringPrintf("usdStageOpen_%s",
+                           TfStringGetSuffix(filePath).c_str()),
+            opts,
+            [&filePath]() { _OpenAndTraverse(filePath); });
+    }
+
+    for (std::string const &tmpPath: tmpPaths) {
+        TfDeleteFile(tmpPath);
+    }
+
+    return 0;
+}
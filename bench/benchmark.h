@@ -0,0 +1,113 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef PXR_BENCH_BENCHMARK_H
+#define PXR_BENCH_BENCHMARK_H
+
+/// \file bench/benchmark.h
+///
+/// A minimal measurement harness shared by the benchmark programs in this
+/// directory. Each measurement runs a number of unrecorded warmup
+/// iterations followed by a number of timed iterations, and emits one JSON
+/// object per line to stdout:
+///
+///   {"benchmark": "...", "iterations": N, "warmup": W, "items": I,
+///    "min_ms": ..., "mean_ms": ..., "median_ms": ..., "stddev_ms": ...,
+///    "max_ms": ...}
+///
+/// so results can be collected and compared by scripts without parsing
+/// free-form log output. "items" is a benchmark-specific work count (prims
+/// read, bytes written, frames played, ...) that allows throughput to be
+/// derived from the timings; it is zero when not meaningful.
+
+#include "pxr/pxr.h"
+#include "pxr/base/tf/stopwatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+struct BenchOptions {
+    BenchOptions() : warmupIterations(2), iterations(10), items(0) {}
+
+    size_t warmupIterations;
+    size_t iterations;
+
+    // Benchmark-specific work count per iteration; reported verbatim.
+    size_t items;
+};
+
+/// Runs \p fn for the configured warmup and timed iterations and prints a
+/// JSON record of the wall-clock statistics.
+inline void
+BenchRun(std::string const &name,
+         BenchOptions const &opts,
+         std::function<void ()> const &fn)
+{
+    for (size_t i = 0; i < opts.warmupIterations; ++i) {
+        fn();
+    }
+
+    std::vector<double> samplesMs;
+    samplesMs.reserve(opts.iterations);
+    for (size_t i = 0; i < opts.iterations; ++i) {
+        TfStopwatch watch;
+        watch.Start();
+        fn();
+        watch.Stop();
+        samplesMs.push_back(watch.GetSeconds() * 1000.0);
+    }
+
+    std::vector<double> sorted = samplesMs;
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0.0;
+    for (double ms: samplesMs) {
+        sum += ms;
+    }
+    const double mean = sum / samplesMs.size();
+
+    double sqDevSum = 0.0;
+    for (double ms: samplesMs) {
+        sqDevSum += (ms - mean) * (ms - mean);
+    }
+    const double stddev = sqrt(sqDevSum / samplesMs.size());
+
+    const double median = (sorted.size() % 2 == 0)
+        ? (sorted[sorted.size() / 2 - 1] + sorted[sorted.size() / 2]) / 2.0
+        : sorted[sorted.size() / 2];
+
+    printf("{\"benchmark\": \"%s\", \"iterations\": %zu, \"warmup\": %zu, "
+           "\"items\": %zu, \"min_ms\": %.4f, \"mean_ms\": %.4f, "
+           "\"median_ms\": %.4f, \"stddev_ms\": %.4f, \"max_ms\": %.4f}\n",
+           name.c_str(), opts.iterations, opts.warmupIterations, opts.items,
+           sorted.front(), mean, median, stddev, sorted.back());
+    fflush(stdout);
+}
+
+#endif // PXR_BENCH_BENCHMARK_H
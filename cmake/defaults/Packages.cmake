@@ -67,6 +67,12 @@ endif()
 find_package(TBB REQUIRED COMPONENTS tbb)
 add_definitions(${TBB_DEFINITIONS})
 
+# --Zstd
+if (PXR_ENABLE_ZSTD_SUPPORT)
+    find_package(Zstd REQUIRED)
+    add_definitions(-DPXR_ZSTD_SUPPORT_ENABLED)
+endif()
+
 # --math
 if(WIN32)
     # Math functions are linked automatically by including math.h on Windows.
@@ -519,6 +519,50 @@ function(pxr_build_test TEST_NAME)
     endif()
 endfunction() # pxr_build_test
 
+function(pxr_build_benchmark BENCH_NAME)
+    if (PXR_BUILD_BENCHMARKS)
+        cmake_parse_arguments(bb
+            "" ""
+            "LIBRARIES;CPPFILES"
+            ${ARGN}
+        )
+
+        add_executable(${BENCH_NAME}
+            ${bb_CPPFILES}
+        )
+
+        _get_folder("bench/bin" folder)
+        set_target_properties(${BENCH_NAME}
+            PROPERTIES
+                FOLDER "${folder}"
+                POSITION_INDEPENDENT_CODE ON
+        )
+        target_include_directories(${BENCH_NAME}
+            PRIVATE "${CMAKE_BINARY_DIR}/include"
+        )
+        _pxr_target_link_libraries(${BENCH_NAME}
+            ${bb_LIBRARIES}
+        )
+
+        # Find libraries under the install prefix, which has the core USD
+        # libraries.
+        _pxr_init_rpath(rpath "bench")
+        _pxr_add_rpath(rpath "${CMAKE_INSTALL_PREFIX}/lib")
+        _pxr_install_rpath(rpath ${BENCH_NAME})
+
+        install(TARGETS ${BENCH_NAME}
+            RUNTIME DESTINATION "bench"
+        )
+
+        # Collect every benchmark under one umbrella target so the whole
+        # suite can be built with the "benchmarks" target.
+        if (NOT TARGET benchmarks)
+            add_custom_target(benchmarks)
+        endif()
+        add_dependencies(benchmarks ${BENCH_NAME})
+    endif()
+endfunction() # pxr_build_benchmark
+
 function(pxr_test_scripts)
     # If we can't build Python modules then do nothing.
     if(NOT TARGET python)
@@ -0,0 +1,78 @@
+#
+# Copyright 2019 Pixar
+#
+# Licensed under the Apache License, Version 2.0 (the "Apache License")
+# with the following modification; you may not use this file except in
+# compliance with the Apache License and the following modification to it:
+# Section 6. Trademarks. is deleted and replaced with:
+#
+# 6. Trademarks. This License does not grant permission to use the trade
+#    names, trademarks, service marks, or product names of the Licensor
+#    and its affiliates, except as required to comply with Section 4(c) of
+#    the License and to reproduce the content of the NOTICE file.
+#
+# You may obtain a copy of the Apache License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the Apache License with the above modification is
+# distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied. See the Apache License for the specific
+# language governing permissions and limitations under the Apache License.
+#
+
+find_path( ZSTD_INCLUDE_DIR
+    NAMES
+        zstd.h
+    HINTS
+        "${ZSTD_LOCATION}/include"
+        "$ENV{ZSTD_LOCATION}/include"
+    PATHS
+        /usr/include
+        /usr/local/include
+        DOC "The directory where zstd.h resides")
+find_library( ZSTD_LIBRARY
+    NAMES
+        zstd
+    HINTS
+        "${ZSTD_LOCATION}/lib64"
+        "${ZSTD_LOCATION}/lib"
+        "$ENV{ZSTD_LOCATION}/lib64"
+        "$ENV{ZSTD_LOCATION}/lib"
+    PATHS
+        /usr/lib64
+        /usr/lib
+        /usr/local/lib64
+        /usr/local/lib
+        DOC "The zstd library")
+
+if (ZSTD_INCLUDE_DIR AND EXISTS "${ZSTD_INCLUDE_DIR}/zstd.h" )
+
+    file(STRINGS "${ZSTD_INCLUDE_DIR}/zstd.h" TMP REGEX "^#define ZSTD_VERSION_MAJOR.*$")
+    string(REGEX MATCHALL "[0-9]+" MAJOR ${TMP})
+
+    file(STRINGS "${ZSTD_INCLUDE_DIR}/zstd.h" TMP REGEX "^#define ZSTD_VERSION_MINOR.*$")
+    string(REGEX MATCHALL "[0-9]+" MINOR ${TMP})
+
+    file(STRINGS "${ZSTD_INCLUDE_DIR}/zstd.h" TMP REGEX "^#define ZSTD_VERSION_RELEASE.*$")
+    string(REGEX MATCHALL "[0-9]+" RELEASE ${TMP})
+
+    set(ZSTD_VERSION ${MAJOR}.${MINOR}.${RELEASE})
+
+endif()
+
+include(FindPackageHandleStandardArgs)
+
+find_package_handle_standard_args(Zstd
+    REQUIRED_VARS
+        ZSTD_INCLUDE_DIR
+        ZSTD_LIBRARY
+    VERSION_VAR
+        ZSTD_VERSION
+)
+
+mark_as_advanced(
+    ZSTD_INCLUDE_DIR
+    ZSTD_LIBRARY
+)
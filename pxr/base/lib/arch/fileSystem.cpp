@@ -712,7 +712,7 @@ Arch_Unmapper::operator()(char *mapStart) const
 
 template <class Mapping>
 static inline Mapping
-Arch_MapFileImpl(FILE *file, std::string *errMsg)
+Arch_MapFileImpl(FILE *file, std::string *errMsg, int flags)
 {
     using PtrType = typename Mapping::pointer;
     constexpr bool isConst =
@@ -739,9 +739,22 @@ Arch_MapFileImpl(FILE *file, std::string *errMsg)
     CloseHandle(hFileMap);
     return Mapping(ptr, Arch_Unmapper(length));
 #else // Assume POSIX
+    int mmapFlags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+    if (flags & ArchMapFlagPopulate) {
+        mmapFlags |= MAP_POPULATE;
+    }
+#endif
     auto m = mmap(nullptr, length,
                   isConst ? PROT_READ : PROT_READ | PROT_WRITE,
-                  MAP_PRIVATE, fileno(file), 0);
+                  mmapFlags, fileno(file), 0);
+#if defined(MADV_HUGEPAGE)
+    if (m != MAP_FAILED && (flags & ArchMapFlagHugePages)) {
+        // Best-effort hint; failure (e.g. THP disabled system-wide) is
+        // harmless.
+        madvise(m, length, MADV_HUGEPAGE);
+    }
+#endif
     Mapping ret(m == MAP_FAILED ? nullptr : static_cast<PtrType>(m),
                 Arch_Unmapper(length));
     if (!ret && errMsg) {
@@ -760,15 +773,15 @@ Arch_MapFileImpl(FILE *file, std::string *errMsg)
 }
 
 ArchConstFileMapping
-ArchMapFileReadOnly(FILE *file, std::string *errMsg)
+ArchMapFileReadOnly(FILE *file, std::string *errMsg, int flags)
 {
-    return Arch_MapFileImpl<ArchConstFileMapping>(file, errMsg);
+    return Arch_MapFileImpl<ArchConstFileMapping>(file, errMsg, flags);
 }
 
 ArchMutableFileMapping
-ArchMapFileReadWrite(FILE *file, std::string *errMsg)
+ArchMapFileReadWrite(FILE *file, std::string *errMsg, int flags)
 {
-    return Arch_MapFileImpl<ArchMutableFileMapping>(file, errMsg);
+    return Arch_MapFileImpl<ArchMutableFileMapping>(file, errMsg, flags);
 }
 
 namespace
@@ -790,7 +803,7 @@ using _UniqueFILE = std::unique_ptr<FILE, _Fcloser>;
 
 template <class Mapping>
 static inline Mapping
-Arch_MapFileImpl(std::string const& path, std::string *errMsg)
+Arch_MapFileImpl(std::string const& path, std::string *errMsg, int flags)
 {
     _UniqueFILE f(ArchOpenFile(path.c_str(), "rb"));
     if (!f) {
@@ -799,19 +812,19 @@ Arch_MapFileImpl(std::string const& path, std::string *errMsg)
         }
         return Mapping();
     }
-    return Arch_MapFileImpl<Mapping>(f.get(), errMsg);
+    return Arch_MapFileImpl<Mapping>(f.get(), errMsg, flags);
 }
 
 ArchConstFileMapping
-ArchMapFileReadOnly(std::string const& path, std::string *errMsg)
+ArchMapFileReadOnly(std::string const& path, std::string *errMsg, int flags)
 {
-    return Arch_MapFileImpl<ArchConstFileMapping>(path, errMsg);
+    return Arch_MapFileImpl<ArchConstFileMapping>(path, errMsg, flags);
 }
 
 ArchMutableFileMapping
-ArchMapFileReadWrite(std::string const& path, std::string *errMsg)
+ArchMapFileReadWrite(std::string const& path, std::string *errMsg, int flags)
 {
-    return Arch_MapFileImpl<ArchMutableFileMapping>(path, errMsg);
+    return Arch_MapFileImpl<ArchMutableFileMapping>(path, errMsg, flags);
 }
 
 ARCH_API
@@ -328,33 +328,59 @@ ArchGetFileMappingLength(ArchMutableFileMapping const &m) {
     return m.get_deleter().GetLength();
 }
 
+/// Flags that modify how ArchMapFileReadOnly() and ArchMapFileReadWrite()
+/// establish their mappings.  These are optimization hints only; they do not
+/// change program semantics and unsupported flags are silently ignored on
+/// systems that cannot honor them.
+enum ArchMapFlags {
+    // Default mapping behavior.
+    ArchMapFlagDefault   = 0,
+
+    // Hint that the mapping should be backed by huge pages (e.g. Linux
+    // transparent huge pages) where supported.  Reduces page-table and TLB
+    // pressure for large mappings.
+    ArchMapFlagHugePages = 1 << 0,
+
+    // Eagerly populate the mapping's page tables at map time instead of
+    // faulting pages in on first access.  Useful for mappings that will be
+    // consumed in their entirety, but forces a full read of the backing
+    // file.
+    ArchMapFlagPopulate  = 1 << 1,
+};
+
 /// Privately map the passed \p file into memory and return a unique_ptr to the
 /// read-only mapped contents.  The contents may not be modified.  If mapping
 /// fails, return a null unique_ptr and if errMsg is not null fill it with
-/// information about the failure.
+/// information about the failure.  The \p flags argument is a bitwise-OR of
+/// ArchMapFlags values modifying how the mapping is established.
 ARCH_API
 ArchConstFileMapping
-ArchMapFileReadOnly(FILE *file, std::string *errMsg=nullptr);
+ArchMapFileReadOnly(FILE *file, std::string *errMsg=nullptr,
+                    int flags=ArchMapFlagDefault);
 
 /// \overload
 ARCH_API
 ArchConstFileMapping
-ArchMapFileReadOnly(std::string const& path, std::string *errMsg=nullptr);
+ArchMapFileReadOnly(std::string const& path, std::string *errMsg=nullptr,
+                    int flags=ArchMapFlagDefault);
 
 /// Privately map the passed \p file into memory and return a unique_ptr to the
 /// copy-on-write mapped contents.  If modified, the affected pages are
 /// dissociated from the underlying file and become backed by the system's swap
 /// or page-file storage.  Edits are not carried through to the underlying file.
 /// If mapping fails, return a null unique_ptr and if errMsg is not null fill it
-/// with information about the failure.
+/// with information about the failure.  The \p flags argument is a bitwise-OR
+/// of ArchMapFlags values modifying how the mapping is established.
 ARCH_API
 ArchMutableFileMapping
-ArchMapFileReadWrite(FILE *file, std::string *errMsg=nullptr);
+ArchMapFileReadWrite(FILE *file, std::string *errMsg=nullptr,
+                     int flags=ArchMapFlagDefault);
 
 /// \overload
 ARCH_API
 ArchMutableFileMapping
-ArchMapFileReadWrite(std::string const& path, std::string *errMsg=nullptr);
+ArchMapFileReadWrite(std::string const& path, std::string *errMsg=nullptr,
+                     int flags=ArchMapFlagDefault);
 
 enum ArchMemAdvice {
     ArchMemAdviceNormal,       // Treat range with default behavior.
@@ -0,0 +1,244 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/base/arch/numa.h"
+#include "pxr/base/arch/defines.h"
+#include "pxr/base/arch/systemInfo.h"
+
+#if defined(ARCH_OS_LINUX)
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#elif defined(ARCH_OS_WINDOWS)
+#include <Windows.h>
+#include <Memoryapi.h>
+#else // Assume other POSIX, no topology queries.
+#include <sys/mman.h>
+#endif
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+#if defined(ARCH_OS_LINUX)
+
+namespace {
+
+// Parse a kernel cpulist string such as "0-15,32-47" into CPU ids.
+static std::vector<int>
+_ParseCpuList(const char *cpuList)
+{
+    std::vector<int> cpus;
+    const char *p = cpuList;
+    while (*p) {
+        char *end = nullptr;
+        long first = strtol(p, &end, 10);
+        if (end == p) {
+            break;
+        }
+        long last = first;
+        p = end;
+        if (*p == '-') {
+            last = strtol(p + 1, &end, 10);
+            if (end == p + 1) {
+                break;
+            }
+            p = end;
+        }
+        for (long cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+        if (*p == ',') {
+            ++p;
+        }
+    }
+    return cpus;
+}
+
+// Read /sys/devices/system/node once; nodes without CPUs (memory-only
+// nodes) are skipped, since threads cannot be placed on them.
+static std::vector<std::vector<int>> const &
+_GetNodeCpus()
+{
+    static std::vector<std::vector<int>> const nodeCpus = []() {
+        std::vector<std::vector<int>> result;
+        for (int node = 0; ; ++node) {
+            char path[128];
+            snprintf(path, sizeof(path),
+                     "/sys/devices/system/node/node%d/cpulist", node);
+            FILE *f = fopen(path, "r");
+            if (!f) {
+                break;
+            }
+            char buf[4096];
+            buf[0] = '\0';
+            if (fgets(buf, sizeof(buf), f)) {
+                std::vector<int> cpus = _ParseCpuList(buf);
+                if (!cpus.empty()) {
+                    result.push_back(std::move(cpus));
+                }
+            }
+            fclose(f);
+        }
+        return result;
+    }();
+    return nodeCpus;
+}
+
+} // anonymous namespace
+
+int
+ArchGetNumaNodeCount()
+{
+    size_t const numNodes = _GetNodeCpus().size();
+    return numNodes ? static_cast<int>(numNodes) : 1;
+}
+
+std::vector<int>
+ArchGetNumaNodeCpus(int node)
+{
+    std::vector<std::vector<int>> const &nodeCpus = _GetNodeCpus();
+    if (node < 0 || static_cast<size_t>(node) >= nodeCpus.size()) {
+        return std::vector<int>();
+    }
+    return nodeCpus[node];
+}
+
+bool
+ArchPinThreadToNumaNode(int node)
+{
+    std::vector<int> const cpus = ArchGetNumaNodeCpus(node);
+    if (cpus.empty()) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu: cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+bool
+ArchUnpinThread()
+{
+    long const numCpus = sysconf(_SC_NPROCESSORS_CONF);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (long cpu = 0; cpu < numCpus && cpu < CPU_SETSIZE; ++cpu) {
+        CPU_SET(cpu, &set);
+    }
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+#else // not ARCH_OS_LINUX
+
+// No topology queries on this platform; report a single node and fail
+// placement requests benignly, per the header contract.
+
+int
+ArchGetNumaNodeCount()
+{
+    return 1;
+}
+
+std::vector<int>
+ArchGetNumaNodeCpus(int)
+{
+    return std::vector<int>();
+}
+
+bool
+ArchPinThreadToNumaNode(int)
+{
+    return false;
+}
+
+bool
+ArchUnpinThread()
+{
+    return false;
+}
+
+#endif // ARCH_OS_LINUX
+
+#if defined(ARCH_OS_WINDOWS)
+
+void *
+ArchNumaAllocOnCurrentNode(size_t numBytes)
+{
+    // VirtualAlloc commits pages on the node of the thread that first
+    // accesses them; fault them in here so placement follows the caller.
+    void *ptr = VirtualAlloc(NULL, numBytes, MEM_RESERVE | MEM_COMMIT,
+                             PAGE_READWRITE);
+    if (!ptr) {
+        return nullptr;
+    }
+    size_t const pageSize = static_cast<size_t>(ArchGetPageSize());
+    volatile char *bytes = static_cast<volatile char *>(ptr);
+    for (size_t offset = 0; offset < numBytes; offset += pageSize) {
+        bytes[offset] = 0;
+    }
+    return ptr;
+}
+
+bool
+ArchNumaFree(void *ptr, size_t /*numBytes*/)
+{
+    return VirtualFree(ptr, 0, MEM_RELEASE);
+}
+
+#else // not ARCH_OS_WINDOWS, assume POSIX (mmap)
+
+void *
+ArchNumaAllocOnCurrentNode(size_t numBytes)
+{
+    void *ptr = mmap(NULL, numBytes, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (!ptr || ptr == MAP_FAILED) {
+        return nullptr;
+    }
+    // Fault every page in from the calling thread; with the kernel's
+    // first-touch policy this places the pages on the caller's node.
+    size_t const pageSize = static_cast<size_t>(ArchGetPageSize());
+    volatile char *bytes = static_cast<volatile char *>(ptr);
+    for (size_t offset = 0; offset < numBytes; offset += pageSize) {
+        bytes[offset] = 0;
+    }
+    return ptr;
+}
+
+bool
+ArchNumaFree(void *ptr, size_t numBytes)
+{
+    return munmap(ptr, numBytes) == 0;
+}
+
+#endif // ARCH_OS_WINDOWS
+
+PXR_NAMESPACE_CLOSE_SCOPE
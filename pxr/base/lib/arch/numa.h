@@ -0,0 +1,89 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef ARCH_NUMA_H
+#define ARCH_NUMA_H
+
+/// \file arch/numa.h
+/// \ingroup group_arch_Multithreading
+/// Architecture-specific NUMA topology queries and thread placement.
+///
+/// On NUMA machines, memory accesses that cross socket boundaries cost
+/// substantially more than node-local accesses.  These functions expose the
+/// node topology and let callers restrict threads to a node so that the
+/// operating system's default first-touch policy places the memory those
+/// threads allocate and initialize on the same node.  On non-NUMA machines
+/// (and on platforms where the topology cannot be queried) the machine is
+/// reported as a single node and placement requests fail benignly.
+
+#include "pxr/pxr.h"
+#include "pxr/base/arch/api.h"
+
+#include <cstddef>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Return the number of NUMA nodes with processors on this machine, or 1 if
+/// the machine is not NUMA or the topology cannot be determined.
+/// \ingroup group_arch_Multithreading
+ARCH_API int ArchGetNumaNodeCount();
+
+/// Return the CPU ids belonging to NUMA node \p node, which must be in
+/// [0, ArchGetNumaNodeCount()).  Returns an empty vector if the topology
+/// cannot be determined or \p node is out of range.
+/// \ingroup group_arch_Multithreading
+ARCH_API std::vector<int> ArchGetNumaNodeCpus(int node);
+
+/// Restrict the calling thread to the CPUs of NUMA node \p node.  Memory the
+/// thread subsequently allocates and first touches is placed on that node by
+/// the operating system's first-touch policy.  Returns false if the request
+/// cannot be honored (unsupported platform, unknown topology, or \p node out
+/// of range), in which case the thread's affinity is unchanged.
+/// \ingroup group_arch_Multithreading
+ARCH_API bool ArchPinThreadToNumaNode(int node);
+
+/// Undo a previous ArchPinThreadToNumaNode() on the calling thread, allowing
+/// it to run on any CPU again.  Returns false if affinity cannot be set on
+/// this platform.
+/// \ingroup group_arch_Multithreading
+ARCH_API bool ArchUnpinThread();
+
+/// Allocate \p numBytes bytes of zero-initialized memory whose pages are
+/// placed on the NUMA node the calling thread is running on.  The pages are
+/// faulted in immediately so that placement follows the caller rather than
+/// whichever thread touches them first; pin the calling thread to a node
+/// beforehand to make the placement deterministic.  Free the memory with
+/// ArchNumaFree().  Returns nullptr in case of an error; check errno.
+/// \ingroup group_arch_Multithreading
+ARCH_API void *ArchNumaAllocOnCurrentNode(size_t numBytes);
+
+/// Return memory obtained with ArchNumaAllocOnCurrentNode() to the system.
+/// The \p numBytes argument must match the argument from the allocating
+/// call.  Returns false in case of an error; check errno.
+/// \ingroup group_arch_Multithreading
+ARCH_API bool ArchNumaFree(void *ptr, size_t numBytes);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // ARCH_NUMA_H
@@ -125,6 +125,16 @@ int main()
     mfm.get()[0] = 'T'; mfm.get()[2] = 's';
     ARCH_AXIOM(memcmp("Test", mfm.get(), strlen("Test")) == 0);
     mfm.reset();
+
+    // Mapping flags are hints only; a mapping with all of them requested
+    // must still succeed and read back the same contents.
+    ARCH_AXIOM((firstFile = ArchOpenFile(firstName.c_str(), "rb")) != NULL);
+    cfm = ArchMapFileReadOnly(firstFile, nullptr,
+                              ArchMapFlagHugePages | ArchMapFlagPopulate);
+    fclose(firstFile);
+    ARCH_AXIOM(cfm);
+    ARCH_AXIOM(memcmp(testContent, cfm.get(), strlen(testContent)) == 0);
+    cfm.reset();
     ArchUnlinkFile(firstName.c_str());
 
     // Test ArchPWrite and ArchPRead.
@@ -0,0 +1,71 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/arch/numa.h"
+#include "pxr/base/arch/error.h"
+
+#include <cstring>
+#include <set>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+int main()
+{
+    int const numNodes = ArchGetNumaNodeCount();
+    ARCH_AXIOM(numNodes >= 1);
+
+    // Where the topology is known, nodes must have disjoint CPU sets.
+    std::set<int> allCpus;
+    for (int node = 0; node < numNodes; ++node) {
+        for (int cpu: ArchGetNumaNodeCpus(node)) {
+            ARCH_AXIOM(cpu >= 0);
+            ARCH_AXIOM(allCpus.insert(cpu).second);
+        }
+    }
+
+    // Out-of-range nodes report no CPUs and refuse placement.
+    ARCH_AXIOM(ArchGetNumaNodeCpus(-1).empty());
+    ARCH_AXIOM(ArchGetNumaNodeCpus(numNodes).empty());
+    ARCH_AXIOM(!ArchPinThreadToNumaNode(numNodes));
+
+    // Pinning succeeds exactly when the node's CPUs are known.
+    if (!ArchGetNumaNodeCpus(0).empty()) {
+        ARCH_AXIOM(ArchPinThreadToNumaNode(0));
+        ARCH_AXIOM(ArchUnpinThread());
+    }
+
+    // Node-local allocations are zeroed, writable, and freeable.
+    size_t const numBytes = 1 << 20;
+    void *ptr = ArchNumaAllocOnCurrentNode(numBytes);
+    ARCH_AXIOM(ptr);
+    char *bytes = static_cast<char *>(ptr);
+    for (size_t i = 0; i < numBytes; ++i) {
+        ARCH_AXIOM(bytes[i] == 0);
+    }
+    memset(ptr, 0xab, numBytes);
+    ARCH_AXIOM(ArchNumaFree(ptr, numBytes));
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/gf/batchTransform.h"
+
+#include "pxr/base/arch/defines.h"
+
+// Use an explicit AVX2+FMA implementation when the build targets it.  On
+// other architectures the scalar kernels below are written so that
+// vectorizing compilers (e.g. for NEON) can unroll them: the matrix rows
+// are hoisted into locals and each output element is an independent
+// multiply-add chain.
+#if defined(ARCH_CPU_INTEL) && defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#define _GF_BATCH_TRANSFORM_AVX2
+#endif
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+#if defined(_GF_BATCH_TRANSFORM_AVX2)
+
+// The four rows of a GfMatrix4d held in vector registers.
+struct _Mat4dRows {
+    explicit _Mat4dRows(const GfMatrix4d &m) {
+        const double *d = m.GetArray();
+        r0 = _mm256_loadu_pd(d);
+        r1 = _mm256_loadu_pd(d + 4);
+        r2 = _mm256_loadu_pd(d + 8);
+        r3 = _mm256_loadu_pd(d + 12);
+    }
+    __m256d r0, r1, r2, r3;
+};
+
+// Returns the row vector (x, y, z, 1) times the matrix, i.e.
+// x*r0 + y*r1 + z*r2 + r3.
+inline __m256d
+_XformPoint(const _Mat4dRows &m, double x, double y, double z)
+{
+    __m256d r = _mm256_fmadd_pd(_mm256_set1_pd(z), m.r2, m.r3);
+    r = _mm256_fmadd_pd(_mm256_set1_pd(y), m.r1, r);
+    return _mm256_fmadd_pd(_mm256_set1_pd(x), m.r0, r);
+}
+
+// Returns the row vector (x, y, z, 0) times the matrix, i.e.
+// x*r0 + y*r1 + z*r2.
+inline __m256d
+_XformDir(const _Mat4dRows &m, double x, double y, double z)
+{
+    __m256d r = _mm256_mul_pd(_mm256_set1_pd(z), m.r2);
+    r = _mm256_fmadd_pd(_mm256_set1_pd(y), m.r1, r);
+    return _mm256_fmadd_pd(_mm256_set1_pd(x), m.r0, r);
+}
+
+// Computes the sixteen doubles of a*b, where b's rows are already in
+// registers.  a and out may refer to the same matrix: each of a's rows is
+// fully consumed before the corresponding row of out is written.
+inline void
+_MultMatrix(const double *a, const _Mat4dRows &b, double *out)
+{
+    for (int i = 0; i != 4; ++i, a += 4, out += 4) {
+        __m256d r = _mm256_fmadd_pd(_mm256_set1_pd(a[3]), b.r3,
+                    _mm256_mul_pd(_mm256_set1_pd(a[2]), b.r2));
+        r = _mm256_fmadd_pd(_mm256_set1_pd(a[1]), b.r1, r);
+        r = _mm256_fmadd_pd(_mm256_set1_pd(a[0]), b.r0, r);
+        _mm256_storeu_pd(out, r);
+    }
+}
+
+template <class Vec3>
+void
+_TransformPoints(const GfMatrix4d &m, Vec3 *points, size_t numPoints)
+{
+    const _Mat4dRows rows(m);
+    for (size_t i = 0; i != numPoints; ++i) {
+        Vec3 &p = points[i];
+        alignas(32) double v[4];
+        _mm256_store_pd(v, _XformPoint(rows, p[0], p[1], p[2]));
+        const double inv = (v[3] != 0.0) ? 1.0 / v[3] : 1.0;
+        p.Set(inv * v[0], inv * v[1], inv * v[2]);
+    }
+}
+
+template <class Vec3>
+void
+_TransformPointsAffine(const GfMatrix4d &m, Vec3 *points, size_t numPoints)
+{
+    const _Mat4dRows rows(m);
+    for (size_t i = 0; i != numPoints; ++i) {
+        Vec3 &p = points[i];
+        alignas(32) double v[4];
+        _mm256_store_pd(v, _XformPoint(rows, p[0], p[1], p[2]));
+        p.Set(v[0], v[1], v[2]);
+    }
+}
+
+template <class Vec3>
+void
+_TransformDirs(const GfMatrix4d &m, Vec3 *dirs, size_t numDirs)
+{
+    const _Mat4dRows rows(m);
+    for (size_t i = 0; i != numDirs; ++i) {
+        Vec3 &d = dirs[i];
+        alignas(32) double v[4];
+        _mm256_store_pd(v, _XformDir(rows, d[0], d[1], d[2]));
+        d.Set(v[0], v[1], v[2]);
+    }
+}
+
+#else // !_GF_BATCH_TRANSFORM_AVX2
+
+// The four rows of a GfMatrix4d hoisted into locals so that the per-element
+// loops below are free of loads from the matrix and can be vectorized.
+struct _Mat4dRows {
+    explicit _Mat4dRows(const GfMatrix4d &m)
+        : m00(m[0][0]), m01(m[0][1]), m02(m[0][2]), m03(m[0][3])
+        , m10(m[1][0]), m11(m[1][1]), m12(m[1][2]), m13(m[1][3])
+        , m20(m[2][0]), m21(m[2][1]), m22(m[2][2]), m23(m[2][3])
+        , m30(m[3][0]), m31(m[3][1]), m32(m[3][2]), m33(m[3][3]) {}
+    double m00, m01, m02, m03;
+    double m10, m11, m12, m13;
+    double m20, m21, m22, m23;
+    double m30, m31, m32, m33;
+};
+
+template <class Vec3>
+void
+_TransformPoints(const GfMatrix4d &m, Vec3 *points, size_t numPoints)
+{
+    const _Mat4dRows r(m);
+    for (size_t i = 0; i != numPoints; ++i) {
+        Vec3 &p = points[i];
+        const double x = p[0], y = p[1], z = p[2];
+        const double w = x*r.m03 + y*r.m13 + z*r.m23 + r.m33;
+        const double inv = (w != 0.0) ? 1.0 / w : 1.0;
+        p.Set(inv * (x*r.m00 + y*r.m10 + z*r.m20 + r.m30),
+              inv * (x*r.m01 + y*r.m11 + z*r.m21 + r.m31),
+              inv * (x*r.m02 + y*r.m12 + z*r.m22 + r.m32));
+    }
+}
+
+template <class Vec3>
+void
+_TransformPointsAffine(const GfMatrix4d &m, Vec3 *points, size_t numPoints)
+{
+    const _Mat4dRows r(m);
+    for (size_t i = 0; i != numPoints; ++i) {
+        Vec3 &p = points[i];
+        const double x = p[0], y = p[1], z = p[2];
+        p.Set(x*r.m00 + y*r.m10 + z*r.m20 + r.m30,
+              x*r.m01 + y*r.m11 + z*r.m21 + r.m31,
+              x*r.m02 + y*r.m12 + z*r.m22 + r.m32);
+    }
+}
+
+template <class Vec3>
+void
+_TransformDirs(const GfMatrix4d &m, Vec3 *dirs, size_t numDirs)
+{
+    const _Mat4dRows r(m);
+    for (size_t i = 0; i != numDirs; ++i) {
+        Vec3 &d = dirs[i];
+        const double x = d[0], y = d[1], z = d[2];
+        d.Set(x*r.m00 + y*r.m10 + z*r.m20,
+              x*r.m01 + y*r.m11 + z*r.m21,
+              x*r.m02 + y*r.m12 + z*r.m22);
+    }
+}
+
+#endif // _GF_BATCH_TRANSFORM_AVX2
+
+} // anonymous namespace
+
+void
+GfTransformPoints(const GfMatrix4d &m, GfVec3f *points, size_t numPoints)
+{
+    _TransformPoints(m, points, numPoints);
+}
+
+void
+GfTransformPoints(const GfMatrix4d &m, GfVec3d *points, size_t numPoints)
+{
+    _TransformPoints(m, points, numPoints);
+}
+
+void
+GfTransformPointsAffine(const GfMatrix4d &m, GfVec3f *points,
+                        size_t numPoints)
+{
+    _TransformPointsAffine(m, points, numPoints);
+}
+
+void
+GfTransformPointsAffine(const GfMatrix4d &m, GfVec3d *points,
+                        size_t numPoints)
+{
+    _TransformPointsAffine(m, points, numPoints);
+}
+
+void
+GfTransformDirs(const GfMatrix4d &m, GfVec3f *dirs, size_t numDirs)
+{
+    _TransformDirs(m, dirs, numDirs);
+}
+
+void
+GfTransformDirs(const GfMatrix4d &m, GfVec3d *dirs, size_t numDirs)
+{
+    _TransformDirs(m, dirs, numDirs);
+}
+
+void
+GfMultiplyMatrices(const GfMatrix4d *a, const GfMatrix4d *b,
+                   GfMatrix4d *out, size_t numMatrices)
+{
+#if defined(_GF_BATCH_TRANSFORM_AVX2)
+    for (size_t i = 0; i != numMatrices; ++i) {
+        // Load b[i] into registers before writing out[i], which may alias
+        // either input.
+        const _Mat4dRows rows(b[i]);
+        _MultMatrix(a[i].GetArray(), rows, out[i].GetArray());
+    }
+#else
+    for (size_t i = 0; i != numMatrices; ++i) {
+        out[i] = a[i] * b[i];
+    }
+#endif
+}
+
+void
+GfMultiplyMatrices(const GfMatrix4d *a, const GfMatrix4d &b,
+                   GfMatrix4d *out, size_t numMatrices)
+{
+#if defined(_GF_BATCH_TRANSFORM_AVX2)
+    const _Mat4dRows rows(b);
+    for (size_t i = 0; i != numMatrices; ++i) {
+        _MultMatrix(a[i].GetArray(), rows, out[i].GetArray());
+    }
+#else
+    for (size_t i = 0; i != numMatrices; ++i) {
+        out[i] = a[i] * b;
+    }
+#endif
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,111 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef GF_BATCHTRANSFORM_H
+#define GF_BATCHTRANSFORM_H
+
+/// \file gf/batchTransform.h
+/// \ingroup group_gf_LinearAlgebra
+/// Batch kernels that apply one GfMatrix4d to arrays of points, vectors,
+/// or matrices.
+///
+/// These functions are equivalent to calling the corresponding GfMatrix4d
+/// method on each element, but process the whole array in one call so that
+/// vectorized implementations can be used where the hardware supports them.
+/// The vectorized paths may contract multiplies and adds into fused
+/// operations, so results can differ from the scalar methods in the least
+/// significant bits.  Prefer these over an element-at-a-time loop when the
+/// array is large, e.g. when transforming the points of a gprim.
+
+#include "pxr/pxr.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/vec3d.h"
+#include "pxr/base/gf/vec3f.h"
+#include "pxr/base/gf/api.h"
+
+#include <cstddef>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Transforms each of the \p numPoints points in \p points by \p m in
+/// place, treating them as homogeneous points with an implicit fourth
+/// element of 1 and dividing by the transformed fourth element.  This is
+/// the batch equivalent of GfMatrix4d::Transform().
+/// \ingroup group_gf_LinearAlgebra
+GF_API
+void GfTransformPoints(const GfMatrix4d &m,
+                       GfVec3f *points, size_t numPoints);
+
+/// \overload
+/// \ingroup group_gf_LinearAlgebra
+GF_API
+void GfTransformPoints(const GfMatrix4d &m,
+                       GfVec3d *points, size_t numPoints);
+
+/// Transforms each of the \p numPoints points in \p points by \p m in
+/// place, assuming \p m is affine, i.e. its fourth column is (0,0,0,1).
+/// This is the batch equivalent of GfMatrix4d::TransformAffine().
+/// \ingroup group_gf_LinearAlgebra
+GF_API
+void GfTransformPointsAffine(const GfMatrix4d &m,
+                             GfVec3f *points, size_t numPoints);
+
+/// \overload
+/// \ingroup group_gf_LinearAlgebra
+GF_API
+void GfTransformPointsAffine(const GfMatrix4d &m,
+                             GfVec3d *points, size_t numPoints);
+
+/// Transforms each of the \p numDirs row vectors in \p dirs by \p m in
+/// place, using only the upper 3x3 of the matrix.  This is the batch
+/// equivalent of GfMatrix4d::TransformDir().
+/// \ingroup group_gf_LinearAlgebra
+GF_API
+void GfTransformDirs(const GfMatrix4d &m,
+                     GfVec3f *dirs, size_t numDirs);
+
+/// \overload
+/// \ingroup group_gf_LinearAlgebra
+GF_API
+void GfTransformDirs(const GfMatrix4d &m,
+                     GfVec3d *dirs, size_t numDirs);
+
+/// Computes <c>out[i] = a[i] * b[i]</c> for each of the \p numMatrices
+/// matrices.  \p out may alias \p a or \p b, so the multiplication may be
+/// performed in place.
+/// \ingroup group_gf_LinearAlgebra
+GF_API
+void GfMultiplyMatrices(const GfMatrix4d *a, const GfMatrix4d *b,
+                        GfMatrix4d *out, size_t numMatrices);
+
+/// Computes <c>out[i] = a[i] * b</c> for each of the \p numMatrices
+/// matrices.  \p out may alias \p a, so the multiplication may be
+/// performed in place.
+/// \ingroup group_gf_LinearAlgebra
+GF_API
+void GfMultiplyMatrices(const GfMatrix4d *a, const GfMatrix4d &b,
+                        GfMatrix4d *out, size_t numMatrices);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // GF_BATCHTRANSFORM_H
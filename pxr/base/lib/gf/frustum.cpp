@@ -1247,47 +1247,48 @@ GfFrustum::_CalculateFrustumPlanes() const
                 -(_planes[4].GetDistanceFromOrigin() + (far - near))) );
 }
 
-bool
-GfFrustum::IntersectsViewVolume(const GfBBox3d &bbox,
-                                const GfMatrix4d &viewProjMat)
+// This implementation is a standard technique employed in frustum
+// culling during rendering.  It correctly culls the box even from
+// view volumes that are not representable by a GfFrustum because of
+// skewed near/far planes, such as the ones produced by
+// presto shadowmap cameras.
+//
+// Its principle of operation:  If all 8 points of
+// the box, when transformed into clip coordinates,
+// are on one side or the other of each dimension's
+// clipping interval, then the entire
+// box volume must lie outside the view volume.
+static inline bool
+_BBoxIntersectsViewVolume(const GfBBox3d &bbox, const GfMatrix4d &viewProjMat)
 {
-    // This implementation is a standard technique employed in frustum
-    // culling during rendering.  It correctly culls the box even from
-    // view volumes that are not representable by a GfFrustum because of
-    // skewed near/far planes, such as the ones produced by
-    // presto shadowmap cameras.
-    //
-    // Its principle of operation:  If all 8 points of
-    // the box, when transformed into clip coordinates,
-    // are on one side or the other of each dimension's
-    // clipping interval, then the entire
-    // box volume must lie outside the view volume.
-
-    // Compute the 8 points of the bbox in
-    // bbox local space.
-    GfVec4d points[8];
+    // Compute the composed transform taking bbox local space points
+    // directly into clip space.
+    const GfMatrix4d m = bbox.GetMatrix() * viewProjMat;
     const GfVec3d &localMin = bbox.GetRange().GetMin();
     const GfVec3d &localMax = bbox.GetRange().GetMax();
-    points[0] = GfVec4d(localMin[0], localMin[1], localMin[2], 1);
-    points[1] = GfVec4d(localMin[0], localMin[1], localMax[2], 1);
-    points[2] = GfVec4d(localMin[0], localMax[1], localMin[2], 1);
-    points[3] = GfVec4d(localMin[0], localMax[1], localMax[2], 1);
-    points[4] = GfVec4d(localMax[0], localMin[1], localMin[2], 1);
-    points[5] = GfVec4d(localMax[0], localMin[1], localMax[2], 1);
-    points[6] = GfVec4d(localMax[0], localMax[1], localMin[2], 1);
-    points[7] = GfVec4d(localMax[0], localMax[1], localMax[2], 1);
-
-    // Transform bbox local space points into clip space
-    for (int i = 0; i < 8; ++i) {
-        points[i] = points[i] * bbox.GetMatrix() * viewProjMat;
-    }
+
+    // A bbox corner (x, y, z, 1) lands in clip space at
+    // x*row0 + y*row1 + z*row2 + row3, where each coordinate is either
+    // the min or the max for its axis.  Precompute the six scaled rows
+    // once so each of the 8 corners costs three vector adds instead of
+    // a full matrix transform.
+    const GfVec4d minRows[3] = { localMin[0] * m.GetRow(0),
+                                 localMin[1] * m.GetRow(1),
+                                 localMin[2] * m.GetRow(2) };
+    const GfVec4d maxRows[3] = { localMax[0] * m.GetRow(0),
+                                 localMax[1] * m.GetRow(1),
+                                 localMax[2] * m.GetRow(2) };
+    const GfVec4d transRow = m.GetRow(3);
 
     // clipFlags is a 6-bit field with one bit per +/- per x,y,z,
     // or one per frustum plane.  If the points overlap the
     // clip volume in any axis, then clipFlags will be 0x3f (0b111111).
     int clipFlags = 0;
     for (int i = 0; i < 8; ++i) {
-        GfVec4d clipPos = points[i];
+        const GfVec4d clipPos =
+            ((i & 1) ? maxRows[0] : minRows[0]) +
+            ((i & 2) ? maxRows[1] : minRows[1]) +
+            ((i & 4) ? maxRows[2] : minRows[2]) + transRow;
 
         // flag is used as a 6-bit shift register, as we append
         // results of plane-side testing.  OR-ing all the flags
@@ -1295,7 +1296,7 @@ GfFrustum::IntersectsViewVolume(const GfBBox3d &bbox,
         // have been on.
         int flag = 0;
         for (int j = 0; j < 3; ++j) {
-            // We use +/-clipPos[3] as the interval bound instead of 
+            // We use +/-clipPos[3] as the interval bound instead of
             // 1,-1 because these coordinates are not normalized.
             flag = (flag << 1) | (clipPos[j] <  clipPos[3]);
             flag = (flag << 1) | (clipPos[j] > -clipPos[3]);
@@ -1306,6 +1307,30 @@ GfFrustum::IntersectsViewVolume(const GfBBox3d &bbox,
     return clipFlags == 0x3f;
 }
 
+bool
+GfFrustum::IntersectsViewVolume(const GfBBox3d &bbox,
+                                const GfMatrix4d &viewProjMat)
+{
+    return _BBoxIntersectsViewVolume(bbox, viewProjMat);
+}
+
+void
+GfFrustum::IntersectsViewVolume(const GfBBox3d *bboxes,
+                                size_t numBBoxes,
+                                const GfMatrix4d &viewProjMat,
+                                uint64_t *results)
+{
+    const size_t numWords = (numBBoxes + 63) / 64;
+    for (size_t w = 0; w != numWords; ++w) {
+        results[w] = 0;
+    }
+    for (size_t i = 0; i != numBBoxes; ++i) {
+        if (_BBoxIntersectsViewVolume(bboxes[i], viewProjMat)) {
+            results[i / 64] |= UINT64_C(1) << (i % 64);
+        }
+    }
+}
+
 void
 GfFrustum::SetPositionAndRotationFromMatrix(
     const GfMatrix4d &camToWorldXf)
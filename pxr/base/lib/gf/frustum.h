@@ -41,6 +41,7 @@
 
 #include <boost/functional/hash.hpp>
 
+#include <cstdint>
 #include <iosfwd>
 #include <vector>
 
@@ -546,6 +547,21 @@ class GfFrustum {
     GF_API static bool  IntersectsViewVolume(const GfBBox3d &bbox,
                                              const GfMatrix4d &vpMat);
 
+    /// Tests a batch of bbox volumes against the view volume given by the
+    /// view-projection matrix, with the same semantics as the single-bbox
+    /// overload.  On return, bit \c i of \p results (that is, bit
+    /// <tt>i % 64</tt> of word <tt>i / 64</tt>) is set if and only if
+    /// \p bboxes[i] intersects the view volume.  \p results must point to
+    /// at least <tt>(numBBoxes + 63) / 64</tt> words.
+    ///
+    /// This is equivalent to calling the single-bbox overload once per
+    /// box, but amortizes the per-call overhead, which matters when
+    /// culling large numbers of bounds per frame.
+    GF_API static void  IntersectsViewVolume(const GfBBox3d *bboxes,
+                                             size_t numBBoxes,
+                                             const GfMatrix4d &vpMat,
+                                             uint64_t *results);
+
     ///@}
 
   private:
@@ -0,0 +1,168 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/gf/batchTransform.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/rotation.h"
+#include "pxr/base/gf/vec3d.h"
+#include "pxr/base/gf/vec3f.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+#include <cmath>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// The batch kernels may use fused multiply-adds, so compare against the
+// scalar GfMatrix4d methods with a small tolerance.
+static bool
+_IsClose(const GfVec3d &a, const GfVec3d &b)
+{
+    return (a - b).GetLength() <= 1e-9 * (1.0 + b.GetLength());
+}
+
+static bool
+_IsClose(const GfVec3f &a, const GfVec3f &b)
+{
+    return (a - b).GetLength() <= 1e-5f * (1.0f + b.GetLength());
+}
+
+static bool
+_IsClose(const GfMatrix4d &a, const GfMatrix4d &b)
+{
+    for (int i = 0; i != 4; ++i) {
+        for (int j = 0; j != 4; ++j) {
+            if (std::fabs(a[i][j] - b[i][j]) > 1e-9 * (1.0 + fabs(b[i][j]))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <class Vec3>
+static std::vector<Vec3>
+_MakeVecs(size_t n)
+{
+    std::vector<Vec3> vecs(n);
+    for (size_t i = 0; i != n; ++i) {
+        vecs[i] = Vec3(0.25 * i - 3.0, 1.5 * i, -0.125 * i + 7.0);
+    }
+    return vecs;
+}
+
+template <class Vec3>
+static void
+_TestTransforms(const GfMatrix4d &m, size_t n)
+{
+    const std::vector<Vec3> orig = _MakeVecs<Vec3>(n);
+
+    std::vector<Vec3> points = orig;
+    GfTransformPoints(m, points.data(), points.size());
+    for (size_t i = 0; i != n; ++i) {
+        TF_AXIOM(_IsClose(points[i], m.Transform(orig[i])));
+    }
+
+    points = orig;
+    GfTransformPointsAffine(m, points.data(), points.size());
+    for (size_t i = 0; i != n; ++i) {
+        TF_AXIOM(_IsClose(points[i], m.TransformAffine(orig[i])));
+    }
+
+    std::vector<Vec3> dirs = orig;
+    GfTransformDirs(m, dirs.data(), dirs.size());
+    for (size_t i = 0; i != n; ++i) {
+        TF_AXIOM(_IsClose(dirs[i], m.TransformDir(orig[i])));
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    GfMatrix4d affine;
+    affine.SetTransform(GfRotation(GfVec3d(1, 2, 3), 37.0),
+                        GfVec3d(10.0, -20.0, 30.0));
+    affine = affine * GfMatrix4d(1.0).SetScale(GfVec3d(2.0, 0.5, -1.5));
+
+    // A matrix with a projective fourth column, to exercise the
+    // homogeneous divide in GfTransformPoints.
+    GfMatrix4d projective = affine;
+    projective[0][3] = 0.125;
+    projective[2][3] = -0.25;
+
+    // Sizes chosen to hit the empty, single-element, and long-array cases.
+    for (size_t n : {0, 1, 7, 1000}) {
+        _TestTransforms<GfVec3f>(affine, n);
+        _TestTransforms<GfVec3d>(affine, n);
+        _TestTransforms<GfVec3f>(projective, n);
+        _TestTransforms<GfVec3d>(projective, n);
+    }
+
+    // Pairwise and array-times-constant matrix products, including the
+    // in-place aliasing cases.
+    {
+        const size_t n = 100;
+        std::vector<GfMatrix4d> a(n), b(n), expected(n);
+        for (size_t i = 0; i != n; ++i) {
+            a[i].SetTransform(GfRotation(GfVec3d(1, 0, 1), 3.0 * i),
+                              GfVec3d(0.5 * i, -1.0 * i, 2.0));
+            b[i].SetTransform(GfRotation(GfVec3d(0, 1, 0), -2.0 * i),
+                              GfVec3d(1.0, 0.25 * i, -3.0));
+            expected[i] = a[i] * b[i];
+        }
+
+        std::vector<GfMatrix4d> out(n);
+        GfMultiplyMatrices(a.data(), b.data(), out.data(), n);
+        for (size_t i = 0; i != n; ++i) {
+            TF_AXIOM(_IsClose(out[i], expected[i]));
+        }
+
+        // In place, aliasing the second input as skinning code does.
+        std::vector<GfMatrix4d> inPlace = b;
+        GfMultiplyMatrices(a.data(), inPlace.data(), inPlace.data(), n);
+        for (size_t i = 0; i != n; ++i) {
+            TF_AXIOM(_IsClose(inPlace[i], expected[i]));
+        }
+
+        for (size_t i = 0; i != n; ++i) {
+            expected[i] = a[i] * affine;
+        }
+        GfMultiplyMatrices(a.data(), affine, out.data(), n);
+        for (size_t i = 0; i != n; ++i) {
+            TF_AXIOM(_IsClose(out[i], expected[i]));
+        }
+
+        // In place, aliasing the input array.
+        inPlace = a;
+        GfMultiplyMatrices(inPlace.data(), affine, inPlace.data(), n);
+        for (size_t i = 0; i != n; ++i) {
+            TF_AXIOM(_IsClose(inPlace[i], expected[i]));
+        }
+    }
+
+    printf("Test SUCCEEDED\n");
+    return 0;
+}
@@ -0,0 +1,121 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/gf/bbox3d.h"
+#include "pxr/base/gf/frustum.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/range3d.h"
+#include "pxr/base/gf/rotation.h"
+#include "pxr/base/gf/vec3d.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+#include <cstdlib>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static double
+_Rand(double lo, double hi)
+{
+    return lo + (hi - lo) * (double(rand()) / RAND_MAX);
+}
+
+int
+main()
+{
+    GfFrustum frustum;
+    frustum.SetPerspective(45.0, 1.0, 1.0, 100.0);
+    const GfMatrix4d viewProj =
+        frustum.ComputeViewMatrix() * frustum.ComputeProjectionMatrix();
+
+    // Boxes straddling the view direction at increasing depths; the first
+    // is in front of the near plane and the last is beyond the far plane.
+    std::vector<GfBBox3d> bboxes;
+    bboxes.push_back(GfBBox3d(
+        GfRange3d(GfVec3d(-0.1, -0.1, -0.5), GfVec3d(0.1, 0.1, -0.4))));
+    bboxes.push_back(GfBBox3d(
+        GfRange3d(GfVec3d(-1, -1, -11), GfVec3d(1, 1, -10))));
+    bboxes.push_back(GfBBox3d(
+        GfRange3d(GfVec3d(-1, -1, -50), GfVec3d(1, 1, -49))));
+    bboxes.push_back(GfBBox3d(
+        GfRange3d(GfVec3d(-1, -1, -300), GfVec3d(1, 1, -200))));
+    // A box with a nontrivial local transform.
+    bboxes.push_back(GfBBox3d(
+        GfRange3d(GfVec3d(-1, -1, -1), GfVec3d(1, 1, 1)),
+        GfMatrix4d().SetTranslate(GfVec3d(0, 0, -20))));
+    // Empty batch padding: boxes far off to the side.
+    for (size_t i = bboxes.size(); i < 70; ++i) {
+        bboxes.push_back(GfBBox3d(
+            GfRange3d(GfVec3d(999, 999, -20), GfVec3d(1000, 1000, -19))));
+    }
+
+    // The batch API must agree with the single-bbox overload bit for bit,
+    // including across the 64-bit word boundary.
+    std::vector<uint64_t> bits((bboxes.size() + 63) / 64);
+    GfFrustum::IntersectsViewVolume(
+        bboxes.data(), bboxes.size(), viewProj, bits.data());
+    for (size_t i = 0; i != bboxes.size(); ++i) {
+        const bool single =
+            GfFrustum::IntersectsViewVolume(bboxes[i], viewProj);
+        const bool batched = (bits[i / 64] >> (i % 64)) & 1;
+        TF_AXIOM(single == batched);
+    }
+
+    // Spot-check expected visibility.
+    TF_AXIOM(!((bits[0] >> 0) & 1));    // in front of near plane
+    TF_AXIOM(  (bits[0] >> 1) & 1);     // inside
+    TF_AXIOM(  (bits[0] >> 2) & 1);     // inside
+    TF_AXIOM(!((bits[0] >> 3) & 1));    // beyond far plane
+    TF_AXIOM(  (bits[0] >> 4) & 1);     // transformed, inside
+    TF_AXIOM(!((bits[1] >> 5) & 1));    // word 2, off to the side
+
+    // Randomized agreement with the single-bbox overload.
+    srand(12345);
+    std::vector<GfBBox3d> random;
+    for (size_t i = 0; i != 1000; ++i) {
+        GfVec3d lo(_Rand(-40, 40), _Rand(-40, 40), _Rand(-150, 50));
+        GfVec3d size(_Rand(0, 10), _Rand(0, 10), _Rand(0, 10));
+        GfMatrix4d xf(GfRotation(
+            GfVec3d(_Rand(-1, 1), _Rand(-1, 1), _Rand(-1, 1)).GetNormalized(),
+            _Rand(0, 360)), GfVec3d(_Rand(-5, 5), _Rand(-5, 5), _Rand(-5, 5)));
+        random.push_back(GfBBox3d(GfRange3d(lo, lo + size), xf));
+    }
+    std::vector<uint64_t> randomBits((random.size() + 63) / 64);
+    GfFrustum::IntersectsViewVolume(
+        random.data(), random.size(), viewProj, randomBits.data());
+    for (size_t i = 0; i != random.size(); ++i) {
+        const bool single =
+            GfFrustum::IntersectsViewVolume(random[i], viewProj);
+        const bool batched = (randomBits[i / 64] >> (i % 64)) & 1;
+        TF_AXIOM(single == batched);
+    }
+
+    // Zero boxes is a no-op.
+    GfFrustum::IntersectsViewVolume(nullptr, 0, viewProj, nullptr);
+
+    printf("OK\n");
+    return 0;
+}
@@ -132,6 +132,56 @@ public:
     std::vector<JsObject::mapped_type> values;
 };
 
+// Adapts the rapidjson SAX events to a client-provided JsParseHandler.
+struct _HandlerAdapter
+    : public rj::BaseReaderHandler<rj::UTF8<>, _HandlerAdapter>
+{
+    explicit _HandlerAdapter(JsParseHandler* handler) : _handler(handler) { }
+
+    bool Null() {
+        return _handler->Null();
+    }
+    bool Bool(bool b) {
+        return _handler->Bool(b);
+    }
+    bool Int(int i) {
+        return _handler->Int64(i);
+    }
+    bool Uint(unsigned u) {
+        return _handler->Int64(u);
+    }
+    bool Int64(int64_t i) {
+        return _handler->Int64(i);
+    }
+    bool Uint64(uint64_t u) {
+        return _handler->UInt64(u);
+    }
+    bool Double(double d) {
+        return _handler->Real(d);
+    }
+    bool String(const char* str, rj::SizeType length, bool /* copy */) {
+        return _handler->String(str, length);
+    }
+    bool Key(const char* str, rj::SizeType length, bool /* copy */) {
+        return _handler->Key(str, length);
+    }
+    bool StartObject() {
+        return _handler->BeginObject();
+    }
+    bool EndObject(rj::SizeType memberCount) {
+        return _handler->EndObject(memberCount);
+    }
+    bool StartArray() {
+        return _handler->BeginArray();
+    }
+    bool EndArray(rj::SizeType elementCount) {
+        return _handler->EndArray(elementCount);
+    }
+
+private:
+    JsParseHandler* _handler;
+};
+
 // This class is needed to override writing out doubles. There is a bug in 
 // rapidJSON when writing out some double values. These classes uses the Tf
 // library to do the conversion instead.
@@ -222,6 +272,103 @@ _JsValueToImplValue(
 }
 
 
+// Converts the character offset reported by rapidjson for a parse error
+// into the line/column information exposed through JsParseError.
+static void
+_ExtractParseError(
+    const std::string& data,
+    const rj::ParseResult& result,
+    JsParseError* error)
+{
+    if (!error) {
+        return;
+    }
+
+    // Rapidjson only provides a character offset for errors, not
+    // line/column information like other parsers (like json_spirit,
+    // upon which this library was previously implemented). Analyze
+    // the input data to convert the offset to line/column.
+    error->line = 1;
+    const size_t eoff = result.Offset();
+    size_t nlpos = 0;
+    for (size_t i = 0; i < eoff; ++i) {
+        if (data[i] == '\n') {
+            error->line++;
+            nlpos = i;
+        }
+    }
+    error->column = eoff - nlpos;
+    error->reason = rj::GetParseError_En(result.Code());
+}
+
+JsParseHandler::~JsParseHandler() = default;
+
+bool
+JsParseHandler::Null()
+{
+    return true;
+}
+
+bool
+JsParseHandler::Bool(bool)
+{
+    return true;
+}
+
+bool
+JsParseHandler::Int64(int64_t)
+{
+    return true;
+}
+
+bool
+JsParseHandler::UInt64(uint64_t)
+{
+    return true;
+}
+
+bool
+JsParseHandler::Real(double)
+{
+    return true;
+}
+
+bool
+JsParseHandler::String(const char*, size_t)
+{
+    return true;
+}
+
+bool
+JsParseHandler::Key(const char*, size_t)
+{
+    return true;
+}
+
+bool
+JsParseHandler::BeginObject()
+{
+    return true;
+}
+
+bool
+JsParseHandler::EndObject(size_t)
+{
+    return true;
+}
+
+bool
+JsParseHandler::BeginArray()
+{
+    return true;
+}
+
+bool
+JsParseHandler::EndArray(size_t)
+{
+    return true;
+}
+
 JsValue
 JsParseStream(
     std::istream& istr,
@@ -260,23 +407,7 @@ JsParseString(
             ss, handler);
 
     if (!result) {
-        if (error) {
-            // Rapidjson only provides a character offset for errors, not
-            // line/column information like other parsers (like json_spirit,
-            // upon which this library was previously implemented). Analyze
-            // the input data to convert the offset to line/column.
-            error->line = 1;
-            const size_t eoff = result.Offset();
-            size_t nlpos = 0;
-            for (size_t i = 0; i < eoff; ++i) {
-                if (data[i] == '\n') {
-                    error->line++;
-                    nlpos = i;
-                }
-            }
-            error->column = eoff - nlpos;
-            error->reason = rj::GetParseError_En(result.Code());
-        }
+        _ExtractParseError(data, result, error);
         return JsValue();
     }
 
@@ -286,6 +417,57 @@ JsParseString(
     return handler.values.empty() ? JsValue() : handler.values.front();
 }
 
+bool
+JsParseStream(
+    std::istream& istr,
+    JsParseHandler* handler,
+    JsParseError* error)
+{
+    if (!istr) {
+        TF_CODING_ERROR("Stream error");
+        return false;
+    }
+
+    // As in the JsValue overload above, read the stream into a string so
+    // that parse errors can be reported with line/column information.
+    return JsParseString(std::string(
+        (std::istreambuf_iterator<char>(istr)),
+         std::istreambuf_iterator<char>()),
+        handler, error);
+}
+
+bool
+JsParseString(
+    const std::string& data,
+    JsParseHandler* handler,
+    JsParseError* error)
+{
+    if (!handler) {
+        TF_CODING_ERROR("Null handler");
+        return false;
+    }
+
+    if (data.empty()) {
+        TF_CODING_ERROR("JSON string is empty");
+        return false;
+    }
+
+    _HandlerAdapter adapter(handler);
+    rj::Reader reader;
+    rj::StringStream ss(data.c_str());
+    // Need Full precision flag to round trip double values correctly.
+    rj::ParseResult result =
+        reader.Parse<rj::kParseFullPrecisionFlag|rj::kParseStopWhenDoneFlag>(
+            ss, adapter);
+
+    if (!result) {
+        _ExtractParseError(data, result, error);
+        return false;
+    }
+
+    return true;
+}
+
 void
 JsWriteToStream(
     const JsValue& value,
@@ -48,6 +48,62 @@ struct JsParseError {
     std::string reason;
 };
 
+/// \class JsParseHandler
+///
+/// This class provides a callback interface that is invoked by JsParseStream
+/// and JsParseString as elements are encountered in the JSON input. It is the
+/// reading counterpart of JsWriter: consumers that only need to extract a few
+/// fields from a large document can implement this interface to avoid
+/// materializing the full JsValue tree.
+///
+/// The default implementation of every callback accepts the element and
+/// continues parsing; consumers override only the callbacks they care about.
+/// Returning \c false from any callback stops the parse, which is then
+/// reported to the caller as a failure.
+///
+class JsParseHandler {
+public:
+    JS_API virtual ~JsParseHandler();
+
+    /// Called when a null value is parsed.
+    JS_API virtual bool Null();
+
+    /// Called when a boolean value is parsed.
+    JS_API virtual bool Bool(bool value);
+
+    /// Called when an integer value is parsed. Unsigned values are reported
+    /// here when they are representable as int64_t.
+    JS_API virtual bool Int64(int64_t value);
+
+    /// Called when an unsigned integer value too large for int64_t is parsed.
+    JS_API virtual bool UInt64(uint64_t value);
+
+    /// Called when a real value is parsed.
+    JS_API virtual bool Real(double value);
+
+    /// Called when a string value is parsed. The string is only guaranteed
+    /// to be valid for the duration of the call.
+    JS_API virtual bool String(const char* value, size_t length);
+
+    /// Called when an object key is parsed. The string is only guaranteed
+    /// to be valid for the duration of the call.
+    JS_API virtual bool Key(const char* key, size_t length);
+
+    /// Called when the start of an object is parsed.
+    JS_API virtual bool BeginObject();
+
+    /// Called when the end of an object is parsed, after all of its members
+    /// have been reported.
+    JS_API virtual bool EndObject(size_t numMembers);
+
+    /// Called when the start of an array is parsed.
+    JS_API virtual bool BeginArray();
+
+    /// Called when the end of an array is parsed, after all of its elements
+    /// have been reported.
+    JS_API virtual bool EndArray(size_t numElements);
+};
+
 /// Parse the contents of input stream \p istr and return a JsValue. On
 /// failure, this returns a null JsValue.
 JS_API
@@ -58,6 +114,22 @@ JsValue JsParseStream(std::istream& istr, JsParseError* error = 0);
 JS_API
 JsValue JsParseString(const std::string& data, JsParseError* error = 0);
 
+/// Parse the contents of input stream \p istr, reporting elements to
+/// \p handler as they are encountered rather than constructing a JsValue.
+/// Returns \c true if the input was parsed to completion, \c false if a
+/// parse error was encountered or \p handler stopped the parse.
+JS_API
+bool JsParseStream(std::istream& istr, JsParseHandler* handler,
+                   JsParseError* error = 0);
+
+/// Parse the contents of the JSON string \p data, reporting elements to
+/// \p handler as they are encountered rather than constructing a JsValue.
+/// Returns \c true if the input was parsed to completion, \c false if a
+/// parse error was encountered or \p handler stopped the parse.
+JS_API
+bool JsParseString(const std::string& data, JsParseHandler* handler,
+                   JsParseError* error = 0);
+
 /// Convert the JsValue \p value to JSON and write the result to output stream
 /// \p ostr.
 JS_API
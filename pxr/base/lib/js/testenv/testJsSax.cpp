@@ -0,0 +1,149 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+///
+/// \file testenv/testJsSax.cpp
+
+#include "pxr/pxr.h"
+#include "pxr/base/js/json.h"
+#include "pxr/base/tf/diagnosticLite.h"
+
+#include <sstream>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static const char* _TestJson =
+    "{\n"
+    "    \"Name\": \"TestPlugin\",\n"
+    "    \"Count\": 42,\n"
+    "    \"Big\": 18446744073709551615,\n"
+    "    \"Scale\": 1.5,\n"
+    "    \"Enabled\": true,\n"
+    "    \"Extra\": null,\n"
+    "    \"Types\": [ \"a\", \"b\", \"c\" ],\n"
+    "    \"Nested\": { \"Depth\": 2 }\n"
+    "}\n";
+
+// Counts every event reported during the parse.
+class _CountingHandler : public JsParseHandler {
+public:
+    bool Null() override { ++nulls; return true; }
+    bool Bool(bool) override { ++bools; return true; }
+    bool Int64(int64_t) override { ++ints; return true; }
+    bool UInt64(uint64_t) override { ++uints; return true; }
+    bool Real(double) override { ++reals; return true; }
+    bool String(const char*, size_t) override { ++strings; return true; }
+    bool Key(const char*, size_t) override { ++keys; return true; }
+    bool BeginObject() override { ++objects; return true; }
+    bool EndObject(size_t numMembers) override {
+        members += numMembers;
+        return true;
+    }
+    bool BeginArray() override { ++arrays; return true; }
+    bool EndArray(size_t numElements) override {
+        elements += numElements;
+        return true;
+    }
+
+    size_t nulls = 0, bools = 0, ints = 0, uints = 0, reals = 0;
+    size_t strings = 0, keys = 0, objects = 0, arrays = 0;
+    size_t members = 0, elements = 0;
+};
+
+// Extracts the value of a single top-level key, then stops the parse.
+class _SingleKeyHandler : public JsParseHandler {
+public:
+    explicit _SingleKeyHandler(const std::string& key) : _key(key) { }
+
+    bool Key(const char* key, size_t length) override {
+        _atKey = (_key == std::string(key, length));
+        return true;
+    }
+    bool String(const char* value, size_t length) override {
+        if (_atKey) {
+            found = std::string(value, length);
+            return false;
+        }
+        return true;
+    }
+
+    std::string found;
+
+private:
+    std::string _key;
+    bool _atKey = false;
+};
+
+int main(int argc, char const *argv[])
+{
+    // Parsing with a handler that accepts everything reports each element
+    // exactly once.
+    {
+        _CountingHandler handler;
+        JsParseError error;
+        TF_AXIOM(JsParseString(_TestJson, &handler, &error));
+        TF_AXIOM(error.reason.empty());
+
+        TF_AXIOM(handler.nulls == 1);
+        TF_AXIOM(handler.bools == 1);
+        TF_AXIOM(handler.ints == 2);
+        TF_AXIOM(handler.uints == 1);
+        TF_AXIOM(handler.reals == 1);
+        TF_AXIOM(handler.strings == 4);
+        TF_AXIOM(handler.keys == 9);
+        TF_AXIOM(handler.objects == 2);
+        TF_AXIOM(handler.arrays == 1);
+        TF_AXIOM(handler.members == 9);
+        TF_AXIOM(handler.elements == 3);
+    }
+
+    // The stream overload reports the same events as the string overload.
+    {
+        _CountingHandler handler;
+        std::istringstream istr(_TestJson);
+        TF_AXIOM(JsParseStream(istr, &handler));
+        TF_AXIOM(handler.keys == 9);
+    }
+
+    // A handler may stop the parse early once it has what it needs; this is
+    // reported as a failure, but the extracted data is still available.
+    {
+        _SingleKeyHandler handler("Name");
+        TF_AXIOM(!JsParseString(_TestJson, &handler));
+        TF_AXIOM(handler.found == "TestPlugin");
+    }
+
+    // Parse errors are reported with line/column information, as with the
+    // JsValue-returning overloads.
+    {
+        JsParseHandler handler;
+        JsParseError error;
+        TF_AXIOM(!JsParseString("{ \"key\": 1,\n  \"bad\" }", &handler,
+                                &error));
+        TF_AXIOM(error.line == 2);
+        TF_AXIOM(!error.reason.empty());
+    }
+
+    return 0;
+}
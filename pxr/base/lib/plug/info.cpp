@@ -25,9 +25,12 @@
 #include "pxr/pxr.h"
 #include "pxr/base/plug/info.h"
 #include "pxr/base/plug/debugCodes.h"
+#include "pxr/base/arch/fileSystem.h"
 #include "pxr/base/js/json.h"
+#include "pxr/base/tf/atomicOfstreamWrapper.h"
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/getenv.h"
 #include "pxr/base/tf/pathUtils.h"
 #include "pxr/base/tf/staticTokens.h"
 #include "pxr/base/tf/stringUtils.h"
@@ -35,6 +38,7 @@
 #include <tbb/task_arena.h>
 #include <tbb/task_group.h>
 #include <fstream>
+#include <mutex>
 #include <regex>
 #include <set>
 
@@ -60,8 +64,18 @@ TF_DEFINE_PRIVATE_TOKENS(_Tokens,
     ((RootKey,              "Root"))
     ((LibraryPathKey,       "LibraryPath"))
     ((ResourcePathKey,      "ResourcePath"))
+
+    // Cache file keys
+    ((CacheVersionKey,      "Version"))
+    ((CacheSearchPathsKey,  "SearchPaths"))
+    ((CacheFilesKey,        "Files"))
+    ((CachePluginsKey,      "Plugins"))
     );
 
+// Version number for the plugInfo cache file format.  Bump this when the
+// format or the semantics of any recorded field changes.
+static const int _CacheFormatVersion = 1;
+
 struct _ReadContext {
     _ReadContext(Plug_TaskArena& taskArena_,
                  const AddVisitedPathCallback& addVisitedPath_,
@@ -712,6 +726,183 @@ error:
     type = UnknownType;
 }
 
+
+namespace {
+
+// Serialize \p metadata as an object in the same form as an element of a
+// plugInfo.json "Plugins" array, with all paths made absolute so that no
+// path merging is required when reading it back.
+JsObject
+_CacheEntryFromMetadata(const Plug_RegistrationMetadata& metadata)
+{
+    JsObject entry;
+    switch (metadata.type) {
+    case Plug_RegistrationMetadata::LibraryType:
+        entry[_Tokens->TypeKey] = JsValue("library"); break;
+#ifdef PXR_PYTHON_SUPPORT_ENABLED
+    case Plug_RegistrationMetadata::PythonType:
+        entry[_Tokens->TypeKey] = JsValue("python"); break;
+#endif // PXR_PYTHON_SUPPORT_ENABLED
+    case Plug_RegistrationMetadata::ResourceType:
+        entry[_Tokens->TypeKey] = JsValue("resource"); break;
+    default:
+        break;
+    }
+    entry[_Tokens->NameKey] = JsValue(metadata.pluginName);
+    entry[_Tokens->RootKey] = JsValue(metadata.pluginPath);
+    entry[_Tokens->LibraryPathKey] = JsValue(metadata.libraryPath);
+    entry[_Tokens->ResourcePathKey] = JsValue(metadata.resourcePath);
+    entry[_Tokens->InfoKey] = JsValue(metadata.plugInfo);
+    return entry;
+}
+
+// Attempt to satisfy a plugin scan over \p pathnames from the cache file at
+// \p cachePath.  Returns true if the cache was valid and all plugins were
+// delivered from it; false means the caller must do a full scan.  The cache
+// is valid if it was built for the same search paths and none of the
+// plugInfo files it recorded have changed on disk.  Note that this does not
+// detect files newly added under previously scanned wildcard directories;
+// the cache is intended for deployments where install trees are immutable.
+bool
+_ReadPlugInfoCache(
+    const std::string& cachePath,
+    const std::vector<std::string>& pathnames,
+    const AddVisitedPathCallback& addVisitedPath,
+    const AddPluginCallback& addPlugin)
+{
+    std::ifstream ifs(cachePath.c_str());
+    if (!ifs.is_open()) {
+        TF_DEBUG(PLUG_INFO_SEARCH).
+            Msg("No plugInfo cache at %s\n", cachePath.c_str());
+        return false;
+    }
+
+    JsParseError error;
+    const JsValue cache = JsParseStream(ifs, &error);
+    if (!cache.IsObject()) {
+        TF_DEBUG(PLUG_INFO_SEARCH).
+            Msg("Ignoring unreadable plugInfo cache %s (line %d, col %d)\n",
+                cachePath.c_str(), error.line, error.column);
+        return false;
+    }
+    const JsObject& top = cache.GetJsObject();
+
+    // Check the format version.
+    JsObject::const_iterator i = top.find(_Tokens->CacheVersionKey);
+    if (i == top.end() || !i->second.IsInt() ||
+        i->second.GetInt() != _CacheFormatVersion) {
+        return false;
+    }
+
+    // The cache is only valid for the same search paths.
+    i = top.find(_Tokens->CacheSearchPathsKey);
+    if (i == top.end() || !i->second.IsArrayOf<std::string>() ||
+        i->second.GetArrayOf<std::string>() != pathnames) {
+        TF_DEBUG(PLUG_INFO_SEARCH).
+            Msg("Ignoring plugInfo cache %s built for other search paths\n",
+                cachePath.c_str());
+        return false;
+    }
+
+    // Verify that no recorded plugInfo file has changed.
+    i = top.find(_Tokens->CacheFilesKey);
+    if (i == top.end() || !i->second.IsObject()) {
+        return false;
+    }
+    for (const auto& v : i->second.GetJsObject()) {
+        // Files that were visited but missing are recorded with an mtime
+        // of zero; they invalidate the cache only if they now exist.
+        double mtime = 0.0;
+        ArchGetModificationTime(v.first.c_str(), &mtime);
+        if (!(v.second.IsReal() || v.second.IsInt()) ||
+            mtime != v.second.GetReal()) {
+            TF_DEBUG(PLUG_INFO_SEARCH).
+                Msg("Ignoring plugInfo cache %s: %s changed\n",
+                    cachePath.c_str(), v.first.c_str());
+            return false;
+        }
+    }
+
+    i = top.find(_Tokens->CachePluginsKey);
+    if (i == top.end() || !i->second.IsArray()) {
+        return false;
+    }
+
+    // The cache checks out.  Mark the recorded files visited and deliver
+    // the plugins.
+    for (const auto& v : top.find(_Tokens->CacheFilesKey)->
+             second.GetJsObject()) {
+        addVisitedPath(v.first);
+    }
+    const JsArray& plugins = i->second.GetJsArray();
+    for (size_t j = 0, n = plugins.size(); j != n; ++j) {
+        const std::string location =
+            TfStringPrintf("cache %s %s[%zd]", cachePath.c_str(),
+                           _Tokens->CachePluginsKey.GetText(), j);
+        const Plug_RegistrationMetadata metadata(
+            plugins[j], cachePath, location);
+        if (metadata.type != Plug_RegistrationMetadata::UnknownType) {
+            addPlugin(metadata);
+        }
+    }
+
+    TF_DEBUG(PLUG_INFO_SEARCH).
+        Msg("Read %zd plugins from plugInfo cache %s\n",
+            plugins.size(), cachePath.c_str());
+    return true;
+}
+
+// Write a cache file at \p cachePath recording the given scan results.
+void
+_WritePlugInfoCache(
+    const std::string& cachePath,
+    const std::vector<std::string>& pathnames,
+    const std::set<std::string>& visitedPaths,
+    const std::vector<Plug_RegistrationMetadata>& plugins)
+{
+    JsObject top;
+    top[_Tokens->CacheVersionKey] = JsValue(_CacheFormatVersion);
+
+    JsArray searchPaths;
+    for (const auto& pathname : pathnames) {
+        searchPaths.push_back(JsValue(pathname));
+    }
+    top[_Tokens->CacheSearchPathsKey] = JsValue(std::move(searchPaths));
+
+    // Record the modification time of every plugInfo file we visited,
+    // including ones that did not exist or failed to parse; if one of those
+    // appears or changes the cache must be rebuilt.
+    JsObject files;
+    for (const auto& path : visitedPaths) {
+        double mtime = 0.0;
+        ArchGetModificationTime(path.c_str(), &mtime);
+        files[path] = JsValue(mtime);
+    }
+    top[_Tokens->CacheFilesKey] = JsValue(std::move(files));
+
+    JsArray pluginArray;
+    pluginArray.reserve(plugins.size());
+    for (const auto& metadata : plugins) {
+        pluginArray.push_back(JsValue(_CacheEntryFromMetadata(metadata)));
+    }
+    top[_Tokens->CachePluginsKey] = JsValue(std::move(pluginArray));
+
+    TfAtomicOfstreamWrapper wrapper(cachePath);
+    std::string reason;
+    if (!wrapper.Open(&reason)) {
+        TF_WARN("Failed to write plugInfo cache %s: %s",
+                cachePath.c_str(), reason.c_str());
+        return;
+    }
+    JsWriteToStream(JsValue(std::move(top)), wrapper.GetStream());
+    if (!wrapper.Commit(&reason)) {
+        TF_WARN("Failed to write plugInfo cache %s: %s",
+                cachePath.c_str(), reason.c_str());
+    }
+}
+
+} // anonymous namespace
+
 void
 Plug_ReadPlugInfo(
     const std::vector<std::string>& pathnames,
@@ -720,7 +911,45 @@ Plug_ReadPlugInfo(
     Plug_TaskArena* taskArena)
 {
     TF_DEBUG(PLUG_INFO_SEARCH).Msg("Will check plugin info paths\n");
-    _ReadContext context(*taskArena, addVisitedPath, addPlugin);
+
+    // If a cache file is specified, try to satisfy the scan from it, and
+    // otherwise collect the scan results so we can build it.
+    const std::string cachePath = TfGetenv("PXR_PLUGINFO_CACHE");
+    if (!cachePath.empty() &&
+        _ReadPlugInfoCache(cachePath, pathnames,
+                           addVisitedPath, addPlugin)) {
+        TF_DEBUG(PLUG_INFO_SEARCH).Msg("Did check plugin info paths\n");
+        return;
+    }
+
+    std::mutex cacheMutex;
+    std::set<std::string> visitedForCache;
+    std::vector<Plug_RegistrationMetadata> pluginsForCache;
+
+    AddVisitedPathCallback addVisitedPathWrapper = addVisitedPath;
+    AddPluginCallback addPluginWrapper = addPlugin;
+    if (!cachePath.empty()) {
+        addVisitedPathWrapper =
+            [&addVisitedPath, &cacheMutex, &visitedForCache](
+                const std::string& path) {
+                {
+                    std::lock_guard<std::mutex> lock(cacheMutex);
+                    visitedForCache.insert(path);
+                }
+                return addVisitedPath(path);
+            };
+        addPluginWrapper =
+            [&addPlugin, &cacheMutex, &pluginsForCache](
+                const Plug_RegistrationMetadata& metadata) {
+                {
+                    std::lock_guard<std::mutex> lock(cacheMutex);
+                    pluginsForCache.push_back(metadata);
+                }
+                addPlugin(metadata);
+            };
+    }
+
+    _ReadContext context(*taskArena, addVisitedPathWrapper, addPluginWrapper);
     for (const auto& pathname : pathnames) {
         if (pathname.empty()) {
             continue;
@@ -745,6 +974,12 @@ Plug_ReadPlugInfo(
     }
 
     context.taskArena.Wait();
+
+    if (!cachePath.empty()) {
+        _WritePlugInfoCache(
+            cachePath, pathnames, visitedForCache, pluginsForCache);
+    }
+
     TF_DEBUG(PLUG_INFO_SEARCH).Msg("Did check plugin info paths\n");
 }
 
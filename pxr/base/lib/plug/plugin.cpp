@@ -44,13 +44,17 @@
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/tf/type.h"
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/dispatcher.h"
 
 #ifdef PXR_PYTHON_SUPPORT_ENABLED
 #include "pxr/base/tf/pyInterpreter.h"
 #endif // PXR_PYTHON_SUPPORT_ENABLED
 
+#include <deque>
+#include <functional>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -324,21 +328,24 @@ PlugPlugin::_LoadWithDependents(_SeenPlugins *seenPlugins)
     return true;
 }
 
+// Serializes plugin loading.  This is a recursive mutex because loading a
+// plugin may run code (e.g. static initializers in a dlopen'd library)
+// that re-enters Load() on the same thread.
+static std::recursive_mutex _loadMutex;
+
 bool
 PlugPlugin::Load()
 {
-    static std::recursive_mutex loadMutex;
-
     bool result = false;
     bool loadedInSecondaryThread = false;
     {
         // Drop the GIL if we have it, otherwise we can deadlock if another
-        // thread has the plugin loadMutex and is waiting on the GIL (for
+        // thread has the plugin _loadMutex and is waiting on the GIL (for
         // example if we're concurrently loading a python plugin in another
         // thread).
         TF_PY_ALLOW_THREADS_IN_SCOPE();
 
-        std::lock_guard<std::recursive_mutex> lock(loadMutex);
+        std::lock_guard<std::recursive_mutex> lock(_loadMutex);
         loadedInSecondaryThread = !_isLoaded && !ArchIsMainThread();
         _SeenPlugins seenPlugins;
         result = _LoadWithDependents(&seenPlugins);
@@ -352,6 +359,150 @@ PlugPlugin::Load()
     return result;
 }
 
+/* static */
+bool
+PlugPlugin::LoadInParallel(const PlugPluginPtrVector &plugins)
+{
+    TRACE_FUNCTION();
+
+    // Node in the dependency graph of plugins still needing to be loaded.
+    // Nodes live in a deque since std::atomic is not movable.
+    struct _Node {
+        PlugPluginPtr plugin;
+        std::vector<size_t> dependents;
+        size_t numDependencies = 0;
+        std::atomic<size_t> remainingDependencies{0};
+    };
+    std::deque<_Node> nodes;
+    std::unordered_map<std::string, size_t, TfHash> indexByName;
+
+    bool graphOk = true;
+
+    // Adds the given plugin and (recursively) its not-yet-loaded
+    // dependencies to the graph.  Returns the plugin's node index via
+    // *nodeIndex, or alreadyLoaded if the plugin is already loaded.
+    constexpr size_t alreadyLoaded = size_t(-1);
+    std::function<bool(const PlugPluginPtr &, size_t *)> addToGraph =
+        [&](const PlugPluginPtr &plugin, size_t *nodeIndex) {
+            if (plugin->_isLoaded) {
+                *nodeIndex = alreadyLoaded;
+                return true;
+            }
+            auto insertResult =
+                indexByName.insert({plugin->GetName(), nodes.size()});
+            if (!insertResult.second) {
+                *nodeIndex = insertResult.first->second;
+                return true;
+            }
+            const size_t index = nodes.size();
+            nodes.emplace_back();
+            nodes[index].plugin = plugin;
+
+            const JsObject dependencies = plugin->GetDependencies();
+            for (const auto &dependEntry : dependencies) {
+                const TfType baseType = TfType::FindByName(dependEntry.first);
+                if (baseType.IsUnknown()) {
+                    TF_CODING_ERROR("Load failed: unknown base class '%s'",
+                                    dependEntry.first.c_str());
+                    return false;
+                }
+                if (!dependEntry.second.IsArrayOf<std::string>()) {
+                    TF_CODING_ERROR(
+                        "Load failed: dependency list has wrong type");
+                    return false;
+                }
+                for (const std::string &dependName :
+                         dependEntry.second.GetArrayOf<std::string>()) {
+                    const TfType dependType = TfType::FindByName(dependName);
+                    if (dependType.IsUnknown()) {
+                        TF_CODING_ERROR(
+                            "Load failed: unknown dependent class '%s'",
+                            dependName.c_str());
+                        return false;
+                    }
+                    PlugPluginPtr dependPlugin =
+                        _GetPluginForType(dependType);
+                    if (!dependPlugin) {
+                        TF_CODING_ERROR(
+                            "Load failed: unknown dependent plugin '%s'",
+                            dependName.c_str());
+                        return false;
+                    }
+                    size_t dependIndex = 0;
+                    if (!addToGraph(dependPlugin, &dependIndex)) {
+                        return false;
+                    }
+                    if (dependIndex != alreadyLoaded &&
+                        dependIndex != index) {
+                        nodes[dependIndex].dependents.push_back(index);
+                        ++nodes[index].numDependencies;
+                    }
+                }
+            }
+            *nodeIndex = index;
+            return true;
+        };
+
+    {
+        // Hold the load mutex while building the graph so that the set of
+        // loaded plugins can't shift underneath us.
+        TF_PY_ALLOW_THREADS_IN_SCOPE();
+        std::lock_guard<std::recursive_mutex> lock(_loadMutex);
+        for (const PlugPluginPtr &plugin : plugins) {
+            if (!plugin) {
+                TF_CODING_ERROR("Invalid plugin");
+                graphOk = false;
+                continue;
+            }
+            size_t index = 0;
+            if (!addToGraph(plugin, &index)) {
+                graphOk = false;
+            }
+        }
+    }
+
+    // Fan the loads out without holding the load mutex; a plugin's static
+    // initializers may re-enter Load() on a worker thread, which must be
+    // able to acquire it.  If an outside Load() races with us on one of
+    // these plugins, both may load it; the underlying library handles are
+    // reference-counted by the dynamic loader, so this is benign.
+    std::atomic<bool> allLoaded(graphOk);
+    {
+        TF_PY_ALLOW_THREADS_IN_SCOPE();
+        WorkDispatcher dispatcher;
+        std::function<void(size_t)> loadNode = [&](size_t index) {
+            _Node &node = nodes[index];
+            if (!node.plugin->_isLoaded && !node.plugin->_Load()) {
+                allLoaded = false;
+            }
+            for (size_t dependent : node.dependents) {
+                if (--nodes[dependent].remainingDependencies == 0) {
+                    dispatcher.Run(loadNode, dependent);
+                }
+            }
+        };
+        for (size_t i = 0; i != nodes.size(); ++i) {
+            nodes[i].remainingDependencies = nodes[i].numDependencies;
+        }
+        for (size_t i = 0; i != nodes.size(); ++i) {
+            if (nodes[i].numDependencies == 0) {
+                dispatcher.Run(loadNode, i);
+            }
+        }
+        dispatcher.Wait();
+    }
+
+    // If the graph had a cycle, some nodes never ran; load them serially
+    // so that the existing cyclic-dependency diagnostics fire.
+    for (_Node &node : nodes) {
+        if (node.remainingDependencies != 0 && !node.plugin->Load()) {
+            allLoaded = false;
+        }
+    }
+
+    return allLoaded;
+}
+
 bool
 PlugPlugin::IsLoaded() const
 {
@@ -64,6 +64,18 @@ public:
     /// This is a noop if the plugin is already loaded.
     PLUG_API bool Load();
 
+    /// Loads all of the plugins in \p plugins, fanning the loads out to
+    /// multiple threads where the plugins' declared dependencies allow.
+    /// Plugins that are already loaded are skipped.  Returns \c true if
+    /// all of the plugins loaded successfully, \c false otherwise.
+    ///
+    /// This is equivalent to calling Load() on each plugin in turn, but
+    /// can be substantially faster when many independent plugins need to
+    /// be loaded at once, since the dynamic loader can process them
+    /// concurrently.  Note that python module plugins serialize on the
+    /// interpreter's import machinery regardless.
+    PLUG_API static bool LoadInParallel(const PlugPluginPtrVector &plugins);
+
     /// Returns \c true if the plugin is currently loaded.  Resource
     /// plugins always report as loaded.
     PLUG_API bool IsLoaded() const;
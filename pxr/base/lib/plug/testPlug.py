@@ -339,5 +339,23 @@ class TestPlug(unittest.TestCase):
         self.assertEqual(allplugins, Plug.Registry().GetAllPlugins())
         self.assertEqual(listener.numReceived, 0)
 
+    # Named so that it runs after the other cases, which assert that
+    # various plugins have not yet been loaded.
+    def test_ZLoadInParallel(self):
+        badNames = ('Bad', 'Unloadable', 'Incomplete', 'Cycle')
+        goodPlugins = [p for p in Plug.Registry().GetAllPlugins()
+                       if p.name.startswith('TestPlug') and
+                       not any(bad in p.name for bad in badNames)]
+        self.assertTrue(goodPlugins)
+
+        # Load everything, fanning out where dependencies allow; plugins
+        # loaded by earlier cases are skipped.
+        self.assertTrue(Plug.Plugin.LoadInParallel(goodPlugins))
+        for p in goodPlugins:
+            self.assertTrue(p.isLoaded)
+
+        # Loading an already-loaded set reports success.
+        self.assertTrue(Plug.Plugin.LoadInParallel(goodPlugins))
+
 if __name__ == '__main__':
     unittest.main()
@@ -76,6 +76,8 @@ void wrapPlugin()
     class_<This, ThisPtr, boost::noncopyable> ( "Plugin", no_init )
         .def(TfPyWeakPtr())
         .def("Load", &This::Load)
+        .def("LoadInParallel", &This::LoadInParallel, arg("plugins"))
+        .staticmethod("LoadInParallel")
 
         .add_property("isLoaded", &This::IsLoaded)
         .add_property("isPythonModule", &This::IsPythonModule)
@@ -109,6 +111,9 @@ void wrapPlugin()
     // a converter that turns that vector into a Python list.
     boost::python::to_python_converter<std::vector<object>,
         TfPySequenceToPython<std::vector<object> > >();
+
+    // Let LoadInParallel accept any Python sequence of plugins.
+    TfPyRegisterStlSequencesFromPython<PlugPluginPtr>();
 }
 
 TF_REFPTR_CONST_VOLATILE_GET(PlugPlugin)
@@ -30,10 +30,31 @@
 // XXX: Need to isolate symbols here?
 #include "pxrLZ4/lz4.h"
 
+#ifdef PXR_ZSTD_SUPPORT_ENABLED
+#include <zstd.h>
+#endif
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 using namespace pxr_lz4;
 
+namespace {
+// The first byte of a compressed buffer identifies the codec: values 0-127
+// are an LZ4 chunk count (0 meaning a single chunk), and this value marks
+// a zstd frame.  LZ4 chunk counts never exceed 127; see GetMaxInputSize().
+constexpr unsigned char Tf_ZstdCodecMarker = 128;
+} // anon
+
+bool
+TfFastCompression::HasZstdSupport()
+{
+#ifdef PXR_ZSTD_SUPPORT_ENABLED
+    return true;
+#else
+    return false;
+#endif
+}
+
 size_t
 TfFastCompression::GetMaxInputSize()
 {
@@ -45,23 +66,29 @@ TfFastCompression::GetCompressedBufferSize(size_t inputSize)
 {
     if (inputSize > GetMaxInputSize())
         return 0;
-    
+
     // If it fits in one chunk then it's just the compress bound plus 1.
+    size_t sz;
     if (inputSize <= LZ4_MAX_INPUT_SIZE) {
-        return LZ4_compressBound(inputSize) + 1;
+        sz = LZ4_compressBound(inputSize) + 1;
+    } else {
+        size_t nWholeChunks = inputSize / LZ4_MAX_INPUT_SIZE;
+        size_t partChunkSz = inputSize % LZ4_MAX_INPUT_SIZE;
+        sz = 1 + nWholeChunks *
+            (LZ4_compressBound(LZ4_MAX_INPUT_SIZE) + sizeof(int32_t));
+        if (partChunkSz)
+            sz += LZ4_compressBound(partChunkSz) + sizeof(int32_t);
     }
-    size_t nWholeChunks = inputSize / LZ4_MAX_INPUT_SIZE;
-    size_t partChunkSz = inputSize % LZ4_MAX_INPUT_SIZE;
-    size_t sz = 1 + nWholeChunks *
-        (LZ4_compressBound(LZ4_MAX_INPUT_SIZE) + sizeof(int32_t));
-    if (partChunkSz)
-        sz += LZ4_compressBound(partChunkSz) + sizeof(int32_t);
+#ifdef PXR_ZSTD_SUPPORT_ENABLED
+    sz = std::max<size_t>(sz, ZSTD_compressBound(inputSize) + 1);
+#endif
     return sz;
 }
 
 size_t
 TfFastCompression::CompressToBuffer(
-    char const *input, char *compressed, size_t inputSize)
+    char const *input, char *compressed, size_t inputSize,
+    Codec codec)
 {
     if (inputSize > GetMaxInputSize()) {
         TF_CODING_ERROR("Attempted to compress a buffer of %zu bytes, "
@@ -69,7 +96,26 @@ TfFastCompression::CompressToBuffer(
                         inputSize, GetMaxInputSize());
         return 0;
     }
-    
+
+    if (codec == CodecZstd) {
+#ifdef PXR_ZSTD_SUPPORT_ENABLED
+        compressed[0] = static_cast<char>(Tf_ZstdCodecMarker);
+        size_t n = ZSTD_compress(
+            compressed + 1, ZSTD_compressBound(inputSize),
+            input, inputSize, ZSTD_CLEVEL_DEFAULT);
+        if (ZSTD_isError(n)) {
+            TF_RUNTIME_ERROR("Failed to compress data: %s",
+                             ZSTD_getErrorName(n));
+            return 0;
+        }
+        return n + 1;
+#else
+        TF_CODING_ERROR("The zstd codec was requested, but this build does "
+                        "not include zstd support -- falling back to LZ4");
+        codec = CodecLZ4;
+#endif
+    }
+
     // If it fits in one chunk, just do it.
     char const * const origCompressed = compressed;
     if (inputSize <= LZ4_MAX_INPUT_SIZE) {
@@ -106,8 +152,25 @@ TfFastCompression::DecompressFromBuffer(
     char const *compressed, char *output,
     size_t compressedSize, size_t maxOutputSize)
 {
-    // Check first byte for # chunks.
-    int nChunks = *compressed++;
+    // Check first byte for the codec / # chunks.
+    unsigned char const lead = static_cast<unsigned char>(*compressed++);
+    if (lead == Tf_ZstdCodecMarker) {
+#ifdef PXR_ZSTD_SUPPORT_ENABLED
+        size_t n = ZSTD_decompress(
+            output, maxOutputSize, compressed, compressedSize - 1);
+        if (ZSTD_isError(n)) {
+            TF_RUNTIME_ERROR("Failed to decompress data, possibly corrupt? "
+                             "zstd error: %s", ZSTD_getErrorName(n));
+            return 0;
+        }
+        return n;
+#else
+        TF_RUNTIME_ERROR("Data is compressed with the zstd codec, but this "
+                         "build does not include zstd support");
+        return 0;
+#endif
+    }
+    int nChunks = lead;
     if (nChunks == 0) {
         // Just one.
         int nDecompressed = LZ4_decompress_safe(
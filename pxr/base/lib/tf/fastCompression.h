@@ -38,25 +38,40 @@ PXR_NAMESPACE_OPEN_SCOPE
 class TfFastCompression
 {
 public:
+    /// Codecs that may be selected when compressing.  Decompression
+    /// detects the codec from the compressed data itself, so no codec is
+    /// specified there.  CodecZstd is only available when the library is
+    /// built with zstd support; see HasZstdSupport().
+    enum Codec {
+        CodecLZ4,
+        CodecZstd
+    };
+
+    /// Return true if this build of the library supports the zstd codec.
+    TF_API static bool
+    HasZstdSupport();
+
     /// Return the largest input buffer size that can be compressed with these
     /// functions.  Guaranteed to be at least 200 GB.
     TF_API static size_t
     GetMaxInputSize();
-    
+
     /// Return the largest possible compressed size for the given \p inputSize
-    /// in the worst case (input is not compressible).  This is larger than
-    /// \p inputSize.  If inputSize is larger than GetMaxInputSize(), return 0.
+    /// in the worst case (input is not compressible), over all supported
+    /// codecs.  This is larger than \p inputSize.  If inputSize is larger
+    /// than GetMaxInputSize(), return 0.
     TF_API static size_t
     GetCompressedBufferSize(size_t inputSize);
 
-    /// Compress \p inputSize bytes in \p input and store the result in
-    /// \p compressed.  The \p compressed buffer must point to at least
-    /// GetCompressedBufferSize(uncompressedSize) bytes.  Return the number of
-    /// bytes written to the \p compressed buffer.  Issue a runtime error and
-    /// return ~0 in case of an error.
+    /// Compress \p inputSize bytes in \p input with the given \p codec and
+    /// store the result in \p compressed.  The \p compressed buffer must
+    /// point to at least GetCompressedBufferSize(uncompressedSize) bytes.
+    /// Return the number of bytes written to the \p compressed buffer.
+    /// Issue a runtime error and return ~0 in case of an error.
     TF_API static size_t
-    CompressToBuffer(char const *input, char *compressed, size_t inputSize);
-                           
+    CompressToBuffer(char const *input, char *compressed, size_t inputSize,
+                     Codec codec = CodecLZ4);
+
     /// Decompress \p compressedSize bytes in \p compressed and store the
     /// result in \p output.  No more than \p maxOutputSize bytes will be
     /// written to \p output.
@@ -0,0 +1,441 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef TF_FLAT_HASH_MAP_H
+#define TF_FLAT_HASH_MAP_H
+
+/// \file tf/flatHashMap.h
+
+#include "pxr/pxr.h"
+#include "pxr/base/arch/hints.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class TfFlatHashMap
+///
+/// A cache-friendly hash map that mimics the TfHashMap API but stores its
+/// elements in a single flat array using open addressing with robin-hood
+/// probing.  Compared to the chained TfHashMap there are no per-node
+/// allocations, successful and failed lookups touch a small number of
+/// contiguous cache lines, and iteration is a linear scan of one array.
+/// This makes it the better choice for large tables where iteration and
+/// miss-heavy lookup dominate, such as path-to-object indexes.
+///
+/// To build a large table in one shot, call reserve() with the expected
+/// final size before inserting (or use the range constructor/insert, which
+/// do so automatically when the range size is cheaply available); this
+/// builds the table with no intermediate rehashes.
+///
+/// \warning Unlike TfHashMap, any insertion or erasure may invalidate all
+/// iterators, references and pointers into the map.  Do not use this class
+/// where clients retain references to elements across mutations.
+///
+template <class Key, class Mapped, class HashFn,
+          class EqualKey = std::equal_to<Key>>
+class TfFlatHashMap
+{
+public:
+    typedef Key key_type;
+    typedef Mapped mapped_type;
+    typedef std::pair<const Key, Mapped> value_type;
+    typedef HashFn hasher;
+    typedef EqualKey key_equal;
+    typedef size_t size_type;
+
+private:
+    // Elements are stored with a mutable key so they can be relocated when
+    // probing shifts them.  value_type and _Entry are layout-compatible;
+    // iterators expose elements as value_type so client code cannot
+    // invalidate the key-to-slot mapping.
+    typedef std::pair<Key, Mapped> _Entry;
+
+    template <class Value>
+    class _IteratorBase
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Value value_type;
+        typedef ptrdiff_t difference_type;
+        typedef Value *pointer;
+        typedef Value &reference;
+
+        _IteratorBase() : _map(nullptr), _index(0) {}
+
+        reference operator*() const {
+            return *reinterpret_cast<Value *>(&_map->_entries[_index]);
+        }
+        pointer operator->() const {
+            return reinterpret_cast<Value *>(&_map->_entries[_index]);
+        }
+
+        _IteratorBase &operator++() {
+            ++_index;
+            _AdvanceToOccupied();
+            return *this;
+        }
+        _IteratorBase operator++(int) {
+            _IteratorBase result = *this;
+            ++*this;
+            return result;
+        }
+
+        bool operator==(const _IteratorBase &rhs) const {
+            return _index == rhs._index;
+        }
+        bool operator!=(const _IteratorBase &rhs) const {
+            return _index != rhs._index;
+        }
+
+        // Allow iterator -> const_iterator conversion.
+        operator _IteratorBase<Value const>() const {
+            return _IteratorBase<Value const>(_map, _index);
+        }
+
+    private:
+        friend class TfFlatHashMap;
+        template <class V> friend class _IteratorBase;
+
+        _IteratorBase(TfFlatHashMap const *map, size_t index)
+            : _map(map), _index(index) {}
+
+        void _AdvanceToOccupied() {
+            while (_index < _map->_capacity && !_map->_dists[_index]) {
+                ++_index;
+            }
+        }
+
+        TfFlatHashMap const *_map;
+        size_t _index;
+    };
+
+public:
+    typedef _IteratorBase<value_type> iterator;
+    typedef _IteratorBase<value_type const> const_iterator;
+
+    /// Create an empty map.
+    TfFlatHashMap()
+        : _entries(nullptr), _dists(nullptr), _capacity(0), _size(0) {}
+
+    /// Create an empty map with room for at least \p n elements.
+    explicit TfFlatHashMap(size_type n)
+        : _entries(nullptr), _dists(nullptr), _capacity(0), _size(0) {
+        reserve(n);
+    }
+
+    /// Create a map with the elements in [\p first, \p last), reserving
+    /// the full range's capacity up front when the iterators are
+    /// random-access.
+    template <class InputIterator>
+    TfFlatHashMap(InputIterator first, InputIterator last)
+        : _entries(nullptr), _dists(nullptr), _capacity(0), _size(0) {
+        insert(first, last);
+    }
+
+    TfFlatHashMap(TfFlatHashMap const &rhs)
+        : _entries(nullptr), _dists(nullptr), _capacity(0), _size(0) {
+        reserve(rhs._size);
+        for (const_iterator i = rhs.begin(), e = rhs.end(); i != e; ++i) {
+            insert(*i);
+        }
+    }
+
+    TfFlatHashMap(TfFlatHashMap &&rhs)
+        : _entries(rhs._entries), _dists(rhs._dists),
+          _capacity(rhs._capacity), _size(rhs._size) {
+        rhs._entries = nullptr;
+        rhs._dists = nullptr;
+        rhs._capacity = 0;
+        rhs._size = 0;
+    }
+
+    TfFlatHashMap &operator=(TfFlatHashMap rhs) {
+        swap(rhs);
+        return *this;
+    }
+
+    ~TfFlatHashMap() {
+        clear();
+        _FreeStorage();
+    }
+
+    iterator begin() {
+        iterator result(this, 0);
+        result._AdvanceToOccupied();
+        return result;
+    }
+    const_iterator begin() const {
+        const_iterator result(this, 0);
+        result._AdvanceToOccupied();
+        return result;
+    }
+    iterator end() { return iterator(this, _capacity); }
+    const_iterator end() const { return const_iterator(this, _capacity); }
+
+    size_type size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    iterator find(Key const &key) {
+        return iterator(this, _FindIndex(key));
+    }
+    const_iterator find(Key const &key) const {
+        return const_iterator(this, _FindIndex(key));
+    }
+    size_type count(Key const &key) const {
+        return _FindIndex(key) != _capacity ? 1 : 0;
+    }
+
+    /// Insert \p value if its key is not already present.  Returns the
+    /// iterator to the (new or existing) element and whether an insertion
+    /// took place.  Accepts any pair type that value_type is constructible
+    /// from, moving from rvalue members.
+    template <class Pair,
+              class = typename std::enable_if<
+                  std::is_constructible<value_type, Pair &&>::value>::type>
+    std::pair<iterator, bool> insert(Pair &&value) {
+        return _Insert(Key(std::forward<Pair>(value).first),
+                       Mapped(std::forward<Pair>(value).second));
+    }
+
+    /// Insert the elements in [\p first, \p last), reserving the full
+    /// range's capacity up front when the iterators are random-access.
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+        _ReserveForRange(
+            first, last,
+            typename std::iterator_traits<
+                InputIterator>::iterator_category());
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    Mapped &operator[](Key const &key) {
+        return _Insert(Key(key), Mapped()).first->second;
+    }
+
+    /// Erase the element with \p key, if any.  Returns the number of
+    /// elements erased (0 or 1).
+    size_type erase(Key const &key) {
+        const size_t index = _FindIndex(key);
+        if (index == _capacity) {
+            return 0;
+        }
+        _EraseIndex(index);
+        return 1;
+    }
+
+    /// Erase the element at \p pos.
+    void erase(const_iterator pos) {
+        _EraseIndex(pos._index);
+    }
+
+    /// Erase all elements, keeping the current capacity.
+    void clear() {
+        for (size_t i = 0; i != _capacity; ++i) {
+            if (_dists[i]) {
+                _entries[i].~_Entry();
+                _dists[i] = 0;
+            }
+        }
+        _size = 0;
+    }
+
+    /// Ensure the map can hold \p n elements without rehashing.
+    void reserve(size_type n) {
+        const size_t required = _CapacityFor(n);
+        if (required > _capacity) {
+            _Rehash(required);
+        }
+    }
+
+    void swap(TfFlatHashMap &rhs) {
+        std::swap(_entries, rhs._entries);
+        std::swap(_dists, rhs._dists);
+        std::swap(_capacity, rhs._capacity);
+        std::swap(_size, rhs._size);
+    }
+
+private:
+    // Pre-size for a range insertion when the range size is cheaply
+    // available.
+    template <class Iter>
+    void _ReserveForRange(Iter first, Iter last,
+                          std::random_access_iterator_tag) {
+        reserve(_size + (last - first));
+    }
+    template <class Iter>
+    void _ReserveForRange(Iter, Iter, std::input_iterator_tag) {
+    }
+
+    // Grow when load would exceed 3/4.
+    static size_t _CapacityFor(size_t numElements) {
+        size_t capacity = 16;
+        while (numElements * 4 > capacity * 3) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    // Scramble the client hash: probe sequences index with the high bits
+    // mixed down, so clustered or low-entropy hashes (e.g. pointer-derived
+    // ones) still spread across the table.
+    size_t _HomeIndex(Key const &key) const {
+        uint64_t h = HashFn()(key);
+        h *= 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 32;
+        return static_cast<size_t>(h) & (_capacity - 1);
+    }
+
+    // Returns the slot holding key, or _capacity if absent.  The robin-hood
+    // invariant lets misses stop as soon as they reach a slot that is empty
+    // or closer to its home than the probe is to key's home.
+    size_t _FindIndex(Key const &key) const {
+        if (_size == 0) {
+            return _capacity;
+        }
+        size_t index = _HomeIndex(key);
+        for (uint32_t dist = 1; ; ++dist) {
+            const uint32_t slotDist = _dists[index];
+            if (slotDist < dist) {
+                return _capacity;
+            }
+            if (slotDist == dist && EqualKey()(_entries[index].first, key)) {
+                return index;
+            }
+            index = (index + 1) & (_capacity - 1);
+        }
+    }
+
+    std::pair<iterator, bool> _Insert(Key &&key, Mapped &&mapped) {
+        if ((_size + 1) * 4 > _capacity * 3) {
+            _Rehash(_capacity ? _capacity * 2 : 16);
+        }
+
+        size_t index = _HomeIndex(key);
+        size_t resultIndex = _capacity;
+        for (uint32_t dist = 1; ; ++dist) {
+            if (!_dists[index]) {
+                new (_entries + index) _Entry(std::move(key),
+                                              std::move(mapped));
+                _dists[index] = dist;
+                ++_size;
+                if (resultIndex == _capacity) {
+                    resultIndex = index;
+                }
+                return std::make_pair(iterator(this, resultIndex), true);
+            }
+            if (resultIndex == _capacity) {
+                if (_dists[index] == dist &&
+                    EqualKey()(_entries[index].first, key)) {
+                    return std::make_pair(iterator(this, index), false);
+                }
+            }
+            if (_dists[index] < dist) {
+                // Displace the closer-to-home resident and keep probing
+                // for a slot for it.
+                std::swap(_entries[index].first, key);
+                std::swap(_entries[index].second, mapped);
+                std::swap(_dists[index], dist);
+                if (resultIndex == _capacity) {
+                    resultIndex = index;
+                }
+            }
+            index = (index + 1) & (_capacity - 1);
+        }
+    }
+
+    void _EraseIndex(size_t index) {
+        // Backward-shift deletion keeps probe distances minimal without
+        // tombstones: pull each displaced successor one slot closer to
+        // home until a slot that is empty or already home is reached.
+        size_t next = (index + 1) & (_capacity - 1);
+        while (_dists[next] > 1) {
+            _entries[index].first = std::move(_entries[next].first);
+            _entries[index].second = std::move(_entries[next].second);
+            _dists[index] = _dists[next] - 1;
+            index = next;
+            next = (next + 1) & (_capacity - 1);
+        }
+        _entries[index].~_Entry();
+        _dists[index] = 0;
+        --_size;
+    }
+
+    void _Rehash(size_t newCapacity) {
+        _Entry *const oldEntries = _entries;
+        uint32_t *const oldDists = _dists;
+        const size_t oldCapacity = _capacity;
+
+        _entries = static_cast<_Entry *>(
+            ::operator new(newCapacity * sizeof(_Entry)));
+        _dists = new uint32_t[newCapacity]();
+        _capacity = newCapacity;
+        _size = 0;
+
+        for (size_t i = 0; i != oldCapacity; ++i) {
+            if (oldDists[i]) {
+                _Insert(std::move(oldEntries[i].first),
+                        std::move(oldEntries[i].second));
+                oldEntries[i].~_Entry();
+            }
+        }
+
+        ::operator delete(oldEntries);
+        delete [] oldDists;
+    }
+
+    void _FreeStorage() {
+        ::operator delete(_entries);
+        delete [] _dists;
+        _entries = nullptr;
+        _dists = nullptr;
+        _capacity = 0;
+    }
+
+    _Entry *_entries;
+    // Probe distance + 1 for each slot, 0 for empty slots.  Kept separate
+    // from the entries so probes that only inspect distances do not pull
+    // element data into cache.
+    uint32_t *_dists;
+    size_t _capacity;
+    size_t _size;
+};
+
+template <class Key, class Mapped, class HashFn, class EqualKey>
+inline void
+swap(TfFlatHashMap<Key, Mapped, HashFn, EqualKey> &lhs,
+     TfFlatHashMap<Key, Mapped, HashFn, EqualKey> &rhs)
+{
+    lhs.swap(rhs);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // TF_FLAT_HASH_MAP_H
@@ -85,6 +85,7 @@ struct Tf_MallocGlobalData;
 static ArchMallocHook _mallocHook;      // zero-initialized POD
 static Tf_MallocGlobalData* _mallocGlobalData = NULL;
 bool TfMallocTag::_doTagging = false;
+size_t TfMallocTag::_sampleRate = 1;
 
 static bool
 _UsePtmalloc()
@@ -830,7 +831,7 @@ _StoreIndexAndGetSize(void *, size_t *, uint32_t)
 
 // Per-thread data for TfMallocTag.
 struct TfMallocTag::_ThreadData {
-    _ThreadData() : _tagState(_TaggingDormant) { }
+    _ThreadData() : _tagState(_TaggingDormant), _sampleCountdown(0) { }
     _ThreadData(const _ThreadData &) = delete;
     _ThreadData(_ThreadData&&) = delete;
     _ThreadData& operator=(const _ThreadData &rhs) = delete;
@@ -839,6 +840,10 @@ struct TfMallocTag::_ThreadData {
     _Tagging _tagState;
     std::vector<Tf_MallocPathNode*> _tagStack;
     std::vector<unsigned int> _callSiteOnStack;
+
+    // Countdown until the next allocation this thread tags when sampling
+    // is enabled.  See TfMallocTag::SetSampleRate().
+    size_t _sampleCountdown;
 };
 
 class TfMallocTag::Tls {
@@ -906,6 +911,37 @@ TfMallocTag::_GetCurrentPathNodeNoLock(const TfMallocTag::_ThreadData* tptr)
     return _mallocGlobalData->_rootNode;
 }
 
+// Returns true if this allocation should be tagged, false if it should be
+// skipped under the current sampling rate.  Skipped allocations bypass the
+// global mutex and all shared bookkeeping; their blocks are simply never
+// registered, which the free paths already tolerate.
+inline bool
+TfMallocTag::_ShouldSample(TfMallocTag::_ThreadData* td)
+{
+    const size_t rate = TfMallocTag::GetSampleRate();
+    if (rate <= 1) {
+        return true;
+    }
+    if (td->_sampleCountdown > 0) {
+        --td->_sampleCountdown;
+        return false;
+    }
+    td->_sampleCountdown = rate - 1;
+    return true;
+}
+
+void
+TfMallocTag::SetSampleRate(size_t rate)
+{
+    _sampleRate = rate > 0 ? rate : 1;
+}
+
+size_t
+TfMallocTag::GetSampleRate()
+{
+    return _sampleRate;
+}
+
 void
 TfMallocTag::SetDebugMatchList(const std::string& matchList)
 {
@@ -960,6 +996,9 @@ TfMallocTag::_MallocWrapper(size_t nBytes, const void*)
     if (_ShouldNotTag(&td) || ARCH_UNLIKELY(!ptr))
         return ptr;
 
+    if (!_ShouldSample(td))
+        return ptr;
+
     {
         tbb::spin_mutex::scoped_lock lock(_mallocGlobalData->_mutex);
     
@@ -1054,6 +1093,9 @@ TfMallocTag::_ReallocWrapper(void* oldPtr, size_t nBytes, const void*)
         if (shouldNotTag || ARCH_UNLIKELY(!newPtr))
             return newPtr;
 
+        if (!_ShouldSample(td))
+            return newPtr;
+
         Tf_MallocPathNode* newNode = _GetCurrentPathNodeNoLock(td);
         size_t blockSize = Tf_GetMallocBlockSize(newPtr, nBytes);
 
@@ -1096,6 +1138,9 @@ TfMallocTag::_MemalignWrapper(size_t alignment, size_t nBytes, const void*)
     if (_ShouldNotTag(&td) || ARCH_UNLIKELY(!ptr))
         return ptr;
 
+    if (!_ShouldSample(td))
+        return ptr;
+
     tbb::spin_mutex::scoped_lock lock(_mallocGlobalData->_mutex);
 
     Tf_MallocPathNode* node = _GetCurrentPathNodeNoLock(td);
@@ -1167,6 +1212,9 @@ TfMallocTag::_MallocWrapper_ptmalloc(size_t nBytes, const void*)
     if (_ShouldNotTag(&td))
         return ptr;
 
+    if (!_ShouldSample(td))
+        return ptr;
+
     tbb::spin_mutex::scoped_lock lock(_mallocGlobalData->_mutex);
 
     Tf_MallocPathNode* node = _GetCurrentPathNodeNoLock(td);
@@ -1216,11 +1264,11 @@ TfMallocTag::_ReallocWrapper_ptmalloc(void* oldPtr, size_t nBytes, const void*)
     if (_ShouldNotTag(&td))
         return newPtr;
 
-    tbb::spin_mutex::scoped_lock lock(_mallocGlobalData->_mutex);
+    // When sampled out, still account for the implicit free of the old
+    // block below, but do not register the new block.
+    const bool sampled = _ShouldSample(td);
 
-    Tf_MallocPathNode* newNode = _GetCurrentPathNodeNoLock(td);
-    size_t actualBytes;
-    _StoreIndexAndGetSize(newPtr, &actualBytes, newNode->_index);
+    tbb::spin_mutex::scoped_lock lock(_mallocGlobalData->_mutex);
 
     if (index) {
         Tf_MallocPathNode* oldNode = _mallocGlobalData->_allPathNodes[index];
@@ -1237,6 +1285,13 @@ TfMallocTag::_ReallocWrapper_ptmalloc(void* oldPtr, size_t nBytes, const void*)
         _mallocGlobalData->_totalBytes -= bytesFreed;
     }
 
+    if (!sampled)
+        return newPtr;
+
+    Tf_MallocPathNode* newNode = _GetCurrentPathNodeNoLock(td);
+    size_t actualBytes;
+    _StoreIndexAndGetSize(newPtr, &actualBytes, newNode->_index);
+
     // Check if we should capture a malloc stack.  This has to happen while
     // the mutex is held.
     _mallocGlobalData->_CaptureMallocStack(newNode, newPtr, actualBytes);
@@ -1263,6 +1318,9 @@ TfMallocTag::_MemalignWrapper_ptmalloc(size_t alignment, size_t nBytes, const vo
     if (_ShouldNotTag(&td))
         return ptr;
 
+    if (!_ShouldSample(td))
+        return ptr;
+
     tbb::spin_mutex::scoped_lock lock(_mallocGlobalData->_mutex);
 
     Tf_MallocPathNode* node = _GetCurrentPathNodeNoLock(td);
@@ -1326,6 +1384,20 @@ TfMallocTag::Initialize(string* errMsg)
 }
 
 
+// Recursively scale the counts in a call tree snapshot by the sampling
+// rate, so that sampled reports approximate full tagging.
+static void
+Tf_ScalePathNodeBySampleRate(
+    TfMallocTag::CallTree::PathNode* node, size_t rate)
+{
+    node->nBytes *= rate;
+    node->nBytesDirect *= rate;
+    node->nAllocations *= rate;
+    TF_FOR_ALL(child, node->children) {
+        Tf_ScalePathNodeBySampleRate(&(*child), rate);
+    }
+}
+
 bool
 TfMallocTag::GetCallTree(CallTree* tree, bool skipRepeated)
 {
@@ -1361,6 +1433,16 @@ TfMallocTag::GetCallTree(CallTree* tree, bool skipRepeated)
         gd->_BuildUniqueMallocStacks(tree);
 
         gd->_mutex.unlock();
+
+        // When sampling, scale the reported counts so that totals remain
+        // representative of the full allocation load.
+        const size_t rate = GetSampleRate();
+        if (rate > 1) {
+            Tf_ScalePathNodeBySampleRate(&tree->root, rate);
+            TF_FOR_ALL(csi, tree->callSites) {
+                csi->nBytes *= rate;
+            }
+        }
         return true;
     }
     else
@@ -1374,7 +1456,7 @@ TfMallocTag::GetTotalBytes()
         return 0;
 
     tbb::spin_mutex::scoped_lock lock(_mallocGlobalData->_mutex);
-    return _mallocGlobalData->_totalBytes;
+    return _mallocGlobalData->_totalBytes * GetSampleRate();
 }
 
 size_t
@@ -1384,7 +1466,7 @@ TfMallocTag::GetMaxTotalBytes()
         return 0;
 
     tbb::spin_mutex::scoped_lock lock(_mallocGlobalData->_mutex);
-    return _mallocGlobalData->_maxTotalBytes;
+    return _mallocGlobalData->_maxTotalBytes * GetSampleRate();
 }
 
 void
@@ -1409,6 +1491,9 @@ TfMallocTag::_Initialize(std::string* errMsg)
     TF_AXIOM(!_mallocGlobalData);
     _mallocGlobalData = new Tf_MallocGlobalData();
 
+    const int sampleRate = TfGetenvInt("TF_MALLOC_TAG_SAMPLE_RATE", 1);
+    SetSampleRate(sampleRate > 0 ? sampleRate : 1);
+
     // Note that we are *not* using the _TemporaryTaggingState object
     // here. We explicitly want the tagging set to enabled as the end
     // of this function so that all subsequent memory allocations are captured.
@@ -208,6 +208,31 @@ public:
     /// was called.
     TF_API static size_t GetMaxTotalBytes();
 
+    /// Set the allocation sampling rate.
+    ///
+    /// When \p rate is greater than one, only one in \p rate allocations is
+    /// tagged; untagged allocations bypass all shared bookkeeping state,
+    /// drastically reducing the overhead of leaving tagging enabled in
+    /// production.  Each thread maintains its own sampling countdown, so no
+    /// synchronization is introduced on the untagged path.  Reported byte
+    /// and allocation counts are scaled by \p rate, so totals remain
+    /// statistically representative, though small or short-lived
+    /// allocation sites may be missed or over-represented.
+    ///
+    /// A \p rate of one (the default) tags every allocation.  The rate may
+    /// also be set with the environment variable TF_MALLOC_TAG_SAMPLE_RATE,
+    /// which is read when the tagging system is initialized.
+    ///
+    /// This function should be called before spawning worker threads;
+    /// changing the rate while allocations are in flight does not corrupt
+    /// the tagging structures, but makes the scaled totals less accurate.
+    TF_API static void SetSampleRate(size_t rate);
+
+    /// Return the current allocation sampling rate.
+    ///
+    /// See SetSampleRate().  A rate of one means every allocation is tagged.
+    TF_API static size_t GetSampleRate();
+
     /// Return a snapshot of memory usage.
     ///
     /// Returns a snapshot by writing into \c *tree.  See the \c C *tree
@@ -487,6 +512,7 @@ private:
     static bool _Initialize(std::string* errMsg);
 
     static inline bool _ShouldNotTag(_ThreadData**, _Tagging* t = NULL);
+    static inline bool _ShouldSample(_ThreadData*);
     static inline Tf_MallocPathNode* _GetCurrentPathNodeNoLock(
         const _ThreadData* threadData);
 
@@ -504,6 +530,11 @@ private:
     class Tls;
     friend class TfMallocTag::Tls;
     TF_API static bool _doTagging;
+
+    // The sampling rate; one in _sampleRate allocations is tagged.  Like
+    // _doTagging, this is read without synchronization on the allocation
+    // path; it should be set before heavy threading begins.
+    TF_API static size_t _sampleRate;
 };
 
 /// Top-down memory tagging system.
@@ -166,4 +166,22 @@ TfNotice::Block::~Block()
     Tf_NoticeRegistry::_GetInstance()._DecrementBlockCount();
 }
 
+TfNotice *
+TfNotice::_CloneForDeferredDelivery() const
+{
+    // Notices do not support deferred delivery unless they explicitly
+    // opt in by overriding this method.
+    return 0;
+}
+
+TfNotice::DeferBlock::DeferBlock()
+{
+    Tf_NoticeRegistry::_GetInstance()._IncrementDeferBlockCount();
+}
+
+TfNotice::DeferBlock::~DeferBlock()
+{
+    Tf_NoticeRegistry::_GetInstance()._DecrementDeferBlockCount();
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -454,6 +454,47 @@ public:
         TF_API ~Block();
     };
 
+    /// Defers delivery of notices in the current thread until the outermost
+    /// block is destroyed.
+    ///
+    /// While one or more \c TfNotice::DeferBlock is instantiated, any notice
+    /// sent in the current thread whose type supports deferral (see
+    /// \c _CloneForDeferredDelivery()) is queued rather than delivered.  When
+    /// the last block in the thread is destroyed, the queued notices are
+    /// delivered, in the order they were sent, on the thread destroying the
+    /// block.  Notices whose types do not support deferral are delivered
+    /// immediately, as if no block were present.
+    ///
+    /// This is useful for authoring code that produces bursts of notices:
+    /// listener-side work is moved to the boundary of the block, after the
+    /// sender has finished its edits.  \c SdfChangeBlock provides analogous
+    /// batching for Sdf change notification by coalescing the underlying
+    /// changes themselves; this class is the general-purpose mechanism for
+    /// other notice types.
+    ///
+    /// Since delivery happens when the outermost block closes, senders of
+    /// deferred notices must ensure that the sender object outlives the
+    /// block.  \c Send() returns zero for a deferred notice, because the
+    /// number of interested listeners is not known until delivery.
+    class DeferBlock {
+    public:
+        TF_API DeferBlock();
+        TF_API ~DeferBlock();
+    };
+
+protected:
+    /// Clone this notice for deferred delivery, returning a heap-allocated
+    /// copy, or NULL if this notice type does not support deferral.
+    ///
+    /// The default implementation returns NULL, which causes the notice to
+    /// be delivered synchronously even when a \c TfNotice::DeferBlock is
+    /// active.  Notice classes whose instances remain meaningful after the
+    /// sending call has returned may override this method to return
+    /// \c new Derived(*this); ownership of the returned copy passes to the
+    /// notification system.
+    TF_API
+    virtual TfNotice *_CloneForDeferredDelivery() const;
+
 private:
     // Abstract base class for calling listeners.
     // A typed-version derives (via templating) off this class.
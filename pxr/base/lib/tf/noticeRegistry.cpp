@@ -45,7 +45,8 @@ TF_INSTANTIATE_SINGLETON(Tf_NoticeRegistry);
 Tf_NoticeRegistry::Tf_NoticeRegistry()
     : _userCount(0),
       _doProbing(false),
-      _globalBlockCount(0)
+      _globalBlockCount(0),
+      _globalDeferBlockCount(0)
 {
     /*
      * lib/tf's diagnostic-reporting mechanisms are based on sending
@@ -221,6 +222,26 @@ Tf_NoticeRegistry::_Send(const TfNotice &n, const TfType & noticeType,
         }
     }
 
+    // Likewise check the global defer block count first to keep the
+    // common non-deferred case cheap.
+    if (_globalDeferBlockCount > 0) {
+        _DeferState &deferState = _perThreadDeferState.local();
+        if (deferState.blockCount > 0) {
+            if (TfNotice *clone = n._CloneForDeferredDelivery()) {
+                _DeferredNotice deferred;
+                deferred.notice.reset(clone);
+                deferred.noticeType = noticeType;
+                deferred.sender = s;
+                deferred.senderUniqueId = senderUniqueId;
+                deferred.senderType = &senderType;
+                deferState.queue.push_back(std::move(deferred));
+                return 0;
+            }
+            // Notices that do not support deferral fall through and are
+            // delivered immediately.
+        }
+    }
+
     _IncrementUserCount(1);
 
     size_t nSent = 0;
@@ -362,11 +383,39 @@ Tf_NoticeRegistry::_IncrementBlockCount()
     ++_perThreadBlockCount.local();
 }
 
-void 
+void
 Tf_NoticeRegistry::_DecrementBlockCount()
 {
     --_globalBlockCount;
     --_perThreadBlockCount.local();
 }
 
+void
+Tf_NoticeRegistry::_IncrementDeferBlockCount()
+{
+    ++_globalDeferBlockCount;
+    ++_perThreadDeferState.local().blockCount;
+}
+
+void
+Tf_NoticeRegistry::_DecrementDeferBlockCount()
+{
+    --_globalDeferBlockCount;
+    _DeferState &deferState = _perThreadDeferState.local();
+    if (--deferState.blockCount > 0 || deferState.queue.empty()) {
+        return;
+    }
+
+    // The outermost block on this thread has closed; deliver the queued
+    // notices in the order they were sent.  Swap the queue out first, so
+    // that notices sent by listeners during the flush (or queued by new
+    // blocks they open) do not interleave with the batch being delivered.
+    std::vector<_DeferredNotice> queue;
+    queue.swap(deferState.queue);
+    for (const _DeferredNotice &d : queue) {
+        _Send(*d.notice, d.noticeType, d.sender, d.senderUniqueId,
+              *d.senderType);
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -41,6 +41,7 @@
 #include <tbb/enumerable_thread_specific.h>
 #include <tbb/spin_mutex.h>
 #include <atomic>
+#include <memory>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -119,6 +120,11 @@ public:
     TF_API
     void _DecrementBlockCount();
 
+    TF_API
+    void _IncrementDeferBlockCount();
+    TF_API
+    void _DecrementDeferBlockCount();
+
 private:
     Tf_NoticeRegistry();
     friend class TfSingleton<Tf_NoticeRegistry>;
@@ -253,6 +259,26 @@ private:
 
     std::atomic<size_t> _globalBlockCount;
     tbb::enumerable_thread_specific<size_t> _perThreadBlockCount;
+
+    // A notice queued by a TfNotice::DeferBlock for delivery when the
+    // outermost block on the queuing thread is destroyed.  The registry
+    // owns the cloned notice.
+    struct _DeferredNotice {
+        std::shared_ptr<const TfNotice> notice;
+        TfType noticeType;
+        const TfWeakBase *sender;
+        const void *senderUniqueId;
+        const std::type_info *senderType;
+    };
+
+    struct _DeferState {
+        _DeferState() : blockCount(0) {}
+        size_t blockCount;
+        std::vector<_DeferredNotice> queue;
+    };
+
+    std::atomic<size_t> _globalDeferBlockCount;
+    tbb::enumerable_thread_specific<_DeferState> _perThreadDeferState;
 };
 
 TF_API_TEMPLATE_CLASS(TfSingleton<Tf_NoticeRegistry>);
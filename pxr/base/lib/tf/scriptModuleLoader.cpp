@@ -27,6 +27,7 @@
 
 #include "pxr/base/tf/debug.h"
 #include "pxr/base/tf/debugCodes.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/instantiateSingleton.h"
 #include "pxr/base/tf/iterator.h"
 #include "pxr/base/tf/pyUtils.h"
@@ -47,6 +48,18 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 TF_INSTANTIATE_SINGLETON(TfScriptModuleLoader);
 
+TF_DEFINE_ENV_SETTING(
+    TF_DEFER_SCRIPT_MODULE_LOADING, false,
+    "Defer bulk loading of script modules.  Normally, initializing python "
+    "or opening a shared library with script bindings imports the binding "
+    "modules for every library registered in the process.  When this "
+    "setting is enabled those bulk loads are skipped; each binding module "
+    "still imports its declared predecessors when it is itself imported, "
+    "so modules load on demand in dependency order.  Short-lived tools "
+    "that touch a few modules avoid paying for the rest, at the cost that "
+    "python code is not loaded for libraries whose bindings are never "
+    "explicitly imported.");
+
 using std::deque;
 using std::string;
 using std::vector;
@@ -192,6 +205,15 @@ TfScriptModuleLoader::WriteDotFile(string const &file) const
 void
 TfScriptModuleLoader::LoadModules()
 {
+    // In deferred mode, skip bulk loads entirely; modules are imported on
+    // demand via LoadModulesForLibrary() when a binding module is itself
+    // imported.
+    if (TfGetEnvSetting(TF_DEFER_SCRIPT_MODULE_LOADING)) {
+        TF_DEBUG(TF_SCRIPT_MODULE_LOADER)
+            .Msg("Deferring bulk module load "
+                 "(TF_DEFER_SCRIPT_MODULE_LOADING)\n");
+        return;
+    }
     _LoadModulesFor(TfToken());
 }
 
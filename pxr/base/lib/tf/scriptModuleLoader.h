@@ -73,7 +73,10 @@ class TfScriptModuleLoader : public TfWeakBase {
 
     /// Load all the script modules for any libraries registered using \a
     /// RegisterLibrary if necessary. Loads the modules in dependency order as
-    /// defined in \a RegisterLibrary.
+    /// defined in \a RegisterLibrary.  If the TF_DEFER_SCRIPT_MODULE_LOADING
+    /// env setting is enabled this does nothing; modules are instead imported
+    /// on demand, in dependency order, when a binding module is itself
+    /// imported.
     TF_API
     void LoadModules();
 
@@ -0,0 +1,840 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef TF_SMALL_VECTOR_H
+#define TF_SMALL_VECTOR_H
+
+/// \file tf/smallVector.h
+
+#include "pxr/pxr.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// Contains parts of the small vector implementation that do not depend on
+// the template parameters.
+class TfSmallVectorBase
+{
+public:
+    using size_type = std::uint32_t;
+    using difference_type = std::int32_t;
+
+    /// Returns the local capacity that may be used without increasing the
+    /// size of the TfSmallVector.  TfSmallVector<T, N> will never use more
+    /// local capacity than is specified by N but clients that wish to
+    /// maximize local occupancy in a generic way can compute N using this
+    /// function.
+    template <typename U>
+    static constexpr size_type ComputeSerendipitousLocalCapacity() {
+        return (alignof(U) <= alignof(_Data<U, 0>))
+            ? sizeof(_Data<U, 0>) / sizeof(U)
+            : 0;
+    }
+
+protected:
+    // Invoke std::uninitialized_copy that either moves or copies entries,
+    // depending on whether the type is move constructible or not.
+    template <typename Iterator>
+    static Iterator _UninitializedMove(
+        Iterator first, Iterator last, Iterator dest) {
+        return std::uninitialized_copy(
+            std::make_move_iterator(first),
+            std::make_move_iterator(last),
+            dest);
+    }
+
+    // Invokes either the move or copy constructor (via placement new),
+    // depending on whether U is move constructible or not.
+    template <typename U>
+    static void _MoveConstruct(U *p, U *src) {
+        new (p) U(std::move(*src));
+    }
+
+    // The data storage, which is a union of both the local storage, as well
+    // as a pointer, holding the address to the remote storage on the heap, if
+    // used.
+    template <typename U, size_type M>
+    union _Data {
+    public:
+
+        U *GetLocalStorage() {
+            return reinterpret_cast<U *>(_local);
+        }
+
+        const U *GetLocalStorage() const {
+            return reinterpret_cast<const U *>(_local);
+        }
+
+        U *GetRemoteStorage() {
+            return _remote;
+        }
+
+        const U *GetRemoteStorage() const {
+            return _remote;
+        }
+
+        void SetRemoteStorage(U *p) {
+            _remote = p;
+        }
+
+    private:
+
+        alignas(U) char _local[sizeof(U) * M];
+        U *_remote;
+
+    };
+
+    // For N == 0 the _local member array would be ill-formed, so provide a
+    // specialization that only supports remote storage.
+    template <typename U>
+    union _Data<U, 0> {
+    public:
+
+        U *GetLocalStorage() {
+            return reinterpret_cast<U *>(this);
+        }
+
+        const U *GetLocalStorage() const {
+            return reinterpret_cast<const U *>(this);
+        }
+
+        U *GetRemoteStorage() {
+            return _remote;
+        }
+
+        const U *GetRemoteStorage() const {
+            return _remote;
+        }
+
+        void SetRemoteStorage(U *p) {
+            _remote = p;
+        }
+
+    private:
+
+        U *_remote;
+
+    };
+};
+
+/// \class TfSmallVector
+///
+/// This is a small-vector class with local storage optimization, the local
+/// storage can be specified via a template parameter, and expresses the
+/// number of entries the container can store locally.
+///
+/// In addition to the local storage optimization, this vector is also
+/// optimized for storing a smaller number of entries on the heap: It features
+/// a reduced memory footprint (minimum 16 bytes) by limiting max_size() to
+/// 2^32 entries.
+///
+/// We do not intend to extend this class to behave like a full-fledged STL
+/// vector.  In fact, we'd like to keep it as small and simple as possible, in
+/// order to keep compile times low, and to make it as easy as possible to
+/// read and maintain the code.
+///
+template <typename T, std::uint32_t N>
+class TfSmallVector
+    : public TfSmallVectorBase
+{
+public:
+
+    /// \name STL API.
+    ///
+    /// @{
+    ///
+
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    /// Default constructor.
+    ///
+    TfSmallVector() : _size(0), _capacity(N) {}
+
+    /// Construct a vector holding \p n value-initialized elements.
+    ///
+    explicit TfSmallVector(size_type n) :
+        _capacity(N) {
+        _InitStorage(n);
+        value_type *d = data();
+        for (size_type i = 0; i < n; ++i) {
+            new (d + i) value_type();
+        }
+    }
+
+    /// Construct a vector holding \p n copies of \p v.
+    ///
+    TfSmallVector(size_type n, const value_type &v) :
+        _capacity(N) {
+        _InitStorage(n);
+        std::uninitialized_fill_n(data(), n, v);
+    }
+
+    /// Copy constructor.
+    ///
+    TfSmallVector(const TfSmallVector &rhs) : _capacity(N) {
+        _InitStorage(rhs.size());
+        std::uninitialized_copy(rhs.begin(), rhs.end(), begin());
+    }
+
+    /// Move constructor.
+    ///
+    TfSmallVector(TfSmallVector &&rhs) : _size(0), _capacity(N) {
+        // If rhs can not be stored locally, take rhs's remote storage and
+        // reset rhs to empty.
+        if (rhs.size() > N) {
+            _data.SetRemoteStorage(rhs._data.GetRemoteStorage());
+            std::swap(_capacity, rhs._capacity);
+        }
+
+        // If rhs is stored locally, it's faster to simply move the entries
+        // into this vector's storage, destruct the entries at rhs, and swap
+        // sizes. Note that capacities will be the same in this case, so no
+        // need to swap those.
+        else {
+            _UninitializedMove(rhs.begin(), rhs.end(), begin());
+            rhs._Destruct();
+        }
+        std::swap(_size, rhs._size);
+    }
+
+    /// Construct a new vector from initializer list.
+    ///
+    TfSmallVector(std::initializer_list<T> values)
+        : TfSmallVector(values.begin(), values.end()) {
+    }
+
+    template<typename _ForwardIterator>
+    using _EnableIfForwardIterator =
+        typename std::enable_if<
+            std::is_convertible<
+                typename std::iterator_traits<
+                    _ForwardIterator>::iterator_category,
+                    std::forward_iterator_tag
+                >::value
+            >::type;
+
+    /// Creates a new vector containing copies of the data between
+    /// \p first and \p last.
+    ///
+    template<typename ForwardIterator,
+             typename = _EnableIfForwardIterator<ForwardIterator>>
+    TfSmallVector(ForwardIterator first, ForwardIterator last) : _capacity(N)
+    {
+        _InitStorage(std::distance(first, last));
+        std::uninitialized_copy(first, last, begin());
+    }
+
+    /// Destructor.
+    ///
+    ~TfSmallVector() {
+        _Destruct();
+        _FreeStorage();
+    }
+
+    /// Assignment operator.
+    ///
+    TfSmallVector &operator=(const TfSmallVector &rhs) {
+        if (this != &rhs) {
+            assign(rhs.begin(), rhs.end());
+        }
+        return *this;
+    }
+
+    /// Move assignment operator.
+    ///
+    TfSmallVector &operator=(TfSmallVector &&rhs) {
+        if (this != &rhs) {
+            swap(rhs);
+        }
+        return *this;
+    }
+
+    /// Replace existing contents with the contents of \p ilist.
+    ///
+    TfSmallVector &operator=(std::initializer_list<T> ilist) {
+        assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    /// Swap two vector instances.
+    ///
+    void swap(TfSmallVector &rhs) {
+        // Both this vector and rhs are stored locally.
+        if (_IsLocal() && rhs._IsLocal()) {
+            TfSmallVector *smaller = size() < rhs.size() ? this : &rhs;
+            TfSmallVector *larger = size() < rhs.size() ? &rhs : this;
+
+            // Swap all the entries up to the size of the smaller vector.
+            std::swap_ranges(smaller->begin(), smaller->end(), larger->begin());
+
+            // Move the tail end of the entries, and destruct them at the
+            // source vector.
+            for (size_type i = smaller->size(); i < larger->size(); ++i) {
+                _MoveConstruct(smaller->data() + i, &(*larger)[i]);
+                (*larger)[i].~value_type();
+            }
+
+            // Swap sizes. Capacities are already equal in this case.
+            std::swap(smaller->_size, larger->_size);
+        }
+
+        // Both this vector and rhs are stored remotely.
+        else if (!_IsLocal() && !rhs._IsLocal()) {
+            value_type *tmp = _data.GetRemoteStorage();
+            _data.SetRemoteStorage(rhs._data.GetRemoteStorage());
+            rhs._data.SetRemoteStorage(tmp);
+            std::swap(_size, rhs._size);
+            std::swap(_capacity, rhs._capacity);
+        }
+
+        // Either this vector or rhs is stored remotely, whereas the other
+        // one is stored locally.
+        else {
+            TfSmallVector *remote = _IsLocal() ? &rhs : this;
+            TfSmallVector *local = _IsLocal() ? this : &rhs;
+
+            // Get a pointer to the remote storage. We'll be overwriting the
+            // pointer value below, so gotta retain it first.
+            value_type *remoteStorage = remote->_GetStorage();
+
+            // Move all the entries from the vector with the local storage, to
+            // the other vector's local storage. This will overwrite the pointer
+            // to the other vectors remote storage. Note that we will have to
+            // also destruct the elements at the source's local storage. The
+            // source will be the vector with the remote storage.
+            for (size_type i = 0; i < local->size(); ++i) {
+                _MoveConstruct(
+                    remote->_data.GetLocalStorage() + i, &(*local)[i]);
+                (*local)[i].~value_type();
+            }
+
+            // Swap the remote storage into the vector which previously had the
+            // local storage. It's been properly cleaned up now.
+            local->_data.SetRemoteStorage(remoteStorage);
+
+            // Swap sizes and capacities. Easy peasy.
+            std::swap(remote->_size, local->_size);
+            std::swap(remote->_capacity, local->_capacity);
+        }
+
+    }
+
+    /// Insert an rvalue-reference entry at the given iterator position.
+    ///
+    iterator insert(const_iterator it, value_type &&v) {
+        return _Insert(it, std::move(v));
+    }
+
+    /// Insert an entry at the given iterator.
+    ///
+    iterator insert(const_iterator it, const value_type &v) {
+        return _Insert(it, v);
+    }
+
+    /// Insert the range denoted by [\p first, \p last) at position \p it.
+    ///
+    template <typename ForwardIterator,
+              typename = _EnableIfForwardIterator<ForwardIterator>>
+    iterator insert(
+        const_iterator it, ForwardIterator first, ForwardIterator last) {
+        const size_type num = std::distance(first, last);
+        const size_type index = std::distance(cbegin(), it);
+        if (num == 0) {
+            return begin() + index;
+        }
+
+        // If we require more capacity, grow into fresh storage, moving the
+        // prefix, the new range, and the suffix into place.
+        if (size() + num > capacity()) {
+            const size_type newCapacity = _NextCapacity(num);
+            value_type *newStorage = _Allocate(newCapacity);
+            value_type *d = newStorage;
+            d = _UninitializedMove(begin(), begin() + index, d);
+            d = std::uninitialized_copy(first, last, d);
+            _UninitializedMove(begin() + index, end(), d);
+            _Destruct();
+            _FreeStorage();
+            _data.SetRemoteStorage(newStorage);
+            _capacity = newCapacity;
+        }
+
+        // Otherwise, shift the suffix back by num entries, and copy the new
+        // range into the opened up window.
+        else {
+            value_type *p = begin() + index;
+            value_type *e = end();
+            const size_type numMoved = std::min<size_type>(num, e - p);
+
+            // Move-construct entries past the current end ...
+            _UninitializedMove(e - numMoved, e, e + num - numMoved);
+
+            // ... then move-assign the remainder of the suffix ...
+            std::move_backward(p, e - numMoved, e);
+
+            // ... and fill in the new entries, assigning over the moved-from
+            // prefix portion, copy-constructing into the uninitialized rest.
+            ForwardIterator src = first;
+            size_type i = 0;
+            for (; i < numMoved; ++i, ++src) {
+                p[i] = *src;
+            }
+            for (; i < num; ++i, ++src) {
+                new (p + i) value_type(*src);
+            }
+        }
+
+        _size += num;
+        return begin() + index;
+    }
+
+    /// Erase an entry at the given iterator.
+    ///
+    iterator erase(const_iterator it) {
+        return erase(it, it + 1);
+    }
+
+    /// Erase entries between [ \p first, \p last ) from the vector.
+    ///
+    iterator erase(const_iterator it, const_iterator last) {
+        value_type *p = const_cast<value_type *>(&*it);
+        value_type *q = const_cast<value_type *>(&*last);
+
+        // If we're not removing anything, bail out.
+        if (p == q) {
+            return iterator(p);
+        }
+
+        const size_type num = std::distance(p, q);
+
+        // Move entries starting at last, down a few slots to starting a it.
+        value_type *e = end();
+        std::move(q, e, p);
+
+        // Destruct all entries past the new end of the vector.
+        for (value_type *i = e - num; i != e; ++i) {
+            i->~value_type();
+        }
+
+        _size -= num;
+        return iterator(p);
+    }
+
+    /// Reserve storage for \p newCapacity entries.
+    ///
+    void reserve(size_type newCapacity) {
+        // If we already have enough capacity, or the new capacity is smaller
+        // than the current one, nothing to be done.
+        if (newCapacity <= capacity()) {
+            return;
+        }
+
+        // Allocate new storage and move entries over.
+        _GrowStorage(newCapacity);
+    }
+
+    /// Resize the vector to \p newSize and insert copies of \p v.
+    ///
+    void resize(size_type newSize, const value_type &v = value_type()) {
+        // If the new size is smaller than the current size, let go of some
+        // entries at the tail.
+        if (newSize < size()) {
+            erase(const_iterator(data() + newSize),
+                  const_iterator(data() + size()));
+        }
+
+        // Otherwise, lets grow and fill: Reserve some storage, fill the tail
+        // end with copies of v, and update the new size.
+        else if (newSize > size()) {
+            reserve(newSize);
+            std::uninitialized_fill(data() + size(), data() + newSize, v);
+            _size = newSize;
+        }
+    }
+
+    /// Clear the entries in the vector. Does not let go of the underpinning
+    /// storage.
+    ///
+    void clear() {
+        _Destruct();
+        _size = 0;
+    }
+
+    /// Clears any previously held entries, and copies entries between
+    /// [ \p first, \p last ) to this vector.
+    ///
+    template<typename ForwardIterator,
+             typename = _EnableIfForwardIterator<ForwardIterator>>
+    void assign(ForwardIterator first, ForwardIterator last) {
+        clear();
+        const size_type newSize = std::distance(first, last);
+        reserve(newSize);
+        std::uninitialized_copy(first, last, begin());
+        _size = newSize;
+    }
+
+    /// Replace existing contents with the contents of \p ilist.
+    ///
+    void assign(std::initializer_list<T> ilist) {
+        assign(ilist.begin(), ilist.end());
+    }
+
+    /// Emplace an entry at the back of the vector.
+    ///
+    template < typename... Args >
+    void emplace_back(Args&&... args) {
+        if (size() == capacity()) {
+            _GrowStorage(_NextCapacity(1));
+        }
+        new (data() + size()) value_type(std::forward<Args>(args)...);
+        _size += 1;
+    }
+
+    /// Copy an entry to the back of the vector,
+    ///
+    void push_back(const value_type &v) {
+        emplace_back(v);
+    }
+
+    /// Move an entry to the back of the vector.
+    ///
+    void push_back(value_type &&v) {
+        emplace_back(std::move(v));
+    }
+
+    /// Remove the entry at the back of the vector.
+    ///
+    void pop_back() {
+        back().~value_type();
+        _size -= 1;
+    }
+
+    /// Returns the current size of the vector.
+    ///
+    size_type size() const {
+        return _size;
+    }
+
+    /// Returns the maximum size of this vector.
+    ///
+    static constexpr size_type max_size() {
+        return std::numeric_limits<size_type>::max();
+    }
+
+    /// Returns \c true if this vector is empty.
+    ///
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /// Returns the current capacity of this vector. Note that if the returned
+    /// value is less than or equal to N, the values are stored locally.
+    ///
+    size_type capacity() const {
+        return _capacity;
+    }
+
+    /// Returns an iterator to the beginning of the vector.
+    ///
+    iterator begin() {
+        return iterator(_GetStorage());
+    }
+
+    /// Returns an iterator to the beginning of the vector.
+    ///
+    const_iterator begin() const {
+        return const_iterator(_GetStorage());
+    }
+
+    /// Returns an iterator to the beginning of the vector.
+    ///
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    /// Returns an iterator to the end of the vector.
+    ///
+    iterator end() {
+        return iterator(_GetStorage() + size());
+    }
+
+    /// Returns an iterator to the end of the vector.
+    ///
+    const_iterator end() const {
+        return const_iterator(_GetStorage() + size());
+    }
+
+    /// Returns an iterator to the end of the vector.
+    ///
+    const_iterator cend() const {
+        return end();
+    }
+
+    /// Returns a reverse iterator to the beginning of the vector.
+    ///
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    /// Returns a reverse iterator to the beginning of the vector.
+    ///
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    /// Returns a reverse iterator to the beginning of the vector.
+    ///
+    const_reverse_iterator crbegin() const {
+        return rbegin();
+    }
+
+    /// Returns a reverse iterator to the end of the vector.
+    ///
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    /// Returns a reverse iterator to the end of the vector.
+    ///
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    /// Returns a reverse iterator to the end of the vector.
+    ///
+    const_reverse_iterator crend() const {
+        return rend();
+    }
+
+    /// Returns the first element in the vector.
+    ///
+    reference front() {
+        return *begin();
+    }
+
+    /// Returns the first element in the vector.
+    ///
+    const_reference front() const {
+        return *begin();
+    }
+
+    /// Returns the last element in the vector.
+    ///
+    reference back() {
+        return data()[size() - 1];
+    }
+
+    /// Returns the last elements in the vector.
+    ///
+    const_reference back() const {
+        return data()[size() - 1];
+    }
+
+    /// Access the specified element.
+    ///
+    reference operator[](size_type i) {
+        return data()[i];
+    }
+
+    /// Access the specified element.
+    ///
+    const_reference operator[](size_type i) const {
+        return data()[i];
+    }
+
+    /// Direct access to the underlying array.
+    ///
+    value_type *data() {
+        return _GetStorage();
+    }
+
+    /// Direct access to the underlying array.
+    ///
+    const value_type *data() const {
+        return _GetStorage();
+    }
+
+    /// Lexicographically compares the elements in the vectors for equality.
+    ///
+    bool operator==(const TfSmallVector &rhs) const {
+        return size() == rhs.size() && std::equal(begin(), end(), rhs.begin());
+    }
+
+    /// Lexicographically compares the elements in the vectors for
+    /// inequality.
+    ///
+    bool operator!=(const TfSmallVector &rhs) const {
+        return !operator==(rhs);
+    }
+
+    /// @}
+
+private:
+
+    // Returns true if the local storage is used.
+    bool _IsLocal() const {
+        return _capacity <= N;
+    }
+
+    // Return a pointer to the storage, which is either local or remote
+    // depending on the current capacity.
+    value_type *_GetStorage() {
+        return _IsLocal() ?
+            _data.GetLocalStorage() : _data.GetRemoteStorage();
+    }
+
+    // Return a const pointer to the storage, which is either local or remote
+    // depending on the current capacity.
+    const value_type *_GetStorage() const {
+        return _IsLocal() ?
+            _data.GetLocalStorage() : _data.GetRemoteStorage();
+    }
+
+    // Allocate a buffer on the heap, large enough to hold size entries.
+    static value_type *_Allocate(size_type size) {
+        return static_cast<value_type *>(
+            malloc(sizeof(value_type) * size));
+    }
+
+    // Free the remote storage, if used.
+    void _FreeStorage() {
+        if (!_IsLocal()) {
+            free(_data.GetRemoteStorage());
+        }
+    }
+
+    // Destructs all the entries currently stored in this vector.
+    void _Destruct() {
+        value_type *b = data();
+        value_type *e = b + size();
+        for (value_type *p = b; p != e; ++p) {
+            p->~value_type();
+        }
+    }
+
+    // Initialize the vector with a given size, either allocating remote
+    // storage, or just updating the size, if the entries fit locally.
+    // Note that this method does not construct any entries.
+    void _InitStorage(size_type size) {
+        if (size > capacity()) {
+            _data.SetRemoteStorage(_Allocate(size));
+            _capacity = size;
+        }
+        _size = size;
+    }
+
+    // Grow the capacity of the storage to hold newCapacity entries, moving
+    // all the existing entries over.
+    void _GrowStorage(const size_type newCapacity) {
+        value_type *newStorage = _Allocate(newCapacity);
+        _UninitializedMove(begin(), end(), iterator(newStorage));
+        _Destruct();
+        _FreeStorage();
+        _data.SetRemoteStorage(newStorage);
+        _capacity = newCapacity;
+    }
+
+    // Returns the next capacity to use for vector growth, when at least
+    // spaceFor more entries must be accommodated.  Growth is geometric, to
+    // guarantee amortized constant time insertion.
+    size_type _NextCapacity(size_type spaceFor) const {
+        const size_type nextCapacity = capacity() + (capacity() / 2);
+        return std::max<size_type>(size() + spaceFor, nextCapacity);
+    }
+
+    // Insert the value v at the given iterator position, growing and/or
+    // shifting entries as required.
+    template <typename U>
+    iterator _Insert(const_iterator it, U &&v) {
+        const size_type index = std::distance(cbegin(), it);
+
+        // In the case of an insertion at the end, simply defer to
+        // emplace_back, which correctly deals with growth.
+        if (index == size()) {
+            emplace_back(std::forward<U>(v));
+            return begin() + index;
+        }
+
+        // If there is not enough capacity, grow into fresh storage, moving
+        // the prefix and suffix into place around the new entry.
+        if (size() == capacity()) {
+            const size_type newCapacity = _NextCapacity(1);
+            value_type *newStorage = _Allocate(newCapacity);
+            value_type *d = newStorage;
+            d = _UninitializedMove(begin(), begin() + index, d);
+            new (d) value_type(std::forward<U>(v));
+            _UninitializedMove(begin() + index, end(), d + 1);
+            _Destruct();
+            _FreeStorage();
+            _data.SetRemoteStorage(newStorage);
+            _capacity = newCapacity;
+        }
+
+        // Otherwise, move-construct the current last entry past the end,
+        // shift the remainder of the suffix back by one slot, and move-assign
+        // the new entry into place.
+        else {
+            value_type *p = begin() + index;
+            value_type *e = end();
+            _MoveConstruct(e, e - 1);
+            std::move_backward(p, e - 1, e);
+            *p = std::forward<U>(v);
+        }
+
+        _size += 1;
+        return begin() + index;
+    }
+
+    // The vector storage, which is a union of the local storage and a pointer
+    // to the heap memory, if allocated.
+    _Data<value_type, N> _data;
+
+    // The current size of the vector, i.e. how many entries it contains.
+    size_type _size;
+
+    // The current capacity of the vector, i.e. how big the currently
+    // allocated storage space is.
+    size_type _capacity;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -0,0 +1,206 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/tf/flatHashMap.h"
+#include "pxr/base/tf/hash.h"
+#include "pxr/base/tf/regTest.h"
+#include "pxr/base/tf/stringUtils.h"
+
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// A deliberately terrible hash that maps everything to a handful of home
+// slots, to exercise long probe sequences and backward-shift deletion.
+struct TestTf_FlatHashMapBadHash
+{
+    size_t operator()(const size_t &x) const {
+        return x % 7;
+    }
+};
+
+static void Run()
+{
+    typedef TfFlatHashMap<size_t, std::string, TfHash> _Map;
+    _Map _map;
+
+    TF_AXIOM(_map.empty());
+    TF_AXIOM(_map.begin() == _map.end());
+
+    // Insert a bunch of numbers in order.
+    printf("inserting numbers to 10000\n");
+    for(size_t i = 1; i <= 10000; ++i) {
+        _map[i] = TfStringify(i);
+        TF_AXIOM(_map.size() == i);
+        TF_AXIOM(_map.find(i) != _map.end());
+        TF_AXIOM(_map.count(i) == 1);
+    }
+
+    TF_AXIOM(!_map.empty());
+    TF_AXIOM(_map.size() == 10000);
+
+    printf("exercise assignment operator and swap\n");
+    _Map newMap;
+
+    newMap = _map;
+    TF_AXIOM(newMap.size() == _map.size());
+    newMap[9999999] = "full";
+    TF_AXIOM(newMap.size() == _map.size()+1);
+
+    newMap.swap(_map);
+    TF_AXIOM(newMap.size()+1 == _map.size());
+    newMap.swap(_map);
+    TF_AXIOM(newMap.size() == _map.size()+1);
+
+    printf("checking containment\n");
+    for(size_t i = 1; i <= 10000; ++i)
+        TF_AXIOM(_map.count(i) == 1);
+
+    printf("checking correct mapping\n");
+    for(size_t i = 1; i <= 10000; ++i)
+        TF_AXIOM(_map[i] == TfStringify(i));
+
+    printf("checking misses\n");
+    for(size_t i = 10001; i <= 20000; ++i)
+        TF_AXIOM(_map.find(i) == _map.end());
+
+    // Remove some stuff.
+    printf("erasing 8000 elements\n");
+    for(size_t i = 1000; i < 9000; ++i)
+        TF_AXIOM(_map.erase(i) == 1);
+
+    // Attempt to remove some stuff again.
+    printf("erasing 8000 elements\n");
+    for(size_t i = 1000; i < 9000; ++i)
+        TF_AXIOM(_map.erase(i) == 0);
+
+    TF_AXIOM(!_map.empty());
+    TF_AXIOM(_map.size() == 2000);
+
+    printf("checking containment\n");
+    for(size_t i = 1; i <= 10000; ++i) {
+        if (i < 1000 || i >= 9000)
+            TF_AXIOM(_map.count(i) == 1);
+        else
+            TF_AXIOM(_map.count(i) == 0);
+    }
+
+    // Put it back.
+    printf("reinserting 8000 elements\n");
+    for(size_t i = 1000; i < 9000; ++i)
+        _map[i] = TfStringify(i);
+
+    TF_AXIOM(!_map.empty());
+    TF_AXIOM(_map.size() == 10000);
+
+    printf("checking correct mapping\n");
+    for(size_t i = 1; i <= 10000; ++i)
+        TF_AXIOM(_map[i] == TfStringify(i));
+
+    // Remove some stuff.
+    printf("erasing 8000 elements\n");
+    for(size_t i = 1000; i < 9000; ++i)
+        _map.erase(i);
+
+    // iterate
+    printf("iterating\n");
+    size_t count = 0;
+    for(_Map::iterator i = _map.begin(); i != _map.end(); ++i, ++count) {
+        TF_AXIOM(TfStringify(i->first) == i->second);
+        TF_AXIOM(i->first < 1000 || i->first >= 9000);
+    }
+    TF_AXIOM(count == 2000);
+
+    // iterate
+    printf("const iterating\n");
+    count = 0;
+    for(_Map::const_iterator i = _map.begin(); i != _map.end(); ++i, ++count) {
+        TF_AXIOM(TfStringify(i->first) == i->second);
+        TF_AXIOM(i->first < 1000 || i->first >= 9000);
+    }
+    TF_AXIOM(count == 2000);
+
+    printf("erasing via iterator\n");
+    _Map::iterator i0 = _map.begin();
+    const size_t victim = i0->first;
+    _map.erase(i0);
+    TF_AXIOM(_map.size() == 1999);
+    TF_AXIOM(_map.count(victim) == 0);
+
+    printf("bulk building from a range\n");
+    std::vector< std::pair<size_t, std::string> > morekeys;
+    for(size_t i = 1; i <= 10000; ++i)
+        morekeys.push_back(std::make_pair(i, TfStringify(i)));
+    _Map built(morekeys.begin(), morekeys.end());
+    TF_AXIOM(built.size() == 10000);
+    for(size_t i = 1; i <= 10000; ++i)
+        TF_AXIOM(built[i] == TfStringify(i));
+
+    printf("reserving, then inserting a range\n");
+    _Map reserved;
+    reserved.reserve(morekeys.size());
+    reserved.insert(morekeys.begin(), morekeys.end());
+    TF_AXIOM(reserved.size() == 10000);
+
+    // clear it.
+    printf("clearing\n");
+    _map.clear();
+    TF_AXIOM(_map.empty());
+    TF_AXIOM(_map.size() == 0);
+    TF_AXIOM(_map.begin() == _map.end());
+
+    printf("\ntesting TfFlatHashMap with a clustering hash\n");
+
+    typedef TfFlatHashMap<size_t, std::string, TestTf_FlatHashMapBadHash>
+        _Map2;
+
+    _Map2 _map2;
+    for(size_t i = 1; i <= 1000; ++i)
+        _map2[i] = TfStringify(i);
+    TF_AXIOM(_map2.size() == 1000);
+    for(size_t i = 1; i <= 1000; ++i)
+        TF_AXIOM(_map2[i] == TfStringify(i));
+
+    // Erase odd keys and verify the evens survive backward shifting.
+    for(size_t i = 1; i <= 1000; i += 2)
+        TF_AXIOM(_map2.erase(i) == 1);
+    TF_AXIOM(_map2.size() == 500);
+    for(size_t i = 1; i <= 1000; ++i) {
+        TF_AXIOM(_map2.count(i) == (i % 2 == 0 ? 1u : 0u));
+        if (i % 2 == 0)
+            TF_AXIOM(_map2[i] == TfStringify(i));
+    }
+}
+
+static bool
+Test_TfFlatHashMap()
+{
+    Run();
+    return true;
+}
+
+TF_ADD_REGTEST(TfFlatHashMap);
@@ -422,6 +422,83 @@ _TestNoticeBlock()
     TF_AXIOM(l.hits[1] == 20);
 }
 
+class DeferTestNotice : public TfNotice {
+public:
+    DeferTestNotice(const string& what)
+        : _what(what) {
+    }
+    ~DeferTestNotice();
+
+    const string& GetWhat() const {
+        return _what;
+    }
+
+protected:
+    virtual TfNotice *_CloneForDeferredDelivery() const {
+        return new DeferTestNotice(*this);
+    }
+
+private:
+    const string _what;
+};
+
+DeferTestNotice::~DeferTestNotice() { }
+
+struct DeferListener : public TfWeakBase
+{
+    DeferListener()
+    {
+        TfNotice::Register(TfCreateWeakPtr(this), &DeferListener::Listen);
+    }
+
+    void Listen(const DeferTestNotice& n)
+    {
+        whats.push_back(n.GetWhat());
+    }
+
+    vector<string> whats;
+};
+
+static void
+_TestNoticeDeferBlock()
+{
+    DeferListener l;
+
+    // Without a block, deferrable notices are delivered synchronously.
+    TF_AXIOM(DeferTestNotice("immediate").Send() == 1);
+    TF_AXIOM(l.whats == vector<string>({"immediate"}));
+    l.whats.clear();
+
+    {
+        TfNotice::DeferBlock block;
+
+        // Deferrable notices are queued; Send reports zero listeners.
+        TF_AXIOM(DeferTestNotice("first").Send() == 0);
+        TF_AXIOM(DeferTestNotice("second").Send() == 0);
+        TF_AXIOM(l.whats.empty());
+
+        // A nested block neither delivers nor drops the queued notices.
+        {
+            TfNotice::DeferBlock nestedBlock;
+            TF_AXIOM(DeferTestNotice("third").Send() == 0);
+        }
+        TF_AXIOM(l.whats.empty());
+    }
+
+    // The outermost block has closed; the queued notices were delivered
+    // in the order they were sent.
+    TF_AXIOM(l.whats == vector<string>({"first", "second", "third"}));
+    l.whats.clear();
+
+    // Notices that do not opt into deferral ignore the block entirely.
+    {
+        BlockListener bl;
+        TfNotice::DeferBlock block;
+        TestNotice("not deferrable").Send();
+        TF_AXIOM(bl.hits[0] == 1);
+    }
+}
+
 static bool
 Test_TfNotice()
 {
@@ -495,13 +572,16 @@ Test_TfNotice()
     _TestSpoofedNotices();
 
     _TestNoticeBlock();
-    
+
+    _TestNoticeDeferBlock();
+
     return true;
 }
 
 TF_REGISTRY_FUNCTION(TfType)
 {
     TfType::Define<TestNotice, TfType::Bases<TfNotice> >();
+    TfType::Define<DeferTestNotice, TfType::Bases<TfNotice> >();
     TfType::Define<MainNotice, TfType::Bases<TfNotice> >();
     TfType::Define<WorkerNotice, TfType::Bases<TfNotice> >();
 }
@@ -0,0 +1,202 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/tf/regTest.h"
+#include "pxr/base/tf/smallVector.h"
+
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static void
+TestBasics()
+{
+    TfSmallVector<int, 4> v;
+    TF_AXIOM(v.empty());
+    TF_AXIOM(v.size() == 0);
+    TF_AXIOM(v.capacity() == 4);
+
+    // Fill up the local storage.
+    for (int i = 0; i < 4; ++i) {
+        v.push_back(i);
+    }
+    TF_AXIOM(v.size() == 4);
+    TF_AXIOM(v.capacity() == 4);
+
+    // Grow into remote storage.
+    v.push_back(4);
+    TF_AXIOM(v.size() == 5);
+    TF_AXIOM(v.capacity() > 4);
+
+    for (int i = 0; i < 5; ++i) {
+        TF_AXIOM(v[i] == i);
+    }
+
+    v.pop_back();
+    TF_AXIOM(v.size() == 4);
+    TF_AXIOM(v.back() == 3);
+    TF_AXIOM(v.front() == 0);
+}
+
+static void
+TestInsertAndErase()
+{
+    TfSmallVector<std::string, 2> v;
+    v.push_back("b");
+    v.push_back("d");
+
+    // Insert at the beginning, in the middle, and at the end, growing from
+    // local to remote storage along the way.
+    v.insert(v.begin(), "a");
+    v.insert(v.begin() + 2, "c");
+    v.insert(v.end(), "e");
+
+    TF_AXIOM(v.size() == 5);
+    TF_AXIOM(v[0] == "a" && v[1] == "b" && v[2] == "c" &&
+             v[3] == "d" && v[4] == "e");
+
+    // Range insertion.
+    const std::vector<std::string> more = { "x", "y", "z" };
+    v.insert(v.begin() + 1, more.begin(), more.end());
+    TF_AXIOM(v.size() == 8);
+    TF_AXIOM(v[0] == "a" && v[1] == "x" && v[2] == "y" &&
+             v[3] == "z" && v[4] == "b");
+
+    // Erase the inserted range again.
+    v.erase(v.begin() + 1, v.begin() + 4);
+    TF_AXIOM(v.size() == 5);
+    TF_AXIOM(v[0] == "a" && v[1] == "b" && v[2] == "c" &&
+             v[3] == "d" && v[4] == "e");
+
+    v.erase(v.begin());
+    TF_AXIOM(v.front() == "b");
+    v.erase(v.end() - 1);
+    TF_AXIOM(v.back() == "d");
+}
+
+static void
+TestCopyAndMove()
+{
+    TfSmallVector<std::string, 2> local = { "a", "b" };
+    TfSmallVector<std::string, 2> remote = { "a", "b", "c", "d" };
+
+    // Copy construction from local and remote storage.
+    TfSmallVector<std::string, 2> localCopy(local);
+    TF_AXIOM(localCopy == local);
+    TfSmallVector<std::string, 2> remoteCopy(remote);
+    TF_AXIOM(remoteCopy == remote);
+
+    // Move construction steals remote storage, and moves local entries.
+    TfSmallVector<std::string, 2> movedLocal(std::move(localCopy));
+    TF_AXIOM(movedLocal == local);
+    TF_AXIOM(localCopy.empty());
+    TfSmallVector<std::string, 2> movedRemote(std::move(remoteCopy));
+    TF_AXIOM(movedRemote == remote);
+    TF_AXIOM(remoteCopy.empty());
+
+    // Assignment.
+    TfSmallVector<std::string, 2> assigned;
+    assigned = remote;
+    TF_AXIOM(assigned == remote);
+    assigned = local;
+    TF_AXIOM(assigned == local);
+}
+
+static void
+TestSwap()
+{
+    TfSmallVector<std::string, 2> a = { "a", "b" };
+    TfSmallVector<std::string, 2> b = { "x", "y", "z" };
+
+    // local <-> remote.
+    a.swap(b);
+    TF_AXIOM(a.size() == 3 && a[0] == "x" && a[2] == "z");
+    TF_AXIOM(b.size() == 2 && b[0] == "a" && b[1] == "b");
+
+    // local <-> local, different sizes.
+    TfSmallVector<std::string, 4> c = { "1" };
+    TfSmallVector<std::string, 4> d = { "2", "3", "4" };
+    c.swap(d);
+    TF_AXIOM(c.size() == 3 && c[0] == "2" && c[2] == "4");
+    TF_AXIOM(d.size() == 1 && d[0] == "1");
+
+    // remote <-> remote.
+    TfSmallVector<std::string, 1> e = { "a", "b", "c" };
+    TfSmallVector<std::string, 1> f = { "d", "e", "f", "g" };
+    e.swap(f);
+    TF_AXIOM(e.size() == 4 && e[0] == "d");
+    TF_AXIOM(f.size() == 3 && f[0] == "a");
+}
+
+static void
+TestResizeAndAssign()
+{
+    TfSmallVector<std::string, 2> v;
+    v.resize(5, "x");
+    TF_AXIOM(v.size() == 5);
+    TF_AXIOM(v[0] == "x" && v[4] == "x");
+
+    v.resize(1);
+    TF_AXIOM(v.size() == 1);
+
+    const std::vector<std::string> src = { "a", "b", "c" };
+    v.assign(src.begin(), src.end());
+    TF_AXIOM(v.size() == 3);
+    TF_AXIOM(v[0] == "a" && v[1] == "b" && v[2] == "c");
+
+    v.clear();
+    TF_AXIOM(v.empty());
+
+    // Reserve does not change the size.
+    v.reserve(100);
+    TF_AXIOM(v.empty());
+    TF_AXIOM(v.capacity() >= 100);
+}
+
+static void
+TestZeroLocalCapacity()
+{
+    TfSmallVector<std::string, 0> v;
+    TF_AXIOM(v.capacity() == 0);
+    v.push_back("a");
+    v.push_back("b");
+    TF_AXIOM(v.size() == 2);
+    TF_AXIOM(v[0] == "a" && v[1] == "b");
+}
+
+static bool
+Test_TfSmallVector()
+{
+    TestBasics();
+    TestInsertAndErase();
+    TestCopyAndMove();
+    TestSwap();
+    TestResizeAndAssign();
+    TestZeroLocalCapacity();
+    return true;
+}
+
+TF_ADD_REGTEST(TfSmallVector);
@@ -38,6 +38,8 @@
 
 #include <tbb/spin_mutex.h>
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <ostream>
 #include <vector>
@@ -101,9 +103,37 @@ struct Tf_TokenRegistry
     // TfHashSet for now.
     typedef TfHashSet<TfToken::_Rep, _InnerHash, _Eq> _RepSet;
 
+    // A lock-free open-addressed probe table over immortal reps.  Immortal
+    // reps are never destroyed, so readers may probe these tables without
+    // taking the set locks.  Counted reps can expire concurrently, so they
+    // always go through the locked path.
+    struct _ProbeTable {
+        explicit _ProbeTable(size_t cap)
+            : capacity(cap)
+            , buckets(new std::atomic<_RepPtr>[cap]) {
+            for (size_t i = 0; i != cap; ++i) {
+                buckets[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+        size_t const capacity;
+        std::unique_ptr<std::atomic<_RepPtr>[]> const buckets;
+    };
+
+    // Per-set index of immortal reps.  All members other than the published
+    // table pointer are protected by the corresponding set's lock.  Old
+    // tables are retired rather than freed, since lock-free readers may
+    // still be probing them; the retired memory is bounded by twice the
+    // final table size.
+    struct _ImmortalIndex {
+        std::atomic<_ProbeTable *> table { nullptr };
+        size_t count = 0;
+        std::vector<std::unique_ptr<_ProbeTable>> retired;
+    };
+
     // Data members.
     _RepSet _sets[_NumSets];
     mutable _CacheLinePadded<tbb::spin_mutex> _locks[_NumSets];
+    _ImmortalIndex _immortals[_NumSets];
 
     static Tf_TokenRegistry& _GetInstance() {
         return TfSingleton<Tf_TokenRegistry>::GetInstance();
@@ -190,6 +220,78 @@ private:
         return ret;
     }
 
+    // Probe the immortal index for \p s without taking any locks.  Returns
+    // null if \p s is not present (or only present as a counted rep).
+    inline _RepPtr _FindImmortalLockFree(size_t setNum, char const *s) const {
+        _ProbeTable const *t =
+            _immortals[setNum].table.load(std::memory_order_acquire);
+        if (!t) {
+            return nullptr;
+        }
+        size_t const mask = t->capacity - 1;
+        _InnerHash h;
+        for (size_t i = h(s) & mask; ; i = (i + 1) & mask) {
+            _RepPtr rep = t->buckets[i].load(std::memory_order_acquire);
+            if (!rep) {
+                return nullptr;
+            }
+            if (_Eq()(rep->_cstr, s)) {
+                return rep;
+            }
+        }
+    }
+
+    // Publish \p rep into the immortal index for \p setNum.  Must be called
+    // with the set's lock held, and only for reps that are (now) immortal.
+    void _PublishImmortal(size_t setNum, _RepPtr rep) {
+        _ImmortalIndex &idx = _immortals[setNum];
+        _ProbeTable *t = idx.table.load(std::memory_order_relaxed);
+        if (!t || 2 * (idx.count + 1) > t->capacity) {
+            t = _GrowProbeTable(idx, t);
+        }
+        size_t const mask = t->capacity - 1;
+        _InnerHash h;
+        for (size_t i = h(rep->_cstr) & mask; ; i = (i + 1) & mask) {
+            _RepPtr cur = t->buckets[i].load(std::memory_order_relaxed);
+            if (!cur) {
+                // Release so that lock-free readers that observe this entry
+                // also observe the fully-constructed rep.
+                t->buckets[i].store(rep, std::memory_order_release);
+                ++idx.count;
+                return;
+            }
+            if (cur == rep) {
+                return;
+            }
+        }
+    }
+
+    // Grow (or create) the probe table for \p idx, rehashing entries from
+    // \p old.  Must be called with the set's lock held.
+    _ProbeTable *_GrowProbeTable(_ImmortalIndex &idx, _ProbeTable *old) {
+        size_t const newCapacity = old ? 2 * old->capacity : 256;
+        std::unique_ptr<_ProbeTable> newTable(new _ProbeTable(newCapacity));
+        size_t const mask = newCapacity - 1;
+        _InnerHash h;
+        if (old) {
+            for (size_t i = 0; i != old->capacity; ++i) {
+                _RepPtr rep = old->buckets[i].load(std::memory_order_relaxed);
+                if (!rep) {
+                    continue;
+                }
+                size_t j = h(rep->_cstr) & mask;
+                while (newTable->buckets[j].load(std::memory_order_relaxed)) {
+                    j = (j + 1) & mask;
+                }
+                newTable->buckets[j].store(rep, std::memory_order_relaxed);
+            }
+        }
+        _ProbeTable *ret = newTable.get();
+        idx.retired.push_back(std::move(newTable));
+        idx.table.store(ret, std::memory_order_release);
+        return ret;
+    }
+
     static inline uint64_t _ComputeCompareCode(char const *p) {
         uint64_t compCode = 0;
         int nchars = sizeof(compCode);
@@ -213,6 +315,12 @@ private:
 
         size_t setNum = _GetSetNum(_CStr(s));
 
+        // Fast path: already-interned immortal tokens are found without
+        // taking any locks.
+        if (_RepPtr rep = _FindImmortalLockFree(setNum, _CStr(s))) {
+            return _RepPtrAndBits(rep, /*isCounted=*/false);
+        }
+
         tbb::spin_mutex::scoped_lock lock(_locks[setNum].val);
 
         // Insert or lookup an existing.
@@ -221,10 +329,12 @@ private:
             _RepPtr rep = &(*iter);
             bool isCounted = rep->_isCounted;
             if (isCounted) {
-                if (makeImmortal)
+                if (makeImmortal) {
                     isCounted = rep->_isCounted = false;
-                else
+                    _PublishImmortal(setNum, rep);
+                } else {
                     ++rep->_refCount;
+                }
             }
             return _RepPtrAndBits(rep, isCounted);
         } else {
@@ -236,6 +346,8 @@ private:
             rep->_compareCode = _ComputeCompareCode(rep->_cstr);
             if (!makeImmortal)
                 rep->_refCount = 1;
+            else
+                _PublishImmortal(setNum, rep);
             return _RepPtrAndBits(rep, !makeImmortal);
         }
     }
@@ -247,6 +359,12 @@ private:
         
         size_t setNum = _GetSetNum(_CStr(s));
 
+        // Fast path: already-interned immortal tokens are found without
+        // taking any locks.
+        if (_RepPtr rep = _FindImmortalLockFree(setNum, _CStr(s))) {
+            return _RepPtrAndBits(rep, /*isCounted=*/false);
+        }
+
         tbb::spin_mutex::scoped_lock lock(_locks[setNum].val);
 
         _RepSet::const_iterator iter =
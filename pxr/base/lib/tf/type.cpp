@@ -285,6 +285,9 @@ public:
     TfType::_TypeInfo *NewTypeInfo(const string &typeName) {
         TfType::_TypeInfo *info = new TfType::_TypeInfo(typeName);
         _typeNameToTypeMap[typeName] = info;
+        // The published name table (if any) no longer reflects the live
+        // map; retire it so the next lookup rebuilds a fresh snapshot.
+        _InvalidateNameToTypeSnapshot();
         return info;
     }
 
@@ -318,7 +321,36 @@ public:
 
     TfType::_TypeInfo *GetRoot() const { return _rootTypeInfo; }
 
+    // Lockless lookup by typename.  Lookups consult an immutable published
+    // snapshot of the name table, so the steady-state read path (type
+    // registration effectively stops after startup) takes no lock.  If no
+    // snapshot is current because a type was declared since the last
+    // lookup, fall back to rebuilding and publishing one under the
+    // registry lock.
     TfType::_TypeInfo *FindByName(const string &name) const {
+        typedef TfType::_TypeInfo::NameToTypeMap NameToTypeMap;
+        // Announce this reader before loading the snapshot pointer; a
+        // publisher that observes no readers after publishing a new
+        // snapshot knows no thread can still be consulting a superseded
+        // one.  Both sides rely on sequential consistency here.
+        ++_snapshotReaders;
+        bool found = false;
+        TfType::_TypeInfo *result = nullptr;
+        if (NameToTypeMap const *snapshot = _nameToTypeSnapshot.load()) {
+            auto it = snapshot->find(name);
+            result = it != snapshot->end() ? it->second : nullptr;
+            found = true;
+        }
+        --_snapshotReaders;
+        return found ? result : _FindByNamePublishingSnapshot(name);
+    }
+
+    // Lookup by typename in the live name table.  Caller must hold the
+    // registry lock.  Declarations use this rather than FindByName():
+    // every declaration retires the published snapshot, so going through
+    // the snapshot path during a registration burst would copy the whole
+    // table once per declaration.
+    TfType::_TypeInfo *FindByNameInLiveTable(const string &name) const {
         auto it = _typeNameToTypeMap.find(name);
         return it != _typeNameToTypeMap.end() ? it->second : nullptr;
     }
@@ -343,6 +375,42 @@ public:
 private:
     Tf_TypeRegistry();
 
+    // Copies the live name table, publishes the copy as the current
+    // snapshot, and performs the lookup in it.  Callers must not hold the
+    // registry lock.
+    TfType::_TypeInfo *
+    _FindByNamePublishingSnapshot(const string &name) const {
+        typedef TfType::_TypeInfo::NameToTypeMap NameToTypeMap;
+        ScopedLock lock(_mutex, /*write=*/true);
+        NameToTypeMap const *snapshot = _nameToTypeSnapshot.load();
+        if (!snapshot) {
+            // Ownership lives in _nameToTypeSnapshots.
+            _nameToTypeSnapshots.emplace_back(
+                new NameToTypeMap(_typeNameToTypeMap));
+            snapshot = _nameToTypeSnapshots.back().get();
+            _nameToTypeSnapshot.store(snapshot);
+            // Retire superseded generations.  New readers can only
+            // observe the snapshot just published, so once no readers
+            // are in flight nothing references the older ones.  If
+            // readers are in flight, the older generations survive
+            // until the next publication observes none.
+            if (_nameToTypeSnapshots.size() > 1 &&
+                _snapshotReaders.load() == 0) {
+                _nameToTypeSnapshots.erase(
+                    _nameToTypeSnapshots.begin(),
+                    _nameToTypeSnapshots.end() - 1);
+            }
+        }
+        auto it = snapshot->find(name);
+        return it != snapshot->end() ? it->second : nullptr;
+    }
+
+    // Caller must hold the registry lock for writing (or be the sole
+    // initializing thread).
+    void _InvalidateNameToTypeSnapshot() {
+        _nameToTypeSnapshot.store(nullptr, std::memory_order_release);
+    }
+
     mutable RWMutex _mutex;
 
     // The thread that is currently performing initialization.  This is set to a
@@ -352,7 +420,21 @@ private:
     // Map of typeName to _TypeInfo*.
     // This holds all declared types, by unique typename.
     TfType::_TypeInfo::NameToTypeMap _typeNameToTypeMap;
-    
+
+    // Immutable published copy of _typeNameToTypeMap used by the lockless
+    // FindByName read path, or null if a type has been declared since the
+    // last publication.  Published snapshots are owned by
+    // _nameToTypeSnapshots; superseded generations are reclaimed when a
+    // publication observes no readers in flight (_snapshotReaders),
+    // leaving only the current generation in the common case.
+    mutable std::atomic<TfType::_TypeInfo::NameToTypeMap const *>
+        _nameToTypeSnapshot;
+    mutable vector<
+        std::unique_ptr<TfType::_TypeInfo::NameToTypeMap const>>
+        _nameToTypeSnapshots;
+    mutable std::atomic<int> _snapshotReaders;
+
+
     // Map of type_info to _TypeInfo*.
     // This holds info for types that have been defined as C++ types.
     // XXX: change this to regular hash table?
@@ -384,6 +466,8 @@ TF_INSTANTIATE_SINGLETON(Tf_TypeRegistry);
 struct _TfUnknownType {};
 
 Tf_TypeRegistry::Tf_TypeRegistry() :
+    _nameToTypeSnapshot(nullptr),
+    _snapshotReaders(0),
     _unknownTypeInfo(0),
     _rootTypeInfo(0),
     _sendDeclaredNotification(false)
@@ -478,9 +562,10 @@ TfType::FindDerivedByName(const string &name) const
     if (!result) {
         const auto &r = Tf_TypeRegistry::GetInstance();
         r.WaitForInitializingThread();
-        ScopedLock regLock(r.GetMutex(), /*write=*/false);
+        // FindByName performs its own synchronization: it reads from a
+        // published snapshot of the name table when one is current, and
+        // otherwise takes the registry lock itself to rebuild one.
         TfType::_TypeInfo *foundInfo = r.FindByName(name);
-        regLock.release();
         if (foundInfo) {
             // Next look for a type with the given typename.  If a type was 
             // found, verify that it derives from *this. 
@@ -802,12 +887,32 @@ TfType::Declare(const string &typeName)
 {
     TfAutoMallocTag2 tag("Tf", "TfType::Declare");
 
-    TfType t = FindByName(typeName);
+    auto &r = Tf_TypeRegistry::GetInstance();
+    r.WaitForInitializingThread();
+
+    TfType t;
+
+    // Check for a root alias with this name first, as FindByName() would.
+    {
+        TfType const &root = GetRoot();
+        ScopedLock rootInfoLock(root._info->mutex, /*write=*/false);
+        if (TfType::_TypeInfo *aliasInfo = root._info->FindByAlias(typeName)) {
+            t = TfType(aliasInfo);
+        }
+    }
+
     if (t.IsUnknown()) {
-        auto &r = Tf_TypeRegistry::GetInstance();
+        // Consult the live name table under the registry lock rather than
+        // going through FindByName(): declaring a type retires the
+        // published snapshot, so the snapshot path would recopy the whole
+        // table for every type declared during a registration burst.
         ScopedLock lock(r.GetMutex(), /*write=*/true);
-        t = TfType(r.NewTypeInfo(typeName));
-        TF_AXIOM(!t._info->IsDefined());
+        if (TfType::_TypeInfo *info = r.FindByNameInLiveTable(typeName)) {
+            t = TfType(info);
+        } else {
+            t = TfType(r.NewTypeInfo(typeName));
+            TF_AXIOM(!t._info->IsDefined());
+        }
     }
     return t.GetCanonicalType();
 }
@@ -27,7 +27,9 @@
 #include "pxr/pxr.h"
 #include "pxr/base/trace/collection.h"
 #include "pxr/base/trace/collectionNotice.h"
+#include "pxr/base/trace/perfEvents.h"
 #include "pxr/base/trace/reporter.h"
+#include "pxr/base/trace/serialization.h"
 #include "pxr/base/trace/trace.h"
 
 #include "pxr/base/arch/stackTrace.h"
@@ -43,8 +45,11 @@
 #include "pxr/base/tf/staticData.h"
 #include "pxr/base/tf/stringUtils.h"
 
+#include <chrono>
+#include <fstream>
 #include <functional>
 #include <iostream>
+#include <thread>
 #include <utility>
 
 using std::string;
@@ -56,6 +61,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 TF_INSTANTIATE_SINGLETON(TraceCollector);
 
 std::atomic<int> TraceCollector::_isEnabled(0);
+std::atomic<int> TraceCollector::_perfCountersEnabled(0);
 
 TraceCollector::_PerThreadData* TraceCollector::_GetThreadData()
 {
@@ -97,11 +103,25 @@ TraceCollector::TraceCollector()
             SetPythonTracingEnabled(true);
 #endif // PXR_PYTHON_SUPPORT_ENABLED
     }
+
+    // Always-on streaming mode: enable tracing and continuously flush the
+    // recorded events to chunk files based at the given path.
+    const std::string streamPath = TfGetenv("PXR_TRACE_STREAM");
+    if (!streamPath.empty()) {
+        BeginStreaming(
+            streamPath,
+            TfGetenvDouble("PXR_TRACE_STREAM_INTERVAL", 1.0));
+    }
+
+    if (TfGetenvBool("PXR_TRACE_PERF_COUNTERS", false)) {
+        SetPerfCounterSamplingEnabled(true);
+    }
 }
 
 
 TraceCollector::~TraceCollector()
 {
+    EndStreaming();
     SetEnabled(false);
 }
 
@@ -111,6 +131,55 @@ TraceCollector::SetEnabled(bool isEnabled)
     _isEnabled.store((int)isEnabled, std::memory_order_release);
 }
 
+void
+TraceCollector::SetPerfCounterSamplingEnabled(bool enabled)
+{
+    if (enabled && !ArePerfCountersSupported()) {
+        TF_WARN("Hardware performance counters are not available on this "
+                "system; counter sampling remains disabled.");
+        return;
+    }
+    _perfCountersEnabled.store((int)enabled, std::memory_order_release);
+}
+
+bool
+TraceCollector::ArePerfCountersSupported()
+{
+    return Trace_PerfEvents::IsSupported();
+}
+
+static constexpr TraceStaticKeyData _perfCyclesKey("PMU cycles");
+static constexpr TraceStaticKeyData _perfInstructionsKey("PMU instructions");
+static constexpr TraceStaticKeyData _perfCacheMissesKey("PMU cache misses");
+
+void
+TraceCollector::_SamplePerfCounters()
+{
+    // The counters are attached to the thread that opened them, so each
+    // thread gets its own reader; the file descriptors are released when
+    // the thread exits.
+    static thread_local Trace_PerfEvents perfEvents;
+
+    Trace_PerfEvents::Sample sample;
+    if (!perfEvents.Read(&sample)) {
+        return;
+    }
+
+    // Record the deltas since this thread's previous sample through the
+    // regular counter machinery so that they show up in TraceReporter
+    // counter output and the Chrome trace export.
+    _PerThreadData *threadData = _GetThreadData();
+    threadData->EmplaceEvent(
+        TraceEvent::CounterDelta, TraceKey(_perfCyclesKey),
+        static_cast<double>(sample.cycles), TraceCategory::Default);
+    threadData->EmplaceEvent(
+        TraceEvent::CounterDelta, TraceKey(_perfInstructionsKey),
+        static_cast<double>(sample.instructions), TraceCategory::Default);
+    threadData->EmplaceEvent(
+        TraceEvent::CounterDelta, TraceKey(_perfCacheMissesKey),
+        static_cast<double>(sample.cacheMisses), TraceCategory::Default);
+}
+
 TraceCollector::TimeStamp
 TraceCollector::_BeginEvent(const Key& key, TraceCategoryId cat)
 {
@@ -119,6 +188,7 @@ TraceCollector::_BeginEvent(const Key& key, TraceCategoryId cat)
         return 0;
     }
 
+    SamplePerfCounters();
     _PerThreadData *threadData = _GetThreadData();
     return threadData->BeginEvent(key, cat);
 }
@@ -131,6 +201,7 @@ TraceCollector::_EndEvent(const Key& key, TraceCategoryId cat)
         return 0;
     }
 
+    SamplePerfCounters();
     _PerThreadData *threadData = _GetThreadData();
     return threadData->EndEvent(key, cat);
 }
@@ -197,12 +268,121 @@ TraceCollector::Clear()
 void
 TraceCollector::_EndScope(const TraceKey& key, TraceCategoryId cat)
 {
+    SamplePerfCounters();
     // Note we're not calling _NewEvent, be fast and don't
     // need to cache key
     _PerThreadData *threadData = _GetThreadData();
     threadData->EndScope(key, cat);
 }
 
+
+// State for streaming mode.  The flush thread periodically drains the
+// per-thread event buffers to chunk files so that memory use stays bounded
+// no matter how long tracing remains enabled.
+struct TraceCollector::_Streamer
+{
+    std::string filePath;
+    double flushInterval;
+    size_t chunkCount = 0;
+    std::atomic<bool> running { true };
+    std::thread thread;
+};
+
+bool
+TraceCollector::BeginStreaming(
+    const std::string& filePath, double flushIntervalInSeconds)
+{
+    if (_streamer) {
+        TF_CODING_ERROR("Streaming is already active (to '%s')",
+                        _streamer->filePath.c_str());
+        return false;
+    }
+
+    // Verify that we will be able to write chunk files before committing.
+    {
+        std::ofstream probe((filePath + ".0").c_str());
+        if (!probe.is_open()) {
+            TF_RUNTIME_ERROR("Cannot create trace chunk file '%s.0'",
+                             filePath.c_str());
+            return false;
+        }
+    }
+
+    _streamer.reset(new _Streamer);
+    _streamer->filePath = filePath;
+    _streamer->flushInterval = flushIntervalInSeconds > 0.0
+        ? flushIntervalInSeconds : 1.0;
+
+    SetEnabled(true);
+
+    _Streamer* streamer = _streamer.get();
+    _streamer->thread = std::thread([this, streamer]() {
+        // Sleep in small increments so that EndStreaming() is prompt.
+        const std::chrono::milliseconds tick(10);
+        const std::chrono::duration<double> interval(
+            streamer->flushInterval);
+        std::chrono::duration<double> slept(0);
+        while (streamer->running.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(tick);
+            slept += tick;
+            if (slept >= interval) {
+                _FlushStreaming();
+                slept = std::chrono::duration<double>(0);
+            }
+        }
+    });
+
+    return true;
+}
+
+void
+TraceCollector::EndStreaming()
+{
+    if (!_streamer) {
+        return;
+    }
+    _streamer->running.store(false, std::memory_order_release);
+    _streamer->thread.join();
+
+    // Write out whatever remains.
+    _FlushStreaming();
+    _streamer.reset();
+}
+
+bool
+TraceCollector::IsStreaming() const
+{
+    return static_cast<bool>(_streamer);
+}
+
+void
+TraceCollector::_FlushStreaming()
+{
+    // Drain the per-thread buffers, as CreateCollection() does, but write
+    // the result to a chunk file instead of sending a notice.
+    std::shared_ptr<TraceCollection> collection(new TraceCollection());
+    bool empty = true;
+    for (_PerThreadData& i : _allPerThreadData) {
+        TraceCollection::EventListPtr collData = i.GetCollectionData();
+        if (!collData->IsEmpty()) {
+            collection->AddToCollection(i.GetThreadId(), std::move(collData));
+            empty = false;
+        }
+    }
+    if (empty) {
+        return;
+    }
+
+    const std::string chunkPath = TfStringPrintf(
+        "%s.%zu", _streamer->filePath.c_str(), _streamer->chunkCount);
+    std::ofstream out(chunkPath.c_str());
+    if (!out.is_open() || !TraceSerialization::Write(out, collection)) {
+        TF_WARN("Failed to write trace chunk file '%s'", chunkPath.c_str());
+        return;
+    }
+    ++_streamer->chunkCount;
+}
+
 void
 TraceCollector::CreateCollection() {
     std::unique_ptr<TraceCollection> collection(new TraceCollection());
@@ -48,6 +48,7 @@
 #include "pxr/base/tf/weakPtr.h"
 
 #include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -114,10 +115,52 @@ public:
     TRACE_API void SetPythonTracingEnabled(bool enabled);
 #endif // PXR_PYTHON_SUPPORT_ENABLED
     
-    /// Clear all pending events from the collector. No TraceCollection will be 
+    /// Clear all pending events from the collector. No TraceCollection will be
     /// made for these events.
     TRACE_API void Clear();
 
+    /// \name Hardware performance counters
+    ///
+    /// When sampling is enabled, the values of a small set of hardware
+    /// performance counters (cycles, retired instructions and last-level
+    /// cache misses) are read on the recording thread at scope boundaries
+    /// and recorded as counter deltas named "PMU cycles",
+    /// "PMU instructions" and "PMU cache misses".  The deltas flow through
+    /// the normal counter pipeline, so they appear in TraceReporter counter
+    /// output and in the Chrome trace export alongside timing data.
+    ///
+    /// Sampling is only available on Linux via perf_event, and only when
+    /// the system permits unprivileged counter access; elsewhere enabling
+    /// it has no effect.  It can also be enabled at startup by setting
+    /// PXR_TRACE_PERF_COUNTERS in the environment.
+    /// @{
+
+    /// Enables or disables sampling of hardware performance counters at
+    /// scope boundaries.  Raises a warning and leaves sampling disabled if
+    /// the counters cannot be read on this system.
+    TRACE_API void SetPerfCounterSamplingEnabled(bool enabled);
+
+    /// Returns whether hardware performance counter sampling is enabled.
+    static bool IsPerfCounterSamplingEnabled() {
+        return (_perfCountersEnabled.load(std::memory_order_acquire) == 1);
+    }
+
+    /// Returns true if hardware performance counters can be read on this
+    /// system.
+    TRACE_API static bool ArePerfCountersSupported();
+
+    /// Records the current hardware counter deltas as counter events on the
+    /// calling thread if sampling is enabled.  This is called automatically
+    /// at scope boundaries; clients may call it directly to add additional
+    /// sampling points.
+    void SamplePerfCounters() {
+        if (ARCH_UNLIKELY(IsPerfCounterSamplingEnabled())) {
+            _SamplePerfCounters();
+        }
+    }
+
+    /// @}
+
     /// \name Event Recording
     /// @{
 
@@ -275,6 +318,7 @@ public:
         if (ARCH_LIKELY(!Category::IsEnabled()))
             return;
 
+        SamplePerfCounters();
         _PerThreadData *threadData = _GetThreadData();
         threadData->EmplaceEvent(
             TraceEvent::Timespan, key,  start, Category::GetId());
@@ -393,12 +437,46 @@ public:
     /// collection will not be present in subsequent collections.
     TRACE_API void CreateCollection();
 
+    /// \name Streaming
+    ///
+    /// Streaming mode enables the collector and periodically drains the
+    /// recorded events to disk, so that tracing can be left on indefinitely
+    /// with bounded memory use.  Each flush is written as a separate chunk
+    /// file named \<filePath\>.\<N\>, individually readable with
+    /// TraceSerialization::Read.  Flushed events are not delivered via
+    /// TraceCollectionAvailable notices and will not appear in subsequent
+    /// collections.
+    /// @{
+
+    /// Begin streaming recorded events to chunk files based at \p filePath,
+    /// flushing approximately every \p flushIntervalInSeconds.  Enables the
+    /// collector.  Returns false and raises an error if streaming is
+    /// already active or the first chunk file cannot be created.
+    TRACE_API bool BeginStreaming(const std::string& filePath,
+                                  double flushIntervalInSeconds = 1.0);
+
+    /// Stop streaming, writing out any remaining events.  Does not disable
+    /// the collector.
+    TRACE_API void EndStreaming();
+
+    /// Returns true if streaming mode is active.
+    TRACE_API bool IsStreaming() const;
+
+    /// @}
+
 private:
 
     TraceCollector();
 
     friend class TfSingleton<TraceCollector>;
 
+    // State for streaming mode; allocated only while streaming is active.
+    struct _Streamer;
+    std::unique_ptr<_Streamer> _streamer;
+
+    // Drain the per-thread event buffers and write them as a chunk file.
+    void _FlushStreaming();
+
     class _PerThreadData;
 
     // Return a pointer to existing per-thread data or create one if none
@@ -424,15 +502,20 @@ private:
     // and TRACE_SCOPE macros
     void _BeginScope(const TraceKey& key, TraceCategoryId cat)
     {
+        SamplePerfCounters();
         // Note we're not calling _NewEvent, don't need to cache key
         _PerThreadData *threadData = _GetThreadData();
         threadData->BeginScope(key, cat);
     }
 
     // This is the fast execution path called from the TRACE_FUNCTION
-    // and TRACE_SCOPE macros    
+    // and TRACE_SCOPE macros
     TRACE_API void _EndScope(const TraceKey& key, TraceCategoryId cat);
 
+    // Reads the hardware performance counters and records the deltas since
+    // the calling thread's previous sample as counter events.
+    TRACE_API void _SamplePerfCounters();
+
 #ifdef PXR_PYTHON_SUPPORT_ENABLED
     // Callback function registered as a python tracing function.
     void _PyTracingCallback(const TfPyTraceInfo &info);
@@ -601,6 +684,7 @@ private:
     };
 
     TRACE_API static std::atomic<int> _isEnabled;
+    TRACE_API static std::atomic<int> _perfCountersEnabled;
 
     // A list with one _PerThreadData per thread.
     TraceConcurrentList<_PerThreadData> _allPerThreadData;
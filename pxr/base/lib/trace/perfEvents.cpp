@@ -0,0 +1,176 @@
+//
+// Copyright 2018 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/base/trace/perfEvents.h"
+
+#include "pxr/pxr.h"
+#include "pxr/base/arch/defines.h"
+
+#if defined(ARCH_OS_LINUX)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+#if defined(ARCH_OS_LINUX)
+
+namespace {
+
+// Hardware event ids for the counter group, in the order of
+// Trace_PerfEvents::Sample and Trace_PerfEvents::_fds.  The group leader
+// (cycles) comes first.
+const uint64_t _eventConfigs[3] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES
+};
+
+int
+_PerfEventOpen(uint64_t config, int groupFd)
+{
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    // Count user space only; counting the kernel requires elevated
+    // privileges on most production configurations.
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    // Attach to the calling thread on any cpu.
+    return syscall(__NR_perf_event_open, &attr, /*pid=*/0, /*cpu=*/-1,
+                   groupFd, /*flags=*/0);
+}
+
+} // anonymous namespace
+
+Trace_PerfEvents::Trace_PerfEvents()
+{
+    _fds[0] = _fds[1] = _fds[2] = -1;
+    _previous[0] = _previous[1] = _previous[2] = 0;
+
+    // Open the counters as a single group led by the cycle counter so that
+    // all three can be read atomically with one read() call.  If any
+    // counter cannot be opened (unsupported hardware, restricted
+    // perf_event_paranoid), leave the reader inert.
+    _fds[0] = _PerfEventOpen(_eventConfigs[0], -1);
+    if (_fds[0] == -1) {
+        return;
+    }
+    for (int i = 1; i != 3; ++i) {
+        _fds[i] = _PerfEventOpen(_eventConfigs[i], _fds[0]);
+        if (_fds[i] == -1) {
+            for (int j = 0; j != i; ++j) {
+                close(_fds[j]);
+                _fds[j] = -1;
+            }
+            return;
+        }
+    }
+
+    ioctl(_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+Trace_PerfEvents::~Trace_PerfEvents()
+{
+    for (int i = 0; i != 3; ++i) {
+        if (_fds[i] != -1) {
+            close(_fds[i]);
+        }
+    }
+}
+
+bool
+Trace_PerfEvents::Read(Sample* sample)
+{
+    if (_fds[0] == -1) {
+        return false;
+    }
+
+    // Group read format: { u64 nr; u64 values[nr]; }.
+    struct {
+        uint64_t nr;
+        uint64_t values[3];
+    } data;
+    if (read(_fds[0], &data, sizeof(data)) != sizeof(data) || data.nr != 3) {
+        return false;
+    }
+
+    sample->cycles = data.values[0] - _previous[0];
+    sample->instructions = data.values[1] - _previous[1];
+    sample->cacheMisses = data.values[2] - _previous[2];
+    for (int i = 0; i != 3; ++i) {
+        _previous[i] = data.values[i];
+    }
+    return true;
+}
+
+bool
+Trace_PerfEvents::IsSupported()
+{
+    static const bool supported = []() {
+        const int fd = _PerfEventOpen(PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (fd == -1) {
+            return false;
+        }
+        close(fd);
+        return true;
+    }();
+    return supported;
+}
+
+#else // !defined(ARCH_OS_LINUX)
+
+Trace_PerfEvents::Trace_PerfEvents()
+{
+    _fds[0] = _fds[1] = _fds[2] = -1;
+    _previous[0] = _previous[1] = _previous[2] = 0;
+}
+
+Trace_PerfEvents::~Trace_PerfEvents()
+{
+}
+
+bool
+Trace_PerfEvents::Read(Sample*)
+{
+    return false;
+}
+
+bool
+Trace_PerfEvents::IsSupported()
+{
+    return false;
+}
+
+#endif // defined(ARCH_OS_LINUX)
+
+PXR_NAMESPACE_CLOSE_SCOPE
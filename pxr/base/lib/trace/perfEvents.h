@@ -0,0 +1,81 @@
+//
+// Copyright 2018 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#ifndef TRACE_PERF_EVENTS_H
+#define TRACE_PERF_EVENTS_H
+
+#include "pxr/pxr.h"
+
+#include <cstdint>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class Trace_PerfEvents
+///
+/// Reads hardware performance counters (cycles, retired instructions and
+/// last-level cache misses) for the calling thread.  On Linux the counters
+/// are backed by the kernel perf_event interface; on other platforms, or
+/// when access to the performance monitoring unit is restricted (e.g. by
+/// perf_event_paranoid), the reader is inert and Read always fails.
+///
+/// An instance may only be used from the thread on which it was constructed,
+/// because the underlying counters are attached to that thread.
+///
+class Trace_PerfEvents {
+public:
+    /// Counter deltas returned by Read.
+    struct Sample {
+        uint64_t cycles = 0;
+        uint64_t instructions = 0;
+        uint64_t cacheMisses = 0;
+    };
+
+    Trace_PerfEvents();
+    ~Trace_PerfEvents();
+
+    Trace_PerfEvents(const Trace_PerfEvents&) = delete;
+    Trace_PerfEvents& operator=(const Trace_PerfEvents&) = delete;
+
+    /// Returns true if hardware counters can be read on this system.  The
+    /// check is performed once and cached.
+    static bool IsSupported();
+
+    /// Reads the counters and stores the deltas since the previous
+    /// successful call on this instance into \p sample.  The first
+    /// successful call returns the deltas since construction.  Returns
+    /// false, leaving \p sample untouched, if the counters could not be
+    /// opened or read.
+    bool Read(Sample* sample);
+
+private:
+    // File descriptors for the counter group; the leader (cycles) is
+    // _fds[0].  All are -1 if the counters could not be opened.
+    int _fds[3];
+    uint64_t _previous[3];
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // TRACE_PERF_EVENTS_H
@@ -0,0 +1,351 @@
+//
+// Copyright 2018 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/base/trace/reporterDataSourceSpool.h"
+
+#include "pxr/pxr.h"
+#include "pxr/base/trace/eventData.h"
+#include "pxr/base/trace/serialization.h"
+
+#include "pxr/base/arch/timing.h"
+#include "pxr/base/tf/atomicOfstreamWrapper.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/stringUtils.h"
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+static const char* _spoolFileExtension = ".trace";
+
+namespace {
+
+// TraceCollection visitor which rebuilds a collection with its thread ids
+// prefixed by a stream label and its event timestamps shifted by a
+// clock-domain offset.  Event reconstruction mirrors what the serialization
+// code does when reading a collection.
+class _IngestVisitor : public TraceCollection::Visitor {
+public:
+    _IngestVisitor(const std::string& label, int64_t offsetTicks)
+        : _label(label)
+        , _offsetTicks(offsetTicks)
+        , _collection(new TraceCollection())
+    {}
+
+    TraceReporterDataSourceBase::CollectionPtr GetCollection() {
+        return std::move(_collection);
+    }
+
+    virtual void OnBeginCollection() override {}
+    virtual void OnEndCollection() override {}
+
+    virtual bool AcceptsCategory(TraceCategoryId categoryId) override {
+        return true;
+    }
+
+    virtual void OnBeginThread(const TraceThreadId& threadId) override {
+        _events.reset(new TraceEventList());
+    }
+
+    virtual void OnEndThread(const TraceThreadId& threadId) override {
+        _collection->AddToCollection(
+            _label.empty() ? threadId :
+            TraceThreadId(_label + " " + threadId.ToString()),
+            std::move(_events));
+    }
+
+    virtual void OnEvent(
+        const TraceThreadId& threadId,
+        const TfToken& key,
+        const TraceEvent& event) override {
+        const TraceCategoryId category = event.GetCategory();
+        switch (event.GetType()) {
+            case TraceEvent::EventType::Begin:
+                _events->EmplaceBack(
+                    TraceEvent::Begin,
+                    _events->CacheKey(key),
+                    _Shift(event.GetTimeStamp()),
+                    category);
+                break;
+            case TraceEvent::EventType::End:
+                _events->EmplaceBack(
+                    TraceEvent::End,
+                    _events->CacheKey(key),
+                    _Shift(event.GetTimeStamp()),
+                    category);
+                break;
+            case TraceEvent::EventType::Marker:
+                _events->EmplaceBack(
+                    TraceEvent::Marker,
+                    _events->CacheKey(key),
+                    _Shift(event.GetTimeStamp()),
+                    category);
+                break;
+            case TraceEvent::EventType::Timespan:
+                _events->EmplaceBack(
+                    TraceEvent::Timespan,
+                    _events->CacheKey(key),
+                    _Shift(event.GetStartTimeStamp()),
+                    _Shift(event.GetEndTimeStamp()),
+                    category);
+                break;
+            case TraceEvent::EventType::CounterDelta:
+                {
+                    TraceEvent counterEvent(
+                        TraceEvent::CounterDelta,
+                        _events->CacheKey(key),
+                        event.GetCounterValue(),
+                        category);
+                    counterEvent.SetTimeStamp(_Shift(event.GetTimeStamp()));
+                    _events->EmplaceBack(std::move(counterEvent));
+                }
+                break;
+            case TraceEvent::EventType::CounterValue:
+                {
+                    TraceEvent counterEvent(
+                        TraceEvent::CounterValue,
+                        _events->CacheKey(key),
+                        event.GetCounterValue(),
+                        category);
+                    counterEvent.SetTimeStamp(_Shift(event.GetTimeStamp()));
+                    _events->EmplaceBack(std::move(counterEvent));
+                }
+                break;
+            case TraceEvent::EventType::ScopeData:
+                _OnDataEvent(key, event);
+                break;
+            case TraceEvent::EventType::Unknown:
+                break;
+        }
+    }
+
+private:
+    TraceEvent::TimeStamp _Shift(TraceEvent::TimeStamp ts) const {
+        return static_cast<TraceEvent::TimeStamp>(
+            static_cast<int64_t>(ts) + _offsetTicks);
+    }
+
+    void _OnDataEvent(const TfToken& key, const TraceEvent& event) {
+        const TraceEventData data = event.GetData();
+        const TraceCategoryId category = event.GetCategory();
+        switch (data.GetType()) {
+            case TraceEvent::DataType::Boolean:
+                {
+                    TraceEvent dataEvent(
+                        TraceEvent::Data,
+                        _events->CacheKey(key),
+                        *data.GetBool(),
+                        category);
+                    dataEvent.SetTimeStamp(_Shift(event.GetTimeStamp()));
+                    _events->EmplaceBack(std::move(dataEvent));
+                }
+                break;
+            case TraceEvent::DataType::Int:
+                {
+                    TraceEvent dataEvent(
+                        TraceEvent::Data,
+                        _events->CacheKey(key),
+                        *data.GetInt(),
+                        category);
+                    dataEvent.SetTimeStamp(_Shift(event.GetTimeStamp()));
+                    _events->EmplaceBack(std::move(dataEvent));
+                }
+                break;
+            case TraceEvent::DataType::UInt:
+                {
+                    TraceEvent dataEvent(
+                        TraceEvent::Data,
+                        _events->CacheKey(key),
+                        *data.GetUInt(),
+                        category);
+                    dataEvent.SetTimeStamp(_Shift(event.GetTimeStamp()));
+                    _events->EmplaceBack(std::move(dataEvent));
+                }
+                break;
+            case TraceEvent::DataType::Float:
+                {
+                    TraceEvent dataEvent(
+                        TraceEvent::Data,
+                        _events->CacheKey(key),
+                        *data.GetFloat(),
+                        category);
+                    dataEvent.SetTimeStamp(_Shift(event.GetTimeStamp()));
+                    _events->EmplaceBack(std::move(dataEvent));
+                }
+                break;
+            case TraceEvent::DataType::String:
+                {
+                    TraceEvent dataEvent(
+                        TraceEvent::Data,
+                        _events->CacheKey(key),
+                        _events->StoreData(data.GetString()->c_str()),
+                        category);
+                    dataEvent.SetTimeStamp(_Shift(event.GetTimeStamp()));
+                    _events->EmplaceBack(std::move(dataEvent));
+                }
+                break;
+            case TraceEvent::DataType::Invalid:
+                break;
+        }
+    }
+
+    std::string _label;
+    int64_t _offsetTicks;
+    TraceReporterDataSourceBase::CollectionPtr _collection;
+    TraceCollection::EventListPtr _events;
+};
+
+// Returns the stream label encoded in the spool file name, i.e. the base
+// name with the extension and the trailing "_<ticks>_<sequence>" fields
+// that make the name unique stripped off.
+static std::string
+_GetStreamLabel(const std::string& filePath)
+{
+    std::string stem = TfGetBaseName(filePath);
+    stem = stem.substr(0, stem.size() - strlen(_spoolFileExtension));
+    for (int i = 0; i != 2; ++i) {
+        const std::string::size_type sep = stem.rfind('_');
+        if (sep == std::string::npos) {
+            return std::string();
+        }
+        stem = stem.substr(0, sep);
+    }
+    return stem;
+}
+
+} // anonymous namespace
+
+TraceReporterDataSourceSpool::TraceReporterDataSourceSpool(
+    const std::string& spoolDirectory)
+    : _spoolDirectory(spoolDirectory)
+{}
+
+/* static */
+bool
+TraceReporterDataSourceSpool::PublishCollection(
+    const std::string& spoolDirectory,
+    const std::string& label,
+    const CollectionPtr& collection)
+{
+    if (!collection) {
+        TF_CODING_ERROR("Invalid collection");
+        return false;
+    }
+
+    // Publish-time ticks plus a per-process sequence number make the file
+    // name unique across the publishing processes sharing the directory.
+    static std::atomic<size_t> seqNum(0);
+    const std::string fileName = TfStringPrintf(
+        "%s/%s_%zu_%zu%s",
+        spoolDirectory.c_str(),
+        TfStringReplace(label, "/", "_").c_str(),
+        static_cast<size_t>(ArchGetTickTime()),
+        seqNum.fetch_add(1),
+        _spoolFileExtension);
+
+    // Write through a temporary file which is renamed into place on Commit(),
+    // so readers of the spool directory never see a partial collection.
+    TfAtomicOfstreamWrapper wrapper(fileName);
+    std::string reason;
+    if (!wrapper.Open(&reason)) {
+        TF_RUNTIME_ERROR("Unable to publish trace collection: %s",
+                         reason.c_str());
+        return false;
+    }
+    if (!TraceSerialization::Write(wrapper.GetStream(), collection)) {
+        TF_RUNTIME_ERROR("Failed to serialize trace collection to '%s'",
+                         fileName.c_str());
+        return false;
+    }
+    if (!wrapper.Commit(&reason)) {
+        TF_RUNTIME_ERROR("%s", reason.c_str());
+        return false;
+    }
+    return true;
+}
+
+void
+TraceReporterDataSourceSpool::SetTickOffset(
+    const std::string& label, int64_t ticks)
+{
+    _tickOffsets[label] = ticks;
+}
+
+void
+TraceReporterDataSourceSpool::Clear()
+{
+    _consumedFiles.clear();
+}
+
+std::vector<TraceReporterDataSourceBase::CollectionPtr>
+TraceReporterDataSourceSpool::ConsumeData()
+{
+    std::vector<CollectionPtr> result;
+    for (const std::string& filePath : TfListDir(_spoolDirectory)) {
+        if (!TfStringEndsWith(filePath, _spoolFileExtension)) {
+            continue;
+        }
+        if (!_consumedFiles.insert(filePath).second) {
+            continue;
+        }
+        std::ifstream stream(filePath.c_str());
+        if (!stream) {
+            TF_WARN("Unable to open trace spool file '%s'", filePath.c_str());
+            continue;
+        }
+        std::string error;
+        std::shared_ptr<TraceCollection> collection =
+            TraceSerialization::Read(stream, &error);
+        if (!collection) {
+            TF_WARN("Failed to read trace spool file '%s': %s",
+                    filePath.c_str(), error.c_str());
+            continue;
+        }
+        const std::string label = _GetStreamLabel(filePath);
+        const std::map<std::string, int64_t>::const_iterator offsetIt =
+            _tickOffsets.find(label);
+        result.push_back(
+            _IngestCollection(
+                *collection, label,
+                offsetIt != _tickOffsets.end() ? offsetIt->second : 0));
+    }
+    return result;
+}
+
+TraceReporterDataSourceBase::CollectionPtr
+TraceReporterDataSourceSpool::_IngestCollection(
+    const TraceCollection& collection,
+    const std::string& label,
+    int64_t offsetTicks) const
+{
+    _IngestVisitor visitor(label, offsetTicks);
+    collection.Iterate(visitor);
+    return visitor.GetCollection();
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
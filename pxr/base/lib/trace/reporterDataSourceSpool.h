@@ -0,0 +1,116 @@
+//
+// Copyright 2018 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#ifndef TRACE_REPORTER_DATA_SOURCE_SPOOL_H
+#define TRACE_REPORTER_DATA_SOURCE_SPOOL_H
+
+#include "pxr/pxr.h"
+
+#include "pxr/base/trace/api.h"
+#include "pxr/base/trace/collection.h"
+#include "pxr/base/trace/event.h"
+#include "pxr/base/trace/reporterDataSourceBase.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class TraceReporterDataSourceSpool
+///
+/// This class is an implementation of TraceReporterDataSourceBase which merges
+/// TraceCollections published by other processes into a shared spool
+/// directory.  Publishing processes call PublishCollection() with a stream
+/// label naming the process; each collection is serialized to its own file and
+/// made visible atomically, so a reader never observes a partially written
+/// collection.  Each call to ConsumeData() picks up the spool files that have
+/// appeared since the last call, so a reporter using this data source can
+/// combine the event streams of every publishing process into a single report,
+/// such as one Chrome trace covering a whole multi-process frame.
+///
+/// Thread identifiers in ingested collections are prefixed with the
+/// publisher's stream label so that, for example, the main threads of
+/// different processes appear as distinct rows in the merged timeline.
+///
+/// Event timestamps are in arch tick time, which on a given host is a single
+/// clock domain shared by all processes; collections published on the host
+/// that reads them need no adjustment.  For spool files produced in a
+/// different clock domain (e.g. copied from another machine), a per-stream
+/// tick offset may be registered with SetTickOffset() and is applied to every
+/// event timestamp ingested from that stream.
+///
+class TraceReporterDataSourceSpool : public TraceReporterDataSourceBase {
+public:
+    using This = TraceReporterDataSourceSpool;
+    using ThisRefPtr = std::unique_ptr<This>;
+
+    /// Creates a new TraceReporterDataSourceSpool which ingests collections
+    /// from \p spoolDirectory.
+    static ThisRefPtr New(const std::string& spoolDirectory) {
+        return ThisRefPtr(new This(spoolDirectory));
+    }
+
+    /// Serializes \p collection to a new uniquely-named file in
+    /// \p spoolDirectory and makes it visible atomically.  \p label names the
+    /// publishing event stream and becomes the thread identifier prefix on
+    /// ingest.  Returns true if the collection was published successfully.
+    TRACE_API static bool PublishCollection(
+        const std::string& spoolDirectory,
+        const std::string& label,
+        const CollectionPtr& collection);
+
+    /// Registers \p ticks as the clock-domain offset for the stream published
+    /// under \p label.  The offset is added to every event timestamp ingested
+    /// from that stream by subsequent ConsumeData() calls.
+    TRACE_API void SetTickOffset(const std::string& label, int64_t ticks);
+
+    /// Forgets which spool files have been consumed, so that the next call to
+    /// ConsumeData() re-ingests the entire spool directory.
+    TRACE_API void Clear() override;
+
+    /// Returns the collections from spool files which have appeared in the
+    /// spool directory since the last call to ConsumeData().
+    TRACE_API std::vector<CollectionPtr> ConsumeData() override;
+
+private:
+    TRACE_API TraceReporterDataSourceSpool(const std::string& spoolDirectory);
+
+    // Returns a copy of collection with its thread ids prefixed by label and
+    // its event timestamps shifted by offsetTicks.
+    CollectionPtr _IngestCollection(
+        const TraceCollection& collection,
+        const std::string& label,
+        int64_t offsetTicks) const;
+
+    std::string _spoolDirectory;
+    std::map<std::string, int64_t> _tickOffsets;
+    std::set<std::string> _consumedFiles;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // TRACE_REPORTER_DATA_SOURCE_SPOOL_H
@@ -0,0 +1,90 @@
+//
+// Copyright 2018 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/base/trace/trace.h"
+#include "pxr/base/trace/reporter.h"
+
+#include <cstdio>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static volatile int sink = 0;
+
+static void
+DoWork()
+{
+    TRACE_FUNCTION();
+    for (int i = 0; i < 100000; ++i) {
+        sink += i;
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    TraceCollector* collector = &TraceCollector::GetInstance();
+
+    // Sampling must be off by default.
+    TF_AXIOM(!TraceCollector::IsPerfCounterSamplingEnabled());
+
+    if (!TraceCollector::ArePerfCountersSupported()) {
+        // Counter access may be restricted (e.g. perf_event_paranoid); all
+        // we can verify is that enabling is a graceful no-op.
+        printf("Hardware performance counters unavailable; skipping.\n");
+        collector->SetPerfCounterSamplingEnabled(true);
+        TF_AXIOM(!TraceCollector::IsPerfCounterSamplingEnabled());
+        return 0;
+    }
+
+    collector->SetPerfCounterSamplingEnabled(true);
+    TF_AXIOM(TraceCollector::IsPerfCounterSamplingEnabled());
+
+    collector->SetEnabled(true);
+    for (int i = 0; i < 10; ++i) {
+        DoWork();
+    }
+    collector->SetEnabled(false);
+
+    collector->SetPerfCounterSamplingEnabled(false);
+    TF_AXIOM(!TraceCollector::IsPerfCounterSamplingEnabled());
+
+    // The sampled counters must show up through the regular counter
+    // pipeline with non-zero totals; the traced loop certainly retired
+    // instructions and consumed cycles.
+    TraceReporterPtr reporter = TraceReporter::GetGlobalReporter();
+    reporter->UpdateAggregateTree();
+    const TraceReporter::CounterMap& counters = reporter->GetCounters();
+
+    for (const char* name :
+            {"PMU cycles", "PMU instructions", "PMU cache misses"}) {
+        TraceReporter::CounterMap::const_iterator it =
+            counters.find(TfToken(name));
+        TF_AXIOM(it != counters.end());
+        printf("%s: %f\n", name, it->second);
+    }
+    TF_AXIOM(counters.find(TfToken("PMU cycles"))->second > 0.0);
+    TF_AXIOM(counters.find(TfToken("PMU instructions"))->second > 0.0);
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+//
+// Copyright 2018 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/base/trace/trace.h"
+#include "pxr/base/trace/reporterDataSourceSpool.h"
+
+#include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/stringUtils.h"
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static std::unique_ptr<TraceEventList>
+CreateTestEvents(TraceEvent::TimeStamp timeStampOffset)
+{
+    const TraceEvent::TimeStamp ms = ArchSecondsToTicks(0.001);
+    std::unique_ptr<TraceEventList> events(new TraceEventList);
+
+    events->EmplaceBack(
+        TraceEvent::Begin,
+        events->CacheKey("Test Scope"),
+        ms + timeStampOffset,
+        TraceCategory::Default
+    );
+    events->EmplaceBack(
+        TraceEvent::End,
+        events->CacheKey("Test Scope"),
+        2*ms + timeStampOffset,
+        TraceCategory::Default
+    );
+    events->EmplaceBack(
+        TraceEvent::Marker,
+        events->CacheKey("Test Marker"),
+        3*ms + timeStampOffset,
+        TraceCategory::Default
+    );
+    return events;
+}
+
+static std::shared_ptr<TraceCollection>
+CreateTestCollection(TraceEvent::TimeStamp timeStampOffset = 0)
+{
+    std::shared_ptr<TraceCollection> collection(new TraceCollection);
+    collection->AddToCollection(
+        TraceThreadId("Main Thread"),
+        CreateTestEvents(timeStampOffset));
+    return collection;
+}
+
+// Visitor which records the thread ids encountered in a collection and the
+// smallest event timestamp per thread.
+class _CollectionSummary : public TraceCollection::Visitor {
+public:
+    virtual void OnBeginCollection() override {}
+    virtual void OnEndCollection() override {}
+    virtual bool AcceptsCategory(TraceCategoryId) override { return true; }
+    virtual void OnBeginThread(const TraceThreadId&) override {}
+    virtual void OnEndThread(const TraceThreadId&) override {}
+    virtual void OnEvent(
+        const TraceThreadId& threadId,
+        const TfToken& key,
+        const TraceEvent& event) override {
+        std::map<std::string, TraceEvent::TimeStamp>::iterator it =
+            minTimeStamps.insert(
+                std::make_pair(threadId.ToString(),
+                               event.GetTimeStamp())).first;
+        it->second = std::min(it->second, event.GetTimeStamp());
+    }
+
+    std::map<std::string, TraceEvent::TimeStamp> minTimeStamps;
+};
+
+int
+main(int argc, char *argv[])
+{
+    const std::string spoolDir = "spool";
+    TF_AXIOM(TfMakeDirs(spoolDir));
+
+    using Spool = TraceReporterDataSourceSpool;
+
+    std::cout << "Testing publish and ingest\n";
+    TF_AXIOM(Spool::PublishCollection(
+                 spoolDir, "procA", CreateTestCollection()));
+    TF_AXIOM(Spool::PublishCollection(
+                 spoolDir, "procB", CreateTestCollection()));
+
+    Spool::ThisRefPtr dataSource = Spool::New(spoolDir);
+    std::vector<Spool::CollectionPtr> collections =
+        dataSource->ConsumeData();
+    TF_AXIOM(collections.size() == 2);
+
+    // Thread ids must be prefixed with the publisher's stream label.
+    _CollectionSummary summary;
+    for (const Spool::CollectionPtr& collection : collections) {
+        collection->Iterate(summary);
+    }
+    TF_AXIOM(summary.minTimeStamps.count("procA Main Thread"));
+    TF_AXIOM(summary.minTimeStamps.count("procB Main Thread"));
+    std::cout << " PASSED\n";
+
+    std::cout << "Testing incremental consumption\n";
+    TF_AXIOM(dataSource->ConsumeData().empty());
+    TF_AXIOM(Spool::PublishCollection(
+                 spoolDir, "procA", CreateTestCollection()));
+    TF_AXIOM(dataSource->ConsumeData().size() == 1);
+    std::cout << " PASSED\n";
+
+    std::cout << "Testing clock-domain alignment\n";
+    const int64_t offset = ArchSecondsToTicks(1.0);
+    Spool::ThisRefPtr shiftedSource = Spool::New(spoolDir);
+    shiftedSource->SetTickOffset("procB", offset);
+    collections = shiftedSource->ConsumeData();
+    TF_AXIOM(collections.size() == 3);
+
+    _CollectionSummary shiftedSummary;
+    for (const Spool::CollectionPtr& collection : collections) {
+        collection->Iterate(shiftedSummary);
+    }
+    TF_AXIOM(shiftedSummary.minTimeStamps["procB Main Thread"] ==
+             summary.minTimeStamps["procB Main Thread"] + offset);
+    TF_AXIOM(shiftedSummary.minTimeStamps["procA Main Thread"] ==
+             summary.minTimeStamps["procA Main Thread"]);
+    std::cout << " PASSED\n";
+
+    std::cout << "Testing Clear\n";
+    TF_AXIOM(shiftedSource->ConsumeData().empty());
+    shiftedSource->Clear();
+    TF_AXIOM(shiftedSource->ConsumeData().size() == 3);
+    std::cout << " PASSED\n";
+}
@@ -214,6 +214,7 @@ public:
         if (ARCH_UNLIKELY(TraceCollector::IsEnabled())) {
             // Init the key if needed.
             _key = &key;
+            TraceCollector::GetInstance().SamplePerfCounters();
             _start = ArchGetTickTime();
         }
         
@@ -83,6 +83,11 @@ IsEnabledHelper(const TraceCollectorPtr& self) {
     return TraceCollector::IsEnabled();
 }
 
+static bool
+IsPerfCounterSamplingEnabledHelper(const TraceCollectorPtr& self) {
+    return TraceCollector::IsPerfCounterSamplingEnabled();
+}
+
 void wrapCollector()
 {
     using This = TraceCollector;
@@ -103,9 +108,14 @@ void wrapCollector()
         .def("Clear", &This::Clear)
 
         .add_property("enabled", IsEnabledHelper, &This::SetEnabled)
+        .add_property("perfCounterSamplingEnabled",
+                      IsPerfCounterSamplingEnabledHelper,
+                      &This::SetPerfCounterSamplingEnabled)
         .add_property("pythonTracingEnabled",
                       &This::IsPythonTracingEnabled,
                       &This::SetPythonTracingEnabled)
+        .def("ArePerfCountersSupported", &This::ArePerfCountersSupported)
+        .staticmethod("ArePerfCountersSupported")
         ;
     
     def("GetElapsedSeconds", GetElapsedSeconds);
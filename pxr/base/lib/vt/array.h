@@ -47,7 +47,9 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdlib>
+#include <functional>
 #include <memory>
+#include <utility>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -71,6 +73,29 @@ protected:
     void (*_detachedFn)(Vt_ArrayForeignDataSource *self);
 };
 
+// Foreign data source that invokes a client-supplied cleanup function and
+// destroys itself when the last array referring to it detaches.  Created on
+// the heap by VtArrayFromForeignData().
+class Vt_DeleterForeignDataSource : public Vt_ArrayForeignDataSource
+{
+public:
+    explicit Vt_DeleterForeignDataSource(std::function<void ()> &&deleter)
+        : Vt_ArrayForeignDataSource(_Detached)
+        , _deleter(std::move(deleter)) {}
+
+private:
+    static void _Detached(Vt_ArrayForeignDataSource *selfBase) {
+        Vt_DeleterForeignDataSource *self =
+            static_cast<Vt_DeleterForeignDataSource *>(selfBase);
+        if (self->_deleter) {
+            self->_deleter();
+        }
+        delete self;
+    }
+
+    std::function<void ()> _deleter;
+};
+
 // Private base class helper for VtArray implementation.
 class Vt_ArrayBase
 {
@@ -102,11 +127,15 @@ protected:
     // immediately preceding the start of the array's _data in memory.  See
     // _GetControlBlock() for details.
     struct _ControlBlock {
-        _ControlBlock() : nativeRefCount(0), capacity(0) {}
+        _ControlBlock() : nativeRefCount(0), capacity(0), cachedHash(0) {}
         _ControlBlock(size_t initCount, size_t initCap)
-            : nativeRefCount(initCount), capacity(initCap) {}
+            : nativeRefCount(initCount), capacity(initCap), cachedHash(0) {}
         mutable std::atomic<size_t> nativeRefCount;
         size_t capacity;
+        // Cached hash of the array contents; 0 means not yet computed.
+        // Reset whenever mutable access to the data is granted; detaching
+        // copies always start with a fresh control block.
+        mutable std::atomic<size_t> cachedHash;
     };
     
     _ControlBlock &_GetControlBlock(void *nativeData) {
@@ -124,6 +153,10 @@ protected:
         return _GetControlBlock(nativeData).nativeRefCount;
     }
 
+    std::atomic<size_t> &_GetCachedHash(void *nativeData) const {
+        return _GetControlBlock(nativeData).cachedHash;
+    }
+
     size_t &_GetCapacity(void *nativeData) {
         return _GetControlBlock(nativeData).capacity;
     }
@@ -137,7 +170,13 @@ protected:
     Vt_ArrayForeignDataSource *_foreignSource;
 };
 
-/// \class VtArray 
+template <typename ELEM> class VtArray;
+
+template <class ELEM>
+typename std::enable_if<VtIsHashable<ELEM>(), size_t>::type
+hash_value(VtArray<ELEM> const &array);
+
+/// \class VtArray
 ///
 /// Represents an arbitrary dimensional rectangular container class.
 ///
@@ -380,7 +419,7 @@ class VtArray : public Vt_ArrayBase {
 
     /// Return a non-const pointer to this array's data.  The underlying data is
     /// copied if it is not uniquely owned.
-    pointer data() { _DetachIfNotUnique(); return _data; }
+    pointer data() { _DetachIfNotUnique(); _InvalidateCachedHash(); return _data; }
     /// Return a const pointer to this array's data.
     const_pointer data() const { return _data; }
     /// Return a const pointer to the data held by this array.
@@ -407,6 +446,7 @@ class VtArray : public Vt_ArrayBase {
         ::new (static_cast<void*>(_data + curSize)) value_type(elem);
         // Adjust size.
         ++_shapeData.totalSize;
+        _InvalidateCachedHash();
     }
 
     /// Remove the last element of an array.  The underlying data is first
@@ -422,6 +462,7 @@ class VtArray : public Vt_ArrayBase {
         (_data + size() - 1)->~value_type();
         // Adjust size.
         --_shapeData.totalSize;
+        _InvalidateCachedHash();
     }
 
     /// Return the total number of elements in this array.
@@ -530,6 +571,7 @@ class VtArray : public Vt_ArrayBase {
         }
         // Adjust size.
         _shapeData.totalSize = newSize;
+        _InvalidateCachedHash();
     }
 
     /// Equivalent to resize(0).
@@ -547,6 +589,7 @@ class VtArray : public Vt_ArrayBase {
             _DecRef();
         }
         _shapeData.totalSize = 0;
+        _InvalidateCachedHash();
     }
 
     /// Assign array contents.
@@ -678,6 +721,63 @@ ARCH_PRAGMA_POP
         _data = newData;
     }
 
+    // Reset the cached content hash.  Called whenever mutable access to the
+    // elements is granted; detaching copies start with a fresh control
+    // block, whose cached hash is already unset.
+    void _InvalidateCachedHash() {
+        if (_data && ARCH_LIKELY(!_foreignSource)) {
+            _GetCachedHash(_data).store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // Hash the array contents, consulting and populating the cached hash in
+    // the control block for natively owned data.  Note that the cache can
+    // only go stale if a caller retains a mutable pointer or iterator
+    // across a hash computation and writes through it afterwards; obtaining
+    // mutable access invalidates the cache.
+    size_t _GetHash() const {
+        const bool canCache = _data && ARCH_LIKELY(!_foreignSource);
+        if (canCache) {
+            const size_t cached =
+                _GetCachedHash(_data).load(std::memory_order_relaxed);
+            if (cached) {
+                return cached;
+            }
+        }
+        size_t h = _ComputeHash(
+            std::integral_constant<
+                bool, VtIsByteHashable<value_type>::value>());
+        // Zero is the 'not yet computed' sentinel.
+        if (h == 0) {
+            h = 1;
+        }
+        if (canCache) {
+            _GetCachedHash(_data).store(h, std::memory_order_relaxed);
+        }
+        return h;
+    }
+
+    // Bulk path for elements whose equality is bytewise: hash the whole
+    // buffer in one pass rather than element-by-element.
+    size_t _ComputeHash(std::true_type) const {
+        size_t h = size();
+        boost::hash_combine(
+            h, Vt_HashByteData(_data, size() * sizeof(value_type)));
+        return h;
+    }
+
+    size_t _ComputeHash(std::false_type) const {
+        size_t h = size();
+        for (value_type const *p = _data, *e = _data + size(); p != e; ++p) {
+            boost::hash_combine(h, *p);
+        }
+        return h;
+    }
+
+    template <class ELEM2>
+    friend typename std::enable_if<VtIsHashable<ELEM2>(), size_t>::type
+    hash_value(VtArray<ELEM2> const &array);
+
     inline bool _IsUnique() const {
         return !_data ||
             (ARCH_LIKELY(!_foreignSource) && _GetNativeRefCount(_data) == 1);
@@ -743,14 +843,50 @@ ARCH_PRAGMA_POP
     value_type *_data;
 };
 
+/// Create an array that refers to the \p size elements at \p data without
+/// copying them.  The returned array and all copies of it share \p data;
+/// when the last of them is destroyed or detached, \p deleter is invoked
+/// (if it is not empty) to release the memory.  The caller must guarantee
+/// that \p data remains valid until then, and must not mutate it while any
+/// array refers to it.
+///
+/// The returned array preserves VtArray's copy-on-write semantics: any
+/// mutating operation first copies the contents into storage owned by the
+/// array, leaving \p data untouched.  Obtaining non-const access to the
+/// elements (e.g. via operator[] or data() on a non-const array) counts as
+/// mutation and will copy.
+///
+/// For example,
+///
+/// \code
+/// float *points = cache->GetPoints();
+/// VtArray<float> array = VtArrayFromForeignData(
+///     points, cache->GetNumPoints(),
+///     [cache]() { cache->ReleasePoints(); });
+/// \endcode
+///
+template <class ELEM>
+VtArray<ELEM>
+VtArrayFromForeignData(ELEM *data, size_t size,
+                       std::function<void ()> deleter = {})
+{
+    if (!data) {
+        if (deleter) {
+            deleter();
+        }
+        return VtArray<ELEM>();
+    }
+    // The source deletes itself (and runs the deleter) when the last array
+    // referring to it detaches.
+    Vt_DeleterForeignDataSource *source =
+        new Vt_DeleterForeignDataSource(std::move(deleter));
+    return VtArray<ELEM>(source, data, size);
+}
+
 template <class ELEM>
 typename std::enable_if<VtIsHashable<ELEM>(), size_t>::type
 hash_value(VtArray<ELEM> const &array) {
-    size_t h = array.size();
-    for (auto const &x: array) {
-        boost::hash_combine(h, x);
-    }
-    return h;
+    return array._GetHash();
 }
 
 // Specialize traits so others can figure out that VtArray is an array.
@@ -55,9 +55,11 @@ TF_MAKE_STATIC_DATA(VtDictionary, _emptyDictionary) {
     *_emptyDictionary = VtDictionary();
 }
 
-VtDictionary::VtDictionary(VtDictionary const& other) {
-    if (other._dictMap)
-        _dictMap.reset(new _Map(*other._dictMap));
+VtDictionary::VtDictionary(VtDictionary const& other)
+    // Share the representation -- we defer the deep copy until one of the
+    // copies is mutated (see _Detach()).
+    : _dictMap(other._dictMap)
+{
 }
 
 VtDictionary::VtDictionary(std::initializer_list<value_type> init)
@@ -67,13 +69,13 @@ VtDictionary::VtDictionary(std::initializer_list<value_type> init)
    
 VtDictionary& VtDictionary::operator=(VtDictionary const& other) {
     if (this != &other)
-        _dictMap.reset(other._dictMap ? new _Map(*other._dictMap) : 0);
+        _dictMap = other._dictMap;
     return *this;
 }
 
 VtValue& VtDictionary::operator[](const string& key) {
     TfAutoMallocTag2 tag("Vt", "VtDictionary::operator[]");
-    _CreateDictIfNeeded();
+    _Detach();
     return (*_dictMap)[key];
 }
 
@@ -82,28 +84,34 @@ VtDictionary::size_type VtDictionary::count(const string& key) const {
 }
     
 VtDictionary::size_type VtDictionary::erase(const string& key) {
-    return _dictMap ? _dictMap->erase(key) : 0;
+    if (!_dictMap || !_dictMap->count(key))
+        return 0;
+    _Detach();
+    return _dictMap->erase(key);
 }
 
 void VtDictionary::erase(iterator it) {
+    _Detach();
     _dictMap->erase(it.GetUnderlyingIterator(_dictMap.get()));
 }
 
 void VtDictionary::erase(iterator f, iterator l) {
     if (!_dictMap)
         return;
+    _Detach();
     _dictMap->erase(f.GetUnderlyingIterator(_dictMap.get()),
         l.GetUnderlyingIterator(_dictMap.get()));
 }
 
 void VtDictionary::clear() {
-    if (_dictMap)
-        _dictMap->clear();
+    _dictMap.reset();
 }
 
 VtDictionary::iterator VtDictionary::find(const string& key) {
-    return _dictMap ? iterator(_dictMap.get(), _dictMap->find(key))
-        : iterator(); 
+    if (!_dictMap)
+        return iterator();
+    _Detach();
+    return iterator(_dictMap.get(), _dictMap->find(key));
 }
 
 VtDictionary::const_iterator VtDictionary::find(const string& key) const {
@@ -112,8 +120,10 @@ VtDictionary::const_iterator VtDictionary::find(const string& key) const {
 }
 
 VtDictionary::iterator VtDictionary::begin() {
-    return _dictMap ? iterator(_dictMap.get(), _dictMap->begin())
-        : iterator(); 
+    if (!_dictMap)
+        return iterator();
+    _Detach();
+    return iterator(_dictMap.get(), _dictMap->begin());
 }
 
 VtDictionary::const_iterator VtDictionary::begin() const {
@@ -144,7 +154,7 @@ void VtDictionary::swap(VtDictionary& dict) {
 std::pair<VtDictionary::iterator, bool>
 VtDictionary::insert(const value_type& obj) {
     TfAutoMallocTag2 tag("Vt", "VtDictionary::insert");
-    _CreateDictIfNeeded();
+    _Detach();
     std::pair<_Map::iterator, bool> inserted = _dictMap->insert(obj);
     return std::pair<iterator, bool>(
         iterator(_dictMap.get(), inserted.first), inserted.second);
@@ -294,6 +304,14 @@ void VtDictionary::_CreateDictIfNeeded() {
     }
 }
 
+void VtDictionary::_Detach() {
+    _CreateDictIfNeeded();
+    if (_dictMap.use_count() > 1) {
+        TfAutoMallocTag2 tag("Vt", "VtDictionary::_Detach");
+        _dictMap.reset(new _Map(*_dictMap));
+    }
+}
+
 
 VtDictionary const &VtGetEmptyDictionary() {
     return *_emptyDictionary;
@@ -454,6 +472,12 @@ VtDictionaryOverRecursive(const VtDictionary &strong, VtDictionary *weak,
 
 bool operator==(VtDictionary const &lhs, VtDictionary const &rhs)
 {
+    // Copies share their representation until mutated, so equal pointers
+    // mean equal contents.
+    if (lhs._dictMap == rhs._dictMap) {
+        return true;
+    }
+
     if (lhs.size() != rhs.size()) {
         return false;
     }
@@ -55,12 +55,26 @@ PXR_NAMESPACE_OPEN_SCOPE
 ///   - std::vector<VtValue>  (converts to a nested list)
 ///   - VtValue with one of the supported Vt Types.
 ///
-/// For a list of functions that can manipulate VtDictionary objects, see the  
+/// For a list of functions that can manipulate VtDictionary objects, see the
 /// \link group_vtdict_functions VtDictionary Functions \endlink group page .
 ///
+/// Copying a VtDictionary is cheap: copies share a single underlying map
+/// until one of them is mutated, at which point the mutated copy detaches
+/// with its own deep copy.  This makes it inexpensive to return dictionaries
+/// by value, as metadata reads do.  Note that iterators obtained from a
+/// dictionary before it was copied may not be used to mutate it afterwards,
+/// since mutation detaches from the map those iterators refer to.
+///
 class VtDictionary {
     typedef std::map<std::string, VtValue> _Map;
-    std::unique_ptr<_Map> _dictMap;
+
+    // Copies of a VtDictionary share this representation until one of them
+    // is mutated, so returning a dictionary by value -- layer metadata like
+    // assetInfo and customData is read this way thousands of times per
+    // stage open -- costs a reference bump rather than a deep copy.
+    // Mutating entry points detach (clone the shared map) first; see
+    // _Detach().
+    std::shared_ptr<_Map> _dictMap;
 
 public:
     // The iterator class, used to make both const and non-const iterators.
@@ -267,7 +281,7 @@ public:
     void insert(_InputIterator f, _InputIterator l) {
         TfAutoMallocTag2 tag("Vt", "VtDictionary::insert (range)");
         if (f != l) {
-            _CreateDictIfNeeded();
+            _Detach();
             _dictMap->insert(f, l);
         }
     }
@@ -338,6 +352,14 @@ private:
 
     void _CreateDictIfNeeded();
 
+    // Ensure we exclusively own _dictMap before mutating through it, cloning
+    // the underlying map if it is shared with other dictionaries (or creating
+    // it if this dictionary is empty).
+    VT_API
+    void _Detach();
+
+    friend VT_API bool
+    operator==(VtDictionary const &, VtDictionary const &);
 };
 
 /// Equality comparison.
@@ -25,8 +25,11 @@
 #include "pxr/pxr.h"
 #include "pxr/base/vt/hash.h"
 #include "pxr/base/arch/demangle.h"
+#include "pxr/base/arch/hash.h"
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/envSetting.h"
 
+#include <algorithm>
 #include <string>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -44,4 +47,39 @@ _IssueUnimplementedHashError(std::type_info const &t)
 
 } // Vt_HashDetail
 
+TF_DEFINE_ENV_SETTING(
+    VT_ARRAY_HASH_SAMPLE_THRESHOLD_MB, 0,
+    "If nonzero, hash the contents of byte-hashable arrays larger than this "
+    "many megabytes by sampling evenly spaced blocks instead of reading "
+    "every byte.  Sampled hashes are cheaper for very large arrays but "
+    "collide more readily; equal arrays still hash equal.");
+
+size_t
+Vt_HashByteData(void const *bytes, size_t numBytes)
+{
+    static const size_t threshold = []() {
+        return size_t(
+            std::max(0, TfGetEnvSetting(VT_ARRAY_HASH_SAMPLE_THRESHOLD_MB)))
+            * 1024 * 1024;
+    }();
+
+    char const *p = static_cast<char const *>(bytes);
+
+    if (threshold && numBytes > threshold) {
+        // Sample a fixed number of evenly spaced blocks, always including
+        // the head and tail, and mix in the total size so that arrays of
+        // different lengths hash differently.
+        constexpr size_t numBlocks = 16;
+        constexpr size_t blockSize = 64 * 1024;
+        const size_t stride = (numBytes - blockSize) / (numBlocks - 1);
+        uint64_t h = numBytes;
+        for (size_t i = 0; i != numBlocks; ++i) {
+            h = ArchHash64(p + i * stride, blockSize, h);
+        }
+        return size_t(h);
+    }
+
+    return size_t(ArchHash64(p, numBytes));
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
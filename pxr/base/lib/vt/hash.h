@@ -26,8 +26,10 @@
 
 #include "pxr/pxr.h"
 #include "pxr/base/vt/api.h"
+#include "pxr/base/gf/declare.h"
 #include "pxr/base/tf/hash.h"
 #include <boost/functional/hash.hpp>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
 
@@ -96,6 +98,29 @@ size_t VtHashValue(T const &val)
     return Vt_HashDetail::_HashValueImpl(val, 0);
 }
 
+/// A metafunction that is std::true_type for element types whose values can
+/// be hashed by hashing their object representation directly, meaning that
+/// values comparing equal always have identical bytes.  This holds for
+/// integral types and compound types built exclusively from them, but not
+/// for floating point types (e.g. -0.0 == 0.0 with different bit patterns)
+/// or types with padding.  VtArray uses this to hash array contents with a
+/// single bulk byte hash rather than element-by-element.
+template <class T>
+struct VtIsByteHashable
+    : std::integral_constant<bool, std::is_integral<T>::value> {};
+
+template <> struct VtIsByteHashable<GfVec2i> : std::true_type {};
+template <> struct VtIsByteHashable<GfVec3i> : std::true_type {};
+template <> struct VtIsByteHashable<GfVec4i> : std::true_type {};
+
+/// Hash \p numBytes bytes starting at \p bytes.  Used by VtArray to hash the
+/// contents of arrays of byte-hashable elements in bulk.  If the
+/// VT_ARRAY_HASH_SAMPLE_THRESHOLD_MB env setting is nonzero, ranges larger
+/// than the threshold are hashed by sampling evenly spaced blocks rather
+/// than reading every byte, trading hash quality for speed on very large
+/// arrays.
+VT_API size_t Vt_HashByteData(void const *bytes, size_t numBytes);
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif // VT_HASH_H
@@ -0,0 +1,171 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/vt/packedConversion.h"
+
+#include "pxr/base/gf/half.h"
+#include "pxr/base/gf/vec2d.h"
+#include "pxr/base/gf/vec2f.h"
+#include "pxr/base/gf/vec2h.h"
+#include "pxr/base/gf/vec3d.h"
+#include "pxr/base/gf/vec3f.h"
+#include "pxr/base/gf/vec3h.h"
+#include "pxr/base/gf/vec4d.h"
+#include "pxr/base/gf/vec4f.h"
+#include "pxr/base/gf/vec4h.h"
+
+#include <cmath>
+#include <limits>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// The kernels below run over flat component arrays with simple
+// element-wise bodies so the compiler can vectorize them.
+
+template <class HalfArray, class SrcArray>
+HalfArray
+_ToHalf(SrcArray const &src)
+{
+    typedef typename HalfArray::value_type HalfType;
+    HalfArray result(src.size());
+    HalfType *dst = result.data();
+    typename SrcArray::value_type const *s = src.cdata();
+    size_t const n = src.size();
+    for (size_t i = 0; i != n; ++i) {
+        dst[i] = HalfType(s[i]);
+    }
+    return result;
+}
+
+// Convert one float component to an unsigned normalized integer, mapping
+// [0,1] onto [0,max] with clamping and round-to-nearest.
+template <class UInt>
+inline UInt
+_PackUNorm(float value)
+{
+    float const max = float(std::numeric_limits<UInt>::max());
+    value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+    return UInt(value * max + 0.5f);
+}
+
+// Convert one float component to a signed normalized integer, mapping
+// [-1,1] onto [-max,max] with clamping and round-to-nearest.  Note that
+// the most negative representable integer is unused, per the usual
+// graphics-API snorm encoding.
+template <class Int>
+inline Int
+_PackSNorm(float value)
+{
+    float const max = float(std::numeric_limits<Int>::max());
+    value = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+    return Int(std::lround(value * max));
+}
+
+template <class Norm, Norm (*PackFunc)(float), class SrcArray>
+VtArray<Norm>
+_ToNorm(SrcArray const &src)
+{
+    typedef typename SrcArray::value_type SrcType;
+    size_t const numComponents =
+        sizeof(SrcType) / sizeof(float) * src.size();
+    VtArray<Norm> result(numComponents);
+    Norm *dst = result.data();
+    float const *s = reinterpret_cast<float const *>(src.cdata());
+    for (size_t i = 0; i != numComponents; ++i) {
+        dst[i] = PackFunc(s[i]);
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+VtHalfArray VtConvertToHalf(VtFloatArray const &src) {
+    return _ToHalf<VtHalfArray>(src);
+}
+VtHalfArray VtConvertToHalf(VtDoubleArray const &src) {
+    return _ToHalf<VtHalfArray>(src);
+}
+VtVec2hArray VtConvertToHalf(VtVec2fArray const &src) {
+    return _ToHalf<VtVec2hArray>(src);
+}
+VtVec3hArray VtConvertToHalf(VtVec3fArray const &src) {
+    return _ToHalf<VtVec3hArray>(src);
+}
+VtVec4hArray VtConvertToHalf(VtVec4fArray const &src) {
+    return _ToHalf<VtVec4hArray>(src);
+}
+VtVec2hArray VtConvertToHalf(VtVec2dArray const &src) {
+    return _ToHalf<VtVec2hArray>(src);
+}
+VtVec3hArray VtConvertToHalf(VtVec3dArray const &src) {
+    return _ToHalf<VtVec3hArray>(src);
+}
+VtVec4hArray VtConvertToHalf(VtVec4dArray const &src) {
+    return _ToHalf<VtVec4hArray>(src);
+}
+
+VtUCharArray VtConvertToUNorm8(VtFloatArray const &src) {
+    return _ToNorm<unsigned char, _PackUNorm<unsigned char>>(src);
+}
+VtUCharArray VtConvertToUNorm8(VtVec3fArray const &src) {
+    return _ToNorm<unsigned char, _PackUNorm<unsigned char>>(src);
+}
+VtUCharArray VtConvertToUNorm8(VtVec4fArray const &src) {
+    return _ToNorm<unsigned char, _PackUNorm<unsigned char>>(src);
+}
+
+VtCharArray VtConvertToSNorm8(VtFloatArray const &src) {
+    return _ToNorm<char, _PackSNorm<char>>(src);
+}
+VtCharArray VtConvertToSNorm8(VtVec3fArray const &src) {
+    return _ToNorm<char, _PackSNorm<char>>(src);
+}
+VtCharArray VtConvertToSNorm8(VtVec4fArray const &src) {
+    return _ToNorm<char, _PackSNorm<char>>(src);
+}
+
+VtUShortArray VtConvertToUNorm16(VtFloatArray const &src) {
+    return _ToNorm<unsigned short, _PackUNorm<unsigned short>>(src);
+}
+VtUShortArray VtConvertToUNorm16(VtVec3fArray const &src) {
+    return _ToNorm<unsigned short, _PackUNorm<unsigned short>>(src);
+}
+VtUShortArray VtConvertToUNorm16(VtVec4fArray const &src) {
+    return _ToNorm<unsigned short, _PackUNorm<unsigned short>>(src);
+}
+
+VtShortArray VtConvertToSNorm16(VtFloatArray const &src) {
+    return _ToNorm<short, _PackSNorm<short>>(src);
+}
+VtShortArray VtConvertToSNorm16(VtVec3fArray const &src) {
+    return _ToNorm<short, _PackSNorm<short>>(src);
+}
+VtShortArray VtConvertToSNorm16(VtVec4fArray const &src) {
+    return _ToNorm<short, _PackSNorm<short>>(src);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
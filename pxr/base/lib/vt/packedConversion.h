@@ -0,0 +1,111 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef VT_PACKED_CONVERSION_H
+#define VT_PACKED_CONVERSION_H
+
+/// \file vt/packedConversion.h
+///
+/// Conversion kernels from full-precision arrays to packed arrays.
+///
+/// Renderers frequently upload primvar data as full float32 even when the
+/// source values fit a narrower encoding.  The functions here convert
+/// float and double arrays into half-precision and normalized-integer
+/// arrays so consumers can hold and upload the packed form directly.
+///
+/// The normalized-integer conversions clamp to the representable range
+/// ([0,1] for unsigned, [-1,1] for signed) and round to nearest, matching
+/// the usual graphics-API unorm/snorm encodings.  Conversions from vector
+/// arrays produce flat component arrays (e.g. a VtVec3fArray of length N
+/// becomes a VtUCharArray of length 3N), since there are no
+/// normalized-integer vector value types.
+
+#include "pxr/pxr.h"
+#include "pxr/base/vt/api.h"
+#include "pxr/base/vt/array.h"
+#include "pxr/base/vt/types.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \defgroup group_vt_packedConversion Packed Array Conversions
+/// Functions converting full-precision arrays to packed arrays.
+/// @{
+
+/// Convert \p src to an array of half-precision floats.  Values outside
+/// the representable range of GfHalf become infinities.
+VT_API VtHalfArray VtConvertToHalf(VtFloatArray const &src);
+/// \overload
+VT_API VtHalfArray VtConvertToHalf(VtDoubleArray const &src);
+/// \overload
+VT_API VtVec2hArray VtConvertToHalf(VtVec2fArray const &src);
+/// \overload
+VT_API VtVec3hArray VtConvertToHalf(VtVec3fArray const &src);
+/// \overload
+VT_API VtVec4hArray VtConvertToHalf(VtVec4fArray const &src);
+/// \overload
+VT_API VtVec2hArray VtConvertToHalf(VtVec2dArray const &src);
+/// \overload
+VT_API VtVec3hArray VtConvertToHalf(VtVec3dArray const &src);
+/// \overload
+VT_API VtVec4hArray VtConvertToHalf(VtVec4dArray const &src);
+
+/// Convert \p src to 8-bit unsigned normalized values.  Source values are
+/// clamped to [0,1] and rounded to nearest, so 0 maps to 0 and 1 to 255.
+VT_API VtUCharArray VtConvertToUNorm8(VtFloatArray const &src);
+/// \overload Produces a flat component array of length 3 * src.size().
+VT_API VtUCharArray VtConvertToUNorm8(VtVec3fArray const &src);
+/// \overload Produces a flat component array of length 4 * src.size().
+VT_API VtUCharArray VtConvertToUNorm8(VtVec4fArray const &src);
+
+/// Convert \p src to 8-bit signed normalized values.  Source values are
+/// clamped to [-1,1] and rounded to nearest, so -1 maps to -127 and 1 to
+/// 127.
+VT_API VtCharArray VtConvertToSNorm8(VtFloatArray const &src);
+/// \overload Produces a flat component array of length 3 * src.size().
+VT_API VtCharArray VtConvertToSNorm8(VtVec3fArray const &src);
+/// \overload Produces a flat component array of length 4 * src.size().
+VT_API VtCharArray VtConvertToSNorm8(VtVec4fArray const &src);
+
+/// Convert \p src to 16-bit unsigned normalized values.  Source values
+/// are clamped to [0,1] and rounded to nearest, so 0 maps to 0 and 1 to
+/// 65535.
+VT_API VtUShortArray VtConvertToUNorm16(VtFloatArray const &src);
+/// \overload Produces a flat component array of length 3 * src.size().
+VT_API VtUShortArray VtConvertToUNorm16(VtVec3fArray const &src);
+/// \overload Produces a flat component array of length 4 * src.size().
+VT_API VtUShortArray VtConvertToUNorm16(VtVec4fArray const &src);
+
+/// Convert \p src to 16-bit signed normalized values.  Source values are
+/// clamped to [-1,1] and rounded to nearest, so -1 maps to -32767 and 1
+/// to 32767.
+VT_API VtShortArray VtConvertToSNorm16(VtFloatArray const &src);
+/// \overload Produces a flat component array of length 3 * src.size().
+VT_API VtShortArray VtConvertToSNorm16(VtVec3fArray const &src);
+/// \overload Produces a flat component array of length 4 * src.size().
+VT_API VtShortArray VtConvertToSNorm16(VtVec4fArray const &src);
+
+/// @}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // VT_PACKED_CONVERSION_H
@@ -28,6 +28,7 @@
 #include "pxr/base/vt/value.h"
 #include "pxr/base/vt/types.h"
 #include "pxr/base/vt/functions.h"
+#include "pxr/base/vt/packedConversion.h"
 
 #include "pxr/base/gf/matrix2f.h"
 #include "pxr/base/gf/matrix2d.h"
@@ -311,6 +312,53 @@ static void testArray() {
     }
 }
 
+static void testForeignArray() {
+    // Wrap externally owned memory in a VtArray without copying it.
+    {
+        bool deleted = false;
+        double *buf = new double[4];
+        for (size_t i = 0; i != 4; ++i) {
+            buf[i] = static_cast<double>(i);
+        }
+
+        {
+            VtDoubleArray array = VtArrayFromForeignData(
+                buf, 4, [buf, &deleted]() { delete [] buf; deleted = true; });
+            TF_AXIOM(array.size() == 4);
+            // Const access does not copy.
+            TF_AXIOM(array.cdata() == buf);
+            TF_AXIOM(array.cdata()[2] == 2.0);
+
+            // Copies share the foreign buffer.
+            VtDoubleArray copy = array;
+            TF_AXIOM(copy.cdata() == buf);
+            TF_AXIOM(!deleted);
+
+            // Mutation detaches into array-owned storage, leaving the
+            // foreign buffer untouched.
+            copy[1] = 99.0;
+            TF_AXIOM(copy.cdata() != buf);
+            TF_AXIOM(copy[1] == 99.0);
+            TF_AXIOM(buf[1] == 1.0);
+            TF_AXIOM(!deleted);
+        }
+
+        // The last referring array has been destroyed; the deleter must
+        // have run.
+        TF_AXIOM(deleted);
+    }
+
+    // A null pointer yields an empty array and runs the deleter
+    // immediately.
+    {
+        bool deleted = false;
+        VtIntArray array = VtArrayFromForeignData<int>(
+            nullptr, 0, [&deleted]() { deleted = true; });
+        TF_AXIOM(array.empty());
+        TF_AXIOM(deleted);
+    }
+}
+
 static void testArrayOperators() {
 
     {
@@ -525,6 +573,103 @@ static void testDictionary() {
     }
 }
 
+static void testPackedConversion() {
+    // Half conversions preserve exactly representable values.
+    VtFloatArray floats(4);
+    floats[0] = 0.0f;
+    floats[1] = 1.0f;
+    floats[2] = -2.5f;
+    floats[3] = 0.125f;
+    VtHalfArray halves = VtConvertToHalf(floats);
+    TF_AXIOM(halves.size() == 4);
+    for (size_t i = 0; i != floats.size(); ++i) {
+        TF_AXIOM(float(halves[i]) == floats[i]);
+    }
+
+    VtVec3fArray vecs(2);
+    vecs[0] = GfVec3f(0.0f, 0.5f, 1.0f);
+    vecs[1] = GfVec3f(-1.0f, 2.0f, -0.25f);
+    VtVec3hArray halfVecs = VtConvertToHalf(vecs);
+    TF_AXIOM(halfVecs.size() == 2);
+    TF_AXIOM(GfVec3f(halfVecs[1]) == vecs[1]);
+
+    // UNorm8 clamps to [0,1] and rounds to nearest; vector sources
+    // produce flat component arrays.
+    VtUCharArray unorm = VtConvertToUNorm8(vecs);
+    TF_AXIOM(unorm.size() == 6);
+    TF_AXIOM(unorm[0] == 0 && unorm[1] == 128 && unorm[2] == 255);
+    TF_AXIOM(unorm[3] == 0 && unorm[4] == 255 && unorm[5] == 0);
+
+    // SNorm8 clamps to [-1,1]; -1 and 1 map to -127 and 127.
+    VtCharArray snorm = VtConvertToSNorm8(vecs);
+    TF_AXIOM(snorm.size() == 6);
+    TF_AXIOM(snorm[3] == -127 && snorm[4] == 127);
+
+    // 16-bit flavors cover the wider range.
+    VtFloatArray ends(2);
+    ends[0] = 0.0f;
+    ends[1] = 1.0f;
+    VtUShortArray unorm16 = VtConvertToUNorm16(ends);
+    TF_AXIOM(unorm16[0] == 0 && unorm16[1] == 65535);
+    ends[0] = -1.0f;
+    VtShortArray snorm16 = VtConvertToSNorm16(ends);
+    TF_AXIOM(snorm16[0] == -32767 && snorm16[1] == 32767);
+}
+
+static void testDictionarySharing() {
+    VtDictionary dict;
+    dict["key1"] = VtValue(1.5);
+    dict["key2"] = VtValue(string("a string"));
+
+    // Copies share the underlying representation until one is mutated, so
+    // the values of a fresh copy live at the same addresses.
+    VtDictionary copy = dict;
+    VtDictionary const &constDict = dict;
+    VtDictionary const &constCopy = copy;
+    TF_AXIOM(&constDict.find("key1")->second ==
+             &constCopy.find("key1")->second);
+
+    // Const lookups do not detach.
+    TF_AXIOM(VtDictionaryGet<double>(copy, "key1") == 1.5);
+    TF_AXIOM(&constDict.find("key1")->second ==
+             &constCopy.find("key1")->second);
+
+    // Mutating the copy detaches it; the original is unaffected.
+    copy["key3"] = VtValue(true);
+    TF_AXIOM(&constDict.find("key1")->second !=
+             &constCopy.find("key1")->second);
+    TF_AXIOM(dict.size() == 2);
+    TF_AXIOM(copy.size() == 3);
+
+    copy["key1"] = VtValue(2.5);
+    TF_AXIOM(VtDictionaryGet<double>(dict, "key1") == 1.5);
+    TF_AXIOM(VtDictionaryGet<double>(copy, "key1") == 2.5);
+
+    // Assignment shares as well, and erasing from one side leaves the
+    // other intact.
+    VtDictionary assigned;
+    assigned = dict;
+    TF_AXIOM(assigned == dict);
+    assigned.erase("key2");
+    TF_AXIOM(assigned.size() == 1);
+    TF_AXIOM(dict.size() == 2);
+
+    // Mutation via a non-const iterator detaches before the iterator is
+    // produced, so the shared copy is unaffected.
+    VtDictionary iterCopy = dict;
+    VtDictionary::iterator i = iterCopy.find("key1");
+    TF_AXIOM(i != iterCopy.end());
+    i->second = VtValue(3.5);
+    TF_AXIOM(VtDictionaryGet<double>(dict, "key1") == 1.5);
+    TF_AXIOM(VtDictionaryGet<double>(iterCopy, "key1") == 3.5);
+
+    // Clearing one copy leaves the other alone.
+    VtDictionary cleared = dict;
+    cleared.clear();
+    TF_AXIOM(cleared.empty());
+    TF_AXIOM(dict.size() == 2);
+}
+
 static void testDictionaryOverRecursive() {
     double d = 1.5;
     double d2 = 2.5;
@@ -1250,6 +1395,49 @@ static void testValue() {
         TF_AXIOM(v.IsEmpty());
     }
 
+    // Test moving objects into and out of VtValues.  The vector's buffer
+    // pointer lets us observe whether contents were moved or copied.
+    {
+        std::vector<double> vec(100, 1.23);
+        double const *data = vec.data();
+        VtValue v(std::move(vec));
+        TF_AXIOM(v.IsHolding<std::vector<double>>());
+        TF_AXIOM(v.UncheckedGet<std::vector<double>>().data() == data);
+
+        std::vector<double> vec2(50, 4.56);
+        data = vec2.data();
+        v = std::move(vec2);
+        TF_AXIOM(v.IsHolding<std::vector<double>>());
+        TF_AXIOM(v.UncheckedGet<std::vector<double>>().size() == 50);
+        TF_AXIOM(v.UncheckedGet<std::vector<double>>().data() == data);
+
+        std::vector<double> vec3(25, 7.89);
+        data = vec3.data();
+        VtValue taken = VtValue::Take(std::move(vec3));
+        TF_AXIOM(taken.IsHolding<std::vector<double>>());
+        TF_AXIOM(taken.UncheckedGet<std::vector<double>>().data() == data);
+
+        std::vector<double> out = taken.UncheckedRemove<std::vector<double>>();
+        TF_AXIOM(out.data() == data);
+        TF_AXIOM(taken.IsEmpty());
+    }
+
+    // Small fixed-size types are stored in VtValue's local storage; make
+    // sure two-word types round-trip correctly.
+    {
+        VtValue v(GfVec2d(1.0, 2.0));
+        TF_AXIOM(v.IsHolding<GfVec2d>());
+        TF_AXIOM(v.UncheckedGet<GfVec2d>() == GfVec2d(1.0, 2.0));
+
+        VtValue copy = v;
+        TF_AXIOM(copy == v);
+
+        GfVec2d other(3.0, 4.0);
+        v.Swap(other);
+        TF_AXIOM(other == GfVec2d(1.0, 2.0));
+        TF_AXIOM(v.UncheckedGet<GfVec2d>() == GfVec2d(3.0, 4.0));
+    }
+
     // Test calling Get with incorrect type.  Should issue an error and produce
     // some "default" value.
 
@@ -1309,12 +1497,67 @@ testValueHash()
     }
 }
 
+static void
+testArrayHash()
+{
+    // Byte-hashable and element-wise hashed types must both satisfy the
+    // basic contract: equal arrays hash equal.
+    static_assert(VtIsByteHashable<int>::value, "");
+    static_assert(!VtIsByteHashable<float>::value, "");
+
+    VtIntArray ia(1024);
+    for (size_t i = 0; i != ia.size(); ++i) {
+        ia[i] = int(i);
+    }
+    VtIntArray ib = ia;
+    TF_AXIOM(hash_value(ia) == hash_value(ib));
+
+    // Copies share data, so the cached hash is shared too; hashing one then
+    // mutating the other must not produce a stale result.
+    VtIntArray ic = ia;
+    size_t oldHash = hash_value(ic);
+    ic[0] = -1;
+    TF_AXIOM(hash_value(ic) != oldHash ||
+             !"mutated array should (almost certainly) hash differently");
+    TF_AXIOM(hash_value(ia) == oldHash);
+
+    // In-place mutation of a uniquely owned array invalidates the cache.
+    size_t uniqueHash = hash_value(ia);
+    ia[0] = 12345;
+    TF_AXIOM(hash_value(ia) != uniqueHash);
+    ia[0] = 0;
+    TF_AXIOM(hash_value(ia) == uniqueHash);
+
+    // Size changes invalidate too.
+    VtIntArray id = ib;
+    size_t preResize = hash_value(id);
+    id.push_back(7);
+    TF_AXIOM(hash_value(id) != preResize);
+    id.pop_back();
+    TF_AXIOM(hash_value(id) == preResize);
+
+    // Element-wise path for float arrays: equal contents hash equal.
+    VtFloatArray fa(64, 1.5f);
+    VtFloatArray fb(64, 1.5f);
+    TF_AXIOM(hash_value(fa) == hash_value(fb));
+    // -0.0f == 0.0f must hash identically, which is why floats take the
+    // element-wise path.
+    VtFloatArray fz1(4, 0.0f);
+    VtFloatArray fz2(4, -0.0f);
+    TF_AXIOM(fz1 == fz2);
+    TF_AXIOM(hash_value(fz1) == hash_value(fz2));
+}
+
 int main(int argc, char *argv[])
 {
     testArray();
+    testForeignArray();
     testArrayOperators();
+    testArrayHash();
 
     testDictionary();
+    testDictionarySharing();
+    testPackedConversion();
     testDictionaryKeyPathAPI();
     testDictionaryOverRecursive();
     testDictionaryIterators();
@@ -190,6 +190,9 @@ class VtValue
         explicit _Counted(T const &obj) : _obj(obj) {
             _refCount = 0;
         }
+        explicit _Counted(T &&obj) : _obj(std::move(obj)) {
+            _refCount = 0;
+        }
         bool IsUnique() const { return _refCount == 1; }
         T const &Get() const { return _obj; }
         T &GetMutable() { return _obj; }
@@ -209,12 +212,16 @@ class VtValue
         }
     };
 
-    // Hold objects up to 1 word large locally.  This makes the total structure
-    // 16 bytes when compiled 64 bit (1 word type-info pointer, 1 word storage
-    // space).
-    static const size_t _MaxLocalSize = sizeof(void*);
+    // Hold objects up to 2 words large locally.  This makes the total
+    // structure 24 bytes when compiled 64 bit (1 word type-info pointer, 2
+    // words storage space) and covers common small value types like vec2d,
+    // vec4f and quatf in addition to the word-sized ones.  Larger local
+    // storage (say, matrix-sized) trades poorly: scene data holds values by
+    // the million, and the bigger footprint costs more in cache misses than
+    // the avoided heap allocations return.
+    static const size_t _MaxLocalSize = 2 * sizeof(void*);
     typedef std::aligned_storage<
-        /* size */_MaxLocalSize, /* alignment */_MaxLocalSize>::type _Storage;
+        /* size */_MaxLocalSize, /* alignment */sizeof(void*)>::type _Storage;
 
     template <class T>
     struct _IsTriviallyCopyable : boost::mpl::and_<
@@ -228,6 +235,7 @@ class VtValue
     template <class T>
     struct _UsesLocalStore : boost::mpl::bool_<
         (sizeof(T) <= sizeof(_Storage)) &&
+        (alignof(T) <= alignof(_Storage)) &&
         VtValueTypeHasCheapCopy<T>::value > {};
 
     // Type information base class.
@@ -430,6 +438,10 @@ class VtValue
             Derived::_PlaceCopy(&_Container(dst), objSrc);
         }
 
+        static void MoveInitObj(T &&objSrc, _Storage &dst) {
+            Derived::_PlaceMove(&_Container(dst), std::move(objSrc));
+        }
+
     private:
         static_assert(sizeof(Container) <= sizeof(_Storage),
                       "Container size cannot exceed storage size.");
@@ -529,6 +541,7 @@ class VtValue
         static T const &_GetObj(T const &obj) { return obj; }
         // Place placement new's object directly.
         static void _PlaceCopy(T *dst, T const &src) { new (dst) T(src); }
+        static void _PlaceMove(T *dst, T &&src) { new (dst) T(std::move(src)); }
     };
 
     ////////////////////////////////////////////////////////////////////////
@@ -558,6 +571,10 @@ class VtValue
         static void _PlaceCopy(Ptr *dst, T const &src) {
             new (dst) Ptr(new _Counted<T>(src));
         }
+        // PlaceMove() allocates a new _Counted<T>, moving from the object.
+        static void _PlaceMove(Ptr *dst, T &&src) {
+            new (dst) Ptr(new _Counted<T>(std::move(src)));
+        }
     };
 
     // Metafunction that returns the specific _TypeInfo subclass for T.
@@ -622,10 +639,24 @@ class VtValue
         TypeInfo::CopyInitObj(obj, _storage);
     }
 
+    // Move-from-object initialization; selected for rvalues of the stored
+    // type.  For lvalues, T deduces to a reference type, the enable_if
+    // fails, and the copying overload above is taken instead.
+    template <class T>
+    typename boost::enable_if<
+        boost::is_same<T, typename Vt_ValueGetStored<T>::Type> >::type
+    _Init(T &&obj) {
+        _info = GetTypeInfo<T>();
+        typedef typename _TypeInfoFor<T>::Type TypeInfo;
+        TypeInfo::MoveInitObj(std::move(obj), _storage);
+    }
+
     template <class T>
     typename boost::disable_if<
         boost::is_same<T, typename Vt_ValueGetStored<T>::Type> >::type
     _Init(T const &obj) {
+        // The converted temporary is an rvalue, so this takes the moving
+        // overload above.
         _Init(typename Vt_ValueGetStored<T>::Type(obj));
     }
 
@@ -644,14 +675,18 @@ public:
         _Move(other, *this);
     }
 
-    /// Construct a VtValue holding a copy of \p obj.
-    /// 
+    /// Construct a VtValue holding a copy of \p obj, or, if \p obj is an
+    /// rvalue, a VtValue that has taken \p obj's contents by move.
+    ///
     /// If T is a char pointer or array, produce a VtValue holding a
     /// std::string. If T is boost::python::object, produce a VtValue holding
     /// a TfPyObjWrapper.
-    template <class T>
-    explicit VtValue(T const &obj) {
-        _Init(obj);
+    template <class T,
+              typename std::enable_if<
+                  !std::is_same<VtValue, typename std::decay<T>::type>::value,
+                  int>::type = 0>
+    explicit VtValue(T &&obj) {
+        _Init(std::forward<T>(obj));
     }
 
     /// Create a new VtValue, taking its contents from \p obj.
@@ -673,8 +708,11 @@ public:
     /// MyExpensiveObject obj = CreateObject();
     /// return VtValue(obj);
     /// \endcode
+    /// Rvalues may be passed directly: VtValue::Take(CreateObject()) and
+    /// VtValue::Take(std::move(obj)) take the object's contents without
+    /// copying.
     template <class T>
-    static VtValue Take(T &obj) {
+    static VtValue Take(T &&obj) {
         VtValue ret;
         ret.Swap(obj);
         return ret;
@@ -722,6 +760,21 @@ public:
         return *this;
     }
 
+    /// Move assignment from rvalues of types that are not stored locally
+    /// with trivial copies; takes the object's contents without copying.
+    /// Lvalues and cheaply copied local types take the overloads above.
+    template <class T>
+    typename boost::enable_if_c<
+        !std::is_reference<T>::value &&
+        !(_TypeInfoFor<typename std::decay<T>::type>::Type::IsLocal &&
+          _TypeInfoFor<typename std::decay<T>::type>::Type::HasTrivialCopy),
+    VtValue &>::type
+    operator=(T &&obj) {
+        _HoldAside tmp(this);
+        _Init(std::move(obj));
+        return *this;
+    }
+
     /// Assigning a char const * gives a VtValue holding a std::string.
     VtValue &operator=(char const *cstr) {
         std::string tmp(cstr);
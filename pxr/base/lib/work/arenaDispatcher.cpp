@@ -25,10 +25,46 @@
 #include "pxr/pxr.h"
 #include "pxr/base/work/arenaDispatcher.h"
 
+#include "pxr/base/arch/numa.h"
+
+// Observers bound to a specific arena are a preview feature in the TBB
+// versions we build against.
+#define TBB_PREVIEW_LOCAL_OBSERVER 1
 #include <tbb/concurrent_queue.h>
+#include <tbb/task_scheduler_observer.h>
+
+#include <algorithm>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+/// Pins threads to a NUMA node's CPUs while they work in a given arena, so
+/// the memory their tasks allocate and first touch lands on that node.
+class Work_NumaArenaObserver : public tbb::task_scheduler_observer
+{
+public:
+    Work_NumaArenaObserver(tbb::task_arena &arena, int numaNode)
+        : tbb::task_scheduler_observer(arena)
+        , _numaNode(numaNode)
+    {
+        observe(true);
+    }
+
+    ~Work_NumaArenaObserver() {
+        observe(false);
+    }
+
+    void on_scheduler_entry(bool) override {
+        ArchPinThreadToNumaNode(_numaNode);
+    }
+
+    void on_scheduler_exit(bool) override {
+        ArchUnpinThread();
+    }
+
+private:
+    int _numaNode;
+};
+
 namespace {
 // We do this at Intel's suggestion, since creating and destroying arenas is
 // pretty expensive and rather concurrency unfriendly.  We have code that,
@@ -83,7 +119,15 @@ GetTheArenaManager()
 WorkArenaDispatcher::~WorkArenaDispatcher()
 {
     Wait();
-    GetTheArenaManager().Return(_arena);
+    if (_observer) {
+        // Node-bound arenas are dedicated to this dispatcher -- their
+        // concurrency matches the node, not the global limit -- so they
+        // are not returned to the shared manager.
+        delete _observer;
+        delete _arena;
+    } else {
+        GetTheArenaManager().Return(_arena);
+    }
 }
 
 void
@@ -112,9 +156,27 @@ WorkArenaDispatcher::Cancel()
 }
 
 tbb::task_arena *
-WorkArenaDispatcher::_GetArena() const
+WorkArenaDispatcher::_GetArena(int numaNode) const
 {
+    if (numaNode >= 0) {
+        size_t const numCpus = ArchGetNumaNodeCpus(numaNode).size();
+        if (numCpus > 0) {
+            return new tbb::task_arena(static_cast<int>(
+                std::min<size_t>(numCpus, WorkGetConcurrencyLimit())));
+        }
+        // Unknown topology or node out of range; fall through to a
+        // placement-blind arena.
+    }
     return GetTheArenaManager().CheckOut();
 }
 
+Work_NumaArenaObserver *
+WorkArenaDispatcher::_MakeObserver(int numaNode) const
+{
+    if (numaNode >= 0 && !ArchGetNumaNodeCpus(numaNode).empty()) {
+        return new Work_NumaArenaObserver(*_arena, numaNode);
+    }
+    return nullptr;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -52,12 +52,34 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// The interface of the WorkArenaDispatcher, and thread-safety notes about its
 /// API are identical to those of the WorkDispatcher.
 ///
+/// On NUMA machines a dispatcher can additionally be bound to a single NUMA
+/// node.  Worker threads entering a node-bound dispatcher's arena are pinned
+/// to that node's CPUs, so the memory its tasks allocate and first touch is
+/// placed node-locally (see arch/numa.h).  Clients with work that is large
+/// enough to partition -- composing the subtrees of a large stage, say --
+/// can create one node-bound dispatcher per node (ArchGetNumaNodeCount())
+/// and keep each partition's computation and memory on one socket, avoiding
+/// cross-socket traffic.
+///
+class Work_NumaArenaObserver;
+
 class WorkArenaDispatcher
 {
 public:
     /// Constructs a new dispatcher. The internal arena will mirror the
-    /// global concurrency limit setting.
-    WorkArenaDispatcher() : _arena(_GetArena()) {}
+    /// global concurrency limit setting.  Tasks run by this dispatcher are
+    /// scheduled in the given priority lane; see WorkPriority.
+    ///
+    /// If \p numaNode is non-negative and names a NUMA node on this machine
+    /// (see ArchGetNumaNodeCount()), the dispatcher gets a dedicated arena
+    /// whose concurrency matches the node's CPU count, and worker threads
+    /// are pinned to the node's CPUs while working in it.  Otherwise the
+    /// dispatcher is placement-blind, as before.
+    explicit WorkArenaDispatcher(WorkPriority priority = WorkPriorityDefault,
+                                 int numaNode = -1)
+        : _arena(_GetArena(numaNode))
+        , _observer(_MakeObserver(numaNode))
+        , _dispatcher(priority) {}
 
     /// Wait() for any pending tasks to complete, then destroy the dispatcher.
     WORK_API ~WorkArenaDispatcher();
@@ -101,8 +123,12 @@ public:
     WORK_API void Cancel();
 
 private:
-    WORK_API tbb::task_arena *_GetArena() const;
-    
+    WORK_API tbb::task_arena *_GetArena(int numaNode) const;
+
+    // Returns an observer that pins worker threads entering _arena to
+    // \p numaNode's CPUs, or nullptr for placement-blind dispatchers.
+    WORK_API Work_NumaArenaObserver *_MakeObserver(int numaNode) const;
+
     template <class Fn>
     struct _Runner {
         _Runner(WorkDispatcher *wd, Fn &&fn) : _wd(wd), _fn(std::move(fn)) {}
@@ -124,6 +150,9 @@ private:
     // The task arena.
     tbb::task_arena *_arena;
 
+    // Pins threads in _arena to a NUMA node; null unless node-bound.
+    Work_NumaArenaObserver *_observer;
+
     // The dispatcher.
     WorkDispatcher _dispatcher;
 };
@@ -0,0 +1,96 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef WORK_CANCELLATION_TOKEN_H
+#define WORK_CANCELLATION_TOKEN_H
+
+/// \file work/cancellationToken.h
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/api.h"
+
+#include <atomic>
+#include <memory>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class WorkCancellationToken
+///
+/// A cooperative cancellation flag that task code can poll from inside its
+/// inner loops.
+///
+/// WorkDispatcher::Cancel() prevents tasks that have not yet started from
+/// running, but a task already executing -- say, one iteration range of a
+/// WorkParallelForN loop -- runs to completion regardless.  For long-running
+/// task bodies that should abort early when their results are no longer
+/// wanted (for example, updating renderable state for a frame the user has
+/// already scrubbed past), share a WorkCancellationToken between the code
+/// that issues the work and the task bodies, and have the task bodies check
+/// IsCanceled() at convenient points and return early when it fires.
+///
+/// Copies of a token share cancellation state: Cancel() on any copy is
+/// observed by IsCanceled() on all of them.  Reset() detaches the token from
+/// its current state and gives it fresh, uncanceled state; copies taken
+/// before the Reset() still observe the old state.  This makes per-round
+/// usage simple: the issuing side holds one token, Reset()s it at the start
+/// of each round of work, hands copies to the tasks, and Cancel()s when the
+/// round is superseded.
+///
+/// All methods are thread-safe.
+///
+class WorkCancellationToken
+{
+public:
+    /// Construct a token in the uncanceled state.
+    WorkCancellationToken()
+        : _canceled(std::make_shared<std::atomic<bool>>(false)) {}
+
+    /// Request cancellation.  Tasks polling this token (or any copy of it)
+    /// will see IsCanceled() return true.
+    void Cancel() const {
+        _canceled->store(true, std::memory_order_release);
+    }
+
+    /// Returns true if Cancel() has been called on this token or on any
+    /// copy sharing its state.  Cheap enough to poll from inner loops.
+    bool IsCanceled() const {
+        return _canceled->load(std::memory_order_acquire);
+    }
+
+    /// Replace this token's state with fresh, uncanceled state.  Copies
+    /// taken before the Reset() keep observing the old state, so work
+    /// already in flight against those copies stays canceled.
+    ///
+    /// Unlike Cancel() and IsCanceled(), Reset() must not race with other
+    /// uses of this same token object (copies are fine).
+    void Reset() {
+        _canceled = std::make_shared<std::atomic<bool>>(false);
+    }
+
+private:
+    std::shared_ptr<std::atomic<bool>> _canceled;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // WORK_CANCELLATION_TOKEN_H
@@ -27,12 +27,21 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
-WorkDispatcher::WorkDispatcher()
+WorkDispatcher::WorkDispatcher(WorkPriority priority)
     : _context(
         tbb::task_group_context::isolated,
-        tbb::task_group_context::concurrent_wait | 
+        tbb::task_group_context::concurrent_wait |
         tbb::task_group_context::default_traits)
 {
+    // Map the requested priority lane onto the task group context.  The
+    // default lane leaves the context's priority untouched so it behaves
+    // exactly as before this parameter existed.
+    if (priority == WorkPriorityBackground) {
+        _context.set_priority(tbb::priority_low);
+    } else if (priority == WorkPriorityInteractive) {
+        _context.set_priority(tbb::priority_high);
+    }
+
     // The concurrent_wait flag used with the task_group_context ensures
     // the ref count will remain at 1 after all predecessor tasks are
     // completed, so we don't need to keep resetting it in Wait().
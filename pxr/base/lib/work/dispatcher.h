@@ -42,6 +42,22 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+/// \enum WorkPriority
+///
+/// Scheduling priority lane for a dispatcher's tasks.  All tasks run by a
+/// dispatcher share its priority; when the machine is oversubscribed, TBB
+/// runs higher-priority task groups ahead of lower-priority ones.  Use
+/// WorkPriorityInteractive for work the user is actively waiting on (for
+/// example, updating state for the frame being displayed) and
+/// WorkPriorityBackground for speculative or deferrable work (for example,
+/// prefetching data for upcoming frames), so the latter yields the machine
+/// to the former instead of competing with it.
+enum WorkPriority {
+    WorkPriorityBackground,
+    WorkPriorityDefault,
+    WorkPriorityInteractive
+};
+
 /// \class WorkDispatcher
 ///
 /// A work dispatcher runs concurrent tasks.  The dispatcher supports adding
@@ -71,8 +87,10 @@ PXR_NAMESPACE_OPEN_SCOPE
 class WorkDispatcher
 {
 public:
-    /// Construct a new dispatcher.
-    WORK_API WorkDispatcher();
+    /// Construct a new dispatcher.  Tasks run by this dispatcher are
+    /// scheduled in the given priority lane; see WorkPriority.
+    WORK_API explicit WorkDispatcher(
+        WorkPriority priority = WorkPriorityDefault);
 
     /// Wait() for any pending tasks to complete, then destroy the dispatcher.
     WORK_API ~WorkDispatcher();
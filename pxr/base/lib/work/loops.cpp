@@ -27,6 +27,82 @@
 #include "pxr/base/work/loops.h"
 #include "pxr/base/work/threadLimits.h"
 
+#include "pxr/base/arch/timing.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/trace/trace.h"
+
 //
 // WorkParallelForN implementation for TBB
 //
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    WORK_LOOP_METRICS, false,
+    "Report per-loop parallel efficiency counters for WorkParallelForN "
+    "through libTrace (enable tracing to capture them)");
+
+bool
+WorkGetLoopMetricsEnabled()
+{
+    static const bool enabled = TfGetEnvSetting(WORK_LOOP_METRICS);
+    return enabled;
+}
+
+void
+Work_ReportLoopMetrics(size_t n, size_t grainSize,
+                       uint64_t busyTicks, uint64_t wallTicks)
+{
+    const double busyMs = ArchTicksToNanoseconds(busyTicks) * 1e-6;
+    const double wallMs = ArchTicksToNanoseconds(wallTicks) * 1e-6;
+
+    TRACE_COUNTER_DELTA("Work loops", 1);
+    TRACE_COUNTER_DELTA("Work loop elements", static_cast<double>(n));
+    TRACE_COUNTER_DELTA("Work loop busy ms", busyMs);
+    TRACE_COUNTER_DELTA("Work loop wall ms", wallMs);
+
+    // Efficiency is the fraction of the machine the loop kept busy: summed
+    // callback time over wall time times the concurrency limit.  Loops too
+    // small to amortize task overhead and loops with too-coarse grains both
+    // show up as low values here.
+    if (wallTicks > 0) {
+        const double efficiency =
+            busyMs / (wallMs * WorkGetConcurrencyLimit());
+        TRACE_COUNTER_VALUE("Work loop efficiency", efficiency);
+    }
+}
+
+size_t
+Work_ComputeAdaptiveGrainSize(size_t n,
+                              size_t calibrationSize,
+                              uint64_t calibrationTicks)
+{
+    // Target enough work per grain to amortize task scheduling overhead;
+    // 50us is comfortably above TBB's per-task cost without hurting load
+    // balancing on ranges that are large relative to it.
+    static const uint64_t targetGrainNs = 50000;
+
+    uint64_t perElementNs = calibrationSize
+        ? ArchTicksToNanoseconds(calibrationTicks) / calibrationSize : 0;
+    if (perElementNs == 0) {
+        // Too cheap (or too fast) to measure; treat as 1ns per element so
+        // very cheap loops still get coarse grains.
+        perElementNs = 1;
+    }
+
+    size_t grainSize = static_cast<size_t>(targetGrainNs / perElementNs);
+    if (grainSize < 1) {
+        grainSize = 1;
+    }
+
+    // Keep at least a few grains per thread available so the scheduler can
+    // balance uneven per-element costs across the machine.
+    const size_t maxGrainSize = n / (WorkGetConcurrencyLimit() * 4);
+    if (maxGrainSize >= 1 && grainSize > maxGrainSize) {
+        grainSize = maxGrainSize;
+    }
+
+    return grainSize;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
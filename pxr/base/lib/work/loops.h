@@ -26,6 +26,8 @@
 
 /// \file work/loops.h
 #include "pxr/pxr.h"
+#include "pxr/base/arch/hints.h"
+#include "pxr/base/arch/timing.h"
 #include "pxr/base/work/threadLimits.h"
 #include "pxr/base/work/api.h"
 
@@ -34,8 +36,41 @@
 #include <tbb/parallel_for_each.h>
 #include <tbb/task.h>
 
+#include <atomic>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+///////////////////////////////////////////////////////////////////////////////
+///
+/// Loop instrumentation.
+///
+/// When the WORK_LOOP_METRICS env setting is enabled, every WorkParallelForN
+/// loop reports counters through libTrace: loop count, element count, wall
+/// and per-thread busy milliseconds, and the resulting parallel efficiency
+/// (busy time over wall time times the concurrency limit).  Viewing a trace
+/// capture of an instrumented run makes mis-parallelized loops -- too-small
+/// ranges paying task overhead, or too-coarse grains idling threads --
+/// stand out without recompiling call sites.
+
+/// Returns true if per-loop metrics reporting is enabled.
+WORK_API bool WorkGetLoopMetricsEnabled();
+
+/// Reports metrics for one executed loop to libTrace.  \p busyTicks is the
+/// summed tick time spent inside the loop callback across all threads and
+/// \p wallTicks the loop's elapsed tick time.  Implementation detail of
+/// WorkParallelForN; not meant to be called directly.
+WORK_API void Work_ReportLoopMetrics(size_t n, size_t grainSize,
+                                     uint64_t busyTicks, uint64_t wallTicks);
+
+/// Computes a grain size for a loop over \p n elements from a serial
+/// calibration run that took \p calibrationTicks over \p calibrationSize
+/// elements, targeting grains big enough to amortize task scheduling
+/// overhead while leaving enough grains to occupy and load-balance all
+/// threads.  Implementation detail of WorkParallelForNAdaptive.
+WORK_API size_t Work_ComputeAdaptiveGrainSize(size_t n,
+                                              size_t calibrationSize,
+                                              uint64_t calibrationTicks);
+
 ///////////////////////////////////////////////////////////////////////////////
 ///
 /// WorkSerialForN(size_t n, CallbackType callback)
@@ -101,6 +136,29 @@ WorkParallelForN(size_t n, Fn &&callback, size_t grainSize)
         // In most cases we do not want to inherit cancellation state from the
         // parent context, so we create an isolated task group context.
         tbb::task_group_context ctx(tbb::task_group_context::isolated);
+
+        if (ARCH_UNLIKELY(WorkGetLoopMetricsEnabled())) {
+            // Instrumented run: accumulate the callback's busy time across
+            // threads and report it against the loop's wall time.
+            std::atomic<uint64_t> busyTicks(0);
+            Fn &fn = callback;
+            auto timedCallback = [&fn, &busyTicks](size_t b, size_t e) {
+                const uint64_t start = ArchGetTickTime();
+                std::forward<Fn>(fn)(b, e);
+                busyTicks += ArchGetTickTime() - start;
+            };
+            auto rangeAdapter =
+                [&timedCallback](const tbb::blocked_range<size_t> &r) {
+                    timedCallback(r.begin(), r.end());
+                };
+            const uint64_t wallStart = ArchGetTickTime();
+            tbb::parallel_for(tbb::blocked_range<size_t>(0,n,grainSize),
+                              rangeAdapter, ctx);
+            Work_ReportLoopMetrics(n, grainSize, busyTicks,
+                                   ArchGetTickTime() - wallStart);
+            return;
+        }
+
         tbb::parallel_for(tbb::blocked_range<size_t>(0,n,grainSize),
             Work_ParallelForN_TBB(callback),
             ctx);
@@ -131,6 +189,60 @@ WorkParallelForN(size_t n, Fn &&callback)
     WorkParallelForN(n, std::forward<Fn>(callback), 1);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+///
+/// WorkParallelForNAdaptive(size_t n, CallbackType callback)
+///
+/// Like WorkParallelForN, but instead of taking a caller-supplied grain
+/// size, calibrates one at runtime: a small prefix of the range is run
+/// serially and timed, and the measured per-element cost determines a grain
+/// size that amortizes task scheduling overhead without starving threads of
+/// grains to balance.  Use this for loops whose per-element cost varies too
+/// much across call sites or inputs for a hard-coded grain size -- the same
+/// loop may process four elements or four million, or elements that cost
+/// nanoseconds or milliseconds.
+///
+/// Callback must be of the form:
+///
+///     void LoopCallback(size_t begin, size_t end);
+///
+/// and must be safe to invoke serially for the calibration prefix before
+/// the parallel run over the remainder.
+///
+template <typename Fn>
+void
+WorkParallelForNAdaptive(size_t n, Fn &&callback)
+{
+    if (n == 0)
+        return;
+
+    if (WorkGetConcurrencyLimit() <= 1) {
+        WorkSerialForN(n, std::forward<Fn>(callback));
+        return;
+    }
+
+    // Time a small serial prefix to estimate per-element cost.
+    const size_t calibrationSize = n < 32 ? n : 32;
+    const uint64_t calibrationStart = ArchGetTickTime();
+    callback(0, calibrationSize);
+    const uint64_t calibrationTicks = ArchGetTickTime() - calibrationStart;
+
+    const size_t remaining = n - calibrationSize;
+    if (remaining == 0)
+        return;
+
+    const size_t grainSize = Work_ComputeAdaptiveGrainSize(
+        remaining, calibrationSize, calibrationTicks);
+
+    Fn &fn = callback;
+    WorkParallelForN(
+        remaining,
+        [&fn, calibrationSize](size_t b, size_t e) {
+            std::forward<Fn>(fn)(b + calibrationSize, e + calibrationSize);
+        },
+        grainSize);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///
 /// WorkParallelForEach(Iterator first, Iterator last, CallbackType callback)
@@ -0,0 +1,226 @@
+//
+// Copyright 2018 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef WORK_SCAN_H
+#define WORK_SCAN_H
+
+/// \file work/scan.h
+#include "pxr/pxr.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/threadLimits.h"
+#include "pxr/base/work/api.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// Scans of fewer elements than this run serially; below this size the
+// second pass over the data costs more than the parallelism recovers.
+constexpr size_t Work_ScanSerialThreshold = 16384;
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// WorkParallelExclusiveScan(first, n, result, identity, op)
+///
+/// Computes an exclusive prefix scan of the \p n elements starting at
+/// \p first, writing the results to the range starting at \p result:
+/// result[i] receives the reduction under \p op of \p identity and the
+/// first i input elements, so result[0] == identity.  Returns the
+/// reduction of all \p n elements, i.e. the value result[n] would have
+/// had.  \p result may equal \p first for an in-place scan.
+///
+/// \p op must be an associative binary operation of the form
+///
+///     V Op(const V &lhs, const V &rhs);
+///
+/// with \p identity as its identity element.  Both iterators must be
+/// random access.  The typical use is converting per-element counts to
+/// offsets, e.g. building index-buffer offset tables from per-face vertex
+/// counts:
+///
+/// ```{.cpp}
+/// std::vector<int> offsets(numFaces);
+/// int total = WorkParallelExclusiveScan(
+///     counts.begin(), numFaces, offsets.begin(), 0, std::plus<int>());
+/// ```
+///
+/// The implementation is a blocked two-pass scan: a parallel pass reduces
+/// each block, a serial scan over the (few) block sums assigns each block
+/// its starting value, and a second parallel pass scans each block.  The
+/// input is therefore read twice; for small ranges the scan runs serially.
+///
+template <typename InputIterator, typename OutputIterator,
+          typename V, typename Op>
+V
+WorkParallelExclusiveScan(
+    InputIterator first,
+    size_t n,
+    OutputIterator result,
+    V identity,
+    Op op)
+{
+    if (n == 0) {
+        return identity;
+    }
+
+    if (n < Work_ScanSerialThreshold || WorkGetConcurrencyLimit() <= 1) {
+        V running = identity;
+        for (size_t i = 0; i != n; ++i) {
+            // Read before writing so that in-place scans work.
+            V elem = first[i];
+            result[i] = running;
+            running = op(running, elem);
+        }
+        return running;
+    }
+
+    // Block the range so that every thread gets a few blocks to balance
+    // load, while keeping the serial scan over block sums negligible.
+    const size_t numBlocks = std::min<size_t>(
+        WorkGetConcurrencyLimit() * 4,
+        n / (Work_ScanSerialThreshold / 16));
+    const size_t blockSize = (n + numBlocks - 1) / numBlocks;
+
+    // First pass: reduce each block.
+    std::vector<V> blockSums(numBlocks, identity);
+    WorkParallelForN(
+        numBlocks,
+        [first, n, blockSize, &blockSums, &identity, &op](size_t b, size_t e) {
+            for (size_t block = b; block != e; ++block) {
+                const size_t lo = block * blockSize;
+                const size_t hi = std::min(lo + blockSize, n);
+                V sum = identity;
+                for (size_t i = lo; i != hi; ++i) {
+                    sum = op(sum, first[i]);
+                }
+                blockSums[block] = sum;
+            }
+        });
+
+    // Serially scan the block sums to get each block's starting value.
+    V running = identity;
+    for (size_t block = 0; block != numBlocks; ++block) {
+        V sum = blockSums[block];
+        blockSums[block] = running;
+        running = op(running, sum);
+    }
+
+    // Second pass: scan within each block, seeded with its starting value.
+    WorkParallelForN(
+        numBlocks,
+        [first, result, n, blockSize, &blockSums, &op](size_t b, size_t e) {
+            for (size_t block = b; block != e; ++block) {
+                const size_t lo = block * blockSize;
+                const size_t hi = std::min(lo + blockSize, n);
+                V blockRunning = blockSums[block];
+                for (size_t i = lo; i != hi; ++i) {
+                    V elem = first[i];
+                    result[i] = blockRunning;
+                    blockRunning = op(blockRunning, elem);
+                }
+            }
+        });
+
+    return running;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// WorkParallelInclusiveScan(first, n, result, identity, op)
+///
+/// Like WorkParallelExclusiveScan, but result[i] receives the reduction of
+/// the first i+1 input elements, so result[n-1] holds the total, which is
+/// also returned.  \p result may equal \p first for an in-place scan.
+///
+template <typename InputIterator, typename OutputIterator,
+          typename V, typename Op>
+V
+WorkParallelInclusiveScan(
+    InputIterator first,
+    size_t n,
+    OutputIterator result,
+    V identity,
+    Op op)
+{
+    if (n == 0) {
+        return identity;
+    }
+
+    if (n < Work_ScanSerialThreshold || WorkGetConcurrencyLimit() <= 1) {
+        V running = identity;
+        for (size_t i = 0; i != n; ++i) {
+            running = op(running, first[i]);
+            result[i] = running;
+        }
+        return running;
+    }
+
+    const size_t numBlocks = std::min<size_t>(
+        WorkGetConcurrencyLimit() * 4,
+        n / (Work_ScanSerialThreshold / 16));
+    const size_t blockSize = (n + numBlocks - 1) / numBlocks;
+
+    std::vector<V> blockSums(numBlocks, identity);
+    WorkParallelForN(
+        numBlocks,
+        [first, n, blockSize, &blockSums, &identity, &op](size_t b, size_t e) {
+            for (size_t block = b; block != e; ++block) {
+                const size_t lo = block * blockSize;
+                const size_t hi = std::min(lo + blockSize, n);
+                V sum = identity;
+                for (size_t i = lo; i != hi; ++i) {
+                    sum = op(sum, first[i]);
+                }
+                blockSums[block] = sum;
+            }
+        });
+
+    V running = identity;
+    for (size_t block = 0; block != numBlocks; ++block) {
+        V sum = blockSums[block];
+        blockSums[block] = running;
+        running = op(running, sum);
+    }
+
+    WorkParallelForN(
+        numBlocks,
+        [first, result, n, blockSize, &blockSums, &op](size_t b, size_t e) {
+            for (size_t block = b; block != e; ++block) {
+                const size_t lo = block * blockSize;
+                const size_t hi = std::min(lo + blockSize, n);
+                V blockRunning = blockSums[block];
+                for (size_t i = lo; i != hi; ++i) {
+                    blockRunning = op(blockRunning, first[i]);
+                    result[i] = blockRunning;
+                }
+            }
+        });
+
+    return running;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // WORK_SCAN_H
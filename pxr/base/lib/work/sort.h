@@ -25,10 +25,15 @@
 #define WORK_SORT_H
 
 /// \file work/sort.h
+#include "pxr/base/work/loops.h"
 #include "pxr/base/work/threadLimits.h"
 
 #include <tbb/parallel_sort.h>
 #include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -52,6 +57,169 @@ WorkParallelSort(C* container)
     }
 }
 
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// WorkParallelRadixSort(std::vector<T>* v, KeyFn keyFn)
+///
+/// Sorts \p *v in-place by the 64-bit unsigned keys produced by \p keyFn,
+/// using a parallel least-significant-digit radix sort.  The sort is stable
+/// with respect to equal keys.  For large vectors of elements with cheap
+/// integer keys -- object identifiers, hashes, or pointer-derived keys such
+/// as those used to order SdfPaths -- this substantially outperforms
+/// comparison sorting.
+///
+/// \p keyFn is invoked once per element.  T must be default-constructible
+/// and movable.  Small inputs and single-threaded configurations fall back
+/// to a comparison sort on the keys.
+///
+template <typename T, typename KeyFn>
+void
+WorkParallelRadixSort(std::vector<T>* v, KeyFn keyFn)
+{
+    const size_t n = v->size();
+
+    // For small inputs the bookkeeping is not worth it; sort by key
+    // directly.  This also covers concurrency limited to 1, where the
+    // histogram passes would only add overhead.
+    if (n < 4096 || WorkGetConcurrencyLimit() <= 1) {
+        std::stable_sort(v->begin(), v->end(),
+                         [&keyFn](const T& lhs, const T& rhs) {
+                             return keyFn(lhs) < keyFn(rhs);
+                         });
+        return;
+    }
+
+    // Compute the keys once, up front and in parallel; key computation may
+    // be arbitrarily expensive and each pass below only permutes them.
+    std::vector<uint64_t> keys(n);
+    {
+        const T* data = v->data();
+        uint64_t* keyData = keys.data();
+        WorkParallelForN(
+            n,
+            [data, keyData, &keyFn](size_t begin, size_t end) {
+                for (size_t i = begin; i != end; ++i) {
+                    keyData[i] = keyFn(data[i]);
+                }
+            });
+    }
+
+    static const size_t bitsPerPass = 8;
+    static const size_t numBuckets = 1 << bitsPerPass;
+    static const size_t numPasses = 64 / bitsPerPass;
+
+    // Partition the input into contiguous chunks; each chunk builds its own
+    // histogram so the scatter pass can proceed without synchronization
+    // while remaining stable.
+    const size_t numChunks =
+        std::min<size_t>(WorkGetConcurrencyLimit(), 1 + n / 4096);
+    const size_t chunkSize = (n + numChunks - 1) / numChunks;
+
+    std::vector<T> tmpValues(n);
+    std::vector<uint64_t> tmpKeys(n);
+    std::vector<size_t> histograms(numChunks * numBuckets);
+
+    std::vector<T>* srcValues = v;
+    std::vector<T>* dstValues = &tmpValues;
+    std::vector<uint64_t>* srcKeys = &keys;
+    std::vector<uint64_t>* dstKeys = &tmpKeys;
+
+    for (size_t pass = 0; pass != numPasses; ++pass) {
+        const size_t shift = pass * bitsPerPass;
+        const uint64_t* srcKeyData = srcKeys->data();
+
+        // Histogram each chunk in parallel.
+        std::fill(histograms.begin(), histograms.end(), 0);
+        size_t* histogramData = histograms.data();
+        WorkParallelForN(
+            numChunks,
+            [n, chunkSize, shift, srcKeyData, histogramData](
+                size_t begin, size_t end) {
+                for (size_t c = begin; c != end; ++c) {
+                    size_t* histogram = histogramData + c * numBuckets;
+                    const size_t lo = c * chunkSize;
+                    const size_t hi = std::min(lo + chunkSize, n);
+                    for (size_t i = lo; i != hi; ++i) {
+                        ++histogram[(srcKeyData[i] >> shift) & 
+                                    (numBuckets - 1)];
+                    }
+                }
+            });
+
+        // Exclusive scan over buckets (outer) and chunks (inner), giving
+        // each chunk its starting offset for each bucket.  If all keys
+        // fall into a single bucket the pass would be the identity
+        // permutation, so skip it.
+        size_t total = 0;
+        bool singleBucket = false;
+        for (size_t b = 0; b != numBuckets; ++b) {
+            for (size_t c = 0; c != numChunks; ++c) {
+                size_t& count = histogramData[c * numBuckets + b];
+                if (count == n) {
+                    singleBucket = true;
+                }
+                const size_t offset = total;
+                total += count;
+                count = offset;
+            }
+        }
+        if (singleBucket) {
+            continue;
+        }
+
+        // Scatter each chunk in parallel.
+        T* srcValueData = srcValues->data();
+        T* dstValueData = dstValues->data();
+        uint64_t* dstKeyData = dstKeys->data();
+        WorkParallelForN(
+            numChunks,
+            [n, chunkSize, shift, srcKeyData, srcValueData,
+             dstKeyData, dstValueData, histogramData](
+                size_t begin, size_t end) {
+                for (size_t c = begin; c != end; ++c) {
+                    size_t* histogram = histogramData + c * numBuckets;
+                    const size_t lo = c * chunkSize;
+                    const size_t hi = std::min(lo + chunkSize, n);
+                    for (size_t i = lo; i != hi; ++i) {
+                        const size_t dst =
+                            histogram[(srcKeyData[i] >> shift) &
+                                      (numBuckets - 1)]++;
+                        dstKeyData[dst] = srcKeyData[i];
+                        dstValueData[dst] = std::move(srcValueData[i]);
+                    }
+                }
+            });
+
+        std::swap(srcValues, dstValues);
+        std::swap(srcKeys, dstKeys);
+    }
+
+    // After an even number of performed passes the result may live in the
+    // temporary buffer; move it back.
+    if (srcValues != v) {
+        *v = std::move(*srcValues);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// WorkParallelRadixSort(std::vector<T>* v)
+///
+/// Overload for vectors of unsigned integral values, sorted by value.
+///
+template <typename T>
+void
+WorkParallelRadixSort(std::vector<T>* v)
+{
+    static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
+                  "WorkParallelRadixSort without a key function requires "
+                  "unsigned integral values");
+    WorkParallelRadixSort(v, [](T value) {
+        return static_cast<uint64_t>(value);
+    });
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif // WORK_SORT_H
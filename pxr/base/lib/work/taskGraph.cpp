@@ -0,0 +1,121 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/taskGraph.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+WorkTaskGraph::WorkTaskGraph()
+    : _numCompleted(0)
+    , _cancelled(false)
+{
+}
+
+WorkTaskGraph::~WorkTaskGraph()
+{
+    _dispatcher.Wait();
+}
+
+void
+WorkTaskGraph::AddDependency(TaskId task, TaskId dependsOn)
+{
+    if (!TF_VERIFY(task < _tasks.size() && dependsOn < _tasks.size())) {
+        return;
+    }
+    if (!TF_VERIFY(task != dependsOn, "A task may not depend on itself")) {
+        return;
+    }
+    _tasks[dependsOn].successors.push_back(task);
+    _tasks[task].numUnfinishedDeps.fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+WorkTaskGraph::RunAndWait()
+{
+    // Gather the tasks that are runnable at the outset before spawning any
+    // of them.  Gathering first is important: once a task is spawned it may
+    // complete and spawn a successor whose dependency count has dropped to
+    // zero, and that successor must not also be spawned by this loop.
+    const size_t numTasks = _tasks.size();
+    std::vector<TaskId> initiallyRunnable;
+    for (TaskId id = 0; id != numTasks; ++id) {
+        if (_tasks[id].numUnfinishedDeps.load(std::memory_order_relaxed)
+            == 0) {
+            initiallyRunnable.push_back(id);
+        }
+    }
+    for (TaskId id : initiallyRunnable) {
+        _dispatcher.Run(&WorkTaskGraph::_RunTask, this, id);
+    }
+
+    // The remaining tasks are spawned by their final dependency as it
+    // completes.
+
+    _dispatcher.Wait();
+
+    // Every task should have run exactly once.  If some have not, the
+    // declared dependencies must contain a cycle.
+    if (!_cancelled.load(std::memory_order_relaxed) &&
+        _numCompleted.load(std::memory_order_relaxed) != numTasks) {
+        TF_CODING_ERROR("WorkTaskGraph dependencies contain a cycle; "
+                        "%zu of %zu tasks did not run",
+                        numTasks -
+                        _numCompleted.load(std::memory_order_relaxed),
+                        numTasks);
+    }
+}
+
+void
+WorkTaskGraph::Cancel()
+{
+    _cancelled.store(true, std::memory_order_relaxed);
+    _dispatcher.Cancel();
+}
+
+void
+WorkTaskGraph::_RunTask(TaskId id)
+{
+    _Task &task = _tasks[id];
+
+    if (!_cancelled.load(std::memory_order_relaxed)) {
+        task.fn();
+    }
+
+    _numCompleted.fetch_add(1, std::memory_order_relaxed);
+
+    // Release our hold on each successor; the thread that releases the last
+    // dependency spawns the successor, keeping it on a warm worker thread
+    // when possible.
+    for (TaskId successor : task.successors) {
+        if (_tasks[successor].numUnfinishedDeps.fetch_sub(
+                1, std::memory_order_acq_rel) == 1) {
+            _dispatcher.Run(&WorkTaskGraph::_RunTask, this, successor);
+        }
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
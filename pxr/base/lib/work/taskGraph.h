@@ -0,0 +1,165 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef WORK_TASK_GRAPH_H
+#define WORK_TASK_GRAPH_H
+
+/// \file work/taskGraph.h
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/api.h"
+#include "pxr/base/work/dispatcher.h"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class WorkTaskGraph
+///
+/// A WorkTaskGraph runs a set of tasks with explicit dependencies between
+/// them.  Tasks are added with AddTask() and ordering constraints are
+/// declared with AddDependency().  RunAndWait() then schedules tasks onto
+/// the work-stealing scheduler underlying WorkDispatcher: a task becomes
+/// runnable as soon as all of its dependencies have completed, so
+/// independent subgraphs execute concurrently without any client-side
+/// coordination.
+///
+/// This suits problems where the dependency structure is known up front but
+/// is not a simple fork/join tree -- for example, computing a set of
+/// results where some results consume others.  For purely hierarchical
+/// parallelism, prefer WorkDispatcher, which has less overhead.
+///
+/// For example,
+///
+/// \code
+/// WorkTaskGraph graph;
+/// WorkTaskGraph::TaskId a = graph.AddTask(ComputeA);
+/// WorkTaskGraph::TaskId b = graph.AddTask(ComputeB);
+/// WorkTaskGraph::TaskId c = graph.AddTask(CombineAB);
+/// graph.AddDependency(c, a);
+/// graph.AddDependency(c, b);
+/// graph.RunAndWait();
+/// \endcode
+///
+/// The graph must be fully constructed before RunAndWait() is invoked;
+/// AddTask() and AddDependency() are not thread-safe and must not be called
+/// while the graph is running.  A graph may be run only once.
+///
+class WorkTaskGraph
+{
+public:
+    /// An identifier for a task added to the graph.
+    typedef size_t TaskId;
+
+    /// Construct a new task graph.
+    WORK_API WorkTaskGraph();
+
+    /// Destroy the task graph.  Any tasks still running are waited upon.
+    WORK_API ~WorkTaskGraph();
+
+    WorkTaskGraph(WorkTaskGraph const &) = delete;
+    WorkTaskGraph &operator=(WorkTaskGraph const &) = delete;
+
+    /// Add a task to the graph and return its identifier.  The task will
+    /// not run before RunAndWait() is invoked.
+    template <class Callable>
+    TaskId AddTask(Callable &&c) {
+        const TaskId id = _tasks.size();
+        _tasks.emplace_back(std::forward<Callable>(c));
+        return id;
+    }
+
+    /// \overload
+    template <class Callable, class A0, class ... Args>
+    TaskId AddTask(Callable &&c, A0 &&a0, Args&&... args) {
+        return AddTask(std::bind(std::forward<Callable>(c),
+                                 std::forward<A0>(a0),
+                                 std::forward<Args>(args)...));
+    }
+
+    /// Declare that \p task must not run until \p dependsOn has completed.
+    /// Both identifiers must have been returned by AddTask() on this graph.
+    /// Duplicate dependencies are permitted but wasteful.
+    WORK_API void AddDependency(TaskId task, TaskId dependsOn);
+
+    /// Run all tasks, respecting the declared dependencies, and block until
+    /// they have completed.  Diagnostics issued by tasks are transported
+    /// back to this thread, as with WorkDispatcher.
+    ///
+    /// If the declared dependencies form a cycle, the tasks on the cycle
+    /// (and their transitive dependents) are not run, and a coding error is
+    /// issued.
+    WORK_API void RunAndWait();
+
+    /// Cancel remaining work and return immediately.  Tasks that have not
+    /// yet started will not run.  This call does not block; call
+    /// RunAndWait()'s caller may still be blocked until running tasks
+    /// complete.
+    WORK_API void Cancel();
+
+private:
+    struct _Task {
+        template <class Callable>
+        explicit _Task(Callable &&c)
+            : fn(std::forward<Callable>(c))
+            , numUnfinishedDeps(0)
+        { }
+
+        _Task(_Task &&other)
+            : fn(std::move(other.fn))
+            , successors(std::move(other.successors))
+            , numUnfinishedDeps(other.numUnfinishedDeps.load())
+        { }
+
+        std::function<void ()> fn;
+        std::vector<TaskId> successors;
+        std::atomic<int> numUnfinishedDeps;
+    };
+
+    // Run the task identified by \p id, then decrement its successors'
+    // dependency counts, spawning any that become runnable.
+    WORK_API void _RunTask(TaskId id);
+
+    // The tasks in the graph.  A deque is used so that AddTask() does not
+    // invalidate references held by running tasks.
+    std::deque<_Task> _tasks;
+
+    // The dispatcher that tasks are scheduled onto.
+    WorkDispatcher _dispatcher;
+
+    // The number of tasks that have completed, used to detect cycles.
+    std::atomic<size_t> _numCompleted;
+
+    // Whether the graph has been cancelled.
+    std::atomic<bool> _cancelled;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // WORK_TASK_GRAPH_H
@@ -0,0 +1,141 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/cancellationToken.h"
+
+#include "pxr/base/work/dispatcher.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/threadLimits.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+#include <atomic>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Copies share cancellation state; Reset() detaches from it.
+static void
+_TestSharedState()
+{
+    WorkCancellationToken token;
+    TF_AXIOM(!token.IsCanceled());
+
+    WorkCancellationToken copy = token;
+    token.Cancel();
+    TF_AXIOM(token.IsCanceled());
+    TF_AXIOM(copy.IsCanceled());
+
+    token.Reset();
+    TF_AXIOM(!token.IsCanceled());
+
+    // The copy still observes the old, canceled state, and canceling it
+    // again does not leak into the fresh state.
+    TF_AXIOM(copy.IsCanceled());
+    copy.Cancel();
+    TF_AXIOM(!token.IsCanceled());
+}
+
+// Canceling mid-loop makes subsequent iterations skip their work, while
+// iterations that ran before the cancellation are unaffected.
+static void
+_TestCancelFromParallelLoop()
+{
+    const size_t numElements = 100000;
+    const size_t cancelAt = numElements / 2;
+
+    WorkCancellationToken token;
+    std::atomic<size_t> numProcessed(0);
+
+    WorkParallelForN(
+        numElements,
+        [&token, &numProcessed, cancelAt](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (token.IsCanceled()) {
+                    continue;
+                }
+                if (i == cancelAt) {
+                    token.Cancel();
+                }
+                ++numProcessed;
+            }
+        });
+
+    TF_AXIOM(token.IsCanceled());
+    TF_AXIOM(numProcessed < numElements);
+}
+
+// Canceling from another thread via a copy stops tasks polling the
+// original token.
+static void
+_TestCancelAcrossDispatcher()
+{
+    WorkCancellationToken token;
+    std::atomic<size_t> numProcessed(0);
+
+    WorkDispatcher dispatcher;
+    for (size_t i = 0; i < 100; ++i) {
+        dispatcher.Run([&token, &numProcessed]() {
+            if (!token.IsCanceled()) {
+                ++numProcessed;
+            }
+        });
+    }
+    WorkCancellationToken copy = token;
+    dispatcher.Run([copy]() { copy.Cancel(); });
+    dispatcher.Wait();
+
+    TF_AXIOM(token.IsCanceled());
+}
+
+// The priority lanes are pure scheduling hints; verify dispatchers built
+// for each lane still run their work to completion.
+static void
+_TestPriorityLanes()
+{
+    for (WorkPriority priority: { WorkPriorityBackground,
+                                  WorkPriorityDefault,
+                                  WorkPriorityInteractive }) {
+        std::atomic<size_t> numRun(0);
+        WorkDispatcher dispatcher(priority);
+        for (size_t i = 0; i < 100; ++i) {
+            dispatcher.Run([&numRun]() { ++numRun; });
+        }
+        dispatcher.Wait();
+        TF_AXIOM(numRun == 100);
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    WorkSetMaximumConcurrencyLimit();
+
+    _TestSharedState();
+    _TestCancelFromParallelLoop();
+    _TestCancelAcrossDispatcher();
+    _TestPriorityLanes();
+
+    return 0;
+}
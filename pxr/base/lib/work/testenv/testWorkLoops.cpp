@@ -132,6 +132,19 @@ _DoTBBTestForEach(
     return sw.GetSeconds();
 }
 
+void
+_DoAdaptiveTest()
+{
+    // Cover ranges smaller than, equal to, and larger than the calibration
+    // prefix so both the serial-only and calibrate-then-parallel paths run.
+    for (size_t n : {size_t(5), size_t(32), size_t(100000)}) {
+        std::vector<int> v;
+        _PopulateVector(n, &v);
+        WorkParallelForNAdaptive(n, std::bind(&_Double, _1, _2, &v));
+        _VerifyDoubled(v);
+    }
+}
+
 void
 _DoSerialTest()
 {
@@ -190,6 +203,8 @@ main(int argc, char **argv)
         << " seconds" << std::endl;
 
 
+    _DoAdaptiveTest();
+
     _DoSerialTest();
 
     _DoSignatureTest();
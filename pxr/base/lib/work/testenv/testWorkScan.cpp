@@ -0,0 +1,109 @@
+//
+// Copyright 2018 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/scan.h"
+
+#include "pxr/base/work/threadLimits.h"
+#include "pxr/base/tf/diagnostic.h"
+
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Verify against a serial reference scan for a range of sizes spanning the
+// serial threshold and awkward block boundaries.
+static void
+_TestScansOfSize(size_t n)
+{
+    std::vector<int> input(n);
+    for (size_t i = 0; i != n; ++i) {
+        input[i] = int(i % 7) + 1;
+    }
+
+    std::vector<int> expectedExcl(n), expectedIncl(n);
+    int running = 0;
+    for (size_t i = 0; i != n; ++i) {
+        expectedExcl[i] = running;
+        running += input[i];
+        expectedIncl[i] = running;
+    }
+    const int expectedTotal = running;
+
+    std::vector<int> output(n);
+    int total = WorkParallelExclusiveScan(
+        input.begin(), n, output.begin(), 0, std::plus<int>());
+    TF_AXIOM(total == expectedTotal);
+    TF_AXIOM(output == expectedExcl);
+
+    total = WorkParallelInclusiveScan(
+        input.begin(), n, output.begin(), 0, std::plus<int>());
+    TF_AXIOM(total == expectedTotal);
+    TF_AXIOM(output == expectedIncl);
+
+    // In-place scans must read each element before overwriting it.
+    std::vector<int> inPlace = input;
+    total = WorkParallelExclusiveScan(
+        inPlace.begin(), n, inPlace.begin(), 0, std::plus<int>());
+    TF_AXIOM(total == expectedTotal);
+    TF_AXIOM(inPlace == expectedExcl);
+
+    inPlace = input;
+    total = WorkParallelInclusiveScan(
+        inPlace.begin(), n, inPlace.begin(), 0, std::plus<int>());
+    TF_AXIOM(total == expectedTotal);
+    TF_AXIOM(inPlace == expectedIncl);
+}
+
+int
+main(int argc, char **argv)
+{
+    WorkSetMaximumConcurrencyLimit();
+
+    printf("Testing parallel scans with max concurrency...\n");
+
+    // Empty range.
+    std::vector<int> empty;
+    TF_AXIOM(WorkParallelExclusiveScan(
+                 empty.begin(), 0, empty.begin(), 42, std::plus<int>()) == 42);
+    TF_AXIOM(WorkParallelInclusiveScan(
+                 empty.begin(), 0, empty.begin(), 42, std::plus<int>()) == 42);
+
+    const size_t sizes[] = { 1, 2, 1000, 16383, 16384, 16385, 100000, 1<<20 };
+    for (size_t n : sizes) {
+        _TestScansOfSize(n);
+    }
+
+    // Must also work with concurrency limited to 1 (pure serial path).
+    printf("Testing parallel scans with concurrency limit 1...\n");
+    WorkSetConcurrencyLimit(1);
+    for (size_t n : sizes) {
+        _TestScansOfSize(n);
+    }
+
+    printf("Done.\n");
+    return 0;
+}
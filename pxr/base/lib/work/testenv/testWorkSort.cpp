@@ -28,6 +28,7 @@
 #include "pxr/base/work/arenaDispatcher.h"
 #include "pxr/base/work/threadLimits.h"
 
+#include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/stopwatch.h"
 #include "pxr/base/tf/iterator.h"
 #include "pxr/base/tf/staticData.h"
@@ -80,6 +81,38 @@ _DoTBBTest(bool verify, const size_t arraySize, const size_t numIterations)
 }
 
 
+// Verify WorkParallelRadixSort against std::stable_sort for both the
+// integral overload and a key-function sort of a payload-carrying type.
+static void
+_DoRadixTest(const size_t arraySize)
+{
+    std::srand(std::time(NULL));
+
+    std::vector<uint64_t> ids(arraySize);
+    for (size_t i = 0; i < arraySize; ++i) {
+        ids[i] = ((uint64_t)std::rand() << 32) | std::rand();
+    }
+    std::vector<uint64_t> expectedIds = ids;
+    std::sort(expectedIds.begin(), expectedIds.end());
+    WorkParallelRadixSort(&ids);
+    TF_AXIOM(ids == expectedIds);
+
+    typedef std::pair<uint64_t, size_t> _Item;
+    std::vector<_Item> items(arraySize);
+    for (size_t i = 0; i < arraySize; ++i) {
+        items[i] = _Item(std::rand() % 1024, i);
+    }
+    std::vector<_Item> expectedItems = items;
+    std::stable_sort(expectedItems.begin(), expectedItems.end(),
+                     [](const _Item& lhs, const _Item& rhs) {
+                         return lhs.first < rhs.first;
+                     });
+    WorkParallelRadixSort(&items, [](const _Item& item) {
+        return item.first;
+    });
+    TF_AXIOM(items == expectedItems);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -94,6 +127,11 @@ main(int argc, char **argv)
 
     double tbbSeconds = _DoTBBTest(!perfMode, arraySize, numIterations);
 
+    if (!perfMode) {
+        _DoRadixTest(arraySize);
+        _DoRadixTest(100);  // small-input fallback path
+    }
+
     std::cout << "TBB parallel_sort.h took: " << tbbSeconds << " seconds" 
         << std::endl;
 
@@ -0,0 +1,145 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/taskGraph.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/errorMark.h"
+
+#include <atomic>
+#include <cstdio>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// A simple diamond: a -> {b, c} -> d.  Verify that d observes the results
+// of b and c, which in turn observe the result of a.
+static void
+TestDiamond()
+{
+    printf("Testing diamond dependency graph...\n");
+
+    int a = 0, b = 0, c = 0, d = 0;
+
+    WorkTaskGraph graph;
+    WorkTaskGraph::TaskId ta = graph.AddTask([&a]() { a = 1; });
+    WorkTaskGraph::TaskId tb = graph.AddTask([&a, &b]() { b = a + 1; });
+    WorkTaskGraph::TaskId tc = graph.AddTask([&a, &c]() { c = a + 10; });
+    WorkTaskGraph::TaskId td = graph.AddTask([&b, &c, &d]() { d = b + c; });
+    graph.AddDependency(tb, ta);
+    graph.AddDependency(tc, ta);
+    graph.AddDependency(td, tb);
+    graph.AddDependency(td, tc);
+    graph.RunAndWait();
+
+    TF_AXIOM(a == 1);
+    TF_AXIOM(b == 2);
+    TF_AXIOM(c == 11);
+    TF_AXIOM(d == 13);
+}
+
+// A long chain must run strictly in order.
+static void
+TestChain()
+{
+    printf("Testing chain of dependent tasks...\n");
+
+    const size_t numTasks = 1000;
+    std::atomic<size_t> counter(0);
+
+    WorkTaskGraph graph;
+    WorkTaskGraph::TaskId prev = graph.AddTask([&counter]() {
+        TF_AXIOM(counter.fetch_add(1) == 0);
+    });
+    for (size_t i = 1; i != numTasks; ++i) {
+        WorkTaskGraph::TaskId cur = graph.AddTask([&counter, i]() {
+            TF_AXIOM(counter.fetch_add(1) == i);
+        });
+        graph.AddDependency(cur, prev);
+        prev = cur;
+    }
+    graph.RunAndWait();
+
+    TF_AXIOM(counter == numTasks);
+}
+
+// Many independent tasks all feeding a single reduction task.
+static void
+TestFanIn()
+{
+    printf("Testing fan-in...\n");
+
+    const size_t numProducers = 512;
+    std::atomic<size_t> numProduced(0);
+    size_t observed = 0;
+
+    WorkTaskGraph graph;
+    WorkTaskGraph::TaskId consumer = graph.AddTask(
+        [&numProduced, &observed]() {
+            observed = numProduced.load();
+        });
+    for (size_t i = 0; i != numProducers; ++i) {
+        WorkTaskGraph::TaskId producer = graph.AddTask([&numProduced]() {
+            numProduced.fetch_add(1);
+        });
+        graph.AddDependency(consumer, producer);
+    }
+    graph.RunAndWait();
+
+    TF_AXIOM(observed == numProducers);
+}
+
+// A cycle should produce a coding error and not hang.
+static void
+TestCycle()
+{
+    printf("Testing cycle detection...\n");
+
+    bool ranA = false, ranB = false;
+
+    WorkTaskGraph graph;
+    WorkTaskGraph::TaskId ta = graph.AddTask([&ranA]() { ranA = true; });
+    WorkTaskGraph::TaskId tb = graph.AddTask([&ranB]() { ranB = true; });
+    graph.AddDependency(ta, tb);
+    graph.AddDependency(tb, ta);
+
+    TfErrorMark m;
+    graph.RunAndWait();
+    TF_AXIOM(!m.IsClean());
+    m.Clear();
+
+    TF_AXIOM(!ranA && !ranB);
+}
+
+int
+main()
+{
+    TestDiamond();
+    TestChain();
+    TestFanIn();
+    TestCycle();
+
+    printf("Done.\n");
+    return 0;
+}
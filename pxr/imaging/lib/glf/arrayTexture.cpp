@@ -33,6 +33,9 @@
 #include "pxr/base/tf/registryManager.h"
 #include "pxr/base/tf/type.h"
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
+
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -121,14 +124,27 @@ GlfArrayTexture::_ReadTexture()
     GlfBaseTextureDataConstRefPtrVector texDataVec(_arraySize, 0);
     size_t targetMemory = GetMemoryRequested();
 
+    // Reading a slice is pure cpu-side decode and conversion, so read all
+    // the slices concurrently before touching any GL state.
+    std::vector<GlfUVTextureDataRefPtr> texDatas(_arraySize);
     for (size_t i = 0; i < _arraySize; ++i) {
-        GlfUVTextureDataRefPtr texData =
+        texDatas[i] =
             GlfUVTextureData::New(_GetImageFilePath(i), targetMemory,
                                   _GetCropTop(), _GetCropBottom(),
                                   _GetCropLeft(), _GetCropRight());
-        if (texData) {
-            texData->Read(0, _GenerateMipmap(), GetOriginLocation());
-        }
+    }
+    WorkParallelForN(_arraySize,
+        [this, &texDatas](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (texDatas[i]) {
+                    texDatas[i]->Read(0, _GenerateMipmap(),
+                                      GetOriginLocation());
+                }
+            }
+        });
+
+    for (size_t i = 0; i < _arraySize; ++i) {
+        GlfUVTextureDataRefPtr texData = texDatas[i];
 
         _UpdateTexture(texData);
 
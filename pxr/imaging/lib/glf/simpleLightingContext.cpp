@@ -89,6 +89,10 @@ GlfSimpleLightingContext::~GlfSimpleLightingContext()
 void
 GlfSimpleLightingContext::SetLights(GlfSimpleLightVector const & lights)
 {
+    if (_lights == lights) {
+        return;
+    }
+
     _lights = lights;
     _lightingUniformBlockValid = false;
     _shadowUniformBlockValid = false;
@@ -363,18 +367,65 @@ GlfSimpleLightingContext::BindUniformBlocks(GlfBindingMapPtr const &bindingMap)
             }
         }
 
-        _lightingUniformBlock->Update(lightingData, lightingSize);
+        // Avoid re-uploading lights that did not change: when the block
+        // layout is unchanged, compare each packed light source against
+        // the copy from the previous upload and update only the entries
+        // that differ.
+        if (_lightingUniformBlockData.size() != lightingSize) {
+            _lightingUniformBlock->Update(lightingData, lightingSize);
+            _lightingUniformBlockData.assign(
+                (char const*)lightingData,
+                (char const*)lightingData + lightingSize);
+        } else {
+            char const * const newData = (char const*)lightingData;
+            char * const oldData = _lightingUniformBlockData.data();
+            size_t const headerSize = sizeof(Lighting);
+            if (memcmp(oldData, newData, headerSize) != 0) {
+                _lightingUniformBlock->UpdateRange(newData, 0, headerSize);
+                memcpy(oldData, newData, headerSize);
+            }
+            for (int i = 0; i < numLights; ++i) {
+                size_t const offset = headerSize + i * sizeof(LightSource);
+                if (memcmp(oldData + offset, newData + offset,
+                           sizeof(LightSource)) != 0) {
+                    _lightingUniformBlock->UpdateRange(
+                        newData + offset, offset, sizeof(LightSource));
+                    memcpy(oldData + offset, newData + offset,
+                           sizeof(LightSource));
+                }
+            }
+        }
         _lightingUniformBlockValid = true;
 
         if (shadowExists) {
-            _shadowUniformBlock->Update(shadowData, shadowSize);
+            if (_shadowUniformBlockData.size() != shadowSize) {
+                _shadowUniformBlock->Update(shadowData, shadowSize);
+                _shadowUniformBlockData.assign(
+                    (char const*)shadowData,
+                    (char const*)shadowData + shadowSize);
+            } else {
+                char const * const newData = (char const*)shadowData;
+                char * const oldData = _shadowUniformBlockData.data();
+                for (int i = 0; i < numLights; ++i) {
+                    size_t const offset = i * sizeof(ShadowMatrix);
+                    if (memcmp(oldData + offset, newData + offset,
+                               sizeof(ShadowMatrix)) != 0) {
+                        _shadowUniformBlock->UpdateRange(
+                            newData + offset, offset, sizeof(ShadowMatrix));
+                        memcpy(oldData + offset, newData + offset,
+                               sizeof(ShadowMatrix));
+                    }
+                }
+            }
             _shadowUniformBlockValid = true;
         }
     }
 
     _lightingUniformBlock->Bind(bindingMap, _tokens->lightingUB);
 
-    if (shadowExists) {
+    // Note that this cannot test shadowExists, which stays false when the
+    // uniform blocks were still valid and the repack above was skipped.
+    if (_useShadows) {
         _shadowUniformBlock->Bind(bindingMap, _tokens->shadowUB);
     }
 
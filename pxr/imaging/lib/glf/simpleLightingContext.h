@@ -39,6 +39,8 @@
 #include "pxr/base/tf/refBase.h"
 #include "pxr/base/tf/weakBase.h"
 
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
@@ -137,6 +139,11 @@ private:
     GlfUniformBlockRefPtr _shadowUniformBlock;
     GlfUniformBlockRefPtr _materialUniformBlock;
 
+    // Copies of the packed uniform data from the previous upload, used
+    // to re-upload only the per-light entries that changed.
+    std::vector<char> _lightingUniformBlockData;
+    std::vector<char> _shadowUniformBlockData;
+
     bool _lightingUniformBlockValid;
     bool _shadowUniformBlockValid;
     bool _materialUniformBlockValid;
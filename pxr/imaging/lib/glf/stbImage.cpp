@@ -36,6 +36,7 @@
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/tf/type.h"
+#include "pxr/base/work/loops.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "pxr/imaging/glf/stb/stb_image.h"
@@ -233,17 +234,22 @@ Glf_StbImage::_CropAndResize(void const *sourceData, int const cropTop,
         croppedData = storage.data;
     }
     
-    for (int i = 0; i < cropHeight; i ++)
-    {
-        unsigned char *src = (unsigned char*) sourceData + 
-                             ((cropTop + i) * strideLength) + 
-                             (cropLeft * bpp);
-        unsigned char *dest = (unsigned char *) croppedData + 
-                              (i * croppedStrideLength);
-
-        //memcpy 1 row of data
-        memcpy(dest, src, croppedStrideLength);
-    }
+    // Rows are independent, so copy out the cropped region by scanline
+    // ranges in parallel.
+    WorkParallelForN(cropHeight,
+        [sourceData, croppedData, cropTop, cropLeft, bpp,
+         strideLength, croppedStrideLength](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                unsigned char *src = (unsigned char*) sourceData +
+                                     ((cropTop + i) * strideLength) +
+                                     (cropLeft * bpp);
+                unsigned char *dest = (unsigned char *) croppedData +
+                                      (i * croppedStrideLength);
+
+                //memcpy 1 row of data
+                memcpy(dest, src, croppedStrideLength);
+            }
+        });
 
     if (resizeNeeded) {
         //resize and copy data into storage
@@ -607,9 +613,13 @@ Glf_StbImage::Write(StorageSpec const & storageIn,
         quantizedData.reset(new uint8_t[numElements]);
 
         const float* inData = static_cast<float*>(storageIn.data);
-        for (size_t i = 0; i < numElements; ++i) {
-            quantizedData[i] = _Quantize(inData[i]);
-        }
+        uint8_t* outData = quantizedData.get();
+        WorkParallelForN(numElements,
+            [inData, outData](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    outData[i] = _Quantize(inData[i]);
+                }
+            });
 
         quantizedSpec = storageIn; // shallow copy
         quantizedSpec.data = quantizedData.get();
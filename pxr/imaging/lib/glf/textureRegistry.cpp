@@ -33,11 +33,13 @@
 #include "pxr/usd/ar/resolver.h"
 
 #include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/instantiateSingleton.h"
 #include "pxr/base/tf/stl.h"
 
 #include "pxr/base/trace/trace.h"
 
+#include <algorithm>
 #include <cstdint>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -45,6 +47,17 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 TF_INSTANTIATE_SINGLETON( GlfTextureRegistry );
 
+TF_DEFINE_ENV_SETTING(GLF_TEXTURE_MEMORY_BUDGET, 0,
+                      "Texture memory budget in megabytes. When set, "
+                      "unreferenced textures are kept as a working set and "
+                      "evicted in least-recently-used order once the budget "
+                      "is exceeded; 0 disables the budget.");
+
+TF_DEFINE_ENV_SETTING(GLF_ENABLE_ASYNC_TEXTURE_STREAMING, false,
+                      "Load textures at mip-tail resolution first and "
+                      "stream the full resolution data in from a "
+                      "background thread.");
+
 GlfTextureRegistry &
 GlfTextureRegistry::GetInstance() {
     return TfSingleton<GlfTextureRegistry>::GetInstance();
@@ -52,7 +65,8 @@ GlfTextureRegistry::GetInstance() {
 
 GlfTextureRegistry::GlfTextureRegistry() :
     _typeMap(new GlfRankedTypeMap),
-    _requiresGarbageCollection(false)
+    _requiresGarbageCollection(false),
+    _accessCounter(0)
 {
     TfSingleton<GlfTextureRegistry>::SetInstanceConstructed(*this);
 
@@ -76,11 +90,13 @@ GlfTextureRegistry::GetTextureHandle(const TfToken &texture,
 
     if (it != _textureRegistry.end() && it->second.IsMetadataEqual(md)) {
         textureHandle = it->second.GetHandle();
+        it->second.SetLastAccessed(++_accessCounter);
     } else {
         // if not exists, create it
         textureHandle = _CreateTexture(texture, originLocation);
         if (textureHandle) {
             md.SetHandle(textureHandle);
+            md.SetLastAccessed(++_accessCounter);
             _textureRegistry[std::make_pair(texture, originLocation)] = md;
         }
     }
@@ -112,12 +128,14 @@ GlfTextureRegistry::GetTextureHandle(const TfTokenVector &textures,
     
     if (it != _textureRegistry.end() && it->second.IsMetadataEqual(md)) {
         textureHandle = it->second.GetHandle();
+        it->second.SetLastAccessed(++_accessCounter);
     } else {
         // if not exists, create it
         textureHandle = _CreateTexture(textures, numTextures,
                                        originLocation);
         if (textureHandle) {
             md.SetHandle(textureHandle);
+            md.SetLastAccessed(++_accessCounter);
             _textureRegistry[std::make_pair(texture, originLocation)] = md;
         }
     }
@@ -168,6 +186,7 @@ GlfTextureRegistry::GetTextureHandle(
         _textureRegistry.find(std::make_pair(texture, originLocation));
 
     if (it != _textureRegistry.end() && it->second.IsMetadataEqual(md)) {
+        it->second.SetLastAccessed(++_accessCounter);
         return it->second.GetHandle();
     } else {
         GlfTextureHandleRefPtr textureHandle;
@@ -176,6 +195,7 @@ GlfTextureRegistry::GetTextureHandle(
                                        textureFactory);
         if (textureHandle) {
             md.SetHandle(textureHandle);
+            md.SetLastAccessed(++_accessCounter);
             _textureRegistry[std::make_pair(texture, originLocation)] = md;
         }
         return textureHandle;
@@ -297,34 +317,137 @@ GlfTextureRegistry::RequiresGarbageCollection()
     _requiresGarbageCollection = true;
 }
 
+/* static */
+size_t
+GlfTextureRegistry::GetTextureMemoryBudget()
+{
+    static size_t budget =
+        size_t(TfGetEnvSetting(GLF_TEXTURE_MEMORY_BUDGET)) * 1024 * 1024;
+    return budget;
+}
+
+/* static */
+bool
+GlfTextureRegistry::IsAsyncTextureStreamingEnabled()
+{
+    static bool enabled =
+        TfGetEnvSetting(GLF_ENABLE_ASYNC_TEXTURE_STREAMING);
+    return enabled;
+}
+
+void
+GlfTextureRegistry::QueueAsyncLoad(
+    std::function<std::function<void()>()> const &load)
+{
+    _asyncLoadDispatcher.Run([this, load]() {
+        std::function<void()> commit = load();
+        if (commit) {
+            std::lock_guard<std::mutex> lock(_asyncCommitMutex);
+            _pendingAsyncCommits.push_back(std::move(commit));
+        }
+    });
+}
+
+void
+GlfTextureRegistry::_CommitAsyncLoads()
+{
+    std::vector<std::function<void()>> commits;
+    {
+        std::lock_guard<std::mutex> lock(_asyncCommitMutex);
+        commits.swap(_pendingAsyncCommits);
+    }
+    for (std::function<void()> const &commit : commits) {
+        commit();
+    }
+}
+
+size_t
+GlfTextureRegistry::_GetTotalMemoryUsed() const
+{
+    size_t memoryUsed = 0;
+    for (TextureRegistryMap::value_type const &p : _textureRegistry) {
+        GlfTextureHandlePtr const &handle = p.second.GetHandle();
+        if (handle && handle->GetTexture()) {
+            memoryUsed += handle->GetTexture()->GetMemoryUsed();
+        }
+    }
+    return memoryUsed;
+}
+
+void
+GlfTextureRegistry::_EvictLeastRecentlyUsed(size_t budget)
+{
+    TRACE_FUNCTION();
+
+    size_t memoryUsed = _GetTotalMemoryUsed();
+    if (memoryUsed <= budget) {
+        return;
+    }
+
+    // Gather the evictable entries, i.e. the ones no sampler refers to
+    // anymore, ordered from least to most recently used.
+    std::vector<TextureRegistryMap::iterator> evictable;
+    for (TextureRegistryMap::iterator it = _textureRegistry.begin();
+         it != _textureRegistry.end(); ++it) {
+        const GlfTextureHandleRefPtr &handle = it->second.GetHandle();
+        if (TF_VERIFY(handle) && handle->IsUnique()) {
+            evictable.push_back(it);
+        }
+    }
+    std::sort(evictable.begin(), evictable.end(),
+        [](TextureRegistryMap::iterator const &a,
+           TextureRegistryMap::iterator const &b) {
+            return a->second.GetLastAccessed() < b->second.GetLastAccessed();
+        });
+
+    for (TextureRegistryMap::iterator const &it : evictable) {
+        if (memoryUsed <= budget) {
+            break;
+        }
+        GlfTexturePtr const &texture = it->second.GetHandle()->GetTexture();
+        if (texture) {
+            memoryUsed -= std::min(memoryUsed, texture->GetMemoryUsed());
+        }
+        // TextureHandle (and its GlfTexture) will be released here.
+        _textureRegistry.erase(it);
+    }
+}
+
 void
 GlfTextureRegistry::GarbageCollectIfNeeded()
 {
+    // Finalize async texture loads that have completed since the last call;
+    // this is the per-frame hook that holds the GL context.
+    _CommitAsyncLoads();
+
     // Even if we hold the list of texture handles to be deleted, we have to
     // traverse entire map to remove the entry for them. So simple flag works
     // enough to avoid unnecessary process.
     if (!_requiresGarbageCollection) return;
 
-    // XXX:
-    // Frequent garbage collection causing slow UI when reading textures.
-    // We're freeing and re-loading textures instead of caching them.
-    // 
-    // Can we only garbage collect when GPU memory is high?  Or have a
-    // least-recently-used queue or something?
     TRACE_FUNCTION();
 
-    std::map<std::pair<TfToken, GlfImage::ImageOriginLocation>,
-             _TextureMetadata>::iterator it =
-        _textureRegistry.begin();
-    while (it != _textureRegistry.end()){
-        const GlfTextureHandleRefPtr &handle = it->second.GetHandle();
-
-        // Null handles should not have been added to the registry
-        if (TF_VERIFY(handle) && handle->IsUnique()) {
-            it = _textureRegistry.erase(it);
-            // TextureHandle (and its GlfTexture) will be released here.
-        } else {
-            ++it;
+    const size_t budget = GetTextureMemoryBudget();
+    if (budget > 0) {
+        // With a memory budget set, unreferenced textures are kept as a
+        // working set so they don't have to be re-read from disk when a
+        // sampler picks them up again, and the least recently used ones are
+        // evicted once the budget is exceeded.
+        _EvictLeastRecentlyUsed(budget);
+    } else {
+        std::map<std::pair<TfToken, GlfImage::ImageOriginLocation>,
+                 _TextureMetadata>::iterator it =
+            _textureRegistry.begin();
+        while (it != _textureRegistry.end()){
+            const GlfTextureHandleRefPtr &handle = it->second.GetHandle();
+
+            // Null handles should not have been added to the registry
+            if (TF_VERIFY(handle) && handle->IsUnique()) {
+                it = _textureRegistry.erase(it);
+                // TextureHandle (and its GlfTexture) will be released here.
+            } else {
+                ++it;
+            }
         }
     }
 
@@ -422,6 +545,7 @@ GlfTextureRegistry::_TextureMetadata::_TextureMetadata(
     : _numTextures(numTextures)
     , _fileSize(0)
     , _mtime(0)
+    , _lastAccessed(0)
 {
     TRACE_FUNCTION();
 
@@ -471,5 +595,18 @@ GlfTextureRegistry::_TextureMetadata::SetHandle(
     _handle = handle;
 }
 
+inline size_t
+GlfTextureRegistry::_TextureMetadata::GetLastAccessed() const
+{
+    return _lastAccessed;
+}
+
+inline void
+GlfTextureRegistry::_TextureMetadata::SetLastAccessed(
+    const size_t lastAccessed)
+{
+    _lastAccessed = lastAccessed;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
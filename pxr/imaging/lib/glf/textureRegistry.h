@@ -35,11 +35,14 @@
 #include "pxr/base/tf/token.h"
 #include "pxr/base/tf/weakPtr.h"
 #include "pxr/base/vt/dictionary.h"
+#include "pxr/base/work/dispatcher.h"
 
 #include <boost/noncopyable.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <functional>
 #include <map>
+#include <mutex>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -79,6 +82,28 @@ public:
     GLF_API
     void GarbageCollectIfNeeded();
 
+    /// Returns the texture memory budget in bytes, as configured via
+    /// GLF_TEXTURE_MEMORY_BUDGET. Zero means no budget; garbage collection
+    /// then releases every unreferenced texture as before. With a budget
+    /// set, unreferenced textures are kept as a working set and evicted in
+    /// least-recently-used order once the budget is exceeded.
+    GLF_API
+    static size_t GetTextureMemoryBudget();
+
+    /// Returns true if textures should first be loaded at mip-tail
+    /// resolution with the full resolution data streamed in from a
+    /// background thread. Configured via GLF_ENABLE_ASYNC_TEXTURE_STREAMING.
+    GLF_API
+    static bool IsAsyncTextureStreamingEnabled();
+
+    /// Queues \p load to run on a background thread. The returned function,
+    /// if any, is invoked on the thread that calls GarbageCollectIfNeeded
+    /// (which holds the GL context) once the load has completed, so GL
+    /// resources can be updated with the loaded data there.
+    GLF_API
+    void QueueAsyncLoad(
+        std::function<std::function<void()>()> const &load);
+
     // Returns true if the registry contains a texture sampler for \a texture;
     GLF_API
     bool HasTexture(const TfToken &texture,
@@ -130,6 +155,11 @@ private:
         const GlfTextureHandleRefPtr &GetHandle() const;
         void SetHandle(const GlfTextureHandleRefPtr &handle);
 
+        // Last access stamp, used for least-recently-used eviction when a
+        // texture memory budget is set.
+        size_t GetLastAccessed() const;
+        void SetLastAccessed(size_t lastAccessed);
+
     private:
         _TextureMetadata(const TfToken *textures,
                          const std::uint32_t numTextures);
@@ -137,6 +167,7 @@ private:
         std::uint32_t _numTextures;
         off_t _fileSize;
         double _mtime;
+        size_t _lastAccessed;
         GlfTextureHandleRefPtr _handle;
     };
 
@@ -147,6 +178,15 @@ public:
         TextureRegistryNonSharedMap;
 
 private:
+    // Returns the total GPU memory used by the textures in the registry.
+    size_t _GetTotalMemoryUsed() const;
+
+    // Evicts unreferenced textures in least-recently-used order until the
+    // registry fits the given budget.
+    void _EvictLeastRecentlyUsed(size_t budget);
+
+    // Runs the completions of finished async loads on the calling thread.
+    void _CommitAsyncLoads();
 
     // Map of file extensions to texture types.
     boost::scoped_ptr<GlfRankedTypeMap> _typeMap;
@@ -158,6 +198,16 @@ private:
     TextureRegistryNonSharedMap _textureRegistryNonShared;
 
     bool _requiresGarbageCollection;
+
+    // Monotonic stamp bumped on every texture handle lookup, used to order
+    // entries for least-recently-used eviction.
+    size_t _accessCounter;
+
+    // Background tasks loading texture data, and the completions they
+    // queue to be run on the GL thread.
+    WorkDispatcher _asyncLoadDispatcher;
+    std::mutex _asyncCommitMutex;
+    std::vector<std::function<void()>> _pendingAsyncCommits;
 };
 
 
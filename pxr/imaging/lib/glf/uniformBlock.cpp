@@ -84,5 +84,20 @@ GlfUniformBlock::Update(const void *data, int size)
     glBindBuffer(GL_UNIFORM_BUFFER, 0);
 }
 
+void
+GlfUniformBlock::UpdateRange(const void *data, int offset, int size)
+{
+    GLF_GROUP_FUNCTION();
+
+    if (!TF_VERIFY(offset >= 0 && size >= 0 && offset + size <= _size)) {
+        return;
+    }
+    if (size > 0) {
+        glBindBuffer(GL_UNIFORM_BUFFER, _buffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -62,7 +62,12 @@ public:
     /// is different, the buffer will be reallocated.
     GLF_API
     void Update(const void *data, int size);
-    
+
+    /// Updates a sub-range of the uniform buffer. The range has to lie
+    /// within the size established by a previous call to Update.
+    GLF_API
+    void UpdateRange(const void *data, int offset, int size);
+
 protected:
     GLF_API
     GlfUniformBlock(char const *label);
@@ -28,14 +28,23 @@
 
 #include "pxr/imaging/glf/image.h"
 #include "pxr/imaging/glf/arrayTexture.h"
+#include "pxr/imaging/glf/textureRegistry.h"
 #include "pxr/imaging/glf/uvTexture.h"
 #include "pxr/imaging/glf/uvTextureData.h"
 #include "pxr/imaging/glf/utils.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/registryManager.h"
 #include "pxr/base/tf/type.h"
 
+#include <functional>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(GLF_TEXTURE_MIP_TAIL_LEVELS, 3,
+                      "Number of mip levels to load synchronously when "
+                      "async texture streaming is enabled; the remaining "
+                      "levels are streamed in from a background thread.");
+
 
 // Custom factory to handle UVTexture and ArrayTexture for same types.
 class Glf_UVTextureFactory : public GlfTextureFactoryBase {
@@ -151,6 +160,11 @@ GlfUVTexture::IsMinFilterSupported(GLenum filter)
 void
 GlfUVTexture::_ReadTexture()
 {
+    if (GlfTextureRegistry::IsAsyncTextureStreamingEnabled() &&
+        _ReadTextureStreamed()) {
+        return;
+    }
+
     GlfUVTextureDataRefPtr texData =
         GlfUVTextureData::New(_GetImageFilePath(), GetMemoryRequested(),
                               _GetCropTop(), _GetCropBottom(),
@@ -163,6 +177,68 @@ GlfUVTexture::_ReadTexture()
     _SetLoaded();
 }
 
+bool
+GlfUVTexture::_ReadTextureStreamed()
+{
+    static const int numMipTailLevels =
+        TfGetEnvSetting(GLF_TEXTURE_MIP_TAIL_LEVELS);
+
+    GlfUVTextureDataRefPtr tailData =
+        GlfUVTextureData::New(_GetImageFilePath(), GetMemoryRequested(),
+                              _GetCropTop(), _GetCropBottom(),
+                              _GetCropLeft(), _GetCropRight());
+    if (!tailData ||
+        !tailData->ReadMipTail(numMipTailLevels, GetOriginLocation())) {
+        return false;
+    }
+
+    // Bring the texture up at mip-tail resolution so the first bind doesn't
+    // stall on the full resolution read.
+    _UpdateTexture(tailData);
+    _CreateTexture(tailData, _GenerateMipmap());
+    _SetLoaded();
+
+    // Queue a background load of the full resolution data. The GL texture
+    // is refreshed from it on the GL thread, when the registry commits
+    // completed loads.
+    GlfUVTexturePtr self(this);
+    const TfToken filePath = _GetImageFilePath();
+    const size_t targetMemory = GetMemoryRequested();
+    const unsigned int cropTop = _GetCropTop();
+    const unsigned int cropBottom = _GetCropBottom();
+    const unsigned int cropLeft = _GetCropLeft();
+    const unsigned int cropRight = _GetCropRight();
+    const bool generateMipmap = _GenerateMipmap();
+    const GlfImage::ImageOriginLocation originLocation = GetOriginLocation();
+
+    GlfTextureRegistry::GetInstance().QueueAsyncLoad(
+        [=]() -> std::function<void()> {
+            GlfUVTextureDataRefPtr fullData =
+                GlfUVTextureData::New(filePath, targetMemory,
+                                      cropTop, cropBottom,
+                                      cropLeft, cropRight);
+            if (!fullData ||
+                !fullData->Read(0, generateMipmap, originLocation)) {
+                return std::function<void()>();
+            }
+            return [self, fullData]() {
+                if (self) {
+                    self->_RefreshFromStreamedData(fullData);
+                }
+            };
+        });
+
+    return true;
+}
+
+void
+GlfUVTexture::_RefreshFromStreamedData(
+    GlfBaseTextureDataRefPtr const &texData)
+{
+    _UpdateTexture(texData);
+    _CreateTexture(texData, _GenerateMipmap());
+}
+
 bool
 GlfUVTexture::_GenerateMipmap() const
 {
@@ -110,6 +110,16 @@ protected:
     unsigned int _GetCropRight() const {return _cropRight;}
 
 private:
+    // Attempts to read the mip tail of the image and kick off a background
+    // load of the full resolution data. Returns false if the image can't be
+    // streamed (e.g. no pre-generated mips), in which case _ReadTexture
+    // falls back to the synchronous path.
+    bool _ReadTextureStreamed();
+
+    // Replaces the GL texture contents with the given fully loaded texture
+    // data once a background load has completed.
+    void _RefreshFromStreamedData(GlfBaseTextureDataRefPtr const &texData);
+
     const TfToken _imageFilePath;
     const unsigned int _cropTop;
     const unsigned int _cropBottom;
@@ -27,12 +27,66 @@
 #include "pxr/imaging/glf/utils.h"
 #include "pxr/imaging/glf/uvTextureData.h"
 
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/arch/hash.h"
+#include "pxr/base/tf/atomicOfstreamWrapper.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 
+TF_DEFINE_ENV_SETTING(GLF_TEXTURE_TRANSCODE_CACHE_DIR, "",
+    "Directory used to cache the post-processed (cropped, resized and "
+    "pre-mipped) texel data of uv textures between sessions. An empty "
+    "value disables the cache.");
+
+namespace {
+
+// Layout of a cache file: a _CacheHeader, followed by
+// header.numMipLevels _CacheMip entries, followed by header.size bytes
+// of raw texel data ready for upload.
+struct _CacheMip {
+    uint64_t size;
+    uint64_t offset;
+    int32_t  width;
+    int32_t  height;
+};
+
+struct _CacheHeader {
+    uint64_t magic;
+    // Length and modification time of the source image when the cache
+    // file was written, used to detect stale entries.
+    int64_t  sourceLength;
+    double   sourceModTime;
+    uint32_t glInternalFormat;
+    uint32_t glFormat;
+    uint32_t glType;
+    uint32_t hasWrapModeS;
+    uint32_t hasWrapModeT;
+    uint32_t wrapModeS;
+    uint32_t wrapModeT;
+    int32_t  nativeWidth;
+    int32_t  nativeHeight;
+    int32_t  resizedWidth;
+    int32_t  resizedHeight;
+    int32_t  bytesPerPixel;
+    uint32_t numMipLevels;
+    uint64_t size;
+};
+
+// Bump when _CacheHeader or _CacheMip changes.
+static const uint64_t _cacheMagic = 0x476c665556547831ULL; // 'GlfUVTx1'
+
+} // anonymous namespace
+
 GlfUVTextureDataRefPtr
 GlfUVTextureData::New(
     std::string const &filePath,
@@ -272,12 +326,171 @@ _IsValidCrop(GlfImageSharedPtr image,
             cropImageHeight > 0); 
 }
 
+std::string
+GlfUVTextureData::_GetCacheFilePath(
+    int degradeLevel, bool generateMipmap,
+    GlfImage::ImageOriginLocation originLocation) const
+{
+    const std::string cacheDir =
+        TfGetEnvSetting(GLF_TEXTURE_TRANSCODE_CACHE_DIR);
+    if (cacheDir.empty()) {
+        return std::string();
+    }
+
+    // The key covers everything that affects the content of the raw
+    // buffer: the source path and all the read arguments. Staleness with
+    // respect to the source file content is handled via the length and
+    // modification time stored in the cache header.
+    const std::string key = TfStringPrintf(
+        "%s|%zu|%u|%u|%u|%u|%d|%d|%d",
+        _filePath.c_str(), _params.targetMemory,
+        _params.cropTop, _params.cropBottom,
+        _params.cropLeft, _params.cropRight,
+        degradeLevel, (int)generateMipmap, (int)originLocation);
+
+    return TfStringPrintf("%s/%016llx.glftex", cacheDir.c_str(),
+        (unsigned long long)ArchHash64(key.c_str(), key.size()));
+}
+
+bool
+GlfUVTextureData::_ReadCacheFile(std::string const &cachePath)
+{
+    TRACE_FUNCTION();
+
+    FILE *file = ArchOpenFile(cachePath.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+
+    _CacheHeader header;
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 &&
+                 header.magic == _cacheMagic;
+
+    // Reject the entry if the source image changed since it was written.
+    double sourceModTime = 0;
+    if (valid) {
+        valid = ArchGetModificationTime(_filePath.c_str(), &sourceModTime) &&
+                sourceModTime == header.sourceModTime &&
+                ArchGetFileLength(_filePath.c_str()) == header.sourceLength;
+    }
+
+    std::vector<_CacheMip> mips;
+    if (valid && header.numMipLevels > 0 && header.numMipLevels <= 32) {
+        mips.resize(header.numMipLevels);
+        valid = fread(mips.data(), sizeof(_CacheMip), mips.size(), file) ==
+                mips.size();
+    } else {
+        valid = false;
+    }
+
+    std::unique_ptr<unsigned char[]> buffer;
+    if (valid) {
+        buffer.reset(new unsigned char[header.size]);
+        valid = fread(buffer.get(), 1, header.size, file) == header.size;
+    }
+
+    fclose(file);
+
+    if (!valid) {
+        return false;
+    }
+
+    _glInternalFormat = header.glInternalFormat;
+    _glFormat = header.glFormat;
+    _glType = header.glType;
+    _wrapInfo.hasWrapModeS = header.hasWrapModeS;
+    _wrapInfo.hasWrapModeT = header.hasWrapModeT;
+    _wrapInfo.wrapModeS = header.wrapModeS;
+    _wrapInfo.wrapModeT = header.wrapModeT;
+    _targetMemory = _params.targetMemory;
+    _nativeWidth = header.nativeWidth;
+    _nativeHeight = header.nativeHeight;
+    _resizedWidth = header.resizedWidth;
+    _resizedHeight = header.resizedHeight;
+    _bytesPerPixel = header.bytesPerPixel;
+    _size = header.size;
+
+    _rawBufferMips.clear();
+    _rawBufferMips.resize(header.numMipLevels);
+    for (size_t i = 0; i < mips.size(); ++i) {
+        Mip &mip = _rawBufferMips[i];
+        mip.size = mips[i].size;
+        mip.offset = mips[i].offset;
+        mip.width = mips[i].width;
+        mip.height = mips[i].height;
+    }
+    _rawBuffer = std::move(buffer);
+
+    return true;
+}
+
+void
+GlfUVTextureData::_WriteCacheFile(std::string const &cachePath) const
+{
+    TRACE_FUNCTION();
+
+    _CacheHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = _cacheMagic;
+    header.sourceLength = ArchGetFileLength(_filePath.c_str());
+    if (!ArchGetModificationTime(_filePath.c_str(),
+                                 &header.sourceModTime)) {
+        return;
+    }
+    header.glInternalFormat = _glInternalFormat;
+    header.glFormat = _glFormat;
+    header.glType = _glType;
+    header.hasWrapModeS = _wrapInfo.hasWrapModeS;
+    header.hasWrapModeT = _wrapInfo.hasWrapModeT;
+    header.wrapModeS = _wrapInfo.wrapModeS;
+    header.wrapModeT = _wrapInfo.wrapModeT;
+    header.nativeWidth = _nativeWidth;
+    header.nativeHeight = _nativeHeight;
+    header.resizedWidth = _resizedWidth;
+    header.resizedHeight = _resizedHeight;
+    header.bytesPerPixel = _bytesPerPixel;
+    header.numMipLevels = _rawBufferMips.size();
+    header.size = _size;
+
+    std::vector<_CacheMip> mips(_rawBufferMips.size());
+    for (size_t i = 0; i < _rawBufferMips.size(); ++i) {
+        mips[i].size = _rawBufferMips[i].size;
+        mips[i].offset = _rawBufferMips[i].offset;
+        mips[i].width = _rawBufferMips[i].width;
+        mips[i].height = _rawBufferMips[i].height;
+    }
+
+    // Write through a temporary so concurrent processes never observe a
+    // partially written entry; losing the write only costs the next
+    // session its cache hit.
+    TfAtomicOfstreamWrapper wrapper(cachePath);
+    if (!wrapper.Open()) {
+        return;
+    }
+    wrapper.GetStream().write((char const *)&header, sizeof(header));
+    wrapper.GetStream().write((char const *)mips.data(),
+                              mips.size() * sizeof(_CacheMip));
+    wrapper.GetStream().write((char const *)_rawBuffer.get(), _size);
+    if (wrapper.GetStream()) {
+        wrapper.Commit();
+    }
+}
+
 bool
 GlfUVTextureData::Read(int degradeLevel, bool generateMipmap,
                        GlfImage::ImageOriginLocation originLocation)
-{   
+{
     TRACE_FUNCTION();
 
+    // If a transcode cache is configured, try to stream the
+    // ready-for-upload texel data written by a previous session instead
+    // of decoding and post-processing the source image again.
+    const std::string cachePath =
+        _GetCacheFilePath(degradeLevel, generateMipmap, originLocation);
+    if (!cachePath.empty() && _ReadCacheFile(cachePath)) {
+        return true;
+    }
+
     // Read the image from a file, if possible and necessary, a down-sampled
     // version
     const _DegradedImageInput degradedImage = _ReadDegradedImageInput(
@@ -287,6 +500,60 @@ GlfUVTextureData::Read(int degradeLevel, bool generateMipmap,
         return false;
     }
 
+    if (!_ReadFromImageInput(degradedImage, degradeLevel, generateMipmap,
+                             originLocation)) {
+        return false;
+    }
+
+    if (!cachePath.empty()) {
+        _WriteCacheFile(cachePath);
+    }
+    return true;
+}
+
+bool
+GlfUVTextureData::ReadMipTail(int numMipLevels,
+                              GlfImage::ImageOriginLocation originLocation)
+{
+    TRACE_FUNCTION();
+
+    const GlfImageSharedPtr fullImage = GlfImage::OpenForReading(_filePath);
+    if (!fullImage) {
+        TF_WARN("Unable to load Texture '%s'.", _filePath.c_str());
+        return false;
+    }
+
+    // Streaming a mip tail only makes sense for images that provide a
+    // pre-generated mip chain; otherwise reading the tail would decode the
+    // full resolution image anyway.
+    const int numValidMipLevels = _GetNumMipLevelsValid(fullImage);
+    const int startMip = numValidMipLevels - numMipLevels;
+    if (numValidMipLevels <= 1 || startMip <= 0) {
+        return false;
+    }
+
+    GlfImageSharedPtr tailImage =
+        GlfImage::OpenForReading(_filePath, 0, startMip);
+    if (!tailImage) {
+        return false;
+    }
+
+    const _DegradedImageInput degradedImage = _GetDegradedImageInputChain(
+        double(tailImage->GetWidth()) / fullImage->GetWidth(),
+        double(tailImage->GetHeight()) / fullImage->GetHeight(),
+        startMip, numValidMipLevels);
+
+    return _ReadFromImageInput(degradedImage, /*degradeLevel=*/0,
+                               /*generateMipmap=*/true, originLocation);
+}
+
+bool
+GlfUVTextureData::_ReadFromImageInput(
+    _DegradedImageInput const &degradedImage,
+    int degradeLevel,
+    bool generateMipmap,
+    GlfImage::ImageOriginLocation originLocation)
+{
     // Load the first mip to extract important data
     GlfImageSharedPtr image = degradedImage.images[0];
     _glFormat = image->GetFormat();
@@ -404,32 +671,42 @@ GlfUVTextureData::Read(int degradeLevel, bool generateMipmap,
     }
 
     // Read the actual mips from each image and store them in a big buffer of
-    // contiguous memory.
-    for(int i = 0 ; i < numMipLevels; i++) {
-        GlfImageSharedPtr image = degradedImage.images[i];
-        if (!image) {
-            TF_RUNTIME_ERROR("Unable to load mip from Texture '%s'.", 
-                _filePath.c_str());
-            return false;
-        }
-
-        Mip & mip  = _rawBufferMips[i];
-        GlfImage::StorageSpec storage;
-        storage.width = mip.width;
-        storage.height = mip.height;
-        storage.format = _glFormat;
-        storage.flipped = (originLocation == GlfImage::OriginLowerLeft) ?
-                          (true) : (false);
-        storage.type = _glType;
-        storage.data = _rawBuffer.get() + mip.offset;
-        
-        if (!image->ReadCropped(cropTop, cropBottom, cropLeft, cropRight, storage)) {
-            TF_WARN("Unable to read Texture '%s'.", _filePath.c_str());
-            return false;
-        }
-    }
+    // contiguous memory. Each mip writes into a disjoint range of the
+    // buffer, so the decode/convert work for the mips can run in parallel.
+    std::atomic<bool> readSuccess(true);
+    WorkParallelForN(numMipLevels,
+        [this, &degradedImage, &readSuccess,
+         cropTop, cropBottom, cropLeft, cropRight, originLocation]
+        (size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                GlfImageSharedPtr image = degradedImage.images[i];
+                if (!image) {
+                    TF_RUNTIME_ERROR("Unable to load mip from Texture '%s'.",
+                        _filePath.c_str());
+                    readSuccess = false;
+                    return;
+                }
+
+                Mip & mip  = _rawBufferMips[i];
+                GlfImage::StorageSpec storage;
+                storage.width = mip.width;
+                storage.height = mip.height;
+                storage.format = _glFormat;
+                storage.flipped = (originLocation == GlfImage::OriginLowerLeft)
+                                  ? (true) : (false);
+                storage.type = _glType;
+                storage.data = _rawBuffer.get() + mip.offset;
+
+                if (!image->ReadCropped(cropTop, cropBottom,
+                                        cropLeft, cropRight, storage)) {
+                    TF_WARN("Unable to read Texture '%s'.", _filePath.c_str());
+                    readSuccess = false;
+                    return;
+                }
+            }
+        });
 
-    return true;
+    return readSuccess;
 }
 
 size_t 
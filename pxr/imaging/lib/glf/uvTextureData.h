@@ -128,7 +128,17 @@ public:
     virtual bool Read(int degradeLevel, bool generateMipmap,
                       GlfImage::ImageOriginLocation originLocation =
                                          GlfImage::OriginUpperLeft);
-    
+
+    /// Reads only the \p numMipLevels smallest pre-generated mip levels of
+    /// the image, for use as a low-resolution stand-in while the full
+    /// resolution data is streamed in asynchronously.
+    /// Returns false if the image doesn't provide a usable pre-generated
+    /// mip chain, in which case the caller should fall back to Read().
+    GLF_API
+    bool ReadMipTail(int numMipLevels,
+                     GlfImage::ImageOriginLocation originLocation =
+                                        GlfImage::OriginUpperLeft);
+
     GLF_API
     virtual int GetNumMipLevels() const;
 
@@ -183,11 +193,37 @@ private:
                                                     int startMip, 
                                                     int lastMip);
 
-    // Given a GlfImage it will return the number of mip levels that 
+    // Given a GlfImage it will return the number of mip levels that
     // are actually valid to be loaded to the GPU. For instance, it will
     // drop textures with non valid OpenGL pyramids.
     int _GetNumMipLevelsValid(const GlfImageSharedPtr image) const;
 
+    // Reads the given image input into the raw buffer, shared by Read()
+    // and ReadMipTail(). \p degradeLevel is only used to compute the
+    // resized dimensions when the input needs a resize on load.
+    bool _ReadFromImageInput(_DegradedImageInput const &degradedImage,
+                             int degradeLevel,
+                             bool generateMipmap,
+                             GlfImage::ImageOriginLocation originLocation);
+
+    // Returns the path of the on-disk cache file holding the
+    // post-processed texel data for this texture and the given read
+    // arguments, or the empty string when the cache is disabled
+    // (see GLF_TEXTURE_TRANSCODE_CACHE_DIR).
+    std::string _GetCacheFilePath(
+                             int degradeLevel,
+                             bool generateMipmap,
+                             GlfImage::ImageOriginLocation originLocation) const;
+
+    // Tries to populate the raw buffer and texture metadata from a cache
+    // file written by a previous session. Returns false if the file is
+    // missing, stale with respect to the source image, or malformed.
+    bool _ReadCacheFile(std::string const &cachePath);
+
+    // Best-effort write of the current raw buffer and metadata to the
+    // cache; failures only cost us the next session's cache hit.
+    void _WriteCacheFile(std::string const &cachePath) const;
+
     GlfUVTextureData(std::string const &filePath, Params const &params);
     virtual ~GlfUVTextureData();
         
@@ -0,0 +1,129 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/imaging/hd/bufferKernels.h"
+
+#include "pxr/base/arch/defines.h"
+
+#if defined(ARCH_CPU_INTEL)
+#include <emmintrin.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+void
+HdNarrowDoubleToFloat(float *dst, double const *src, size_t count)
+{
+    size_t i = 0;
+#if defined(ARCH_CPU_INTEL)
+    // SSE2 is part of the x86-64 baseline; convert four doubles per
+    // iteration.  Unaligned loads/stores are used since VtArray data has
+    // no alignment guarantee beyond the element type's.
+    for (; i + 4 <= count; i += 4) {
+        const __m128d lo = _mm_loadu_pd(src + i);
+        const __m128d hi = _mm_loadu_pd(src + i + 2);
+        _mm_storeu_ps(dst + i,
+                      _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi)));
+    }
+#endif
+    for (; i != count; ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+namespace {
+
+// Copy count elements of type T from a contiguous source to a strided
+// destination, or vice versa.  Using a fixed-size element type lets the
+// compiler emit whole-element moves rather than a memcpy call per
+// element.
+template <class T>
+void
+_Scatter(uint8_t *dst, size_t dstStride, uint8_t const *src, size_t count)
+{
+    for (size_t i = 0; i != count; ++i) {
+        *reinterpret_cast<T*>(dst) =
+            *reinterpret_cast<T const*>(src + i*sizeof(T));
+        dst += dstStride;
+    }
+}
+
+template <class T>
+void
+_Gather(uint8_t *dst, uint8_t const *src, size_t srcStride, size_t count)
+{
+    for (size_t i = 0; i != count; ++i) {
+        *reinterpret_cast<T*>(dst + i*sizeof(T)) =
+            *reinterpret_cast<T const*>(src);
+        src += srcStride;
+    }
+}
+
+// Fixed-size element types for the common vertex attribute sizes.
+struct _Elem12 { uint32_t v[3]; };
+struct _Elem16 { uint64_t v[2]; };
+
+} // anonymous namespace
+
+void
+HdInterleaveElements(void *dst, size_t dstStride,
+                     void const *src, size_t elemSize, size_t count)
+{
+    uint8_t *d = static_cast<uint8_t*>(dst);
+    uint8_t const *s = static_cast<uint8_t const*>(src);
+
+    switch (elemSize) {
+    case 4:  _Scatter<uint32_t>(d, dstStride, s, count); return;
+    case 8:  _Scatter<uint64_t>(d, dstStride, s, count); return;
+    case 12: _Scatter<_Elem12>(d, dstStride, s, count); return;
+    case 16: _Scatter<_Elem16>(d, dstStride, s, count); return;
+    }
+    for (size_t i = 0; i != count; ++i) {
+        memcpy(d, s + i*elemSize, elemSize);
+        d += dstStride;
+    }
+}
+
+void
+HdDeinterleaveElements(void *dst, void const *src, size_t srcStride,
+                       size_t elemSize, size_t count)
+{
+    uint8_t *d = static_cast<uint8_t*>(dst);
+    uint8_t const *s = static_cast<uint8_t const*>(src);
+
+    switch (elemSize) {
+    case 4:  _Gather<uint32_t>(d, s, srcStride, count); return;
+    case 8:  _Gather<uint64_t>(d, s, srcStride, count); return;
+    case 12: _Gather<_Elem12>(d, s, srcStride, count); return;
+    case 16: _Gather<_Elem16>(d, s, srcStride, count); return;
+    }
+    for (size_t i = 0; i != count; ++i) {
+        memcpy(d + i*elemSize, s, elemSize);
+        s += srcStride;
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,67 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef HD_BUFFER_KERNELS_H
+#define HD_BUFFER_KERNELS_H
+
+/// \file hd/bufferKernels.h
+///
+/// Bulk conversion and layout kernels used when packing buffer source
+/// data for the GPU.  These replace element-by-element loops with
+/// vectorized (or at least vectorizable) implementations for the copies
+/// that dominate commit time on large primvar updates.
+
+#include "pxr/pxr.h"
+#include "pxr/imaging/hd/api.h"
+#include "pxr/imaging/hd/version.h"
+
+#include <cstddef>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Convert \p count doubles from \p src to floats in \p dst.
+///
+/// Both arrays are contiguous, so componented types narrow with a single
+/// call: a VtArray of n GfVec3d values is 3n doubles and a VtArray of n
+/// GfMatrix4d values is 16n doubles.  Uses SIMD conversion where the
+/// target architecture provides it.
+HD_API
+void HdNarrowDoubleToFloat(float *dst, double const *src, size_t count);
+
+/// Scatter \p count elements of \p elemSize bytes each from the
+/// contiguous array \p src into \p dst, advancing the destination by
+/// \p dstStride bytes per element (interleave, SoA to AoS).
+HD_API
+void HdInterleaveElements(void *dst, size_t dstStride,
+                          void const *src, size_t elemSize, size_t count);
+
+/// Gather \p count elements of \p elemSize bytes each from \p src,
+/// advancing the source by \p srcStride bytes per element, into the
+/// contiguous array \p dst (deinterleave, AoS to SoA).
+HD_API
+void HdDeinterleaveElements(void *dst, void const *src, size_t srcStride,
+                            size_t elemSize, size_t count);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_BUFFER_KERNELS_H
@@ -55,6 +55,8 @@ HdChangeTracker::HdChangeTracker()
     , _bprimIndexVersion(1)
     , _instancerIndexVersion(1)
     , _sceneStateVersion(1)
+    , _rprimStateVersion(1)
+    , _sprimStateVersion(1)
     , _visChangeCount(1)
     , _renderTagVersion(1)
     , _batchVersion(1)
@@ -85,8 +87,35 @@ HdChangeTracker::RprimInserted(SdfPath const& id, HdDirtyBits initialDirtyState)
 {
     TF_DEBUG(HD_RPRIM_ADDED).Msg("Rprim Added: %s\n", id.GetText());
     _rprimState[id] = initialDirtyState;
+    if ((initialDirtyState & Varying) != 0) {
+        _varyingRprimIds.insert(id);
+    }
+
+    ++_sceneStateVersion;
+    ++_rprimStateVersion;
+    ++_rprimIndexVersion;
+}
+
+void
+HdChangeTracker::RprimsInserted(
+    std::vector<std::pair<SdfPath, HdDirtyBits>> const& rprims)
+{
+    if (rprims.empty()) {
+        return;
+    }
+
+    _rprimState.reserve(_rprimState.size() + rprims.size());
+    for (const auto &entry : rprims) {
+        TF_DEBUG(HD_RPRIM_ADDED).Msg("Rprim Added: %s\n",
+                                     entry.first.GetText());
+        _rprimState[entry.first] = entry.second;
+        if ((entry.second & Varying) != 0) {
+            _varyingRprimIds.insert(entry.first);
+        }
+    }
 
     ++_sceneStateVersion;
+    ++_rprimStateVersion;
     ++_rprimIndexVersion;
 }
 
@@ -95,11 +124,13 @@ HdChangeTracker::RprimRemoved(SdfPath const& id)
 {
     TF_DEBUG(HD_RPRIM_REMOVED).Msg("Rprim Removed: %s\n", id.GetText());
     _rprimState.erase(id);
+    _varyingRprimIds.erase(id);
     // Make sure cached DrawItems get flushed out and their buffers are
     // reclaimed.
     _needsGarbageCollection = true;
 
     ++_sceneStateVersion;
+    ++_rprimStateVersion;
     ++_rprimIndexVersion;
 }
 
@@ -145,10 +176,12 @@ HdChangeTracker::MarkRprimDirty(SdfPath const& id, HdDirtyBits bits)
 
         // varying state changed.
         bits |= HdChangeTracker::Varying;
+        _varyingRprimIds.insert(id);
         ++_varyingStateVersion;
     }
     it->second = oldBits | bits;
     ++_sceneStateVersion;
+    ++_rprimStateVersion;
 
     if ((bits & DirtyVisibility) != 0) {
         ++_visChangeCount;
@@ -181,6 +214,7 @@ HdChangeTracker::ResetVaryingState()
     TF_FOR_ALL (it, _rprimState) {
         if (IsClean(it->second)) {
             it->second &= ~Varying;
+            _varyingRprimIds.erase(it->first);
         }
     }
 }
@@ -201,6 +235,13 @@ HdChangeTracker::ResetRprimVaryingState(SdfPath const& id)
     // want to pick up the possible change on the next iteration.
 
     it->second &= ~Varying;
+    _varyingRprimIds.erase(id);
+}
+
+SdfPathVector
+HdChangeTracker::GetVaryingRprimIds() const
+{
+    return SdfPathVector(_varyingRprimIds.begin(), _varyingRprimIds.end());
 }
 
 void
@@ -396,6 +437,7 @@ HdChangeTracker::SprimInserted(SdfPath const& id, HdDirtyBits initialDirtyState)
     _sprimState[id] = initialDirtyState;
     ++_sceneStateVersion;
     ++_sprimIndexVersion;
+    ++_sprimStateVersion;
 }
 
 void
@@ -407,6 +449,7 @@ HdChangeTracker::SprimRemoved(SdfPath const& id)
     _needsGarbageCollection = true;
     ++_sceneStateVersion;
     ++_sprimIndexVersion;
+    ++_sprimStateVersion;
 }
 
 HdDirtyBits
@@ -431,6 +474,7 @@ HdChangeTracker::MarkSprimDirty(SdfPath const& id, HdDirtyBits bits)
         return;
     it->second = it->second | bits;
     ++_sceneStateVersion;
+    ++_sprimStateVersion;
 }
 
 void
@@ -771,6 +815,7 @@ HdChangeTracker::MarkAllRprimsDirty(HdDirtyBits bits)
 
             if ((rprimDirtyBits & HdChangeTracker::Varying) == 0) {
                 rprimDirtyBits |= HdChangeTracker::Varying;
+                _varyingRprimIds.insert(it->first);
                 varyingStateUpdated = true;
             }
         }
@@ -783,6 +828,7 @@ HdChangeTracker::MarkAllRprimsDirty(HdDirtyBits bits)
     // These counters get updated every time, even if no prims
     // have moved into the dirty state.
     ++_sceneStateVersion;
+    ++_rprimStateVersion;
     if ((bits & DirtyVisibility) != 0) {
         ++_visChangeCount;
     }
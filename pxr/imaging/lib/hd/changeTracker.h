@@ -30,9 +30,12 @@
 #include "pxr/imaging/hd/rprimCollection.h"
 #include "pxr/imaging/hd/types.h"
 #include "pxr/usd/sdf/path.h"
+#include "pxr/base/tf/denseHashMap.h"
 #include "pxr/base/tf/hashmap.h"
 
 #include <atomic>
+#include <utility>
+#include <vector>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/unordered_map.hpp>
@@ -111,6 +114,14 @@ public:
     HD_API
     void RprimInserted(SdfPath const& id, HdDirtyBits initialDirtyState);
 
+    /// Start tracking a batch of Rprims, each with its own initial dirty
+    /// state.  This is equivalent to calling RprimInserted() for each entry,
+    /// except that the scene state and rprim index versions are bumped only
+    /// once for the whole batch.
+    HD_API
+    void RprimsInserted(
+        std::vector<std::pair<SdfPath, HdDirtyBits>> const& rprims);
+
     /// Stop tracking Rprim with the given \p id.
     HD_API
     void RprimRemoved(SdfPath const& id);
@@ -495,6 +506,13 @@ public:
         return _varyingStateVersion;
     }
 
+    /// Returns the ids of all rprims currently in varying state, in sorted
+    /// order.  The set is maintained incrementally as prims move in and out
+    /// of varying state, so retrieving it does not require scanning every
+    /// rprim in the index.
+    HD_API
+    SdfPathVector GetVaryingRprimIds() const;
+
     /// Marks all batches dirty, meaning they need to be validated and
     /// potentially rebuilt.
     HD_API
@@ -548,6 +566,26 @@ public:
         return _sceneStateVersion;
     }
 
+    /// Returns the current version of rprim state.
+    /// This version number changes whenever an rprim is marked dirty,
+    /// inserted or removed; unlike the scene state version it is not
+    /// affected by changes to other prim types such as cameras and lights.
+    /// The use case is to detect that rendered geometry is unchanged, so
+    /// cached renderings of it (e.g. shadow maps) can be reused.
+    unsigned GetRprimStateVersion() const {
+        return _rprimStateVersion;
+    }
+
+    /// Returns the current version of sprim state.
+    /// This version number changes whenever an sprim is marked dirty,
+    /// inserted or removed.
+    /// The use case is to detect that cameras, lights and other scene
+    /// state prims are unchanged, so derived state (e.g. packed lighting
+    /// uniforms) can be reused.
+    unsigned GetSprimStateVersion() const {
+        return _sprimStateVersion;
+    }
+
     // ---------------------------------------------------------------------- //
     /// @}
     /// \name General state tracking
@@ -585,13 +623,24 @@ private:
     static void _LogCacheAccess(TfToken const& cacheName,
                                 SdfPath const& id, bool hit);
 
-    typedef TfHashMap<SdfPath, HdDirtyBits, SdfPath::Hash> _IDStateMap;
+    // SdfPath is a 64-bit value type hashed as an integer, so the dirty
+    // state maps can use dense, open-addressed storage; the full-map
+    // sweeps done per frame then walk contiguous memory.  Note that
+    // insertion and removal invalidate iterators, which the tracker never
+    // holds across mutations.
+    typedef TfDenseHashMap<SdfPath, HdDirtyBits, SdfPath::Hash> _IDStateMap;
     typedef TfHashMap<TfToken, int, TfToken::HashFunctor> _CollectionStateMap;
     typedef TfHashMap<SdfPath, SdfPathSet, SdfPath::Hash> _InstancerRprimMap;
     typedef TfHashMap<TfToken, unsigned, TfToken::HashFunctor> _GeneralStateMap;
 
     // Core dirty state.
     _IDStateMap _rprimState;
+
+    // The ids of all rprims whose state currently has the Varying bit set.
+    // Kept in sync with _rprimState so that dirty lists can be rebuilt
+    // without scanning the whole index.
+    SdfPathSet _varyingRprimIds;
+
     _IDStateMap _instancerState;
     _IDStateMap _taskState;
     _IDStateMap _sprimState;
@@ -626,6 +675,14 @@ private:
     // avoid the need to sync or reset progressive renderers.
     unsigned _sceneStateVersion;
 
+    // Tracks edits to rprim state only (dirtying, insertion and removal),
+    // so consumers can tell geometry changes apart from changes to other
+    // prim types covered by the scene state version.
+    unsigned _rprimStateVersion;
+
+    // Tracks edits to sprim state only (dirtying, insertion and removal).
+    unsigned _sprimStateVersion;
+
     // Used to detect that visibility changed somewhere in the render index.
     unsigned _visChangeCount;
 
@@ -29,6 +29,7 @@
 #include "pxr/imaging/hd/renderIndex.h"
 #include "pxr/imaging/hd/tokens.h"
 
+#include <algorithm>
 #include <iostream>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -119,12 +120,50 @@ HdDirtyList::_BuildDirtyList(const TfTokenVector& renderTags,
     // exclude path.  This should hit the filter's fast path.
     static const SdfPathVector includePaths = {SdfPath::AbsoluteRootPath()};
     static const SdfPathVector excludePaths;
-    
-    const SdfPathVector &paths = _renderIndex.GetRprimIds();
 
+    // With no dirty bits mask, the list is exactly the set of prims
+    // carrying one of the active render tags, which the render index keeps
+    // partitioned per tag.  Taking the union of those ready lists avoids
+    // re-querying the render tag of every prim in the scene each time tag
+    // activation changes (e.g. toggling guide display).
+    if (mask == 0 && !renderTags.empty()) {
+        _dirtyIds.clear();
+        for (const TfToken &tag : renderTags) {
+            const SdfPathVector &tagIds =
+                _renderIndex.GetRprimIdsWithRenderTag(tag);
+            _dirtyIds.insert(_dirtyIds.end(), tagIds.begin(), tagIds.end());
+        }
+        // Each per-tag list is sorted; restore global order when several
+        // were concatenated.
+        if (renderTags.size() > 1) {
+            std::sort(_dirtyIds.begin(), _dirtyIds.end());
+        }
+        return;
+    }
 
     _FilterParam filterParam = {_renderIndex, renderTags, mask};
 
+    // When only the varying prims are wanted, the change tracker's
+    // incrementally-maintained varying set can be filtered directly
+    // rather than scanning every rprim in the index, so the cost of the
+    // rebuild scales with the number of varying prims.
+    if (mask == HdChangeTracker::Varying) {
+        const SdfPathVector varyingIds =
+            _renderIndex.GetChangeTracker().GetVaryingRprimIds();
+
+        _dirtyIds.clear();
+        _dirtyIds.reserve(varyingIds.size());
+        for (const SdfPath &id : varyingIds) {
+            if (_DirtyListFilterPredicate(id, &filterParam)) {
+                _dirtyIds.push_back(id);
+            }
+        }
+
+        return;
+    }
+
+    const SdfPathVector &paths = _renderIndex.GetRprimIds();
+
     HdPrimGather gather;
 
     gather.PredicatedFilter(paths,
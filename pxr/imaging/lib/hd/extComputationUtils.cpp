@@ -30,9 +30,11 @@
 #include "pxr/imaging/hd/sceneDelegate.h"
 
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/taskGraph.h"
 
 #include <deque>
 #include <iostream>
+#include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -104,60 +106,100 @@ _GenerateDependencyMap(
 }
 
 static HdExtComputationUtils::ValueStore
-_ExecuteComputations(HdExtComputationConstPtrVector computations,
+_ExecuteComputations(HdExtComputationConstPtrVector const& computations,
+                     HdExtComputationUtils::ComputationDependencyMap const& cdm,
                      HdSceneDelegate* sceneDelegate)
 {
     HD_TRACE_FUNCTION();
 
     HdExtComputationUtils::ValueStore valueStore;
+
+    // Add all the scene inputs to the value store up front, on this thread;
+    // scene delegate queries don't run on the worker threads.
     for (auto const& comp : computations) {
         SdfPath const& compId = comp->GetId();
 
-        // Add all the scene inputs to the value store
         for (TfToken const& input : comp->GetSceneInputNames()) {
             valueStore[input] = sceneDelegate->GetExtComputationInput(
                                     compId, input);
         }
+    }
 
-        if (comp->IsInputAggregation()) {
-            // An aggregator computation produces no output, and thus
-            // doesn't need to be executed.
-            continue;
-        }
+    // The kernels execute as a task graph with one task per computation and
+    // a dependency edge per computation input, so independent computations
+    // run concurrently.  Values are handed from computation to computation
+    // through the shared value store; VtValue is copy-on-write, so no
+    // buffer data is copied along the way.
+    std::mutex valueStoreMutex;
 
-        // Populate the context with all the inputs (scene, computed) from
-        // the value store.
-        Hd_ExtComputationContextInternal context;
-        for (auto const& sceneInput : comp->GetSceneInputNames()) {
-            context.SetInputValue(sceneInput, valueStore.at(sceneInput));
-        }
+    WorkTaskGraph taskGraph;
+    std::unordered_map<HdExtComputation const *, WorkTaskGraph::TaskId>
+        taskIds;
+    taskIds.reserve(computations.size());
 
-        for (auto const& computedInput : comp->GetComputationInputs()) {
-            context.SetInputValue(computedInput.name,
-                valueStore.at(computedInput.sourceComputationOutputName));
-        }
+    for (auto const& comp : computations) {
+        taskIds[comp] = taskGraph.AddTask(
+            [comp, sceneDelegate, &valueStore, &valueStoreMutex]() {
 
-        sceneDelegate->InvokeExtComputation(compId, &context);
-        
-        if (context.HasComputationError()) {
-            // We could bail here, or choose to execute other computations.
-            // Choose the latter.
-            TF_WARN("Error invoking computation %s.\n", compId.GetText());
-        } else {
-            // Add outputs to the value store (subsequent computations may need
-            // them as computation inputs)
-            TfTokenVector const& outputNames = comp->GetOutputNames();
-            for (auto const& name : outputNames) {
-                VtValue value;
-                if (!context.GetOutputValue(name, &value)) {
-                    TF_WARN("Error getting out %s for computation %s.\n",
-                            name.GetText(), compId.GetText());
-                } else {
-                    valueStore[name] = value;
+            if (comp->IsInputAggregation()) {
+                // An aggregator computation produces no output, and thus
+                // doesn't need to be executed.
+                return;
+            }
+
+            SdfPath const& compId = comp->GetId();
+
+            // Populate the context with all the inputs (scene, computed)
+            // from the value store.
+            Hd_ExtComputationContextInternal context;
+            {
+                std::lock_guard<std::mutex> lock(valueStoreMutex);
+                for (auto const& sceneInput : comp->GetSceneInputNames()) {
+                    context.SetInputValue(sceneInput,
+                                          valueStore.at(sceneInput));
+                }
+
+                for (auto const& computedInput :
+                         comp->GetComputationInputs()) {
+                    context.SetInputValue(computedInput.name,
+                        valueStore.at(
+                            computedInput.sourceComputationOutputName));
                 }
             }
+
+            sceneDelegate->InvokeExtComputation(compId, &context);
+
+            if (context.HasComputationError()) {
+                // We could bail here, or choose to execute other
+                // computations. Choose the latter.
+                TF_WARN("Error invoking computation %s.\n", compId.GetText());
+            } else {
+                // Add outputs to the value store (dependent computations may
+                // need them as computation inputs)
+                TfTokenVector const& outputNames = comp->GetOutputNames();
+                for (auto const& name : outputNames) {
+                    VtValue value;
+                    if (!context.GetOutputValue(name, &value)) {
+                        TF_WARN("Error getting out %s for computation %s.\n",
+                                name.GetText(), compId.GetText());
+                    } else {
+                        std::lock_guard<std::mutex> lock(valueStoreMutex);
+                        valueStore[name] = value;
+                    }
+                }
+            }
+        });
+    }
+
+    // Wire up the dependency edges.
+    for (auto const& entry : cdm) {
+        WorkTaskGraph::TaskId taskId = taskIds[entry.first];
+        for (HdExtComputation const * depComp : entry.second) {
+            taskGraph.AddDependency(taskId, taskIds[depComp]);
         }
-    } // for each computation
+    }
+
+    taskGraph.RunAndWait();
 
     return valueStore;
 }
@@ -176,7 +218,8 @@ HdExtComputationUtils::GetComputedPrimvarValues(
     HdExtComputationUtils::ComputationDependencyMap cdm
         = _GenerateDependencyMap(compPrimvars, sceneDelegate);
 
-    // Topological ordering of the computations
+    // Topological ordering of the computations; this also validates that
+    // the dependency graph is free of cycles before execution.
     HdExtComputationConstPtrVector sortedComputations;
     bool success = DependencySort(cdm, &sortedComputations);
 
@@ -186,7 +229,7 @@ HdExtComputationUtils::GetComputedPrimvarValues(
 
     // Execution
     HdExtComputationUtils::ValueStore valueStore =
-        _ExecuteComputations(sortedComputations, sceneDelegate);
+        _ExecuteComputations(sortedComputations, cdm, sceneDelegate);
 
     // Output extraction
     HdExtComputationUtils::ValueStore computedPrimvarValueStore;
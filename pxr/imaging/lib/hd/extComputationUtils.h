@@ -53,7 +53,8 @@ public:
     // Returns a map containing the (token, value) pairs for each "computation
     // primvar".
     // The participating computations are ordered based on their dependency
-    // and then, the CPU kernel is executed for each computation.
+    // and then, the CPU kernels are executed as a task graph, running
+    // computations that don't depend on each other concurrently.
     HD_API
     static ValueStore
     GetComputedPrimvarValues(
@@ -30,6 +30,9 @@
 #include "pxr/imaging/hf/perfLog.h"
 #include "pxr/base/vt/array.h"
 #include "pxr/base/work/loops.h"
+#include "pxr/base/work/scan.h"
+
+#include <functional>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -52,6 +55,10 @@ public:
 
     void Compute(size_t begin, size_t end)
     {
+        // Hoist the orientation sign out of the fan loop; keeping the loop
+        // body branch-free lets the compiler vectorize the cross products.
+        const typename SrcType::ScalarType sign = _flip ? -1.0 : 1.0;
+
         for (size_t i = begin; i < end; ++i) {
             SrcType normal(0);
             int offset = _faceOffsets[i];
@@ -61,8 +68,9 @@ public:
             for (int j = 2; j < count; ++j) {
                 SrcType const& v1 = _points[_faceIndices[offset+j-1]];
                 SrcType const& v2 = _points[_faceIndices[offset+j]];
-                normal += GfCross(v1-v0, v2-v0) * (_flip ? -1.0 : 1.0);
+                normal += GfCross(v1-v0, v2-v0);
             }
+            normal *= sign;
             if (true) { // could defer normalization to shader code
                 normal.Normalize();
             }
@@ -87,13 +95,13 @@ _ComputeFlatNormals(HdMeshTopology const *topology, SrcType const* points)
     int numFaces = topology->GetFaceVertexCounts().size();
     VtArray<DstType> normals(numFaces);
 
+    // The offset table is an exclusive scan of the face vertex counts;
+    // on large meshes this was the remaining serial portion of the
+    // computation.
     VtIntArray faceOffsets(numFaces);
     VtIntArray const &faceCounts = topology->GetFaceVertexCounts();
-    int offset = 0;
-    for (int i = 0; i < numFaces; ++i) {
-        faceOffsets[i] = offset;
-        offset += faceCounts[i];
-    }
+    WorkParallelExclusiveScan(
+        faceCounts.cdata(), numFaces, faceOffsets.data(), 0, std::plus<int>());
     VtIntArray const &faceIndices = topology->GetFaceVertexIndices();
     bool flip = (topology->GetOrientation() != HdTokens->rightHanded);
 
@@ -23,8 +23,24 @@
 //
 #include "pxr/imaging/hd/instanceRegistry.h"
 
+#include "pxr/base/tf/envSetting.h"
+
+#include <algorithm>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(HD_INSTANCE_REGISTRY_GC_BUDGET, 4096,
+                      "Maximum number of entries each instance registry "
+                      "examines per GarbageCollect() call "
+                      "(0 = sweep every entry)");
+
+size_t
+HdGetInstanceRegistryGarbageCollectionBudget()
+{
+    static const size_t budget =
+        std::max(TfGetEnvSetting(HD_INSTANCE_REGISTRY_GC_BUDGET), 0);
+    return budget;
+}
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -33,10 +33,18 @@
 #include <boost/shared_ptr.hpp>
 #include <tbb/concurrent_unordered_map.h>
 
+#include <iterator>
+#include <limits>
 #include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+/// Returns the maximum number of entries each registry examines per
+/// GarbageCollect() call, controlled by the env setting
+/// HD_INSTANCE_REGISTRY_GC_BUDGET (0 = sweep every entry).
+HD_API
+size_t HdGetInstanceRegistryGarbageCollectionBudget();
+
 
 /// \class HdInstance
 ///
@@ -104,7 +112,8 @@ private:
 /// HdInstanceRegistry is a dictionary container of HdInstance.
 /// This class is almost just a dictionary from key to value.
 /// For cleaning unused entries, it provides GarbageCollect() API.
-/// It sweeps all entries in the dictionary and erase unreferenced entries.
+/// It incrementally sweeps entries in the dictionary and erases
+/// unreferenced entries.
 /// When HdInstance::ValueType is shared_ptr, it is regarded as unreferenced
 /// if the shared_ptr is unique (use_count==1). Note that Key is not
 /// involved to determine the lifetime of entries.
@@ -117,8 +126,9 @@ public:
     /// Copy constructor.  Need as HdInstanceRegistry is placed in a map
     /// and mutex is not copy constructable, so can't use default
     HdInstanceRegistry(const HdInstanceRegistry &other)
-        : _dictionary(other._dictionary),
-        _regLock()  // Lock is not copied
+        : _dictionary(other._dictionary)
+        , _gcSweepIndex(0)
+        // Locks are not copied
     {
     }
 
@@ -151,7 +161,21 @@ private:
 
     typedef typename INSTANCE::Dictionary _Dictionary;
     _Dictionary _dictionary;
-    std::mutex _regLock;
+
+    // The dictionary itself supports concurrent find/insert; the locks only
+    // guard value initialization of an entry.  They are striped by the key's
+    // hash so that lookups of unrelated keys during parallel rprim sync
+    // don't serialize on a single registry-wide mutex.
+    static const size_t _NumLocks = 16;
+    std::mutex _regLocks[_NumLocks];
+
+    std::mutex &_GetLock(typename INSTANCE::KeyType const &key) {
+        return _regLocks[tbb::tbb_hasher(key) % _NumLocks];
+    }
+
+    // Number of entries preceding the position where the next incremental
+    // garbage collection sweep resumes.
+    size_t _gcSweepIndex = 0;
 
     HdInstanceRegistry &operator =(HdInstanceRegistry &) = delete;
 };
@@ -167,9 +191,9 @@ HdInstanceRegistry<INSTANCE>::GetInstance(typename INSTANCE::KeyType const &key,
     HD_TRACE_FUNCTION();
     HF_MALLOC_TAG_FUNCTION();
 
-    // Grab Registry lock
+    // Grab the lock stripe for this key
     // (and don't release it in this function, return it instead)
-    std::unique_lock<std::mutex> lock(_regLock);
+    std::unique_lock<std::mutex> lock(_GetLock(key));
 
     typename _Dictionary::iterator it = _dictionary.find(key);
     bool firstInstance = false;
@@ -194,9 +218,9 @@ HdInstanceRegistry<INSTANCE>::FindInstance(typename INSTANCE::KeyType const &key
     HD_TRACE_FUNCTION();
     HF_MALLOC_TAG_FUNCTION();
 
-    // Grab Registry lock
+    // Grab the lock stripe for this key
     // (and don't release it in this function, return it instead)
-    std::unique_lock<std::mutex> lock(_regLock);
+    std::unique_lock<std::mutex> lock(_GetLock(key));
 
     typename _Dictionary::iterator it = _dictionary.find(key);
     if (it == _dictionary.end()) {
@@ -216,19 +240,37 @@ HdInstanceRegistry<INSTANCE>::GarbageCollect()
     HD_TRACE_FUNCTION();
     HF_MALLOC_TAG_FUNCTION();
 
-    size_t count = 0;
-    for (typename _Dictionary::iterator it = _dictionary.begin();
-         it != _dictionary.end();) {
+    // Erasure is amortized over frames: each call sweeps at most the
+    // budgeted number of entries, resuming where the previous sweep left
+    // off, so unloading a large scene doesn't stall a single frame with a
+    // full walk of the dictionary.
+    size_t budget = HdGetInstanceRegistryGarbageCollectionBudget();
+    if (budget == 0) {
+        budget = std::numeric_limits<size_t>::max();
+    }
+
+    if (_gcSweepIndex >= _dictionary.size()) {
+        _gcSweepIndex = 0;
+    }
+    typename _Dictionary::iterator it = _dictionary.begin();
+    std::advance(it, _gcSweepIndex);
+
+    for (size_t examined = 0;
+         it != _dictionary.end() && examined < budget; ++examined) {
 
         // erase instance which isn't referred from anyone
         if (_IsUnique(it->second)) {
             it = _dictionary.unsafe_erase(it);
         } else {
             ++it;
-            ++count;
+            ++_gcSweepIndex;
         }
     }
-    return count;
+    if (it == _dictionary.end()) {
+        _gcSweepIndex = 0;
+    }
+
+    return _dictionary.size();
 }
 
 template <typename INSTANCE>
@@ -239,6 +281,7 @@ HdInstanceRegistry<INSTANCE>::Invalidate()
     HF_MALLOC_TAG_FUNCTION();
 
     _dictionary.clear();
+    _gcSweepIndex = 0;
 }
 
 
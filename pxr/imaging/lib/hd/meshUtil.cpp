@@ -34,6 +34,13 @@
 #include "pxr/base/gf/vec2d.h"
 #include "pxr/base/gf/vec3d.h"
 #include "pxr/base/gf/vec4d.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/scan.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -73,6 +80,85 @@ bool _FanTriangulate(GfVec3i *dst, int const *src,
     return _FanTriangulate(dst->data(), src, offset, index, size, flip);
 }
 
+VtIntArray const &
+HdMeshUtil::_GetFaceTriangleOffsets(VtIntArray const &holeFaces,
+                                    int *numTrisOut,
+                                    bool *invalidFacesOut) const
+{
+    // Topologies without holes use the same table for both variants, so
+    // key the cache slot on whether hole faces were supplied.
+    int slot = holeFaces.empty() ? 1 : 0;
+
+    if (_faceTriangleCounts[slot] < 0) {
+        int const * numVertsPtr = _topology->GetFaceVertexCounts().cdata();
+        int const * holeFacesPtr = holeFaces.cdata();
+        int numFaces = _topology->GetFaceVertexCounts().size();
+        int numHoleFaces = holeFaces.size();
+
+        VtIntArray &table = _faceTriangleOffsets[slot];
+        table.resize(numFaces * 2);
+        int *tablePtr = table.data();
+
+        // Per-face triangle counts; zero for skipped faces.  Hole faces are
+        // found by binary search, which (like the serial walk this replaces)
+        // relies on the hole indices being in ascending order.
+        std::vector<int> triOffsets(numFaces);
+        std::vector<char> skips(numFaces);
+        std::atomic<bool> invalidFound(false);
+        WorkParallelForN(
+            numFaces,
+            [&](size_t begin, size_t end) {
+            bool localInvalid = false;
+            for (size_t i = begin; i < end; ++i) {
+                int nv = numVertsPtr[i];
+                if (nv < 3) {
+                    // skip degenerated face
+                    triOffsets[i] = 0;
+                    skips[i] = 1;
+                    localInvalid = true;
+                } else if (std::binary_search(
+                               holeFacesPtr, holeFacesPtr + numHoleFaces,
+                               int(i))) {
+                    // skip hole face
+                    triOffsets[i] = 0;
+                    skips[i] = 1;
+                } else {
+                    triOffsets[i] = nv - 2;
+                    skips[i] = 0;
+                }
+            }
+            if (localInvalid) {
+                invalidFound = true;
+            }
+        });
+
+        // Convert the per-face vertex and triangle counts to offsets.
+        std::vector<int> vertOffsets(numFaces);
+        WorkParallelExclusiveScan(
+            numVertsPtr, numFaces, vertOffsets.begin(), 0, std::plus<int>());
+        int tv = WorkParallelExclusiveScan(
+            triOffsets.begin(), numFaces, triOffsets.begin(), 0,
+            std::plus<int>());
+
+        // Interleave into the table, marking skipped faces.
+        WorkParallelForN(
+            numFaces,
+            [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                tablePtr[i*2] = vertOffsets[i];
+                tablePtr[i*2 + 1] = skips[i] ? -1 : triOffsets[i];
+            }
+        });
+
+        _faceTriangleCounts[slot] = tv;
+        _faceTriangleInvalid[slot] = invalidFound;
+    }
+
+    *numTrisOut = _faceTriangleCounts[slot];
+    *invalidFacesOut = _faceTriangleInvalid[slot];
+    return _faceTriangleOffsets[slot];
+}
+
 void
 HdMeshUtil::ComputeTriangleIndices(VtVec3iArray *indices,
                                    VtIntArray *primitiveParams,
@@ -94,28 +180,17 @@ HdMeshUtil::ComputeTriangleIndices(VtVec3iArray *indices,
 
     int const * numVertsPtr = _topology->GetFaceVertexCounts().cdata();
     int const * vertsPtr = _topology->GetFaceVertexIndices().cdata();
-    int const * holeFacesPtr = _topology->GetHoleIndices().cdata();
     int numFaces = _topology->GetFaceVertexCounts().size();
     int numVertIndices = _topology->GetFaceVertexIndices().size();
+
     int numTris = 0;
-    int numHoleFaces = _topology->GetHoleIndices().size();
-    bool invalidTopology = false;
-    int holeIndex = 0;
-    for (int i=0; i<numFaces; ++i) {
-        int nv = numVertsPtr[i]-2;
-        if (nv < 1) {
-            // skip degenerated face
-            invalidTopology = true;
-        } else if (holeIndex < numHoleFaces && holeFacesPtr[holeIndex] == i) {
-            // skip hole face
-            ++holeIndex;
-        } else {
-            numTris += nv;
-        }
-    }
-    if (invalidTopology) {
+    bool invalidFaces = false;
+    VtIntArray const &faceTriangleOffsets =
+        _GetFaceTriangleOffsets(_topology->GetHoleIndices(),
+                                &numTris, &invalidFaces);
+    int const * faceTriangleOffsetsPtr = faceTriangleOffsets.cdata();
+    if (invalidFaces) {
         TF_WARN("degenerated face found [%s]", _id.GetText());
-        invalidTopology = false;
     }
 
     indices->resize(numTris); // vec3 per face
@@ -126,25 +201,35 @@ HdMeshUtil::ComputeTriangleIndices(VtVec3iArray *indices,
 
     bool flip = (_topology->GetOrientation() != HdTokens->rightHanded);
 
-    // reset holeIndex
-    holeIndex = 0;
-
     EdgeMap edges;
     if (edgeIndices) {
         edges = ComputeAuthoredEdgeMap(_topology);
     }
 
+    GfVec3i * indicesPtr = indices->data();
+    int * primitiveParamsPtr = primitiveParams->data();
+    GfVec3i * edgeIndicesPtr = edgeIndices ? edgeIndices->data() : nullptr;
+
+    std::atomic<bool> invalidTopology(false);
+
+    // Each face writes into its own output range given by the offset
+    // table, so the faces can be triangulated in parallel.
+    //
     // i  -> authored face index [0, numFaces)
     // tv -> triangulated face index [0, numTris)
     // v  -> index to the first vertex (index) for face i
-    for (int i=0,tv=0,v=0; i<numFaces; ++i) {
-        int nv = numVertsPtr[i];
-        if (nv < 3) {
-            // Skip degenerate faces.
-        } else if (holeIndex < numHoleFaces && holeFacesPtr[holeIndex] == i) {
-            // Skip hole faces.
-            ++holeIndex;
-        } else {
+    WorkParallelForN(
+        numFaces,
+        [&, flip](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            int v  = faceTriangleOffsetsPtr[i*2];
+            int tv = faceTriangleOffsetsPtr[i*2 + 1];
+            if (tv < 0) {
+                // Skip degenerate and hole faces.
+                continue;
+            }
+            int nv = numVertsPtr[i];
+
             // edgeFlag is used for inner-line removal of non-triangle
             // faces on wireframe shading.
             //
@@ -163,7 +248,7 @@ HdMeshUtil::ComputeTriangleIndices(VtVec3iArray *indices,
             int edgeFlag = 0;
             for (int j=0; j < nv-2; ++j) {
                 if (!_FanTriangulate(
-                        &(*indices)[tv],
+                        &indicesPtr[tv],
                         vertsPtr, v, j, numVertIndices, flip)) {
                     invalidTopology = true;
                 }
@@ -175,7 +260,7 @@ HdMeshUtil::ComputeTriangleIndices(VtVec3iArray *indices,
                             // 021 instead of 012, and we'd hide edge 0-1
                             // instead of 0-2; so we rotate the indices to
                             // produce triangle 210.
-                            GfVec3i &index = (*indices)[tv];
+                            GfVec3i &index = indicesPtr[tv];
                             index.Set(index[1], index[2], index[0]);
                         }
                         edgeFlag = 1;
@@ -186,7 +271,7 @@ HdMeshUtil::ComputeTriangleIndices(VtVec3iArray *indices,
                             // 043 instead of 034, and we'd hide edge 0-4
                             // instead of 0-3; so we rotate the indices to
                             // produce triangle 304.
-                            GfVec3i &index = (*indices)[tv];
+                            GfVec3i &index = indicesPtr[tv];
                             index.Set(index[2], index[0], index[1]);
                         }
                         edgeFlag = 2;
@@ -197,8 +282,8 @@ HdMeshUtil::ComputeTriangleIndices(VtVec3iArray *indices,
                 }
 
 
-                if (edgeIndices) {
-                    GfVec3i const& triIndices = (*indices)[tv];
+                if (edgeIndicesPtr) {
+                    GfVec3i const& triIndices = indicesPtr[tv];
                     for (int e=0; e<3; e++) {
                         int ev0 = e;
                         int ev1 = (e==2)? 0 : e+1;
@@ -210,20 +295,18 @@ HdMeshUtil::ComputeTriangleIndices(VtVec3iArray *indices,
                         if (it != edges.end()) {
                             eId = it->second;
                         }
-                        (*edgeIndices)[tv][e] = eId;
+                        edgeIndicesPtr[tv][e] = eId;
                     }
                 }
-                
+
                 // note that ptex indexing isn't available along with
                 // triangulation.
-                (*primitiveParams)[tv] = EncodeCoarseFaceParam(i, edgeFlag);
+                primitiveParamsPtr[tv] = EncodeCoarseFaceParam(i, edgeFlag);
                 ++tv;
             }
         }
-        // When the face is degenerate and nv > 0, we need to increment the v
-        // pointer to walk past the degenerate verts.
-        v += nv;
-    }
+    });
+
     if (invalidTopology) {
         TF_WARN("numVerts and verts are incosistent [%s]",
                 _id.GetText());
@@ -236,7 +319,8 @@ static
 void _TriangulateFaceVarying(
         SdfPath const& id,
         VtIntArray const &faceVertexCounts,
-        VtIntArray const &holeFaces,
+        int const *faceTriangleOffsets,
+        int numTris,
         bool flip,
         void const* sourceUntyped,
         int numElements,
@@ -245,45 +329,33 @@ void _TriangulateFaceVarying(
     T const* source = static_cast<T const*>(sourceUntyped);
 
     // CPU face-varying triangulation
-    bool invalidTopology = false;
-    int numFVarValues = 0;
-    int holeIndex = 0;
-    int numHoleFaces = holeFaces.size();
-    for (int i = 0; i < (int)faceVertexCounts.size(); ++i) {
-        int nv = faceVertexCounts[i] - 2;
-        if (nv < 1) {
-            // skip degenerated face
-            invalidTopology = true;
-        } else if (holeIndex < numHoleFaces && holeFaces[holeIndex] == i) {
-            // skip hole face
-            ++holeIndex;
-        } else {
-            numFVarValues += 3 * nv;
-        }
-    }
-    if (invalidTopology) {
-        TF_WARN("degenerated face found [%s]", id.GetText());
-        invalidTopology = false;
-    }
-
-    VtArray<T> results(numFVarValues);
-    // reset holeIndex
-    holeIndex = 0;
-
-    int dstIndex = 0;
-    for (int i = 0, v = 0; i < (int)faceVertexCounts.size(); ++i) {
-        int nVerts = faceVertexCounts[i];
+    int numFaces = faceVertexCounts.size();
+    int const * numVertsPtr = faceVertexCounts.cdata();
+
+    VtArray<T> results(numTris * 3);
+    T * resultsPtr = results.data();
+
+    std::atomic<bool> invalidTopology(false);
+
+    // The offset table gives each face a disjoint output range, so the
+    // faces can be triangulated in parallel.
+    WorkParallelForN(
+        numFaces,
+        [&, flip](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            int v = faceTriangleOffsets[i*2];
+            int triOffset = faceTriangleOffsets[i*2 + 1];
+            if (triOffset < 0) {
+                // Skip degenerate and hole faces.
+                continue;
+            }
+            int nVerts = numVertsPtr[i];
+            int dstIndex = triOffset * 3;
 
-        if (nVerts < 3) {
-            // Skip degenerate faces.
-        } else if (holeIndex < numHoleFaces && holeFaces[holeIndex] == i) {
-            // Skip hole faces.
-            ++holeIndex;
-        } else {
             // triangulate.
             // apply same triangulation as index does
             for (int j=0; j < nVerts-2; ++j) {
-                if (!_FanTriangulate(&results[dstIndex],
+                if (!_FanTriangulate(&resultsPtr[dstIndex],
                         source, v, j, numElements, flip)) {
                     invalidTopology = true;
                 }
@@ -292,18 +364,20 @@ void _TriangulateFaceVarying(
                 // triangle indices. See ComputeTriangleIndices.
                 if (nVerts > 3 && flip) {
                     if (j == 0) {
-                        std::swap(results[dstIndex], results[dstIndex+1]);
-                        std::swap(results[dstIndex+1], results[dstIndex+2]);
+                        std::swap(resultsPtr[dstIndex], resultsPtr[dstIndex+1]);
+                        std::swap(resultsPtr[dstIndex+1],
+                                  resultsPtr[dstIndex+2]);
                     } else if (j == nVerts-3) {
-                        std::swap(results[dstIndex+1], results[dstIndex+2]);
-                        std::swap(results[dstIndex], results[dstIndex+1]);
+                        std::swap(resultsPtr[dstIndex+1],
+                                  resultsPtr[dstIndex+2]);
+                        std::swap(resultsPtr[dstIndex], resultsPtr[dstIndex+1]);
                     }
                 }
                 dstIndex += 3;
             }
         }
-        v += nVerts;
-    }
+    });
+
     if (invalidTopology) {
         TF_WARN("numVerts and verts are incosistent [%s]", id.GetText());
     }
@@ -331,44 +405,60 @@ HdMeshUtil::ComputeTriangulatedFaceVaryingPrimvar(void const* source,
     VtIntArray const &faceVertexCounts = _topology->GetFaceVertexCounts();
 
     // Faces tagged as holes can be skipped over only when not refined.
-    VtIntArray const &holeFaces =
+    VtIntArray const holeFaces =
         (_topology->GetRefineLevel() > 0)
             ? VtIntArray()
             : _topology->GetHoleIndices();
 
+    int numTris = 0;
+    bool invalidFaces = false;
+    VtIntArray const &faceTriangleOffsets =
+        _GetFaceTriangleOffsets(holeFaces, &numTris, &invalidFaces);
+    if (invalidFaces) {
+        TF_WARN("degenerated face found [%s]", _id.GetText());
+    }
+
     bool flip = (_topology->GetOrientation() != HdTokens->rightHanded);
 
     switch (dataType) {
     case HdTypeFloat:
-        _TriangulateFaceVarying<float>(_id, faceVertexCounts, holeFaces, flip,
+        _TriangulateFaceVarying<float>(_id, faceVertexCounts,
+                faceTriangleOffsets.cdata(), numTris, flip,
                 source, numElements, triangulated);
         break;
     case HdTypeFloatVec2:
-        _TriangulateFaceVarying<GfVec2f>(_id, faceVertexCounts, holeFaces, flip,
+        _TriangulateFaceVarying<GfVec2f>(_id, faceVertexCounts,
+                faceTriangleOffsets.cdata(), numTris, flip,
                 source, numElements, triangulated);
         break;
     case HdTypeFloatVec3:
-        _TriangulateFaceVarying<GfVec3f>(_id, faceVertexCounts, holeFaces, flip,
+        _TriangulateFaceVarying<GfVec3f>(_id, faceVertexCounts,
+                faceTriangleOffsets.cdata(), numTris, flip,
                 source, numElements, triangulated);
         break;
     case HdTypeFloatVec4:
-        _TriangulateFaceVarying<GfVec4f>(_id, faceVertexCounts, holeFaces, flip,
+        _TriangulateFaceVarying<GfVec4f>(_id, faceVertexCounts,
+                faceTriangleOffsets.cdata(), numTris, flip,
                 source, numElements, triangulated);
         break;
     case HdTypeDouble:
-        _TriangulateFaceVarying<double>(_id, faceVertexCounts, holeFaces, flip,
+        _TriangulateFaceVarying<double>(_id, faceVertexCounts,
+                faceTriangleOffsets.cdata(), numTris, flip,
                 source, numElements, triangulated);
         break;
     case HdTypeDoubleVec2:
-        _TriangulateFaceVarying<GfVec2d>(_id, faceVertexCounts, holeFaces, flip,
+        _TriangulateFaceVarying<GfVec2d>(_id, faceVertexCounts,
+                faceTriangleOffsets.cdata(), numTris, flip,
                 source, numElements, triangulated);
         break;
     case HdTypeDoubleVec3:
-        _TriangulateFaceVarying<GfVec3d>(_id, faceVertexCounts, holeFaces, flip,
+        _TriangulateFaceVarying<GfVec3d>(_id, faceVertexCounts,
+                faceTriangleOffsets.cdata(), numTris, flip,
                 source, numElements, triangulated);
         break;
     case HdTypeDoubleVec4:
-        _TriangulateFaceVarying<GfVec4d>(_id, faceVertexCounts, holeFaces, flip,
+        _TriangulateFaceVarying<GfVec4d>(_id, faceVertexCounts,
+                faceTriangleOffsets.cdata(), numTris, flip,
                 source, numElements, triangulated);
         break;
     default:
@@ -528,8 +618,6 @@ HdMeshUtil::ComputeQuadIndices(VtVec4iArray *indices,
         invalidTopology = false;
     }
 
-    int holeIndex = 0;
-
     indices->resize(numQuads);
     primitiveParams->resize(numQuads);
     if (quadsEdgeIndices) {
@@ -538,154 +626,194 @@ HdMeshUtil::ComputeQuadIndices(VtVec4iArray *indices,
 
     // quadrangulated verts is added to the end.
     bool flip = (_topology->GetOrientation() != HdTokens->rightHanded);
-    int vertIndex = numPoints;
 
     EdgeMap edges;
     if (quadsEdgeIndices) {
         edges = ComputeAuthoredEdgeMap(_topology);
     }
 
+    // Compute per-face offsets so that every face writes a disjoint range
+    // of quads, vertex indices and additional (edge/center) points, which
+    // lets the faces be quadrangulated in parallel.  Hole faces are found
+    // by binary search, which (like the serial walk this replaces) relies
+    // on the hole indices being in ascending order.
+    std::vector<int> vertOffsets(numFaces);
+    WorkParallelExclusiveScan(
+        numVertsPtr, numFaces, vertOffsets.begin(), 0, std::plus<int>());
+
+    std::vector<int> quadOffsets(numFaces);
+    std::vector<int> addOffsets(numFaces);
+    std::vector<char> skips(numFaces);
+    WorkParallelForN(
+        numFaces,
+        [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            int nv = numVertsPtr[i];
+            if (nv < 3 ||
+                std::binary_search(
+                    holeFacesPtr, holeFacesPtr + numHoleFaces, int(i))) {
+                skips[i] = 1;
+                quadOffsets[i] = 0;
+                addOffsets[i] = 0;
+                continue;
+            }
+            skips[i] = 0;
+            quadOffsets[i] = (nv == 4) ? 1 : nv;
+            // Faces whose vertex indices run off the end of the topology
+            // emit placeholder quads and no additional points.
+            addOffsets[i] =
+                (nv == 4 || vertOffsets[i] + nv > numVertIndices)
+                ? 0 : nv + 1;
+        }
+    });
+    WorkParallelExclusiveScan(
+        quadOffsets.begin(), numFaces, quadOffsets.begin(), 0,
+        std::plus<int>());
+    WorkParallelExclusiveScan(
+        addOffsets.begin(), numFaces, addOffsets.begin(), 0,
+        std::plus<int>());
+
+    std::atomic<bool> invalidIndices(false);
+
     // TODO: We need to support ptex index in addition to coarse indices.
     //int ptexIndex = 0;
-    
+
     // i  -> authored face index [0, numFaces)
     // qv -> quadrangulated face index [0, numQuads)
     // v  -> index to the first vertex (index) for face i
     // vertIndex -> index to the start of the additional verts (edge, center)
     //              for face i
-    for (int i = 0, qv = 0, v = 0; i<numFaces; ++i) {
-        int nv = numVertsPtr[i];
-        if (nv < 3) {
-            v += nv;
-            continue; // skip degenerated face
-        }
-        if (holeIndex < numHoleFaces &&
-            holeFacesPtr[holeIndex] == i) {
-            // skip hole faces.
-            ++holeIndex;
-            v += nv;
-            continue;
-        }
-
-        if (v+nv > numVertIndices) {
-            invalidTopology = true;
-            if (nv == 4) {
-                (*indices)[qv++] = GfVec4i(0);
-            } else {
-                for (int j = 0; j < nv; ++j) {
-                    (*indices)[qv++] = GfVec4i(0);
-                }
-            }
-            v += nv;
-            continue;
-        }
-
-        if (nv == 4) {
-            if (flip) {
-                (*indices)[qv][0] = (vertsPtr[v+0]);
-                (*indices)[qv][1] = (vertsPtr[v+3]);
-                (*indices)[qv][2] = (vertsPtr[v+2]);
-                (*indices)[qv][3] = (vertsPtr[v+1]);
-            } else {
-                (*indices)[qv][0] = (vertsPtr[v+0]);
-                (*indices)[qv][1] = (vertsPtr[v+1]);
-                (*indices)[qv][2] = (vertsPtr[v+2]);
-                (*indices)[qv][3] = (vertsPtr[v+3]);
+    WorkParallelForN(
+        numFaces,
+        [&, flip](size_t begin, size_t end) {
+        for (size_t fi = begin; fi < end; ++fi) {
+            int i = int(fi);
+            if (skips[i]) {
+                // skip degenerated and hole faces.
+                continue;
             }
-
-            //  Case             EdgeFlag    Draw
-            //  Quad/Refined face   0        hide common edge for the tri-pair
-            //  Non-Quad face       1/2/3    hide common edge for the tri-pair & 
-            //                               hide interior quadrangulated edges
-            //
-            //  The first quad of a non-quad face is marked 1; the last as 2; and
-            //  intermediate quads as 3.
-
-            (*primitiveParams)[qv] = GfVec2i(
-                EncodeCoarseFaceParam(i, /*edgeFlag=*/0), qv);
-
-            if (quadsEdgeIndices) {
-                GfVec4i const& quadIndices = (*indices)[qv];
-                for(int e = 0; e < nv; ++e) {
-                    GfVec2i edge(quadIndices[e], quadIndices[(e+1)%nv]);
-                    // since this is an authored quad, all edges are guaranteed
-                    // to exist in the authored edge map
-                    auto it = edges.find(edge);
-                    TF_VERIFY(it != edges.end());
-                    (*quadsEdgeIndices)[qv][e] = it->second; // authored edge id
+            int nv = numVertsPtr[i];
+            int v = vertOffsets[i];
+            int qv = quadOffsets[i];
+            int vertIndex = numPoints + addOffsets[i];
+
+            if (v+nv > numVertIndices) {
+                invalidIndices = true;
+                if (nv == 4) {
+                    (*indices)[qv++] = GfVec4i(0);
+                } else {
+                    for (int j = 0; j < nv; ++j) {
+                        (*indices)[qv++] = GfVec4i(0);
+                    }
                 }
+                continue;
             }
 
-            ++qv;
-        } else {
-            // quadrangulate non-quad faces
-            // the additional points (edge and center) are stored at the end of
-            // original points, as
-            //   last point, e0, e1, ..., en, center, e0, e1, ...
-            // so each sub-quads become
-            // *first non-quad
-            //   v0, e0, center, e(-1),
-            //   v1, e1, center, e0,
-            //...
-            // *second non-quad
-            //   ...
-            for (int j = 0; j < nv; ++j) {
-                // vertex
-                (*indices)[qv][0] = vertsPtr[v+j];
+            if (nv == 4) {
                 if (flip) {
-                    // edge prev
-                    (*indices)[qv][1] = vertIndex + (j+nv-1)%nv;
-                    // center
-                    (*indices)[qv][2] = vertIndex + nv;
-                    // edge next
-                    (*indices)[qv][3] = vertIndex + j;
-                } else {
-                    // edge next
-                    (*indices)[qv][1] = vertIndex + j;
-                    // center
-                    (*indices)[qv][2] = vertIndex + nv;
-                    // edge prev
-                    (*indices)[qv][3] = vertIndex + (j+nv-1)%nv;
-                }
-                // edge flag != 0 => quad face is from quadrangulation
-                // it is used to hide internal edges (edge-center) of the quad
-                // The first quad gets flag = 1, intermediate quads get flag = 3
-                // and the last quad gets flag = 2, so computations can tell
-                // how quads are grouped by looking at edge flags.
-                int edgeFlag = 0;
-                if (j == 0) {
-                    edgeFlag = 1;
-                } else if (j == nv - 1) {
-                    edgeFlag = 2;
+                    (*indices)[qv][0] = (vertsPtr[v+0]);
+                    (*indices)[qv][1] = (vertsPtr[v+3]);
+                    (*indices)[qv][2] = (vertsPtr[v+2]);
+                    (*indices)[qv][3] = (vertsPtr[v+1]);
                 } else {
-                    edgeFlag = 3;
+                    (*indices)[qv][0] = (vertsPtr[v+0]);
+                    (*indices)[qv][1] = (vertsPtr[v+1]);
+                    (*indices)[qv][2] = (vertsPtr[v+2]);
+                    (*indices)[qv][3] = (vertsPtr[v+3]);
                 }
+
+                //  Case             EdgeFlag    Draw
+                //  Quad/Refined face   0        hide common edge for the tri-pair
+                //  Non-Quad face       1/2/3    hide common edge for the tri-pair & 
+                //                               hide interior quadrangulated edges
+                //
+                //  The first quad of a non-quad face is marked 1; the last as 2; and
+                //  intermediate quads as 3.
+
                 (*primitiveParams)[qv] = GfVec2i(
-                    EncodeCoarseFaceParam(i, edgeFlag), qv);
+                    EncodeCoarseFaceParam(i, /*edgeFlag=*/0), qv);
 
                 if (quadsEdgeIndices) {
-                    // only the first (index 0) and last (index 3) edges of the
-                    // quad are from the authored edges; the other 2 are the
-                    // result of quadrangulation.
-                    GfVec2i e0 = GfVec2i(vertsPtr[v+j], vertsPtr[v+(j+1)%nv]);
-                    GfVec2i e3 = GfVec2i(vertsPtr[v+(j+nv-1)%nv], vertsPtr[v+j]);
-                    auto it = edges.find(e0);
-                    TF_VERIFY(it != edges.end());
-                    (*quadsEdgeIndices)[qv][0] = it->second;
-                    (*quadsEdgeIndices)[qv][1] = -1;
-                    (*quadsEdgeIndices)[qv][2] = -1;
-                    it = edges.find(e3);
-                    TF_VERIFY(it != edges.end());
-                    (*quadsEdgeIndices)[qv][3] = it->second;
+                    GfVec4i const& quadIndices = (*indices)[qv];
+                    for(int e = 0; e < nv; ++e) {
+                        GfVec2i edge(quadIndices[e], quadIndices[(e+1)%nv]);
+                        // since this is an authored quad, all edges are guaranteed
+                        // to exist in the authored edge map
+                        auto it = edges.find(edge);
+                        TF_VERIFY(it != edges.end());
+                        (*quadsEdgeIndices)[qv][e] = it->second; // authored edge id
+                    }
                 }
-                
+
                 ++qv;
+            } else {
+                // quadrangulate non-quad faces
+                // the additional points (edge and center) are stored at the end of
+                // original points, as
+                //   last point, e0, e1, ..., en, center, e0, e1, ...
+                // so each sub-quads become
+                // *first non-quad
+                //   v0, e0, center, e(-1),
+                //   v1, e1, center, e0,
+                //...
+                // *second non-quad
+                //   ...
+                for (int j = 0; j < nv; ++j) {
+                    // vertex
+                    (*indices)[qv][0] = vertsPtr[v+j];
+                    if (flip) {
+                        // edge prev
+                        (*indices)[qv][1] = vertIndex + (j+nv-1)%nv;
+                        // center
+                        (*indices)[qv][2] = vertIndex + nv;
+                        // edge next
+                        (*indices)[qv][3] = vertIndex + j;
+                    } else {
+                        // edge next
+                        (*indices)[qv][1] = vertIndex + j;
+                        // center
+                        (*indices)[qv][2] = vertIndex + nv;
+                        // edge prev
+                        (*indices)[qv][3] = vertIndex + (j+nv-1)%nv;
+                    }
+                    // edge flag != 0 => quad face is from quadrangulation
+                    // it is used to hide internal edges (edge-center) of the quad
+                    // The first quad gets flag = 1, intermediate quads get flag = 3
+                    // and the last quad gets flag = 2, so computations can tell
+                    // how quads are grouped by looking at edge flags.
+                    int edgeFlag = 0;
+                    if (j == 0) {
+                        edgeFlag = 1;
+                    } else if (j == nv - 1) {
+                        edgeFlag = 2;
+                    } else {
+                        edgeFlag = 3;
+                    }
+                    (*primitiveParams)[qv] = GfVec2i(
+                        EncodeCoarseFaceParam(i, edgeFlag), qv);
+
+                    if (quadsEdgeIndices) {
+                        // only the first (index 0) and last (index 3) edges of the
+                        // quad are from the authored edges; the other 2 are the
+                        // result of quadrangulation.
+                        GfVec2i e0 = GfVec2i(vertsPtr[v+j], vertsPtr[v+(j+1)%nv]);
+                        GfVec2i e3 = GfVec2i(vertsPtr[v+(j+nv-1)%nv], vertsPtr[v+j]);
+                        auto it = edges.find(e0);
+                        TF_VERIFY(it != edges.end());
+                        (*quadsEdgeIndices)[qv][0] = it->second;
+                        (*quadsEdgeIndices)[qv][1] = -1;
+                        (*quadsEdgeIndices)[qv][2] = -1;
+                        it = edges.find(e3);
+                        TF_VERIFY(it != edges.end());
+                        (*quadsEdgeIndices)[qv][3] = it->second;
+                    }
+                
+                    ++qv;
+                }
             }
-            vertIndex += nv + 1;
         }
-        v += nv;
-    }
-    if (invalidTopology) {
+    });
+    if (invalidIndices) {
         TF_WARN("numVerts and verts are incosistent [%s]", _id.GetText());
     }
 }
@@ -920,11 +1048,19 @@ HdMeshUtil::ComputeQuadrangulatedFaceVaryingPrimvar(
     VtIntArray const &faceVertexCounts = _topology->GetFaceVertexCounts();
 
     // Faces tagged as holes can be skipped over only when not refined.
-    VtIntArray const &holeFaces =
+    VtIntArray const holeFaces =
         (_topology->GetRefineLevel() > 0)
             ? VtIntArray()
             : _topology->GetHoleIndices();
 
+    int numTris = 0;
+    bool invalidFaces = false;
+    VtIntArray const &faceTriangleOffsets =
+        _GetFaceTriangleOffsets(holeFaces, &numTris, &invalidFaces);
+    if (invalidFaces) {
+        TF_WARN("degenerated face found [%s]", _id.GetText());
+    }
+
     bool flip = (_topology->GetOrientation() != HdTokens->rightHanded);
 
     switch (dataType) {
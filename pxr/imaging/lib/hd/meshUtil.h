@@ -83,7 +83,11 @@ class HdMeshUtil
 {
 public:
     HdMeshUtil(HdMeshTopology const* topology, SdfPath const& id)
-        : _topology(topology), _id(id) {}
+        : _topology(topology), _id(id)
+    {
+        _faceTriangleCounts[0] = _faceTriangleCounts[1] = -1;
+        _faceTriangleInvalid[0] = _faceTriangleInvalid[1] = false;
+    }
     virtual ~HdMeshUtil() {}
 
     // --------------------------------------------------------------------
@@ -243,8 +247,29 @@ public:
     GetAuthoredEdgeID(HdMeshTopology const* topology,
                       GfVec2i edge);
 private:
+    // Computes, for each authored face, the offset of its first vertex
+    // index and the index of its first output triangle under fan
+    // triangulation, stored as two ints per face.  Faces that produce no
+    // triangles (hole and degenerate faces) get a triangle index of -1.
+    // The table is cached on the instance so that index generation and
+    // triangulation of multiple face-varying primvars share one mapping,
+    // and it is what allows those operations to fill their outputs in
+    // parallel across face ranges.  Returns the total triangle count in
+    // *numTrisOut and whether degenerate faces were found in
+    // *invalidFacesOut.
+    VtIntArray const &_GetFaceTriangleOffsets(VtIntArray const &holeFaces,
+                                              int *numTrisOut,
+                                              bool *invalidFacesOut) const;
+
     HdMeshTopology const* _topology;
     SdfPath const _id;
+
+    // Cached triangulation mapping tables; slot 0 is used when hole faces
+    // are applied, slot 1 when they are ignored (refined face-varying
+    // primvars).
+    mutable VtIntArray _faceTriangleOffsets[2];
+    mutable int _faceTriangleCounts[2];
+    mutable bool _faceTriangleInvalid[2];
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
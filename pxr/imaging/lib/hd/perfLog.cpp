@@ -35,6 +35,20 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 TF_INSTANTIATE_SINGLETON(HdPerfLog);
 
+thread_local HdPerfLog::_Shard *HdPerfLog::_localShard = nullptr;
+
+HdPerfLog::_Shard &
+HdPerfLog::_GetLocalShard()
+{
+    _Shard *shard = _localShard;
+    if (ARCH_UNLIKELY(!shard)) {
+        _Lock lock(_mutex);
+        _shards.push_back(std::unique_ptr<_Shard>(new _Shard));
+        shard = _localShard = _shards.back().get();
+    }
+    return *shard;
+}
+
 static
 bool
 _IsEnabledPerfLog()
@@ -62,13 +76,15 @@ HdPerfLog::AddCacheHit(TfToken const& name,
 {
     if (ARCH_LIKELY(!_enabled))
         return;
-    _Lock lock(_mutex);
-    _cacheMap[name].AddHit();
-    TF_DEBUG(HD_CACHE_HITS).Msg("Cache hit: %s %s %s hits: %lu\n",
+    _Shard &shard = _GetLocalShard();
+    _Lock lock(shard.mutex);
+    _CacheEntry &entry = shard.cacheDeltas[name];
+    entry.AddHit();
+    TF_DEBUG(HD_CACHE_HITS).Msg("Cache hit: %s %s %s thread-local hits: %lu\n",
             name.GetText(),
             id.GetText(),
             tag.GetText(),
-            _cacheMap[name].GetHits());
+            entry.GetHits());
 }
 
 void
@@ -78,13 +94,16 @@ HdPerfLog::AddCacheMiss(TfToken const& name,
 {
     if (ARCH_LIKELY(!_enabled))
         return;
-    _Lock lock(_mutex);
-    _cacheMap[name].AddMiss();
-    TF_DEBUG(HD_CACHE_MISSES).Msg("Cache miss: %s %s %s Total misses: %lu\n",
+    _Shard &shard = _GetLocalShard();
+    _Lock lock(shard.mutex);
+    _CacheEntry &entry = shard.cacheDeltas[name];
+    entry.AddMiss();
+    TF_DEBUG(HD_CACHE_MISSES).Msg(
+            "Cache miss: %s %s %s thread-local misses: %lu\n",
             name.GetText(),
             id.GetText(),
             tag.GetText(),
-            _cacheMap[name].GetMisses());
+            entry.GetMisses());
 }
 
 void
@@ -94,34 +113,51 @@ HdPerfLog::ResetCache(TfToken const& name)
         return;
     _Lock lock(_mutex);
     _cacheMap[name].Reset();
+    TF_FOR_ALL(shardIt, _shards) {
+        _Lock shardLock((*shardIt)->mutex);
+        (*shardIt)->cacheDeltas.erase(name);
+    }
+}
+
+// Sums the base _CacheEntry for \p name with every shard's entry.
+HdPerfLog::_CacheEntry
+HdPerfLog::_AggregateCacheEntry(TfToken const& name)
+{
+    // Note: callers hold _mutex.
+    _CacheEntry total;
+    if (_CacheEntry* value = TfMapLookupPtr(_cacheMap, name)) {
+        total = *value;
+    }
+    TF_FOR_ALL(shardIt, _shards) {
+        _Lock shardLock((*shardIt)->mutex);
+        if (_CacheEntry* value =
+                TfMapLookupPtr((*shardIt)->cacheDeltas, name)) {
+            total.Add(*value);
+        }
+    }
+    return total;
 }
- 
+
 double
 HdPerfLog::GetCacheHitRatio(TfToken const& name)
 {
     _Lock lock(_mutex);
-    if (HdPerfLog::_CacheEntry* value = TfMapLookupPtr(_cacheMap, name)) {
-        return value->GetHitRatio();
-    }
-    return 0.0;
+    _CacheEntry entry = _AggregateCacheEntry(name);
+    return entry.GetTotal() ? entry.GetHitRatio() : 0.0;
 }
 
 size_t
 HdPerfLog::GetCacheHits(TfToken const& name)
 {
     _Lock lock(_mutex);
-    if (HdPerfLog::_CacheEntry* value = TfMapLookupPtr(_cacheMap, name))
-        return value->GetHits();
-    return 0;
+    return _AggregateCacheEntry(name).GetHits();
 }
 
 size_t
 HdPerfLog::GetCacheMisses(TfToken const& name)
 {
     _Lock lock(_mutex);
-    if (HdPerfLog::_CacheEntry* value = TfMapLookupPtr(_cacheMap, name))
-        return value->GetMisses();
-    return 0;
+    return _AggregateCacheEntry(name).GetMisses();
 }
 
 TfTokenVector
@@ -133,11 +169,18 @@ HdPerfLog::GetCacheNames()
     TF_FOR_ALL(tokCacheIt, _cacheMap) {
         names.push_back(tokCacheIt->first);
     }
+    TF_FOR_ALL(shardIt, _shards) {
+        _Lock shardLock((*shardIt)->mutex);
+        TF_FOR_ALL(it, (*shardIt)->cacheDeltas) {
+            names.push_back(it->first);
+        }
+    }
     std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
     return names;
 }
 
-TfTokenVector 
+TfTokenVector
 HdPerfLog::GetCounterNames()
 {
     _Lock lock(_mutex);
@@ -146,40 +189,55 @@ HdPerfLog::GetCounterNames()
     TF_FOR_ALL(it, _counterMap) {
         names.push_back(it->first);
     }
+    TF_FOR_ALL(shardIt, _shards) {
+        _Lock shardLock((*shardIt)->mutex);
+        TF_FOR_ALL(it, (*shardIt)->counterDeltas) {
+            names.push_back(it->first);
+        }
+    }
     std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
     return names;
 }
 
+// Accumulates a counter delta into the calling thread's shard.  The
+// debug message reports the thread-local tally; the global value is
+// only computed on read, so other threads' shards are never touched on
+// the hot path.
+void
+HdPerfLog::_AddCounterDelta(TfToken const& name, double delta)
+{
+    _Shard &shard = _GetLocalShard();
+    _Lock lock(shard.mutex);
+    double &value = shard.counterDeltas[name];
+    value += delta;
+    TF_DEBUG(HD_COUNTER_CHANGED).Msg(
+            "Counter changed %s: %f -> %f (thread-local)\n",
+            name.GetText(),
+            value - delta,
+            value);
+}
+
 void
 HdPerfLog::IncrementCounter(TfToken const& name)
 {
-    if (ARCH_LIKELY(!_enabled)) 
+    if (ARCH_LIKELY(!_enabled))
         return;
-    _Lock lock(_mutex);
-    TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s: %f -> %f\n",
-            name.GetText(),
-            _counterMap[name],
-            _counterMap[name] + 1.0);
-    _counterMap[name] += 1.0;
+    _AddCounterDelta(name, 1.0);
 }
 
 void
 HdPerfLog::DecrementCounter(TfToken const& name)
 {
-    if (ARCH_LIKELY(!_enabled)) 
+    if (ARCH_LIKELY(!_enabled))
         return;
-    _Lock lock(_mutex);
-    TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s: %f -> %f\n",
-            name.GetText(),
-            _counterMap[name],
-            _counterMap[name] - 1.0);
-    _counterMap[name] -= 1.0;
+    _AddCounterDelta(name, -1.0);
 }
 
 void
 HdPerfLog::SetCounter(TfToken const& name, double value)
 {
-    if (ARCH_LIKELY(!_enabled)) 
+    if (ARCH_LIKELY(!_enabled))
         return;
     _Lock lock(_mutex);
     TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s: %f -> %f\n",
@@ -187,6 +245,12 @@ HdPerfLog::SetCounter(TfToken const& name, double value)
             _counterMap[name],
             value);
     _counterMap[name] = value;
+    // The base map now holds the absolute value; drop any accumulated
+    // per-thread deltas for this counter.
+    TF_FOR_ALL(shardIt, _shards) {
+        _Lock shardLock((*shardIt)->mutex);
+        (*shardIt)->counterDeltas.erase(name);
+    }
 }
 
 void
@@ -194,12 +258,7 @@ HdPerfLog::AddCounter(TfToken const &name, double value)
 {
     if (ARCH_LIKELY(!_enabled))
         return;
-    _Lock lock(_mutex);
-    TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s %f -> %f\n",
-            name.GetText(),
-            _counterMap[name],
-            _counterMap[name] + value);
-    _counterMap[name] += value;
+    _AddCounterDelta(name, value);
 }
 
 void
@@ -207,19 +266,19 @@ HdPerfLog::SubtractCounter(TfToken const &name, double value)
 {
     if (ARCH_LIKELY(!_enabled))
         return;
-    _Lock lock(_mutex);
-    TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s %f -> %f\n",
-            name.GetText(),
-            _counterMap[name],
-            _counterMap[name] - value);
-    _counterMap[name] -= value;
+    _AddCounterDelta(name, -value);
 }
 
 double
 HdPerfLog::GetCounter(TfToken const& name)
 {
     _Lock lock(_mutex);
-    return TfMapLookupByValue(_counterMap, name, 0.0);
+    double value = TfMapLookupByValue(_counterMap, name, 0.0);
+    TF_FOR_ALL(shardIt, _shards) {
+        _Lock shardLock((*shardIt)->mutex);
+        value += TfMapLookupByValue((*shardIt)->counterDeltas, name, 0.0);
+    }
+    return value;
 }
 
 void
@@ -234,6 +293,10 @@ HdPerfLog::ResetCounters()
                                          counterIt->second);
         counterIt->second = 0;
     }
+    TF_FOR_ALL(shardIt, _shards) {
+        _Lock shardLock((*shardIt)->mutex);
+        (*shardIt)->counterDeltas.clear();
+    }
 }
 
 void 
@@ -39,7 +39,9 @@
 #include <boost/shared_ptr.hpp>
 #include "pxr/base/tf/hashmap.h"
 
+#include <memory>
 #include <mutex>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -207,6 +209,12 @@ private:
         size_t GetTotal() {return _hits+_misses;}
         double GetHitRatio() {return (double)_hits / GetTotal();}
 
+        // Accumulates another entry, for aggregating per-thread shards.
+        void Add(_CacheEntry const &other) {
+            _hits += other._hits;
+            _misses += other._misses;
+        }
+
         void Reset() { _hits = 0; _misses = 0; }
     private:
         size_t _hits;
@@ -221,6 +229,32 @@ private:
     typedef TfHashMap<TfToken, double, TfToken::HashFunctor> _CounterMap;
     _CounterMap _counterMap;
 
+    // A per-thread shard of counter and cache state.  Hot-path updates
+    // mutate the calling thread's own shard under its mutex, which is
+    // never contended by other writers, so enabling perf logging during
+    // parallel sync does not serialize the threads being measured.
+    // Readers aggregate the base maps above with every shard.
+    struct _Shard {
+        _CounterMap counterDeltas;
+        _CacheMap cacheDeltas;
+        std::mutex mutex;
+    };
+
+    // Returns the calling thread's shard, creating it on first use.
+    HD_API _Shard &_GetLocalShard();
+
+    // Returns the sum of the base cache entry for \p name and every
+    // shard's entry for it.  Callers must hold _mutex.
+    _CacheEntry _AggregateCacheEntry(TfToken const &name);
+
+    // Accumulates \p delta into the calling thread's shard.
+    HD_API void _AddCounterDelta(TfToken const &name, double delta);
+
+    // All shards, in thread creation order; guarded by _mutex.  Shards
+    // are retained when threads exit so their tallies are not lost.
+    std::vector<std::unique_ptr<_Shard>> _shards;
+    static thread_local _Shard *_localShard;
+
     // Resource registry vector.
     std::vector<HdResourceRegistrySharedPtr> _resourceRegistryVector;
 
@@ -45,6 +45,7 @@
 
 #include "pxr/base/work/arenaDispatcher.h"
 #include "pxr/base/work/loops.h"
+#include "pxr/base/work/taskGraph.h"
 #include "pxr/base/tf/pyLock.h"
 
 #include <iostream>
@@ -73,6 +74,8 @@ HdRenderIndex::HdRenderIndex(HdRenderDelegate *renderDelegate)
     , _renderDelegate(renderDelegate)
     , _activeRenderTags()
     , _renderTagVersion(_tracker.GetRenderTagVersion() - 1)
+    , _renderTagIdsIndexVersion(_tracker.GetRprimIndexVersion() - 1)
+    , _renderTagIdsTagVersion(_tracker.GetRenderTagVersion() - 1)
 {
     // Note: HdRenderIndex::New(...) guarantees renderDelegate is non-null.
 
@@ -170,6 +173,63 @@ HdRenderIndex::InsertRprim(TfToken const& typeId,
     }
 }
 
+void
+HdRenderIndex::InsertRprims(std::vector<RprimDescriptor> const& descriptors)
+{
+    HD_TRACE_FUNCTION();
+    HF_MALLOC_TAG_FUNCTION();
+
+    _rprimMap.reserve(_rprimMap.size() + descriptors.size());
+
+    // Collect the inserted ids and their initial dirty bits so that the
+    // change tracker can be told about the whole batch at once.
+    std::vector<std::pair<SdfPath, HdDirtyBits>> insertedRprims;
+    insertedRprims.reserve(descriptors.size());
+
+    for (const RprimDescriptor& desc : descriptors) {
+        // Apply the same checks as InsertRprim(); the map lookup also
+        // catches duplicates within the batch itself.
+        if (ARCH_UNLIKELY(TfMapLookupPtr(_rprimMap, desc.rprimId))) {
+            continue;
+        }
+
+        SdfPath const &sceneDelegateId = desc.sceneDelegate->GetDelegateID();
+        if (!desc.rprimId.HasPrefix(sceneDelegateId)) {
+            TF_CODING_ERROR("Scene Delegate Id (%s) must prefix prim Id (%s)",
+                            sceneDelegateId.GetText(),
+                            desc.rprimId.GetText());
+            continue;
+        }
+
+        HdRprim *rprim = _renderDelegate->CreateRprim(desc.typeId,
+                                                      desc.rprimId,
+                                                      desc.instancerId);
+        if (rprim == nullptr) {
+            continue;
+        }
+
+        _rprimIds.Insert(desc.rprimId);
+
+        insertedRprims.emplace_back(desc.rprimId,
+                                    rprim->GetInitialDirtyBitsMask());
+        _AllocatePrimId(rprim);
+
+        _RprimInfo info = {
+            desc.sceneDelegate,
+            rprim
+        };
+        _rprimMap[desc.rprimId] = std::move(info);
+
+        SdfPath instanceId = rprim->GetInstancerId();
+
+        if (!instanceId.IsEmpty()) {
+            _tracker.InstancerRPrimInserted(instanceId, desc.rprimId);
+        }
+    }
+
+    _tracker.RprimsInserted(insertedRprims);
+}
+
 void
 HdRenderIndex::RemoveRprim(SdfPath const& id)
 {
@@ -669,22 +729,43 @@ HdRenderIndex::GetDrawItems(HdRprimCollection const& collection,
 {
     HD_TRACE_FUNCTION();
 
-    SdfPathVector rprimIds;
-
-    const SdfPathVector &paths        = GetRprimIds();
-    const SdfPathVector &includePaths = collection.GetRootPaths();
-    const SdfPathVector &excludePaths = collection.GetExcludePaths();
-
-    _FilterParam filterParam = {collection, renderTags, this};
-
-    HdPrimGather gather;
+    // The filter result depends on the rprim set and on the render and
+    // material tags of the prims; the latter bump the render tag and batch
+    // versions respectively when they change.  On matching versions, reuse
+    // the previously gathered ids rather than re-filtering the whole index.
+    const unsigned rprimIndexVersion = _tracker.GetRprimIndexVersion();
+    const unsigned renderTagVersion  = _tracker.GetRenderTagVersion();
+    const unsigned batchVersion      = _tracker.GetBatchVersion();
+
+    size_t cacheKey = hash_value(collection);
+    boost::hash_range(cacheKey, renderTags.begin(), renderTags.end());
+
+    _GatherCacheEntry &entry = _drawItemGatherCache[cacheKey];
+    if (entry.rprimIndexVersion != rprimIndexVersion ||
+        entry.renderTagVersion  != renderTagVersion  ||
+        entry.batchVersion      != batchVersion) {
+        entry.rprimIndexVersion = rprimIndexVersion;
+        entry.renderTagVersion  = renderTagVersion;
+        entry.batchVersion      = batchVersion;
+        entry.ids.clear();
+
+        const SdfPathVector &paths        = GetRprimIds();
+        const SdfPathVector &includePaths = collection.GetRootPaths();
+        const SdfPathVector &excludePaths = collection.GetExcludePaths();
+
+        _FilterParam filterParam = {collection, renderTags, this};
+
+        HdPrimGather gather;
+
+        gather.PredicatedFilter(paths,
+                                includePaths,
+                                excludePaths,
+                                _DrawItemFilterPredicate,
+                                &filterParam,
+                                &entry.ids);
+    }
 
-    gather.PredicatedFilter(paths,
-                            includePaths,
-                            excludePaths,
-                            _DrawItemFilterPredicate,
-                            &filterParam,
-                            &rprimIds);
+    const SdfPathVector &rprimIds = entry.ids;
 
     _ConcurrentDrawItems concurrentDrawItems;
 
@@ -737,12 +818,47 @@ HdRenderIndex::GetMaterialTag(SdfPath const& id) const
 SdfPathVector
 HdRenderIndex::GetRprimSubtree(SdfPath const& rootPath)
 {
-    SdfPathVector paths;
+    // The subtree result depends only on the rprim set, so it stays valid
+    // until an rprim is inserted or removed.
+    const unsigned rprimIndexVersion = _tracker.GetRprimIndexVersion();
 
-    HdPrimGather gather;
-    gather.Subtree(_rprimIds.GetIds(), rootPath, &paths);
+    _GatherCacheEntry &entry = _subtreeGatherCache[rootPath];
+    if (entry.rprimIndexVersion != rprimIndexVersion) {
+        entry.rprimIndexVersion = rprimIndexVersion;
+        entry.ids.clear();
 
-    return paths;
+        HdPrimGather gather;
+        gather.Subtree(_rprimIds.GetIds(), rootPath, &entry.ids);
+    }
+
+    return entry.ids;
+}
+
+const SdfPathVector &
+HdRenderIndex::GetRprimIdsWithRenderTag(TfToken const &renderTag)
+{
+    const unsigned rprimIndexVersion = _tracker.GetRprimIndexVersion();
+    const unsigned renderTagVersion  = _tracker.GetRenderTagVersion();
+
+    if (_renderTagIdsIndexVersion != rprimIndexVersion ||
+        _renderTagIdsTagVersion   != renderTagVersion) {
+        HD_TRACE_FUNCTION();
+
+        _renderTagIdsIndexVersion = rprimIndexVersion;
+        _renderTagIdsTagVersion   = renderTagVersion;
+
+        // A single scan partitions every tag's list at once, so asking for
+        // a different tag afterwards is just a lookup.  GetRprimIds() is
+        // sorted, so each per-tag list is too.
+        _renderTagRprimIds.clear();
+        for (const SdfPath &id : GetRprimIds()) {
+            _renderTagRprimIds[GetRenderTag(id)].push_back(id);
+        }
+    }
+
+    static const SdfPathVector empty;
+    _RenderTagIdMap::const_iterator it = _renderTagRprimIds.find(renderTag);
+    return (it != _renderTagRprimIds.end()) ? it->second : empty;
 }
 
 
@@ -1052,260 +1168,287 @@ HdRenderIndex::SyncAll(HdTaskSharedPtrVector *tasks,
 
     HdRenderParam *renderParam = _renderDelegate->GetRenderParam();
 
-    _bprimIndex.SyncPrims(_tracker, _renderDelegate->GetRenderParam());
-
-    // Texture Bprims contain a deduplication system, where certain paramters
-    // such as maximum texture size are resolved by looking at all the
-    // references.
-    //
-    // At this point new textures may have been added to the system, but old
-    // references haven't been removed yet.
-    //
-    // As Material Sprims need the resolved state of the textures.
-    // Therefore, the old references are cleaned up here, before Sprim
-    // processing
-    if (_tracker.IsBprimGarbageCollectionNeeded()) {
-        HdResourceRegistrySharedPtr registry = GetResourceRegistry();
-
-        registry->GarbageCollectBprims();
-
-        _tracker.ClearBprimGarbageCollectionNeeded();
-    }
+    // Drop the GIL before we spawn parallel tasks.
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
 
+    _RprimSyncRequestMap syncMap;
+    _ReprList reprs;
+    bool resetVaryingState = false;
 
-    _sprimIndex.SyncPrims(_tracker, _renderDelegate->GetRenderParam());
+    // Sync is scheduled as a small task graph.  The phases are ordered --
+    // Sprims read resolved texture (Bprim) state, task sync reads camera
+    // and light (Sprim) state, and Rprim sync reads material (Sprim) and
+    // texture (Bprim) state -- and the render index does not record which
+    // specific prims each consumer references, so a finer-grained,
+    // per-prim dependency graph is not expressible here.  The graph form
+    // makes those ordering constraints explicit and lets future phases
+    // that are genuinely independent overlap.
+    WorkTaskGraph syncGraph;
+
+    WorkTaskGraph::TaskId bprimTask = syncGraph.AddTask([this]() {
+        _bprimIndex.SyncPrims(_tracker, _renderDelegate->GetRenderParam());
+
+        // Texture Bprims contain a deduplication system, where certain paramters
+        // such as maximum texture size are resolved by looking at all the
+        // references.
+        //
+        // At this point new textures may have been added to the system, but old
+        // references haven't been removed yet.
+        //
+        // As Material Sprims need the resolved state of the textures.
+        // Therefore, the old references are cleaned up here, before Sprim
+        // processing
+        if (_tracker.IsBprimGarbageCollectionNeeded()) {
+            HdResourceRegistrySharedPtr registry = GetResourceRegistry();
 
-    ////////////////////////////////////////////////////////////////////////////
-    //
-    // Task Sync
-    //
-    // could be in parallel...
-    //
-    // These tasks will call Sync() adding dirty lists to _syncQueue for
-    // processing below.
-    //
-    size_t numTasks = tasks->size();
-    for (size_t taskNum = 0; taskNum < numTasks; ++taskNum) {
-        HdTaskSharedPtr &task = (*tasks)[taskNum];
+            registry->GarbageCollectBprims();
 
-        if (!TF_VERIFY(task)) {
-            TF_CODING_ERROR("Null Task in task list.  Entry Num: %zu", taskNum);
-            continue;
+            _tracker.ClearBprimGarbageCollectionNeeded();
         }
+    });
+
+    // Material Sprims need the resolved state of the texture Bprims, so
+    // Sprim sync runs after Bprim sync.
+    WorkTaskGraph::TaskId sprimTask = syncGraph.AddTask([this]() {
+        _sprimIndex.SyncPrims(_tracker, _renderDelegate->GetRenderParam());
+    });
+    syncGraph.AddDependency(sprimTask, bprimTask);
+
+    // Task sync reads Sprim state -- e.g. the simple light task reads the
+    // camera and light Sprims, and the shadow task reads light shadow
+    // state -- so it must run after the Sprim chain, preserving the
+    // baseline bprim -> sprim -> task ordering.  Only the Rprim dirty-list
+    // bookkeeping that follows it overlaps with nothing else pending.
+    WorkTaskGraph::TaskId taskSyncTask = syncGraph.AddTask(
+        [this, tasks, taskContext, &syncMap, &reprs, &resetVaryingState]() {
+        ////////////////////////////////////////////////////////////////////////
+        //
+        // Task Sync
+        //
+        // These tasks will call Sync() adding dirty lists to _syncQueue for
+        // processing below.
+        //
+        size_t numTasks = tasks->size();
+        for (size_t taskNum = 0; taskNum < numTasks; ++taskNum) {
+            HdTaskSharedPtr &task = (*tasks)[taskNum];
 
-        SdfPath taskId = task->GetId();
+            if (!TF_VERIFY(task)) {
+                TF_CODING_ERROR("Null Task in task list.  Entry Num: %zu", taskNum);
+                continue;
+            }
 
-        // Is this a tracked task?
-        _TaskMap::iterator taskMapIt = _taskMap.find(taskId);
-        if (taskMapIt != _taskMap.end()) {
-            _TaskInfo &taskInfo = taskMapIt->second;
+            SdfPath taskId = task->GetId();
 
-            // If in the task is in the render index, then we have to
-            // possibility that the task pass in points to a
-            // different instance than the one stored in the render index
-            // even though they have the same id.
-            //
-            // For consistency, we always use the registered task in the
-            // render index for a given id, as that is the one the state is
-            // tracked for.
-            //
-            // However, this is still a weird situation, so report the
-            // issue as a verify so it can be addressed.
-            TF_VERIFY(taskInfo.task == task);
+            // Is this a tracked task?
+            _TaskMap::iterator taskMapIt = _taskMap.find(taskId);
+            if (taskMapIt != _taskMap.end()) {
+                _TaskInfo &taskInfo = taskMapIt->second;
 
-            HdDirtyBits taskDirtyBits = _tracker.GetTaskDirtyBits(taskId);
+                // If in the task is in the render index, then we have to
+                // possibility that the task pass in points to a
+                // different instance than the one stored in the render index
+                // even though they have the same id.
+                //
+                // For consistency, we always use the registered task in the
+                // render index for a given id, as that is the one the state is
+                // tracked for.
+                //
+                // However, this is still a weird situation, so report the
+                // issue as a verify so it can be addressed.
+                TF_VERIFY(taskInfo.task == task);
 
-            taskInfo.task->Sync(taskInfo.sceneDelegate,
-                                taskContext,
-                                &taskDirtyBits);
+                HdDirtyBits taskDirtyBits = _tracker.GetTaskDirtyBits(taskId);
 
-            _tracker.MarkTaskClean(taskId, taskDirtyBits);
+                taskInfo.task->Sync(taskInfo.sceneDelegate,
+                                    taskContext,
+                                    &taskDirtyBits);
 
-        } else {
-            // Dummy dirty bits
-            HdDirtyBits taskDirtyBits = 0;
+                _tracker.MarkTaskClean(taskId, taskDirtyBits);
+
+            } else {
+                // Dummy dirty bits
+                HdDirtyBits taskDirtyBits = 0;
 
-            // This is an untracked task, never added to the render index.
-            task->Sync(nullptr,
-                       taskContext,
-                       &taskDirtyBits);
+                // This is an untracked task, never added to the render index.
+                task->Sync(nullptr,
+                           taskContext,
+                           &taskDirtyBits);
+            }
         }
-    }
 
-    ////////////////////////////////////////////////////////////////////////////
-    //
-    // Render Tag Gather
-    //
-    // Because the task list is not state tracked and can vary from
-    // Sync to Sync as different views use different task lists.
-    // Therefore, the render tags cannot be cached and need to be gathered
-    // every Sync.
-    _GatherRenderTags(tasks);
-
-    // Merge IDs using the slow SdfPath less-than so that all delegate IDs group
-    // together. Unfortunately, FastLessThan makes the optimization below less
-    // effective, however the time to build the std::map dominates when using
-    // the lexicographic less than.
-    std::map<SdfPath, /*reprMask=*/size_t, SdfPath::FastLessThan> dirtyIds;
-    _ReprList reprs;
-    {
-        HF_TRACE_FUNCTION_SCOPE("Merge Dirty Lists");
-        // If dirty list prims are all sorted, we could do something more
-        // efficient here.
-        size_t numSyncQueueEntries = _syncQueue.size();
-        for (size_t entryNum = 0; entryNum < numSyncQueueEntries; ++entryNum) {
-            _SyncQueueEntry &entry = _syncQueue[entryNum];
-            HdDirtyListSharedPtr &hdDirtyList = entry.dirtyList;
-            HdRprimCollection const& collection = entry.collection;
-
-            _ReprSpec reprSpec(collection.GetReprSelector(),
-                               collection.IsForcedRepr());
-
-            // find reprIndex and append it if not exists.
-            int reprIndex = (int)reprs.size();
-            for (size_t i = 0; i < reprs.size(); ++i) {
-                if (reprs[i] == reprSpec) {
-                    reprIndex = i;
-                    break;
+        ////////////////////////////////////////////////////////////////////////////
+        //
+        // Render Tag Gather
+        //
+        // Because the task list is not state tracked and can vary from
+        // Sync to Sync as different views use different task lists.
+        // Therefore, the render tags cannot be cached and need to be gathered
+        // every Sync.
+        _GatherRenderTags(tasks);
+
+        // Merge IDs using the slow SdfPath less-than so that all delegate IDs group
+        // together. Unfortunately, FastLessThan makes the optimization below less
+        // effective, however the time to build the std::map dominates when using
+        // the lexicographic less than.
+        std::map<SdfPath, /*reprMask=*/size_t, SdfPath::FastLessThan> dirtyIds;
+        {
+            HF_TRACE_FUNCTION_SCOPE("Merge Dirty Lists");
+            // If dirty list prims are all sorted, we could do something more
+            // efficient here.
+            size_t numSyncQueueEntries = _syncQueue.size();
+            for (size_t entryNum = 0; entryNum < numSyncQueueEntries; ++entryNum) {
+                _SyncQueueEntry &entry = _syncQueue[entryNum];
+                HdDirtyListSharedPtr &hdDirtyList = entry.dirtyList;
+                HdRprimCollection const& collection = entry.collection;
+
+                _ReprSpec reprSpec(collection.GetReprSelector(),
+                                   collection.IsForcedRepr());
+
+                // find reprIndex and append it if not exists.
+                int reprIndex = (int)reprs.size();
+                for (size_t i = 0; i < reprs.size(); ++i) {
+                    if (reprs[i] == reprSpec) {
+                        reprIndex = i;
+                        break;
+                    }
+                }
+                if (reprIndex == (int)reprs.size()) {
+                    reprs.push_back(reprSpec);
                 }
-            }
-            if (reprIndex == (int)reprs.size()) {
-                reprs.push_back(reprSpec);
-            }
 
-            // up-to 64 (collection's) reprs can be synced at once.
-            // Note that per-prim repr is not limited here, so this
-            // is a fair assumption.
-            //
-            // XXX: WBN to iterate SyncAll if there are more than 64 reprs
-            //      in the extreme case.
-            //
-            if (!TF_VERIFY(reprIndex < 64)) {
-                break;
-            }
+                // up-to 64 (collection's) reprs can be synced at once.
+                // Note that per-prim repr is not limited here, so this
+                // is a fair assumption.
+                //
+                // XXX: WBN to iterate SyncAll if there are more than 64 reprs
+                //      in the extreme case.
+                //
+                if (!TF_VERIFY(reprIndex < 64)) {
+                    break;
+                }
 
-            // PERFORMANCE: this loop can be expensive.
-            SdfPathVector const &dirtyPrims
-                               = hdDirtyList->GetDirtyRprims(_activeRenderTags);
+                // PERFORMANCE: this loop can be expensive.
+                SdfPathVector const &dirtyPrims
+                                   = hdDirtyList->GetDirtyRprims(_activeRenderTags);
 
-            size_t numDirtyPrims = dirtyPrims.size();
-            for (size_t primNum = 0; primNum < numDirtyPrims; ++primNum) {
-                SdfPath const &primPath = dirtyPrims[primNum];
-                dirtyIds[primPath] |= (1ULL << reprIndex);
+                size_t numDirtyPrims = dirtyPrims.size();
+                for (size_t primNum = 0; primNum < numDirtyPrims; ++primNum) {
+                    SdfPath const &primPath = dirtyPrims[primNum];
+                    dirtyIds[primPath] |= (1ULL << reprIndex);
+                }
             }
         }
-    }
 
-    _RprimSyncRequestMap syncMap;
-    bool resetVaryingState = false;
-    {
-        HF_TRACE_FUNCTION_SCOPE("Build Sync Map: Rprims");
-        // Collect dirty Rprim IDs.
-        HdSceneDelegate* curdel = nullptr;
-        _RprimSyncRequestVector* curvec = nullptr;
-
-        // PERFORMANCE: Hot loop.
-        int numSkipped = 0;
-        int numNonVarying = 0;
-        TF_FOR_ALL(idIt, dirtyIds) {
-            _RprimMap::const_iterator it = _rprimMap.find(idIt->first);
-            if (!TF_VERIFY(it != _rprimMap.end())) {
-                continue;
-            }
+        {
+            HF_TRACE_FUNCTION_SCOPE("Build Sync Map: Rprims");
+            // Collect dirty Rprim IDs.
+            HdSceneDelegate* curdel = nullptr;
+            _RprimSyncRequestVector* curvec = nullptr;
+
+            // PERFORMANCE: Hot loop.
+            int numSkipped = 0;
+            int numNonVarying = 0;
+            TF_FOR_ALL(idIt, dirtyIds) {
+                _RprimMap::const_iterator it = _rprimMap.find(idIt->first);
+                if (!TF_VERIFY(it != _rprimMap.end())) {
+                    continue;
+                }
 
-            const _RprimInfo &rprimInfo = it->second;
-            const SdfPath &rprimId = rprimInfo.rprim->GetId();
-            HdDirtyBits dirtyBits =
-                           _tracker.GetRprimDirtyBits(rprimId);
-            size_t reprsMask = idIt->second;
+                const _RprimInfo &rprimInfo = it->second;
+                const SdfPath &rprimId = rprimInfo.rprim->GetId();
+                HdDirtyBits dirtyBits =
+                               _tracker.GetRprimDirtyBits(rprimId);
+                size_t reprsMask = idIt->second;
 
-            if (HdChangeTracker::IsClean(dirtyBits)) {
-                numSkipped++;
-                continue;
-            }
+                if (HdChangeTracker::IsClean(dirtyBits)) {
+                    numSkipped++;
+                    continue;
+                }
 
-            if (!HdChangeTracker::IsVarying(dirtyBits)) {
-                ++numNonVarying;
-            }
+                if (!HdChangeTracker::IsVarying(dirtyBits)) {
+                    ++numNonVarying;
+                }
 
-            // PERFORMANCE: This loop is constrained by memory access, avoid
-            // re-fetching the sync request vector if possible.
-            if (curdel != rprimInfo.sceneDelegate) {
-                curdel = rprimInfo.sceneDelegate;
-                curvec = &syncMap[curdel];
-            }
+                // PERFORMANCE: This loop is constrained by memory access, avoid
+                // re-fetching the sync request vector if possible.
+                if (curdel != rprimInfo.sceneDelegate) {
+                    curdel = rprimInfo.sceneDelegate;
+                    curvec = &syncMap[curdel];
+                }
 
-            curvec->PushBack(rprimInfo.rprim,
-                             reprsMask, dirtyBits);
-        }
+                curvec->PushBack(rprimInfo.rprim,
+                                 reprsMask, dirtyBits);
+            }
 
-        // Use a heuristic to determine whether or not to destroy the entire
-        // dirty state.  We say that if we've skipped more than 25% of the
-        // rprims that were claimed dirty, then it's time to clean up this
-        // list.
-        // Alternatively if the list contains more the 10% rprims that
-        // are not marked as varying.  (This can happen when prims are
-        // invisible for example).
-        //
-        // This leads to performance improvements after many rprims
-        // get dirty and then cleaned one, and the steady state becomes a
-        // small number of dirty items.
-        if (!dirtyIds.empty()) {
-            resetVaryingState =
-                ((float )numSkipped / (float)dirtyIds.size()) > 0.25f;
-
-            resetVaryingState |=
-                ((float )numNonVarying / (float)dirtyIds.size()) > 0.10f;
-
-
-            if (TfDebug::IsEnabled(HD_VARYING_STATE)) {
-                std::cout << "Dirty List Redundancy: "
-                          << "Skipped  = "
-                          << ((float )numSkipped * 100.0f /
-                              (float)dirtyIds.size())
-                          << "% (" <<  numSkipped << " / "
-                          << dirtyIds.size() << ") "
-                          << "Non-Varying  = "
-                          << ((float )numNonVarying * 100.0f /
-                              (float)dirtyIds.size())
-                          << "% (" <<  numNonVarying << " / "
-                          << dirtyIds.size() << ")"
-                          << std::endl;
+            // Use a heuristic to determine whether or not to destroy the entire
+            // dirty state.  We say that if we've skipped more than 25% of the
+            // rprims that were claimed dirty, then it's time to clean up this
+            // list.
+            // Alternatively if the list contains more the 10% rprims that
+            // are not marked as varying.  (This can happen when prims are
+            // invisible for example).
+            //
+            // This leads to performance improvements after many rprims
+            // get dirty and then cleaned one, and the steady state becomes a
+            // small number of dirty items.
+            if (!dirtyIds.empty()) {
+                resetVaryingState =
+                    ((float )numSkipped / (float)dirtyIds.size()) > 0.25f;
+
+                resetVaryingState |=
+                    ((float )numNonVarying / (float)dirtyIds.size()) > 0.10f;
+
+
+                if (TfDebug::IsEnabled(HD_VARYING_STATE)) {
+                    std::cout << "Dirty List Redundancy: "
+                              << "Skipped  = "
+                              << ((float )numSkipped * 100.0f /
+                                  (float)dirtyIds.size())
+                              << "% (" <<  numSkipped << " / "
+                              << dirtyIds.size() << ") "
+                              << "Non-Varying  = "
+                              << ((float )numNonVarying * 100.0f /
+                                  (float)dirtyIds.size())
+                              << "% (" <<  numNonVarying << " / "
+                              << dirtyIds.size() << ")"
+                              << std::endl;
+                }
             }
         }
-    }
 
-    // Drop the GIL before we spawn parallel tasks.
-    TF_PY_ALLOW_THREADS_IN_SCOPE();
 
 
-    // Give the render delegates the chance to modify the sync request
-    // before passing it to the scene delegates.
-    //
-    // This allows the render delegate to request more data that it needs
-    // to process the changes that are marked in the change tracker.
-    //
-    // So that the entity marking the changes does not need to be aware of
-    // render delegate specific data dependencies.
-    {
-        HF_TRACE_FUNCTION_SCOPE("Pre-Sync Rprims");
+        // Give the render delegates the chance to modify the sync request
+        // before passing it to the scene delegates.
+        //
+        // This allows the render delegate to request more data that it needs
+        // to process the changes that are marked in the change tracker.
+        //
+        // So that the entity marking the changes does not need to be aware of
+        // render delegate specific data dependencies.
+        {
+            HF_TRACE_FUNCTION_SCOPE("Pre-Sync Rprims");
 
-        // Dispatch synchronization work to each delegate.
-        WorkArenaDispatcher dirtyBitDispatcher;
+            // Dispatch synchronization work to each delegate.
+            WorkArenaDispatcher dirtyBitDispatcher;
 
-        TF_FOR_ALL(dlgIt, syncMap) {
-            HdSceneDelegate *sceneDelegate = dlgIt->first;
-            _RprimSyncRequestVector *r = &dlgIt->second;
-            dirtyBitDispatcher.Run(
-                                   std::bind(&_PreSyncRequestVector,
-                                             sceneDelegate,
-                                             &_tracker,
-                                             r,
-                                             std::cref(reprs)));
+            TF_FOR_ALL(dlgIt, syncMap) {
+                HdSceneDelegate *sceneDelegate = dlgIt->first;
+                _RprimSyncRequestVector *r = &dlgIt->second;
+                dirtyBitDispatcher.Run(
+                                       std::bind(&_PreSyncRequestVector,
+                                                 sceneDelegate,
+                                                 &_tracker,
+                                                 r,
+                                                 std::cref(reprs)));
 
+            }
+            dirtyBitDispatcher.Wait();
         }
-        dirtyBitDispatcher.Wait();
-    }
+    });
+    syncGraph.AddDependency(taskSyncTask, sprimTask);
+
+    syncGraph.RunAndWait();
 
     {
         HF_TRACE_FUNCTION_SCOPE("Delegate Sync");
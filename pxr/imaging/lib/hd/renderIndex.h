@@ -40,6 +40,7 @@
 #include "pxr/usd/sdf/path.h"
 
 #include "pxr/base/gf/vec4i.h"
+#include "pxr/base/tf/denseHashMap.h"
 #include "pxr/base/tf/hashmap.h"
 
 #include <boost/noncopyable.hpp>
@@ -201,6 +202,22 @@ public:
                      SdfPath const& rprimId,
                      SdfPath const& instancerId = SdfPath());
 
+    /// Describes a single rprim to be inserted by InsertRprims().
+    struct RprimDescriptor {
+        TfToken typeId;
+        HdSceneDelegate* sceneDelegate;
+        SdfPath rprimId;
+        SdfPath instancerId;
+    };
+
+    /// Insert a batch of rprims into the index.  This is equivalent to
+    /// calling InsertRprim() for each descriptor, except that storage for
+    /// the batch is reserved up front and the change tracker receives a
+    /// single aggregated notification, so populating a large scene does
+    /// not invalidate downstream state once per prim.
+    HD_API
+    void InsertRprims(std::vector<RprimDescriptor> const& descriptors);
+
     /// Remove a rprim from index
     HD_API
     void RemoveRprim(SdfPath const& id);
@@ -243,6 +260,17 @@ public:
     HD_API
     SdfPathVector GetRprimSubtree(SdfPath const& root);
 
+    /// Returns a sorted list of all Rprims whose render tag is
+    /// \p renderTag.
+    ///
+    /// The per-tag lists are all built by a single partition scan of the
+    /// index and then reused until an Rprim is inserted or removed or a
+    /// render tag changes, so changing which tags are active (e.g.
+    /// toggling guide or proxy display) swaps in ready lists rather than
+    /// re-querying the tag of every prim in the scene.
+    HD_API
+    const SdfPathVector &GetRprimIdsWithRenderTag(TfToken const &renderTag);
+
 
     // ---------------------------------------------------------------------- //
     /// \name Instancer Support
@@ -422,7 +450,12 @@ private:
     };
 
     typedef std::unordered_map<SdfPath, _TaskInfo, SdfPath::Hash> _TaskMap;
-    typedef TfHashMap<SdfPath, _RprimInfo, SdfPath::Hash> _RprimMap;
+    // Dense, open-addressed storage keyed by SdfPath's 64-bit value; the
+    // rprim map is probed per prim during sync, and dense storage keeps
+    // those lookups and full-map walks in contiguous memory.  Insertion
+    // and removal invalidate iterators and _RprimInfo pointers, neither of
+    // which the index holds across mutations.
+    typedef TfDenseHashMap<SdfPath, _RprimInfo, SdfPath::Hash> _RprimMap;
     typedef std::map<uint32_t, SdfPath> _RprimPrimIDMap;
 
     typedef Hd_PrimTypeIndex<HdSprim> _SprimIndex;
@@ -480,6 +513,33 @@ private:
                           HdRprimCollection const& collection,
                           _ConcurrentDrawItems* result);
 
+    // Cached results of collection-based prim gathering, so that evaluating
+    // an unchanged collection against an unchanged rprim set is a lookup
+    // rather than an O(N) filter over all rprim ids.  Entries are validated
+    // against the change tracker versions the filter result depends on; all
+    // versions start at 1, so a default entry is always stale.  Draw item
+    // entries are keyed by the hash of (collection, render tags); subtree
+    // entries by the root path and depend only on the rprim set.
+    struct _GatherCacheEntry {
+        unsigned rprimIndexVersion = 0;
+        unsigned renderTagVersion = 0;
+        unsigned batchVersion = 0;
+        SdfPathVector ids;
+    };
+    typedef std::unordered_map<size_t, _GatherCacheEntry> _GatherCache;
+    _GatherCache _drawItemGatherCache;
+
+    typedef std::unordered_map<SdfPath, _GatherCacheEntry, SdfPath::Hash>
+        _SubtreeGatherCache;
+    _SubtreeGatherCache _subtreeGatherCache;
+
+    // Rprim ids partitioned by render tag; see GetRprimIdsWithRenderTag().
+    typedef std::unordered_map<TfToken, SdfPathVector, TfToken::HashFunctor>
+        _RenderTagIdMap;
+    _RenderTagIdMap _renderTagRprimIds;
+    unsigned _renderTagIdsIndexVersion;
+    unsigned _renderTagIdsTagVersion;
+
     /// Register core hydra reprs. Only ever called once, the first time
     /// a render index is created.
     /// XXX: This code should move to the application layer.
@@ -36,6 +36,7 @@
 #include "pxr/base/work/loops.h"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <set>
@@ -285,6 +286,13 @@ HdResourceRegistry::Commit()
     HD_TRACE_FUNCTION();
     HF_MALLOC_TAG_FUNCTION();
 
+    // Bump the commit version if this commit is going to change any buffer
+    // contents, so consumers of GetCommitVersion() can tell whether their
+    // derived state is still valid.
+    if (!_pendingSources.empty() || !_pendingComputations.empty()) {
+        ++_commitVersion;
+    }
+
     // TODO: requests should be sorted by resource, and range.
     {
         HD_TRACE_SCOPE("Resolve");
@@ -292,41 +300,33 @@ HdResourceRegistry::Commit()
         // for each pending source, resolve and check if it needs buffer
         // reallocation or not.
 
-        size_t numBufferSourcesResolved = 0;
-        int numThreads = 1; //omp_get_max_threads();
+        std::atomic<size_t> numBufferSourcesResolved(0);
         int numIterations = 0;
 
         // iterate until all buffer sources have been resolved.
+        // a source that depends on the result of another source (e.g. a
+        // quadrangulated primvar depending on the quadinfo computation)
+        // fails to resolve until its dependency has been resolved in an
+        // earlier round, so each round resolves all currently resolvable
+        // sources concurrently and the loop runs again for the rest.
         while (numBufferSourcesResolved < _numBufferSourcesToResolve) {
-            // XXX: Parallel for is currently much slower than a single
-            // thread in all tested scenarios, disabling until we can
-            // figure out what's going on here.
-//#pragma omp parallel for
-            for (int i = 0; i < numThreads; ++i) {
-                // iterate over all pending sources
-                for (_PendingSource const& req: _pendingSources) {
+            WorkParallelForEach(
+                _pendingSources.begin(), _pendingSources.end(),
+                [&numBufferSourcesResolved](_PendingSource const& req) {
                     for (HdBufferSourceSharedPtr const& source: req.sources) {
                         // execute computation.
                         // call IsResolved first since Resolve is virtual and
                         // could be costly.
                         if (!source->IsResolved()) {
                             if (source->Resolve()) {
-                                TF_VERIFY(source->IsResolved(), 
+                                TF_VERIFY(source->IsResolved(),
                                 "Name = %s", source->GetName().GetText());
 
                                 ++numBufferSourcesResolved;
-
-                                // call resize if it's the first in sources.
-                                if (req.range &&
-                                    source == *req.sources.begin()) {
-                                    req.range->Resize(
-                                        source->GetNumElements());
-                                }
                             }
                         }
                     }
-                }
-            }
+                });
             if (++numIterations > 100) {
                 TF_WARN("Too many iterations in resolving buffer source. "
                         "It's likely due to incosistent dependency.");
@@ -334,6 +334,16 @@ HdResourceRegistry::Commit()
             }
         }
 
+        // resize each range to the number of elements of its first source.
+        // this is done outside the resolve loop so that ranges shared
+        // between pending source requests aren't resized concurrently.
+        for (_PendingSource const& req: _pendingSources) {
+            if (req.range && !req.sources.empty() &&
+                req.sources.front()->IsResolved()) {
+                req.range->Resize(req.sources.front()->GetNumElements());
+            }
+        }
+
         TF_VERIFY(numBufferSourcesResolved == _numBufferSourcesToResolve);
         HD_PERF_COUNTER_ADD(HdPerfTokens->bufferSourcesResolved,
                             numBufferSourcesResolved);
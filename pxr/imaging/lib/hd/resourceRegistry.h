@@ -141,6 +141,12 @@ public:
     HD_API
     void Commit();
 
+    /// Returns a version number that increments whenever Commit() uploads
+    /// pending sources or executes pending computations. It can be used to
+    /// conservatively detect changes to committed buffer contents, e.g. to
+    /// invalidate state derived from them such as GPU culling results.
+    size_t GetCommitVersion() const { return _commitVersion; }
+
     /// cleanup all buffers and remove if empty
     HD_API
     void GarbageCollect();
@@ -356,6 +362,7 @@ private:
     typedef tbb::concurrent_vector<_PendingSource> _PendingSourceList;
     _PendingSourceList    _pendingSources;
     std::atomic_size_t   _numBufferSourcesToResolve;
+    size_t _commitVersion = 0;
     
 
 
@@ -141,6 +141,26 @@ HdSceneDelegate::GetVisible(SdfPath const & id)
     return true;
 }
 
+/*virtual*/
+void
+HdSceneDelegate::GetTransforms(SdfPath const *ids, size_t count,
+                               GfMatrix4d *transforms)
+{
+    for (size_t i = 0; i < count; ++i) {
+        transforms[i] = GetTransform(ids[i]);
+    }
+}
+
+/*virtual*/
+void
+HdSceneDelegate::GetVisibles(SdfPath const *ids, size_t count,
+                             bool *visibilities)
+{
+    for (size_t i = 0; i < count; ++i) {
+        visibilities[i] = GetVisible(ids[i]);
+    }
+}
+
 /*virtual*/
 bool
 HdSceneDelegate::GetDoubleSided(SdfPath const & id)
@@ -437,6 +457,17 @@ HdSceneDelegate::GetPrimvarDescriptors(SdfPath const& id,
     return HdPrimvarDescriptorVector();
 }
 
+/*virtual*/
+void
+HdSceneDelegate::GetPrimvarDescriptors(SdfPath const *ids, size_t count,
+                                       HdInterpolation interpolation,
+                                       HdPrimvarDescriptorVector *primvars)
+{
+    for (size_t i = 0; i < count; ++i) {
+        primvars[i] = GetPrimvarDescriptors(ids[i], interpolation);
+    }
+}
+
 /*virtual*/
 HdExtComputationPrimvarDescriptorVector
 HdSceneDelegate::GetExtComputationPrimvarDescriptors(
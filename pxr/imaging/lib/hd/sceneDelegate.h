@@ -360,6 +360,26 @@ public:
     HD_API
     virtual bool GetVisible(SdfPath const & id);
 
+    /// Returns the object space transforms for \p count prims at once,
+    /// writing the transform for \p ids[i] to \p transforms[i].
+    ///
+    /// Equivalent to calling GetTransform() for each id, which is what the
+    /// default implementation does.  Delegates that can serve many prims
+    /// from bulk storage should override this to amortize the per-prim
+    /// virtual dispatch and lookup cost when large numbers of prims sync.
+    HD_API
+    virtual void GetTransforms(SdfPath const *ids, size_t count,
+                               GfMatrix4d *transforms);
+
+    /// Returns the authored visible state for \p count prims at once,
+    /// writing the state for \p ids[i] to \p visibilities[i].
+    ///
+    /// Equivalent to calling GetVisible() for each id, which is what the
+    /// default implementation does; see GetTransforms().
+    HD_API
+    virtual void GetVisibles(SdfPath const *ids, size_t count,
+                             bool *visibilities);
+
     /// Returns the doubleSided state for the given prim.
     HD_API
     virtual bool GetDoubleSided(SdfPath const & id);
@@ -685,6 +705,19 @@ public:
     virtual HdPrimvarDescriptorVector
     GetPrimvarDescriptors(SdfPath const& id, HdInterpolation interpolation);
 
+    /// Returns primvar descriptors of the given interpolation type for
+    /// \p count prims at once, writing the descriptors for \p ids[i] to
+    /// \p primvars[i].
+    ///
+    /// Equivalent to calling the single-prim GetPrimvarDescriptors() for
+    /// each id, which is what the default implementation does; see
+    /// GetTransforms().
+    HD_API
+    virtual void
+    GetPrimvarDescriptors(SdfPath const *ids, size_t count,
+                          HdInterpolation interpolation,
+                          HdPrimvarDescriptorVector *primvars);
+
     // -----------------------------------------------------------------------//
     /// \name Task Aspects
     // -----------------------------------------------------------------------//
@@ -42,27 +42,42 @@ public:
                          VtIntArray const &adjacencyTable,
                          DstType *normals)
     : _pointsPtr(pointsPtr)
-    , _adjacencyTable(adjacencyTable)
+    , _adjacencyTable(adjacencyTable.cdata())
     , _normals(normals)
     {
     }
 
     void Compute(size_t begin, size_t end)
     {
+        typedef typename SrcVec3Type::ScalarType ScalarType;
+
         for(size_t i = begin; i < end; ++i) {
             int offsetIdx = i * 2;
             int offset  = _adjacencyTable[offsetIdx];
             int valence = _adjacencyTable[offsetIdx + 1];
 
             int const * e = &_adjacencyTable[offset];
-            SrcVec3Type normal(0);
             SrcVec3Type const & curr = _pointsPtr[i];
+
+            // Accumulate the normal in component form; keeping the sums in
+            // scalar locals lets the compiler vectorize the edge loop.
+            ScalarType nx = 0, ny = 0, nz = 0;
             for (int j=0; j<valence; ++j) {
                 SrcVec3Type const & prev = _pointsPtr[*e++];
                 SrcVec3Type const & next = _pointsPtr[*e++];
                 // All meshes have all been converted to rightHanded
-                normal += GfCross(next-curr, prev-curr);
+                const ScalarType ax = next[0] - curr[0];
+                const ScalarType ay = next[1] - curr[1];
+                const ScalarType az = next[2] - curr[2];
+                const ScalarType bx = prev[0] - curr[0];
+                const ScalarType by = prev[1] - curr[1];
+                const ScalarType bz = prev[2] - curr[2];
+                nx += ay * bz - az * by;
+                ny += az * bx - ax * bz;
+                nz += ax * by - ay * bx;
             }
+
+            SrcVec3Type normal(nx, ny, nz);
             if (true) { // Could defer normalization to shader code
                 normal.Normalize();
             }
@@ -72,7 +87,7 @@ public:
 
 private:
     SrcVec3Type const * _pointsPtr;
-    VtIntArray const &_adjacencyTable;
+    int const * _adjacencyTable;
     DstType *_normals;
 };
 
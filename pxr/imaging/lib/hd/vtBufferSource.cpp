@@ -22,6 +22,7 @@
 // language governing permissions and limitations under the Apache License.
 //
 #include "pxr/imaging/hd/vtBufferSource.h"
+#include "pxr/imaging/hd/bufferKernels.h"
 #include "pxr/imaging/hd/perfLog.h"
 
 #include "pxr/base/vt/array.h"
@@ -93,11 +94,8 @@ HdVtBufferSource::HdVtBufferSource(TfToken const &name,
     if (GetDefaultMatrixType() == HdTypeDoubleMat4) {
         _SetValue( VtValue(matrix), 1 );
     } else {
-        GfMatrix4f fmatrix(
-            matrix[0][0], matrix[0][1], matrix[0][2], matrix[0][3],
-            matrix[1][0], matrix[1][1], matrix[1][2], matrix[1][3],
-            matrix[2][0], matrix[2][1], matrix[2][2], matrix[2][3],
-            matrix[3][0], matrix[3][1], matrix[3][2], matrix[3][3]);
+        GfMatrix4f fmatrix;
+        HdNarrowDoubleToFloat(fmatrix.GetArray(), matrix.GetArray(), 16);
         _SetValue( VtValue(fmatrix), 1 );
     }
 }
@@ -110,15 +108,13 @@ HdVtBufferSource::HdVtBufferSource(TfToken const &name,
     if (GetDefaultMatrixType() == HdTypeDoubleMat4) {
         _SetValue( VtValue(matrices), arraySize );
     } else {
+        // Matrices are contiguous in the array, so narrow all 16n
+        // components with one bulk conversion.
         VtArray<GfMatrix4f> fmatrices(matrices.size());
-        for (size_t i = 0; i < matrices.size(); ++i) {
-            GfMatrix4d const &matrix = matrices[i];
-            GfMatrix4f fmatrix(
-                matrix[0][0], matrix[0][1], matrix[0][2], matrix[0][3],
-                matrix[1][0], matrix[1][1], matrix[1][2], matrix[1][3],
-                matrix[2][0], matrix[2][1], matrix[2][2], matrix[2][3],
-                matrix[3][0], matrix[3][1], matrix[3][2], matrix[3][3]);
-            fmatrices[i] = fmatrix;
+        if (!matrices.empty()) {
+            HdNarrowDoubleToFloat(fmatrices.data()->GetArray(),
+                                  matrices.cdata()->GetArray(),
+                                  16 * matrices.size());
         }
         _SetValue( VtValue(fmatrices), arraySize );
     }
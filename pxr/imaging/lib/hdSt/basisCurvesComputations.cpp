@@ -31,8 +31,12 @@
 
 #include "pxr/base/gf/vec2i.h"
 #include "pxr/base/gf/vec4i.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/scan.h"
 
 #include <algorithm>
+#include <functional>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -43,72 +47,116 @@ InterpolateVarying(size_t numVerts, VtIntArray const & vertexCounts, TfToken wra
 {
     VtArray<T> outputValues(numVerts);
 
-    size_t srcIndex = 0;
-    size_t dstIndex = 0;
-
     if (wrap == HdTokens->periodic) {
         // XXX : Add support for periodic curves
         TF_WARN("Varying data is only supported for non-periodic curves.");
     }
 
-    TF_FOR_ALL(itVertexCount, vertexCounts) {
-        int nVerts = *itVertexCount;
-
-        // Handling for the case of potentially incorrect vertex counts 
-        if(nVerts < 1) {
-            continue;
-        }
+    const bool vStep1 = (basis == HdTokens->catmullRom ||
+                         basis == HdTokens->bSpline);
+    if (!vStep1 && basis != HdTokens->bezier) {
+        TF_WARN("Unsupported basis: '%s'", basis.GetText());
+        return outputValues;
+    }
 
-        if(basis == HdTokens->catmullRom || basis == HdTokens->bSpline) {
-            // For splines with a vstep of 1, we are doing linear interpolation 
-            // between segments, so all we do here is duplicate the first and 
-            // last outputValues. Since these are never acutally used during 
-            // drawing, it would also work just to set the to 0.
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            for (int i = 1; i < nVerts - 2; ++i){
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++dstIndex; ++srcIndex;
+    // Compute per-curve source and destination offsets, so every curve
+    // expands into a disjoint range of the output and the curves can be
+    // processed in parallel.  The bezier middle loop runs
+    // ceil((nVerts - 4) / 3) times for nVerts > 4.
+    const size_t numCurves = vertexCounts.size();
+    const int *countsPtr = vertexCounts.cdata();
+
+    std::vector<int> srcOffsets(numCurves);
+    std::vector<int> dstOffsets(numCurves);
+    WorkParallelForN(
+        numCurves,
+        [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            int nVerts = countsPtr[i];
+            // Handling for the case of potentially incorrect vertex counts
+            if (nVerts < 1) {
+                srcOffsets[i] = 0;
+                dstOffsets[i] = 0;
+            } else if (vStep1) {
+                srcOffsets[i] = std::max(nVerts - 2, 1);
+                dstOffsets[i] = std::max(nVerts, 3);
+            } else {
+                int numMid = (nVerts > 4) ? ((nVerts - 5) / 3 + 1) : 0;
+                srcOffsets[i] = 2 + numMid;
+                dstOffsets[i] = 4 + 3 * numMid;
             }
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex;
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex; ++srcIndex;
         }
-        else if (basis == HdTokens->bezier){
-            // For bezier splines, we map the linear values to cubic values
-            // the begin value gets mapped to the first two vertices and
-            // the end value gets mapped to the last two vertices in a segment.
-            // shaders can choose to access value[1] and value[2] when linearly
-            // interpolating a value, which happens to match up with the
-            // indexing to use for catmullRom and bSpline basis.
-            int vStep = 3;
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex; // don't increment the srcIndex
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex; ++ srcIndex;
-
-            // vstep - 1 control points will have an interpolated value
-            for(int i = 2; i < nVerts - 2; i += vStep) {
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++ dstIndex; // don't increment the srcIndex
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++ dstIndex; // don't increment the srcIndex
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++ dstIndex; ++ srcIndex; 
+    });
+    const size_t totalSrc = WorkParallelExclusiveScan(
+        srcOffsets.begin(), numCurves, srcOffsets.begin(), 0,
+        std::plus<int>());
+    const size_t totalDst = WorkParallelExclusiveScan(
+        dstOffsets.begin(), numCurves, dstOffsets.begin(), 0,
+        std::plus<int>());
+    TF_VERIFY(totalSrc == authoredValues.size());
+    TF_VERIFY(totalDst == numVerts);
+
+    T *outputPtr = outputValues.data();
+    T const *authoredPtr = authoredValues.cdata();
+
+    WorkParallelForN(
+        numCurves,
+        [&, vStep1](size_t begin, size_t end) {
+        for (size_t curve = begin; curve < end; ++curve) {
+            int nVerts = countsPtr[curve];
+            if (nVerts < 1) {
+                continue;
+            }
+            size_t srcIndex = srcOffsets[curve];
+            size_t dstIndex = dstOffsets[curve];
+
+            if (vStep1) {
+                // For splines with a vstep of 1, we are doing linear
+                // interpolation between segments, so all we do here is
+                // duplicate the first and last outputValues. Since these are
+                // never acutally used during drawing, it would also work just
+                // to set the to 0.
+                outputPtr[dstIndex] = authoredPtr[srcIndex];
+                ++dstIndex;
+                for (int i = 1; i < nVerts - 2; ++i){
+                    outputPtr[dstIndex] = authoredPtr[srcIndex];
+                    ++dstIndex; ++srcIndex;
+                }
+                outputPtr[dstIndex] = authoredPtr[srcIndex];
+                ++dstIndex;
+                outputPtr[dstIndex] = authoredPtr[srcIndex];
+                ++dstIndex; ++srcIndex;
+            } else {
+                // For bezier splines, we map the linear values to cubic values
+                // the begin value gets mapped to the first two vertices and
+                // the end value gets mapped to the last two vertices in a
+                // segment. shaders can choose to access value[1] and value[2]
+                // when linearly interpolating a value, which happens to match
+                // up with the indexing to use for catmullRom and bSpline
+                // basis.
+                int vStep = 3;
+                outputPtr[dstIndex] = authoredPtr[srcIndex];
+                ++dstIndex; // don't increment the srcIndex
+                outputPtr[dstIndex] = authoredPtr[srcIndex];
+                ++dstIndex; ++ srcIndex;
+
+                // vstep - 1 control points will have an interpolated value
+                for(int i = 2; i < nVerts - 2; i += vStep) {
+                    outputPtr[dstIndex] = authoredPtr[srcIndex];
+                    ++ dstIndex; // don't increment the srcIndex
+                    outputPtr[dstIndex] = authoredPtr[srcIndex];
+                    ++ dstIndex; // don't increment the srcIndex
+                    outputPtr[dstIndex] = authoredPtr[srcIndex];
+                    ++ dstIndex; ++ srcIndex;
+                }
+                outputPtr[dstIndex] = authoredPtr[srcIndex];
+                ++dstIndex; // don't increment the srcIndex
+                outputPtr[dstIndex] = authoredPtr[srcIndex];
+                ++dstIndex; ++ srcIndex;
             }
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex; // don't increment the srcIndex
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex; ++ srcIndex;
-        }
-        else {
-            TF_WARN("Unsupported basis: '%s'", basis.GetText());
         }
-    }
-    TF_VERIFY(srcIndex == authoredValues.size());
-    TF_VERIFY(dstIndex == numVerts);
-    
+    });
+
     return outputValues;
 }
 
@@ -143,53 +191,57 @@ HdSt_BasisCurvesIndexBuilderComputation::GetBufferSpecs(
 HdSt_BasisCurvesIndexBuilderComputation::IndexAndPrimIndex
 HdSt_BasisCurvesIndexBuilderComputation::_BuildLinesIndexArray()
 {
-    std::vector<GfVec2i> indices;
-    std::vector<int> primIndices;
     VtArray<int> vertexCounts = _topology->GetCurveVertexCounts();
-
-    int vertexIndex = 0;
-    int curveIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts) {
-        for(int i = 0; i < *itCounts; i+= 2) {
-            indices.push_back(GfVec2i(vertexIndex, vertexIndex + 1));
-            vertexIndex += 2;
-            primIndices.push_back(curveIndex);
+    const size_t numCurves = vertexCounts.size();
+    const int *countsPtr = vertexCounts.cdata();
+
+    // Each curve emits one line per vertex pair and advances the vertex
+    // index by two per line; scanning the per-curve line counts gives every
+    // curve a disjoint output range so the fill can run in parallel.
+    std::vector<int> lineOffsets(numCurves);
+    WorkParallelForN(
+        numCurves,
+        [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            lineOffsets[i] = (countsPtr[i] + 1) / 2;
         }
-        curveIndex++;
-    }
-
-    VtVec2iArray finalIndices(indices.size());
-    VtIntArray const &curveIndices = _topology->GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty())
-    {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    }
-    else
-    {
-        size_t lineCount = indices.size();
-        int maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum)
-        {
-            const GfVec2i &line = indices[lineNum];
+    });
+    const int numLines = WorkParallelExclusiveScan(
+        lineOffsets.begin(), numCurves, lineOffsets.begin(), 0,
+        std::plus<int>());
 
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
+    VtVec2iArray finalIndices(numLines);
+    VtIntArray finalPrimIndices(numLines);
+    GfVec2i *indicesPtr = finalIndices.data();
+    int *primIndicesPtr = finalPrimIndices.data();
 
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-
-            finalIndices[lineNum].Set(v0, v1);
+    VtIntArray const &curveIndices = _topology->GetCurveIndices();
+    const int *curveIndicesPtr = curveIndices.cdata();
+    const bool hasIndices = !curveIndices.empty();
+    const int maxIndex = int(curveIndices.size()) - 1;
+
+    WorkParallelForN(
+        numCurves,
+        [&](size_t begin, size_t end) {
+        for (size_t curve = begin; curve < end; ++curve) {
+            int line = lineOffsets[curve];
+            int vertexIndex = 2 * line;
+            for (int i = 0; i < countsPtr[curve]; i += 2) {
+                int v0 = vertexIndex;
+                int v1 = vertexIndex + 1;
+                // If the topology has indices set, map the generated
+                // indices with the given indices.
+                if (hasIndices) {
+                    v0 = curveIndicesPtr[std::min(v0, maxIndex)];
+                    v1 = curveIndicesPtr[std::min(v1, maxIndex)];
+                }
+                indicesPtr[line].Set(v0, v1);
+                primIndicesPtr[line] = int(curve);
+                ++line;
+                vertexIndex += 2;
+            }
         }
-    }
-
-    VtIntArray finalPrimIndices(primIndices.size());
-    std::copy(  primIndices.begin(), 
-                primIndices.end(), 
-                finalPrimIndices.begin());
+    });
 
     return IndexAndPrimIndex(VtValue(finalIndices), VtValue(finalPrimIndices));
 }
@@ -200,69 +252,89 @@ HdSt_BasisCurvesIndexBuilderComputation::_BuildLineSegmentIndexArray()
     const TfToken basis = _topology->GetCurveBasis();
     const bool skipFirstAndLastSegs = (basis == HdTokens->catmullRom);
 
-    std::vector<GfVec2i> indices;
-    // primIndices stores the curve index that generated each line segment.
-    std::vector<int> primIndices;
     const VtArray<int> vertexCounts = _topology->GetCurveVertexCounts();
-    bool wrap = _topology->GetCurveWrap() == HdTokens->periodic;
-    int vertexIndex = 0; // Index of next vertex to emit
-    int curveIndex = 0;  // Index of next curve to emit
-    // For each curve
-    TF_FOR_ALL(itCounts, vertexCounts) {
-        int v0 = vertexIndex;
-        int v1;
-        // Store first vert index incase we are wrapping
-        const int firstVert = v0;
-        ++ vertexIndex;
-        for(int i = 1;i < *itCounts; ++i) {
-            v1 = vertexIndex;
-            ++ vertexIndex;
-            if (!skipFirstAndLastSegs || (i > 1 && i < (*itCounts)-1)) {
-                indices.push_back(GfVec2i(v0, v1));
-                // Map this line segment back to the curve it came from
-                primIndices.push_back(curveIndex);
+    const bool wrap = _topology->GetCurveWrap() == HdTokens->periodic;
+    const size_t numCurves = vertexCounts.size();
+    const int *countsPtr = vertexCounts.cdata();
+
+    // Per-curve segment and vertex offsets: a curve with c vertices emits
+    // c-1 segments (c-3 when the first and last are skipped), plus one
+    // when wrapping, and always advances the vertex index by at least one.
+    // Scanning these lets every curve fill its output range independently.
+    std::vector<int> segOffsets(numCurves);
+    std::vector<int> vertOffsets(numCurves);
+    WorkParallelForN(
+        numCurves,
+        [&, wrap, skipFirstAndLastSegs](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            int count = countsPtr[i];
+            int numSegs = skipFirstAndLastSegs
+                ? std::max(count - 3, 0)
+                : std::max(count - 1, 0);
+            if (wrap) {
+                ++numSegs;
             }
-            v0 = v1;
-        }
-        if(wrap) {
-            indices.push_back(GfVec2i(v0, firstVert));
-            primIndices.push_back(curveIndex);
+            segOffsets[i] = numSegs;
+            vertOffsets[i] = std::max(count, 1);
         }
-        ++curveIndex;
-    }
+    });
+    const int numSegments = WorkParallelExclusiveScan(
+        segOffsets.begin(), numCurves, segOffsets.begin(), 0,
+        std::plus<int>());
+    WorkParallelExclusiveScan(
+        vertOffsets.begin(), numCurves, vertOffsets.begin(), 0,
+        std::plus<int>());
+
+    VtVec2iArray finalIndices(numSegments);
+    VtIntArray finalPrimIndices(numSegments);
+    GfVec2i *indicesPtr = finalIndices.data();
+    // primIndices stores the curve index that generated each line segment.
+    int *primIndicesPtr = finalPrimIndices.data();
 
-    VtVec2iArray finalIndices(indices.size());
     VtIntArray const &curveIndices = _topology->GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty())
-    {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    }
-    else
-    {
-        size_t lineCount = indices.size();
-        int maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum)
-        {
-            const GfVec2i &line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-
-            finalIndices[lineNum].Set(v0, v1);
+    const int *curveIndicesPtr = curveIndices.cdata();
+    const bool hasIndices = !curveIndices.empty();
+    const int maxIndex = int(curveIndices.size()) - 1;
+
+    WorkParallelForN(
+        numCurves,
+        [&, wrap, skipFirstAndLastSegs](size_t begin, size_t end) {
+        for (size_t curve = begin; curve < end; ++curve) {
+            int count = countsPtr[curve];
+            int seg = segOffsets[curve];
+            int vertexIndex = vertOffsets[curve];
+
+            auto emit = [&](int v0, int v1) {
+                // If the topology has indices set, map the generated
+                // indices with the given indices.
+                if (hasIndices) {
+                    v0 = curveIndicesPtr[std::min(v0, maxIndex)];
+                    v1 = curveIndicesPtr[std::min(v1, maxIndex)];
+                }
+                indicesPtr[seg].Set(v0, v1);
+                // Map this line segment back to the curve it came from
+                primIndicesPtr[seg] = int(curve);
+                ++seg;
+            };
+
+            int v0 = vertexIndex;
+            int v1;
+            // Store first vert index incase we are wrapping
+            const int firstVert = v0;
+            ++ vertexIndex;
+            for (int i = 1; i < count; ++i) {
+                v1 = vertexIndex;
+                ++ vertexIndex;
+                if (!skipFirstAndLastSegs || (i > 1 && i < count-1)) {
+                    emit(v0, v1);
+                }
+                v0 = v1;
+            }
+            if (wrap) {
+                emit(v0, firstVert);
+            }
         }
-    }
-
-    VtIntArray finalPrimIndices(primIndices.size());
-    std::copy(  primIndices.begin(),
-                primIndices.end(),
-                finalPrimIndices.begin());
+    });
 
     return IndexAndPrimIndex(VtValue(finalIndices), VtValue(finalPrimIndices));
 }
@@ -308,11 +380,8 @@ HdSt_BasisCurvesIndexBuilderComputation::_BuildCubicIndexArray()
                                           [======= seg5 =======]
     */
 
-    std::vector<GfVec4i> indices;
-    std::vector<int> primIndices;
-
     const VtArray<int> vertexCounts = _topology->GetCurveVertexCounts();
-    bool wrap = _topology->GetCurveWrap() == HdTokens->periodic;
+    const bool wrap = _topology->GetCurveWrap() == HdTokens->periodic;
     int vStep;
     TfToken basis = _topology->GetCurveBasis();
     if(basis == HdTokens->bezier) {
@@ -322,75 +391,82 @@ HdSt_BasisCurvesIndexBuilderComputation::_BuildCubicIndexArray()
         vStep = 1;
     }
 
-    int vertexIndex = 0;
-    int curveIndex = 0;
-    TF_FOR_ALL(itCounts, vertexCounts) {
-        int count = *itCounts;
-        // The first segment always eats up 4 verts, not just vstep, so to
-        // compensate, we break at count - 3.
-        int numSegs;
-
-        // If we're closing the curve, make sure that we have enough
-        // segments to wrap all the way back to the beginning.
-        if (wrap) {
-            numSegs = count / vStep;
-        } else {
-            numSegs = ((count - 4) / vStep) + 1;
-        }
-
-        for(int i = 0;i < numSegs; ++i) {
-
-            // Set up curve segments based on curve basis
-            GfVec4i seg;
-            int offset = i*vStep;
-            for(int v = 0;v < 4; ++v) {
-                // If there are not enough verts to round out the segment
-                // just repeat the last vert.
-                seg[v] = wrap 
-                    ? vertexIndex + ((offset + v) % count)
-                    : vertexIndex + std::min(offset + v, (count -1));
-            }
-            indices.push_back(seg);
-            primIndices.push_back(curveIndex);
+    const size_t numCurves = vertexCounts.size();
+    const int *countsPtr = vertexCounts.cdata();
+
+    // Per-curve segment counts; see the segment math in the fill loop
+    // below.  Scanning them into offsets gives every curve a disjoint
+    // output range so the fill can run in parallel.
+    std::vector<int> segOffsets(numCurves);
+    std::vector<int> vertOffsets(numCurves);
+    WorkParallelForN(
+        numCurves,
+        [&, wrap, vStep](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            int count = countsPtr[i];
+            // The first segment always eats up 4 verts, not just vstep, so
+            // to compensate, we break at count - 3.
+            //
+            // If we're closing the curve, make sure that we have enough
+            // segments to wrap all the way back to the beginning.
+            int numSegs = wrap ? (count / vStep)
+                               : (((count - 4) / vStep) + 1);
+            segOffsets[i] = std::max(numSegs, 0);
+            vertOffsets[i] = count;
         }
-        vertexIndex += count;
-        curveIndex++;
-    }
+    });
+    const int numSegments = WorkParallelExclusiveScan(
+        segOffsets.begin(), numCurves, segOffsets.begin(), 0,
+        std::plus<int>());
+    WorkParallelExclusiveScan(
+        vertOffsets.begin(), numCurves, vertOffsets.begin(), 0,
+        std::plus<int>());
+
+    VtVec4iArray finalIndices(numSegments);
+    VtIntArray finalPrimIndices(numSegments);
+    GfVec4i *indicesPtr = finalIndices.data();
+    int *primIndicesPtr = finalPrimIndices.data();
 
-    VtVec4iArray finalIndices(indices.size());
     VtIntArray const &curveIndices = _topology->GetCurveIndices();
-
-    // If have topology has indices set, map the generated indices
-    // with the given indices.
-    if (curveIndices.empty())
-    {
-        std::copy(indices.begin(), indices.end(), finalIndices.begin());
-    }
-    else
-    {
-        size_t lineCount = indices.size();
-        int maxIndex = curveIndices.size() - 1;
-
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum)
-        {
-            const GfVec4i &line = indices[lineNum];
-
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-            int i2 = std::min(line[2], maxIndex);
-            int i3 = std::min(line[3], maxIndex);
-
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-            int v2 = curveIndices[i2];
-            int v3 = curveIndices[i3];
-
-            finalIndices[lineNum].Set(v0, v1, v2, v3);
+    const int *curveIndicesPtr = curveIndices.cdata();
+    const bool hasIndices = !curveIndices.empty();
+    const int maxIndex = int(curveIndices.size()) - 1;
+
+    WorkParallelForN(
+        numCurves,
+        [&, wrap, vStep](size_t begin, size_t end) {
+        for (size_t curve = begin; curve < end; ++curve) {
+            int count = countsPtr[curve];
+            int seg = segOffsets[curve];
+            int vertexIndex = vertOffsets[curve];
+            int curveSegs = wrap ? (count / vStep)
+                                 : (((count - 4) / vStep) + 1);
+
+            for (int i = 0; i < curveSegs; ++i) {
+                // Set up curve segments based on curve basis
+                GfVec4i segIndices;
+                int offset = i*vStep;
+                for (int v = 0; v < 4; ++v) {
+                    // If there are not enough verts to round out the segment
+                    // just repeat the last vert.
+                    segIndices[v] = wrap
+                        ? vertexIndex + ((offset + v) % count)
+                        : vertexIndex + std::min(offset + v, (count -1));
+                }
+                // If the topology has indices set, map the generated
+                // indices with the given indices.
+                if (hasIndices) {
+                    for (int v = 0; v < 4; ++v) {
+                        segIndices[v] = curveIndicesPtr[
+                            std::min(segIndices[v], maxIndex)];
+                    }
+                }
+                indicesPtr[seg] = segIndices;
+                primIndicesPtr[seg] = int(curve);
+                ++seg;
+            }
         }
-    }
-
-    VtIntArray finalPrimIndices(primIndices.size());
-    std::copy(primIndices.begin(), primIndices.end(), finalPrimIndices.begin());    
+    });
 
     return IndexAndPrimIndex(VtValue(finalIndices), VtValue(finalPrimIndices));
 }
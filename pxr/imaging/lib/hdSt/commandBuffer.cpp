@@ -35,8 +35,10 @@
 #include "pxr/imaging/hd/perfLog.h"
 #include "pxr/imaging/hd/tokens.h"
 
+#include "pxr/base/gf/frustum.h"
 #include "pxr/base/gf/matrix4f.h"
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/stl.h"
 
 #include "pxr/base/work/loops.h"
@@ -45,15 +47,33 @@
 
 #include <tbb/enumerable_thread_specific.h>
 
+#include <algorithm>
 #include <functional>
+#include <unordered_set>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(HDST_ENABLE_AGGRESSIVE_BATCH_MERGE, true,
+                      "Batch draw items by geometric shader and resource "
+                      "layout only, rather than by the exact buffer arrays "
+                      "backing them, to minimize the number of multi-draw "
+                      "indirect batches");
+
+static bool
+_IsEnabledAggressiveBatchMerge()
+{
+    // The merged batches rely on per-draw data indexed by the draw index
+    // within a multi-draw, which only the MDI path provides.
+    GlfContextCaps const &caps = GlfContextCaps::GetInstance();
+    return TfGetEnvSetting(HDST_ENABLE_AGGRESSIVE_BATCH_MERGE) &&
+           caps.multiDrawIndirectEnabled;
+}
 
 HdStCommandBuffer::HdStCommandBuffer()
     : _visibleSize(0)
     , _visChangeCount(0)
     , _batchVersion(0)
+    , _numDrawItemEdits(0)
 {
     /*NOTHING*/
 }
@@ -77,6 +97,32 @@ _NewDrawBatch(HdStDrawItemInstance * drawItemInstance)
     }
 }
 
+static
+size_t
+_GetDrawBatchKey(HdStDrawItem const * drawItem, bool bindlessTexture,
+                 bool aggressiveMerge)
+{
+    size_t key = drawItem->GetGeometricShader()->ComputeHash();
+
+    // In aggressive merge mode the key deliberately ignores which buffer
+    // arrays back the item. Append() verifies actual aggregation
+    // compatibility, so items only split into separate batches under the
+    // same key when their resources genuinely cannot share bindings.
+    if (!aggressiveMerge) {
+        boost::hash_combine(key, drawItem->GetBufferArraysHash());
+    }
+
+    if (!bindlessTexture) {
+        // Geometric, RenderPass and Lighting shaders should never break
+        // batches, however materials can. We consider the material
+        // parameters to be part of the batch key here for that reason.
+        boost::hash_combine(key, HdMaterialParam::ComputeHash(
+                        drawItem->GetMaterialShader()->GetParams()));
+    }
+
+    return key;
+}
+
 void
 HdStCommandBuffer::PrepareDraw(
     HdStRenderPassStateSharedPtr const &renderPassState,
@@ -122,9 +168,127 @@ void
 HdStCommandBuffer::SwapDrawItems(std::vector<HdStDrawItem const*>* items,
                                unsigned currentBatchVersion)
 {
+    if (_ApplyDrawItemEdits(items)) {
+        // Batch-affecting state may also have changed on the items that
+        // were retained, so validate (and if needed rebuild) the surviving
+        // batches in place.
+        RebuildDrawBatchesIfNeeded(currentBatchVersion);
+    } else {
+        _drawItems.swap(*items);
+        _RebuildDrawBatches();
+        _batchVersion = currentBatchVersion;
+    }
+}
+
+bool
+HdStCommandBuffer::_ApplyDrawItemEdits(std::vector<HdStDrawItem const*>* items)
+{
+    HD_TRACE_FUNCTION();
+
+    if (_drawItems.empty() || _drawItemIndexMap.empty()) {
+        // No batches have been built yet.
+        return false;
+    }
+
+    // Diff the new draw item list against the current one.
+    std::unordered_set<HdStDrawItem const*> newItems(items->begin(),
+                                                     items->end());
+    std::vector<HdStDrawItem const*> addedItems;
+    for (HdStDrawItem const* drawItem : *items) {
+        if (_drawItemIndexMap.count(drawItem) == 0) {
+            addedItems.push_back(drawItem);
+        }
+    }
+    std::vector<HdStDrawItem const*> removedItems;
+    for (HdStDrawItem const* drawItem : _drawItems) {
+        if (newItems.count(drawItem) == 0) {
+            removedItems.push_back(drawItem);
+        }
+    }
+
+    // Deferred compaction: incremental removals leave batches fragmented
+    // and their aggregated buffer ranges sparsely used. Once the edits
+    // since the last full rebuild amount to a significant fraction of the
+    // scene, fall back to rebatching from scratch.
+    _numDrawItemEdits += addedItems.size() + removedItems.size();
+    if (_numDrawItemEdits * 4 > items->size()) {
+        return false;
+    }
+
+    for (HdStDrawItem const* drawItem : removedItems) {
+        std::unordered_map<HdStDrawItem const*, size_t>::iterator indexIt =
+            _drawItemIndexMap.find(drawItem);
+        if (!TF_VERIFY(indexIt != _drawItemIndexMap.end())) {
+            return false;
+        }
+        size_t index = indexIt->second;
+        HdStDrawItemInstanceSharedPtr const instance = _drawItemInstances[index];
+        _drawItemIndexMap.erase(indexIt);
+
+        HdSt_DrawBatch * batch = instance->GetBatch();
+        if (batch) {
+            batch->Remove(instance.get());
+            if (batch->GetDrawItemInstanceCount() == 0) {
+                // Drop the now empty batch.
+                auto isBatch = [batch](HdSt_DrawBatchSharedPtr const &b) {
+                    return b.get() == batch;
+                };
+                _drawBatches.erase(
+                    std::find_if(_drawBatches.begin(), _drawBatches.end(),
+                                 isBatch));
+                for (auto it = _batchMap.begin(); it != _batchMap.end(); ++it) {
+                    HdSt_DrawBatchSharedPtrVector &candidates = it->second;
+                    auto batchIt = std::find_if(candidates.begin(),
+                                                candidates.end(), isBatch);
+                    if (batchIt != candidates.end()) {
+                        candidates.erase(batchIt);
+                        if (candidates.empty()) {
+                            _batchMap.erase(it);
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Erase the instance by swapping with the last element.
+        if (index + 1 < _drawItemInstances.size()) {
+            _drawItemInstances[index] = _drawItemInstances.back();
+            _drawItemIndexMap[_drawItemInstances[index]->GetDrawItem()] = index;
+        }
+        _drawItemInstances.pop_back();
+    }
+
+    bool bindlessTexture = GlfContextCaps::GetInstance()
+                                               .bindlessTextureEnabled;
+    bool aggressiveMerge = _IsEnabledAggressiveBatchMerge();
+
+    for (HdStDrawItem const* drawItem : addedItems) {
+        if (!TF_VERIFY(drawItem->GetGeometricShader(), "%s",
+                       drawItem->GetRprimID().GetText()) ||
+            !TF_VERIFY(drawItem->GetMaterialShader(), "%s",
+                       drawItem->GetRprimID().GetText())) {
+            continue;
+        }
+
+        HdStDrawItemInstanceSharedPtr drawItemInstance(
+            new HdStDrawItemInstance(drawItem));
+        _drawItemIndexMap[drawItem] = _drawItemInstances.size();
+        _drawItemInstances.push_back(drawItemInstance);
+
+        size_t key = _GetDrawBatchKey(drawItem, bindlessTexture,
+                                      aggressiveMerge);
+
+        _AppendDrawItemInstance(drawItemInstance, key);
+    }
+
     _drawItems.swap(*items);
-    _RebuildDrawBatches();
-    _batchVersion = currentBatchVersion;
+
+    // Reset culling state, as for a full rebuild.
+    _visibleSize = 0;
+    _visChangeCount = 0;
+
+    return true;
 }
 
 void
@@ -156,14 +320,15 @@ HdStCommandBuffer::_RebuildDrawBatches()
     _drawBatches.clear();
     _drawItemInstances.clear();
     _drawItemInstances.reserve(_drawItems.size());
+    _batchMap.clear();
+    _drawItemIndexMap.clear();
+    _numDrawItemEdits = 0;
 
     HD_PERF_COUNTER_INCR(HdPerfTokens->rebuildBatches);
 
     bool bindlessTexture = GlfContextCaps::GetInstance()
                                                .bindlessTextureEnabled;
-
-    // XXX: Temporary sorting by shader.
-    std::map<size_t, HdSt_DrawBatchSharedPtr> batchMap;
+    bool aggressiveMerge = _IsEnabledAggressiveBatchMerge();
 
     for (size_t i = 0; i < _drawItems.size(); i++) {
         HdStDrawItem const * drawItem = _drawItems[i];
@@ -175,33 +340,40 @@ HdStCommandBuffer::_RebuildDrawBatches()
             continue;
         }
 
-        _drawItemInstances.push_back(HdStDrawItemInstance(drawItem));
-        HdStDrawItemInstance* drawItemInstance = &_drawItemInstances.back();
+        HdStDrawItemInstanceSharedPtr drawItemInstance(
+            new HdStDrawItemInstance(drawItem));
+        _drawItemIndexMap[drawItem] = _drawItemInstances.size();
+        _drawItemInstances.push_back(drawItemInstance);
 
-        size_t key = drawItem->GetGeometricShader()->ComputeHash();
-        boost::hash_combine(key, drawItem->GetBufferArraysHash());
-
-        if (!bindlessTexture) {
-            // Geometric, RenderPass and Lighting shaders should never break
-            // batches, however materials can. We consider the material 
-            // parameters to be part of the batch key here for that reason.
-            boost::hash_combine(key, HdMaterialParam::ComputeHash(
-                            drawItem->GetMaterialShader()->GetParams()));
-        }
+        size_t key = _GetDrawBatchKey(drawItem, bindlessTexture,
+                                      aggressiveMerge);
 
-        TF_DEBUG(HDST_DRAW_BATCH).Msg("%lu (%lu)\n", 
-                key, 
+        TF_DEBUG(HDST_DRAW_BATCH).Msg("%lu (%lu)\n",
+                key,
                 drawItem->GetBufferArraysHash());
                 //, drawItem->GetRprimID().GetText());
 
-        HdSt_DrawBatchSharedPtr batch;
-        TfMapLookup(batchMap, key, &batch);
-        if (!batch || !batch->Append(drawItemInstance)) {
-            batch = _NewDrawBatch(drawItemInstance);
-            _drawBatches.push_back(batch);
-            batchMap[key] = batch;
+        _AppendDrawItemInstance(drawItemInstance, key);
+    }
+}
+
+void
+HdStCommandBuffer::_AppendDrawItemInstance(
+    HdStDrawItemInstanceSharedPtr const &drawItemInstance, size_t key)
+{
+    // Probe every candidate batch registered under this key; batches only
+    // refuse items whose resources cannot share bindings with theirs, so
+    // this packs items into the fewest batches the binding model allows.
+    HdSt_DrawBatchSharedPtrVector &candidates = _batchMap[key];
+    for (HdSt_DrawBatchSharedPtr const &candidate : candidates) {
+        if (candidate->Append(drawItemInstance.get())) {
+            return;
         }
     }
+
+    HdSt_DrawBatchSharedPtr batch = _NewDrawBatch(drawItemInstance.get());
+    _drawBatches.push_back(batch);
+    candidates.push_back(batch);
 }
 
 void
@@ -228,7 +400,7 @@ HdStCommandBuffer::SyncDrawItemVisibility(unsigned visChangeCount)
         end = std::min(end*N, _drawItemInstances.size());
         size_t& count = visCounts.local();
         for (size_t i = start; i < end; ++i) {
-            HdStDrawItem const* item = _drawItemInstances[i].GetDrawItem();
+            HdStDrawItem const* item = _drawItemInstances[i]->GetDrawItem();
 
             bool visible = item->GetVisible();
             // DrawItemInstance->SetVisible is not only an inline function but
@@ -238,9 +410,9 @@ HdStCommandBuffer::SyncDrawItemVisibility(unsigned visChangeCount)
 
             // however, if this is an instancing prim and visible, it always has
             // to be called since instanceCount may changes over time.
-            if ((_drawItemInstances[i].IsVisible() != visible) || 
+            if ((_drawItemInstances[i]->IsVisible() != visible) || 
                 (visible && item->HasInstancer())) {
-                _drawItemInstances[i].SetVisible(visible);
+                _drawItemInstances[i]->SetVisible(visible);
             }
             if (visible) {
                 ++count;
@@ -267,18 +439,59 @@ HdStCommandBuffer::FrustumCull(GfMatrix4d const &viewProjMatrix)
 
     struct _Worker {
         static
-        void cull(std::vector<HdStDrawItemInstance> * drawItemInstances,
+        void updateVisibility(HdStDrawItemInstance &itemInstance,
+                              HdStDrawItem const &item,
+                              bool visible)
+        {
+            if ((itemInstance.IsVisible() != visible) ||
+                (visible && item.HasInstancer())) {
+                itemInstance.SetVisible(visible);
+            }
+        }
+
+        static
+        void cull(std::vector<HdStDrawItemInstanceSharedPtr> * drawItemInstances,
                 GfMatrix4d const &viewProjMatrix,
-                size_t begin, size_t end) 
+                size_t begin, size_t end)
         {
-            for(size_t i = begin; i < end; i++) {
-                HdStDrawItemInstance& itemInstance = (*drawItemInstances)[i];
-                HdStDrawItem const* item = itemInstance.GetDrawItem();
-                bool visible = item->GetVisible() && 
-                    item->IntersectsViewVolume(viewProjMatrix);
-                if ((itemInstance.IsVisible() != visible) || 
-                    (visible && item->HasInstancer())) {
-                    itemInstance.SetVisible(visible);
+            // Test non-instanced bounds against the view volume in
+            // contiguous batches, so GfFrustum can amortize its per-call
+            // overhead across the batch.
+            constexpr size_t maxBatchSize = 1024;
+            std::vector<GfBBox3d> bounds;
+            std::vector<HdStDrawItemInstance *> batched;
+            uint64_t visibleBits[(maxBatchSize + 63) / 64];
+            bounds.reserve(std::min(maxBatchSize, end - begin));
+            batched.reserve(bounds.capacity());
+
+            for (size_t i = begin; i < end; ) {
+                bounds.clear();
+                batched.clear();
+                for (; i < end && bounds.size() < maxBatchSize; ++i) {
+                    HdStDrawItemInstance& itemInstance =
+                        *(*drawItemInstances)[i];
+                    HdStDrawItem const* item = itemInstance.GetDrawItem();
+                    if (!item->GetVisible()) {
+                        updateVisibility(itemInstance, *item, false);
+                    } else if (item->GetInstanceIndexRange()) {
+                        // XXX: As in HdDrawItem::IntersectsViewVolume, the
+                        // bounds of all instances would need to be tested.
+                        updateVisibility(itemInstance, *item, true);
+                    } else {
+                        bounds.push_back(item->GetBounds());
+                        batched.push_back(&itemInstance);
+                    }
+                }
+                if (!bounds.empty()) {
+                    GfFrustum::IntersectsViewVolume(
+                        bounds.data(), bounds.size(), viewProjMatrix,
+                        visibleBits);
+                    for (size_t j = 0; j < bounds.size(); ++j) {
+                        bool const visible =
+                            (visibleBits[j / 64] >> (j % 64)) & 1;
+                        updateVisibility(*batched[j],
+                                         *batched[j]->GetDrawItem(), visible);
+                    }
                 }
             }
         }
@@ -299,7 +512,7 @@ HdStCommandBuffer::FrustumCull(GfMatrix4d const &viewProjMatrix)
 
     _visibleSize = 0;
     for (auto const& instance : _drawItemInstances) {
-        if (instance.IsVisible()) {
+        if (instance->IsVisible()) {
             ++_visibleSize;
         }
     }
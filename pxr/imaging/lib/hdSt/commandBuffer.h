@@ -35,6 +35,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <unordered_map>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -48,6 +49,8 @@ typedef boost::shared_ptr<class HdStResourceRegistry>
 typedef boost::shared_ptr<class HdStRenderPassState> HdStRenderPassStateSharedPtr;
 typedef boost::shared_ptr<class HdSt_DrawBatch> HdSt_DrawBatchSharedPtr;
 typedef std::vector<HdSt_DrawBatchSharedPtr> HdSt_DrawBatchSharedPtrVector;
+typedef boost::shared_ptr<class HdStDrawItemInstance>
+    HdStDrawItemInstanceSharedPtr;
 
 /// \class HdStCommandBuffer
 ///
@@ -84,6 +87,9 @@ public:
 
     /// Destructively swaps the contents of \p items with the internal list of
     /// all draw items. Culling state is reset, with no items visible.
+    /// When only a small fraction of the items has been added or removed,
+    /// the existing draw batches are updated incrementally rather than
+    /// rebuilt from scratch.
     HDST_API
     void SwapDrawItems(std::vector<HdStDrawItem const*>* items,
                        unsigned currentBatchVersion);
@@ -109,12 +115,36 @@ public:
 private:
     void _RebuildDrawBatches();
 
+    // Applies the difference between \p items and the current draw item
+    // list to the existing batches, inserting and removing individual
+    // draw item instances. Returns false if the edit could not be applied
+    // incrementally (e.g. no batches exist yet, or too many items changed
+    // since the last full rebuild) and a full rebuild is required.
+    bool _ApplyDrawItemEdits(std::vector<HdStDrawItem const*>* items);
+
+    // Appends \p drawItemInstance to the first batch registered under
+    // \p key that can absorb it, creating a new batch if none can.
+    void _AppendDrawItemInstance(
+        HdStDrawItemInstanceSharedPtr const &drawItemInstance, size_t key);
+
     std::vector<HdStDrawItem const*> _drawItems;
-    std::vector<HdStDrawItemInstance> _drawItemInstances;
+    std::vector<HdStDrawItemInstanceSharedPtr> _drawItemInstances;
     HdSt_DrawBatchSharedPtrVector _drawBatches;
     size_t _visibleSize;
     unsigned _visChangeCount;
     unsigned _batchVersion;
+
+    // Aggregation key -> candidate batches, used to find an existing batch
+    // for a draw item. Several batches may share a key when their items
+    // cannot be aggregated with each other (e.g. they live in different
+    // underlying buffer arrays).
+    std::unordered_map<size_t, HdSt_DrawBatchSharedPtrVector> _batchMap;
+    // Draw item -> index into _drawItemInstances.
+    std::unordered_map<HdStDrawItem const*, size_t> _drawItemIndexMap;
+    // Number of incremental edits applied since the last full rebuild;
+    // deferred compaction falls back to a full rebuild once batches get
+    // too fragmented.
+    size_t _numDrawItemEdits;
 };
 
 
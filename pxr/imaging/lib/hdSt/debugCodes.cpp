@@ -53,6 +53,9 @@ TF_REGISTRY_FUNCTION(TfDebug)
 
     TF_DEBUG_ENVIRONMENT_SYMBOL(HDST_MATERIAL_REMOVED,
         "Report when a material is removed");
+
+    TF_DEBUG_ENVIRONMENT_SYMBOL(HDST_SHADER_CACHE,
+        "Report on-disk shader program binary cache hits and misses");
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -40,7 +40,8 @@ TF_DEBUG_CODES(
     HDST_DUMP_SHADER_SOURCEFILE,
     HDST_DUMP_SHADER_BINARY,
     HDST_MATERIAL_ADDED,
-    HDST_MATERIAL_REMOVED
+    HDST_MATERIAL_REMOVED,
+    HDST_SHADER_CACHE
 );
 
 
@@ -45,6 +45,9 @@
 
 #include "pxr/base/tf/getenv.h"
 
+#include <algorithm>
+#include <iterator>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
@@ -122,6 +125,33 @@ HdSt_DrawBatch::Append(HdStDrawItemInstance * drawItemInstance)
     }
 }
 
+/*virtual*/
+bool
+HdSt_DrawBatch::Remove(HdStDrawItemInstance * drawItemInstance)
+{
+    std::vector<HdStDrawItemInstance const*>::iterator it =
+        std::find(_drawItemInstances.begin(), _drawItemInstances.end(),
+                  drawItemInstance);
+    if (it == _drawItemInstances.end()) {
+        return false;
+    }
+
+    it = _drawItemInstances.erase(it);
+
+    // Batch indices mirror each instance's position in the batch.
+    for (; it != _drawItemInstances.end(); ++it) {
+        const_cast<HdStDrawItemInstance*>(*it)->SetBatchIndex(
+            std::distance(_drawItemInstances.begin(), it));
+    }
+
+    drawItemInstance->SetBatch(nullptr);
+
+    // Force shader to refresh.
+    _shaderHash = 0;
+
+    return true;
+}
+
 /*static*/
 bool
 HdSt_DrawBatch::_IsAggregated(HdStDrawItem const *drawItem0,
@@ -251,9 +281,8 @@ HdSt_DrawBatch::_GetDrawingProgram(HdStRenderPassStateSharedPtr const &state,
             
             typedef boost::shared_ptr<class HioGlslfx> HioGlslfxSharedPtr;
 
-            HioGlslfxSharedPtr glslSurfaceFallback = 
-                HioGlslfxSharedPtr(
-                        new HioGlslfx(HdStPackageFallbackSurfaceShader()));
+            HioGlslfxSharedPtr glslSurfaceFallback =
+                HioGlslfx::GetShared(HdStPackageFallbackSurfaceShader());
 
             HdStShaderCodeSharedPtr fallbackSurface =
                 HdStShaderCodeSharedPtr(
@@ -326,10 +355,19 @@ HdSt_DrawBatch::_DrawingProgram::CompileShader(
             resourceRegistry->RegisterGLSLProgram(hash, &programInstance);
 
         if (programInstance.IsFirstInstance()) {
-            HdStGLSLProgramSharedPtr glslProgram = codeGen.Compile();
-            if (glslProgram && _Link(glslProgram)) {
-                // store the program into the program registry.
-                programInstance.SetValue(glslProgram);
+            // Try the on-disk program binary cache before compiling from
+            // source; a restored binary already carries the link-time state.
+            HdStGLSLProgramSharedPtr cachedProgram(
+                new HdStGLSLProgram(HdTokens->drawingShader));
+            if (cachedProgram->LoadFromCache(hash)) {
+                programInstance.SetValue(cachedProgram);
+            } else {
+                HdStGLSLProgramSharedPtr glslProgram = codeGen.Compile();
+                if (glslProgram && _Link(glslProgram)) {
+                    glslProgram->SaveToCache(hash);
+                    // store the program into the program registry.
+                    programInstance.SetValue(glslProgram);
+                }
             }
         }
 
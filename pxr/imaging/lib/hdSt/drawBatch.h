@@ -72,6 +72,18 @@ public:
     HDST_API
     bool Append(HdStDrawItemInstance * drawItemInstance);
 
+    /// Removes \a drawItemInstance from the batch, e.g. when its draw item
+    /// is removed from the render pass. Returns \a false if the instance is
+    /// not part of this batch. Draw commands derived from the batch's
+    /// instances are rebuilt on the next PrepareDraw.
+    HDST_API
+    virtual bool Remove(HdStDrawItemInstance * drawItemInstance);
+
+    /// Returns the number of draw item instances in the batch.
+    size_t GetDrawItemInstanceCount() const {
+        return _drawItemInstances.size();
+    }
+
     /// Attempt to rebuild the batch in-place, returns false if draw items are
     /// no longer compatible.
     HDST_API
@@ -74,6 +74,9 @@ public:
     // HDST_API
     void SetBatch(HdSt_DrawBatch *batch);
 
+    /// Return the batch this instance belongs to, or nullptr.
+    HdSt_DrawBatch *GetBatch() const { return _batch; }
+
     /// Return a const pointer to draw item
     HdStDrawItem const *GetDrawItem() const { return _drawItem; }
 
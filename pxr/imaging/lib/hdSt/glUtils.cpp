@@ -37,6 +37,7 @@
 #include "pxr/base/gf/matrix4f.h"
 #include "pxr/base/gf/matrix4d.h"
 #include "pxr/imaging/hdSt/glConversions.h"
+#include "pxr/imaging/hd/bufferKernels.h"
 #include "pxr/imaging/hd/perfLog.h"
 #include "pxr/imaging/hd/tokens.h"
 #include "pxr/base/vt/array.h"
@@ -108,11 +109,8 @@ _CreateVtArray(int numElements, int arraySize, int stride,
         memcpy(dst, src, numElements*arraySize*sizeof(T));
     } else {
         // deinterleaving
-        for (int i = 0; i < numElements; ++i) {
-            memcpy(dst, src, arraySize*sizeof(T));
-            dst += arraySize*sizeof(T);
-            src += stride;
-        }
+        HdDeinterleaveElements(dst, src, stride,
+                               arraySize*sizeof(T), numElements);
     }
     return VtValue(array);
 }
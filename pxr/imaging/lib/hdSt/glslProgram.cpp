@@ -30,11 +30,17 @@
 #include "pxr/imaging/hdSt/glslProgram.h"
 #include "pxr/imaging/hdSt/glUtils.h"
 #include "pxr/imaging/hdSt/resourceRegistry.h"
+#include "pxr/base/arch/hash.h"
+#include "pxr/base/tf/atomicOfstreamWrapper.h"
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/stringUtils.h"
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -42,6 +48,69 @@ PXR_NAMESPACE_OPEN_SCOPE
 TF_DEFINE_ENV_SETTING(HD_ENABLE_SHARED_CONTEXT_CHECK, 0,
     "Enable GL context sharing validation");
 
+TF_DEFINE_ENV_SETTING(HDST_SHADER_CACHE_PATH, "",
+    "Directory used to cache linked GLSL program binaries across sessions "
+    "(empty disables the cache)");
+
+namespace {
+
+// Bumped whenever the cache file layout below changes.
+const uint32_t _ShaderCacheFormatVersion = 1;
+
+bool
+_IsShaderCacheEnabled()
+{
+    static const std::string path = TfGetEnvSetting(HDST_SHADER_CACHE_PATH);
+    return !path.empty();
+}
+
+std::string
+_GetShaderCacheFilePath(HdStGLSLProgram::ID hash)
+{
+    static const std::string path = TfGetEnvSetting(HDST_SHADER_CACHE_PATH);
+    if (path.empty()) {
+        return std::string();
+    }
+    return TfStringPrintf("%s/%zx.bin", path.c_str(), hash);
+}
+
+// Program binaries are only guaranteed to load on the driver that produced
+// them, so the cache files carry a digest of the driver identification
+// strings. Requires a current GL context.
+uint64_t
+_GetDriverHash()
+{
+    static uint64_t driverHash = []() {
+        uint32_t hash = 0;
+        for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+            const char *str =
+                reinterpret_cast<const char *>(glGetString(name));
+            if (str) {
+                hash = ArchHash(str, strlen(str), hash);
+            }
+        }
+        return static_cast<uint64_t>(hash);
+    }();
+    return driverHash;
+}
+
+template <typename T>
+bool
+_Read(std::istream &in, T *value)
+{
+    in.read(reinterpret_cast<char *>(value), sizeof(T));
+    return static_cast<bool>(in);
+}
+
+template <typename T>
+void
+_Write(std::ostream &out, T const &value)
+{
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+} // anonymous namespace
+
 HdStGLSLProgram::HdStGLSLProgram(TfToken const &role)
     : _program(role), _uniformBuffer(role)
 {
@@ -186,7 +255,7 @@ HdStGLSLProgram::Link()
 
     bool dumpShaderBinary = TfDebug::IsEnabled(HDST_DUMP_SHADER_BINARY);
 
-    if (dumpShaderBinary) {
+    if (dumpShaderBinary || _IsShaderCacheEnabled()) {
         // set RETRIEVABLE_HINT to true for getting program binary length.
         // note: Actually the GL driver may recompile the program dynamically on
         // some state changes, so the size of program could be inaccurate.
@@ -238,6 +307,153 @@ HdStGLSLProgram::Link()
     return success;
 }
 
+bool
+HdStGLSLProgram::LoadFromCache(ID hash)
+{
+    HD_TRACE_FUNCTION();
+
+    std::string const filePath = _GetShaderCacheFilePath(hash);
+    if (filePath.empty()) {
+        return false;
+    }
+
+    // glew has to be initialized
+    if (!glProgramBinary) {
+        return false;
+    }
+
+    std::ifstream input(filePath.c_str(), std::ios::in | std::ios::binary);
+    if (!input) {
+        TF_DEBUG(HDST_SHADER_CACHE).Msg(
+            "Shader cache miss for %zx\n", hash);
+        return false;
+    }
+
+    uint32_t version = 0;
+    uint64_t driverHash = 0;
+    uint32_t binaryFormat = 0;
+    uint64_t binarySize = 0;
+    if (!_Read(input, &version) ||
+        !_Read(input, &driverHash) ||
+        !_Read(input, &binaryFormat) ||
+        !_Read(input, &binarySize)) {
+        return false;
+    }
+    if (version != _ShaderCacheFormatVersion ||
+        driverHash != _GetDriverHash()) {
+        TF_DEBUG(HDST_SHADER_CACHE).Msg(
+            "Rejecting stale shader cache entry %s\n", filePath.c_str());
+        return false;
+    }
+
+    std::vector<char> bin(binarySize);
+    input.read(bin.data(), binarySize);
+    if (!input) {
+        return false;
+    }
+
+    // create a program if not exists
+    GLuint program = _program.GetId();
+    if (program == 0) {
+        program = glCreateProgram();
+        _program.SetAllocation(program, 0);
+    }
+
+    glProgramBinary(program, static_cast<GLenum>(binaryFormat),
+                    bin.data(), static_cast<GLsizei>(binarySize));
+
+    // The driver is free to reject a binary (e.g. after an update); the
+    // caller falls back to compiling from source in that case.
+    std::string logString;
+    if (!HdStGLUtils::GetProgramLinkStatus(program, &logString)) {
+        TF_DEBUG(HDST_SHADER_CACHE).Msg(
+            "Driver rejected shader cache entry %s: %s\n",
+            filePath.c_str(), logString.c_str());
+        return false;
+    }
+
+    TF_DEBUG(HDST_SHADER_CACHE).Msg(
+        "Shader cache hit for %zx\n", hash);
+
+    // initial program size
+    GLint size;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+
+    // update the program resource allocation
+    _program.SetAllocation(program, size);
+
+    // create an uniform buffer
+    GLuint uniformBuffer = _uniformBuffer.GetId();
+    if (uniformBuffer == 0) {
+        glGenBuffers(1, &uniformBuffer);
+        _uniformBuffer.SetAllocation(uniformBuffer, 0);
+    }
+
+    return true;
+}
+
+void
+HdStGLSLProgram::SaveToCache(ID hash) const
+{
+    HD_TRACE_FUNCTION();
+
+    std::string const filePath = _GetShaderCacheFilePath(hash);
+    if (filePath.empty()) {
+        return;
+    }
+
+    // glew has to be initialized
+    if (!glGetProgramBinary) {
+        return;
+    }
+
+    GLuint program = _program.GetId();
+    if (program == 0) {
+        return;
+    }
+
+    GLint size = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+    if (size == 0) {
+        return;
+    }
+
+    std::vector<char> bin(size);
+    GLsizei binarySize = 0;
+    GLenum binaryFormat = 0;
+    glGetProgramBinary(program, size, &binarySize, &binaryFormat, &bin[0]);
+    if (binarySize == 0) {
+        return;
+    }
+
+    // Write via the atomic wrapper so concurrent processes sharing the
+    // cache directory never observe a partially written binary.
+    TfAtomicOfstreamWrapper wrapper(filePath);
+    std::string reason;
+    if (!wrapper.Open(&reason)) {
+        TF_DEBUG(HDST_SHADER_CACHE).Msg(
+            "Could not open shader cache file: %s\n", reason.c_str());
+        return;
+    }
+
+    std::ofstream &output = wrapper.GetStream();
+    _Write(output, _ShaderCacheFormatVersion);
+    _Write(output, _GetDriverHash());
+    _Write(output, static_cast<uint32_t>(binaryFormat));
+    _Write(output, static_cast<uint64_t>(binarySize));
+    output.write(&bin[0], binarySize);
+
+    if (!wrapper.Commit(&reason)) {
+        TF_DEBUG(HDST_SHADER_CACHE).Msg(
+            "Could not commit shader cache file: %s\n", reason.c_str());
+        return;
+    }
+
+    TF_DEBUG(HDST_SHADER_CACHE).Msg(
+        "Saved shader cache entry %s (size=%d)\n",
+        filePath.c_str(), binarySize);
+}
+
 bool
 HdStGLSLProgram::Validate() const
 {
@@ -280,16 +496,21 @@ HdStGLSLProgram::GetComputeProgram(
         HdStGLSLProgramSharedPtr newProgram(
             new HdStGLSLProgram(HdTokens->computeShader));
 
-        HioGlslfx glslfx(HdStPackageComputeShader());
-        std::string version = "#version 430\n";
-        if (!newProgram->CompileShader(
-                GL_COMPUTE_SHADER, version + glslfx.GetSource(shaderToken))) {
-            TF_CODING_ERROR("Fail to compile " + shaderToken.GetString());
-            return HdStGLSLProgramSharedPtr();
-        }
-        if (!newProgram->Link()) {
-            TF_CODING_ERROR("Fail to link " + shaderToken.GetString());
-            return HdStGLSLProgramSharedPtr();
+        HdStGLSLProgram::ID hash = HdStGLSLProgram::ComputeHash(shaderToken);
+        if (!newProgram->LoadFromCache(hash)) {
+            HioGlslfx glslfx(HdStPackageComputeShader());
+            std::string version = "#version 430\n";
+            if (!newProgram->CompileShader(
+                    GL_COMPUTE_SHADER,
+                    version + glslfx.GetSource(shaderToken))) {
+                TF_CODING_ERROR("Fail to compile " + shaderToken.GetString());
+                return HdStGLSLProgramSharedPtr();
+            }
+            if (!newProgram->Link()) {
+                TF_CODING_ERROR("Fail to link " + shaderToken.GetString());
+                return HdStGLSLProgramSharedPtr();
+            }
+            newProgram->SaveToCache(hash);
         }
         programInstance.SetValue(newProgram);
     }
@@ -63,6 +63,20 @@ public:
     HDST_API
     bool Link();
 
+    /// Attempts to restore a previously linked program binary for \a hash
+    /// from the on-disk shader cache (see HDST_SHADER_CACHE_PATH). Returns
+    /// false if the cache is disabled, no binary has been saved for the
+    /// hash, or the driver rejects the binary; the caller should fall back
+    /// to compiling from source.
+    HDST_API
+    bool LoadFromCache(ID hash);
+
+    /// Saves the linked program binary to the on-disk shader cache, keyed
+    /// by \a hash. Does nothing if the cache is disabled or the program
+    /// hasn't been linked.
+    HDST_API
+    void SaveToCache(ID hash) const;
+
     /// Validate if this program is a valid progam in the current context.
     HDST_API
     bool Validate() const;
@@ -44,7 +44,7 @@ HdStGLSLFXShader::~HdStGLSLFXShader()
 void
 HdStGLSLFXShader::Reload()
 {
-    HioGlslfxSharedPtr newGlslFx(new HioGlslfx(_glslfx->GetFilePath()));
+    HioGlslfxSharedPtr newGlslFx = HioGlslfx::GetShared(_glslfx->GetFilePath());
 
     if (newGlslFx->IsValid())
     {
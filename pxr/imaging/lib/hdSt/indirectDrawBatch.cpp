@@ -104,6 +104,8 @@ HdSt_IndirectDrawBatch::HdSt_IndirectDrawBatch(
 
     , _instanceCountOffset(0)
     , _cullInstanceCountOffset(0)
+    , _cullResultsValid(false)
+    , _lastCullCommitVersion(0)
     , _cullResultSync(0)
 {
     _Init(drawItemInstance);
@@ -171,6 +173,7 @@ HdSt_IndirectDrawBatch::SetEnableTinyPrimCulling(bool tinyPrimCulling)
     if (_useTinyPrimCulling != tinyPrimCulling) {
         _useTinyPrimCulling = tinyPrimCulling;
         _dirtyCullingProgram = true;
+        _cullResultsValid = false;
     }
 }
 
@@ -222,6 +225,10 @@ HdSt_IndirectDrawBatch::_CompileBatch(
     int drawCount = _drawItemInstances.size();
     if (_drawItemInstances.empty()) return;
 
+    // the dispatch buffer is rebuilt from scratch; any previously computed
+    // cull results are gone with it.
+    _cullResultsValid = false;
+
     // note that when changing struct definition of XFB culling,
     // HdSt_IndirectDrawBatch::_CullingProgram::_CustomLink should also be
     // changed accordingly.
@@ -840,6 +847,21 @@ HdSt_IndirectDrawBatch::_CompileBatch(
     }
 }
 
+bool
+HdSt_IndirectDrawBatch::Remove(HdStDrawItemInstance * drawItemInstance)
+{
+    if (!HdSt_DrawBatch::Remove(drawItemInstance)) {
+        return false;
+    }
+
+    // The dispatch buffer's draw commands no longer line up with the
+    // remaining instances; drop it so PrepareDraw recompiles the batch.
+    _dispatchBuffer.reset();
+    _dispatchBufferCullInput.reset();
+
+    return true;
+}
+
 bool
 HdSt_IndirectDrawBatch::Validate(bool deepValidation)
 {
@@ -992,18 +1014,32 @@ HdSt_IndirectDrawBatch::PrepareDraw(
             _dispatchBufferCullInput->CopyData(_drawCommandBuffer);
         }
         _drawCommandBufferDirty = false;
+        _cullResultsValid = false;
     }
 
     //
     // cull
     //
 
-    if (gpuCulling && !freezeCulling) {
+    // The cull results are still valid if the cull inputs haven't changed
+    // since they were computed: same cull matrix and draw range, and no
+    // resource commits that could have moved or deformed geometry.
+    bool executeCulling = gpuCulling && !freezeCulling &&
+        !(_cullResultsValid &&
+          _lastCullMatrix == renderPassState->GetCullMatrix() &&
+          _lastDrawRangeNDC == renderPassState->GetDrawingRangeNDC() &&
+          _lastCullCommitVersion == resourceRegistry->GetCommitVersion());
+
+    if (executeCulling) {
         if (_useGpuInstanceCulling) {
             _GPUFrustumCulling(batchItem, renderPassState, resourceRegistry);
         } else {
             _GPUFrustumCullingXFB(batchItem, renderPassState, resourceRegistry);
         }
+        _lastCullMatrix = renderPassState->GetCullMatrix();
+        _lastDrawRangeNDC = renderPassState->GetDrawingRangeNDC();
+        _lastCullCommitVersion = resourceRegistry->GetCommitVersion();
+        _cullResultsValid = true;
     }
 
     if (TfDebug::IsEnabled(HD_DRAWITEM_DRAWN)) {
@@ -1072,7 +1108,7 @@ HdSt_IndirectDrawBatch::PrepareDraw(
         }
     }
 
-    if (gpuCulling && !freezeCulling) {
+    if (executeCulling) {
         if (IsEnabledGPUCountVisibleInstances()) {
             _EndGPUCountVisibleInstances(_cullResultSync, &_numVisibleItems);
             glDeleteSync(_cullResultSync);
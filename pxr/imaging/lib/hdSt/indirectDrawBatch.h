@@ -31,6 +31,9 @@
 #include "pxr/imaging/hdSt/drawBatch.h"
 #include "pxr/imaging/hdSt/persistentBuffer.h"
 
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/vec2f.h"
+
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -54,6 +57,9 @@ public:
     ~HdSt_IndirectDrawBatch();
 
     // HdSt_DrawBatch overrides
+    HDST_API
+    virtual bool Remove(HdStDrawItemInstance * drawItemInstance) override;
+
     HDST_API
     virtual bool Validate(bool deepValidation) override;
 
@@ -89,6 +95,15 @@ public:
     HDST_API
     static bool IsEnabledGPUInstanceFrustumCulling();
 
+    /// Returns the dispatch buffer holding the batch's draw commands with
+    /// the per-command instance counts written by GPU frustum culling.
+    /// Other passes drawing the same batch contents (e.g. shadow or
+    /// picking passes) can reuse these culled commands rather than
+    /// re-running culling.
+    HdStDispatchBufferSharedPtr const &GetCulledDispatchBuffer() const {
+        return _dispatchBuffer;
+    }
+
 protected:
     HDST_API
     virtual void _Init(HdStDrawItemInstance * drawItemInstance) override;
@@ -171,6 +186,13 @@ private:
     int _instanceCountOffset;
     int _cullInstanceCountOffset;
 
+    // Validity tracking for cull results, so that frames with unchanged
+    // cull inputs can skip the culling dispatch entirely.
+    bool _cullResultsValid;
+    GfMatrix4d _lastCullMatrix;
+    GfVec2f _lastDrawRangeNDC;
+    size_t _lastCullCommitVersion;
+
     // We'll use this fence to signal when GPU frustum culling is
     // complete if we need to read back result data from the GPU.
     GLsync _cullResultSync;
@@ -40,6 +40,7 @@
 #include "pxr/imaging/hd/perfLog.h"
 #include "pxr/imaging/hd/tokens.h"
 #include "pxr/imaging/hdSt/glConversions.h"
+#include "pxr/imaging/hdSt/stagingBuffer.h"
 
 #include "pxr/imaging/hf/perfLog.h"
 
@@ -692,6 +693,15 @@ HdStInterleavedMemoryManager::_StripedInterleavedBufferRange::CopyData(
         const unsigned char *data =
             (const unsigned char*)bufferSource->GetData();
 
+        // When the destination is contiguous, upload through the
+        // persistently mapped staging ring in one go; the commit becomes
+        // a GPU-side copy that overlaps subsequent CPU work.
+        if ((_numElements == 1 || vboStride == dataSize) &&
+            HdStStagingBuffer::GetInstance().StageAndCopy(
+                VBO->GetId(), vboOffset, dataSize * _numElements, data)) {
+            return;
+        }
+
         for (size_t i = 0; i < _numElements; ++i) {
             HD_PERF_COUNTER_INCR(HdPerfTokens->glBufferSubData);
 
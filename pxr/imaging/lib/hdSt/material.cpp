@@ -53,7 +53,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     (limitSurfaceEvaluation)
 );
 
-HioGlslfx *HdStMaterial::_fallbackSurfaceShader = nullptr;
+HioGlslfxSharedPtr HdStMaterial::_fallbackSurfaceShader;
 
 // A bindless GL sampler buffer.
 // This identifies a texture as a 64-bit handle, passed to GLSL as "uvec2".
@@ -497,13 +497,13 @@ HdStMaterial::SetSurfaceShader(HdStSurfaceShaderSharedPtr &shaderCode)
 void
 HdStMaterial::_InitFallbackShader()
 {
-    if (_fallbackSurfaceShader != nullptr) {
+    if (_fallbackSurfaceShader) {
         return;
     }
 
     const TfToken &filePath = HdStPackageFallbackSurfaceShader();
 
-    _fallbackSurfaceShader = new HioGlslfx(filePath);
+    _fallbackSurfaceShader = HioGlslfx::GetShared(filePath);
 
     // Check fallback shader loaded, if not continue with the invalid shader
     // this would mean the shader compilation fails and the prim would not
@@ -40,6 +40,7 @@ typedef std::vector<HdStTextureResourceSharedPtr>
                                 HdStTextureResourceSharedPtrVector;
 
 class HioGlslfx;
+typedef boost::shared_ptr<class HioGlslfx> HioGlslfxSharedPtr;
 
 class HdStMaterial final: public HdMaterial {
 public:
@@ -133,7 +134,7 @@ private:
 
     void _InitFallbackShader();
 
-    static HioGlslfx                  *_fallbackSurfaceShader;
+    static HioGlslfxSharedPtr          _fallbackSurfaceShader;
 
     HdStSurfaceShaderSharedPtr         _surfaceShader;
     HdStTextureResourceSharedPtrVector _fallbackTextureResources;
@@ -1558,11 +1558,11 @@ _GetMixinShaderSource(TfToken const &shaderStageKey)
     // TODO: each delegate should provide their own package of mixin shaders
     // the lighting mixins are fallback only.
     static std::once_flag firstUse;
-    static std::unique_ptr<HioGlslfx> mixinFX;
-   
+    static HioGlslfxSharedPtr mixinFX;
+
     std::call_once(firstUse, [](){
         std::string filePath = HdStPackageLightingIntegrationShader();
-        mixinFX.reset(new HioGlslfx(filePath));
+        mixinFX = HioGlslfx::GetShared(filePath);
     });
 
     return mixinFX->GetSource(shaderStageKey);
@@ -302,8 +302,8 @@ HdStRenderDelegate::DestroyBprim(HdBprim *bPrim)
 HdSprim *
 HdStRenderDelegate::_CreateFallbackMaterialPrim()
 {
-    HioGlslfxSharedPtr glslfx(
-        new HioGlslfx(HdStPackageFallbackSurfaceShader()));
+    HioGlslfxSharedPtr glslfx =
+        HioGlslfx::GetShared(HdStPackageFallbackSurfaceShader());
 
     HdStSurfaceShaderSharedPtr fallbackShaderCode(new HdStGLSLFXShader(glslfx));
 
@@ -0,0 +1,245 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/imaging/glf/glew.h"
+#include "pxr/imaging/glf/contextCaps.h"
+
+#include "pxr/imaging/hdSt/stagingBuffer.h"
+
+#include "pxr/imaging/hd/perfLog.h"
+#include "pxr/imaging/hd/tokens.h"
+
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/instantiateSingleton.h"
+
+#include <algorithm>
+#include <cstring>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_INSTANTIATE_SINGLETON(HdStStagingBuffer);
+
+TF_DEFINE_ENV_SETTING(HDST_ENABLE_STAGING_BUFFER, true,
+                      "Enable the persistently mapped staging ring buffer "
+                      "for VBO uploads");
+
+TF_DEFINE_ENV_SETTING(HDST_STAGING_BUFFER_SIZE, 32*1024*1024,
+                      "Size of the persistently mapped staging ring buffer "
+                      "for VBO uploads, in bytes");
+
+// Keep staging writes aligned so GPU-side copies start on cache line
+// friendly offsets.
+static const size_t _StagingAlignment = 256;
+
+HdStStagingBuffer::HdStStagingBuffer()
+    : _id(0)
+    , _mappedAddress(nullptr)
+    , _capacity(0)
+    , _segmentSize(0)
+    , _head(0)
+    , _allocationFailed(false)
+{
+    for (size_t i = 0; i < _numSegments; ++i) {
+        _segmentFences[i] = 0;
+    }
+}
+
+HdStStagingBuffer::~HdStStagingBuffer()
+{
+    // The GL context is likely gone by static destruction time; GL
+    // resources are released through Deallocate() instead.
+}
+
+/* static */
+HdStStagingBuffer &
+HdStStagingBuffer::GetInstance()
+{
+    return TfSingleton<HdStStagingBuffer>::GetInstance();
+}
+
+bool
+HdStStagingBuffer::IsEnabled() const
+{
+    static bool enabled = TfGetEnvSetting(HDST_ENABLE_STAGING_BUFFER);
+
+    GlfContextCaps const &caps = GlfContextCaps::GetInstance();
+    return enabled
+        && caps.bufferStorageEnabled
+        && caps.copyBufferEnabled
+        && !_allocationFailed;
+}
+
+bool
+HdStStagingBuffer::_Allocate()
+{
+    GlfContextCaps const &caps = GlfContextCaps::GetInstance();
+
+    size_t capacity = std::max(
+        TfGetEnvSetting(HDST_STAGING_BUFFER_SIZE),
+        (int)(_numSegments * _StagingAlignment));
+    // Round the capacity to a multiple of the segment count so segment
+    // boundaries stay aligned.
+    capacity -= capacity % (_numSegments * _StagingAlignment);
+
+    GLbitfield const access =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    GLuint newId = 0;
+    glGenBuffers(1, &newId);
+
+    if (ARCH_LIKELY(caps.directStateAccessEnabled)) {
+        glNamedBufferStorageEXT(newId, capacity, nullptr, access);
+        _mappedAddress = static_cast<uint8_t*>(
+            glMapNamedBufferRangeEXT(newId, 0, capacity, access));
+    } else {
+        glBindBuffer(GL_COPY_READ_BUFFER, newId);
+        glBufferStorage(GL_COPY_READ_BUFFER, capacity, nullptr, access);
+        _mappedAddress = static_cast<uint8_t*>(
+            glMapBufferRange(GL_COPY_READ_BUFFER, 0, capacity, access));
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    }
+
+    if (!_mappedAddress) {
+        TF_WARN("Failed to map the staging ring buffer (%zu bytes); "
+                "falling back to glBufferSubData uploads", capacity);
+        glDeleteBuffers(1, &newId);
+        _allocationFailed = true;
+        return false;
+    }
+
+    _id = newId;
+    _capacity = capacity;
+    _segmentSize = capacity / _numSegments;
+    _head = 0;
+
+    return true;
+}
+
+void
+HdStStagingBuffer::_FenceSegment(size_t segment)
+{
+    if (_segmentFences[segment]) {
+        glDeleteSync(_segmentFences[segment]);
+    }
+    _segmentFences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void
+HdStStagingBuffer::_WaitSegment(size_t segment)
+{
+    // In steady state the fence is several frames old and the wait
+    // returns immediately.
+    if (_segmentFences[segment]) {
+        static const GLuint64 timeout = 10000000000ULL; // 10s, in ns
+        GLenum result = glClientWaitSync(
+            _segmentFences[segment], GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+        if (result == GL_TIMEOUT_EXPIRED || result == GL_WAIT_FAILED) {
+            TF_WARN("Timed out waiting on a staging ring buffer fence");
+        }
+        glDeleteSync(_segmentFences[segment]);
+        _segmentFences[segment] = 0;
+    }
+}
+
+bool
+HdStStagingBuffer::StageAndCopy(GLuint dstId, GLintptr dstOffset,
+                                GLsizeiptr dataSize, void const *data)
+{
+    if (!IsEnabled()) {
+        return false;
+    }
+
+    if (!_id && !_Allocate()) {
+        return false;
+    }
+
+    // Copies larger than a segment can't be fenced at segment granularity;
+    // let the caller upload those directly.
+    if (static_cast<size_t>(dataSize) > _segmentSize) {
+        return false;
+    }
+
+    GlfContextCaps const &caps = GlfContextCaps::GetInstance();
+
+    size_t segment = _head / _segmentSize;
+    size_t segmentEnd = (segment + 1) * _segmentSize;
+    if (_head + dataSize > segmentEnd) {
+        // The copy doesn't fit in the remainder of the current segment.
+        // Fence the segment we're leaving so it isn't overwritten until
+        // the GPU has consumed all copies sourced from it, advance to the
+        // next segment and wait until that one is free for reuse.
+        _FenceSegment(segment);
+        segment = (segment + 1) % _numSegments;
+        _head = segment * _segmentSize;
+        _WaitSegment(segment);
+    }
+
+    memcpy(_mappedAddress + _head, data, dataSize);
+
+    // The mapping is coherent, so the GPU sees the write without an
+    // explicit flush once the copy below is issued.
+    if (ARCH_LIKELY(caps.directStateAccessEnabled)) {
+        glNamedCopyBufferSubDataEXT(_id, dstId, _head, dstOffset, dataSize);
+    } else {
+        glBindBuffer(GL_COPY_READ_BUFFER, _id);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, dstId);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                            _head, dstOffset, dataSize);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+    HD_PERF_COUNTER_INCR(HdPerfTokens->glCopyBufferSubData);
+
+    _head += (dataSize + _StagingAlignment - 1)
+             & ~(_StagingAlignment - 1);
+    if (_head >= _capacity) {
+        // Wrapped off the end of the ring.
+        _FenceSegment(_numSegments - 1);
+        _head = 0;
+        _WaitSegment(0);
+    }
+
+    return true;
+}
+
+void
+HdStStagingBuffer::Deallocate()
+{
+    for (size_t i = 0; i < _numSegments; ++i) {
+        if (_segmentFences[i]) {
+            glDeleteSync(_segmentFences[i]);
+            _segmentFences[i] = 0;
+        }
+    }
+    if (_id) {
+        glDeleteBuffers(1, &_id);
+        _id = 0;
+    }
+    _mappedAddress = nullptr;
+    _capacity = 0;
+    _segmentSize = 0;
+    _head = 0;
+    _allocationFailed = false;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,105 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef HDST_STAGING_BUFFER_H
+#define HDST_STAGING_BUFFER_H
+
+#include "pxr/pxr.h"
+#include "pxr/imaging/glf/glew.h"
+#include "pxr/imaging/hdSt/api.h"
+#include "pxr/base/tf/singleton.h"
+
+#include <boost/noncopyable.hpp>
+
+#include <cstdint>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class HdStStagingBuffer
+///
+/// A persistently coherent-mapped ring buffer used to stage CPU data for
+/// buffer uploads.
+///
+/// Instead of handing client memory to glBufferSubData, which typically
+/// makes the driver allocate and copy through an internal staging area,
+/// upload data is memcpy'd into a region of the persistently mapped ring
+/// and then copied into the destination VBO with a GPU-side buffer copy.
+/// The GPU copy overlaps subsequent CPU work, which substantially reduces
+/// driver stalls when large amounts of primvar data are re-uploaded every
+/// frame (e.g. for deforming meshes).
+///
+/// The ring is divided into a small number of segments, each protected by
+/// a fence. A segment is fenced off once the ring advances past it and is
+/// not reused for new data until the fence has been signaled, i.e. until
+/// the GPU has consumed all copies sourced from it.
+///
+class HdStStagingBuffer : boost::noncopyable {
+public:
+    /// Returns the singleton staging buffer.
+    HDST_API
+    static HdStStagingBuffer &GetInstance();
+
+    /// Returns true if staged uploads are supported by the current context
+    /// (requires ARB_buffer_storage) and haven't been disabled via
+    /// HDST_ENABLE_STAGING_BUFFER.
+    HDST_API
+    bool IsEnabled() const;
+
+    /// Copies \p dataSize bytes of \p data into \p dstId at \p dstOffset
+    /// through the staging ring. Returns false if the staging ring is
+    /// unavailable or the copy is too large to be staged; the caller
+    /// should fall back to glBufferSubData.
+    HDST_API
+    bool StageAndCopy(GLuint dstId, GLintptr dstOffset,
+                      GLsizeiptr dataSize, void const *data);
+
+    /// Deletes the GL resources held by the staging ring. Subsequent
+    /// StageAndCopy calls will reallocate them.
+    HDST_API
+    void Deallocate();
+
+private:
+    HdStStagingBuffer();
+    ~HdStStagingBuffer();
+    friend class TfSingleton<HdStStagingBuffer>;
+
+    bool _Allocate();
+    void _FenceSegment(size_t segment);
+    void _WaitSegment(size_t segment);
+
+    static const size_t _numSegments = 4;
+
+    GLuint _id;
+    uint8_t *_mappedAddress;
+    size_t _capacity;
+    size_t _segmentSize;
+    size_t _head;
+    GLsync _segmentFences[_numSegments];
+    bool _allocationFailed;
+};
+
+HDST_API_TEMPLATE_CLASS(TfSingleton<HdStStagingBuffer>);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif  // HDST_STAGING_BUFFER_H
@@ -41,7 +41,9 @@
 #include "pxr/imaging/pxOsd/refinerFactory.h"
 #include "pxr/imaging/pxOsd/tokens.h"
 
+#include "pxr/base/arch/hash.h"
 #include "pxr/base/gf/vec4i.h"
+#include "pxr/base/tf/staticData.h"
 
 #include <opensubdiv/version.h>
 #include <opensubdiv/far/patchTable.h>
@@ -54,6 +56,11 @@
 #include <opensubdiv/osd/mesh.h>
 
 #include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#include <map>
+#include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -99,6 +106,30 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 // ---------------------------------------------------------------------------
 
+namespace {
+
+// While topology refiners are mutated in place by the refinement pass and
+// therefore can't be shared, the stencil and patch tables they produce are
+// immutable once built. Identical topologies already share a single
+// HdSt_MeshTopology within a resource registry; this process-wide cache,
+// keyed by the topology hash (which includes subdiv tags) salted with the
+// refinement mode and level, extends that sharing across registries. Entries
+// are held weakly so tables are reclaimed with their last subdivision user.
+struct _RefinementTables {
+    boost::shared_ptr<OpenSubdiv::Far::StencilTable const> vertexStencils;
+    boost::shared_ptr<OpenSubdiv::Far::StencilTable const> varyingStencils;
+    boost::shared_ptr<OpenSubdiv::Far::PatchTable const> patchTable;
+};
+typedef boost::shared_ptr<_RefinementTables> _RefinementTablesSharedPtr;
+
+typedef std::map<HdTopology::ID,
+                 boost::weak_ptr<_RefinementTables>> _RefinementTablesCache;
+
+std::mutex _refinementTablesCacheMutex;
+TfStaticData<_RefinementTablesCache> _refinementTablesCache;
+
+} // anonymous namespace
+
 class HdSt_Osd3Subdivision : public HdSt_Subdivision {
 public:
     /// Construct HdSt_Subdivision. It takes an ownership of farmesh.
@@ -137,9 +168,7 @@ public:
         HdType dataType) override;
 
     void SetRefinementTables(
-        OpenSubdiv::Far::StencilTable const *vertexStencils,
-        OpenSubdiv::Far::StencilTable const *varyingStencils,
-        OpenSubdiv::Far::PatchTable const *patchTable,
+        _RefinementTablesSharedPtr const &tables,
         bool adaptive);
 
     bool IsAdaptive() const {
@@ -147,13 +176,11 @@ public:
     }
 
     OpenSubdiv::Far::PatchTable const *GetPatchTable() const {
-        return _patchTable;
+        return _tables ? _tables->patchTable.get() : NULL;
     }
 
 private:
-    OpenSubdiv::Far::StencilTable const *_vertexStencils;
-    OpenSubdiv::Far::StencilTable const *_varyingStencils;
-    OpenSubdiv::Far::PatchTable const *_patchTable;
+    _RefinementTablesSharedPtr _tables;
     bool _adaptive;
 
 #if HDST_ENABLE_GPU_SUBDIVISION
@@ -210,10 +237,7 @@ private:
 // ---------------------------------------------------------------------------
 
 HdSt_Osd3Subdivision::HdSt_Osd3Subdivision()
-    : _vertexStencils(NULL),
-      _varyingStencils(NULL),
-      _patchTable(NULL),
-      _adaptive(false)
+    : _adaptive(false)
 {
 #if HDST_ENABLE_GPU_SUBDIVISION
     _gpuStencilTable = NULL;
@@ -222,9 +246,6 @@ HdSt_Osd3Subdivision::HdSt_Osd3Subdivision()
 
 HdSt_Osd3Subdivision::~HdSt_Osd3Subdivision()
 {
-    delete _vertexStencils;
-    delete _varyingStencils;
-    delete _patchTable;
 #if HDST_ENABLE_GPU_SUBDIVISION
     delete _gpuStencilTable;
 #endif
@@ -232,18 +253,10 @@ HdSt_Osd3Subdivision::~HdSt_Osd3Subdivision()
 
 void
 HdSt_Osd3Subdivision::SetRefinementTables(
-    OpenSubdiv::Far::StencilTable const *vertexStencils,
-    OpenSubdiv::Far::StencilTable const *varyingStencils,
-    OpenSubdiv::Far::PatchTable const *patchTable,
+    _RefinementTablesSharedPtr const &tables,
     bool adaptive)
 {
-    if (_vertexStencils) delete _vertexStencils;
-    if (_varyingStencils) delete _varyingStencils;
-    if (_patchTable) delete _patchTable;
-
-    _vertexStencils = vertexStencils;
-    _varyingStencils = varyingStencils;
-    _patchTable = patchTable;
+    _tables = tables;
     _adaptive = adaptive;
 }
 
@@ -252,10 +265,10 @@ int
 HdSt_Osd3Subdivision::GetNumVertices() const
 {
     // returns the total number of vertices, including coarse and refined ones.
-    if (!TF_VERIFY(_vertexStencils)) return 0;
+    if (!TF_VERIFY(_tables && _tables->vertexStencils)) return 0;
 
-    return _vertexStencils->GetNumStencils() +
-        _vertexStencils->GetNumControlVertices();
+    return _tables->vertexStencils->GetNumStencils() +
+        _tables->vertexStencils->GetNumControlVertices();
 }
 
 /*virtual*/
@@ -264,8 +277,9 @@ HdSt_Osd3Subdivision::RefineCPU(HdBufferSourceSharedPtr const &source,
                               bool varying,
                               void *vertexBuffer)
 {
-    OpenSubdiv::Far::StencilTable const *stencilTable =
-        varying ? _varyingStencils : _vertexStencils;
+    OpenSubdiv::Far::StencilTable const *stencilTable = _tables ?
+        (varying ? _tables->varyingStencils.get()
+                 : _tables->vertexStencils.get()) : NULL;
 
     if (!TF_VERIFY(stencilTable)) return;
 
@@ -318,7 +332,7 @@ HdSt_Osd3Subdivision::RefineGPU(HdBufferArrayRangeSharedPtr const &range,
                               TfToken const &name)
 {
 #if HDST_ENABLE_GPU_SUBDIVISION
-    if (!TF_VERIFY(_vertexStencils)) return;
+    if (!TF_VERIFY(_tables && _tables->vertexStencils)) return;
 
     // filling coarse vertices has been done at resource registry.
 
@@ -332,7 +346,7 @@ HdSt_Osd3Subdivision::RefineGPU(HdBufferArrayRangeSharedPtr const &range,
     // vertex buffer is not interleaved, but aggregated.
     // we need an offset to locate the current range.
     size_t stride = vertexBuffer.GetNumElements();
-    int numCoarseVertices = _vertexStencils->GetNumControlVertices();
+    int numCoarseVertices = _tables->vertexStencils->GetNumControlVertices();
 
     OpenSubdiv::Osd::BufferDescriptor srcDesc(
         /*offset=*/range->GetOffset() * stride,
@@ -409,7 +423,7 @@ HdSt_Osd3Subdivision::_GetGpuStencilTable()
 
     if (!_gpuStencilTable) {
         _gpuStencilTable = HdSt_OsdGpuStencilTable::Create(
-            _vertexStencils, NULL);
+            _tables->vertexStencils.get(), NULL);
     }
 
     return _gpuStencilTable;
@@ -439,36 +453,55 @@ HdSt_Osd3TopologyComputation::Resolve()
 
     // do far analysis and set stencils and patch table into HdSt_Subdivision.
 
-    // create topology refiner
-    PxOsdTopologyRefinerSharedPtr refiner;
-
     if (!TF_VERIFY(_topology)) {
         _SetResolved();
         return true;
     }
 
-    // for empty topology, we don't need to refine anything.
-    // but still need to return the typed buffer for codegen
-    if (_topology->GetFaceVertexCounts().size() == 0) {
-        // leave refiner empty
-    } else {
-        refiner = PxOsdRefinerFactory::Create(_topology->GetPxOsdMeshTopology(),
-                                              TfToken(_id.GetText()));
-    }
-
     if (!TF_VERIFY(_subdivision)) {
         _SetResolved();
         return true;
     }
 
-    // refine
-    //  and
-    // create stencil/patch table
-    Far::StencilTable const *vertexStencils = NULL;
-    Far::StencilTable const *varyingStencils = NULL;
-    Far::PatchTable const *patchTable = NULL;
+    _RefinementTablesSharedPtr tables;
+    HdTopology::ID tablesId = 0;
+
+    // for empty topology, we don't need to refine anything.
+    // but still need to return the typed buffer for codegen
+    bool const emptyTopology = _topology->GetFaceVertexCounts().size() == 0;
+
+    if (!emptyTopology) {
+        // The topology hash includes subdiv tags; salt it with the
+        // refinement mode and level since those change the tables too.
+        tablesId = _topology->ComputeHash();
+        tablesId = ArchHash64((char const*)&_adaptive,
+                              sizeof(_adaptive), tablesId);
+        tablesId = ArchHash64((char const*)&_level, sizeof(_level), tablesId);
+
+        std::lock_guard<std::mutex> lock(_refinementTablesCacheMutex);
+        _RefinementTablesCache::const_iterator it =
+            _refinementTablesCache->find(tablesId);
+        if (it != _refinementTablesCache->end()) {
+            tables = it->second.lock();
+        }
+    }
+
+    // create topology refiner. the refiner is mutated by the refinement
+    // below, so it can't be shared; only the tables it produces can.
+    PxOsdTopologyRefinerSharedPtr refiner;
+    if (!tables && !emptyTopology) {
+        refiner = PxOsdRefinerFactory::Create(_topology->GetPxOsdMeshTopology(),
+                                              TfToken(_id.GetText()));
+    }
 
     if (refiner) {
+        // refine
+        //  and
+        // create stencil/patch table
+        Far::StencilTable const *vertexStencils = NULL;
+        Far::StencilTable const *varyingStencils = NULL;
+        Far::PatchTable const *patchTable = NULL;
+
         // split trace scopes.
         {
             HD_TRACE_SCOPE("refine");
@@ -501,33 +534,60 @@ HdSt_Osd3TopologyComputation::Resolve()
 
             patchTable = Far::PatchTableFactory::Create(*refiner, options);
         }
-    }
 
-    // merge endcap
-    if (patchTable && patchTable->GetLocalPointStencilTable()) {
-        // append stencils
-        if (Far::StencilTable const *vertexStencilsWithLocalPoints =
-            Far::StencilTableFactory::AppendLocalPointStencilTable(
-                *refiner,
-                vertexStencils,
-                patchTable->GetLocalPointStencilTable())) {
-            delete vertexStencils;
-            vertexStencils = vertexStencilsWithLocalPoints;
+        // merge endcap
+        if (patchTable && patchTable->GetLocalPointStencilTable()) {
+            // append stencils
+            if (Far::StencilTable const *vertexStencilsWithLocalPoints =
+                Far::StencilTableFactory::AppendLocalPointStencilTable(
+                    *refiner,
+                    vertexStencils,
+                    patchTable->GetLocalPointStencilTable())) {
+                delete vertexStencils;
+                vertexStencils = vertexStencilsWithLocalPoints;
+            }
+            if (Far::StencilTable const *varyingStencilsWithLocalPoints =
+                Far::StencilTableFactory::AppendLocalPointStencilTable(
+                    *refiner,
+                    varyingStencils,
+                    patchTable->GetLocalPointStencilTable())) {
+                delete varyingStencils;
+                varyingStencils = varyingStencilsWithLocalPoints;
+            }
         }
-        if (Far::StencilTable const *varyingStencilsWithLocalPoints =
-            Far::StencilTableFactory::AppendLocalPointStencilTable(
-                *refiner,
-                varyingStencils,
-                patchTable->GetLocalPointStencilTable())) {
-            delete varyingStencils;
-            varyingStencils = varyingStencilsWithLocalPoints;
+
+        tables.reset(new _RefinementTables());
+        tables->vertexStencils.reset(vertexStencils);
+        tables->varyingStencils.reset(varyingStencils);
+        tables->patchTable.reset(patchTable);
+
+        // publish the tables for other subdivisions sharing this topology.
+        // concurrent misses on the same key may build the tables twice; the
+        // last writer wins and the extra copy dies with its owner.
+        {
+            std::lock_guard<std::mutex> lock(_refinementTablesCacheMutex);
+            for (_RefinementTablesCache::iterator it =
+                     _refinementTablesCache->begin();
+                 it != _refinementTablesCache->end(); ) {
+                if (it->second.expired()) {
+                    it = _refinementTablesCache->erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            (*_refinementTablesCache)[tablesId] = tables;
         }
     }
 
+    if (!tables) {
+        // empty or invalid topology; leave the tables empty, but still give
+        // the subdivision a valid (empty) set so codegen stays consistent.
+        tables.reset(new _RefinementTables());
+    }
+
     // set tables to topology
-    // HdSt_Subdivision takes an ownership of stencilTable and patchTable.
-    _subdivision->SetRefinementTables(vertexStencils, varyingStencils,
-                                      patchTable, _adaptive);
+    // HdSt_Subdivision shares ownership of the stencil and patch tables.
+    _subdivision->SetRefinementTables(tables, _adaptive);
 
     _SetResolved();
     return true;
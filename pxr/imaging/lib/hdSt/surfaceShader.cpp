@@ -47,6 +47,8 @@ HdStSurfaceShader::HdStSurfaceShader()
  , _paramArray()
  , _textureDescriptors()
  , _materialTag()
+ , _computedHash(0)
+ , _isValidComputedHash(false)
 {
 }
 
@@ -59,8 +61,10 @@ HdStSurfaceShader::_SetSource(TfToken const &shaderStageKey, std::string const &
 {
     if (shaderStageKey == HdShaderTokens->fragmentShader) {
         _fragmentSource = source;
+        _isValidComputedHash = false;
     } else if (shaderStageKey == HdShaderTokens->geometryShader) {
         _geometrySource = source;
+        _isValidComputedHash = false;
     }
 }
 
@@ -190,6 +194,20 @@ HdStSurfaceShader::AddBindings(HdBindingRequestVector *customBindings)
 /*virtual*/
 HdStShaderCode::ID
 HdStSurfaceShader::ComputeHash() const
+{
+    // Batch aggregation with bindless textures compares material hashes for
+    // every draw item pairing, and the hash covers the full GLSL source.
+    // The hashed state only changes through the setters below, so compute
+    // it once and reuse the cached value until it is invalidated.
+    if (!_isValidComputedHash) {
+        _computedHash = _ComputeHash();
+        _isValidComputedHash = true;
+    }
+    return _computedHash;
+}
+
+HdStShaderCode::ID
+HdStSurfaceShader::_ComputeHash() const
 {
     size_t hash = 0;
     
@@ -224,24 +242,30 @@ void
 HdStSurfaceShader::SetFragmentSource(const std::string &source)
 {
     _fragmentSource = source;
+    _isValidComputedHash = false;
 }
 
 void
 HdStSurfaceShader::SetGeometrySource(const std::string &source)
 {
     _geometrySource = source;
+    _isValidComputedHash = false;
 }
 
 void
 HdStSurfaceShader::SetParams(const HdMaterialParamVector &params)
 {
     _params = params;
+    _isValidComputedHash = false;
 }
 
 void
 HdStSurfaceShader::SetTextureDescriptors(const TextureDescriptorVector &texDesc)
 {
+    // Only the texture names and types are hashed; bindless handles are
+    // deliberately excluded so handle updates don't break batches.
     _textureDescriptors = texDesc;
+    _isValidComputedHash = false;
 }
 
 void
@@ -288,6 +312,7 @@ void
 HdStSurfaceShader::SetMaterialTag(TfToken const &tag)
 {
     _materialTag = tag;
+    _isValidComputedHash = false;
 }
 
 /// If the prim is based on asset, reload that asset.
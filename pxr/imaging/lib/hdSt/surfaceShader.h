@@ -127,6 +127,13 @@ private:
 
     TfToken _materialTag;
 
+    // Cached value of ComputeHash; invalidated whenever one of the setters
+    // changes hashed state.
+    mutable ID _computedHash;
+    mutable bool _isValidComputedHash;
+
+    ID _ComputeHash() const;
+
     // No copying
     HdStSurfaceShader(const HdStSurfaceShader &)                     = delete;
     HdStSurfaceShader &operator =(const HdStSurfaceShader &)         = delete;
@@ -38,6 +38,7 @@
 #include "pxr/imaging/hdSt/glUtils.h"
 #include "pxr/imaging/hdSt/vboMemoryManager.h"
 #include "pxr/imaging/hdSt/glConversions.h"
+#include "pxr/imaging/hdSt/stagingBuffer.h"
 #include "pxr/imaging/hd/perfLog.h"
 #include "pxr/imaging/hd/tokens.h"
 
@@ -681,6 +682,14 @@ HdStVBOMemoryManager::_StripedBufferArrayRange::CopyData(
         }
         GLintptr vboOffset = bytesPerElement * _offset;
 
+        // Prefer to upload through the persistently mapped staging ring,
+        // which turns the commit into a GPU-side copy that overlaps
+        // subsequent CPU work instead of stalling in the driver.
+        if (HdStStagingBuffer::GetInstance().StageAndCopy(
+                VBO->GetId(), vboOffset, srcSize, bufferSource->GetData())) {
+            return;
+        }
+
         HD_PERF_COUNTER_INCR(HdPerfTokens->glBufferSubData);
 
         if (ARCH_LIKELY(caps.directStateAccessEnabled)) {
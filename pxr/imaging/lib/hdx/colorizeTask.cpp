@@ -27,6 +27,9 @@
 #include "pxr/imaging/hd/renderBuffer.h"
 #include "pxr/imaging/hd/tokens.h"
 
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/reduce.h"
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 HdxColorizeTask::HdxColorizeTask(HdSceneDelegate* delegate, SdfPath const& id)
@@ -63,59 +66,81 @@ struct _Colorizer {
     ColorizerCallback callback;
 };
 
+// The colorizers below run multithreaded: large AOVs (particularly from
+// CPU render delegates) make single-threaded colorization the bottleneck
+// of task execution, and each output pixel only depends on its input
+// pixel, so the work divides trivially into ranges.
+
 static void _colorizeNdcDepth(uint8_t* dest, uint8_t* src, size_t nPixels)
 {
     // depth is in clip space, so remap (-1, 1) to (0,1) and clamp.
     float *depthBuffer = reinterpret_cast<float*>(src);
-    for (size_t i = 0; i < nPixels; ++i) {
-        float valuef =
-            std::min(std::max((depthBuffer[i] * 0.5f) + 0.5f, 0.0f), 1.0f);
-        uint8_t value = (uint8_t)(255.0f * valuef);
-        // special case 1.0 (far plane) as all black.
-        if (depthBuffer[i] >= 1.0f) {
-            value = 0;
-        }
-        dest[i*4+0] = value;
-        dest[i*4+1] = value;
-        dest[i*4+2] = value;
-        dest[i*4+3] = 255;
-    }
+    WorkParallelForN(nPixels,
+        [&depthBuffer, &dest](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                float valuef =
+                    std::min(std::max(
+                        (depthBuffer[i] * 0.5f) + 0.5f, 0.0f), 1.0f);
+                uint8_t value = (uint8_t)(255.0f * valuef);
+                // special case 1.0 (far plane) as all black.
+                if (depthBuffer[i] >= 1.0f) {
+                    value = 0;
+                }
+                dest[i*4+0] = value;
+                dest[i*4+1] = value;
+                dest[i*4+2] = value;
+                dest[i*4+3] = 255;
+            }
+        });
 }
 static void _colorizeLinearDepth(uint8_t* dest, uint8_t* src, size_t nPixels)
 {
     // linearDepth is depth from the camera, in world units. Its range is
     // [0, N] for some maximum N; to display it, rescale to [0, 1] and
     // splat that across RGB.
-    float maxDepth = 0.0f;
     float *depthBuffer = reinterpret_cast<float*>(src);
-    for (size_t i = 0; i < nPixels; ++i) {
-        maxDepth = std::max(depthBuffer[i], maxDepth);
-    }
+    float maxDepth = WorkParallelReduceN(0.0f, nPixels,
+        [&depthBuffer](size_t begin, size_t end, float value) {
+            for (size_t i = begin; i < end; ++i) {
+                value = std::max(depthBuffer[i], value);
+            }
+            return value;
+        },
+        [](float lhs, float rhs) {
+            return std::max(lhs, rhs);
+        });
     if (maxDepth != 0.0f) {
-        for (size_t i = 0; i < nPixels; ++i) {
-            float valuef =
-                std::min(std::max((depthBuffer[i] / maxDepth), 0.0f), 1.0f);
-            uint8_t value =
-                (uint8_t)(255.0f * valuef);
-            dest[i*4+0] = value;
-            dest[i*4+1] = value;
-            dest[i*4+2] = value;
-            dest[i*4+3] = 255;
-        }
+        WorkParallelForN(nPixels,
+            [&depthBuffer, &dest, maxDepth](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    float valuef =
+                        std::min(std::max(
+                            (depthBuffer[i] / maxDepth), 0.0f), 1.0f);
+                    uint8_t value =
+                        (uint8_t)(255.0f * valuef);
+                    dest[i*4+0] = value;
+                    dest[i*4+1] = value;
+                    dest[i*4+2] = value;
+                    dest[i*4+3] = 255;
+                }
+            });
     }
 }
 static void _colorizeNormal(uint8_t* dest, uint8_t* src, size_t nPixels)
 {
     float *normalBuffer = reinterpret_cast<float*>(src);
-    for (size_t i = 0; i < nPixels; ++i) {
-        GfVec3f n(normalBuffer[i*3+0], normalBuffer[i*3+1],
-                  normalBuffer[i*3+2]);
-        n = (n * 0.5f) + GfVec3f(0.5f);
-        dest[i*4+0] = (uint8_t)(n[0] * 255.0f);
-        dest[i*4+1] = (uint8_t)(n[1] * 255.0f);
-        dest[i*4+2] = (uint8_t)(n[2] * 255.0f);
-        dest[i*4+3] = 255;
-    }
+    WorkParallelForN(nPixels,
+        [&normalBuffer, &dest](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                GfVec3f n(normalBuffer[i*3+0], normalBuffer[i*3+1],
+                          normalBuffer[i*3+2]);
+                n = (n * 0.5f) + GfVec3f(0.5f);
+                dest[i*4+0] = (uint8_t)(n[0] * 255.0f);
+                dest[i*4+1] = (uint8_t)(n[1] * 255.0f);
+                dest[i*4+2] = (uint8_t)(n[2] * 255.0f);
+                dest[i*4+3] = 255;
+            }
+        });
 }
 static void _colorizeId(uint8_t* dest, uint8_t* src, size_t nPixels)
 {
@@ -123,29 +148,35 @@ static void _colorizeId(uint8_t* dest, uint8_t* src, size_t nPixels)
     // hash the ID to 3 bytes and use those as color. Even fancier,
     // hash to hue and stratified (saturation, value) levels, etc.
     int32_t *idBuffer = reinterpret_cast<int32_t*>(src);
-    for (size_t i = 0; i < nPixels; ++i) {
-        int32_t id = idBuffer[i];
-        dest[i*4+0] = (uint8_t)(id & 0xff);
-        dest[i*4+1] = (uint8_t)((id >> 8) & 0xff);
-        dest[i*4+2] = (uint8_t)((id >> 16) & 0xff);
-        dest[i*4+3] = 255;
-    }
+    WorkParallelForN(nPixels,
+        [&idBuffer, &dest](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                int32_t id = idBuffer[i];
+                dest[i*4+0] = (uint8_t)(id & 0xff);
+                dest[i*4+1] = (uint8_t)((id >> 8) & 0xff);
+                dest[i*4+2] = (uint8_t)((id >> 16) & 0xff);
+                dest[i*4+3] = 255;
+            }
+        });
 }
 static void _colorizePrimvar(uint8_t* dest, uint8_t* src, size_t nPixels)
 {
     float *primvarBuffer = reinterpret_cast<float*>(src);
-    for (size_t i = 0; i < nPixels; ++i) {
-        GfVec3f p(std::fmod(primvarBuffer[i*3+0], 1.0f),
-                  std::fmod(primvarBuffer[i*3+1], 1.0f),
-                  std::fmod(primvarBuffer[i*3+2], 1.0f));
-        if (p[0] < 0.0f) { p[0] += 1.0f; }
-        if (p[1] < 0.0f) { p[1] += 1.0f; }
-        if (p[2] < 0.0f) { p[2] += 1.0f; }
-        dest[i*4+0] = (uint8_t)(p[0] * 255.0f);
-        dest[i*4+1] = (uint8_t)(p[1] * 255.0f);
-        dest[i*4+2] = (uint8_t)(p[2] * 255.0f);
-        dest[i*4+3] = 255;
-    }
+    WorkParallelForN(nPixels,
+        [&primvarBuffer, &dest](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                GfVec3f p(std::fmod(primvarBuffer[i*3+0], 1.0f),
+                          std::fmod(primvarBuffer[i*3+1], 1.0f),
+                          std::fmod(primvarBuffer[i*3+2], 1.0f));
+                if (p[0] < 0.0f) { p[0] += 1.0f; }
+                if (p[1] < 0.0f) { p[1] += 1.0f; }
+                if (p[2] < 0.0f) { p[2] += 1.0f; }
+                dest[i*4+0] = (uint8_t)(p[0] * 255.0f);
+                dest[i*4+1] = (uint8_t)(p[1] * 255.0f);
+                dest[i*4+2] = (uint8_t)(p[2] * 255.0f);
+                dest[i*4+3] = 255;
+            }
+        });
 }
 
 // XXX: It would be nice to make the colorizers more flexible on input format,
@@ -44,22 +44,45 @@
 #include "pxr/imaging/hdSt/bufferArrayRangeGL.h"
 #include "pxr/imaging/hdSt/bufferResourceGL.h"
 
+#include <algorithm>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
-TF_DEFINE_ENV_SETTING(HDX_ENABLE_OIT, true, 
+TF_DEFINE_ENV_SETTING(HDX_ENABLE_OIT, true,
                       "Enable order independent translucency");
 
+TF_DEFINE_ENV_SETTING(HDX_ENABLE_TILED_OIT, false,
+                      "Enable tiled two-pass OIT; a count pass sizes "
+                      "exact-fit per-tile fragment allocations within a "
+                      "fixed buffer budget");
+
+TF_DEFINE_ENV_SETTING(HDX_TILED_OIT_BUFFER_BUDGET_MB, 256,
+                      "GPU memory budget of the tiled OIT fragment "
+                      "buffers, in megabytes");
+
 typedef std::vector<HdBufferSourceSharedPtr> HdBufferSourceSharedPtrVector;
 
+// Edge length of a screen tile in pixels.
+static const int _oitTileSize = 64;
+// Ints per tile table entry: (count, offset, capacity, cursor).
+static const int _oitTileStride = 4;
+
 // -------------------------------------------------------------------------- //
 
 HdxOitRenderTask::HdxOitRenderTask(HdSceneDelegate* delegate, SdfPath const& id)
     : HdxRenderTask(delegate, id)
     , _oitRenderPassShader()
+    , _oitCountRenderPassShader()
     , _viewport(0)
+    , _useTiledOit(bool(TfGetEnvSetting(HDX_ENABLE_TILED_OIT)))
+    , _numTiles(0)
+    , _poolSamples(0)
 {
     _oitRenderPassShader.reset(
         new HdStRenderPassShader(HdxPackageRenderPassOitShader()));
+    _oitCountRenderPassShader.reset(
+        new HdStRenderPassShader(HdxPackageRenderPassOitCountShader()));
 }
 
 HdxOitRenderTask::~HdxOitRenderTask()
@@ -130,6 +153,18 @@ HdxOitRenderTask::Execute(HdTaskContext* ctx)
     // HdxRenderTask EXECUTE
     //
 
+    if (_useTiledOit && extendedState && _tileBar) {
+        // Count pass: render the geometry once with a shader that only
+        // bumps per-tile fragment counters, then size each tile's
+        // exact-fit allocation before accumulating.
+        extendedState->SetRenderPassShader(_oitCountRenderPassShader);
+        HdxRenderTask::Execute(ctx);
+
+        _AllocateOitTiles();
+
+        extendedState->SetRenderPassShader(_oitRenderPassShader);
+    }
+
     HdxRenderTask::Execute(ctx);
 
     //
@@ -155,14 +190,22 @@ HdxOitRenderTask::_PrepareOitBuffers(
 
     const int numSamples = 8; // Should match glslfx files
 
-    HdResourceRegistrySharedPtr const& resourceRegistry = 
+    // Tiled mode needs to read the tile counters back between the count
+    // and accumulation passes.
+    if (_useTiledOit && !glGetBufferSubData) {
+        TF_WARN("glGetBufferSubData missing for tiled OIT (old glew?); "
+                "falling back to the single-pass OIT buffers");
+        _useTiledOit = false;
+    }
+
+    HdResourceRegistrySharedPtr const& resourceRegistry =
         renderIndex->GetResourceRegistry();
 
     // XXX Rebuilding the buffers is a slow operation that slows viewport
     //     resizing. We only shrink in steps of 256^2 to reduce the impact.
     GfVec4i viewport;
     glGetIntegerv(GL_VIEWPORT, &viewport[0]);
-    
+
     int sizeNew = viewport[2] * viewport[3];
     int sizeOld = _viewport[2] * _viewport[3];
     bool rebuildOitBuffers = (sizeNew > sizeOld || sizeOld-sizeNew > 256*256);
@@ -174,15 +217,37 @@ HdxOitRenderTask::_PrepareOitBuffers(
         }
 
         _counterBar.reset();
-        _dataBar.reset();
-        _depthBar.reset();
-        _indexBar.reset();
+        _tileBar.reset();
         _uniformBar.reset();
+        if (!_useTiledOit) {
+            // In tiled mode the data/depth/index pool is sized by the
+            // budget, not the viewport, so it survives resizes.
+            _dataBar.reset();
+            _depthBar.reset();
+            _indexBar.reset();
+        }
         renderIndex->GetChangeTracker().SetGarbageCollectionNeeded();
 
         _viewport = viewport;
     }
 
+    // The fragment sample pool is sized for the worst case in single-pass
+    // mode and clamped to the fixed budget in tiled mode.  Each sample
+    // stores a vec4 color, a float depth and an int next-pointer.
+    if (_useTiledOit) {
+        const size_t bytesPerSample = 4*sizeof(float)+sizeof(float)+sizeof(int);
+        const size_t budgetBytes = size_t(
+            std::max(1, TfGetEnvSetting(HDX_TILED_OIT_BUFFER_BUDGET_MB)))
+            * 1024 * 1024;
+        _poolSamples = int(budgetBytes / bytesPerSample);
+    } else {
+        _poolSamples = _viewport[2] * _viewport[3] * numSamples;
+    }
+
+    const int tilesPerRow = (_viewport[2] + _oitTileSize - 1) / _oitTileSize;
+    const int tilesPerColumn = (_viewport[3] + _oitTileSize - 1) / _oitTileSize;
+    _numTiles = tilesPerRow * tilesPerColumn;
+
     //
     // Counter Buffer
     //
@@ -223,8 +288,8 @@ HdxOitRenderTask::_PrepareOitBuffers(
                                             HdBufferArrayUsageHint());
 
         VtIntArray indices;
-        size_t indicesSize = _viewport[2] * _viewport[3] * numSamples; 
-        int indicesValue = -1; 
+        size_t indicesSize = _poolSamples;
+        int indicesValue = -1;
         indices.assign(indicesSize, indicesValue);
 
         HdBufferSourceSharedPtr indicesSource(
@@ -249,7 +314,7 @@ HdxOitRenderTask::_PrepareOitBuffers(
                                             HdBufferArrayUsageHint());
 
         VtVec4fArray dataArray;
-        size_t dataSize = _viewport[2] * _viewport[3] * numSamples;
+        size_t dataSize = _poolSamples;
         GfVec4f dataValue = GfVec4f(0.0f, 0.0f, 0.0f, 0.0f); 
         dataArray.assign(dataSize, dataValue);
 
@@ -275,8 +340,8 @@ HdxOitRenderTask::_PrepareOitBuffers(
                                             HdBufferArrayUsageHint());
 
         VtFloatArray depthArray;
-        size_t depthSize = _viewport[2] * _viewport[3] * numSamples; 
-        float depthValue = 0.0f; 
+        size_t depthSize = _poolSamples;
+        float depthValue = 0.0f;
         depthArray.assign(depthSize, depthValue);
 
         HdBufferSourceSharedPtr depthSource(
@@ -287,6 +352,30 @@ HdxOitRenderTask::_PrepareOitBuffers(
 
     (*ctx)[HdxTokens->oitDepthBufferBar] = _depthBar;
 
+    //
+    // Tile Buffer
+    //
+    if (_useTiledOit && !_tileBar) {
+        HdBufferSpecVector specs;
+        specs.push_back(HdBufferSpec(
+            HdxTokens->hdxOitTileBuffer,
+            HdTupleType {HdTypeInt32, 1}));
+        _tileBar = resourceRegistry->AllocateSingleBufferArrayRange(
+                                            /*role*/HdxTokens->oitTiles,
+                                            specs,
+                                            HdBufferArrayUsageHint());
+
+        VtIntArray tiles;
+        size_t tilesSize = _numTiles * _oitTileStride;
+        int tilesValue = 0;
+        tiles.assign(tilesSize, tilesValue);
+
+        HdBufferSourceSharedPtr tileSource(
+                new HdVtBufferSource(HdxTokens->hdxOitTileBuffer,
+                                    VtValue(tiles)));
+        resourceRegistry->AddSource(_tileBar, tileSource);
+    }
+
     //
     // Uniforms
     //
@@ -298,6 +387,12 @@ HdxOitRenderTask::_PrepareOitBuffers(
             HdBufferSpec(HdxTokens->oitHeight, HdTupleType {HdTypeInt32, 1}));
         specs.push_back(
             HdBufferSpec(HdxTokens->oitSamples, HdTupleType {HdTypeInt32, 1}));
+        specs.push_back(
+            HdBufferSpec(HdxTokens->oitBufferSize,
+                         HdTupleType {HdTypeInt32, 1}));
+        specs.push_back(
+            HdBufferSpec(HdxTokens->oitTileSize,
+                         HdTupleType {HdTypeInt32, 1}));
         _uniformBar = resourceRegistry->AllocateUniformBufferArrayRange(
                                             /*role*/HdxTokens->oitUniforms,
                                             specs,
@@ -313,6 +408,12 @@ HdxOitRenderTask::_PrepareOitBuffers(
         uniformSources.push_back(HdBufferSourceSharedPtr(
                 new HdVtBufferSource(HdxTokens->oitSamples,
                                     VtValue(numSamples))));
+        uniformSources.push_back(HdBufferSourceSharedPtr(
+                new HdVtBufferSource(HdxTokens->oitBufferSize,
+                                    VtValue(_poolSamples))));
+        uniformSources.push_back(HdBufferSourceSharedPtr(
+                new HdVtBufferSource(HdxTokens->oitTileSize,
+                                    VtValue(_oitTileSize))));
         resourceRegistry->AddSources(_uniformBar, uniformSources);
     }
 
@@ -339,9 +440,27 @@ HdxOitRenderTask::_PrepareOitBuffers(
                              HdxTokens->oitIndexBufferBar, _indexBar,
                              /*interleave*/false));
         _oitRenderPassShader->AddBufferBinding(
-            HdBindingRequest(HdBinding::UBO, 
+            HdBindingRequest(HdBinding::UBO,
                              HdxTokens->oitUniformBar, _uniformBar,
                              /*interleave*/true));
+
+        if (_useTiledOit) {
+            // The tile buffer binding switches the write shader over to
+            // the exact-fit tile allocations; the count pass shader only
+            // needs the tile counters and the uniforms.
+            _oitRenderPassShader->AddBufferBinding(
+                HdBindingRequest(HdBinding::SSBO,
+                                 HdxTokens->oitTileBufferBar, _tileBar,
+                                 /*interleave*/false));
+            _oitCountRenderPassShader->AddBufferBinding(
+                HdBindingRequest(HdBinding::SSBO,
+                                 HdxTokens->oitTileBufferBar, _tileBar,
+                                 /*interleave*/false));
+            _oitCountRenderPassShader->AddBufferBinding(
+                HdBindingRequest(HdBinding::UBO,
+                                 HdxTokens->oitUniformBar, _uniformBar,
+                                 /*interleave*/true));
+        }
     }
 }
 
@@ -408,6 +527,72 @@ HdxOitRenderTask::_ClearOitGpuBuffers(HdTaskContext* ctx)
                             GL_RED,
                             GL_FLOAT,
                             &clearDepth);
+
+    //
+    // Tile Buffer
+    //
+    if (_tileBar) {
+        HdStBufferArrayRangeGLSharedPtr stTileBar =
+            boost::dynamic_pointer_cast<HdStBufferArrayRangeGL> (_tileBar);
+        HdStBufferResourceGLSharedPtr stTileResource =
+            stTileBar->GetResource(HdxTokens->hdxOitTileBuffer);
+        const GLint clearTile = 0;
+        glClearNamedBufferData(stTileResource->GetId(),
+                                GL_R32I,
+                                GL_RED_INTEGER,
+                                GL_INT,
+                                &clearTile);
+    }
+}
+
+void
+HdxOitRenderTask::_AllocateOitTiles()
+{
+    if (!_tileBar || !glGetBufferSubData) return;
+
+    HdStBufferArrayRangeGLSharedPtr stTileBar =
+        boost::dynamic_pointer_cast<HdStBufferArrayRangeGL> (_tileBar);
+    HdStBufferResourceGLSharedPtr stTileResource =
+        stTileBar->GetResource(HdxTokens->hdxOitTileBuffer);
+
+    // Make the count pass's atomic increments visible to the readback.
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT |
+                    GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    std::vector<GLint> tiles(_numTiles * _oitTileStride, 0);
+    const GLsizeiptr tileBytes = tiles.size() * sizeof(GLint);
+
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, stTileResource->GetId());
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, tileBytes, tiles.data());
+
+    // Exact-fit allocation: each tile gets as many samples as it counted.
+    // If the frame exceeds the budget every tile's capacity is clamped
+    // proportionally, so an overflowing tile drops its deepest fragments
+    // instead of starving the rest of the viewport.
+    size_t totalSamples = 0;
+    for (int i = 0; i < _numTiles; ++i) {
+        totalSamples += tiles[i * _oitTileStride];
+    }
+
+    const double fit = (totalSamples > size_t(_poolSamples))
+        ? double(_poolSamples) / double(totalSamples)
+        : 1.0;
+
+    int offset = 0;
+    for (int i = 0; i < _numTiles; ++i) {
+        const int count = tiles[i * _oitTileStride];
+        int capacity = (fit < 1.0) ? int(count * fit) : count;
+        capacity = std::min(capacity, _poolSamples - offset);
+
+        tiles[i * _oitTileStride + 1] = offset;
+        tiles[i * _oitTileStride + 2] = capacity;
+        tiles[i * _oitTileStride + 3] = 0;
+
+        offset += capacity;
+    }
+
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, tileBytes, tiles.data());
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 }
 
 
@@ -80,14 +80,25 @@ private:
     void _PrepareOitBuffers(HdTaskContext* ctx, HdRenderIndex* renderIndex);
     void _ClearOitGpuBuffers(HdTaskContext* ctx);
 
+    // Reads back the per-tile fragment counts produced by the count pass
+    // and sizes each tile's exact-fit allocation within the buffer budget.
+    void _AllocateOitTiles();
+
     HdStRenderPassShaderSharedPtr _oitRenderPassShader;
+    HdStRenderPassShaderSharedPtr _oitCountRenderPassShader;
 
     GfVec4i _viewport;
     HdBufferArrayRangeSharedPtr _counterBar;
     HdBufferArrayRangeSharedPtr _dataBar;
     HdBufferArrayRangeSharedPtr _depthBar;
     HdBufferArrayRangeSharedPtr _indexBar;
+    HdBufferArrayRangeSharedPtr _tileBar;
     HdBufferArrayRangeSharedPtr _uniformBar;
+
+    // Tiled two-pass mode state, see HDX_ENABLE_TILED_OIT.
+    bool _useTiledOit;
+    int _numTiles;
+    int _poolSamples;
 };
 
 
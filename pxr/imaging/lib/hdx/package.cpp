@@ -101,6 +101,13 @@ HdxPackageRenderPassOitShader()
     return shader;
 }
 
+TfToken
+HdxPackageRenderPassOitCountShader()
+{
+    static TfToken shader = _GetShaderPath("renderPassOitCountShader.glslfx");
+    return shader;
+}
+
 TfToken
 HdxPackageOitResolveImageShader()
 {
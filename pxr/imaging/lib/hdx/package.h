@@ -39,6 +39,7 @@ TfToken HdxPackageRenderPassShadowShader();
 TfToken HdxPackageSimpleLightingShader();
 TfToken HdxPackageColorCorrectionShader();
 TfToken HdxPackageRenderPassOitShader();
+TfToken HdxPackageRenderPassOitCountShader();
 TfToken HdxPackageOitResolveImageShader();
 
 
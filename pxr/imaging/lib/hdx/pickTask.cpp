@@ -54,6 +54,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_PUBLIC_TOKENS(HdxPickTokens, HDX_PICK_TOKENS);
 
+static const GLuint64 HDX_PICK_READBACK_TIMEOUT_NS = 5e9;
+
 static HdRenderPassStateSharedPtr
 _InitIdRenderPassState(HdRenderIndex *index)
 {
@@ -85,11 +87,23 @@ HdxPickTask::HdxPickTask(HdSceneDelegate* delegate, SdfPath const& id)
     : HdTask(id)
     , _renderTags()
     , _index(nullptr)
+    , _readbackRingIndex(0)
 {
 }
 
 HdxPickTask::~HdxPickTask()
 {
+    // Release async readback resources. This requires a current GL context
+    // sharing the one the buffers were created on.
+    for (int i = 0; i < _ReadbackRingSize; ++i) {
+        _ReadbackRequest &request = _readbackRing[i];
+        if (request.fence && glDeleteSync) {
+            glDeleteSync(request.fence);
+        }
+        if (request.pbos[0] && glDeleteBuffers) {
+            glDeleteBuffers(_ReadbackRequest::NumBuffers, request.pbos);
+        }
+    }
 }
 
 void
@@ -162,8 +176,7 @@ HdxPickTask::_ConfigureSceneMaterials(bool enableSceneMaterials,
     } else {
         if (!_overrideShader) {
             _overrideShader = HdStShaderCodeSharedPtr(new HdStGLSLFXShader(
-                HioGlslfxSharedPtr(new HioGlslfx(
-                    HdStPackageFallbackSurfaceShader()))));
+                HioGlslfx::GetShared(HdStPackageFallbackSurfaceShader())));
         }
         renderPassState->SetOverrideShader(_overrideShader);
     }
@@ -370,6 +383,55 @@ HdxPickTask::Prepare(HdTaskContext* ctx,
     _pickableRenderPassState->Prepare(renderIndex->GetResourceRegistry());
 }
 
+static void
+_ResolveIdBuffers(
+        int const* primIds,
+        int const* instanceIds,
+        int const* elementIds,
+        int const* edgeIds,
+        int const* pointIds,
+        int const* neyes,
+        float const* depths,
+        HdRenderIndex const *index,
+        TfToken const &pickTarget,
+        TfToken const &resolveMode,
+        GfMatrix4d const &viewMatrix,
+        GfMatrix4d const &projectionMatrix,
+        GfVec2f const &depthRange,
+        GfVec2i const &size,
+        std::vector<GfVec4i> const &pickRegions,
+        HdxPickHitVector *outHits)
+{
+    // HdxPickResult takes a subrect, which is the region of the id buffer
+    // to search over; by default the whole buffer is used, but the caller
+    // can resolve several sub-regions individually from the same render.
+    std::vector<GfVec4i> subRects = pickRegions;
+    if (subRects.empty()) {
+        subRects.push_back(GfVec4i(0, 0, size[0], size[1]));
+    }
+
+    for (GfVec4i const &subRect : subRects) {
+        HdxPickResult result(
+                primIds, instanceIds, elementIds, edgeIds, pointIds,
+                neyes, depths, index, pickTarget, viewMatrix,
+                projectionMatrix, depthRange, size, subRect);
+
+        // Resolve!
+        if (resolveMode == HdxPickTokens->resolveNearestToCenter) {
+            result.ResolveNearestToCenter(outHits);
+        } else if (resolveMode == HdxPickTokens->resolveNearestToCamera) {
+            result.ResolveNearestToCamera(outHits);
+        } else if (resolveMode == HdxPickTokens->resolveUnique) {
+            result.ResolveUnique(outHits);
+        } else if (resolveMode == HdxPickTokens->resolveAll) {
+            result.ResolveAll(outHits);
+        } else {
+            TF_CODING_ERROR("Unrecognized interesection mode '%s'",
+                resolveMode.GetText());
+        }
+    }
+}
+
 void
 HdxPickTask::Execute(HdTaskContext* ctx)
 {
@@ -467,6 +529,31 @@ HdxPickTask::Execute(HdTaskContext* ctx)
 
     GLF_POST_PENDING_GL_ERRORS();
 
+    // For un-projection, get the current depth range.
+    GLfloat p[2];
+    glGetFloatv(GL_DEPTH_RANGE, &p[0]);
+    GfVec2f depthRange(p[0], p[1]);
+
+    if (_contextParams.asyncReadback && _contextParams.completionCallback &&
+        glFenceSync) {
+        // Queue the readback through the PBO ring; the GPU copies overlap
+        // whatever work is issued next and the hits are delivered to the
+        // completion callback once the copies have finished, typically on
+        // the next Execute.
+        _SubmitReadbackRequest(drawTarget, depthRange);
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+        drawTarget->Unbind();
+
+        // Resolve any earlier request whose copies have completed.
+        for (int i = 0; i < _ReadbackRingSize; ++i) {
+            _ResolveReadbackRequest(&_readbackRing[i], /*blocking=*/false);
+        }
+
+        GLF_POST_PENDING_GL_ERRORS();
+        return;
+    }
+
     // Capture the result buffers.
     size_t len = size[0] * size[1];
     std::unique_ptr<int[]> primIds(new int[len]);
@@ -511,38 +598,126 @@ HdxPickTask::Execute(HdTaskContext* ctx)
 
     GLF_POST_PENDING_GL_ERRORS();
 
-    // For un-projection, get the current depth range.
-    GLfloat p[2];
-    glGetFloatv(GL_DEPTH_RANGE, &p[0]);
-    GfVec2f depthRange(p[0], p[1]);
-
-    // HdxPickResult takes a subrect, which is the region of the id buffer to
-    // search over; this task always uses the whole buffer...
-    GfVec4i subRect(0, 0, size[0], size[1]);
-
-    HdxPickResult result(
+    _ResolveIdBuffers(
             primIds.get(), instanceIds.get(), elementIds.get(),
             edgeIds.get(), pointIds.get(), neyes.get(), depths.get(),
-            _index, _contextParams.pickTarget, _contextParams.viewMatrix,
-            _contextParams.projectionMatrix, depthRange, size, subRect);
-
-    // Resolve!
-    if (_contextParams.resolveMode ==
-            HdxPickTokens->resolveNearestToCenter) {
-        result.ResolveNearestToCenter(_contextParams.outHits);
-    } else if (_contextParams.resolveMode ==
-            HdxPickTokens->resolveNearestToCamera) {
-        result.ResolveNearestToCamera(_contextParams.outHits);
-    } else if (_contextParams.resolveMode ==
-            HdxPickTokens->resolveUnique) {
-        result.ResolveUnique(_contextParams.outHits);
-    } else if (_contextParams.resolveMode ==
-            HdxPickTokens->resolveAll) {
-        result.ResolveAll(_contextParams.outHits);
-    } else {
-        TF_CODING_ERROR("Unrecognized interesection mode '%s'",
-            _contextParams.resolveMode.GetText());
+            _index, _contextParams.pickTarget, _contextParams.resolveMode,
+            _contextParams.viewMatrix, _contextParams.projectionMatrix,
+            depthRange, size, _contextParams.pickRegions,
+            _contextParams.outHits);
+}
+
+void
+HdxPickTask::_SubmitReadbackRequest(GlfDrawTargetRefPtr const &drawTarget,
+                                    GfVec2f const &depthRange)
+{
+    _ReadbackRequest &request = _readbackRing[_readbackRingIndex];
+    _readbackRingIndex = (_readbackRingIndex + 1) % _ReadbackRingSize;
+
+    // If this ring entry still holds an unresolved readback (i.e. the ring
+    // has wrapped around), resolve it before reusing its buffers.
+    _ResolveReadbackRequest(&request, /*blocking=*/true);
+
+    GfVec2i size(drawTarget->GetSize());
+    size_t len = size[0] * size[1];
+
+    if (request.pbos[0] == 0) {
+        glGenBuffers(_ReadbackRequest::NumBuffers, request.pbos);
     }
+
+    // All attachments pack to 4 bytes per pixel (RGBA8 ids, float depth).
+    static const char *attachmentNames[_ReadbackRequest::NumBuffers] = {
+        "primId", "instanceId", "elementId", "edgeId", "pointId", "neye",
+        "depth"
+    };
+
+    for (int i = 0; i < _ReadbackRequest::NumBuffers; ++i) {
+        bool const isDepth = (i == _ReadbackRequest::NumBuffers - 1);
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, request.pbos[i]);
+        if (request.bufferLength != len) {
+            glBufferData(GL_PIXEL_PACK_BUFFER, len * 4, NULL,
+                         GL_STREAM_READ);
+        }
+
+        glBindTexture(GL_TEXTURE_2D,
+            drawTarget->GetAttachments().at(
+                attachmentNames[i])->GetGlTextureName());
+        if (isDepth) {
+            glGetTexImage(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, GL_FLOAT, 0);
+        } else {
+            glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        }
+    }
+    request.bufferLength = len;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    request.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    request.inFlight = true;
+    request.size = size;
+    request.depthRange = depthRange;
+    request.pickTarget = _contextParams.pickTarget;
+    request.resolveMode = _contextParams.resolveMode;
+    request.viewMatrix = _contextParams.viewMatrix;
+    request.projectionMatrix = _contextParams.projectionMatrix;
+    request.regions = _contextParams.pickRegions;
+    request.callback = _contextParams.completionCallback;
+}
+
+bool
+HdxPickTask::_ResolveReadbackRequest(_ReadbackRequest *request, bool blocking)
+{
+    if (!request->inFlight) {
+        return true;
+    }
+
+    GLenum status = glClientWaitSync(
+        request->fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+        blocking ? HDX_PICK_READBACK_TIMEOUT_NS : 0);
+    if (!blocking &&
+        (status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED)) {
+        // Still in flight; try again later.
+        return false;
+    }
+    glDeleteSync(request->fence);
+    request->fence = 0;
+    request->inFlight = false;
+
+    void *mapped[_ReadbackRequest::NumBuffers] = { NULL };
+    bool mapFailed = false;
+    for (int i = 0; i < _ReadbackRequest::NumBuffers; ++i) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, request->pbos[i]);
+        mapped[i] = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+        mapFailed |= (mapped[i] == NULL);
+    }
+
+    HdxPickHitVector hits;
+    if (TF_VERIFY(!mapFailed, "Failed to map pick readback buffers")) {
+        _ResolveIdBuffers(
+                (int const*)mapped[0], (int const*)mapped[1],
+                (int const*)mapped[2], (int const*)mapped[3],
+                (int const*)mapped[4], (int const*)mapped[5],
+                (float const*)mapped[6],
+                _index, request->pickTarget, request->resolveMode,
+                request->viewMatrix, request->projectionMatrix,
+                request->depthRange, request->size, request->regions,
+                &hits);
+    }
+
+    for (int i = 0; i < _ReadbackRequest::NumBuffers; ++i) {
+        if (mapped[i]) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, request->pbos[i]);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    if (request->callback) {
+        request->callback(hits);
+    }
+
+    return true;
 }
 
 const TfTokenVector &
@@ -960,7 +1135,9 @@ operator==(HdxPickTaskContextParams const& lhs,
         && lhs.clipPlanes == rhs.clipPlanes
         && lhsDepthMask == rhsDepthMask
         && lhs.collection == rhs.collection
-        && lhs.outHits == rhs.outHits;
+        && lhs.outHits == rhs.outHits
+        && lhs.pickRegions == rhs.pickRegions
+        && lhs.asyncReadback == rhs.asyncReadback;
 }
 
 bool
@@ -989,10 +1166,14 @@ operator<<(std::ostream& out, HdxPickTaskContextParams const& p)
         << p.projectionMatrix << " "
         << depthMask << " "
         << p.collection << " "
-        << p.outHits;
+        << p.outHits << " "
+        << p.asyncReadback;
     for (auto const& a : p.clipPlanes) {
         out << a << " ";
     }
+    for (auto const& r : p.pickRegions) {
+        out << r << " ";
+    }
     return out;
 }
 
@@ -121,6 +121,8 @@ typedef std::vector<HdxPickHit> HdxPickHitVector;
 struct HdxPickTaskContextParams
 {
     typedef std::function<void(void)> DepthMaskCallback;
+    typedef std::function<void(HdxPickHitVector const &)>
+        PickCompletionCallback;
 
     HdxPickTaskContextParams()
         : resolution(128, 128)
@@ -134,6 +136,9 @@ struct HdxPickTaskContextParams
         , depthMaskCallback(nullptr)
         , collection()
         , outHits(nullptr)
+        , pickRegions()
+        , asyncReadback(false)
+        , completionCallback(nullptr)
     {}
 
     GfVec2i resolution;
@@ -147,6 +152,20 @@ struct HdxPickTaskContextParams
     DepthMaskCallback depthMaskCallback;
     HdRprimCollection collection;
     HdxPickHitVector *outHits;
+
+    /// Optional sub-regions (x, y, width, height) of the id buffer to
+    /// resolve individually from a single picking render. When non-empty,
+    /// each region is resolved separately and the hits of all regions are
+    /// accumulated, which lets one render answer several pick queries.
+    std::vector<GfVec4i> pickRegions;
+
+    /// When true, the id buffers are read back asynchronously through a
+    /// ring of pixel buffer objects instead of a blocking read, and hits
+    /// are delivered to \p completionCallback -- typically during the next
+    /// Execute, i.e. with a frame of latency -- rather than to \p outHits.
+    /// Requires \p completionCallback to be set.
+    bool asyncReadback;
+    PickCompletionCallback completionCallback;
 };
 
 /// \class HdxPickTask
@@ -214,6 +233,45 @@ private:
 
     bool _UseOcclusionPass() const;
 
+    // A pending asynchronous id-buffer readback: one pixel buffer object
+    // per id/depth attachment, a fence marking when the GPU copies have
+    // completed, and the parameters needed to resolve the buffers into
+    // hits once they have.
+    struct _ReadbackRequest {
+        static const int NumBuffers = 7;
+
+        _ReadbackRequest()
+            : fence(0)
+            , bufferLength(0)
+            , inFlight(false)
+        {
+            for (int i = 0; i < NumBuffers; ++i) { pbos[i] = 0; }
+        }
+
+        GLuint pbos[NumBuffers];
+        GLsync fence;
+        size_t bufferLength;
+        bool inFlight;
+        GfVec2i size;
+        GfVec2f depthRange;
+        TfToken pickTarget;
+        TfToken resolveMode;
+        GfMatrix4d viewMatrix;
+        GfMatrix4d projectionMatrix;
+        std::vector<GfVec4i> regions;
+        HdxPickTaskContextParams::PickCompletionCallback callback;
+    };
+
+    // Issues the id buffer readback into the next ring entry, waiting for
+    // that entry's previous readback first if it is still in flight.
+    void _SubmitReadbackRequest(GlfDrawTargetRefPtr const &drawTarget,
+                                GfVec2f const &depthRange);
+
+    // Resolves \p request into hits and invokes its completion callback
+    // if the GPU copies have finished (or unconditionally, if \p blocking
+    // is true). Returns false if the request is still in flight.
+    bool _ResolveReadbackRequest(_ReadbackRequest *request, bool blocking);
+
     // Create a shared render pass each for pickables and unpickables
     HdRenderPassSharedPtr _pickableRenderPass;
     HdRenderPassSharedPtr _occluderRenderPass;
@@ -230,6 +288,12 @@ private:
     // be shared, we clone the attachments on each request.
     GlfDrawTargetRefPtr _drawTarget;
 
+    // Ring of asynchronous readback requests. Two entries give the
+    // intended one-frame latency between issuing a pick and resolving it.
+    static const int _ReadbackRingSize = 2;
+    _ReadbackRequest _readbackRing[_ReadbackRingSize];
+    int _readbackRingIndex;
+
     HdxPickTask() = delete;
     HdxPickTask(const HdxPickTask &) = delete;
     HdxPickTask &operator =(const HdxPickTask &) = delete;
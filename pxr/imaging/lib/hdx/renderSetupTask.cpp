@@ -40,6 +40,10 @@
 
 #include "pxr/imaging/cameraUtil/conformWindow.h"
 
+#include "pxr/base/gf/math.h"
+
+#include <algorithm>
+#include <cmath>
 #include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -52,6 +56,7 @@ HdxRenderSetupTask::HdxRenderSetupTask(HdSceneDelegate* delegate, SdfPath const&
     , _colorRenderPassShader()
     , _idRenderPassShader()
     , _viewport()
+    , _resolutionScale(1.0f)
     , _cameraId()
     , _aovBindings()
 {
@@ -182,6 +187,7 @@ HdxRenderSetupTask::SyncParams(HdSceneDelegate* delegate,
         !TfDebug::IsEnabled(HDX_DISABLE_ALPHA_TO_COVERAGE));
 
     _viewport = params.viewport;
+    _resolutionScale = GfClamp(params.resolutionScale, 0.1f, 1.0f);
     _cameraId = params.camera;
     _aovBindings = params.aovBindings;
 
@@ -221,8 +227,33 @@ HdxRenderSetupTask::PrepareCamera(HdRenderIndex* renderIndex)
         // sync render pass state
         HdRenderPassStateSharedPtr &renderPassState =
                 _GetRenderPassState(renderIndex);
-        renderPassState->SetCameraAndViewport(camera, _viewport);
+        renderPassState->SetCameraAndViewport(camera, GetScaledViewport());
+    }
+}
+
+float
+HdxRenderSetupTask::GetResolutionScale() const
+{
+    // When AOVs are bound the render resolution is fixed by the buffer
+    // dimensions, so the scale only applies to the GL framebuffer path.
+    if (!_aovBindings.empty()) {
+        return 1.0f;
     }
+    return _resolutionScale;
+}
+
+GfVec4d
+HdxRenderSetupTask::GetScaledViewport() const
+{
+    GfVec4d viewport = _viewport;
+
+    float const scale = GetResolutionScale();
+    if (scale < 1.0f) {
+        viewport[2] = std::max(1.0, std::floor(viewport[2] * scale));
+        viewport[3] = std::max(1.0, std::floor(viewport[3] * scale));
+    }
+
+    return viewport;
 }
 
 void
@@ -234,8 +265,7 @@ HdxRenderSetupTask::_CreateOverrideShader()
         std::lock_guard<std::mutex> lock(shaderCreateLock);
         if (!_overrideShader) {
             _overrideShader = HdStShaderCodeSharedPtr(new HdStGLSLFXShader(
-                HioGlslfxSharedPtr(new HioGlslfx(
-                    HdStPackageFallbackSurfaceShader()))));
+                HioGlslfx::GetShared(HdStPackageFallbackSurfaceShader())));
         }
     }
 }
@@ -293,7 +323,8 @@ std::ostream& operator<<(std::ostream& out, const HdxRenderTaskParams& pv)
         << pv.enableAlphaToCoverage << ""
         << pv.cullStyle << " "
         << pv.camera << " "
-        << pv.viewport << " ";
+        << pv.viewport << " "
+        << pv.resolutionScale << " ";
         for (auto const& a : pv.aovBindings) {
             out << a << " ";
         }
@@ -337,7 +368,8 @@ bool operator==(const HdxRenderTaskParams& lhs, const HdxRenderTaskParams& rhs)
            lhs.cullStyle               == rhs.cullStyle               &&
            lhs.aovBindings             == rhs.aovBindings             &&
            lhs.camera                  == rhs.camera                  &&
-           lhs.viewport                == rhs.viewport;
+           lhs.viewport                == rhs.viewport                &&
+           lhs.resolutionScale         == rhs.resolutionScale;
 }
 
 bool operator!=(const HdxRenderTaskParams& lhs, const HdxRenderTaskParams& rhs) 
@@ -82,6 +82,18 @@ public:
         return _renderPassState;
     }
 
+    /// The viewport from the last-synced params, before resolution scaling.
+    GfVec4d const &GetViewport() const { return _viewport; }
+
+    /// The fraction of the viewport resolution rendered at; 1.0 when
+    /// resolution scaling is inactive (including whenever AOVs are bound).
+    HDX_API
+    float GetResolutionScale() const;
+
+    /// The viewport rect actually rendered into, after resolution scaling.
+    HDX_API
+    GfVec4d GetScaledViewport() const;
+
     /// Sync the render pass resources
     HDX_API
     virtual void Sync(HdSceneDelegate* delegate,
@@ -102,6 +114,7 @@ private:
     HdStRenderPassShaderSharedPtr _colorRenderPassShader;
     HdStRenderPassShaderSharedPtr _idRenderPassShader;
     GfVec4d _viewport;
+    float _resolutionScale;
     SdfPath _cameraId;
     HdRenderPassAovBindingVector _aovBindings;
 
@@ -164,6 +177,7 @@ struct HdxRenderTaskParams
         , aovBindings()
         , camera()
         , viewport(0.0)
+        , resolutionScale(1.0f)
         {}
 
     // XXX: Several of the params below should move to global application state.
@@ -225,6 +239,14 @@ struct HdxRenderTaskParams
     // RasterState index objects
     SdfPath camera;
     GfVec4d viewport;
+
+    // Fraction of the viewport resolution to render at, in (0, 1].  When
+    // less than 1, interaction frames are rendered into a scaled sub-rect
+    // of the viewport and HdxRenderTask upscales the result to the full
+    // viewport; set it back to 1 to refine to full resolution.
+    // XXX: As a transitional API, this only applies when aovBindings is
+    // empty and the renderer writes to the GL framebuffer.
+    float resolutionScale;
 };
 
 // VtValue requirements
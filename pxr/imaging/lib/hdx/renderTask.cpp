@@ -21,11 +21,15 @@
 // KIND, either express or implied. See the Apache License for the specific
 // language governing permissions and limitations under the Apache License.
 //
+#include "pxr/imaging/glf/glew.h"
+
 #include "pxr/imaging/hdx/renderTask.h"
 #include "pxr/imaging/hdx/renderSetupTask.h"
 #include "pxr/imaging/hdx/tokens.h"
 #include "pxr/imaging/hdx/debugCodes.h"
 
+#include "pxr/imaging/glf/diagnostic.h"
+
 #include "pxr/imaging/hd/perfLog.h"
 #include "pxr/imaging/hd/renderDelegate.h"
 #include "pxr/imaging/hd/renderIndex.h"
@@ -46,11 +50,21 @@ HdxRenderTask::HdxRenderTask(HdSceneDelegate* delegate, SdfPath const& id)
     , _pass()
     , _renderTags()
     , _setupTask()
+    , _upscaleFramebuffer(0)
+    , _upscaleColorBuffer(0)
+    , _upscaleSize(0)
 {
 }
 
 HdxRenderTask::~HdxRenderTask()
 {
+    if (_upscaleFramebuffer != 0) {
+        glDeleteFramebuffers(1, &_upscaleFramebuffer);
+    }
+
+    if (_upscaleColorBuffer != 0) {
+        glDeleteRenderbuffers(1, &_upscaleColorBuffer);
+    }
 }
 
 bool
@@ -164,9 +178,81 @@ HdxRenderTask::Execute(HdTaskContext* ctx)
         renderPassState->Bind();
         _pass->Execute(renderPassState, GetRenderTags());
         renderPassState->Unbind();
+
+        // If the internal setup task framed the camera at reduced
+        // resolution, resolve the scaled region up to the full viewport.
+        // In the external setup task configuration, the application owns
+        // the resolve.
+        if (_setupTask && _setupTask->GetResolutionScale() < 1.0f) {
+            _UpscaleToViewport();
+        }
     }
 }
 
+void
+HdxRenderTask::_UpscaleToViewport()
+{
+    GfVec4d const &viewport = _setupTask->GetViewport();
+    GfVec4d const scaledViewport = _setupTask->GetScaledViewport();
+
+    GLint const x = GLint(viewport[0]);
+    GLint const y = GLint(viewport[1]);
+    GLint const width = GLint(viewport[2]);
+    GLint const height = GLint(viewport[3]);
+    GLint const scaledWidth = GLint(scaledViewport[2]);
+    GLint const scaledHeight = GLint(scaledViewport[3]);
+
+    if (width <= 0 || height <= 0 ||
+        (scaledWidth >= width && scaledHeight >= height)) {
+        return;
+    }
+
+    GLint restoreReadFB, restoreDrawFB;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &restoreReadFB);
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &restoreDrawFB);
+
+    // (Re)create the intermediate color buffer at the scaled size.
+    if (_upscaleFramebuffer == 0) {
+        glGenFramebuffers(1, &_upscaleFramebuffer);
+        glGenRenderbuffers(1, &_upscaleColorBuffer);
+    }
+    GfVec2i const size(scaledWidth, scaledHeight);
+    if (size != _upscaleSize) {
+        glBindRenderbuffer(GL_RENDERBUFFER, _upscaleColorBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA16F,
+                              size[0], size[1]);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, _upscaleFramebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                                  GL_RENDERBUFFER, _upscaleColorBuffer);
+        _upscaleSize = size;
+    }
+
+    // Copy the scaled region aside first; blitting between overlapping
+    // regions of the same framebuffer is undefined.
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, restoreDrawFB);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, _upscaleFramebuffer);
+    glBlitFramebuffer(x, y, x + scaledWidth, y + scaledHeight,
+                      0, 0, scaledWidth, scaledHeight,
+                      GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+    // Stretch it back over the full viewport with a bilinear filter.
+    // Note that only color is resolved; depth is left at the scaled
+    // region, which is fine for interaction frames that are replaced by
+    // a full-resolution render once the camera settles.
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, _upscaleFramebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, restoreDrawFB);
+    glBlitFramebuffer(0, 0, scaledWidth, scaledHeight,
+                      x, y, x + width, y + height,
+                      GL_COLOR_BUFFER_BIT, GL_LINEAR);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, restoreReadFB);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, restoreDrawFB);
+
+    GLF_POST_PENDING_GL_ERRORS();
+}
+
 const TfTokenVector &
 HdxRenderTask::GetRenderTags() const
 {
@@ -30,6 +30,9 @@
 #include "pxr/imaging/hdx/progressiveTask.h"
 #include "pxr/imaging/hdx/renderSetupTask.h"  // for short-term compatibility.
 #include "pxr/imaging/hdSt/renderPassState.h"
+#include "pxr/imaging/garch/gl.h"
+
+#include "pxr/base/gf/vec2i.h"
 
 #include <boost/shared_ptr.hpp>
 
@@ -103,6 +106,16 @@ private:
     // Optional internal render setup task, for params unpacking.
     HdxRenderSetupTaskSharedPtr _setupTask;
 
+    // Intermediate framebuffer used by _UpscaleToViewport; allocated lazily
+    // at the scaled viewport size.
+    GLuint _upscaleFramebuffer;
+    GLuint _upscaleColorBuffer;
+    GfVec2i _upscaleSize;
+
+    // When the setup task renders at reduced resolution, stretches the
+    // scaled region of the bound framebuffer over the full viewport.
+    void _UpscaleToViewport();
+
     // Setup additional state that HdStRenderPassState requires.
     // XXX: This should be moved to hdSt!
     void _SetHdStRenderPassState(HdTaskContext *ctx,
@@ -230,12 +230,18 @@ int _EncodeSelOffset(size_t offset, bool isSelected)
 }
 
 // This function takes care of encoding subprim selection offsets.
+// \p nextSubprimOffset is a block-local link, stored off by one so that 0
+// still means "no link"; it is rebased to an absolute buffer position when
+// the block is spliced into the selection buffer.
+// If \p relocRanges is non-null, the range of entries whose offset field
+// needs such rebasing is appended to it.
 // Returns true if output was filled, and false if not.
 static
-bool _FillSubprimSelOffsets(int type, 
+bool _FillSubprimSelOffsets(int type,
                          std::vector<VtIntArray> const &vecIndices,
                          int nextSubprimOffset,
-                         std::vector<int>* output)
+                         std::vector<int>* output,
+                         std::vector<std::pair<size_t, size_t>>* relocRanges)
 {
     // Nothing to do if we have no indices arrays.
     // Also worth noting that the HdxSelection::Add<Subprim> methods ensure
@@ -266,6 +272,10 @@ bool _FillSubprimSelOffsets(int type,
 
     // For those subprim indices that are selected, set their LSB to 1.
     size_t selOffsetsStart = startOutputSize + SUBPRIM_SELOFFSETS_HEADER_SIZE;
+    if (relocRanges) {
+        relocRanges->push_back(
+            std::make_pair(selOffsetsStart, output->size()));
+    }
     for (VtIntArray const& indices : vecIndices ) {
         for (int const& id : indices ) {
             if (id >= 0) {
@@ -288,10 +298,14 @@ bool _FillPointSelOffsets(int type,
                           std::vector<int>* output)
 {
     size_t startOutputSize = output->size();
+    // The offset field of a point's selOffset encodes its color index
+    // rather than a buffer position, so the entries must not be rebased
+    // when the block is spliced; no relocation range is registered.
     bool hasSelectedPoints = _FillSubprimSelOffsets(type,
                                                     pointIndices,
                                                     /*nextSubprimOffset=*/0,
-                                                    output);
+                                                    output,
+                                                    /*relocRanges=*/nullptr);
     if (hasSelectedPoints) {
         // Update the 'offset' part of selOffset for each of the selected
         // points to represent the point color index for customized point
@@ -311,10 +325,171 @@ bool _FillPointSelOffsets(int type,
             }
         }
     }
- 
+
     return hasSelectedPoints;
 }
 
+// Returns whether two prim selection states are equivalent. The indices
+// arrays are copy-on-write, so the comparison short circuits cheaply when
+// the client reuses the same arrays across selections.
+static
+bool _IsSameSelectionState(HdSelection::PrimSelectionState const &a,
+                           HdSelection::PrimSelectionState const &b)
+{
+    return a.fullySelected == b.fullySelected
+        && a.instanceIndices == b.instanceIndices
+        && a.elementIndices == b.elementIndices
+        && a.edgeIndices == b.edgeIndices
+        && a.pointIndices == b.pointIndices
+        && a.pointColorIndices == b.pointColorIndices;
+}
+
+/* static */
+void
+HdxSelectionTracker::_EncodePrimSelection(
+    HdSelection::PrimSelectionState const &state,
+    _PrimSelOffsets *encoded)
+{
+    bool const SELECT_ALL = 1;
+    bool const SELECT_NONE = 0;
+
+    enum SubPrimType {
+        ELEMENT = 0,
+        EDGE    = 1,
+        POINT   = 2
+    };
+
+    std::vector<int> *output = &encoded->block;
+
+    bool hasSelectedSubprimitives = false;
+    // netSubprimOffset tracks the block-local link (off by one) to the start
+    // of each subprim's range-offsets encoding; it allows us to handle
+    // selection of multiple subprims per prim (XXX: not per instance of a
+    // prim) by backpointing from elements to edges to points.
+    // We process subprims in the reverse order to allow for this.
+    int netSubprimOffset = 0;
+
+    //------------------------------------------------------------------- //
+    // Subprimitives: Points
+    // ------------------------------------------------------------------ //
+    size_t curOffset = output->size();
+
+    if (_FillPointSelOffsets(POINT,
+                             state.pointIndices,
+                             state.pointColorIndices,
+                             output)) {
+        hasSelectedSubprimitives = true;
+        netSubprimOffset = curOffset + 1;
+        _DebugPrintArray("points", *output);
+    }
+
+    //------------------------------------------------------------------- //
+    // Subprimitives: Edges
+    // ------------------------------------------------------------------ //
+    curOffset = output->size();
+    if (_FillSubprimSelOffsets(EDGE, state.edgeIndices,
+                               netSubprimOffset, output,
+                               &encoded->relocRanges)) {
+        hasSelectedSubprimitives = true;
+        netSubprimOffset = curOffset + 1;
+        _DebugPrintArray("edges", *output);
+    }
+
+    // ------------------------------------------------------------------ //
+    // Subprimitives: Elements (coarse/authored face(s) for meshes,
+    //                          individual curve(s) for basis curves)
+    // ------------------------------------------------------------------ //
+    curOffset = output->size();
+    if (_FillSubprimSelOffsets(ELEMENT, state.elementIndices,
+                               netSubprimOffset, output,
+                               &encoded->relocRanges)) {
+        hasSelectedSubprimitives = true;
+        netSubprimOffset = curOffset + 1;
+        _DebugPrintArray("elements", *output);
+    }
+
+    // ------------------------------------------------------------------ //
+    // Instances
+    // ------------------------------------------------------------------ //
+    if (!hasSelectedSubprimitives) {
+        netSubprimOffset = 0;
+    }
+    // By initializing the prevLevelOffset to netSubprimOffset, we remove
+    // a special case (i.e., checking for level 0) in the code below.
+    int prevLevelOffset = netSubprimOffset;
+
+    std::vector<VtIntArray> const& instanceIndices = state.instanceIndices;
+    if (instanceIndices.size()) {
+        // Different instances can have different number of levels.
+        int numLevels = std::numeric_limits<int>::max();
+        size_t numInst= instanceIndices.size();
+        if (numInst == 0) {
+            numLevels = 0;
+        } else {
+            for (size_t instNum = 0; instNum < numInst; ++instNum) {
+                size_t levelsForInst = instanceIndices.at(instNum).size();
+                numLevels = std::min(numLevels,
+                                     static_cast<int>(levelsForInst));
+            }
+        }
+
+        TF_DEBUG(HDX_SELECTION_SETUP).Msg("NumLevels: %d\n", numLevels);
+        if (numLevels == 0) {
+            // Link the prim's own entry to the subprim sections.
+            encoded->rootSelOffset = netSubprimOffset;
+        }
+        for (int level = 0; level < numLevels; ++level) {
+            // Find the required size of the instance vectors.
+            int levelMin = std::numeric_limits<int>::max();
+            int levelMax = std::numeric_limits<int>::lowest();
+            for (VtIntArray const &instVec : instanceIndices) {
+                _DebugPrintArray("\tinstVec", instVec, false);
+                int instId = instVec[level];
+                levelMin = std::min(levelMin, instId);
+                levelMax = std::max(levelMax, instId);
+            }
+
+            TF_DEBUG(HDX_SELECTION_SETUP).Msg(
+                "level-%d: min(%d) max(%d)\n",
+                level, levelMin, levelMax);
+
+            int objLevelSize = levelMax - levelMin +2+1;
+            int levelOffset = output->size();
+            output->insert(output->end(), objLevelSize,
+                           _EncodeSelOffset(prevLevelOffset, SELECT_NONE));
+            (*output)[levelOffset + 0] = levelMin;
+            (*output)[levelOffset + 1] = levelMax + 1;
+            encoded->relocRanges.push_back(
+                std::make_pair(levelOffset + 2, output->size()));
+            for (VtIntArray const& instVec : instanceIndices) {
+                int instId = instVec[level] - levelMin+2;
+                (*output)[levelOffset+instId] =
+                    _EncodeSelOffset(prevLevelOffset, SELECT_ALL);
+            }
+
+            if (level == numLevels-1) {
+                // Link the prim's own entry to the outermost instancing
+                // level. If at all any subprims of the prim (XXX: it should
+                // be instance, ideally) are selected, the instance's
+                // selOffset would encode that.
+                encoded->rootSelOffset = levelOffset + 1;
+            }
+
+            if (ARCH_UNLIKELY(TfDebug::IsEnabled(HDX_SELECTION_SETUP))){
+                std::stringstream name;
+                name << "level[" << level << "]";
+                _DebugPrintArray(name.str(), *output);
+            }
+            prevLevelOffset = levelOffset + 1;
+        }
+    } else {
+        // No instances. Link the prim's own entry to the subprim sections.
+        encoded->rootSelOffset = netSubprimOffset;
+    }
+
+    encoded->fullySelected = state.fullySelected;
+}
+
 /*virtual*/
 bool
 HdxSelectionTracker::_GetSelectionOffsets(HdSelection::HighlightMode const& mode,
@@ -416,169 +591,107 @@ HdxSelectionTracker::_GetSelectionOffsets(HdSelection::HighlightMode const& mode
 
     // Start with individual arrays. Splice arrays once finished.
     int const PRIM_SELOFFSETS_HEADER_SIZE = 2;
-    bool const SELECT_ALL = 1;
     bool const SELECT_NONE = 0;
 
-    enum SubPrimType {
-        ELEMENT = 0,
-        EDGE    = 1,
-        POINT   = 2
-    };
-
     _DebugPrintArray("ids", ids);
-    // For initialization, use offset=0 in the seloffset encoding.
-    // This will be updated as need be once we process subprims and instances.
-    output->insert(output->end(), PRIM_SELOFFSETS_HEADER_SIZE + (max - min + 1),
-                   _EncodeSelOffset(/*offset=*/0, SELECT_NONE));
-    (*output)[0] = min;
-    (*output)[1] = max+1;
-
-    _DebugPrintArray("prims", *output);
-
-    for (size_t primIndex = 0; primIndex < ids.size(); primIndex++) {
-        // TODO: store ID and path in "ids" vector
-        int id = ids[primIndex];
-        if (id == INVALID) continue;
-
-        SdfPath const& objPath = selectedPrims[primIndex];
-        TF_DEBUG(HDX_SELECTION_SETUP).Msg("Processing: %d - %s\n",
-                id, objPath.GetText());
-
-        HdSelection::PrimSelectionState const* primSelState =
-            _selection->GetPrimSelectionState(mode, objPath);
-        if (!primSelState) continue;
-
-        bool hasSelectedSubprimitives = false;
-        // netSubprimOffset tracks the "net" offset to the start of each
-        // subprim's range-offsets encoding; it allows us to handle selection of
-        // multiple subprims per prim (XXX: not per instance of a prim) by
-        // backpointing from elements to edges to points.
-        // We process subprims in the reverse order to allow for this.
-
-        size_t netSubprimOffset = 0;
-         //------------------------------------------------------------------- //
-        // Subprimitives: Points
-        // ------------------------------------------------------------------ //
-        size_t curOffset = output->size();
-
-        if (_FillPointSelOffsets(POINT,
-                                 primSelState->pointIndices,
-                                 primSelState->pointColorIndices,
-                                 output)) {
-            hasSelectedSubprimitives = true;
-            netSubprimOffset = curOffset + modeOffset;
-            _DebugPrintArray("points", *output);
-        }
 
-        //------------------------------------------------------------------- //
-        // Subprimitives: Edges
-        // ------------------------------------------------------------------ //
-        curOffset = output->size();
-        if (_FillSubprimSelOffsets(EDGE,  primSelState->edgeIndices,
-                                netSubprimOffset, output)) {
-            hasSelectedSubprimitives = true;
-            netSubprimOffset = curOffset + modeOffset;
-            _DebugPrintArray("edges", *output);
+    // Each selected prim's subprim and instance sections are encoded as an
+    // independent block with block-local links. Blocks depend only on the
+    // prim's own selection state, so they can be encoded in parallel, and
+    // prims whose state is unchanged since the previous selection reuse
+    // their cached block instead of re-encoding.
+    _PrimSelOffsetsMap &cache = _encodedSelectionCache[mode];
+
+    std::vector<HdSelection::PrimSelectionState const*> states(numPrims,
+                                                               nullptr);
+    std::vector<_PrimSelOffsets*> encoded(numPrims, nullptr);
+    std::vector<_PrimSelOffsets> freshlyEncoded(numPrims);
+
+    for (size_t primIndex = 0; primIndex < numPrims; primIndex++) {
+        if (ids[primIndex] == INVALID) continue;
+
+        states[primIndex] =
+            _selection->GetPrimSelectionState(mode, selectedPrims[primIndex]);
+        if (!states[primIndex]) continue;
+
+        _PrimSelOffsetsMap::iterator it = cache.find(selectedPrims[primIndex]);
+        if (it != cache.end() &&
+            _IsSameSelectionState(it->second.state, *states[primIndex])) {
+            encoded[primIndex] = &it->second;
         }
+    }
 
-        // ------------------------------------------------------------------ //
-        // Subprimitives: Elements (coarse/authored face(s) for meshes,
-        //                          individual curve(s) for basis curves)
-        // ------------------------------------------------------------------ //
-        curOffset = output->size();
-        if (_FillSubprimSelOffsets(ELEMENT,  primSelState->elementIndices,
-                                netSubprimOffset, output)) {
-            hasSelectedSubprimitives = true;
-            netSubprimOffset = curOffset + modeOffset;
-            _DebugPrintArray("elements", *output);
+    WorkParallelForN(numPrims,
+        [&states, &encoded, &freshlyEncoded](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            if (!states[i] || encoded[i]) continue;
+            freshlyEncoded[i].state = *states[i];
+            _EncodePrimSelection(*states[i], &freshlyEncoded[i]);
+            encoded[i] = &freshlyEncoded[i];
         }
+    });
 
-        // ------------------------------------------------------------------ //
-        // Instances
-        // ------------------------------------------------------------------ //
-        if (!hasSelectedSubprimitives) {
-            netSubprimOffset = 0;
-        } 
-        // By initializing the prevLevelOffset to netSubprimOffset, we remove
-        // a special case (i.e., checking for level 0) in the code below.
-        int prevLevelOffset = (int)netSubprimOffset;
-
-        std::vector<VtIntArray> const& instanceIndices =
-            primSelState->instanceIndices;
-        if (instanceIndices.size()) {
-            // Different instances can have different number of levels.
-            int numLevels = std::numeric_limits<int>::max();
-            size_t numInst= instanceIndices.size();
-            if (numInst == 0) {
-                numLevels = 0;
-            } else {
-                for (size_t instNum = 0; instNum < numInst; ++instNum) {
-                    size_t levelsForInst = instanceIndices.at(instNum).size();
-                    numLevels = std::min(numLevels,
-                                         static_cast<int>(levelsForInst));
-                }
-            }
-
-            TF_DEBUG(HDX_SELECTION_SETUP).Msg("NumLevels: %d\n", numLevels);
-            if (numLevels == 0) {
-                // Encode the subprim offset and whether the prim is
-                // fully selected.
-                (*output)[id-min+2] = _EncodeSelOffset(netSubprimOffset,
-                                                primSelState->fullySelected);
-            }
-            for (int level = 0; level < numLevels; ++level) {
-                // Find the required size of the instance vectors.
-                int levelMin = std::numeric_limits<int>::max();
-                int levelMax = std::numeric_limits<int>::lowest();
-                for (VtIntArray const &instVec : instanceIndices) {
-                    _DebugPrintArray("\tinstVec", instVec, false);
-                    int instId = instVec[level];
-                    levelMin = std::min(levelMin, instId);
-                    levelMax = std::max(levelMax, instId);
-                }
+    // Lay the blocks out after the per-prim offsets section.
+    std::vector<size_t> blockStart(numPrims, 0);
+    size_t outputSize = PRIM_SELOFFSETS_HEADER_SIZE + (max - min + 1);
+    for (size_t primIndex = 0; primIndex < numPrims; primIndex++) {
+        if (!encoded[primIndex]) continue;
+        blockStart[primIndex] = outputSize;
+        outputSize += encoded[primIndex]->block.size();
+    }
 
-                TF_DEBUG(HDX_SELECTION_SETUP).Msg(
-                    "level-%d: min(%d) max(%d)\n",
-                    level, levelMin, levelMax);
-
-                int objLevelSize = levelMax - levelMin +2+1;
-                int levelOffset = output->size();
-                output->insert(output->end(), objLevelSize,
-                               _EncodeSelOffset(prevLevelOffset, SELECT_NONE));
-                (*output)[levelOffset + 0] = levelMin;
-                (*output)[levelOffset + 1] = levelMax + 1;
-                for (VtIntArray const& instVec : instanceIndices) {
-                    int instId = instVec[level] - levelMin+2;
-                    (*output)[levelOffset+instId] =
-                        _EncodeSelOffset(prevLevelOffset, SELECT_ALL);
-                }
+    // For initialization, use offset=0 in the seloffset encoding.
+    // Prims with an encoded block overwrite their entry when the block is
+    // spliced into place below.
+    output->clear();
+    output->resize(outputSize, _EncodeSelOffset(/*offset=*/0, SELECT_NONE));
+    (*output)[0] = min;
+    (*output)[1] = max+1;
 
-                if (level == numLevels-1) {
-                    // Encode the instance offset and whether the prim is
-                    // fully selected. If at all any subprims of the prim
-                    // (XXX: it should be instance, ideally) are selected, the
-                    // instance's selOffset would encode that.
-                    (*output)[id-min+2] =
-                        _EncodeSelOffset(levelOffset + modeOffset,
-                                         primSelState->fullySelected);
-                }
+    _DebugPrintArray("prims", *output);
 
-                if (ARCH_UNLIKELY(TfDebug::IsEnabled(HDX_SELECTION_SETUP))){
-                    std::stringstream name;
-                    name << "level[" << level << "]";
-                    _DebugPrintArray(name.str(), *output);
+    // Splice the blocks into place, rebasing their block-local links to net
+    // indices within the selection buffer (which include the mode offset).
+    WorkParallelForN(numPrims,
+        [output, &ids, &encoded, &blockStart, min, modeOffset](
+            size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            if (!encoded[i]) continue;
+
+            _PrimSelOffsets const &e = *encoded[i];
+            size_t const base = blockStart[i];
+            std::copy(e.block.begin(), e.block.end(),
+                      output->begin() + base);
+            for (std::pair<size_t, size_t> const &range : e.relocRanges) {
+                for (size_t j = range.first; j < range.second; j++) {
+                    int const v = (*output)[base + j];
+                    int const link = v >> 1;
+                    if (link != 0) {
+                        (*output)[base + j] = _EncodeSelOffset(
+                            (link - 1) + base + modeOffset, v & 0x1);
+                    }
                 }
-                // The offset is the net index within the selection buffer, and
-                // thus, needs to include the mode offset.
-                prevLevelOffset = levelOffset + modeOffset;
             }
-        } else {
-            // No instances. Encode the subprim offset and whether the prim is
-            // fully selected.
-            (*output)[id-min+2] = _EncodeSelOffset(netSubprimOffset,
-                                                   primSelState->fullySelected);
+
+            // Encode the offset to the prim's subprim/instance sections and
+            // whether the prim is fully selected.
+            size_t const rootOffset = e.rootSelOffset
+                ? (e.rootSelOffset - 1) + base + modeOffset
+                : 0;
+            (*output)[ids[i]-min+2] =
+                _EncodeSelOffset(rootOffset, e.fullySelected);
         }
+    });
+
+    // Refresh the cache: keep the blocks used by this selection and drop
+    // the ones for prims that are no longer selected.
+    _PrimSelOffsetsMap newCache;
+    newCache.reserve(numPrims);
+    for (size_t primIndex = 0; primIndex < numPrims; primIndex++) {
+        if (!encoded[primIndex]) continue;
+        newCache[selectedPrims[primIndex]] = std::move(*encoded[primIndex]);
     }
+    cache.swap(newCache);
 
     _DebugPrintArray("final output", *output);
 
@@ -31,6 +31,7 @@
 #include "pxr/base/vt/array.h"
 #include "pxr/usd/sdf/path.h"
 #include <boost/smart_ptr.hpp>
+#include <unordered_map>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -157,8 +158,41 @@ protected:
                                       std::vector<int>* offsets) const;
 
 private:
+    // A single prim's selection state, encoded with offsets relative to
+    // the start of the prim's block in the selection buffer. Cached across
+    // selection changes, so that updating the selection only re-encodes
+    // prims whose state actually changed.
+    struct _PrimSelOffsets {
+        _PrimSelOffsets() : rootSelOffset(0), fullySelected(false) {}
+
+        std::vector<int> block;
+        // Ranges of entries in \p block whose offset field is a block-local
+        // link (stored off by one, so 0 still means "no link") and must be
+        // rebased when the block is spliced into the selection buffer.
+        std::vector<std::pair<size_t, size_t>> relocRanges;
+        // Block-local link for the prim's own selection offset entry,
+        // off by one; 0 if the prim has no subprim/instance sections.
+        int rootSelOffset;
+        bool fullySelected;
+        // The state this block was encoded from, kept for cache validation.
+        // Copies are cheap since the indices arrays are copy-on-write.
+        HdSelection::PrimSelectionState state;
+    };
+
+    typedef std::unordered_map<SdfPath, _PrimSelOffsets, SdfPath::Hash>
+        _PrimSelOffsetsMap;
+
+    // Encodes \p state as a block-local _PrimSelOffsets record.
+    static void _EncodePrimSelection(
+        HdSelection::PrimSelectionState const &state,
+        _PrimSelOffsets *encoded);
+
     int _version;
     HdSelectionSharedPtr _selection;
+
+    // Per-mode cache of encoded per-prim selection state.
+    mutable _PrimSelOffsetsMap
+        _encodedSelectionCache[HdSelection::HighlightModeCount];
 };
 
 
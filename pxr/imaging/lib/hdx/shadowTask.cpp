@@ -58,6 +58,12 @@ HdxShadowTask::HdxShadowTask(HdSceneDelegate* delegate, SdfPath const& id)
     , _renderPassStates()
     , _params()
     , _renderTags()
+    , _shadowMapStates()
+    , _rprimStateVersion(0)
+    , _rprimIndexVersion(0)
+    , _renderTagVersion(0)
+    , _shadowMapSize(0)
+    , _shadowMapNumLayers(0)
 {
 }
 
@@ -100,7 +106,9 @@ HdxShadowTask::Sync(HdSceneDelegate* delegate,
         }
     }
 
-    if ((*dirtyBits) & HdChangeTracker::DirtyRenderTags) {
+    const bool dirtyRenderTags =
+        (*dirtyBits) & HdChangeTracker::DirtyRenderTags;
+    if (dirtyRenderTags) {
         // Update render tags from scene delegate
         _renderTags = _GetTaskRenderTags(delegate);
     }
@@ -108,6 +116,7 @@ HdxShadowTask::Sync(HdSceneDelegate* delegate,
     // Iterate through all lights and for those that have shadows enabled
     // and ensure we have enough passes to render the shadows.
     size_t passCount = 0;
+    std::vector<size_t> collectionHashes;
     for (size_t lightId = 0; lightId < glfLights.size(); lightId++) {
         const HdStLight* light = static_cast<const HdStLight*>(
             renderIndex.GetSprim(HdPrimTypeTokens->simpleLight,
@@ -142,6 +151,7 @@ HdxShadowTask::Sync(HdSceneDelegate* delegate,
                 (&renderIndex, col);
             _passes.push_back(p);
         }
+        collectionHashes.push_back(hash_value(col));
         passCount++;
     }
     
@@ -197,16 +207,58 @@ HdxShadowTask::Sync(HdSceneDelegate* delegate,
 
     // But if it is not then we still have to make sure we don't
     // buffer overrun here.
-    const size_t shadowCount = 
+    const size_t shadowCount =
         std::min(shadows->GetNumLayers(), _passes.size());
+
+    // Decide which shadow maps need to be re-captured during Execute.
+    // Caster changes are tracked through the change tracker's rprim state,
+    // rprim index and render tag versions, which only move when rendered
+    // geometry changes (not when e.g. only the viewing camera moves); light
+    // changes are tracked by comparing each layer's shadow matrices.
+    HdChangeTracker const &tracker = renderIndex.GetChangeTracker();
+    const unsigned rprimStateVersion = tracker.GetRprimStateVersion();
+    const unsigned rprimIndexVersion = tracker.GetRprimIndexVersion();
+    const unsigned renderTagVersion  = tracker.GetRenderTagVersion();
+    const GfVec2i shadowMapSize      = shadows->GetSize();
+    const size_t shadowMapNumLayers  = shadows->GetNumLayers();
+    const bool invalidateAllMaps =
+        _rprimStateVersion  != rprimStateVersion ||
+        _rprimIndexVersion  != rprimIndexVersion ||
+        _renderTagVersion   != renderTagVersion  ||
+        _shadowMapSize      != shadowMapSize     ||
+        _shadowMapNumLayers != shadowMapNumLayers ||
+        dirtyParams || dirtyRenderTags;
+    _rprimStateVersion  = rprimStateVersion;
+    _rprimIndexVersion  = rprimIndexVersion;
+    _renderTagVersion   = renderTagVersion;
+    _shadowMapSize      = shadowMapSize;
+    _shadowMapNumLayers = shadowMapNumLayers;
+
+    _shadowMapStates.resize(shadowCount);
+
     for(size_t passId = 0; passId < shadowCount; passId++) {
+        const GfMatrix4d viewMatrix = shadows->GetViewMatrix(passId);
+        const GfMatrix4d projectionMatrix =
+            shadows->GetProjectionMatrix(passId);
+
         // Move the camera to the correct position to take the shadow map
-        _renderPassStates[passId]->SetCameraFramingState( 
-            shadows->GetViewMatrix(passId), 
-            shadows->GetProjectionMatrix(passId),
-            GfVec4d(0,0,shadows->GetSize()[0],shadows->GetSize()[1]),
+        _renderPassStates[passId]->SetCameraFramingState(
+            viewMatrix,
+            projectionMatrix,
+            GfVec4d(0,0,shadowMapSize[0],shadowMapSize[1]),
             HdRenderPassState::ClipPlanesVector());
 
+        _ShadowMapState &state = _shadowMapStates[passId];
+        if (invalidateAllMaps ||
+            state.viewMatrix != viewMatrix ||
+            state.projectionMatrix != projectionMatrix ||
+            state.collectionHash != collectionHashes[passId]) {
+            state.viewMatrix = viewMatrix;
+            state.projectionMatrix = projectionMatrix;
+            state.collectionHash = collectionHashes[passId];
+            state.needsCapture = true;
+        }
+
         _passes[passId]->Sync();
     }
 
@@ -259,6 +311,12 @@ HdxShadowTask::Execute(HdTaskContext* ctx)
     const size_t shadowCount =
         std::min(shadows->GetNumLayers(), _passes.size());
     for(size_t shadowId = 0; shadowId < shadowCount; shadowId++) {
+        // The map's contents are still valid from a previous capture when
+        // neither its light nor any caster changed since then (see Sync).
+        if (shadowId < _shadowMapStates.size() &&
+            !_shadowMapStates[shadowId].needsCapture) {
+            continue;
+        }
 
         // Bind the framebuffer that will store shadowId shadow map
         shadows->BeginCapture(shadowId, true);
@@ -270,6 +328,10 @@ HdxShadowTask::Execute(HdTaskContext* ctx)
 
         // Unbind the buffer and move on to the next shadow map
         shadows->EndCapture(shadowId);
+
+        if (shadowId < _shadowMapStates.size()) {
+            _shadowMapStates[shadowId].needsCapture = false;
+        }
     }
 
     // restore GL states to default
@@ -292,8 +354,7 @@ HdxShadowTask::_CreateOverrideShader()
         std::lock_guard<std::mutex> lock(shaderCreateLock);
         if (!_overrideShader) {
             _overrideShader = HdStShaderCodeSharedPtr(new HdStGLSLFXShader(
-                HioGlslfxSharedPtr(new HioGlslfx(
-                    HdStPackageFallbackSurfaceShader()))));
+                HioGlslfx::GetShared(HdStPackageFallbackSurfaceShader())));
         }
     }
 }
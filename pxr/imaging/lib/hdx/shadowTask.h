@@ -31,7 +31,9 @@
 #include "pxr/imaging/hd/rprimCollection.h"
 #include "pxr/imaging/hd/task.h"
 
+#include "pxr/base/gf/matrix4d.h"
 #include "pxr/base/gf/vec2f.h"
+#include "pxr/base/gf/vec2i.h"
 #include "pxr/base/gf/vec4f.h"
 #include "pxr/base/gf/vec4d.h"
 #include "pxr/base/tf/declarePtrs.h"
@@ -142,6 +144,33 @@ private:
     HdxShadowTaskParams _params;
     TfTokenVector       _renderTags;
 
+    // Cached per-shadow-map state, used to skip re-capturing maps whose
+    // light and casters have not changed since the last capture.
+    struct _ShadowMapState {
+        _ShadowMapState()
+            : viewMatrix(1.0)
+            , projectionMatrix(1.0)
+            , collectionHash(0)
+            , needsCapture(true)
+            {}
+
+        GfMatrix4d viewMatrix;
+        GfMatrix4d projectionMatrix;
+        size_t collectionHash;
+        bool needsCapture;
+    };
+    std::vector<_ShadowMapState> _shadowMapStates;
+
+    // Change tracker versions as of the last Sync; a change to any of them
+    // invalidates every shadow map.
+    unsigned _rprimStateVersion;
+    unsigned _rprimIndexVersion;
+    unsigned _renderTagVersion;
+
+    // Shadow array layout at the last Sync; the array reallocates its
+    // texture storage when either changes, discarding all captured maps.
+    GfVec2i  _shadowMapSize;
+    size_t   _shadowMapNumLayers;
 
     HdxShadowTask() = delete;
     HdxShadowTask(const HdxShadowTask &) = delete;
@@ -64,6 +64,7 @@ HdxSimpleLightTask::HdxSimpleLightTask(HdSceneDelegate* delegate, SdfPath const&
     , _sceneAmbient()
     , _shadows()
     , _glfSimpleLights()
+    , _sprimStateVersion(0)
 {
     _shadows = TfCreateRefPtr(new GlfSimpleShadowArray(_defaultShadowRes, 0));
 }
@@ -89,7 +90,8 @@ HdxSimpleLightTask::Sync(HdSceneDelegate* delegate,
 
     HdRenderIndex &renderIndex = delegate->GetRenderIndex();
 
-    if ((*dirtyBits) & HdChangeTracker::DirtyParams) {
+    const bool dirtyParams = (*dirtyBits) & HdChangeTracker::DirtyParams;
+    if (dirtyParams) {
         HdxSimpleLightTaskParams params;
         if (!_GetTaskParams(delegate, &params)) {
             return;
@@ -121,6 +123,17 @@ HdxSimpleLightTask::Sync(HdSceneDelegate* delegate,
     // Place lighting context in task context
     (*ctx)[HdxTokens->lightingContext] = lightingContext;
 
+    // If no sprim changed since the last sync, neither the lights nor the
+    // camera were edited, so the light state packed into the lighting
+    // context is still valid and the rebuild below can be skipped.
+    const unsigned sprimStateVersion =
+        renderIndex.GetChangeTracker().GetSprimStateVersion();
+    if (!dirtyParams && _sprimStateVersion == sprimStateVersion) {
+        *dirtyBits = HdChangeTracker::Clean;
+        return;
+    }
+    _sprimStateVersion = sprimStateVersion;
+
     GfMatrix4d const& viewMatrix = camera->GetViewMatrix();
     GfMatrix4d const& viewInverseMatrix = camera->GetViewInverseMatrix();
     GfMatrix4d const& projectionMatrix = camera->GetProjectionMatrix();
@@ -98,6 +98,11 @@ private:
     GlfSimpleShadowArrayRefPtr _shadows;
     GlfSimpleLightVector _glfSimpleLights;
 
+    // Sprim state version of the change tracker at the last light rebuild;
+    // while it is unchanged no light (or camera) was edited, so the packed
+    // light state in the lighting context is still valid.
+    unsigned _sprimStateVersion;
+
     size_t _AppendLightsOfType(HdRenderIndex &renderIndex,
                                std::vector<TfToken> const &lightTypes,
                                SdfPathVector const &lightIncludePaths,
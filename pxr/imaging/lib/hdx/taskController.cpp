@@ -599,6 +599,18 @@ HdxTaskController::_GetAovPath(TfToken const& aov) const
     return GetControllerId().AppendChild(TfToken(str));
 }
 
+HdAovDescriptor const&
+HdxTaskController::_GetDefaultAovDescriptor(TfToken const& aov)
+{
+    _AovDescriptorCache::iterator it = _defaultAovDescriptors.find(aov);
+    if (it == _defaultAovDescriptors.end()) {
+        it = _defaultAovDescriptors.insert(std::make_pair(aov,
+            GetRenderIndex()->GetRenderDelegate()->
+                GetDefaultAovDescriptor(aov))).first;
+    }
+    return it->second;
+}
+
 void
 HdxTaskController::SetRenderOutputs(TfTokenVector const& outputs)
 {
@@ -641,13 +653,6 @@ HdxTaskController::SetRenderOutputs(TfTokenVector const& outputs)
         }
     }
 
-    // Delete the old renderbuffers.
-    for (size_t i = 0; i < _aovBufferIds.size(); ++i) {
-        GetRenderIndex()->RemoveBprim(HdPrimTypeTokens->renderBuffer,
-            _aovBufferIds[i]);
-    }
-    _aovBufferIds.clear();
-
     // Get the viewport dimensions (for renderbuffer allocation)
     HdxRenderTaskParams renderParams =
         _delegate.GetParameter<HdxRenderTaskParams>(renderTaskId,
@@ -659,14 +664,34 @@ HdxTaskController::SetRenderOutputs(TfTokenVector const& outputs)
     HdAovDescriptorList outputDescs;
     outputDescs.resize(localOutputs.size());
     for (size_t i = 0; i < localOutputs.size(); ++i) {
-        outputDescs[i] = GetRenderIndex()->GetRenderDelegate()->
-            GetDefaultAovDescriptor(localOutputs[i]);
+        outputDescs[i] = _GetDefaultAovDescriptor(localOutputs[i]);
     }
 
-    // Add the new renderbuffers. _GetAovPath returns ids of the form
-    // {controller_id}/aov_{name}.
+    // Reconfigure the renderbuffer set incrementally. _GetAovPath returns
+    // ids of the form {controller_id}/aov_{name}.
+    SdfPathVector newBufferIds;
+    newBufferIds.reserve(localOutputs.size());
     for (size_t i = 0; i < localOutputs.size(); ++i) {
-        SdfPath aovId = _GetAovPath(localOutputs[i]);
+        newBufferIds.push_back(_GetAovPath(localOutputs[i]));
+    }
+
+    // Delete the renderbuffers the new output list no longer uses; buffers
+    // for retained outputs keep their storage and settings.
+    for (SdfPath const& aovId : _aovBufferIds) {
+        if (std::find(newBufferIds.begin(), newBufferIds.end(), aovId) ==
+                newBufferIds.end()) {
+            GetRenderIndex()->RemoveBprim(HdPrimTypeTokens->renderBuffer,
+                aovId);
+        }
+    }
+
+    // Add renderbuffers for the newly requested outputs.
+    for (size_t i = 0; i < localOutputs.size(); ++i) {
+        SdfPath const& aovId = newBufferIds[i];
+        if (std::find(_aovBufferIds.begin(), _aovBufferIds.end(), aovId) !=
+                _aovBufferIds.end()) {
+            continue;
+        }
         GetRenderIndex()->InsertBprim(HdPrimTypeTokens->renderBuffer,
             &_delegate, aovId);
         HdRenderBufferDescriptor desc;
@@ -676,23 +701,38 @@ HdxTaskController::SetRenderOutputs(TfTokenVector const& outputs)
         _delegate.SetParameter(aovId, _tokens->renderBufferDescriptor, desc);
         GetRenderIndex()->GetChangeTracker().MarkBprimDirty(aovId,
             HdRenderBuffer::DirtyDescription);
-        _aovBufferIds.push_back(aovId);
     }
+    _aovBufferIds.swap(newBufferIds);
 
-    // Create the aov binding list and set it on the render task.
+    // Create the aov binding list and set it on the render task.  Bindings
+    // for retained outputs are carried over, so any settings applied
+    // through SetRenderOutputSettings survive reconfiguration.
     HdRenderPassAovBindingVector aovBindings;
     aovBindings.resize(localOutputs.size());
     for (size_t i = 0; i < localOutputs.size(); ++i) {
-        aovBindings[i].aovName = localOutputs[i];
-        aovBindings[i].clearValue = outputDescs[i].clearValue;
-        aovBindings[i].renderBufferId = _GetAovPath(localOutputs[i]);
-        aovBindings[i].aovSettings = outputDescs[i].aovSettings;
+        bool found = false;
+        for (HdRenderPassAovBinding const& oldBinding :
+                renderParams.aovBindings) {
+            if (oldBinding.renderBufferId == _aovBufferIds[i]) {
+                aovBindings[i] = oldBinding;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            aovBindings[i].aovName = localOutputs[i];
+            aovBindings[i].clearValue = outputDescs[i].clearValue;
+            aovBindings[i].renderBufferId = _aovBufferIds[i];
+            aovBindings[i].aovSettings = outputDescs[i].aovSettings;
+        }
     }
 
-    renderParams.aovBindings = aovBindings;
-    _delegate.SetParameter(renderTaskId, HdTokens->params,renderParams);
-    GetRenderIndex()->GetChangeTracker().MarkTaskDirty(
-        renderTaskId, HdChangeTracker::DirtyParams);
+    if (aovBindings != renderParams.aovBindings) {
+        renderParams.aovBindings = aovBindings;
+        _delegate.SetParameter(renderTaskId, HdTokens->params, renderParams);
+        GetRenderIndex()->GetChangeTracker().MarkTaskDirty(
+            renderTaskId, HdChangeTracker::DirtyParams);
+    }
 
     // For AOV visualization, if only one output was specified, send it
     // to the viewer; otherwise, disable colorization.
@@ -234,6 +234,11 @@ private:
     SdfPath _GetRenderTaskPath(TfToken const& materialTag) const;
     SdfPath _GetAovPath(TfToken const& aov) const;
 
+    // Returns the render delegate's default descriptor for \p aov.  The
+    // result is cached so that reconfiguring render outputs doesn't
+    // re-query the delegate for outputs it has seen before.
+    HdAovDescriptor const& _GetDefaultAovDescriptor(TfToken const& aov);
+
     // A private scene delegate member variable backs the tasks this
     // controller generates. To keep _Delegate simple, the containing class
     // is responsible for marking things dirty.
@@ -310,6 +315,11 @@ private:
     SdfPathVector _aovBufferIds;
     TfTokenVector _aovOutputs;
     TfToken _viewportAov;
+
+    // Cached default AOV descriptors, see _GetDefaultAovDescriptor.
+    typedef TfHashMap<TfToken, HdAovDescriptor, TfToken::HashFunctor>
+        _AovDescriptorCache;
+    _AovDescriptorCache _defaultAovDescriptors;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
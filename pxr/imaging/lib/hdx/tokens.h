@@ -37,6 +37,7 @@ PXR_NAMESPACE_OPEN_SCOPE
     (hdxOitDataBuffer)          \
     (hdxOitDepthBuffer)         \
     (hdxOitIndexBuffer)         \
+    (hdxOitTileBuffer)          \
     (hdxSelectionBuffer)        \
     (imagerVersion)             \
     (lightingContext)           \
@@ -45,16 +46,20 @@ PXR_NAMESPACE_OPEN_SCOPE
     (oitData)                   \
     (oitDepth)                  \
     (oitIndices)                \
+    (oitTiles)                  \
     (oitUniforms)               \
     (oitCounterBufferBar)       \
     (oitDataBufferBar)          \
     (oitDepthBufferBar)         \
     (oitIndexBufferBar)         \
+    (oitTileBufferBar)          \
     (oitUniformBar)             \
     (oitRenderPassState)        \
     (oitHeight)                 \
     (oitWidth)                  \
     (oitSamples)                \
+    (oitBufferSize)             \
+    (oitTileSize)               \
     (renderPassState)           \
     (renderIndexVersion)        \
     (selection)                 \
@@ -25,6 +25,7 @@
 #include "pxr/imaging/hio/glslfxConfig.h"
 #include "pxr/imaging/hio/debugCodes.h"
 
+#include "pxr/base/arch/fileSystem.h"
 #include "pxr/base/plug/plugin.h"
 #include "pxr/base/plug/registry.h"
 #include "pxr/base/tf/diagnostic.h"
@@ -36,10 +37,12 @@
 #include "pxr/base/tf/pathUtils.h"
 
 #include <boost/functional/hash.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/unordered_map.hpp>
 #include <iostream>
 #include <istream>
 #include <fstream>
+#include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -222,6 +225,53 @@ HioGlslfx::HioGlslfx(istream &is) :
     }
 }
 
+namespace {
+
+// Process-wide cache of parsed glslfx files, keyed by file path. An entry
+// is reused as long as the file's modification time is unchanged.
+struct _CachedGlslfx {
+    _CachedGlslfx() : mtime(0) { }
+
+    double mtime;
+    HioGlslfxSharedPtr glslfx;
+};
+
+typedef std::map<std::string, _CachedGlslfx> _GlslfxCache;
+
+static std::mutex _cacheMutex;
+static TfStaticData<_GlslfxCache> _glslfxCache;
+
+} // anonymous namespace
+
+/* static */
+HioGlslfxSharedPtr
+HioGlslfx::GetShared(std::string const &filePath)
+{
+    double mtime = 0;
+    ArchGetModificationTime(filePath.c_str(), &mtime);
+
+    {
+        std::lock_guard<std::mutex> lock(_cacheMutex);
+        _GlslfxCache::const_iterator it = _glslfxCache->find(filePath);
+        if (it != _glslfxCache->end() && it->second.mtime == mtime) {
+            return it->second.glslfx;
+        }
+    }
+
+    // Parse outside the lock; concurrent misses on the same file may parse
+    // it more than once, with the last writer winning, which is benign.
+    HioGlslfxSharedPtr glslfx = boost::make_shared<HioGlslfx>(filePath);
+
+    {
+        std::lock_guard<std::mutex> lock(_cacheMutex);
+        _CachedGlslfx &entry = (*_glslfxCache)[filePath];
+        entry.mtime = mtime;
+        entry.glslfx = glslfx;
+    }
+
+    return glslfx;
+}
+
 bool
 HioGlslfx::IsValid(std::string *reason) const
 {
@@ -34,6 +34,7 @@
 #include "pxr/base/tf/staticTokens.h"
 
 #include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include <string>
 #include <vector>
@@ -47,6 +48,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DECLARE_PUBLIC_TOKENS(HioGlslfxTokens, HIO_API, HIO_GLSLFX_TOKENS);
 
+typedef boost::shared_ptr<class HioGlslfx> HioGlslfxSharedPtr;
+
 /// \class HioGlslfx
 ///
 /// A class representing the config and shader source of a glslfx file.
@@ -137,6 +140,14 @@ public:
     HIO_API
     HioGlslfx(std::istream &is);
 
+    /// Returns a glslfx object for \p filePath from a process-wide cache,
+    /// creating and parsing it if necessary. The cache is keyed by the file
+    /// path and the file's modification time, so clients referencing the
+    /// same unchanged file (e.g. materials sharing a preview surface) share
+    /// a single parsed instance, while an edited file is re-parsed.
+    HIO_API
+    static HioGlslfxSharedPtr GetShared(std::string const &filePath);
+
     /// Return the parameters specified in the configuration
     HIO_API
     HioGlslfxConfig::Parameters GetParameters() const;
@@ -29,7 +29,10 @@
 #include "pxr/imaging/hdEmbree/renderParam.h"
 #include "pxr/imaging/hdEmbree/renderPass.h"
 #include "pxr/imaging/hd/extComputationUtils.h"
+#include "pxr/imaging/hd/instanceRegistry.h"
 #include "pxr/imaging/hd/meshUtil.h"
+#include "pxr/imaging/hd/renderIndex.h"
+#include "pxr/imaging/hd/resourceRegistry.h"
 #include "pxr/imaging/hd/smoothNormals.h"
 #include "pxr/imaging/pxOsd/tokens.h"
 #include "pxr/base/gf/matrix4f.h"
@@ -705,14 +708,30 @@ HdEmbreeMesh::_PopulateRtMesh(HdSceneDelegate* sceneDelegate,
     //    form of the topology that helps calculate smooth normals quickly.
     // 2. If the points are dirty, update the smooth normal buffer itself.
     if (_smoothNormals && !_adjacencyValid) {
-        _adjacency.BuildAdjacencyTable(&_topology);
+        // Look up the adjacency table in hd's shared instance registry,
+        // keyed by topology hash, so that meshes with identical topology
+        // (e.g. instanced vegetation) share one table instead of each
+        // building its own.
+        HdResourceRegistrySharedPtr const &resourceRegistry =
+            sceneDelegate->GetRenderIndex().GetResourceRegistry();
+        HdInstance<HdTopology::ID, Hd_VertexAdjacencySharedPtr>
+            adjacencyInstance;
+        std::unique_lock<std::mutex> regLock =
+            resourceRegistry->RegisterVertexAdjacency(
+                _topology.ComputeHash(), &adjacencyInstance);
+        if (adjacencyInstance.IsFirstInstance()) {
+            Hd_VertexAdjacencySharedPtr adjacency(new Hd_VertexAdjacency());
+            adjacency->BuildAdjacencyTable(&_topology);
+            adjacencyInstance.SetValue(adjacency);
+        }
+        _adjacency = adjacencyInstance.GetValue();
         _adjacencyValid = true;
         // If we rebuilt the adjacency table, force a rebuild of normals.
         _normalsValid = false;
     }
     if (_smoothNormals && !_normalsValid) {
         _computedNormals = Hd_SmoothNormals::ComputeSmoothNormals(
-            &_adjacency, _points.size(), _points.cdata());
+            _adjacency.get(), _points.size(), _points.cdata());
         _normalsValid = true;
 
         // Create a sampler for the "normals" primvar. If there are authored
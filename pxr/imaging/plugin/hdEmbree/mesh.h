@@ -40,6 +40,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 class HdEmbreePrototypeContext;
 class HdEmbreeInstanceContext;
 
+typedef boost::shared_ptr<class Hd_VertexAdjacency> Hd_VertexAdjacencySharedPtr;
+
 /// \class HdEmbreeMesh
 ///
 /// An HdEmbree representation of a subdivision surface or poly-mesh object.
@@ -221,11 +223,12 @@ private:
     VtVec3fArray _computedNormals;
 
     // Derived scene data. Hd_VertexAdjacency is an acceleration datastructure
-    // for computing per-vertex smooth normals. _adjacencyValid indicates
-    // whether the datastructure has been rebuilt with the latest topology,
-    // and _normalsValid indicates whether _computedNormals has been
-    // recomputed with the latest points data.
-    Hd_VertexAdjacency _adjacency;
+    // for computing per-vertex smooth normals, shared between meshes with
+    // identical topology through the resource registry. _adjacencyValid
+    // indicates whether the datastructure has been (re)fetched for the
+    // latest topology, and _normalsValid indicates whether _computedNormals
+    // has been recomputed with the latest points data.
+    Hd_VertexAdjacencySharedPtr _adjacency;
     bool _adjacencyValid;
     bool _normalsValid;
 
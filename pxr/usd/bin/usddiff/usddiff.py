@@ -145,11 +145,46 @@ def _tryEdit(fileName, tempFileName, usdcatCmd, fileType, flattened):
     
     return _convertTo(tempFileName, fileName, usdcatCmd, flatten=None, fmt=fileType)
 
-def _runDiff(baseline, comparison, flatten, noeffect):
+def _computeDifferingSpecPaths(baseline, comparison):
+    '''Compare two layers natively via spec content hashes, without
+    round-tripping through text conversion. Returns a list of differing
+    spec paths, or None if either file could not be opened as a layer
+    (in which case callers should fall back to the text-based diff).'''
+    from pxr import Sdf
+
+    try:
+        baselineLayer = Sdf.Layer.FindOrOpen(baseline)
+        comparisonLayer = Sdf.Layer.FindOrOpen(comparison)
+    except Exception:
+        return None
+
+    if baselineLayer is None or comparisonLayer is None:
+        return None
+
+    return Sdf.ComputeDifferingSpecPaths(baselineLayer, comparisonLayer)
+
+def _runDiff(baseline, comparison, flatten, noeffect, brief):
     from pxr import Tf
 
     diffResult = 0
 
+    # When we don't intend to edit either file, compare the layers
+    # natively first: matching files short-circuit without any text
+    # conversion, and in brief mode we only need the differing paths.
+    # Flattened comparisons compose the full stage, so they take the
+    # usdcat path below.
+    if not flatten and (noeffect or brief):
+        differingPaths = _computeDifferingSpecPaths(baseline, comparison)
+        if differingPaths is not None:
+            if not differingPaths:
+                return 0
+            if brief:
+                for path in differingPaths:
+                    print path
+                return 1
+            # Differences found and a full diff was requested; fall
+            # through to the text-based diff below.
+
     usdcatCmd, diffCmd = _findDiffTools()
     baselineFileType = _getFileFormat(baseline)
     comparisonFileType = _getFileFormat(comparison)
@@ -332,6 +367,12 @@ def main():
     parser.add_argument('-f', '--flatten', action='store_true',
                         help='Fully compose both layers as Usd Stages and '
                              'flatten into single layers.')
+    parser.add_argument('-b', '--brief', action='store_true',
+                        help='Only print the paths of specs whose content '
+                             'differs, one per line, instead of a full diff. '
+                             'Layers are compared natively via spec content '
+                             'hashes, which is much faster for large binary '
+                             'files. Implies --noeffect.')
 
     results = parser.parse_args()
     diffResult = NO_DIFF_FOUND_EXIT_CODE 
@@ -340,8 +381,9 @@ def main():
         baselineOnly, common, comparisonOnly = _findFiles(results.files)
 
         for (baseline, comparison) in common:
-            if _runDiff(baseline, comparison, 
-                        results.flatten, results.noeffect):
+            if _runDiff(baseline, comparison,
+                        results.flatten, results.noeffect or results.brief,
+                        results.brief):
                 diffResult = DIFF_FOUND_EXIT_CODE
 
         mismatchMsg = 'No corresponding file found for %s, skipping.'
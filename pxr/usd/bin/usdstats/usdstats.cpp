@@ -0,0 +1,444 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+// usdstats - report where composition and value-resolution cost comes from
+// on a stage: per-subtree composition cost, prim index node counts and
+// arc-type histograms, heaviest contributing layers, and instancing
+// effectiveness.
+//
+#include "pxr/pxr.h"
+#include "pxr/base/arch/attributes.h"
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/arch/vsnprintf.h"
+#include "pxr/base/tf/tf.h"
+#include "pxr/base/tf/enum.h"
+#include "pxr/base/tf/stopwatch.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/trace/collector.h"
+#include "pxr/base/trace/reporter.h"
+#include "pxr/usd/pcp/node.h"
+#include "pxr/usd/pcp/primIndex.h"
+#include "pxr/usd/pcp/types.h"
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/usd/stagePopulationMask.h"
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdarg>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+using std::map;
+using std::string;
+using std::vector;
+
+namespace {
+
+string progName;
+
+void VErr(char const *fmt, va_list ap) {
+    fprintf(stderr, "%s: Error - %s\n", progName.c_str(),
+            ArchVStringPrintf(fmt, ap).c_str());
+}
+
+void ErrExit(char const *fmt, ...) ARCH_PRINTF_FUNCTION(1, 2);
+void ErrExit(char const *fmt, ...) {
+    va_list ap; va_start(ap, fmt); VErr(fmt, ap); va_end(ap);
+    exit(1);
+}
+
+void Print(char const *fmt, ...) ARCH_PRINTF_FUNCTION(1, 2);
+void Print(char const *fmt, ...) {
+    va_list ap; va_start(ap, fmt);
+    vprintf(fmt, ap);
+    va_end(ap);
+}
+
+// Per-subtree accumulation of prim index statistics.  Subtrees are keyed
+// by the root prim of the stage's top-level namespace hierarchy (or by the
+// master prim for prims inside masters).
+struct SubtreeStats
+{
+    size_t numPrims = 0;
+    size_t numNodes = 0;
+    map<PcpArcType, size_t> arcCounts;
+};
+
+// Per-layer spec and value statistics.
+struct LayerStats
+{
+    SdfLayerHandle layer;
+    size_t numSpecs = 0;
+    size_t numPrimSpecs = 0;
+    size_t numPropertySpecs = 0;
+    size_t numFields = 0;
+    size_t numTimeSamples = 0;
+    size_t numArrayElements = 0;
+    int64_t assetBytes = -1;
+};
+
+string
+GetArcTypeName(PcpArcType arcType)
+{
+    const string name = TfEnum::GetDisplayName(TfEnum(arcType));
+    return name.empty() ? TfStringPrintf("arc type %d", arcType) : name;
+}
+
+// Accumulates node counts and arc types from the prim's prim index into
+// stats, and returns the number of nodes visited.
+size_t
+AccumulatePrimIndexStats(UsdPrim const &prim, SubtreeStats *stats)
+{
+    PcpPrimIndex const &primIndex = prim.GetPrimIndex();
+    size_t numNodes = 0;
+    for (PcpNodeRef const &node: primIndex.GetNodeRange()) {
+        ++numNodes;
+        ++stats->arcCounts[node.GetArcType()];
+    }
+    ++stats->numPrims;
+    stats->numNodes += numNodes;
+    return numNodes;
+}
+
+void
+ReportCompositionStats(UsdStageRefPtr const &stage, size_t maxSubtrees,
+                       size_t maxPrims)
+{
+    // Walk every composed prim (including inactive, abstract and
+    // unloaded prims, and prims inside masters -- each of these owns a
+    // prim index) and accumulate stats per top-level subtree.
+    map<SdfPath, SubtreeStats> subtreeStats;
+    SubtreeStats totals;
+    vector<std::pair<size_t, SdfPath>> heaviestPrims;
+
+    vector<UsdPrim> roots;
+    for (UsdPrim const &child: stage->GetPseudoRoot().GetAllChildren()) {
+        roots.push_back(child);
+    }
+    for (UsdPrim const &master: stage->GetMasters()) {
+        roots.push_back(master);
+    }
+
+    for (UsdPrim const &root: roots) {
+        SubtreeStats &stats = subtreeStats[root.GetPath()];
+        for (UsdPrim const &prim:
+                 UsdPrimRange(root, UsdPrimAllPrimsPredicate)) {
+            const size_t numNodes = AccumulatePrimIndexStats(prim, &stats);
+            heaviestPrims.emplace_back(numNodes, prim.GetPath());
+        }
+        totals.numPrims += stats.numPrims;
+        totals.numNodes += stats.numNodes;
+        for (auto const &entry: stats.arcCounts) {
+            totals.arcCounts[entry.first] += entry.second;
+        }
+    }
+
+    Print("Composition:\n");
+    Print("  %zu composed prims, %zu prim index nodes (%.2f nodes/prim)\n",
+          totals.numPrims, totals.numNodes,
+          totals.numPrims
+              ? double(totals.numNodes) / double(totals.numPrims) : 0.0);
+
+    Print("  Arc types:\n");
+    for (auto const &entry: totals.arcCounts) {
+        Print("    %-18s %zu\n",
+              GetArcTypeName(entry.first).c_str(), entry.second);
+    }
+
+    // Order subtrees by node count; the node count is the best structural
+    // proxy for composition cost since every node is a site that value
+    // resolution may have to consult.
+    vector<std::pair<size_t, SdfPath>> subtreesByNodes;
+    for (auto const &entry: subtreeStats) {
+        subtreesByNodes.emplace_back(entry.second.numNodes, entry.first);
+    }
+    sort(subtreesByNodes.rbegin(), subtreesByNodes.rend());
+
+    Print("  Heaviest subtrees by prim index nodes:\n");
+    for (size_t i = 0;
+         i < subtreesByNodes.size() && i < maxSubtrees; ++i) {
+        SubtreeStats const &stats = subtreeStats[subtreesByNodes[i].second];
+        Print("    <%s> : %zu nodes over %zu prims\n",
+              subtreesByNodes[i].second.GetText(),
+              stats.numNodes, stats.numPrims);
+    }
+
+    sort(heaviestPrims.rbegin(), heaviestPrims.rend());
+    Print("  Heaviest prim indexes:\n");
+    for (size_t i = 0; i < heaviestPrims.size() && i < maxPrims; ++i) {
+        Print("    <%s> : %zu nodes\n",
+              heaviestPrims[i].second.GetText(), heaviestPrims[i].first);
+    }
+}
+
+// Re-opens the stage once per top-level subtree with a population mask
+// restricted to that subtree, reporting the wall-clock time each takes.
+// This directly attributes composition time, at the cost of recomposing
+// the stage once per subtree.
+void
+ReportSubtreeTimes(UsdStageRefPtr const &stage, size_t maxSubtrees)
+{
+    vector<std::pair<double, SdfPath>> subtreeTimes;
+    for (UsdPrim const &child: stage->GetPseudoRoot().GetAllChildren()) {
+        UsdStagePopulationMask mask;
+        mask.Add(child.GetPath());
+        TfStopwatch sw;
+        sw.Start();
+        UsdStageRefPtr masked =
+            UsdStage::OpenMasked(stage->GetRootLayer(), mask);
+        sw.Stop();
+        if (!masked) {
+            continue;
+        }
+        subtreeTimes.emplace_back(sw.GetSeconds(), child.GetPath());
+    }
+    sort(subtreeTimes.rbegin(), subtreeTimes.rend());
+
+    Print("Per-subtree composition time (masked re-open):\n");
+    for (size_t i = 0; i < subtreeTimes.size() && i < maxSubtrees; ++i) {
+        Print("    <%s> : %.3f ms\n", subtreeTimes[i].second.GetText(),
+              subtreeTimes[i].first * 1e3);
+    }
+}
+
+LayerStats
+GetLayerStats(SdfLayerHandle const &layer)
+{
+    LayerStats stats;
+    stats.layer = layer;
+    layer->Traverse(
+        SdfPath::AbsoluteRootPath(), [&stats, &layer](SdfPath const &path) {
+            ++stats.numSpecs;
+            stats.numPrimSpecs += path.IsPrimPath();
+            stats.numPropertySpecs += path.IsPropertyPath();
+            for (TfToken const &field: layer->ListFields(path)) {
+                ++stats.numFields;
+                if (field == SdfFieldKeys->TimeSamples) {
+                    stats.numTimeSamples +=
+                        layer->ListTimeSamplesForPath(path).size();
+                    continue;
+                }
+                VtValue value;
+                if (layer->HasField(path, field, &value) &&
+                    value.IsArrayValued()) {
+                    stats.numArrayElements += value.GetArraySize();
+                }
+            }
+        });
+    const string realPath = layer->GetRealPath();
+    if (!realPath.empty()) {
+        stats.assetBytes = ArchGetFileLength(realPath.c_str());
+    }
+    return stats;
+}
+
+void
+ReportLayerStats(UsdStageRefPtr const &stage, size_t maxLayers)
+{
+    vector<LayerStats> layerStats;
+    for (SdfLayerHandle const &layer: stage->GetUsedLayers()) {
+        layerStats.push_back(GetLayerStats(layer));
+    }
+    sort(layerStats.begin(), layerStats.end(),
+         [](LayerStats const &a, LayerStats const &b) {
+             return a.numSpecs > b.numSpecs;
+         });
+
+    Print("Heaviest layers by spec count (%zu used layers):\n",
+          layerStats.size());
+    for (size_t i = 0; i < layerStats.size() && i < maxLayers; ++i) {
+        LayerStats const &stats = layerStats[i];
+        Print("  @%s@\n", stats.layer->GetIdentifier().c_str());
+        Print("    %zu specs (%zu prim, %zu property), %zu fields, "
+              "%zu sample times, %zu array elements",
+              stats.numSpecs, stats.numPrimSpecs, stats.numPropertySpecs,
+              stats.numFields, stats.numTimeSamples, stats.numArrayElements);
+        if (stats.assetBytes >= 0) {
+            Print(", %.2f MB on disk",
+                  double(stats.assetBytes) / (1024.0 * 1024.0));
+        }
+        Print("\n");
+    }
+}
+
+void
+ReportInstancingStats(UsdStageRefPtr const &stage)
+{
+    // Count instances per master.  A high instance-to-master ratio means
+    // instancing is pulling its weight; masters with a single instance
+    // are pure overhead.
+    map<SdfPath, size_t> instancesPerMaster;
+    size_t numInstances = 0;
+    for (UsdPrim const &prim:
+             UsdPrimRange::Stage(stage, UsdPrimAllPrimsPredicate)) {
+        if (prim.IsInstance()) {
+            ++numInstances;
+            if (UsdPrim master = prim.GetMaster()) {
+                ++instancesPerMaster[master.GetPath()];
+            }
+        }
+    }
+
+    size_t numMasterPrims = 0;
+    size_t numPrimsSaved = 0;
+    size_t numSingleUseMasters = 0;
+    vector<UsdPrim> masters = stage->GetMasters();
+    for (UsdPrim const &master: masters) {
+        size_t subtreeSize = 0;
+        for (UsdPrim const &prim:
+                 UsdPrimRange(master, UsdPrimAllPrimsPredicate)) {
+            TF_UNUSED(prim);
+            ++subtreeSize;
+        }
+        numMasterPrims += subtreeSize;
+        const size_t numUses = instancesPerMaster[master.GetPath()];
+        if (numUses <= 1) {
+            ++numSingleUseMasters;
+        }
+        if (numUses > 1) {
+            numPrimsSaved += (numUses - 1) * subtreeSize;
+        }
+    }
+
+    Print("Instancing:\n");
+    Print("  %zu instances sharing %zu masters (%zu prims in masters)\n",
+          numInstances, masters.size(), numMasterPrims);
+    if (!masters.empty()) {
+        Print("  %.2f instances/master, ~%zu prims saved by sharing\n",
+              double(numInstances) / double(masters.size()), numPrimsSaved);
+    }
+    if (numSingleUseMasters) {
+        Print("  %zu masters have a single instance (no sharing benefit)\n",
+              numSingleUseMasters);
+    }
+}
+
+} // anon
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+int
+main(int argc, char const *argv[])
+{
+    namespace po = boost::program_options;
+    PXR_NAMESPACE_USING_DIRECTIVE
+
+    progName = TfGetBaseName(argv[0]);
+
+    bool trace = false, subtreeTimes = false;
+    size_t maxSubtrees = 10, maxPrims = 10, maxLayers = 10;
+    string inputFile;
+
+    po::options_description argOpts("Options");
+    argOpts.add_options()
+        ("help,h", "Show help message.")
+        ("trace", po::bool_switch(&trace),
+         "Open the stage under the trace collector and print the "
+         "aggregated time report, attributing open time to USD and "
+         "plugin internals.")
+        ("subtreeTimes", po::bool_switch(&subtreeTimes),
+         "Measure per-subtree composition time by re-opening the stage "
+         "once per top-level subtree with a population mask.  Accurate "
+         "but slow on large stages.")
+        ("maxSubtrees", po::value<size_t>(&maxSubtrees)->
+         default_value(maxSubtrees)->value_name("n"),
+         "Number of subtrees to list in ranked reports.")
+        ("maxPrims", po::value<size_t>(&maxPrims)->
+         default_value(maxPrims)->value_name("n"),
+         "Number of prims to list in ranked reports.")
+        ("maxLayers", po::value<size_t>(&maxLayers)->
+         default_value(maxLayers)->value_name("n"),
+         "Number of layers to list in ranked reports.")
+        ;
+
+    po::options_description inputFileOpt("Input");
+    inputFileOpt.add_options()
+        ("input-file", po::value<string>(&inputFile), "input file");
+
+    po::options_description allOpts;
+    allOpts.add(argOpts).add(inputFileOpt);
+
+    po::variables_map vm;
+    try {
+        po::positional_options_description p;
+        p.add("input-file", 1);
+        po::store(po::command_line_parser(argc, argv).
+                  options(allOpts).positional(p).run(), vm);
+        po::notify(vm);
+    } catch (std::exception const &e) {
+        ErrExit("%s", e.what());
+    }
+
+    if (vm.count("help") || inputFile.empty()) {
+        fprintf(stderr, "Usage: %s [options] <input file>\n", progName.c_str());
+        fprintf(stderr, "%s\n", TfStringify(argOpts).c_str());
+        exit(1);
+    }
+
+    if (trace) {
+        TraceCollector::GetInstance().SetEnabled(true);
+    }
+
+    TfStopwatch openTimer;
+    openTimer.Start();
+    UsdStageRefPtr stage = UsdStage::Open(inputFile);
+    openTimer.Stop();
+
+    if (trace) {
+        TraceCollector::GetInstance().SetEnabled(false);
+    }
+
+    if (!stage) {
+        ErrExit("failed to open stage %s", inputFile.c_str());
+    }
+
+    Print("Stage @%s@ opened in %.3f ms\n\n", inputFile.c_str(),
+          openTimer.GetSeconds() * 1e3);
+
+    ReportCompositionStats(stage, maxSubtrees, maxPrims);
+    Print("\n");
+    if (subtreeTimes) {
+        ReportSubtreeTimes(stage, maxSubtrees);
+        Print("\n");
+    }
+    ReportLayerStats(stage, maxLayers);
+    Print("\n");
+    ReportInstancingStats(stage);
+
+    if (trace) {
+        Print("\nTrace report for UsdStage::Open:\n");
+        TraceReporter::GetGlobalReporter()->Report(std::cout);
+    }
+
+    return 0;
+}
@@ -33,6 +33,7 @@
 
 #include "pxr/base/arch/fileSystem.h"
 #include "pxr/base/arch/systemInfo.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/getenv.h"
 #include "pxr/base/tf/fileUtils.h"
 #include "pxr/base/tf/pathUtils.h"
@@ -41,11 +42,18 @@
 #include "pxr/base/vt/value.h"
 
 #include <tbb/concurrent_hash_map.h>
+#include <tbb/concurrent_unordered_map.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 AR_DEFINE_RESOLVER(ArDefaultResolver, ArResolver);
 
+TF_DEFINE_ENV_SETTING(
+    PXR_AR_DEFAULT_RESOLVER_CACHE_TTL, 0,
+    "Number of seconds a resolved path remains valid in ArDefaultResolver's "
+    "built-in resolve cache before the filesystem is consulted again. "
+    "0 (the default) disables the cache.");
+
 static bool
 _IsFileRelative(const std::string& path) {
     return path.find("./") == 0 || path.find("../") == 0;
@@ -55,13 +63,34 @@ static TfStaticData<std::vector<std::string>> _SearchPath;
 
 struct ArDefaultResolver::_Cache
 {
-    using _PathToResolvedPathMap = 
-        tbb::concurrent_hash_map<std::string, std::string>;
+    // Within a cache scope paths are only ever inserted, never erased,
+    // so we can use a concurrent_unordered_map and get lock-free reads
+    // for paths that have already been resolved.
+    using _PathToResolvedPathMap =
+        tbb::concurrent_unordered_map<std::string, std::string>;
     _PathToResolvedPathMap _pathToResolvedPathMap;
 };
 
+struct ArDefaultResolver::_TimedCache
+{
+    struct _Entry
+    {
+        std::string resolvedPath;
+        std::chrono::steady_clock::time_point expiration;
+    };
+
+    using _PathToEntryMap = tbb::concurrent_hash_map<std::string, _Entry>;
+    _PathToEntryMap _pathToEntryMap;
+};
+
 ArDefaultResolver::ArDefaultResolver()
+    : _cacheTtl(std::chrono::seconds(
+          TfGetEnvSetting(PXR_AR_DEFAULT_RESOLVER_CACHE_TTL)))
 {
+    if (_cacheTtl > std::chrono::steady_clock::duration::zero()) {
+        _timedCache.reset(new _TimedCache);
+    }
+
     std::vector<std::string> searchPath = *_SearchPath;
 
     const std::string envPath = TfGetenv("PXR_AR_DEFAULT_SEARCH_PATH");
@@ -224,17 +253,82 @@ ArDefaultResolver::ResolveWithAssetInfo(
     }
 
     if (_CachePtr currentCache = _GetCurrentCache()) {
-        _Cache::_PathToResolvedPathMap::accessor accessor;
-        if (currentCache->_pathToResolvedPathMap.insert(
-                accessor, std::make_pair(path, std::string()))) {
-            accessor->second = _ResolveNoCache(path);
+        _Cache::_PathToResolvedPathMap& pathMap =
+            currentCache->_pathToResolvedPathMap;
+        auto iter = pathMap.find(path);
+        if (iter != pathMap.end()) {
+            return iter->second;
         }
-        return accessor->second;
+        // Two threads may race to resolve the same path; the first
+        // insert wins, so that every thread bound to this cache scope
+        // sees a consistent resolved path.
+        return pathMap.insert(
+            std::make_pair(path, _ResolveNoCache(path))).first->second;
+    }
+
+    if (_timedCache) {
+        return _ResolveWithTimedCache(path);
     }
 
     return _ResolveNoCache(path);
 }
 
+std::string
+ArDefaultResolver::_ResolveWithTimedCache(const std::string& path)
+{
+    const std::string cacheKey = _GetTimedCacheKey(path);
+    const auto now = std::chrono::steady_clock::now();
+
+    {
+        _TimedCache::_PathToEntryMap::const_accessor accessor;
+        if (_timedCache->_pathToEntryMap.find(accessor, cacheKey) &&
+            now < accessor->second.expiration) {
+            return accessor->second.resolvedPath;
+        }
+    }
+
+    const std::string resolvedPath = _ResolveNoCache(path);
+
+    _TimedCache::_PathToEntryMap::accessor accessor;
+    _timedCache->_pathToEntryMap.insert(accessor, cacheKey);
+    accessor->second.resolvedPath = resolvedPath;
+    accessor->second.expiration = now + _cacheTtl;
+    return resolvedPath;
+}
+
+std::string
+ArDefaultResolver::_GetTimedCacheKey(const std::string& path)
+{
+    // Search paths resolve differently depending on the currently-bound
+    // context, so qualify their cache keys with the search path that
+    // will be examined. Other paths resolve the same way regardless of
+    // context and may be cached under the asset path alone.
+    if (!IsSearchPath(path)) {
+        return path;
+    }
+
+    std::string cacheKey = path;
+    const ArDefaultResolverContext* contexts[2] =
+        {_GetCurrentContext(), &_fallbackContext};
+    for (const ArDefaultResolverContext* ctx : contexts) {
+        if (ctx) {
+            for (const auto& searchPath : ctx->GetSearchPath()) {
+                cacheKey += '\n';
+                cacheKey += searchPath;
+            }
+        }
+    }
+    return cacheKey;
+}
+
+void
+ArDefaultResolver::InvalidateResolveCache()
+{
+    if (_timedCache) {
+        _timedCache->_pathToEntryMap.clear();
+    }
+}
+
 std::string
 ArDefaultResolver::ComputeLocalPath(const std::string& path)
 {
@@ -330,9 +424,10 @@ ArDefaultResolver::CreateDefaultContextForAsset(
                                  std::vector<std::string>(1, assetDir)));
 }
 
-void 
+void
 ArDefaultResolver::RefreshContext(const ArResolverContext& context)
 {
+    InvalidateResolveCache();
 }
 
 ArResolverContext
@@ -34,6 +34,7 @@
 
 #include <tbb/enumerable_thread_specific.h>
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -57,9 +58,19 @@ PXR_NAMESPACE_OPEN_SCOPE
 ///    - The currently-bound ArDefaultResolverContext for the calling thread
 ///    - ArDefaultResolver::SetDefaultSearchPath
 ///    - The environment variable PXR_AR_DEFAULT_SEARCH_PATH. This is
-///      expected to be a list of directories delimited by the platform's 
+///      expected to be a list of directories delimited by the platform's
 ///      standard path separator.
 ///
+/// This resolver stats the filesystem to determine whether an asset exists,
+/// which can be costly on network filesystems. Setting the environment
+/// variable PXR_AR_DEFAULT_RESOLVER_CACHE_TTL to a number of seconds
+/// enables a built-in resolve cache: a resolved path is reused for that
+/// many seconds before the filesystem is consulted again. The cache can
+/// be flushed at any time via InvalidateResolveCache(), and is also
+/// flushed by RefreshContext(). This cache is separate from, and
+/// superseded by, any active ArResolverScopedCache, which never expires
+/// entries. The cache is disabled by default.
+///
 class ArDefaultResolver
     : public ArResolver
 {
@@ -79,6 +90,14 @@ public:
     static void SetDefaultSearchPath(
         const std::vector<std::string>& searchPath);
 
+    /// Remove all entries from the time-bounded resolve cache enabled via
+    /// PXR_AR_DEFAULT_RESOLVER_CACHE_TTL. Call this to force the next
+    /// resolve of each asset path to consult the filesystem, e.g. after
+    /// assets are known to have been added or removed. Does nothing if
+    /// the cache is not enabled.
+    AR_API
+    void InvalidateResolveCache();
+
     // ArResolver overrides
 
     /// Sets the resolver's default context (returned by CreateDefaultContext())
@@ -201,12 +220,19 @@ private:
 
     std::string _ResolveNoCache(const std::string& path);
 
+    std::string _ResolveWithTimedCache(const std::string& path);
+    std::string _GetTimedCacheKey(const std::string& path);
+
 private:
     ArDefaultResolverContext _fallbackContext;
     ArResolverContext _defaultContext;
 
     _PerThreadCache _threadCache;
 
+    struct _TimedCache;
+    std::unique_ptr<_TimedCache> _timedCache;
+    std::chrono::steady_clock::duration _cacheTtl;
+
     using _ContextStack = std::vector<const ArDefaultResolverContext*>;
     using _PerThreadContextStack = 
         tbb::enumerable_thread_specific<_ContextStack>;
@@ -31,6 +31,10 @@
 #include "pxr/usd/ar/packageResolver.h"
 #include "pxr/usd/ar/packageUtils.h"
 #include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/resolverContext.h"
+#include "pxr/usd/ar/resolverContextBinder.h"
+
+#include "pxr/base/work/detachedTask.h"
 
 #include "pxr/base/vt/value.h"
 #include "pxr/base/plug/plugin.h"
@@ -86,6 +90,40 @@ ArResolver::~ArResolver()
 {
 }
 
+void
+ArResolver::ResolveBatch(
+    const std::vector<std::string>& paths,
+    std::vector<std::string>* resolvedPaths)
+{
+    resolvedPaths->resize(paths.size());
+    for (size_t i = 0, n = paths.size(); i != n; ++i) {
+        (*resolvedPaths)[i] = Resolve(paths[i]);
+    }
+}
+
+std::future<std::vector<std::string>>
+ArResolver::ResolveBatchAsync(
+    const std::vector<std::string>& paths)
+{
+    // Context bindings are per-thread, so capture the context bound on
+    // the calling thread and rebind it on the worker thread.
+    const ArResolverContext context = GetCurrentContext();
+
+    auto promise =
+        std::make_shared<std::promise<std::vector<std::string>>>();
+    std::future<std::vector<std::string>> result = promise->get_future();
+
+    WorkRunDetachedTask(
+        [this, context, paths, promise]() {
+            ArResolverContextBinder binder(this, context);
+            std::vector<std::string> resolvedPaths;
+            ResolveBatch(paths, &resolvedPaths);
+            promise->set_value(std::move(resolvedPaths));
+        });
+
+    return result;
+}
+
 // ------------------------------------------------------------
 
 namespace
@@ -28,6 +28,7 @@
 
 #include "pxr/pxr.h"
 #include "pxr/usd/ar/api.h"
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -121,6 +122,28 @@ public:
     AR_API
     virtual std::string Resolve(const std::string& path) = 0;
 
+    /// Resolves all of the files identified by the given \p paths, filling
+    /// \p resolvedPaths such that (*resolvedPaths)[i] holds the result of
+    /// Resolve(paths[i]).
+    ///
+    /// The default implementation resolves each path in turn. Resolvers
+    /// backed by remote services are encouraged to override this to answer
+    /// the entire batch in a single round trip. Clients with a known
+    /// fan-out of asset paths (e.g., the sublayers of a layer) should
+    /// prefer this entry point over issuing per-path calls.
+    AR_API
+    virtual void ResolveBatch(const std::vector<std::string>& paths,
+                              std::vector<std::string>* resolvedPaths);
+
+    /// Resolves \p paths as in ResolveBatch(), but asynchronously. The
+    /// returned future becomes ready once the entire batch has resolved.
+    ///
+    /// The batch is resolved under the context that is bound to this
+    /// resolver at the time of this call.
+    AR_API
+    std::future<std::vector<std::string>>
+    ResolveBatchAsync(const std::vector<std::string>& paths);
+
     /// @}
 
     // --------------------------------------------------------------------- //
@@ -23,6 +23,9 @@
 //
 
 #include "pxr/pxr.h"
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/js/json.h"
+#include "pxr/base/tf/atomicOfstreamWrapper.h"
 #include "pxr/base/tf/instantiateSingleton.h"
 #include "pxr/base/tf/pathUtils.h"
 #include "pxr/base/tf/type.h"
@@ -39,6 +42,9 @@
 
 #include <boost/functional/hash.hpp>
 
+#include <algorithm>
+#include <fstream>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_ENV_SETTING(
@@ -46,6 +52,14 @@ TF_DEFINE_ENV_SETTING(
     "The auto-discovery of discovery plugins in ndr can be skipped. "
     "This is used mostly for testing purposes.");
 
+TF_DEFINE_ENV_SETTING(
+    PXR_NDR_DISCOVERY_CACHE_PATH, "",
+    "Path to a file used to persist ndr's discovery results across "
+    "processes. If set, the registry loads its discovery results from this "
+    "file when it is valid instead of running the discovery plugins, and "
+    "rewrites it after running them otherwise. The cache is invalidated "
+    "when any discovered file's modification time changes.");
+
 
 
 namespace {
@@ -196,6 +210,157 @@ _ValidateNode(const NdrNodeUniquePtr &newNode,
     return true;
 }
 
+// Persistent discovery cache support. The cache file stores the registry's
+// discovery results as JSON, along with the modification time of each
+// discovered file so that a stale cache is rejected. Parsed nodes are not
+// persisted; they are polymorphic types defined by parser plugins and can
+// only be built by the plugins themselves.
+
+// Bump this version whenever the file layout changes; files with any other
+// version are ignored.
+const int _DiscoveryCacheFormatVersion = 1;
+
+bool
+_GetInt(const JsObject& obj, const char* key, int* result)
+{
+    JsObject::const_iterator i = obj.find(key);
+    if (i == obj.end() || !i->second.IsInt()) {
+        return false;
+    }
+    *result = i->second.GetInt();
+    return true;
+}
+
+bool
+_GetBool(const JsObject& obj, const char* key, bool* result)
+{
+    JsObject::const_iterator i = obj.find(key);
+    if (i == obj.end() || !i->second.IsBool()) {
+        return false;
+    }
+    *result = i->second.GetBool();
+    return true;
+}
+
+bool
+_GetDouble(const JsObject& obj, const char* key, double* result)
+{
+    JsObject::const_iterator i = obj.find(key);
+    if (i == obj.end() || !(i->second.IsReal() || i->second.IsInt())) {
+        return false;
+    }
+    *result = i->second.GetReal();
+    return true;
+}
+
+bool
+_GetString(const JsObject& obj, const char* key, std::string* result)
+{
+    JsObject::const_iterator i = obj.find(key);
+    if (i == obj.end() || !i->second.IsString()) {
+        return false;
+    }
+    *result = i->second.GetString();
+    return true;
+}
+
+JsObject
+_DiscoveryResultToJs(const NdrNodeDiscoveryResult& dr)
+{
+    JsObject obj;
+    obj["Identifier"] = JsValue(NdrGetIdentifierString(dr.identifier));
+    obj["VersionMajor"] = JsValue(dr.version.GetMajor());
+    obj["VersionMinor"] = JsValue(dr.version.GetMinor());
+    obj["VersionIsDefault"] = JsValue(dr.version.IsDefault());
+    obj["Name"] = JsValue(dr.name);
+    obj["Family"] = JsValue(dr.family.GetString());
+    obj["DiscoveryType"] = JsValue(dr.discoveryType.GetString());
+    obj["SourceType"] = JsValue(dr.sourceType.GetString());
+    obj["URI"] = JsValue(dr.uri);
+    obj["ResolvedURI"] = JsValue(dr.resolvedUri);
+    obj["SourceCode"] = JsValue(dr.sourceCode);
+    obj["BlindData"] = JsValue(dr.blindData);
+
+    JsObject metadata;
+    for (const auto& entry : dr.metadata) {
+        metadata[entry.first.GetString()] = JsValue(entry.second);
+    }
+    obj["Metadata"] = JsValue(std::move(metadata));
+
+    // Record the modification time of the discovered file, if there is one,
+    // so that the cached result can be invalidated when the file changes.
+    double mtime;
+    if (!dr.resolvedUri.empty() &&
+        ArchGetModificationTime(dr.resolvedUri.c_str(), &mtime)) {
+        obj["ModificationTime"] = JsValue(mtime);
+    }
+
+    return obj;
+}
+
+// Reconstruct a discovery result from the cache file, appending it to
+// results. Returns false if the entry is malformed or if the discovered
+// file has been modified or removed since the cache was written.
+bool
+_DiscoveryResultFromJs(const JsObject& obj, NdrNodeDiscoveryResultVec* results)
+{
+    std::string identifier, name, family, discoveryType, sourceType,
+        uri, resolvedUri, sourceCode, blindData;
+    int versionMajor, versionMinor;
+    bool versionIsDefault;
+    if (!_GetString(obj, "Identifier", &identifier) ||
+        !_GetInt(obj, "VersionMajor", &versionMajor) ||
+        !_GetInt(obj, "VersionMinor", &versionMinor) ||
+        !_GetBool(obj, "VersionIsDefault", &versionIsDefault) ||
+        !_GetString(obj, "Name", &name) ||
+        !_GetString(obj, "Family", &family) ||
+        !_GetString(obj, "DiscoveryType", &discoveryType) ||
+        !_GetString(obj, "SourceType", &sourceType) ||
+        !_GetString(obj, "URI", &uri) ||
+        !_GetString(obj, "ResolvedURI", &resolvedUri) ||
+        !_GetString(obj, "SourceCode", &sourceCode) ||
+        !_GetString(obj, "BlindData", &blindData)) {
+        return false;
+    }
+
+    NdrTokenMap metadata;
+    JsObject::const_iterator i = obj.find("Metadata");
+    if (i == obj.end() || !i->second.IsObject()) {
+        return false;
+    }
+    for (const auto& entry : i->second.GetJsObject()) {
+        if (!entry.second.IsString()) {
+            return false;
+        }
+        metadata.emplace(TfToken(entry.first), entry.second.GetString());
+    }
+
+    // Reject the cache if the discovered file has been modified or removed
+    // since the cache was written.
+    double cachedMTime;
+    if (_GetDouble(obj, "ModificationTime", &cachedMTime)) {
+        double mtime;
+        if (!ArchGetModificationTime(resolvedUri.c_str(), &mtime) ||
+            mtime != cachedMTime) {
+            return false;
+        }
+    }
+
+    NdrVersion version;
+    if (versionMajor != 0 || versionMinor != 0) {
+        version = NdrVersion(versionMajor, versionMinor);
+    }
+    if (versionIsDefault) {
+        version = version.GetAsDefault();
+    }
+
+    results->emplace_back(NdrIdentifier(identifier), version, name,
+                          TfToken(family), TfToken(discoveryType),
+                          TfToken(sourceType), uri, resolvedUri,
+                          sourceCode, metadata, blindData);
+    return true;
+}
+
 } // anonymous namespace
 
 class NdrRegistry::_DiscoveryContext : public NdrDiscoveryPluginContext {
@@ -217,7 +382,21 @@ NdrRegistry::NdrRegistry()
 {
     _FindAndInstantiateParserPlugins();
     _FindAndInstantiateDiscoveryPlugins();
+
+    // If a persistent discovery cache is in use and it is still valid,
+    // the discovery plugins (and their filesystem scans) can be skipped
+    // entirely.
+    const std::string cachePath =
+        TfGetEnvSetting(PXR_NDR_DISCOVERY_CACHE_PATH);
+    if (!cachePath.empty() && _LoadDiscoveryResultCache(cachePath)) {
+        return;
+    }
+
     _RunDiscoveryPlugins(_discoveryPlugins);
+
+    if (!cachePath.empty()) {
+        _SaveDiscoveryResultCache(cachePath);
+    }
 }
 
 NdrRegistry::~NdrRegistry()
@@ -659,23 +838,34 @@ NdrRegistry::_ParseNodesMatchingPredicate(
     bool onlyParseFirstMatch)
 {
     std::lock_guard<std::mutex> drLock(_discoveryResultMutex);
-    NdrNodeConstPtrVec parsedNodes;
 
-    for (const NdrNodeDiscoveryResult& dr : _discoveryResults) {
-        if (!shouldParsePredicate(dr)) {
-            continue;
+    // Gather the matching results first so that any cache misses can be
+    // parsed in parallel; the predicate itself is cheap to evaluate.
+    std::vector<size_t> matches;
+    for (size_t i = 0; i < _discoveryResults.size(); ++i) {
+        if (shouldParsePredicate(_discoveryResults[i])) {
+            matches.push_back(i);
+            if (onlyParseFirstMatch) {
+                break;
+            }
         }
+    }
 
-        NdrNodeConstPtr parsedNode = _InsertNodeIntoCache(dr);
-
-        if (parsedNode) {
-            parsedNodes.emplace_back(std::move(parsedNode));
+    NdrNodeConstPtrVec parsedNodes(matches.size(), nullptr);
+    WorkParallelForN(matches.size(),
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                parsedNodes[i] =
+                    _InsertNodeIntoCache(_discoveryResults[matches[i]]);
+            }
         }
+    );
 
-        if (onlyParseFirstMatch) {
-            break;
-        }
-    }
+    // Drop entries for nodes that failed to parse, preserving the
+    // discovery order of the rest.
+    parsedNodes.erase(
+        std::remove(parsedNodes.begin(), parsedNodes.end(), nullptr),
+        parsedNodes.end());
 
     return parsedNodes;
 }
@@ -775,6 +965,103 @@ NdrRegistry::_RunDiscoveryPlugins(const DiscoveryPluginRefPtrVec& discoveryPlugi
     }
 }
 
+bool
+NdrRegistry::_LoadDiscoveryResultCache(const std::string& cachePath)
+{
+    std::ifstream stream(cachePath.c_str());
+    if (!stream) {
+        return false;
+    }
+
+    JsParseError error;
+    const JsValue topValue = JsParseStream(stream, &error);
+    if (!topValue.IsObject()) {
+        TF_DEBUG(NDR_DISCOVERY).Msg(
+            "Ignoring malformed discovery cache '%s': %s\n",
+            cachePath.c_str(), error.reason.c_str());
+        return false;
+    }
+
+    const JsObject& top = topValue.GetJsObject();
+    int formatVersion;
+    if (!_GetInt(top, "Version", &formatVersion) ||
+        formatVersion != _DiscoveryCacheFormatVersion) {
+        return false;
+    }
+
+    JsObject::const_iterator i = top.find("DiscoveryResults");
+    if (i == top.end() || !i->second.IsArray()) {
+        return false;
+    }
+
+    NdrNodeDiscoveryResultVec results;
+    const JsArray& array = i->second.GetJsArray();
+    results.reserve(array.size());
+    for (const JsValue& value : array) {
+        if (!value.IsObject() ||
+            !_DiscoveryResultFromJs(value.GetJsObject(), &results)) {
+            TF_DEBUG(NDR_DISCOVERY).Msg(
+                "Ignoring out-of-date discovery cache '%s'\n",
+                cachePath.c_str());
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> drLock(_discoveryResultMutex);
+
+    // Rebuild the sorted source type list from the cached results, just as
+    // _RunDiscoveryPlugins would have.
+    for (const NdrNodeDiscoveryResult& result : results) {
+        if (!result.sourceType.IsEmpty()) {
+            NdrTokenVec::iterator it = std::lower_bound(
+                _availableSourceTypes.begin(),
+                _availableSourceTypes.end(),
+                result.sourceType);
+            if (it == _availableSourceTypes.end() ||
+                result.sourceType != *it) {
+                _availableSourceTypes.insert(it, result.sourceType);
+            }
+        }
+    }
+
+    _discoveryResults = std::move(results);
+
+    TF_DEBUG(NDR_DISCOVERY).Msg(
+        "Loaded %zu discovery results from cache '%s'\n",
+        _discoveryResults.size(), cachePath.c_str());
+
+    return true;
+}
+
+void
+NdrRegistry::_SaveDiscoveryResultCache(const std::string& cachePath) const
+{
+    JsArray array;
+    {
+        std::lock_guard<std::mutex> drLock(_discoveryResultMutex);
+        array.reserve(_discoveryResults.size());
+        for (const NdrNodeDiscoveryResult& dr : _discoveryResults) {
+            array.emplace_back(_DiscoveryResultToJs(dr));
+        }
+    }
+
+    JsObject top;
+    top["Version"] = JsValue(_DiscoveryCacheFormatVersion);
+    top["DiscoveryResults"] = JsValue(std::move(array));
+
+    TfAtomicOfstreamWrapper wrapper(cachePath);
+    std::string reason;
+    if (!wrapper.Open(&reason)) {
+        TF_DEBUG(NDR_DISCOVERY).Msg(
+            "Could not open discovery cache '%s' for writing: %s\n",
+            cachePath.c_str(), reason.c_str());
+        return;
+    }
+
+    JsWriteToStream(JsValue(std::move(top)), wrapper.GetStream());
+    wrapper.Commit(&reason);
+}
+
 NdrNodeConstPtr
 NdrRegistry::_InsertNodeIntoCache(const NdrNodeDiscoveryResult& dr)
 {
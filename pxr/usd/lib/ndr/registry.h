@@ -303,6 +303,16 @@ private:
     // internal discovery results vector
     void _RunDiscoveryPlugins(const DiscoveryPluginRefPtrVec& discoveryPlugins);
 
+    // Attempts to populate the discovery results from the persistent
+    // discovery cache file at cachePath instead of running the discovery
+    // plugins. Returns false if the cache file is missing, malformed, or
+    // out of date with respect to the discovered files.
+    bool _LoadDiscoveryResultCache(const std::string& cachePath);
+
+    // Writes the current discovery results to the persistent discovery
+    // cache file at cachePath.
+    void _SaveDiscoveryResultCache(const std::string& cachePath) const;
+
     // Finds and instantiates the discovery plugins via Tf
     void _FindAndInstantiateDiscoveryPlugins();
 
@@ -311,10 +321,10 @@ private:
 
     // Parses all nodes that match the specified predicate, optionally only
     // parsing the first node that matches (good to use when the predicate will
-    // only ever match one node). This is a lightweight, single-threaded version
-    // of the parsing routine found in `GetNodes()`. Note that if a node matches
-    // the predicate and it has already been parsed, the already-parsed version
-    // will be returned, and a new node will not be inserted into the map.
+    // only ever match one node). Nodes matching the predicate are parsed in
+    // parallel. Note that if a node matches the predicate and it has already
+    // been parsed, the already-parsed version will be returned, and a new node
+    // will not be inserted into the map.
     NdrNodeConstPtrVec _ParseNodesMatchingPredicate(
         std::function<bool(const NdrNodeDiscoveryResult&)> shouldParsePredicate,
         bool onlyParseFirstMatch);
@@ -26,18 +26,22 @@
 #include "pxr/usd/pcp/cache.h"
 #include "pxr/usd/pcp/arc.h"
 #include "pxr/usd/pcp/changes.h"
+#include "pxr/usd/pcp/composeSite.h"
 #include "pxr/usd/pcp/diagnostic.h"
 #include "pxr/usd/pcp/debugCodes.h"
 #include "pxr/usd/pcp/dependencies.h"
+#include "pxr/usd/pcp/layerPrefetchRequest.h"
 #include "pxr/usd/pcp/layerStack.h"
 #include "pxr/usd/pcp/layerStackIdentifier.h"
 #include "pxr/usd/pcp/layerStackRegistry.h"
 #include "pxr/usd/pcp/node_Iterator.h"
 #include "pxr/usd/pcp/pathTranslation.h"
 #include "pxr/usd/pcp/primIndex.h"
+#include "pxr/usd/pcp/primIndexCacheIO.h"
 #include "pxr/usd/pcp/propertyIndex.h"
 #include "pxr/usd/pcp/statistics.h"
 #include "pxr/usd/pcp/targetIndex.h"
+#include "pxr/usd/pcp/utils.h"
 
 #include "pxr/usd/ar/resolver.h"
 #include "pxr/usd/ar/resolverScopedCache.h"
@@ -117,8 +121,11 @@ PcpCache::PcpCache(
     _pathResolverContext(layerStackIdentifier.pathResolverContext),
     _usd(usd),
     _fileFormatTarget(fileFormatTarget),
+    _primIndexCacheFileLoadAttempted(false),
+    _primIndexCacheFileNeedsWrite(false),
     _layerStackCache(Pcp_LayerStackRegistry::New(_fileFormatTarget, _usd)),
-    _primDependencies(new Pcp_Dependencies())
+    _primDependencies(new Pcp_Dependencies()),
+    _usageEpoch(0)
 {
     // Do nothing
 }
@@ -271,7 +278,54 @@ PcpCache::RequestPayloads( const SdfPathSet & pathsToInclude,
     }
 }
 
-void 
+void
+PcpCache::PrefetchPayloads( const SdfPathSet & primIndexPaths,
+                            PcpLayerPrefetchRequest* request ) const
+{
+    TRACE_FUNCTION();
+
+    if (!TF_VERIFY(request)) {
+        return;
+    }
+
+    const SdfLayer::FileFormatArguments defaultArgs =
+        Pcp_GetArgumentsForFileFormatTarget(GetFileFormatTarget());
+
+    // Collect the layers targeted by payload arcs composed at each prim
+    // index.  Payloads authored inside a payload that has not yet been
+    // included are not visible here; clients that include payloads
+    // recursively will pick those up when prefetching the next round.
+    for (const SdfPath& path : primIndexPaths) {
+        const PcpPrimIndex* primIndex = FindPrimIndex(path);
+        if (!primIndex) {
+            continue;
+        }
+        for (const PcpNodeRef& node : primIndex->GetNodeRange()) {
+            if (!node.CanContributeSpecs()) {
+                continue;
+            }
+            SdfPayloadVector payloadArcs;
+            PcpSourceReferenceInfoVector payloadInfo;
+            PcpComposeSitePayloads(node, &payloadArcs, &payloadInfo);
+            for (size_t i = 0, n = payloadArcs.size(); i != n; ++i) {
+                const std::string& assetPath = payloadArcs[i].GetAssetPath();
+                const SdfLayerHandle& srcLayer = payloadInfo[i].layer;
+                if (assetPath.empty() || !srcLayer) {
+                    continue;
+                }
+                SdfLayer::FileFormatArguments localArgs;
+                const SdfLayer::FileFormatArguments& args =
+                    Pcp_GetArgumentsForFileFormatTarget(
+                        assetPath, &defaultArgs, &localArgs);
+                request->RequestLayer(srcLayer, assetPath, args);
+            }
+        }
+    }
+
+    request->Run(_layerStackCache->_GetMutedLayers());
+}
+
+void
 PcpCache::RequestLayerMuting(const std::vector<std::string>& layersToMute,
                              const std::vector<std::string>& layersToUnmute,
                              PcpChanges* changes)
@@ -388,6 +442,22 @@ PcpCache::GetPrimIndexInputs()
         .FileFormatTarget(_fileFormatTarget);
 }
 
+void
+PcpCache::SetPrimIndexCacheFilePath(const std::string &path)
+{
+    if (_primIndexCacheFilePath != path) {
+        _primIndexCacheFilePath = path;
+        _primIndexCacheFileLoadAttempted = false;
+        _primIndexCacheFileNeedsWrite = false;
+    }
+}
+
+const std::string &
+PcpCache::GetPrimIndexCacheFilePath() const
+{
+    return _primIndexCacheFilePath;
+}
+
 PcpLayerStackRefPtr
 PcpCache::ComputeLayerStack(const PcpLayerStackIdentifier &id,
                             PcpErrorVector *allErrors)
@@ -600,7 +670,8 @@ PcpCache::FindSiteDependencies(
 
     // Handle dependencies stored in _primDependencies.
     auto visitSiteFn = [&](const SdfPath &depPrimIndexPath,
-                           const SdfPath &depPrimSitePath)
+                           const SdfPath &depPrimSitePath,
+                           size_t depNodeIndex)
     {
         // Because arc dependencies are analyzed in terms of prims,
         // if we are querying deps for a property, and recurseOnSite
@@ -666,7 +737,8 @@ PcpCache::FindSiteDependencies(
             }
         };
         Pcp_ForEachDependentNode(depPrimSitePath, siteLayerStack,
-                                 depPrimIndexPath, *this, visitNodeFn);
+                                 depPrimIndexPath, depNodeIndex,
+                                 *this, visitNodeFn);
     };
     _primDependencies->ForEachDependencyOnSite(
         siteLayerStack, sitePrimPath,
@@ -1104,6 +1176,71 @@ PcpCache::ReloadReferences(PcpChanges* changes, const SdfPath& primPath)
     SdfLayer::ReloadLayers(layersToReload);
 }
 
+uint64_t
+PcpCache::AdvanceUsageEpoch()
+{
+    return _usageEpoch.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+void
+PcpCache::Trim(uint64_t epoch, PcpLifeboat* lifeboat)
+{
+    TRACE_FUNCTION();
+
+    if (_usageEpoch.load(std::memory_order_relaxed) == 0) {
+        // Usage stamping was never enabled, so there is nothing to
+        // compare against.
+        return;
+    }
+
+    // Gather the paths of valid cached prim indexes whose last-use stamp
+    // predates \p epoch.  An index with no stamp at all has not been used
+    // since stamping was enabled, so it is also considered stale.
+    SdfPathVector pathsToEvict;
+    TF_FOR_ALL(it, _primIndexCache) {
+        if (!it->second.IsValid()) {
+            continue;
+        }
+        const _UsageStampMap::const_iterator stampIt =
+            _usageStamps.find(it->first);
+        const uint64_t stamp =
+            (stampIt == _usageStamps.end()) ? 0 : stampIt->second;
+        if (stamp < epoch) {
+            pathsToEvict.push_back(it->first);
+        }
+    }
+
+    // Evict the stale prim indexes the same way change processing
+    // invalidates them: drop their dependencies and swap in an empty
+    // index, leaving the cache entry to be recomputed on demand.  Layer
+    // stacks and layers held only by the evicted indexes expire with
+    // their last dependency unless \p lifeboat keeps them alive.
+    for (const SdfPath& path : pathsToEvict) {
+        _RemovePrimCache(path, lifeboat);
+        _RemovePropertyCaches(path, lifeboat);
+        _usageStamps.unsafe_erase(path);
+    }
+}
+
+PcpCache::MemoryStats
+PcpCache::GetMemoryStats() const
+{
+    MemoryStats stats;
+    TF_FOR_ALL(it, _primIndexCache) {
+        if (it->second.IsValid()) {
+            ++stats.numPrimIndexes;
+        }
+    }
+    TF_FOR_ALL(it, _propertyIndexCache) {
+        if (!it->second.IsEmpty()) {
+            ++stats.numPropertyIndexes;
+        }
+    }
+    stats.numLayerStacks = _layerStackCache->GetAllLayerStacks().size();
+    stats.numUsedLayers = GetUsedLayers().size();
+    return stats;
+}
+
 void
 PcpCache::_RemovePrimCache(const SdfPath& primPath, PcpLifeboat* lifeboat)
 {
@@ -1164,6 +1301,7 @@ PcpCache::_GetPrimIndex(const SdfPath& path)
     if (i != _primIndexCache.end()) {
         PcpPrimIndex &primIndex = i->second;
         if (primIndex.IsValid()) {
+            _StampUsage(path);
             return &primIndex;
         }
     }
@@ -1177,12 +1315,22 @@ PcpCache::_GetPrimIndex(const SdfPath& path) const
     if (i != _primIndexCache.end()) {
         const PcpPrimIndex &primIndex = i->second;
         if (primIndex.IsValid()) {
+            _StampUsage(path);
             return &primIndex;
         }
     }
     return NULL;
 }
 
+void
+PcpCache::_StampUsage(const SdfPath& path) const
+{
+    const uint64_t epoch = _usageEpoch.load(std::memory_order_relaxed);
+    if (epoch != 0) {
+        _usageStamps[path] = epoch;
+    }
+}
+
 template <class ChildrenPredicate>
 struct Pcp_ParallelIndexer
 {
@@ -1478,6 +1626,17 @@ PcpCache::_ComputePrimIndexesInParallel(
     if (!_layerStack)
         ComputeLayerStack(GetLayerStackIdentifier(), allErrors);
 
+    // If an on-disk prim index cache file is in use, try to pre-populate
+    // _primIndexCache from it.  The indexer below skips any path that
+    // already has a valid cache entry, so a successful load turns the
+    // indexing pass into a no-op.  If the file is missing or stale we
+    // rewrite it once composition is done.
+    if (!_primIndexCacheFilePath.empty() && !_primIndexCacheFileLoadAttempted) {
+        _primIndexCacheFileLoadAttempted = true;
+        _primIndexCacheFileNeedsWrite =
+            !Pcp_PrimIndexCacheIO::Read(this, _primIndexCacheFilePath);
+    }
+
     // General strategy: Compute indexes recursively starting from roots, in
     // parallel.  When we've computed an index, ask the children predicate if we
     // should continue to compute its children indexes.  If so, we add all the
@@ -1506,6 +1665,14 @@ PcpCache::_ComputePrimIndexesInParallel(
 
     // Do the indexing and wait for it to complete.
     indexer.RunAndWait();
+
+    if (_primIndexCacheFileNeedsWrite) {
+        // Only try once per load attempt; failure here means the cache is
+        // not representable in the file (or the file is not writable), and
+        // that will not change until the cache's contents do.
+        _primIndexCacheFileNeedsWrite = false;
+        Pcp_PrimIndexCacheIO::Write(*this, _primIndexCacheFilePath);
+    }
 }
 
 const PcpPrimIndex &
@@ -1526,6 +1693,7 @@ PcpCache::_ComputePrimIndexWithCompatibleInputs(
     // so we have to explicitly check for that.
     _PrimIndexCache::const_iterator i = _primIndexCache.find(path);
     if (i != _primIndexCache.end() && i->second.IsValid()) {
+        _StampUsage(path);
         return i->second;
     }
 
@@ -1555,6 +1723,7 @@ PcpCache::_ComputePrimIndexWithCompatibleInputs(
     // Save the prim index.
     PcpPrimIndex &cacheEntry = _primIndexCache[path];
     cacheEntry.Swap(outputs.primIndex);
+    _StampUsage(path);
 
     return cacheEntry;
 }
@@ -39,6 +39,9 @@
 #include "pxr/base/tf/declarePtrs.h"
 #include "pxr/base/tf/hashset.h"
 
+#include <tbb/concurrent_unordered_map.h>
+
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -50,6 +53,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 class PcpChanges;
 class PcpCacheChanges;
 class Pcp_Dependencies;
+class PcpLayerPrefetchRequest;
 class PcpLayerStackIdentifier;
 class PcpLifeboat;
 class PcpNodeRef;
@@ -168,11 +172,23 @@ public:
     /// \note If a path is listed in both pathsToInclude and pathsToExclude,
     /// it will be treated as an inclusion only.
     ///
-    PCP_API 
+    PCP_API
     void RequestPayloads( const SdfPathSet & pathsToInclude,
                           const SdfPathSet & pathsToExclude,
                           PcpChanges* changes = NULL );
 
+    /// Pre-fetch the layers targeted by payload arcs composed at each
+    /// prim index path in \p primIndexPaths, opening them as one parallel
+    /// fan-out via \p request.  This is an optional optimization for
+    /// clients about to include those payloads via RequestPayloads();
+    /// without it, composition discovers and opens each payload layer
+    /// on demand during prim indexing.  \p request retains the opened
+    /// layers, so it must be kept alive until the payloads have been
+    /// included and their prim indexes recomputed.
+    PCP_API
+    void PrefetchPayloads( const SdfPathSet & primIndexPaths,
+                           PcpLayerPrefetchRequest* request ) const;
+
     /// Request layers to be muted or unmuted in this cache.  Muted layers
     /// are ignored during composition and do not appear in any layer
     /// stacks.  The root layer of this stage may not be muted; attempting
@@ -233,10 +249,30 @@ public:
                           = nullptr) const;
 
     /// Returns parameter object containing all inputs for the prim index
-    /// computation used by this cache. 
+    /// computation used by this cache.
     PCP_API
     PcpPrimIndexInputs GetPrimIndexInputs();
 
+    /// Set the path of an optional on-disk prim index cache file.  When
+    /// set, ComputePrimIndexesInParallel() will attempt to load previously
+    /// computed prim indexes from the file instead of recomposing them,
+    /// and will write the file after composing if it was missing or could
+    /// not be used.  The file records the modification timestamp of every
+    /// contributing layer and is ignored in its entirety if any layer has
+    /// changed, so a stale file only costs the time to detect staleness.
+    ///
+    /// The file cannot represent muted layers, session layer opinions,
+    /// local composition errors, opinions from anonymous layers, or
+    /// dynamic file format dependencies; caches using those features fall
+    /// back to normal composition.  Only supported for USD caches.
+    PCP_API
+    void SetPrimIndexCacheFilePath(const std::string &path);
+
+    /// Returns the path set by SetPrimIndexCacheFilePath(), or the empty
+    /// string if no prim index cache file is in use.
+    PCP_API
+    const std::string &GetPrimIndexCacheFilePath() const;
+
     /// @}
 
     /// \name Computations
@@ -559,6 +595,61 @@ public:
 
     /// @}
 
+    /// \name Memory management
+    /// @{
+
+    /// Advance this cache's usage epoch and return the new epoch value.
+    ///
+    /// Once a client has advanced the epoch at least once, the cache
+    /// stamps each cached prim index with the current epoch whenever it
+    /// is found or computed.  Trim() uses these stamps to evict prim
+    /// indexes that have not been used recently.  Caches whose clients
+    /// never call this function pay no stamping cost.
+    PCP_API
+    uint64_t AdvanceUsageEpoch();
+
+    /// Evict cached prim indexes (and the property indexes beneath them)
+    /// that have not been used since \p epoch, as recorded by the usage
+    /// epoch stamps.  Evicted computations are recomputed on demand the
+    /// next time they are requested, so trimming does not change the
+    /// composed results this cache produces; in particular the set of
+    /// included payloads is unaffected.  Layer stacks and layers that
+    /// were retained only by evicted prim indexes are released as a
+    /// consequence.
+    ///
+    /// Trimming invalidates any PcpPrimIndex and PcpPropertyIndex
+    /// pointers previously returned for the evicted paths; clients that
+    /// hold such pointers (e.g., scenegraphs built atop this cache) must
+    /// not trim epochs whose prim indexes may still be referenced.
+    ///
+    /// If \p lifeboat is given then it will keep any layers dropped by
+    /// the evicted prim indexes alive, as with Apply().
+    PCP_API
+    void Trim(uint64_t epoch, PcpLifeboat* lifeboat = nullptr);
+
+    /// \struct MemoryStats
+    ///
+    /// Counts of the major cached computations held by a PcpCache,
+    /// used to decide when and how aggressively to Trim().
+    struct MemoryStats {
+        MemoryStats()
+            : numPrimIndexes(0)
+            , numPropertyIndexes(0)
+            , numLayerStacks(0)
+            , numUsedLayers(0) {}
+
+        size_t numPrimIndexes;
+        size_t numPropertyIndexes;
+        size_t numLayerStacks;
+        size_t numUsedLayers;
+    };
+
+    /// Return counts of the cached computations held by this cache.
+    PCP_API
+    MemoryStats GetMemoryStats() const;
+
+    /// @}
+
     /// \name Diagnostics
     /// @{
 
@@ -571,6 +662,7 @@ public:
 private:
     friend class PcpChanges;
     friend class Pcp_Statistics;
+    friend class Pcp_PrimIndexCacheIO;
 
     template <class ChildPredicate>
     friend struct Pcp_ParallelIndexer;
@@ -659,6 +751,11 @@ private:
     PcpPrimIndex* _GetPrimIndex(const SdfPath& path);
     const PcpPrimIndex* _GetPrimIndex(const SdfPath& path) const;
 
+    // Stamps the prim index at \p path as used in the current usage
+    // epoch.  Does nothing until a client enables stamping by calling
+    // AdvanceUsageEpoch().
+    void _StampUsage(const SdfPath& path) const;
+
     // Returns the property index for \p path if it exists, NULL otherwise.
     PcpPropertyIndex* _GetPropertyIndex(const SdfPath& path);
     const PcpPropertyIndex* _GetPropertyIndex(const SdfPath& path) const;
@@ -693,6 +790,13 @@ private:
     PayloadSet _includedPayloads;
     PcpVariantFallbackMap _variantFallbackMap;
 
+    // Optional on-disk prim index cache file.  The load is attempted at
+    // most once per path; if it fails the file is rewritten after the next
+    // parallel composition.
+    std::string _primIndexCacheFilePath;
+    bool _primIndexCacheFileLoadAttempted;
+    bool _primIndexCacheFileNeedsWrite;
+
     // Cached computation types.
     typedef Pcp_LayerStackRegistryRefPtr _LayerStackCache;
     typedef SdfPathTable<PcpPrimIndex> _PrimIndexCache;
@@ -703,6 +807,16 @@ private:
     _PrimIndexCache  _primIndexCache;
     _PropertyIndexCache  _propertyIndexCache;
     std::unique_ptr<Pcp_Dependencies> _primDependencies;
+
+    // Usage-epoch stamps for Trim().  The epoch stays 0 until a client
+    // calls AdvanceUsageEpoch(); stamping is skipped entirely while it
+    // is 0.  The stamp map is concurrent because prim indexes are found
+    // and computed from multiple threads; racing stamps within an epoch
+    // are benign since any value from the epoch serves as a usage hint.
+    typedef tbb::concurrent_unordered_map<SdfPath, uint64_t, SdfPath::Hash>
+        _UsageStampMap;
+    std::atomic<uint64_t> _usageEpoch;
+    mutable _UsageStampMap _usageStamps;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -550,8 +550,18 @@ PcpChanges::DidChange(const std::vector<PcpCache*>& caches,
         fallbackToAncestorPaths.clear();
         fieldForFileFormatArgumentsChanges.clear();
 
+        // Coalesce the change list into subtree-granular entries before
+        // processing.  A mass edit that touched every spec beneath a
+        // handful of prims collapses to one entry per subtree carrying
+        // the union of the change flags; the significant change we
+        // register for each subtree root below subsumes invalidation of
+        // everything beneath it, so processing scales with the number of
+        // changed subtrees rather than the number of changed specs.
+        const SdfChangeList::EntryList coalescedEntries =
+            changeList.GetCoalescedSubtreeChanges();
+
         // Loop over each entry on the layer.
-        TF_FOR_ALL(j, changeList.GetEntryList()) {
+        TF_FOR_ALL(j, coalescedEntries) {
             const SdfPath& path = j->first;
             const SdfChangeList::Entry& entry = j->second;
 
@@ -887,8 +897,8 @@ PcpChanges::DidChange(const std::vector<PcpCache*>& caches,
             PcpCache * const & cache = p.first;
             const SdfPath &changedPath = p.second;
 
-            const SdfChangeList::Entry* changes = 
-                TfMapLookupPtr(changeList.GetEntryList(), changedPath);
+            const SdfChangeList::Entry* changes =
+                TfMapLookupPtr(coalescedEntries, changedPath);
 
             // We need to recurse on prim descendants for dynamic file format
             // argument changes. This is to catch the case where there's
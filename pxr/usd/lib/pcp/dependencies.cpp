@@ -86,7 +86,7 @@ Pcp_Dependencies::Add(
         const PcpDependencyFlags depFlags = PcpClassifyNodeDependency(n);
         if (_ShouldStoreDependency(depFlags)) {
             _SiteDepMap &siteDepMap = _deps[n.GetLayerStack()];
-            std::vector<SdfPath> &deps = siteDepMap[n.GetPath()];
+            std::vector<Pcp_DependencyEntry> &deps = siteDepMap[n.GetPath()];
 
             TF_DEBUG(PCP_DEPENDENCIES)
                 .Msg(" - Node %i (%s %s): <%s> %s\n",
@@ -96,7 +96,8 @@ Pcp_Dependencies::Add(
                      n.GetPath().GetText(),
                      TfStringify(n.GetLayerStack()->GetIdentifier()).c_str());
 
-            deps.push_back(primIndexPath);
+            deps.push_back(Pcp_DependencyEntry{
+                primIndexPath, static_cast<size_t>(curNodeIndex)});
             count++;
         }
     }
@@ -142,7 +143,7 @@ Pcp_Dependencies::Remove(const PcpPrimIndex &primIndex, PcpLifeboat *lifeboat)
         }
 
         _SiteDepMap &siteDepMap = _deps[n.GetLayerStack()];
-        std::vector<SdfPath> &deps = siteDepMap[n.GetPath()];
+        std::vector<Pcp_DependencyEntry> &deps = siteDepMap[n.GetPath()];
 
         TF_DEBUG(PCP_DEPENDENCIES)
             .Msg(" - Node %i (%s %s): <%s> %s\n",
@@ -154,12 +155,16 @@ Pcp_Dependencies::Remove(const PcpPrimIndex &primIndex, PcpLifeboat *lifeboat)
 
         // Swap with last element, then remove that.
         // We are using the vector as an unordered set.
-        std::vector<SdfPath>::iterator i =
-            std::find(deps.begin(), deps.end(), primIndexPath);
+        std::vector<Pcp_DependencyEntry>::iterator i = std::find_if(
+            deps.begin(), deps.end(),
+            [&primIndexPath, curNodeIndex](const Pcp_DependencyEntry &dep) {
+                return dep.primIndexPath == primIndexPath &&
+                    dep.nodeIndex == static_cast<size_t>(curNodeIndex);
+            });
         if (!TF_VERIFY(i != deps.end())) {
             continue;
         }
-        std::vector<SdfPath>::iterator last = --deps.end();
+        std::vector<Pcp_DependencyEntry>::iterator last = --deps.end();
         std::swap(*i, *last);
         deps.erase(last);
 
@@ -40,6 +40,7 @@
 #include <boost/noncopyable.hpp>
 
 #include <iosfwd>
+#include <iterator>
 #include <set>
 #include <unordered_map>
 
@@ -50,6 +51,18 @@ class PcpPrimIndexDependencies;
 
 TF_DECLARE_WEAK_PTRS(PcpLayerStack);
 
+/// \struct Pcp_DependencyEntry
+///
+/// A single dependency record: the path of the dependent prim index,
+/// and the index of the node within that prim index that introduces
+/// the dependency.  Recording the node index lets queries jump directly
+/// to the dependent node instead of scanning every node in the index.
+///
+struct Pcp_DependencyEntry {
+    SdfPath primIndexPath;
+    size_t nodeIndex;
+};
+
 /// \class Pcp_Dependencies
 ///
 /// Tracks the dependencies of PcpPrimIndex entries in a PcpCache.
@@ -93,7 +106,9 @@ public:
     /// Invokes \p fn for every \c PcpPrimIndex that uses
     /// the site represented by (siteLayerStack, sitePath).
     ///
-    /// The arguments to \p fn are: (depIndexPath, depSitePath).
+    /// The arguments to \p fn are: (depIndexPath, depSitePath,
+    /// depNodeIndex), where depNodeIndex identifies the node in the
+    /// dependent prim index that introduces the dependency.
     ///
     /// If \p includeAncestral is \c true, this will also walk up
     /// ancestral dependencies introduced by parent prims.
@@ -120,15 +135,15 @@ public:
         if (recurseBelowSite) {
             auto range = siteDepMap.FindSubtreeRange(sitePath);
             for (auto iter = range.first; iter != range.second; ++iter) {
-                for(const SdfPath &primIndexPath: iter->second) {
-                    fn(primIndexPath, iter->first);
+                for(const Pcp_DependencyEntry &dep: iter->second) {
+                    fn(dep.primIndexPath, iter->first, dep.nodeIndex);
                 }
             }
         } else {
             _SiteDepMap::const_iterator j = siteDepMap.find(sitePath);
             if (j != siteDepMap.end()) {
-                for(const SdfPath &primIndexPath: j->second) {
-                    fn(primIndexPath, sitePath);
+                for(const Pcp_DependencyEntry &dep: j->second) {
+                    fn(dep.primIndexPath, sitePath, dep.nodeIndex);
                 }
             }
         }
@@ -140,8 +155,9 @@ public:
                 _SiteDepMap::const_iterator j =
                     siteDepMap.find(ancestorSitePath);
                 if (j != siteDepMap.end()) {
-                    for(const SdfPath &ancestorPrimIndexPath: j->second) {
-                        fn(ancestorPrimIndexPath, ancestorSitePath);
+                    for(const Pcp_DependencyEntry &dep: j->second) {
+                        fn(dep.primIndexPath, ancestorSitePath,
+                           dep.nodeIndex);
                     }
                 }
             }
@@ -181,10 +197,11 @@ public:
     /// @}
 
 private:
-    // Map of site paths to dependencies, as cache paths.  Stores cache
-    // paths as an unordered vector: for our datasets this is both more
-    // compact and faster than std::set.
-    using _SiteDepMap = SdfPathTable<SdfPathVector>;
+    // Map of site paths to dependencies, as cache paths paired with the
+    // index of the dependent node.  Stores the entries as an unordered
+    // vector: for our datasets this is both more compact and faster than
+    // std::set.
+    using _SiteDepMap = SdfPathTable<std::vector<Pcp_DependencyEntry>>;
 
     // Map of layer stacks to dependencies on that layerStack.
     // Retains references to those layer stacks, which in turn
@@ -208,6 +225,21 @@ private:
 
 };
 
+// Variant of Pcp_ForEachDependentNode below that uses the node index
+// recorded in the dependency table to jump directly to the dependent
+// node, rather than scanning every node in the dependent prim index.
+// Falls back to the scanning variant if the recorded node no longer
+// lines up with the prim index, e.g. if the index was evicted and only
+// an ancestor index remains.
+template <typename FN>
+static void
+Pcp_ForEachDependentNode( const SdfPath &sitePath,
+                          const PcpLayerStackPtr &layerStack,
+                          const SdfPath &depIndexPath,
+                          size_t nodeIndex,
+                          const PcpCache &cache,
+                          const FN &fn );
+
 template <typename FN>
 static void
 Pcp_ForEachDependentNode( const SdfPath &sitePath,
@@ -298,6 +330,35 @@ Pcp_ForEachDependentNode( const SdfPath &sitePath,
             );
 }
 
+template <typename FN>
+static void
+Pcp_ForEachDependentNode( const SdfPath &sitePath,
+                          const PcpLayerStackPtr &layerStack,
+                          const SdfPath &depIndexPath,
+                          size_t nodeIndex,
+                          const PcpCache &cache,
+                          const FN &fn )
+{
+    if (const PcpPrimIndex *primIndex =
+        cache.FindPrimIndex(depIndexPath.GetAbsoluteRootOrPrimPath())) {
+        const PcpNodeRange range = primIndex->GetNodeRange();
+        if (static_cast<ptrdiff_t>(nodeIndex) <
+            std::distance(range.first, range.second)) {
+            const PcpNodeRef node = *std::next(range.first, nodeIndex);
+            if (PcpNodeIntroducesDependency(node) &&
+                node.GetLayerStack() == layerStack &&
+                sitePath.HasPrefix(node.GetPath())) {
+                fn(depIndexPath, node);
+                return;
+            }
+        }
+    }
+
+    // The recorded node doesn't line up with a cached prim index;
+    // fall back to scanning for the dependent node.
+    Pcp_ForEachDependentNode(sitePath, layerStack, depIndexPath, cache, fn);
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif // PCP_DEPENDENCIES_H
@@ -52,6 +52,13 @@ struct _Opener
         }
     }
 
+    void OpenLayer(const SdfLayerRefPtr &anchorLayer,
+                   const std::string &path,
+                   const SdfLayer::FileFormatArguments &layerArgs) {
+        _dispatcher.Run(
+            &_Opener::_OpenSublayer, this, path, anchorLayer, layerArgs);
+    }
+
 private:
     void _OpenSublayer(std::string path,
                        const SdfLayerRefPtr &anchorLayer,
@@ -94,6 +101,15 @@ PcpLayerPrefetchRequest::RequestSublayerStack(
     _sublayerRequests.insert(std::make_pair(layer, args));
 }
 
+void
+PcpLayerPrefetchRequest::RequestLayer(
+    const SdfLayerHandle &anchorLayer,
+    const std::string &layerPath,
+    const SdfLayer::FileFormatArguments &args)
+{
+    _layerRequests.insert(std::make_tuple(anchorLayer, layerPath, args));
+}
+
 void
 PcpLayerPrefetchRequest::Run(const Pcp_MutedLayers& mutedLayers)
 {
@@ -111,10 +127,19 @@ PcpLayerPrefetchRequest::Run(const Pcp_MutedLayers& mutedLayers)
     std::set<_Request> requests;
     requests.swap(_sublayerRequests);
 
-    // Open all the sublayers in the request.
+    std::set<_LayerRequest> layerRequests;
+    layerRequests.swap(_layerRequests);
+
+    // Open all the layers in the request.
     _Opener opener(mutedLayers, &_retainedLayers);
     TF_FOR_ALL(req, requests)
         opener.OpenSublayers(req->first, req->second);
+    TF_FOR_ALL(req, layerRequests) {
+        if (const SdfLayerRefPtr anchor =
+            SdfLayerRefPtr(std::get<0>(*req))) {
+            opener.OpenLayer(anchor, std::get<1>(*req), std::get<2>(*req));
+        }
+    }
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
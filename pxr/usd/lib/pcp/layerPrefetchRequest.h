@@ -29,6 +29,8 @@
 #include "pxr/usd/sdf/layer.h"
 
 #include <set>
+#include <string>
+#include <tuple>
 #include <utility>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -54,6 +56,15 @@ public:
         const SdfLayerRefPtr &layer,
         const SdfLayer::FileFormatArguments &args);
 
+    /// Enqueue a request to pre-fetch the layer at \a layerPath, anchored
+    /// to \a anchorLayer, along with its recursive sublayers. Arguments in
+    /// \a args will be passed to Sdf when finding or opening layers.
+    PCP_API
+    void RequestLayer(
+        const SdfLayerHandle &anchorLayer,
+        const std::string &layerPath,
+        const SdfLayer::FileFormatArguments &args);
+
     /// Run the queued requests, returning when complete.
     PCP_API
     void Run(const Pcp_MutedLayers& mutedLayers);
@@ -64,6 +75,11 @@ private:
     typedef std::pair<SdfLayerRefPtr, SdfLayer::FileFormatArguments> _Request;
     std::set<_Request> _sublayerRequests;
 
+    typedef std::tuple<
+        SdfLayerHandle, std::string, SdfLayer::FileFormatArguments>
+        _LayerRequest;
+    std::set<_LayerRequest> _layerRequests;
+
     std::set<SdfLayerRefPtr> _retainedLayers;
 };
 
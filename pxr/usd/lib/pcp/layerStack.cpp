@@ -32,7 +32,9 @@
 #include "pxr/usd/sdf/layer.h"
 #include "pxr/usd/sdf/layerUtils.h"
 #include "pxr/usd/sdf/primSpec.h"
+#include "pxr/usd/ar/resolver.h"
 #include "pxr/usd/ar/resolverContextBinder.h"
+#include "pxr/usd/ar/resolverScopedCache.h"
 #include "pxr/base/trace/trace.h"
 #include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/mallocTag.h"
@@ -747,6 +749,31 @@ PcpLayerStack::_BuildLayerStack(
     Pcp_SublayerInfoVector sublayerInfo;
     const vector<string> &sublayers = layer->GetSubLayerPaths();
     const SdfLayerOffsetVector &sublayerOffsets = layer->GetSubLayerOffsets();
+
+    // Resolve the sublayer asset paths as a batch before opening them one
+    // at a time below.  Paths that require no anchoring -- absolute and
+    // repository paths -- can be handed directly to the resolver; resolvers
+    // that override ArResolver::ResolveBatch() then see the entire fan-out
+    // as a single request, and the scoped cache answers the per-sublayer
+    // resolves issued by SdfFindOrOpenRelativeToLayer from the prefetched
+    // results.
+    ArResolverScopedCache resolverCacheScope;
+    if (sublayers.size() > 1) {
+        ArResolver& resolver = ArGetResolver();
+        std::vector<std::string> prefetchPaths;
+        prefetchPaths.reserve(sublayers.size());
+        for (const string& sublayerPath : sublayers) {
+            if (!sublayerPath.empty() &&
+                !resolver.IsRelativePath(sublayerPath)) {
+                prefetchPaths.push_back(sublayerPath);
+            }
+        }
+        if (prefetchPaths.size() > 1) {
+            std::vector<std::string> prefetchedResults;
+            resolver.ResolveBatch(prefetchPaths, &prefetchedResults);
+        }
+    }
+
     for(size_t i=0, numSublayers = sublayers.size(); i<numSublayers; i++) {
         _assetPaths.insert(sublayers[i]);
 
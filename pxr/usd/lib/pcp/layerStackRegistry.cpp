@@ -32,7 +32,9 @@
 #include "pxr/usd/sdf/layerUtils.h"
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/staticData.h"
+#include "pxr/base/work/loops.h"
 
+#include <tbb/concurrent_hash_map.h>
 #include <tbb/queuing_rw_mutex.h>
 
 #include <boost/unordered_map.hpp>
@@ -55,7 +57,27 @@ public:
 
     typedef SdfLayerHandleVector Layers;
     typedef PcpLayerStackPtrVector LayerStacks;
-    typedef boost::unordered_map<PcpLayerStackIdentifier, PcpLayerStackPtr>
+
+    // Hash and comparison traits for the identifier table.
+    struct IdentifierHashCompare {
+        static size_t hash(const PcpLayerStackIdentifier& identifier) {
+            return identifier.GetHash();
+        }
+        static bool equal(const PcpLayerStackIdentifier& lhs,
+                          const PcpLayerStackIdentifier& rhs) {
+            return lhs == rhs;
+        }
+    };
+
+    // The identifier table is a concurrent hash map so that the
+    // FindOrCreate() hit path, which parallel prim indexing hammers,
+    // only takes a per-bucket reader lock rather than the registry
+    // mutex.  Inserts and erasures still take the registry write lock,
+    // since tbb does not allow them concurrently with the iteration in
+    // GetAllLayerStacks(), which holds the read lock.  The other tables
+    // are only read and written under the registry mutex.
+    typedef tbb::concurrent_hash_map<
+        PcpLayerStackIdentifier, PcpLayerStackPtr, IdentifierHashCompare>
         IdentifierToLayerStack;
     typedef boost::unordered_map<SdfLayerHandle, LayerStacks>
         LayerToLayerStacks;
@@ -144,51 +166,79 @@ Pcp_LayerStackRegistry::FindOrCreate(const PcpLayerStackIdentifier& identifier,
         return TfNullPtr;
     }
 
-    tbb::queuing_rw_mutex::scoped_lock lock(_data->mutex, /*write=*/false);
-
+    // Hit path: the identifier table is concurrency-safe, so lookups
+    // proceed without touching the registry mutex.
     if (const PcpLayerStackPtr & layerStack = _Find(identifier)) {
         return layerStack;
-    } else {
+    }
+
+    // Compute the layer stack outside any lock.
+    PcpLayerStackRefPtr refLayerStack =
+        TfCreateRefPtr(new PcpLayerStack(
+            identifier, _GetFileFormatTarget(), _GetMutedLayers(),
+            _IsUsd()));
+
+    // See if we get to install the layerstack.  All mutations of the
+    // identifier table take the registry write lock so that iteration in
+    // GetAllLayerStacks() -- which tbb does not allow concurrently with
+    // insert or erase -- is excluded by the read lock; only lookups are
+    // lock-free.  Holding the accessor keeps lookups for this identifier
+    // blocked until the layer stack is fully installed.
+    tbb::queuing_rw_mutex::scoped_lock lock(_data->mutex, /*write=*/true);
+    Pcp_LayerStackRegistryData::IdentifierToLayerStack::accessor accessor;
+    if (_data->identifierToLayerStack.insert(accessor, identifier)) {
+        accessor->second = PcpLayerStackPtr(refLayerStack);
+
+        // If so give it a link back to us so it can remove itself upon
+        // destruction, and install its layers into our structures.
+        refLayerStack->_registry = TfCreateWeakPtr(this);
+        _SetLayers(get_pointer(refLayerStack));
+        accessor.release();
         lock.release();
 
-        PcpLayerStackRefPtr refLayerStack =
-            TfCreateRefPtr(new PcpLayerStack(
-                identifier, _GetFileFormatTarget(), _GetMutedLayers(), 
-                _IsUsd()));
-
-        // Take the lock and see if we get to install the layerstack.
-        lock.acquire(_data->mutex);
-        auto iresult =
-            _data->identifierToLayerStack.emplace(identifier, refLayerStack);
-        if (iresult.second) {
-            // If so give it a link back to us so it can remove itself upon
-            // destruction, and install its layers into our structures.
-            refLayerStack->_registry = TfCreateWeakPtr(this);
-            _SetLayers(get_pointer(refLayerStack));
-            lock.release();
-
-            // Return errors from newly computed layer stacks.
-            PcpErrorVector errors = refLayerStack->GetLocalErrors();
-            allErrors->insert(allErrors->end(), errors.begin(), errors.end());
-        }
+        // Return errors from newly computed layer stacks.
+        PcpErrorVector errors = refLayerStack->GetLocalErrors();
+        allErrors->insert(allErrors->end(), errors.begin(), errors.end());
+        return refLayerStack;
+    }
+
+    // Another thread installed a layer stack for this identifier first.
+    return accessor->second;
+}
 
-        return iresult.first->second;
+void
+Pcp_LayerStackRegistry::FindOrCreateInParallel(
+    const std::vector<PcpLayerStackIdentifier>& identifiers,
+    PcpErrorVector* allErrors)
+{
+    // Collect errors per identifier so the workers don't contend on
+    // the caller's error vector.
+    std::vector<PcpErrorVector> errorsPerIdentifier(identifiers.size());
+    WorkParallelForN(
+        identifiers.size(),
+        [this, &identifiers, &errorsPerIdentifier](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                FindOrCreate(identifiers[i], &errorsPerIdentifier[i]);
+            }
+        });
+
+    for (const auto& errors : errorsPerIdentifier) {
+        allErrors->insert(allErrors->end(), errors.begin(), errors.end());
     }
 }
 
 PcpLayerStackPtr
 Pcp_LayerStackRegistry::Find(const PcpLayerStackIdentifier& identifier) const
 {
-    tbb::queuing_rw_mutex::scoped_lock lock(_data->mutex, /*write=*/false);
     return _Find(identifier);
 }
 
 PcpLayerStackPtr
 Pcp_LayerStackRegistry::_Find(const PcpLayerStackIdentifier& identifier) const
 {
-    auto iter = _data->identifierToLayerStack.find(identifier);
-    return (iter != _data->identifierToLayerStack.end()) ?
-        iter->second : PcpLayerStackPtr();
+    Pcp_LayerStackRegistryData::IdentifierToLayerStack::const_accessor accessor;
+    return _data->identifierToLayerStack.find(accessor, identifier) ?
+        accessor->second : PcpLayerStackPtr();
 }
 
 
@@ -221,11 +271,14 @@ void
 Pcp_LayerStackRegistry::_Remove(const PcpLayerStackIdentifier& identifier,
                                 const PcpLayerStack *layerStack)
 {
-    Pcp_LayerStackRegistryData::IdentifierToLayerStack::const_iterator i =
-        _data->identifierToLayerStack.find(identifier);
-    if (TF_VERIFY(i != _data->identifierToLayerStack.end()) &&
-        TF_VERIFY(i->second.operator->() == layerStack)) {
-        _data->identifierToLayerStack.erase(identifier);
+    // Like the insertions in FindOrCreate(), erasure takes the registry
+    // write lock so that it cannot run concurrently with the iteration
+    // in GetAllLayerStacks().
+    tbb::queuing_rw_mutex::scoped_lock lock(_data->mutex, /*write=*/true);
+    Pcp_LayerStackRegistryData::IdentifierToLayerStack::accessor accessor;
+    if (TF_VERIFY(_data->identifierToLayerStack.find(accessor, identifier)) &&
+        TF_VERIFY(accessor->second.operator->() == layerStack)) {
+        _data->identifierToLayerStack.erase(accessor);
     }
 }
 
@@ -82,6 +82,15 @@ public:
     PcpLayerStackRefPtr FindOrCreate(const PcpLayerStackIdentifier& identifier,
                                      PcpErrorVector *allErrors);
 
+    /// Computes the layer stacks for all of \p identifiers in parallel,
+    /// skipping any that already exist.  Errors from newly computed layer
+    /// stacks are appended to \p allErrors.  This is a warm-up for
+    /// parallel prim indexing: computing the layer stacks up front keeps
+    /// indexing threads from contending to create the same few stacks.
+    void FindOrCreateInParallel(
+        const std::vector<PcpLayerStackIdentifier>& identifiers,
+        PcpErrorVector* allErrors);
+
     /// Returns the layer stack for \p identifier if it exists, otherwise
     /// returns \c NULL.
     PcpLayerStackPtr Find(const PcpLayerStackIdentifier&) const;
@@ -105,7 +114,8 @@ private:
                            bool isUsd);
     ~Pcp_LayerStackRegistry();
 
-    // Find that doesn't lock.
+    // Find without taking the registry mutex.  The identifier table is
+    // concurrency-safe on its own.
     PcpLayerStackPtr _Find(const PcpLayerStackIdentifier&) const;
 
     // Remove the layer stack with the given identifier from the registry.
@@ -128,10 +138,14 @@ private:
     // computation can easily query whether a layer is muted.
     const Pcp_MutedLayers& _GetMutedLayers() const;
 
-    // PcpLayerStack can access private _GetFileFormatTarget(), 
+    // PcpLayerStack can access private _GetFileFormatTarget(),
     // _Remove(), and _SetLayers().
     friend class PcpLayerStack;
 
+    // PcpCache can access private _GetMutedLayers() to run layer
+    // pre-fetch requests.
+    friend class PcpCache;
+
 private:
     std::unique_ptr<Pcp_LayerStackRegistryData> _data;
 };
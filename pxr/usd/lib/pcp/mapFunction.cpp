@@ -70,6 +70,33 @@ PcpMapFunction::PcpMapFunction(PathPair const *begin,
     : _data(begin, end, hasRootIdentity)
     , _offset(offset)
 {
+    // Precompute whether any mapping's source or target path encloses
+    // another's.  Only in that case can mapping a path produce a result
+    // that a more-specific reverse mapping would claim, which is what
+    // the invertibility check in _Map guards against; when there is no
+    // nesting, _Map can skip that check entirely.  The pair count is
+    // small (typically one or two), so the quadratic scan here is cheap
+    // and amortized over every subsequent path translation.
+    if (hasRootIdentity && _data.numPairs > 0) {
+        // The root identity's source and target ('/') enclose every
+        // other pair's.
+        _sourcesNested = _targetsNested = true;
+    }
+    else {
+        for (PathPair const *i = begin; i != end; ++i) {
+            for (PathPair const *j = begin; j != end; ++j) {
+                if (i == j) {
+                    continue;
+                }
+                _sourcesNested = _sourcesNested ||
+                    (i->first != j->first &&
+                     j->first.HasPrefix(i->first));
+                _targetsNested = _targetsNested ||
+                    (i->second != j->second &&
+                     j->second.HasPrefix(i->second));
+            }
+        }
+    }
 }
 
 // Canonicalize pairs in-place by removing all redundant entries.  Redundant
@@ -255,6 +282,8 @@ PcpMapFunction::Swap(PcpMapFunction& map)
     using std::swap;
     swap(_data, map._data);
     swap(_offset, map._offset);
+    swap(_sourcesNested, map._sourcesNested);
+    swap(_targetsNested, map._targetsNested);
 }
 
 bool
@@ -274,7 +303,8 @@ _Map(const SdfPath& path,
      const PcpMapFunction::PathPair *pairs,
      const int numPairs,
      bool hasRootIdentity,
-     bool invert)
+     bool invert,
+     bool targetsNested)
 {
     // Note that we explicitly do not fix target paths here. This
     // is for consistency, so that consumers can be certain of
@@ -346,14 +376,13 @@ _Map(const SdfPath& path,
     // For examples, see test case for bug 74847 and bug 112645 in 
     // testPcpMapFunction.
     //
-    // XXX: It seems inefficient to have to do this check every time
-    //      we do a path mapping. I think it might be possible to figure
-    //      out the 'disallowed' mappings and mark them in the mapping
-    //      in PcpMapFunction's c'tor. That would let us get rid of this 
-    //      code. Figuring out the 'disallowed' mappings might be
-    //      expensive though, possibly O(n^2) where n is the number of
-    //      paths in the mapping.
-    //
+    // A more-specific reverse mapping can only exist if some mapping's
+    // target encloses another's; PcpMapFunction's c'tor precomputes
+    // whether that is the case so the check can be skipped outright for
+    // the (common) functions with disjoint targets.
+    if (!targetsNested) {
+        return result;
+    }
 
     // Optimistically assume the same mapping will be the best;
     // we can skip even considering any mapping that is shorter.
@@ -376,14 +405,16 @@ SdfPath
 PcpMapFunction::MapSourceToTarget(const SdfPath & path) const
 {
     return _Map(path, _data.begin(), _data.numPairs, _data.hasRootIdentity,
-                /* invert */ false);
+                /* invert */ false, _targetsNested);
 }
 
 SdfPath
 PcpMapFunction::MapTargetToSource(const SdfPath & path) const
 {
+    // When inverting, the sources play the role of the targets in the
+    // invertibility check.
     return _Map(path, _data.begin(), _data.numPairs, _data.hasRootIdentity,
-                /* invert */ true);
+                /* invert */ true, _sourcesNested);
 }
 
 PcpMapFunction
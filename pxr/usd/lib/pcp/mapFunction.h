@@ -289,6 +289,15 @@ private:
 
     _Data _data;
     SdfLayerOffset _offset;
+
+    // Derived at construction: true if some pair's source (resp. target)
+    // path properly encloses another pair's source (target), including
+    // the root identity mapping.  Only then can mapping a path produce a
+    // result that a more-specific reverse mapping would claim, so when
+    // the flag for a direction is false the per-call invertibility check
+    // can be skipped when mapping in that direction.
+    bool _sourcesNested = false;
+    bool _targetsNested = false;
 };
 
 // Specialize hash_value for PcpMapFunction.
@@ -281,6 +281,7 @@ public:
 
 private:
     friend class PcpPrimIndex_Graph;
+    friend class Pcp_PrimIndexCacheIO;
     friend class PcpNodeIterator;
     friend class PcpNodeRef_ChildrenIterator;
     friend class PcpNodeRef_ChildrenReverseIterator;
@@ -253,6 +253,7 @@ public:
 private:
     friend class PcpPrimIterator;
     friend struct Pcp_PrimIndexer;
+    friend class Pcp_PrimIndexCacheIO;
     friend void Pcp_RescanForSpecs(PcpPrimIndex*, bool usd,
                                    bool updateHasSpecs);
 
@@ -0,0 +1,774 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/usd/pcp/primIndexCacheIO.h"
+
+#include "pxr/usd/pcp/arc.h"
+#include "pxr/usd/pcp/cache.h"
+#include "pxr/usd/pcp/debugCodes.h"
+#include "pxr/usd/pcp/dependencies.h"
+#include "pxr/usd/pcp/layerStack.h"
+#include "pxr/usd/pcp/layerStackIdentifier.h"
+#include "pxr/usd/pcp/mapExpression.h"
+#include "pxr/usd/pcp/mapFunction.h"
+#include "pxr/usd/pcp/node.h"
+#include "pxr/usd/pcp/primIndex.h"
+#include "pxr/usd/pcp/primIndex_Graph.h"
+#include "pxr/usd/pcp/site.h"
+
+#include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/sdf/layerOffset.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/base/js/json.h"
+#include "pxr/base/tf/atomicOfstreamWrapper.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/trace/trace.h"
+#include "pxr/base/vt/value.h"
+
+#include <boost/get_pointer.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Bump this version whenever the file layout changes; files with any other
+// version are ignored.
+const int _FormatVersion = 2;
+
+// Extraction helpers.  These all return false on missing keys or type
+// mismatches so that a corrupt or truncated file is rejected rather than
+// partially applied.
+
+bool
+_Get(const JsObject &obj, const char *key, const JsValue **value)
+{
+    JsObject::const_iterator i = obj.find(key);
+    if (i == obj.end()) {
+        return false;
+    }
+    *value = &i->second;
+    return true;
+}
+
+bool
+_GetInt(const JsObject &obj, const char *key, int *result)
+{
+    const JsValue *v;
+    if (!_Get(obj, key, &v) || !v->IsInt()) {
+        return false;
+    }
+    *result = v->GetInt();
+    return true;
+}
+
+bool
+_GetBool(const JsObject &obj, const char *key, bool *result)
+{
+    const JsValue *v;
+    if (!_Get(obj, key, &v) || !v->IsBool()) {
+        return false;
+    }
+    *result = v->GetBool();
+    return true;
+}
+
+bool
+_GetDouble(const JsObject &obj, const char *key, double *result)
+{
+    const JsValue *v;
+    if (!_Get(obj, key, &v) || !(v->IsReal() || v->IsInt())) {
+        return false;
+    }
+    *result = v->GetReal();
+    return true;
+}
+
+bool
+_GetString(const JsObject &obj, const char *key, std::string *result)
+{
+    const JsValue *v;
+    if (!_Get(obj, key, &v) || !v->IsString()) {
+        return false;
+    }
+    *result = v->GetString();
+    return true;
+}
+
+bool
+_GetArray(const JsObject &obj, const char *key, const JsArray **result)
+{
+    const JsValue *v;
+    if (!_Get(obj, key, &v) || !v->IsArray()) {
+        return false;
+    }
+    *result = &v->GetJsArray();
+    return true;
+}
+
+bool
+_GetObject(const JsObject &obj, const char *key, const JsObject **result)
+{
+    const JsValue *v;
+    if (!_Get(obj, key, &v) || !v->IsObject()) {
+        return false;
+    }
+    *result = &v->GetJsObject();
+    return true;
+}
+
+// Returns the modification timestamp for \p layer, or false if the
+// resolver does not provide a comparable timestamp for it.
+bool
+_GetLayerTimestamp(const SdfLayerHandle &layer, double *timestamp)
+{
+    const VtValue t = ArGetResolver().GetModificationTimestamp(
+        layer->GetIdentifier(), layer->GetRealPath());
+    if (!t.IsHolding<double>()) {
+        return false;
+    }
+    *timestamp = t.UncheckedGet<double>();
+    return true;
+}
+
+} // anonymous namespace
+
+class Pcp_PrimIndexCacheIO::_LayerStackTable
+{
+public:
+    size_t GetOrAddIndex(const PcpLayerStackRefPtr &layerStack) {
+        std::pair<_Map::iterator, bool> result =
+            _map.insert(std::make_pair(layerStack, _stacks.size()));
+        if (result.second) {
+            _stacks.push_back(layerStack);
+        }
+        return result.first->second;
+    }
+
+    const std::vector<PcpLayerStackRefPtr> &GetStacks() const {
+        return _stacks;
+    }
+
+private:
+    typedef std::map<PcpLayerStackRefPtr, size_t> _Map;
+    _Map _map;
+    std::vector<PcpLayerStackRefPtr> _stacks;
+};
+
+namespace {
+
+// Serialize the map function evaluated from \p exp into \p node.
+void
+_SerializeMapToParent(const PcpMapExpression &exp, JsObject *node)
+{
+    const PcpMapFunction function = exp.Evaluate();
+
+    const SdfLayerOffset &offset = function.GetTimeOffset();
+    JsArray offsetArray;
+    offsetArray.push_back(JsValue(offset.GetOffset()));
+    offsetArray.push_back(JsValue(offset.GetScale()));
+    (*node)["TimeOffset"] = JsValue(std::move(offsetArray));
+
+    if (!function.IsIdentity()) {
+        JsArray pathMap;
+        for (const auto &sourceAndTarget :
+                 function.GetSourceToTargetMap()) {
+            JsArray pair;
+            pair.push_back(JsValue(sourceAndTarget.first.GetString()));
+            pair.push_back(JsValue(sourceAndTarget.second.GetString()));
+            pathMap.push_back(JsValue(std::move(pair)));
+        }
+        (*node)["PathMap"] = JsValue(std::move(pathMap));
+    }
+}
+
+bool
+_DeserializeMapToParent(const JsObject &node, PcpMapExpression *exp)
+{
+    const JsArray *offsetArray;
+    if (!_GetArray(node, "TimeOffset", &offsetArray) ||
+        offsetArray->size() != 2 ||
+        !((*offsetArray)[0].IsReal() || (*offsetArray)[0].IsInt()) ||
+        !((*offsetArray)[1].IsReal() || (*offsetArray)[1].IsInt())) {
+        return false;
+    }
+    const SdfLayerOffset offset(
+        (*offsetArray)[0].GetReal(), (*offsetArray)[1].GetReal());
+
+    JsObject::const_iterator pathMapIt = node.find("PathMap");
+    if (pathMapIt == node.end()) {
+        *exp = PcpMapExpression::Identity();
+        return true;
+    }
+
+    if (!pathMapIt->second.IsArray()) {
+        return false;
+    }
+    PcpMapFunction::PathMap pathMap;
+    for (const JsValue &pairValue : pathMapIt->second.GetJsArray()) {
+        if (!pairValue.IsArray()) {
+            return false;
+        }
+        const JsArray &pair = pairValue.GetJsArray();
+        if (pair.size() != 2 || !pair[0].IsString() || !pair[1].IsString()) {
+            return false;
+        }
+        pathMap[SdfPath(pair[0].GetString())] = SdfPath(pair[1].GetString());
+    }
+
+    const PcpMapFunction function = PcpMapFunction::Create(pathMap, offset);
+    if (function.IsNull()) {
+        return false;
+    }
+    *exp = PcpMapExpression::Constant(function);
+    return true;
+}
+
+} // anonymous namespace
+
+// Serialize \p index into \p result.  Returns false if the index cannot be
+// represented in the cache file.
+bool
+Pcp_PrimIndexCacheIO::_SerializePrimIndex(const PcpPrimIndex &index,
+                                          _LayerStackTable *layerStacks,
+                                          JsObject *result)
+{
+    // Gather the nodes in graph storage order.  In that order a node's
+    // parent and origin always precede it, since both must exist before
+    // the node can be inserted.
+    std::vector<PcpNodeRef> nodes;
+    for (const PcpNodeRef &node : index.GetNodeRange()) {
+        const size_t nodeIdx = node._GetNodeIndex();
+        if (nodeIdx >= nodes.size()) {
+            nodes.resize(nodeIdx + 1);
+        }
+        nodes[nodeIdx] = node;
+    }
+
+    JsArray nodeArray;
+    for (size_t i = 0; i != nodes.size(); ++i) {
+        const PcpNodeRef &node = nodes[i];
+        if (!node) {
+            // Node indices should be contiguous in a finalized graph.
+            return false;
+        }
+
+        JsObject n;
+        n["LayerStack"] = JsValue(static_cast<int>(
+            layerStacks->GetOrAddIndex(node.GetLayerStack())));
+        n["Path"] = JsValue(node.GetPath().GetString());
+
+        if (i != 0) {
+            const size_t parentIdx = node.GetParentNode()._GetNodeIndex();
+            const size_t originIdx = node.GetOriginNode()._GetNodeIndex();
+            if (parentIdx >= i || originIdx >= i) {
+                return false;
+            }
+            n["ArcType"] = JsValue(static_cast<int>(node.GetArcType()));
+            n["Parent"] = JsValue(static_cast<int>(parentIdx));
+            n["Origin"] = JsValue(static_cast<int>(originIdx));
+            n["SiblingNumAtOrigin"] =
+                JsValue(node.GetSiblingNumAtOrigin());
+            n["NamespaceDepth"] = JsValue(node.GetNamespaceDepth());
+            _SerializeMapToParent(node.GetMapToParent(), &n);
+        }
+
+        // Node flags.  HasSpecs is not recorded; it is recomputed from the
+        // layers when the index is restored.
+        if (node.IsInert()) {
+            n["Inert"] = JsValue(true);
+        }
+        if (node.IsCulled()) {
+            n["Culled"] = JsValue(true);
+        }
+        if (node.IsRestricted()) {
+            n["Restricted"] = JsValue(true);
+        }
+        if (node.HasSymmetry()) {
+            n["HasSymmetry"] = JsValue(true);
+        }
+        if (node.GetPermission() != SdfPermissionPublic) {
+            n["Permission"] =
+                JsValue(static_cast<int>(node.GetPermission()));
+        }
+
+        nodeArray.push_back(JsValue(std::move(n)));
+    }
+
+    (*result)["Path"] = JsValue(index.GetPath().GetString());
+    (*result)["Nodes"] = JsValue(std::move(nodeArray));
+    if (index.HasAnyPayloads()) {
+        (*result)["HasPayloads"] = JsValue(true);
+    }
+    if (index.IsInstanceable()) {
+        (*result)["Instanceable"] = JsValue(true);
+    }
+    return true;
+}
+
+// Rebuild a prim index from \p record.  Returns false and leaves \p index
+// untouched on any inconsistency.
+bool
+Pcp_PrimIndexCacheIO::_DeserializePrimIndex(
+    const JsObject &record,
+    const std::vector<PcpLayerStackRefPtr> &layerStacks,
+    bool usd,
+    SdfPath *path,
+    PcpPrimIndex *index)
+{
+    std::string pathString;
+    const JsArray *nodeArray;
+    if (!_GetString(record, "Path", &pathString) ||
+        !_GetArray(record, "Nodes", &nodeArray) ||
+        nodeArray->empty()) {
+        return false;
+    }
+    *path = SdfPath(pathString);
+
+    PcpPrimIndex_GraphRefPtr graph;
+    std::vector<PcpNodeRef> nodes;
+    nodes.reserve(nodeArray->size());
+
+    for (size_t i = 0; i != nodeArray->size(); ++i) {
+        if (!(*nodeArray)[i].IsObject()) {
+            return false;
+        }
+        const JsObject &n = (*nodeArray)[i].GetJsObject();
+
+        int layerStackIdx;
+        std::string sitePathString;
+        if (!_GetInt(n, "LayerStack", &layerStackIdx) ||
+            layerStackIdx < 0 ||
+            static_cast<size_t>(layerStackIdx) >= layerStacks.size() ||
+            !_GetString(n, "Path", &sitePathString)) {
+            return false;
+        }
+        const PcpLayerStackSite site(
+            layerStacks[layerStackIdx], SdfPath(sitePathString));
+
+        PcpNodeRef node;
+        if (i == 0) {
+            graph = PcpPrimIndex_Graph::New(site, usd);
+            node = PcpNodeRef(boost::get_pointer(graph), 0);
+        }
+        else {
+            int arcType, parentIdx, originIdx;
+            PcpArc arc;
+            if (!_GetInt(n, "ArcType", &arcType) ||
+                !_GetInt(n, "Parent", &parentIdx) ||
+                !_GetInt(n, "Origin", &originIdx) ||
+                !_GetInt(n, "SiblingNumAtOrigin", &arc.siblingNumAtOrigin) ||
+                !_GetInt(n, "NamespaceDepth", &arc.namespaceDepth) ||
+                !_DeserializeMapToParent(n, &arc.mapToParent) ||
+                parentIdx < 0 || static_cast<size_t>(parentIdx) >= i ||
+                originIdx < 0 || static_cast<size_t>(originIdx) >= i ||
+                arcType <= PcpArcTypeRoot || arcType >= PcpNumArcTypes) {
+                return false;
+            }
+            arc.type = static_cast<PcpArcType>(arcType);
+            arc.parent = nodes[parentIdx];
+            arc.origin = nodes[originIdx];
+            node = graph->InsertChildNode(nodes[parentIdx], site, arc);
+            if (!node) {
+                return false;
+            }
+        }
+
+        bool inert = false, culled = false, restricted = false,
+            hasSymmetry = false;
+        int permission = SdfPermissionPublic;
+        _GetBool(n, "Inert", &inert);
+        _GetBool(n, "Culled", &culled);
+        _GetBool(n, "Restricted", &restricted);
+        _GetBool(n, "HasSymmetry", &hasSymmetry);
+        _GetInt(n, "Permission", &permission);
+
+        // IsInert() reports inert-or-culled, so only restore the inert
+        // flag on nodes that are not culled; the observable state is the
+        // same either way.
+        node.SetCulled(culled);
+        node.SetInert(inert && !culled);
+        node.SetRestricted(restricted);
+        node.SetHasSymmetry(hasSymmetry);
+        if (permission != SdfPermissionPublic) {
+            node.SetPermission(static_cast<SdfPermission>(permission));
+        }
+
+        nodes.push_back(node);
+    }
+
+    bool hasPayloads = false, instanceable = false;
+    _GetBool(record, "HasPayloads", &hasPayloads);
+    _GetBool(record, "Instanceable", &instanceable);
+    graph->SetHasPayloads(hasPayloads);
+    graph->SetIsInstanceable(instanceable);
+    graph->Finalize();
+
+    index->_graph = graph;
+    Pcp_RescanForSpecs(index, usd, /*updateHasSpecs=*/true);
+    return true;
+}
+
+bool
+Pcp_PrimIndexCacheIO::Write(const PcpCache &cache, const std::string &path)
+{
+    TRACE_FUNCTION();
+
+    // Muting and session opinions affect composition in ways the file does
+    // not record.
+    if (!cache.GetMutedLayers().empty()) {
+        return false;
+    }
+    const SdfLayerHandle sessionLayer =
+        cache.GetLayerStackIdentifier().sessionLayer;
+    if (sessionLayer && !sessionLayer->IsEmpty()) {
+        return false;
+    }
+    const SdfLayerHandle rootLayer = cache.GetLayerStackIdentifier().rootLayer;
+    if (!rootLayer || rootLayer->IsAnonymous()) {
+        return false;
+    }
+
+    // Serialize the prim indexes, ancestors before descendants so that
+    // reading can restore them in dependency order.
+    std::vector<std::pair<SdfPath, const PcpPrimIndex *>> indexes;
+    for (const auto &pathAndIndex : cache._primIndexCache) {
+        if (pathAndIndex.second.IsValid()) {
+            indexes.push_back(
+                std::make_pair(pathAndIndex.first, &pathAndIndex.second));
+        }
+    }
+    std::sort(indexes.begin(), indexes.end(),
+              [](const std::pair<SdfPath, const PcpPrimIndex *> &a,
+                 const std::pair<SdfPath, const PcpPrimIndex *> &b) {
+                  const size_t na = a.first.GetPathElementCount();
+                  const size_t nb = b.first.GetPathElementCount();
+                  return na != nb ? na < nb : a.first < b.first;
+              });
+
+    _LayerStackTable layerStacks;
+    JsArray primIndexes;
+    for (const auto &pathAndIndex : indexes) {
+        if (!pathAndIndex.second->GetLocalErrors().empty()) {
+            return false;
+        }
+        JsObject record;
+        if (!_SerializePrimIndex(
+                *pathAndIndex.second, &layerStacks, &record)) {
+            return false;
+        }
+        primIndexes.push_back(JsValue(std::move(record)));
+    }
+
+    // Serialize the layer stack table and collect the set of contributing
+    // layers for validation.  The (empty) session layer is the only
+    // anonymous layer permitted; it is re-established from the cache's own
+    // identifier when the file is read.
+    JsArray layerStackArray;
+    std::map<std::string, double> layerTimestamps;
+    for (const PcpLayerStackRefPtr &layerStack : layerStacks.GetStacks()) {
+        const PcpLayerStackIdentifier &identifier =
+            layerStack->GetIdentifier();
+        if (identifier.sessionLayer &&
+            identifier.sessionLayer != sessionLayer) {
+            return false;
+        }
+        if (!identifier.rootLayer || identifier.rootLayer->IsAnonymous()) {
+            return false;
+        }
+
+        JsObject record;
+        record["RootLayer"] = JsValue(identifier.rootLayer->GetIdentifier());
+        if (identifier.sessionLayer) {
+            record["HasSessionLayer"] = JsValue(true);
+        }
+        layerStackArray.push_back(JsValue(std::move(record)));
+
+        for (const SdfLayerRefPtr &layer : layerStack->GetLayers()) {
+            if (layer == sessionLayer) {
+                continue;
+            }
+            if (layer->IsAnonymous()) {
+                return false;
+            }
+            double timestamp;
+            if (!_GetLayerTimestamp(layer, &timestamp)) {
+                return false;
+            }
+            layerTimestamps[layer->GetIdentifier()] = timestamp;
+        }
+    }
+
+    JsArray layerArray;
+    for (const auto &identifierAndTimestamp : layerTimestamps) {
+        JsObject record;
+        record["Identifier"] = JsValue(identifierAndTimestamp.first);
+        record["Timestamp"] = JsValue(identifierAndTimestamp.second);
+        layerArray.push_back(JsValue(std::move(record)));
+    }
+
+    // Record the payload inclusion set and variant fallbacks the indexes
+    // were composed under.  These are validated, not applied, when the
+    // file is read: a consuming cache with a different load set or
+    // different fallbacks would compose different indexes.
+    JsArray includedPayloads;
+    {
+        SdfPathVector paths(cache._includedPayloads.begin(),
+                            cache._includedPayloads.end());
+        std::sort(paths.begin(), paths.end());
+        for (const SdfPath &payloadPath : paths) {
+            includedPayloads.push_back(JsValue(payloadPath.GetString()));
+        }
+    }
+
+    JsObject variantFallbacks;
+    for (const auto &setAndVariants : cache._variantFallbackMap) {
+        JsArray variants;
+        for (const std::string &variant : setAndVariants.second) {
+            variants.push_back(JsValue(variant));
+        }
+        variantFallbacks[setAndVariants.first] = JsValue(std::move(variants));
+    }
+
+    JsObject top;
+    top["Version"] = JsValue(_FormatVersion);
+    top["RootLayer"] = JsValue(rootLayer->GetIdentifier());
+    top["HasSessionLayer"] = JsValue(static_cast<bool>(sessionLayer));
+    top["Layers"] = JsValue(std::move(layerArray));
+    top["LayerStacks"] = JsValue(std::move(layerStackArray));
+    top["PrimIndexes"] = JsValue(std::move(primIndexes));
+    top["IncludedPayloads"] = JsValue(std::move(includedPayloads));
+    top["VariantFallbacks"] = JsValue(std::move(variantFallbacks));
+
+    TfAtomicOfstreamWrapper wrapper(path);
+    std::string reason;
+    if (!wrapper.Open(&reason)) {
+        TF_DEBUG(PCP_PRIM_INDEX).Msg(
+            "Could not open prim index cache file '%s' for writing: %s\n",
+            path.c_str(), reason.c_str());
+        return false;
+    }
+    JsWriteToStream(JsValue(std::move(top)), wrapper.GetStream());
+    return wrapper.Commit(&reason);
+}
+
+bool
+Pcp_PrimIndexCacheIO::Read(PcpCache *cache, const std::string &path)
+{
+    TRACE_FUNCTION();
+
+    if (!cache->GetMutedLayers().empty()) {
+        return false;
+    }
+
+    std::ifstream stream(path.c_str());
+    if (!stream) {
+        return false;
+    }
+    JsParseError error;
+    const JsValue topValue = JsParseStream(stream, &error);
+    if (!topValue.IsObject()) {
+        TF_DEBUG(PCP_PRIM_INDEX).Msg(
+            "Ignoring prim index cache file '%s': parse error at "
+            "%d:%d: %s\n",
+            path.c_str(), error.line, error.column, error.reason.c_str());
+        return false;
+    }
+    const JsObject &top = topValue.GetJsObject();
+
+    // Validate the header against this cache.
+    int version;
+    std::string rootLayerId;
+    bool hasSessionLayer;
+    if (!_GetInt(top, "Version", &version) || version != _FormatVersion ||
+        !_GetString(top, "RootLayer", &rootLayerId) ||
+        !_GetBool(top, "HasSessionLayer", &hasSessionLayer)) {
+        return false;
+    }
+    const SdfLayerHandle rootLayer = cache->GetLayerStackIdentifier().rootLayer;
+    const SdfLayerHandle sessionLayer =
+        cache->GetLayerStackIdentifier().sessionLayer;
+    if (!rootLayer || rootLayer->GetIdentifier() != rootLayerId ||
+        static_cast<bool>(sessionLayer) != hasSessionLayer ||
+        (sessionLayer && !sessionLayer->IsEmpty())) {
+        return false;
+    }
+
+    // Validate the recorded payload inclusion set and variant fallbacks
+    // against this cache.  The recorded indexes were composed under those
+    // inputs; a cache configured with different ones must recompose.
+    const JsArray *includedPayloads;
+    if (!_GetArray(top, "IncludedPayloads", &includedPayloads)) {
+        return false;
+    }
+    PcpCache::PayloadSet recordedPayloads;
+    for (const JsValue &payloadValue : *includedPayloads) {
+        if (!payloadValue.IsString()) {
+            return false;
+        }
+        recordedPayloads.insert(SdfPath(payloadValue.GetString()));
+    }
+    if (recordedPayloads != cache->_includedPayloads) {
+        TF_DEBUG(PCP_PRIM_INDEX).Msg(
+            "Ignoring prim index cache file '%s': recorded payload "
+            "inclusion set does not match this cache\n", path.c_str());
+        return false;
+    }
+
+    const JsObject *variantFallbacks;
+    if (!_GetObject(top, "VariantFallbacks", &variantFallbacks)) {
+        return false;
+    }
+    PcpVariantFallbackMap recordedFallbacks;
+    for (const auto &setAndVariants : *variantFallbacks) {
+        if (!setAndVariants.second.IsArray()) {
+            return false;
+        }
+        std::vector<std::string> &variants =
+            recordedFallbacks[setAndVariants.first];
+        for (const JsValue &variant : setAndVariants.second.GetJsArray()) {
+            if (!variant.IsString()) {
+                return false;
+            }
+            variants.push_back(variant.GetString());
+        }
+    }
+    if (recordedFallbacks != cache->_variantFallbackMap) {
+        TF_DEBUG(PCP_PRIM_INDEX).Msg(
+            "Ignoring prim index cache file '%s': recorded variant "
+            "fallbacks do not match this cache\n", path.c_str());
+        return false;
+    }
+
+    // Validate the recorded layers.  Every layer must open and have an
+    // unchanged modification timestamp.
+    const JsArray *layerArray;
+    if (!_GetArray(top, "Layers", &layerArray)) {
+        return false;
+    }
+    for (const JsValue &layerValue : *layerArray) {
+        if (!layerValue.IsObject()) {
+            return false;
+        }
+        const JsObject &record = layerValue.GetJsObject();
+        std::string identifier;
+        double recordedTimestamp;
+        if (!_GetString(record, "Identifier", &identifier) ||
+            !_GetDouble(record, "Timestamp", &recordedTimestamp)) {
+            return false;
+        }
+        const SdfLayerRefPtr layer = SdfLayer::FindOrOpen(identifier);
+        double timestamp;
+        if (!layer || !_GetLayerTimestamp(layer, &timestamp) ||
+            timestamp != recordedTimestamp) {
+            TF_DEBUG(PCP_PRIM_INDEX).Msg(
+                "Ignoring prim index cache file '%s': layer '%s' is "
+                "missing or has changed\n", path.c_str(), identifier.c_str());
+            return false;
+        }
+    }
+
+    // Rebuild the layer stacks.
+    const JsArray *layerStackArray;
+    if (!_GetArray(top, "LayerStacks", &layerStackArray)) {
+        return false;
+    }
+    std::vector<PcpLayerStackRefPtr> layerStacks;
+    layerStacks.reserve(layerStackArray->size());
+    for (const JsValue &stackValue : *layerStackArray) {
+        if (!stackValue.IsObject()) {
+            return false;
+        }
+        const JsObject &record = stackValue.GetJsObject();
+        std::string stackRootLayerId;
+        if (!_GetString(record, "RootLayer", &stackRootLayerId)) {
+            return false;
+        }
+        bool usesSessionLayer = false;
+        _GetBool(record, "HasSessionLayer", &usesSessionLayer);
+
+        const SdfLayerRefPtr stackRootLayer =
+            SdfLayer::FindOrOpen(stackRootLayerId);
+        if (!stackRootLayer) {
+            return false;
+        }
+        PcpErrorVector errors;
+        const PcpLayerStackRefPtr layerStack = cache->ComputeLayerStack(
+            PcpLayerStackIdentifier(
+                stackRootLayer,
+                usesSessionLayer ? sessionLayer : SdfLayerHandle(),
+                cache->GetLayerStackIdentifier().pathResolverContext),
+            &errors);
+        if (!layerStack || !errors.empty()) {
+            return false;
+        }
+        layerStacks.push_back(layerStack);
+    }
+
+    // Rebuild the prim indexes into a scratch list first so that a corrupt
+    // entry leaves the cache untouched.
+    const JsArray *primIndexes;
+    if (!_GetArray(top, "PrimIndexes", &primIndexes)) {
+        return false;
+    }
+    std::vector<std::pair<SdfPath, PcpPrimIndex>> restored(
+        primIndexes->size());
+    for (size_t i = 0; i != primIndexes->size(); ++i) {
+        if (!(*primIndexes)[i].IsObject() ||
+            !_DeserializePrimIndex((*primIndexes)[i].GetJsObject(),
+                                   layerStacks, cache->IsUsd(),
+                                   &restored[i].first,
+                                   &restored[i].second)) {
+            return false;
+        }
+    }
+
+    // Publish.  Ancestors were written before descendants, preserving the
+    // ordering that dependency registration expects.
+    for (auto &pathAndIndex : restored) {
+        PcpPrimIndex &entry = cache->_primIndexCache[pathAndIndex.first];
+        if (!TF_VERIFY(!entry.IsValid(),
+                       "PrimIndex for %s already exists in cache",
+                       pathAndIndex.first.GetText())) {
+            continue;
+        }
+        entry.Swap(pathAndIndex.second);
+        cache->_primDependencies->Add(
+            entry, PcpDynamicFileFormatDependencyData());
+    }
+
+    TF_DEBUG(PCP_PRIM_INDEX).Msg(
+        "Restored %zu prim indexes from cache file '%s'\n",
+        restored.size(), path.c_str());
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
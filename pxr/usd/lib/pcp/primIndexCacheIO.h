@@ -0,0 +1,98 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef PCP_PRIM_INDEX_CACHE_IO_H
+#define PCP_PRIM_INDEX_CACHE_IO_H
+
+/// \file pcp/primIndexCacheIO.h
+
+#include "pxr/pxr.h"
+#include "pxr/usd/pcp/layerStack.h"
+#include "pxr/base/js/value.h"
+
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class PcpCache;
+class PcpPrimIndex;
+class SdfPath;
+
+/// \class Pcp_PrimIndexCacheIO
+///
+/// Reads and writes a PcpCache's opt-in on-disk prim index cache file.
+/// This is an internal class only meant for use by PcpCache.
+///
+/// The file records the node graph of every computed prim index along with
+/// the identifier and modification timestamp of every layer that
+/// contributed to composition.  A cache file is only valid for a cache
+/// whose layers all match the recorded timestamps; any mismatch causes the
+/// whole file to be ignored and the indexes to be recomposed as usual.
+///
+/// Some composition features cannot be captured in the file.  Caches with
+/// muted layers, with session layer opinions, with local composition
+/// errors, or with anonymous layers contributing opinions are not written.
+/// Dynamic file format dependency data is not recorded, so caches restored
+/// from a file will not invalidate correctly in response to attribute
+/// changes that affect dynamic payload arguments; this is acceptable for
+/// the intended read-only batch use.
+///
+class Pcp_PrimIndexCacheIO
+{
+public:
+    Pcp_PrimIndexCacheIO() = delete;
+
+    /// Write all prim indexes cached in \p cache to the file at \p path.
+    /// Returns false and writes nothing if any cached prim index cannot be
+    /// represented in the file.
+    static bool Write(const PcpCache &cache, const std::string &path);
+
+    /// Populate \p cache's prim index cache from the file at \p path.
+    /// Returns true if the file exists, validates against the current
+    /// state of the layers it records and against \p cache's payload
+    /// inclusion set and variant fallbacks, and all recorded prim indexes
+    /// were restored.  On failure the cache is left unmodified and prim
+    /// indexes are computed as usual.
+    static bool Read(PcpCache *cache, const std::string &path);
+
+private:
+    // Table assigning indices to the layer stacks referenced by
+    // serialized prim index nodes.
+    class _LayerStackTable;
+
+    static bool _SerializePrimIndex(const PcpPrimIndex &index,
+                                    _LayerStackTable *layerStacks,
+                                    JsObject *result);
+
+    static bool _DeserializePrimIndex(
+        const JsObject &record,
+        const std::vector<PcpLayerStackRefPtr> &layerStacks,
+        bool usd,
+        SdfPath *path,
+        PcpPrimIndex *index);
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PCP_PRIM_INDEX_CACHE_IO_H
@@ -30,6 +30,8 @@
 #include "pxr/usd/pcp/strengthOrdering.h"
 #include "pxr/usd/pcp/types.h"
 
+#include "pxr/usd/sdf/instantiatePool.h"
+
 #include "pxr/base/trace/trace.h"
 #include "pxr/base/tf/mallocTag.h"
 
@@ -39,6 +41,33 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 const size_t PcpPrimIndex_Graph::_Node::_invalidNodeIndex;
 
+// A PcpCache on a large stage holds one graph object per prim index.
+// Allocating them from a dedicated pool keeps these millions of small,
+// identically-sized allocations out of the general heap -- avoiding
+// allocator fragmentation -- and makes allocation and free a cheap
+// thread-local free-list operation.
+struct Pcp_PrimIndexGraphTag;
+using Pcp_PrimIndexGraphPool =
+    Sdf_Pool<Pcp_PrimIndexGraphTag,
+             sizeof(PcpPrimIndex_Graph), /*regionBits=*/8>;
+SDF_INSTANTIATE_POOL(Pcp_PrimIndexGraphTag,
+                     sizeof(PcpPrimIndex_Graph), /*regionBits=*/8);
+
+void *
+PcpPrimIndex_Graph::operator new(size_t size)
+{
+    TF_DEV_AXIOM(size == sizeof(PcpPrimIndex_Graph));
+    return Pcp_PrimIndexGraphPool::Allocate().GetPtr();
+}
+
+void
+PcpPrimIndex_Graph::operator delete(void *ptr)
+{
+    using PoolHandle = Pcp_PrimIndexGraphPool::Handle;
+    Pcp_PrimIndexGraphPool::Free(
+        PoolHandle::GetHandle(reinterpret_cast<char *>(ptr)));
+}
+
 ////////////////////////////////////////////////////////////
 
 struct PcpPrimIndex_Graph::_ArcStrengthOrder {
@@ -130,6 +159,8 @@ PcpPrimIndex_Graph::New(const PcpPrimIndex_GraphPtr& copy)
 PcpPrimIndex_Graph::PcpPrimIndex_Graph(const PcpLayerStackSite& rootSite,
                                        bool usd)
     : _data(new _SharedData(usd))
+    , _hasPayloads(false)
+    , _instanceable(false)
 {
     PcpArc rootArc;
     rootArc.type = PcpArcTypeRoot;
@@ -142,6 +173,8 @@ PcpPrimIndex_Graph::PcpPrimIndex_Graph(const PcpPrimIndex_Graph& rhs)
     : _data(rhs._data)
     , _nodeSitePaths(rhs._nodeSitePaths)
     , _nodeHasSpecs(rhs._nodeHasSpecs)
+    , _hasPayloads(rhs._hasPayloads)
+    , _instanceable(rhs._instanceable)
 {
     // There are no internal references to rhs in the nodes that we've
     // copied, so we don't need to do anything here.
@@ -156,31 +189,25 @@ PcpPrimIndex_Graph::IsUsd() const
 void 
 PcpPrimIndex_Graph::SetHasPayloads(bool hasPayloads)
 {
-    if (_data->hasPayloads != hasPayloads) {
-        _DetachSharedNodePool();
-        _data->hasPayloads = hasPayloads;
-    }
+    _hasPayloads = hasPayloads;
 }
 
 bool
 PcpPrimIndex_Graph::HasPayloads() const
 {
-    return _data->hasPayloads;
+    return _hasPayloads;
 }
 
 void 
 PcpPrimIndex_Graph::SetIsInstanceable(bool instanceable)
 {
-    if (_data->instanceable != instanceable) {
-        _DetachSharedNodePool();
-        _data->instanceable = instanceable;
-    }
+    _instanceable = instanceable;
 }
 
 bool
 PcpPrimIndex_Graph::IsInstanceable() const
 {
-    return _data->instanceable;
+    return _instanceable;
 }
 
 PcpNodeRef
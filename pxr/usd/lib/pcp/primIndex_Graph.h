@@ -36,6 +36,7 @@
 #include "pxr/base/arch/attributes.h"
 #include "pxr/base/tf/declarePtrs.h"
 #include "pxr/base/tf/refBase.h"
+#include "pxr/base/tf/smallVector.h"
 #include "pxr/base/tf/weakBase.h"
 
 #include <memory>
@@ -148,6 +149,12 @@ public:
         return PcpNodeRef(this, site.nodeIndex);
     }
 
+    // Graph objects are small, numerous, and identically sized, so they
+    // are allocated from a dedicated pool rather than the heap.  See
+    // primIndex_Graph.cpp.
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr);
+
 private:
     // Forward declarations for internal data structures.
     struct _Arc;
@@ -370,14 +377,16 @@ private:
         _SmallInts smallInts;
     };
 
-    typedef std::vector<_Node> _NodePool;
+    // The pool of nodes in a graph.  Most prim indexes are for leaf prims
+    // with no composition arcs, i.e. a single root node, so the node pool
+    // reserves local storage for one node to avoid a heap allocation in
+    // that common case.
+    typedef TfSmallVector<_Node, 1> _NodePool;
 
     struct _SharedData {
         _SharedData(bool usd_) 
             : finalized(false)
             , usd(usd_)
-            , hasPayloads(false)
-            , instanceable(false)
         { }
 
         // Pool of nodes for this graph. 
@@ -387,10 +396,6 @@ private:
         bool finalized:1;
         // Whether this prim index is composed in USD mode.
         bool usd:1;
-        // Whether this prim index has authored payloads.
-        bool hasPayloads:1;
-        // Whether this prim index is instanceable.
-        bool instanceable:1;
     };
 
     // Container of graph data. PcpPrimIndex_Graph implements a 
@@ -412,6 +417,14 @@ private:
     // to the composed prim. Elements in this vector correspond to nodes in
     // the shared node pool.
     std::vector<bool> _nodeHasSpecs;
+
+    // Whether this prim index has an authored payload and whether it is
+    // instanceable.  These describe the prim index that owns this graph
+    // instance rather than the shared node pool -- e.g. a graph cloned
+    // from an ancestor index resets them -- so they are stored here to
+    // keep such updates from detaching the shared pool.
+    bool _hasPayloads:1;
+    bool _instanceable:1;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
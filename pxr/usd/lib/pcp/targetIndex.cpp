@@ -36,10 +36,13 @@
 #include "pxr/usd/sdf/types.h"
 
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
 
 #include <boost/optional.hpp>
 
+#include <algorithm>
 #include <functional>
+#include <numeric>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -543,4 +546,84 @@ PcpBuildTargetIndex(
         targetIndex, allErrors );
 }
 
+void
+PcpBuildTargetIndexesInParallel(
+    const PcpCache& cache,
+    const std::vector<std::pair<SdfPath, SdfSpecType>>& properties,
+    std::vector<PcpTargetIndex>* targetIndexes,
+    PcpErrorVector* allErrors)
+{
+    TRACE_FUNCTION();
+
+    targetIndexes->clear();
+    targetIndexes->resize(properties.size());
+
+    // Group the requested properties by owning prim so that each task
+    // looks up the prim index once and shares it across all of that
+    // prim's properties.
+    std::vector<size_t> order(properties.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+        [&properties](size_t a, size_t b) {
+            return SdfPath::FastLessThan()(
+                properties[a].first.GetPrimPath(),
+                properties[b].first.GetPrimPath());
+        });
+
+    std::vector<std::pair<size_t, size_t>> groups;
+    for (size_t i = 0; i != order.size(); ) {
+        const SdfPath primPath = properties[order[i]].first.GetPrimPath();
+        size_t j = i + 1;
+        while (j != order.size() &&
+               properties[order[j]].first.GetPrimPath() == primPath) {
+            ++j;
+        }
+        groups.emplace_back(i, j);
+        i = j;
+    }
+
+    // Errors that are not local to a single target index are collected
+    // per property and merged below, since allErrors is unsynchronized.
+    std::vector<PcpErrorVector> otherErrors(properties.size());
+
+    const PcpLayerStackIdentifier& layerStackId =
+        cache.GetLayerStackIdentifier();
+
+    WorkParallelForN(groups.size(),
+        [&cache, &properties, &order, &groups, &otherErrors,
+         &layerStackId, targetIndexes](size_t begin, size_t end) {
+            for (size_t g = begin; g != end; ++g) {
+                const std::pair<size_t, size_t>& group = groups[g];
+                const SdfPath primPath =
+                    properties[order[group.first]].first.GetPrimPath();
+                const PcpPrimIndex* primIndex =
+                    cache.FindPrimIndex(primPath);
+                if (!primIndex) {
+                    // The owning prim's index has not been computed;
+                    // leave the target indexes empty.
+                    continue;
+                }
+                for (size_t i = group.first; i != group.second; ++i) {
+                    const size_t propIdx = order[i];
+                    const SdfPath& propPath = properties[propIdx].first;
+                    const SdfSpecType specType = properties[propIdx].second;
+
+                    PcpErrorVector* errors = &otherErrors[propIdx];
+                    PcpPropertyIndex propIndex;
+                    PcpBuildPrimPropertyIndex(
+                        propPath, cache, *primIndex, &propIndex, errors);
+
+                    const PcpSite propSite(layerStackId, propPath);
+                    PcpBuildTargetIndex(
+                        propSite, propIndex, specType,
+                        &(*targetIndexes)[propIdx], errors);
+                }
+            }
+        });
+
+    for (const PcpErrorVector& errors : otherErrors) {
+        allErrors->insert(allErrors->end(), errors.begin(), errors.end());
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -30,6 +30,9 @@
 #include "pxr/usd/sdf/declareHandles.h"
 #include "pxr/usd/sdf/path.h"
 
+#include <utility>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 SDF_DECLARE_HANDLES(SdfSpec);
@@ -97,6 +100,31 @@ PcpBuildFilteredTargetIndex(
     PcpTargetIndex *targetIndex,
     PcpErrorVector *allErrors);
 
+/// Build target indexes for many relationship or attribute properties
+/// at once, in parallel.
+///
+/// \p properties pairs each property path with its spec type, which
+/// must be SdfSpecTypeRelationship or SdfSpecTypeAttribute.  Properties
+/// are grouped by owning prim so that each prim's index is looked up
+/// once and shared across its properties.  \p targetIndexes is resized
+/// to match \p properties, with each entry holding the target index for
+/// the corresponding property.
+///
+/// The prim indexes for the owning prims must already exist in \p cache;
+/// properties whose prim index has not been computed yield empty target
+/// indexes.  As with PcpBuildTargetIndex, the validation checks
+/// performed by PcpBuildFilteredTargetIndex are skipped.
+///
+/// \p allErrors will contain any errors encountered while
+/// performing this operation.
+PCP_API
+void
+PcpBuildTargetIndexesInParallel(
+    const PcpCache& cache,
+    const std::vector<std::pair<SdfPath, SdfSpecType>>& properties,
+    std::vector<PcpTargetIndex>* targetIndexes,
+    PcpErrorVector* allErrors);
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif // PCP_TARGET_INDEX_H
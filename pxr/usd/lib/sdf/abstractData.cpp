@@ -23,8 +23,14 @@
 //
 #include "pxr/pxr.h"
 #include "pxr/usd/sdf/abstractData.h"
+#include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
 
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <vector>
 #include <utility>
@@ -307,6 +313,88 @@ SdfAbstractData::VisitSpecs(SdfAbstractDataSpecVisitor* visitor) const
     }
 }
 
+void
+SdfAbstractData::VisitSpecsParallel(SdfAbstractDataSpecVisitor* visitor) const
+{
+    if (TF_VERIFY(visitor)) {
+        _VisitSpecsParallel(visitor);
+        visitor->Done(*this);
+    }
+}
+
+namespace {
+
+// Collects every spec path, for data implementations that cannot
+// partition their storage directly.
+struct _PathCollector : public SdfAbstractDataSpecVisitor
+{
+    virtual bool VisitSpec(
+        const SdfAbstractData& data, const SdfAbstractDataSpecId& id)
+    {
+        paths.push_back(id.GetFullSpecPath());
+        return true;
+    }
+
+    virtual void Done(const SdfAbstractData&)
+    {
+        // Do nothing
+    }
+
+    std::vector<SdfPath> paths;
+};
+
+} // anon
+
+void
+SdfAbstractData::_VisitSpecsParallel(SdfAbstractDataSpecVisitor* visitor) const
+{
+    TRACE_FUNCTION();
+
+    _PathCollector collector;
+    _VisitSpecs(&collector);
+
+    std::atomic<bool> stop(false);
+    WorkParallelForN(collector.paths.size(),
+        [this, visitor, &collector, &stop](size_t begin, size_t end) {
+            for (size_t i = begin; i != end && !stop; ++i) {
+                SdfAbstractDataSpecId id(&collector.paths[i]);
+                if (!visitor->VisitSpec(*this, id)) {
+                    stop = true;
+                }
+            }
+        });
+}
+
+size_t
+SdfAbstractData::GetSpecContentsHash(const SdfAbstractDataSpecId& id) const
+{
+    const SdfSpecType specType = GetSpecType(id);
+    if (specType == SdfSpecTypeUnknown) {
+        return 0;
+    }
+
+    size_t hash = static_cast<size_t>(specType);
+
+    // Fields are hashed in sorted order so the result does not depend on
+    // the storage order of any particular data implementation.
+    TfTokenVector fields = List(id);
+    std::sort(fields.begin(), fields.end());
+    for (const TfToken& field : fields) {
+        boost::hash_combine(hash, field);
+        const VtValue value = Get(id, field);
+        if (value.CanHash()) {
+            boost::hash_combine(hash, value.GetHash());
+        }
+        else {
+            // Unhashable value types (e.g. arrays) fall back to hashing
+            // their stringified representation.
+            boost::hash_combine(hash, TfStringify(value));
+        }
+    }
+
+    return hash;
+}
+
 std::type_info const &
 SdfAbstractData::GetTypeid(
     const SdfAbstractDataSpecId &id, const TfToken &fieldName) const
@@ -314,6 +402,33 @@ SdfAbstractData::GetTypeid(
     return Get(id, fieldName).GetTypeid();
 }
 
+void
+SdfAbstractData::GetFields(const SdfAbstractDataSpecId& id,
+                           const TfToken* fieldNames,
+                           VtValue* values,
+                           size_t numFields) const
+{
+    for (size_t i = 0; i != numFields; ++i) {
+        if (!Has(id, fieldNames[i], &values[i])) {
+            values[i] = VtValue();
+        }
+    }
+}
+
+void
+SdfAbstractData::GetFieldForPaths(const SdfPath* paths,
+                                  size_t numPaths,
+                                  const TfToken& fieldName,
+                                  VtValue* values) const
+{
+    for (size_t i = 0; i != numPaths; ++i) {
+        const SdfAbstractDataSpecId id(&paths[i]);
+        if (!Has(id, fieldName, &values[i])) {
+            values[i] = VtValue();
+        }
+    }
+}
+
 bool
 SdfAbstractData::HasDictKey(const SdfAbstractDataSpecId& id,
                             const TfToken &fieldName,
@@ -230,6 +230,27 @@ public:
     SDF_API
     void VisitSpecs(SdfAbstractDataSpecVisitor* visitor) const;
 
+    /// Visits every spec in this SdfAbstractData object with the given
+    /// \p visitor, invoking the visitor concurrently from multiple threads.
+    /// The visitor's VisitSpec() must be safe to call concurrently; Done()
+    /// is called once, after all visitation has completed.  The order in
+    /// which specs are visited is undefined.  Returning false from
+    /// VisitSpec() stops the visitation of further specs, but specs being
+    /// visited concurrently at that moment will still complete.
+    /// \sa SdfAbstractDataSpecVisitor
+    SDF_API
+    void VisitSpecsParallel(SdfAbstractDataSpecVisitor* visitor) const;
+
+    /// Return a hash of the contents of the spec at \p id: its spec type
+    /// and the names and values of all of its fields.  Returns zero if no
+    /// spec exists at \p id.  The hash is independent of how the data is
+    /// stored, so it may be compared between different SdfAbstractData
+    /// implementations; together with VisitSpecsParallel() this lets
+    /// differencing tools compare large layers spec-by-spec in parallel
+    /// without materializing field values for matching specs twice.
+    SDF_API
+    virtual size_t GetSpecContentsHash(const SdfAbstractDataSpecId& id) const;
+
     /// @}
 
     /// \name Field API
@@ -250,9 +271,33 @@ public:
     /// Return the value for the given \a id and \a fieldName. Returns an
     /// empty value if none is set.
     SDF_API
-    virtual VtValue Get(const SdfAbstractDataSpecId& id, 
+    virtual VtValue Get(const SdfAbstractDataSpecId& id,
                         const TfToken& fieldName) const = 0;
 
+    /// Fill \p values with the value of each of the \p numFields fields
+    /// named by \p fieldNames for the spec at \p id.  Fields with no value
+    /// produce an empty VtValue.
+    ///
+    /// The default implementation calls Has() once per field.  Derived
+    /// classes may override this to resolve all of the fields with a
+    /// single lookup of their internal storage.
+    SDF_API
+    virtual void GetFields(const SdfAbstractDataSpecId& id,
+                           const TfToken* fieldNames,
+                           VtValue* values,
+                           size_t numFields) const;
+
+    /// Fill \p values with the value of the field named \p fieldName for
+    /// the spec at each of the \p numPaths paths in \p paths.  Specs with
+    /// no value for the field produce an empty VtValue.
+    ///
+    /// The default implementation calls Has() once per path.
+    SDF_API
+    virtual void GetFieldForPaths(const SdfPath* paths,
+                                  size_t numPaths,
+                                  const TfToken& fieldName,
+                                  VtValue* values) const;
+
     /// Return the type of the value for \p fieldName on spec \p id.  If no such
     /// field exists, return typeid(void).  Derived classes may optionally
     /// override this for performance.  The base implementation is equivalent
@@ -418,6 +463,17 @@ protected:
     /// \sa SdfAbstractDataSpecVisitor
     SDF_API
     virtual void _VisitSpecs(SdfAbstractDataSpecVisitor* visitor) const = 0;
+
+    /// Visits every spec in this SdfAbstractData object with the given
+    /// \p visitor, invoking it concurrently from multiple threads.  This
+    /// method should \b not call \c Done() on the visitor.  The default
+    /// implementation collects every spec path through _VisitSpecs() and
+    /// then fans the visitation out over the collected paths; derived
+    /// classes whose storage can be partitioned directly should override
+    /// this to avoid the collection pass.
+    /// \sa SdfAbstractDataSpecVisitor
+    SDF_API
+    virtual void _VisitSpecsParallel(SdfAbstractDataSpecVisitor* visitor) const;
 };
 
 template <class T>
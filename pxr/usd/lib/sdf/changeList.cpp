@@ -123,6 +123,90 @@ std::ostream& operator<<(std::ostream &os, const SdfChangeList &cl)
 }
 // CODE_COVERAGE_ON
 
+void
+SdfChangeList::Entry::UnionWith(const Entry& other)
+{
+    // Union the flag bits.  The flags struct is zero-filled at
+    // construction, so a byte-wise OR unions each bit-field member.
+    unsigned char* dst = reinterpret_cast<unsigned char*>(&flags);
+    const unsigned char* src =
+        reinterpret_cast<const unsigned char*>(&other.flags);
+    for (size_t i = 0; i != sizeof(_Flags); ++i) {
+        dst[i] |= src[i];
+    }
+
+    // Avoid updating the stored old value if the info value has been
+    // previously changed.
+    TF_FOR_ALL(it, other.infoChanged) {
+        std::pair<InfoChangeMap::iterator, bool> insertStatus =
+            infoChanged.insert(*it);
+        if (!insertStatus.second) {
+            insertStatus.first->second.second = it->second.second;
+        }
+    }
+
+    subLayerChanges.insert(subLayerChanges.end(),
+        other.subLayerChanges.begin(), other.subLayerChanges.end());
+
+    if (oldPath.IsEmpty()) {
+        oldPath = other.oldPath;
+    }
+    if (oldIdentifier.empty()) {
+        oldIdentifier = other.oldIdentifier;
+    }
+}
+
+SdfChangeList::EntryList
+SdfChangeList::GetCoalescedSubtreeChanges() const
+{
+    // Find the prim paths where an entire subtree was added or removed.
+    SdfPathSet subtreeRoots;
+    TF_FOR_ALL(it, _entries) {
+        if (it->first.IsPrimOrPrimVariantSelectionPath() &&
+            (it->second.flags.didAddNonInertPrim ||
+             it->second.flags.didRemoveNonInertPrim)) {
+            subtreeRoots.insert(it->first);
+        }
+    }
+
+    // Keep only the outermost roots; paths sort with descendants
+    // immediately following their prefix, so we can erase each prefixed
+    // range in one pass.
+    {
+        SdfPathSet::iterator prefixIt = subtreeRoots.begin(),
+            end = subtreeRoots.end();
+        while (prefixIt != end) {
+            SdfPathSet::iterator first = prefixIt;
+            SdfPathSet::iterator last = ++first;
+            while (last != end && last->HasPrefix(*prefixIt)) {
+                ++last;
+            }
+            subtreeRoots.erase(first, last);
+            prefixIt = last;
+        }
+    }
+
+    // Fold each entry into its enclosing subtree root, if any.  Since no
+    // root is a prefix of another, the only candidate is the closest
+    // preceding root in path order.  Entries recording namespace edits
+    // are kept at their own paths so that per-path rename data is not
+    // lost in the union.
+    EntryList result;
+    TF_FOR_ALL(it, _entries) {
+        SdfPathSet::const_iterator rootIt =
+            subtreeRoots.upper_bound(it->first);
+        if (it->second.oldPath.IsEmpty() &&
+            rootIt != subtreeRoots.begin() &&
+            it->first.HasPrefix(*--rootIt)) {
+            result[*rootIt].UnionWith(it->second);
+        }
+        else {
+            result[it->first].UnionWith(it->second);
+        }
+    }
+    return result;
+}
+
 SdfChangeList::Entry const &
 SdfChangeList::GetEntry( const SdfPath & path ) const
 {
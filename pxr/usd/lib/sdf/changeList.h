@@ -166,6 +166,12 @@ public:
         };
 
         _Flags flags;
+
+        // Merge the changes recorded in \p other into this entry.  The
+        // change flags are unioned together; info changes keep the old
+        // value already recorded here, if any.  Used to coalesce the
+        // entries for an entire subtree into a single entry.
+        void UnionWith(const Entry& other);
     };
 
     /// Map of change entries at various paths in a layer.
@@ -174,6 +180,21 @@ public:
 public:
     const EntryList & GetEntryList() const { return _entries; }
 
+    /// Returns a coalesced, subtree-granular view of this change list.
+    ///
+    /// Every prim path where a non-inert prim spec was added or removed
+    /// becomes a subtree root, unless an ancestor path also qualifies;
+    /// the entries for all paths at or beneath a subtree root are folded
+    /// into a single entry at the root with their change flags unioned
+    /// together.  Entries not covered by any subtree root, and entries
+    /// recording namespace edits (which carry per-path rename data),
+    /// are returned unchanged.
+    ///
+    /// Consumers that invalidate at subtree granularity can process the
+    /// result in time proportional to the number of changed subtrees
+    /// rather than the number of changed specs.
+    SDF_API EntryList GetCoalescedSubtreeChanges() const;
+
     // Change accessors/mutators
     Entry const &GetEntry( const SdfPath & ) const;
 
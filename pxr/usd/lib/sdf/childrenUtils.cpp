@@ -39,6 +39,9 @@
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/ostreamMethods.h"
 
+#include <algorithm>
+#include <set>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 //
@@ -519,6 +522,136 @@ Sdf_ChildrenUtils<ChildPolicy>::MoveChildForBatchNamespaceEdit(
     return true;
 }
 
+template <class ChildPolicy>
+bool
+Sdf_ChildrenUtils<ChildPolicy>::MoveChildrenForBatchNamespaceEdit(
+    const SdfLayerHandle &layer,
+    const SdfPath &path,
+    const std::vector<typename ChildPolicy::ValueType>& values,
+    const std::vector<typename ChildPolicy::FieldType>& newNames)
+{
+    typedef typename ChildPolicy::FieldType FieldType;
+    const TfToken childrenKey = ChildPolicy::GetChildrenToken(path);
+
+    if (!TF_VERIFY(!values.empty() && values.size() == newNames.size())) {
+        return false;
+    }
+
+    // All of the values must share one old parent that is not the new
+    // parent;  the caller is responsible for grouping edits accordingly.
+    const SdfPath oldParentPath =
+        ChildPolicy::GetParentPath(values.front()->GetPath());
+    if (!TF_VERIFY(oldParentPath != path)) {
+        return false;
+    }
+    std::set<FieldType> movedKeys;
+    for (const auto& value : values) {
+        if (!TF_VERIFY(ChildPolicy::GetParentPath(value->GetPath()) ==
+                       oldParentPath)) {
+            return false;
+        }
+        movedKeys.insert(FieldType(ChildPolicy::GetKey(value)));
+    }
+
+    // Read each affected children list once.
+    const TfToken oldChildrenKey = ChildPolicy::GetChildrenToken(oldParentPath);
+    std::vector<FieldType> childNames =
+        layer->GetFieldAs<std::vector<FieldType> >(path, childrenKey);
+    std::vector<FieldType> oldSiblingNames =
+        layer->GetFieldAs<std::vector<FieldType> >(oldParentPath,
+                                                   oldChildrenKey);
+
+    // Use a change block to ensure all layer data manipulations below are
+    // treated atomically.
+    SdfChangeBlock block;
+
+    // Remove the moved names from the old parent's children, preserving
+    // the relative order of the names that remain.
+    oldSiblingNames.erase(
+        std::remove_if(oldSiblingNames.begin(), oldSiblingNames.end(),
+                       [&movedKeys](const FieldType& name) {
+                           return movedKeys.count(name);
+                       }),
+        oldSiblingNames.end());
+    if (oldSiblingNames.empty()) {
+        layer->EraseField(oldParentPath, oldChildrenKey);
+
+        // Notify the CleanupTracker that specs were removed from the old
+        // parent path so the old parent can be cleaned up if it is left
+        // inert.
+        if (SdfSpecHandle spec = layer->GetObjectAtPath(oldParentPath)) {
+            Sdf_CleanupTracker::GetInstance().AddSpecIfTracking(spec);
+        }
+    }
+    else {
+        layer->SetField(oldParentPath, oldChildrenKey, oldSiblingNames);
+    }
+
+    // Move the actual spec data and append the new names.
+    childNames.reserve(childNames.size() + newNames.size());
+    for (size_t i = 0, n = values.size(); i != n; ++i) {
+        layer->_MoveSpec(values[i]->GetPath(),
+                         _ComputeMovedPath<ChildPolicy>(path, newNames[i]));
+        childNames.push_back(newNames[i]);
+    }
+
+    // Update and set the _childNames vector.
+    layer->SetField(path, childrenKey, childNames);
+
+    return true;
+}
+
+template <class ChildPolicy>
+bool
+Sdf_ChildrenUtils<ChildPolicy>::RemoveChildrenForBatchNamespaceEdit(
+    const SdfLayerHandle &layer,
+    const SdfPath &path,
+    const std::vector<typename ChildPolicy::FieldType>& keys)
+{
+    typedef typename ChildPolicy::FieldType FieldType;
+    const TfToken childrenKey = ChildPolicy::GetChildrenToken(path);
+
+    std::vector<FieldType> childNames =
+        layer->GetFieldAs<std::vector<FieldType> >(path, childrenKey);
+
+    // Use a change block to ensure all layer data manipulations below are
+    // treated atomically.
+    SdfChangeBlock block;
+
+    const std::set<FieldType> removedKeys(keys.begin(), keys.end());
+    bool removedAny = false;
+    for (const FieldType& name : childNames) {
+        if (removedKeys.count(name)) {
+            layer->_DeleteSpec(ChildPolicy::GetChildPath(path, name));
+            removedAny = true;
+        }
+    }
+    if (!removedAny) {
+        return false;
+    }
+
+    childNames.erase(
+        std::remove_if(childNames.begin(), childNames.end(),
+                       [&removedKeys](const FieldType& name) {
+                           return removedKeys.count(name);
+                       }),
+        childNames.end());
+    if (childNames.empty()) {
+        layer->EraseField(path, childrenKey);
+    }
+    else {
+        layer->SetField(path, childrenKey, childNames);
+    }
+
+    // Notify the CleanupTracker that child specs were removed so that
+    // this spec can be cleaned up if it is left inert.
+    if (SdfSpecHandle spec = layer->GetObjectAtPath(path)) {
+        Sdf_CleanupTracker::GetInstance().AddSpecIfTracking(spec);
+    }
+
+    return true;
+}
+
 template <class ChildPolicy>
 bool
 Sdf_ChildrenUtils<ChildPolicy>::CanMoveChildForBatchNamespaceEdit(
@@ -129,6 +129,20 @@ public:
         const typename ChildPolicy::FieldType& newName,
         int index);
 
+    /// Move each spec in \p values to be a child of \p path with the
+    /// corresponding new name in \p newNames, appending the new names to
+    /// \p path's existing children.  Every value must currently have the
+    /// same parent, which must not be \p path.  This is equivalent to
+    /// calling MoveChildForBatchNamespaceEdit() for each value with index
+    /// \c SdfNamespaceEdit::AtEnd except each affected children list is
+    /// rewritten once instead of once per moved child.
+    SDF_API
+    static bool MoveChildrenForBatchNamespaceEdit(
+        const SdfLayerHandle &layer,
+        const SdfPath &path,
+        const std::vector<typename ChildPolicy::ValueType>& values,
+        const std::vector<typename ChildPolicy::FieldType>& newNames);
+
     /// Remove the child identified by \a key.
     SDF_API
     static bool RemoveChildForBatchNamespaceEdit(
@@ -139,6 +153,14 @@ public:
         return RemoveChild(layer, path, key);
     }
 
+    /// Remove the children identified by \p keys, rewriting \p path's
+    /// children list once instead of once per removed child.
+    SDF_API
+    static bool RemoveChildrenForBatchNamespaceEdit(
+        const SdfLayerHandle &layer,
+        const SdfPath &path,
+        const std::vector<typename ChildPolicy::FieldType>& keys);
+
     /// Returns \c true if \p value can be inserted as a child of \p path
     /// with the new name \p newName at the index \p index, otherwise
     /// returns \c false and sets \p whyNot.
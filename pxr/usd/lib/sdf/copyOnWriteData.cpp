@@ -0,0 +1,301 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/copyOnWriteData.h"
+#include "pxr/base/trace/trace.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Forwards VisitSpec calls to the wrapped visitor, reporting the wrapper
+// as the visited data object, and swallows Done() so that the inner
+// data's public VisitSpecs() does not invoke it a second time.
+class _ForwardingSpecVisitor : public SdfAbstractDataSpecVisitor
+{
+public:
+    _ForwardingSpecVisitor(const SdfAbstractData& owner,
+                           SdfAbstractDataSpecVisitor* wrapped)
+        : _owner(owner)
+        , _wrapped(wrapped)
+    { }
+
+    virtual bool VisitSpec(const SdfAbstractData& data,
+                           const SdfAbstractDataSpecId& id)
+    {
+        return _wrapped->VisitSpec(_owner, id);
+    }
+
+    virtual void Done(const SdfAbstractData& data)
+    {
+        // Do nothing -- the owner's VisitSpecs() calls Done() itself.
+    }
+
+private:
+    const SdfAbstractData& _owner;
+    SdfAbstractDataSpecVisitor* _wrapped;
+};
+
+} // anonymous namespace
+
+Sdf_CopyOnWriteData::Sdf_CopyOnWriteData(
+    const SdfAbstractDataRefPtr& data,
+    const SdfFileFormatConstPtr& fileFormat,
+    const SdfFileFormat::FileFormatArguments& args)
+    : _data(data)
+    , _fileFormat(fileFormat)
+    , _args(args)
+    , _detached(false)
+{
+}
+
+Sdf_CopyOnWriteData::~Sdf_CopyOnWriteData()
+{
+}
+
+void
+Sdf_CopyOnWriteData::_Detach()
+{
+    if (_detached) {
+        return;
+    }
+
+    TRACE_FUNCTION();
+
+    SdfAbstractDataRefPtr ownedData = _fileFormat->InitData(_args);
+    ownedData->CopyFrom(_data);
+    _data = ownedData;
+    _detached = true;
+}
+
+bool
+Sdf_CopyOnWriteData::StreamsData() const
+{
+    return _data->StreamsData();
+}
+
+void
+Sdf_CopyOnWriteData::CreateSpec(const SdfAbstractDataSpecId& id,
+                                SdfSpecType specType)
+{
+    _Detach();
+    _data->CreateSpec(id, specType);
+}
+
+bool
+Sdf_CopyOnWriteData::HasSpec(const SdfAbstractDataSpecId& id) const
+{
+    return _data->HasSpec(id);
+}
+
+void
+Sdf_CopyOnWriteData::EraseSpec(const SdfAbstractDataSpecId& id)
+{
+    _Detach();
+    _data->EraseSpec(id);
+}
+
+void
+Sdf_CopyOnWriteData::MoveSpec(const SdfAbstractDataSpecId& oldId,
+                              const SdfAbstractDataSpecId& newId)
+{
+    _Detach();
+    _data->MoveSpec(oldId, newId);
+}
+
+SdfSpecType
+Sdf_CopyOnWriteData::GetSpecType(const SdfAbstractDataSpecId& id) const
+{
+    return _data->GetSpecType(id);
+}
+
+size_t
+Sdf_CopyOnWriteData::GetSpecContentsHash(const SdfAbstractDataSpecId& id) const
+{
+    return _data->GetSpecContentsHash(id);
+}
+
+bool
+Sdf_CopyOnWriteData::Has(const SdfAbstractDataSpecId& id,
+                         const TfToken& fieldName,
+                         SdfAbstractDataValue* value) const
+{
+    return _data->Has(id, fieldName, value);
+}
+
+bool
+Sdf_CopyOnWriteData::Has(const SdfAbstractDataSpecId& id,
+                         const TfToken& fieldName,
+                         VtValue* value) const
+{
+    return _data->Has(id, fieldName, value);
+}
+
+VtValue
+Sdf_CopyOnWriteData::Get(const SdfAbstractDataSpecId& id,
+                         const TfToken& fieldName) const
+{
+    return _data->Get(id, fieldName);
+}
+
+void
+Sdf_CopyOnWriteData::GetFields(const SdfAbstractDataSpecId& id,
+                               const TfToken* fieldNames,
+                               VtValue* values,
+                               size_t numFields) const
+{
+    _data->GetFields(id, fieldNames, values, numFields);
+}
+
+void
+Sdf_CopyOnWriteData::GetFieldForPaths(const SdfPath* paths,
+                                      size_t numPaths,
+                                      const TfToken& fieldName,
+                                      VtValue* values) const
+{
+    _data->GetFieldForPaths(paths, numPaths, fieldName, values);
+}
+
+std::type_info const&
+Sdf_CopyOnWriteData::GetTypeid(const SdfAbstractDataSpecId& id,
+                               const TfToken& fieldName) const
+{
+    return _data->GetTypeid(id, fieldName);
+}
+
+void
+Sdf_CopyOnWriteData::Set(const SdfAbstractDataSpecId& id,
+                         const TfToken& fieldName,
+                         const VtValue& value)
+{
+    _Detach();
+    _data->Set(id, fieldName, value);
+}
+
+void
+Sdf_CopyOnWriteData::Set(const SdfAbstractDataSpecId& id,
+                         const TfToken& fieldName,
+                         const SdfAbstractDataConstValue& value)
+{
+    _Detach();
+    _data->Set(id, fieldName, value);
+}
+
+void
+Sdf_CopyOnWriteData::Erase(const SdfAbstractDataSpecId& id,
+                           const TfToken& fieldName)
+{
+    _Detach();
+    _data->Erase(id, fieldName);
+}
+
+std::vector<TfToken>
+Sdf_CopyOnWriteData::List(const SdfAbstractDataSpecId& id) const
+{
+    return _data->List(id);
+}
+
+std::set<double>
+Sdf_CopyOnWriteData::ListAllTimeSamples() const
+{
+    return _data->ListAllTimeSamples();
+}
+
+std::set<double>
+Sdf_CopyOnWriteData::ListTimeSamplesForPath(
+    const SdfAbstractDataSpecId& id) const
+{
+    return _data->ListTimeSamplesForPath(id);
+}
+
+bool
+Sdf_CopyOnWriteData::GetBracketingTimeSamples(double time, double* tLower,
+                                              double* tUpper) const
+{
+    return _data->GetBracketingTimeSamples(time, tLower, tUpper);
+}
+
+size_t
+Sdf_CopyOnWriteData::GetNumTimeSamplesForPath(
+    const SdfAbstractDataSpecId& id) const
+{
+    return _data->GetNumTimeSamplesForPath(id);
+}
+
+bool
+Sdf_CopyOnWriteData::GetBracketingTimeSamplesForPath(
+    const SdfAbstractDataSpecId& id,
+    double time, double* tLower, double* tUpper) const
+{
+    return _data->GetBracketingTimeSamplesForPath(id, time, tLower, tUpper);
+}
+
+bool
+Sdf_CopyOnWriteData::QueryTimeSample(const SdfAbstractDataSpecId& id,
+                                     double time,
+                                     VtValue* optionalValue) const
+{
+    return _data->QueryTimeSample(id, time, optionalValue);
+}
+
+bool
+Sdf_CopyOnWriteData::QueryTimeSample(const SdfAbstractDataSpecId& id,
+                                     double time,
+                                     SdfAbstractDataValue* optionalValue) const
+{
+    return _data->QueryTimeSample(id, time, optionalValue);
+}
+
+void
+Sdf_CopyOnWriteData::SetTimeSample(const SdfAbstractDataSpecId& id,
+                                   double time, const VtValue& value)
+{
+    _Detach();
+    _data->SetTimeSample(id, time, value);
+}
+
+void
+Sdf_CopyOnWriteData::EraseTimeSample(const SdfAbstractDataSpecId& id,
+                                     double time)
+{
+    _Detach();
+    _data->EraseTimeSample(id, time);
+}
+
+void
+Sdf_CopyOnWriteData::_VisitSpecs(SdfAbstractDataSpecVisitor* visitor) const
+{
+    _ForwardingSpecVisitor forwarder(*this, visitor);
+    _data->VisitSpecs(&forwarder);
+}
+
+void
+Sdf_CopyOnWriteData::_VisitSpecsParallel(
+    SdfAbstractDataSpecVisitor* visitor) const
+{
+    _ForwardingSpecVisitor forwarder(*this, visitor);
+    _data->VisitSpecsParallel(&forwarder);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,142 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef SDF_COPY_ON_WRITE_DATA_H
+#define SDF_COPY_ON_WRITE_DATA_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/abstractData.h"
+#include "pxr/usd/sdf/fileFormat.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DECLARE_WEAK_AND_REF_PTRS(Sdf_CopyOnWriteData);
+
+/// \class Sdf_CopyOnWriteData
+///
+/// An SdfAbstractData that reads through to another data object and only
+/// materializes a private copy when it is first mutated.
+///
+/// SdfLayer uses this to make TransferContent between streaming layers
+/// zero-copy: the source and destination layers are each handed a wrapper
+/// over the shared data object, so the transfer itself copies nothing,
+/// and the first edit on either side detaches that side into fresh data
+/// created by its own file format before the edit is applied.
+///
+class Sdf_CopyOnWriteData : public SdfAbstractData
+{
+public:
+    /// Construct a wrapper reading through to \p data.  On first
+    /// mutation, private data is created via \p fileFormat->InitData()
+    /// with \p args, the shared contents are copied into it, and the
+    /// wrapper reads and writes that copy from then on.
+    Sdf_CopyOnWriteData(const SdfAbstractDataRefPtr& data,
+                        const SdfFileFormatConstPtr& fileFormat,
+                        const SdfFileFormat::FileFormatArguments& args);
+
+    virtual ~Sdf_CopyOnWriteData();
+
+    /// Return the data object currently read through to: the shared data
+    /// until the first mutation, the private copy after.
+    const SdfAbstractDataRefPtr& GetUnderlyingData() const { return _data; }
+
+    /// Return true if this object still reads through to shared data.
+    bool IsSharing() const { return !_detached; }
+
+    // SdfAbstractData overrides
+    virtual bool StreamsData() const;
+
+    virtual void CreateSpec(const SdfAbstractDataSpecId& id,
+                            SdfSpecType specType);
+    virtual bool HasSpec(const SdfAbstractDataSpecId& id) const;
+    virtual void EraseSpec(const SdfAbstractDataSpecId& id);
+    virtual void MoveSpec(const SdfAbstractDataSpecId& oldId,
+                          const SdfAbstractDataSpecId& newId);
+    virtual SdfSpecType GetSpecType(const SdfAbstractDataSpecId& id) const;
+    virtual size_t GetSpecContentsHash(const SdfAbstractDataSpecId& id) const;
+
+    virtual bool Has(const SdfAbstractDataSpecId& id,
+                     const TfToken& fieldName,
+                     SdfAbstractDataValue* value) const;
+    virtual bool Has(const SdfAbstractDataSpecId& id,
+                     const TfToken& fieldName,
+                     VtValue* value = NULL) const;
+    virtual VtValue Get(const SdfAbstractDataSpecId& id,
+                        const TfToken& fieldName) const;
+    virtual void GetFields(const SdfAbstractDataSpecId& id,
+                           const TfToken* fieldNames,
+                           VtValue* values,
+                           size_t numFields) const;
+    virtual void GetFieldForPaths(const SdfPath* paths,
+                                  size_t numPaths,
+                                  const TfToken& fieldName,
+                                  VtValue* values) const;
+    virtual std::type_info const&
+    GetTypeid(const SdfAbstractDataSpecId& id, const TfToken& fieldName) const;
+    virtual void Set(const SdfAbstractDataSpecId& id,
+                     const TfToken& fieldName,
+                     const VtValue& value);
+    virtual void Set(const SdfAbstractDataSpecId& id,
+                     const TfToken& fieldName,
+                     const SdfAbstractDataConstValue& value);
+    virtual void Erase(const SdfAbstractDataSpecId& id,
+                       const TfToken& fieldName);
+    virtual std::vector<TfToken> List(const SdfAbstractDataSpecId& id) const;
+
+    virtual std::set<double> ListAllTimeSamples() const;
+    virtual std::set<double>
+    ListTimeSamplesForPath(const SdfAbstractDataSpecId& id) const;
+    virtual bool GetBracketingTimeSamples(double time, double* tLower,
+                                          double* tUpper) const;
+    virtual size_t
+    GetNumTimeSamplesForPath(const SdfAbstractDataSpecId& id) const;
+    virtual bool
+    GetBracketingTimeSamplesForPath(const SdfAbstractDataSpecId& id,
+                                    double time,
+                                    double* tLower, double* tUpper) const;
+    virtual bool QueryTimeSample(const SdfAbstractDataSpecId& id, double time,
+                                 VtValue* optionalValue = NULL) const;
+    virtual bool QueryTimeSample(const SdfAbstractDataSpecId& id, double time,
+                                 SdfAbstractDataValue* optionalValue) const;
+    virtual void SetTimeSample(const SdfAbstractDataSpecId& id, double time,
+                               const VtValue& value);
+    virtual void EraseTimeSample(const SdfAbstractDataSpecId& id, double time);
+
+protected:
+    virtual void _VisitSpecs(SdfAbstractDataSpecVisitor* visitor) const;
+    virtual void _VisitSpecsParallel(SdfAbstractDataSpecVisitor* visitor) const;
+
+private:
+    // Replace the shared data with a private copy created by the file
+    // format.  Called before every mutation; does nothing once detached.
+    void _Detach();
+
+    SdfAbstractDataRefPtr _data;
+    SdfFileFormatConstPtr _fileFormat;
+    SdfFileFormat::FileFormatArguments _args;
+    bool _detached;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // SDF_COPY_ON_WRITE_DATA_H
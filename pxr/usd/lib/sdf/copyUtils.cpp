@@ -34,6 +34,7 @@
 
 #include "pxr/base/tf/token.h"
 #include "pxr/base/vt/value.h"
+#include "pxr/base/work/loops.h"
 
 #include <deque>
 #include <utility>
@@ -59,21 +60,31 @@ namespace {
     typedef std::pair<TfToken, VtValue> _FieldValuePair;
     typedef std::vector<_FieldValuePair> _FieldValueList;
 
-    // A _SpecDataEntry contains all of the information being copied for a 
+    // A _SpecDataEntry contains all of the information being copied for a
     // single spec.
     struct _SpecDataEntry {
         _SpecDataEntry(const SdfPath& dstPath_, SdfSpecType specType_)
             : dstPath(dstPath_), specType(specType_) { }
-        
+
         // Destination path to which this spec data should be copied.
         SdfPath dstPath;
 
         // Type of spec this entry represents.
         SdfSpecType specType;
 
+        // Whether this entry indicates that the spec at the destination
+        // path should be removed instead of copied to.
+        bool removeDst = false;
+
         // List containing (field, value) pairs of data to be copied to
         // the destination spec.
         _FieldValueList dataToCopy;
+
+        // Entries in dataToCopy whose values have not been retrieved yet
+        // and must be fetched from the source layer, as (index into
+        // dataToCopy, source spec path to fetch from) pairs. The fetches
+        // for a whole batch of specs are performed in parallel.
+        std::vector<std::pair<size_t, SdfPath>> fieldsToFetch;
     };
 
 } // end anonymous namespace
@@ -420,31 +431,89 @@ _RemoveSpecFromLayer(
 
 // Add a (field, value) entry to the list of fields to copy as directed by
 // the given policy. The value may be empty to indicate that the field
-// should be removed from the destination.
+// should be removed from the destination. If the policy does not supply a
+// value itself, the fetch from the source layer is deferred so that it can
+// be batched up and run in parallel with the fetches for other specs.
 static void
 _AddFieldValueToCopy(
     SdfSpecType specType, const TfToken& field,
     const SdfLayerHandle& srcLayer, const SdfPath& srcPath, bool fieldInSrc,
     const SdfLayerHandle& dstLayer, const SdfPath& dstPath, bool fieldInDst,
-    const SdfShouldCopyValueFn& shouldCopyValue, _FieldValueList* valueList)
+    const SdfShouldCopyValueFn& shouldCopyValue, _SpecDataEntry* copyEntry)
 {
     boost::optional<VtValue> value;
     if (shouldCopyValue(
-            specType, field, 
-            srcLayer, srcPath, fieldInSrc, dstLayer, dstPath, fieldInDst, 
+            specType, field,
+            srcLayer, srcPath, fieldInSrc, dstLayer, dstPath, fieldInDst,
             &value)) {
 
         // XXX: VtValue doesn't have move semantics...
-        valueList->emplace_back(field, VtValue());
+        copyEntry->dataToCopy.emplace_back(field, VtValue());
         if (value) {
-            value->Swap(valueList->back().second);
+            value->Swap(copyEntry->dataToCopy.back().second);
         }
         else {
-            srcLayer->GetField(srcPath, field).Swap(valueList->back().second);
+            copyEntry->fieldsToFetch.emplace_back(
+                copyEntry->dataToCopy.size() - 1, srcPath);
         }
     }
 }
 
+// Resolve any deferred field value fetches for the given entry immediately.
+static void
+_ResolveFieldsToFetch(
+    const SdfLayerHandle& srcLayer, _SpecDataEntry* copyEntry)
+{
+    for (const auto& fieldToFetch : copyEntry->fieldsToFetch) {
+        _FieldValuePair& fieldValue =
+            copyEntry->dataToCopy[fieldToFetch.first];
+        srcLayer->GetField(fieldToFetch.second, fieldValue.first)
+            .Swap(fieldValue.second);
+    }
+    copyEntry->fieldsToFetch.clear();
+}
+
+// Fetch the deferred field values for a whole batch of specs from the
+// source layer. Reading a layer is thread-safe, so the fetches run in
+// parallel when there are enough of them to be worthwhile; for crate-backed
+// sources this spreads value extraction across cores instead of
+// serializing it on the copying thread.
+static void
+_FetchFieldsToCopy(
+    const SdfLayerHandle& srcLayer, std::vector<_SpecDataEntry>* batch)
+{
+    typedef std::pair<_SpecDataEntry*, const std::pair<size_t, SdfPath>*>
+        _FetchEntry;
+    std::vector<_FetchEntry> fetches;
+    for (_SpecDataEntry& copyEntry : *batch) {
+        for (const auto& fieldToFetch : copyEntry.fieldsToFetch) {
+            fetches.emplace_back(&copyEntry, &fieldToFetch);
+        }
+    }
+
+    auto fetchValues = [&srcLayer, &fetches](size_t begin, size_t end) {
+        for (size_t i = begin; i != end; ++i) {
+            _SpecDataEntry* copyEntry = fetches[i].first;
+            _FieldValuePair& fieldValue =
+                copyEntry->dataToCopy[fetches[i].second->first];
+            srcLayer->GetField(fetches[i].second->second, fieldValue.first)
+                .Swap(fieldValue.second);
+        }
+    };
+
+    static const size_t minFetchesInParallel = 64;
+    if (fetches.size() < minFetchesInParallel) {
+        fetchValues(0, fetches.size());
+    }
+    else {
+        WorkParallelForN(fetches.size(), fetchValues);
+    }
+
+    for (_SpecDataEntry& copyEntry : *batch) {
+        copyEntry.fieldsToFetch.clear();
+    }
+}
+
 // Call the given function for each field in srcFields and dstFields.
 // The function will be called once for each unique field and will be 
 // passed flags that indicate which container the field was in.
@@ -492,7 +561,176 @@ _ForEachField(
     }
 }
 
-bool 
+// Process a single copy request: determine the fields that need to be
+// copied for the spec, append an entry for it to the given batch, and add
+// copy requests for its children to the copy stack. Returns false if the
+// source spec is of an unknown type.
+static bool
+_GatherSpecData(
+    const _CopyStackEntry& toCopy,
+    const SdfLayerHandle& srcLayer, const SdfPath& srcRootPath,
+    const SdfLayerHandle& dstLayer,
+    const SdfShouldCopyValueFn& shouldCopyValueFn,
+    const SdfShouldCopyChildrenFn& shouldCopyChildrenFn,
+    _CopyStack* copyStack,
+    std::vector<_SpecDataEntry>* batch)
+{
+    // If the source path is empty, it indicates that the spec at the
+    // destination path should be removed.
+    if (toCopy.srcPath.IsEmpty()) {
+        _SpecDataEntry removeEntry(toCopy.dstPath, SdfSpecTypeUnknown);
+        removeEntry.removeDst = true;
+        batch->push_back(std::move(removeEntry));
+        return true;
+    }
+
+    // Figure out the concrete type of the spec we're copying. The spec type
+    // dictates copying behavior below.
+    const SdfSpecType specType = srcLayer->GetSpecType(toCopy.srcPath);
+    if (specType == SdfSpecTypeUnknown) {
+        TF_CODING_ERROR("Cannot copy unknown spec at <%s> from layer <%s>",
+            srcRootPath.GetText(), srcLayer->GetIdentifier().c_str());
+        return false;
+    }
+
+    _SpecDataEntry copyEntry(toCopy.dstPath, specType);
+
+    // Determine what data is present for the current source and dest specs
+    // and what needs to be copied. Divide the present fields into those
+    // that contain values and those that index children specs.
+    std::vector<TfToken> dstValueFields;
+    std::vector<TfToken> dstChildrenFields;
+    _GetFieldNames(
+        dstLayer, toCopy.dstPath, &dstValueFields, &dstChildrenFields);
+
+    std::vector<TfToken> srcValueFields;
+    std::vector<TfToken> srcChildrenFields;
+    _GetFieldNames(
+        srcLayer, toCopy.srcPath, &srcValueFields, &srcChildrenFields);
+
+    // From the list of value fields, retrieve all values that the copy
+    // policy says we need to copy over to the destination.
+    _ForEachField(
+        srcValueFields, dstValueFields,
+        [&](const TfToken& field, bool fieldInSrc, bool fieldInDst) {
+            _AddFieldValueToCopy(
+                specType, field,
+                srcLayer, toCopy.srcPath, fieldInSrc,
+                dstLayer, toCopy.dstPath, fieldInDst,
+                shouldCopyValueFn, &copyEntry);
+        });
+
+    // Since prims and variants hold the same information, a prim can be
+    // copied to a variant and vice-versa. If this is the case, we need
+    // to update the copy entry since the code below expects the source
+    // and destination spec types to be the same.
+    const bool copyingPrimToVariant =
+        specType == SdfSpecTypePrim &&
+        toCopy.dstPath.IsPrimVariantSelectionPath();
+    const bool copyingVariantToPrim =
+        specType == SdfSpecTypeVariant && toCopy.dstPath.IsPrimPath();
+
+    if (copyingPrimToVariant || copyingVariantToPrim) {
+        // Resolve any deferred field value fetches now, since the fixups
+        // below remove entries from dataToCopy and would invalidate the
+        // indices recorded for the deferred fetches.
+        _ResolveFieldsToFetch(srcLayer, &copyEntry);
+
+        // Clear out any specifier or typename fields in the data to copy,
+        // since we'll want to set those specially.
+        copyEntry.dataToCopy.erase(
+            std::remove_if(
+                copyEntry.dataToCopy.begin(), copyEntry.dataToCopy.end(),
+                [](const _FieldValuePair& fv) {
+                    return fv.first == SdfFieldKeys->Specifier ||
+                        fv.first == SdfFieldKeys->TypeName;
+                }),
+            copyEntry.dataToCopy.end());
+
+        if (copyingPrimToVariant) {
+            // Set the specifier for the destination variant to over, since
+            // that's the value used in SdfVariantSpec's c'tor.
+            copyEntry.dataToCopy.push_back({
+                SdfFieldKeys->Specifier, VtValue(SdfSpecifierOver)});
+            copyEntry.specType = SdfSpecTypeVariant;
+        }
+        else if (copyingVariantToPrim) {
+            // Variants don't have a specifier or typename, but for
+            // convenience we copy those values from the owning prim.
+            const SdfPath srcPrimPath = toCopy.srcPath.GetPrimPath();
+            std::vector<TfToken> srcFields, dstFields;
+            for (const TfToken& field :
+                { SdfFieldKeys->Specifier, SdfFieldKeys->TypeName } ) {
+
+                if (srcLayer->HasField(srcPrimPath, field)) {
+                    srcFields.push_back(field);
+                }
+                if (dstLayer->HasField(toCopy.dstPath, field)) {
+                    dstFields.push_back(field);
+                }
+            }
+
+            _ForEachField(
+                srcFields, dstFields,
+                [&](const TfToken& field, bool fieldInSrc, bool fieldInDst) {
+                    _AddFieldValueToCopy(
+                        specType, field,
+                        srcLayer, srcPrimPath, fieldInSrc,
+                        dstLayer, toCopy.dstPath, fieldInDst,
+                        shouldCopyValueFn, &copyEntry);
+                });
+
+            copyEntry.specType = SdfSpecTypePrim;
+        }
+    }
+
+    batch->push_back(std::move(copyEntry));
+
+    // Now add any children specs that need to be copied to our
+    // copy stack.
+    _ForEachField(
+        srcChildrenFields, dstChildrenFields,
+        [&](const TfToken& field, bool fieldInSrc, bool fieldInDst) {
+            _ProcessChildField(
+                field,
+                srcLayer, toCopy.srcPath, fieldInSrc,
+                dstLayer, toCopy.dstPath, fieldInDst,
+                shouldCopyChildrenFn, copyStack);
+        });
+
+    return true;
+}
+
+// Apply a batch of gathered spec data to the destination layer, in the
+// order the specs were gathered.
+static void
+_ApplySpecDataToLayer(
+    const SdfLayerHandle& dstLayer, const std::vector<_SpecDataEntry>& batch)
+{
+    for (const _SpecDataEntry& copyEntry : batch) {
+        if (copyEntry.removeDst) {
+            _RemoveSpecFromLayer(dstLayer, copyEntry.dstPath);
+            continue;
+        }
+
+        // Create the new spec and copy all of the specified fields over.
+        _AddNewSpecToLayer(dstLayer, copyEntry);
+        for (const _FieldValuePair& fieldValue : copyEntry.dataToCopy) {
+            if (fieldValue.second.IsHolding<SdfCopySpecsValueEdit>()) {
+                const SdfCopySpecsValueEdit::EditFunction& edit =
+                    fieldValue.second.UncheckedGet<SdfCopySpecsValueEdit>()
+                    .GetEditFunction();
+                edit(dstLayer, copyEntry.dstPath);
+            }
+            else {
+                dstLayer->SetField(
+                    copyEntry.dstPath, fieldValue.first, fieldValue.second);
+            }
+        }
+    }
+}
+
+bool
 SdfCopySpec(
     const SdfLayerHandle& srcLayer, const SdfPath& srcPath,
     const SdfLayerHandle& dstLayer, const SdfPath& dstPath,
@@ -535,142 +773,37 @@ SdfCopySpec(
     // Create a stack of source/dest copy requests, initially populated with
     // the passed parameters.  The copy routine will add additional requests
     // as needed to handle children etc... and runs until the stack is empty.
-    _CopyStack copyStack(1, _CopyStackEntry(srcPath, dstPath));
-    while (!copyStack.empty()) {
-        const _CopyStackEntry toCopy = copyStack.front();
-        copyStack.pop_front();
-
-        // If the source path is empty, it indicates that the spec at the
-        // destination path should be removed.
-        if (toCopy.srcPath.IsEmpty()) {
-            _RemoveSpecFromLayer(dstLayer, toCopy.dstPath);
-            continue;
-        }
+    //
+    // The stack is processed in batches: gather a batch of specs along with
+    // the names of the fields to copy, fetch the field values from the
+    // source layer in parallel, then apply the batch to the destination
+    // layer in order.  Batches are bounded so that only a limited amount of
+    // field data is materialized at any one time.
+    static const size_t maxSpecsPerBatch = 4096;
 
-        // Figure out the concrete type of the spec we're copying. The spec type
-        // dictates copying behavior below.
-        const SdfSpecType specType = srcLayer->GetSpecType(toCopy.srcPath);
-        if (specType == SdfSpecTypeUnknown) {
-            TF_CODING_ERROR("Cannot copy unknown spec at <%s> from layer <%s>",
-                srcPath.GetText(), srcLayer->GetIdentifier().c_str());
-            return false;
-        }
-
-        _SpecDataEntry copyEntry(toCopy.dstPath, specType);
-
-        // Determine what data is present for the current source and dest specs
-        // and what needs to be copied. Divide the present fields into those
-        // that contain values and those that index children specs.
-        std::vector<TfToken> dstValueFields;
-        std::vector<TfToken> dstChildrenFields;
-        _GetFieldNames(
-            dstLayer, toCopy.dstPath, &dstValueFields, &dstChildrenFields);
-
-        std::vector<TfToken> srcValueFields;
-        std::vector<TfToken> srcChildrenFields;
-        _GetFieldNames(
-            srcLayer, toCopy.srcPath, &srcValueFields, &srcChildrenFields);
-
-        // From the list of value fields, retrieve all values that the copy
-        // policy says we need to copy over to the destination.
-        _ForEachField(
-            srcValueFields, dstValueFields,
-            [&](const TfToken& field, bool fieldInSrc, bool fieldInDst) {
-                _AddFieldValueToCopy(
-                    specType, field, 
-                    srcLayer, toCopy.srcPath, fieldInSrc,
-                    dstLayer, toCopy.dstPath, fieldInDst,
-                    shouldCopyValueFn, &copyEntry.dataToCopy);
-            });
-
-        // Since prims and variants hold the same information, a prim can be
-        // copied to a variant and vice-versa. If this is the case, we need
-        // to update the copy entry since the code below expects the source
-        // and destination spec types to be the same.
-        const bool copyingPrimToVariant = 
-            specType == SdfSpecTypePrim && 
-            toCopy.dstPath.IsPrimVariantSelectionPath();
-        const bool copyingVariantToPrim =
-            specType == SdfSpecTypeVariant && toCopy.dstPath.IsPrimPath();
-
-        if (copyingPrimToVariant || copyingVariantToPrim) {
-            // Clear out any specifier or typename fields in the data to copy,
-            // since we'll want to set those specially.
-            copyEntry.dataToCopy.erase(
-                std::remove_if(
-                    copyEntry.dataToCopy.begin(), copyEntry.dataToCopy.end(),
-                    [](const _FieldValuePair& fv) {
-                        return fv.first == SdfFieldKeys->Specifier ||
-                            fv.first == SdfFieldKeys->TypeName;
-                    }),
-                copyEntry.dataToCopy.end());
-
-            if (copyingPrimToVariant) {
-                // Set the specifier for the destination variant to over, since
-                // that's the value used in SdfVariantSpec's c'tor.
-                copyEntry.dataToCopy.push_back({
-                    SdfFieldKeys->Specifier, VtValue(SdfSpecifierOver)});
-                copyEntry.specType = SdfSpecTypeVariant;
-            }
-            else if (copyingVariantToPrim) {
-                // Variants don't have a specifier or typename, but for
-                // convenience we copy those values from the owning prim.
-                const SdfPath srcPrimPath = toCopy.srcPath.GetPrimPath();
-                std::vector<TfToken> srcFields, dstFields;
-                for (const TfToken& field : 
-                    { SdfFieldKeys->Specifier, SdfFieldKeys->TypeName } ) {
-
-                    if (srcLayer->HasField(srcPrimPath, field)) {
-                        srcFields.push_back(field);
-                    }
-                    if (dstLayer->HasField(toCopy.dstPath, field)) {
-                        dstFields.push_back(field);
-                    }
-                }
-
-                _ForEachField(
-                    srcFields, dstFields,
-                    [&](const TfToken& field, bool fieldInSrc, bool fieldInDst) {
-                        _AddFieldValueToCopy(
-                            specType, field, 
-                            srcLayer, srcPrimPath, fieldInSrc,
-                            dstLayer, toCopy.dstPath, fieldInDst,
-                            shouldCopyValueFn, &copyEntry.dataToCopy);
-                    });
-
-                copyEntry.specType = SdfSpecTypePrim;
+    _CopyStack copyStack(1, _CopyStackEntry(srcPath, dstPath));
+    std::vector<_SpecDataEntry> batch;
+    bool srcValid = true;
+    while (!copyStack.empty() && srcValid) {
+        batch.clear();
+        while (!copyStack.empty() && batch.size() < maxSpecsPerBatch) {
+            const _CopyStackEntry toCopy = copyStack.front();
+            copyStack.pop_front();
+
+            if (!_GatherSpecData(
+                    toCopy, srcLayer, srcPath, dstLayer,
+                    shouldCopyValueFn, shouldCopyChildrenFn,
+                    &copyStack, &batch)) {
+                srcValid = false;
+                break;
             }
         }
 
-        // Create the new spec and copy all of the specified fields over.
-        _AddNewSpecToLayer(dstLayer, copyEntry);
-        for (const _FieldValuePair& fieldValue : copyEntry.dataToCopy) {
-            if (fieldValue.second.IsHolding<SdfCopySpecsValueEdit>()) {
-                const SdfCopySpecsValueEdit::EditFunction& edit = 
-                    fieldValue.second.UncheckedGet<SdfCopySpecsValueEdit>()
-                    .GetEditFunction();
-                edit(dstLayer, copyEntry.dstPath);
-            }
-            else {
-                dstLayer->SetField(
-                    copyEntry.dstPath, fieldValue.first, fieldValue.second);
-            }
-        }
+        _FetchFieldsToCopy(srcLayer, &batch);
+        _ApplySpecDataToLayer(dstLayer, batch);
+    }
 
-        // Now add any children specs that need to be copied to our
-        // copy stack.
-        _ForEachField(
-            srcChildrenFields, dstChildrenFields,
-            [&](const TfToken& field, bool fieldInSrc, bool fieldInDst) {
-                _ProcessChildField(
-                    field,
-                    srcLayer, toCopy.srcPath, fieldInSrc,
-                    dstLayer, toCopy.dstPath, fieldInDst,
-                    shouldCopyChildrenFn, &copyStack);
-            });
-    }
-    
-    return true;
+    return srcValid;
 }
 
 // ------------------------------------------------------------
@@ -27,6 +27,7 @@
 #include "pxr/base/trace/trace.h"
 #include "pxr/base/work/utils.h"
 
+#include <algorithm>
 #include <iostream>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -53,11 +54,12 @@ void
 SdfData::EraseSpec(const SdfAbstractDataSpecId& id)
 {
     _HashTable::iterator i = _data.find(id.GetFullSpecPath());
-    if (!TF_VERIFY(i != _data.end(), 
+    if (!TF_VERIFY(i != _data.end(),
             "No spec to erase at <%s>", id.GetString().c_str())) {
         return;
     }
     _data.erase(i);
+    _InvalidateFrameIndex();
 }
 
 void
@@ -72,11 +74,14 @@ SdfData::MoveSpec(const SdfAbstractDataSpecId& oldId,
             "No spec to move at <%s>", oldPath.GetString().c_str())) {
         return;
     }
-    bool inserted = _data.insert(std::make_pair(newPath,old->second)).second;
-    if (!TF_VERIFY(inserted)) {
+    if (!TF_VERIFY(_data.find(newPath) == _data.end())) {
         return;
     }
+    // Move the spec data out before mutating the table; insertion
+    // invalidates iterators and references into it.
+    _SpecData specData = std::move(old->second);
     _data.erase(old);
+    _data.insert(std::make_pair(newPath, std::move(specData)));
 }
 
 SdfSpecType
@@ -174,6 +179,28 @@ SdfData::Get(const SdfAbstractDataSpecId& id, const TfToken & field) const
     return VtValue();
 }
 
+void
+SdfData::GetFields(const SdfAbstractDataSpecId& id, const TfToken* fieldNames,
+                   VtValue* values, size_t numFields) const
+{
+    // Look the spec up once and scan its field list for each requested
+    // name, rather than repeating the hash lookup per field.
+    _HashTable::const_iterator i = _data.find(id.GetFullSpecPath());
+    const _SpecData* spec = (i == _data.end()) ? NULL : &i->second;
+    for (size_t k = 0; k != numFields; ++k) {
+        values[k] = VtValue();
+        if (!spec) {
+            continue;
+        }
+        for (size_t j=0, jEnd = spec->fields.size(); j != jEnd; ++j) {
+            if (spec->fields[j].first == fieldNames[k]) {
+                values[k] = spec->fields[j].second;
+                break;
+            }
+        }
+    }
+}
+
 void 
 SdfData::Set(const SdfAbstractDataSpecId& id, const TfToken & field, 
              const VtValue& value)
@@ -188,6 +215,9 @@ SdfData::Set(const SdfAbstractDataSpecId& id, const TfToken & field,
     VtValue* newValue = _GetOrCreateFieldValue(id, field);
     if (newValue) {
         *newValue = value;
+        if (field == SdfDataTokens->TimeSamples) {
+            _InvalidateFrameIndex();
+        }
     }
 }
 
@@ -200,6 +230,9 @@ SdfData::Set(const SdfAbstractDataSpecId& id, const TfToken & field,
     VtValue* newValue = _GetOrCreateFieldValue(id, field);
     if (newValue) {
         value.GetValue(newValue);
+        if (field == SdfDataTokens->TimeSamples) {
+            _InvalidateFrameIndex();
+        }
     }
 }
 
@@ -237,6 +270,9 @@ SdfData::Erase(const SdfAbstractDataSpecId& id, const TfToken & field)
     for (size_t j=0, jEnd = spec.fields.size(); j != jEnd; ++j) {
         if (spec.fields[j].first == field) {
             spec.fields.erase(spec.fields.begin()+j);
+            if (field == SdfDataTokens->TimeSamples) {
+                _InvalidateFrameIndex();
+            }
             return;
         }
     }
@@ -268,16 +304,49 @@ SdfData::List(const SdfAbstractDataSpecId& id) const
 std::set<double>
 SdfData::ListAllTimeSamples() const
 {
-    // Use a set to determine unique times.
-    std::set<double> times;
+    std::shared_ptr<const std::vector<double>> times = _GetFrameIndex();
+    return std::set<double>(times->begin(), times->end());
+}
+
+std::shared_ptr<const std::vector<double>>
+SdfData::_GetFrameIndex() const
+{
+    {
+        std::lock_guard<std::mutex> lock(_frameIndexMutex);
+        if (_frameIndex) {
+            return _frameIndex;
+        }
+    }
 
+    // Build the index outside the lock. Concurrent builders race benignly;
+    // the first to publish wins.
+    std::set<double> times;
     TF_FOR_ALL(i, _data) {
-        std::set<double> timesForPath = 
-            ListTimeSamplesForPath(SdfAbstractDataSpecId(&i->first));
-        times.insert(timesForPath.begin(), timesForPath.end());
+        for (size_t j=0, jEnd = i->second.fields.size(); j != jEnd; ++j) {
+            const _FieldValuePair &fv = i->second.fields[j];
+            if (fv.first == SdfDataTokens->TimeSamples &&
+                fv.second.IsHolding<SdfTimeSampleMap>()) {
+                TF_FOR_ALL(k, fv.second.UncheckedGet<SdfTimeSampleMap>()) {
+                    times.insert(k->first);
+                }
+            }
+        }
     }
+    std::shared_ptr<std::vector<double>> index =
+        std::make_shared<std::vector<double>>(times.begin(), times.end());
 
-    return times;
+    std::lock_guard<std::mutex> lock(_frameIndexMutex);
+    if (!_frameIndex) {
+        _frameIndex = std::move(index);
+    }
+    return _frameIndex;
+}
+
+void
+SdfData::_InvalidateFrameIndex()
+{
+    std::lock_guard<std::mutex> lock(_frameIndexMutex);
+    _frameIndex.reset();
 }
 
 std::set<double>
@@ -344,12 +413,64 @@ _GetBracketingTimeSamples(const SdfTimeSampleMap &samples, double time,
         time, tLower, tUpper);
 }
 
+// Like _GetBracketingTimeSamples, but for a sorted flat array of times and
+// with a bracket hint. During monotonically advancing playback, successive
+// queries tend to fall in the same bracket as the previous one or in an
+// adjacent bracket, so check the remembered bracket before binary
+// searching. The hint is validated before use, so a stale value only costs
+// us the fast path.
+static bool
+_GetBracketingTimeSamplesSorted(const std::vector<double> &times,
+                                const double time, std::atomic<size_t> *hint,
+                                double *tLower, double *tUpper)
+{
+    if (times.empty()) {
+        // No samples.
+        return false;
+    }
+
+    size_t lowerIndex = hint->load(std::memory_order_relaxed);
+    if (!(lowerIndex + 1 < times.size() &&
+          times[lowerIndex] <= time && time <= times[lowerIndex + 1])) {
+        // The hint does not identify the containing bracket; binary search.
+        if (time <= times.front()) {
+            // Time is at-or-before the first sample.
+            *tLower = *tUpper = times.front();
+            hint->store(0, std::memory_order_relaxed);
+            return true;
+        }
+        if (time >= times.back()) {
+            // Time is at-or-after the last sample.
+            *tLower = *tUpper = times.back();
+            hint->store(times.size() - 1, std::memory_order_relaxed);
+            return true;
+        }
+        lowerIndex = std::upper_bound(times.begin(), times.end(), time) -
+            times.begin() - 1;
+        hint->store(lowerIndex, std::memory_order_relaxed);
+    }
+
+    if (time == times[lowerIndex]) {
+        // Time is exactly on the bracket's lower sample.
+        *tLower = *tUpper = times[lowerIndex];
+    } else if (time == times[lowerIndex + 1]) {
+        // Time is exactly on the bracket's upper sample.
+        *tLower = *tUpper = times[lowerIndex + 1];
+    } else {
+        // Time is in-between samples; return the bracketing times.
+        *tLower = times[lowerIndex];
+        *tUpper = times[lowerIndex + 1];
+    }
+    return true;
+}
+
 bool
 SdfData::GetBracketingTimeSamples(
     double time, double* tLower, double* tUpper) const
 {
-    return _GetBracketingTimeSamples(
-        ListAllTimeSamples(), time, tLower, tUpper);
+    std::shared_ptr<const std::vector<double>> times = _GetFrameIndex();
+    return _GetBracketingTimeSamplesSorted(
+        *times, time, &_frameIndexHint, tLower, tUpper);
 }
 
 size_t
@@ -428,8 +549,15 @@ SdfData::SetTimeSample(const SdfAbstractDataSpecId& id, double time,
         fieldValue->UncheckedSwap(newSamples);
     }
     
-    // Insert or overwrite into newSamples.
-    newSamples[time] = value;
+    // Insert or overwrite into newSamples. Introducing a new sample time
+    // invalidates the frame index; overwriting the value at an existing
+    // time does not.
+    auto result = newSamples.insert(std::make_pair(time, value));
+    if (result.second) {
+        _InvalidateFrameIndex();
+    } else {
+        result.first->second = value;
+    }
 
     // Set back into the field.
     if (fieldValue) {
@@ -457,7 +585,9 @@ SdfData::EraseTimeSample(const SdfAbstractDataSpecId& id, double time)
     }
     
     // Erase from newSamples.
-    newSamples.erase(time);
+    if (newSamples.erase(time)) {
+        _InvalidateFrameIndex();
+    }
 
     // Check to see if the result is empty.  In that case we remove the field.
     if (newSamples.empty()) {
@@ -29,10 +29,13 @@
 #include "pxr/usd/sdf/abstractData.h"
 #include "pxr/usd/sdf/path.h"
 #include "pxr/base/tf/declarePtrs.h"
-#include "pxr/base/tf/hashmap.h"
+#include "pxr/base/tf/flatHashMap.h"
 #include "pxr/base/tf/token.h"
 #include "pxr/base/vt/value.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -49,7 +52,7 @@ TF_DECLARE_WEAK_AND_REF_PTRS(SdfData);
 class SdfData : public SdfAbstractData
 {
 public:
-    SdfData() {}
+    SdfData() : _frameIndexHint(0) {}
     SDF_API
     virtual ~SdfData();
 
@@ -78,9 +81,14 @@ public:
     virtual bool Has(const SdfAbstractDataSpecId& id, const TfToken& fieldName,
                      VtValue *value = NULL) const;
     SDF_API
-    virtual VtValue Get(const SdfAbstractDataSpecId& id, 
+    virtual VtValue Get(const SdfAbstractDataSpecId& id,
                         const TfToken& fieldName) const;
     SDF_API
+    virtual void GetFields(const SdfAbstractDataSpecId& id,
+                           const TfToken* fieldNames,
+                           VtValue* values,
+                           size_t numFields) const;
+    SDF_API
     virtual void Set(const SdfAbstractDataSpecId& id, const TfToken& fieldName,
                      const VtValue & value);
     SDF_API
@@ -147,6 +155,15 @@ private:
     VtValue* _GetOrCreateFieldValue(const SdfAbstractDataSpecId& id,
                                     const TfToken& field);
 
+    // Returns the frame index: a lazily-built sorted array of every sample
+    // time in this data object, used by the whole-layer time-sample queries
+    // so they need not walk every spec per call.
+    std::shared_ptr<const std::vector<double>> _GetFrameIndex() const;
+
+    // Drops the frame index; called by mutations that can change the set
+    // of sample times.
+    void _InvalidateFrameIndex();
+
 private:
     // Backing storage for a single "spec" -- prim, property, etc.
     typedef std::pair<TfToken, VtValue> _FieldValuePair;
@@ -157,12 +174,23 @@ private:
         std::vector<_FieldValuePair> fields;
     };
 
-    // Hashtable storing _SpecData.
+    // Hashtable storing _SpecData.  An open-addressing table: spec lookup
+    // (much of it miss-heavy, e.g. HasField on specs without the field)
+    // and whole-layer traversal both dominate here, and the flat layout
+    // avoids the chained table's per-node allocations and pointer chasing.
     typedef SdfPath _Key;
     typedef SdfPath::Hash _KeyHash;
-    typedef TfHashMap<_Key, _SpecData, _KeyHash> _HashTable;
+    typedef TfFlatHashMap<_Key, _SpecData, _KeyHash> _HashTable;
 
     _HashTable _data;
+
+    // Cached frame index, shared out under _frameIndexMutex, and the
+    // bracket found by the most recent GetBracketingTimeSamples() query.
+    // The hint is validated against the index before use, so it needs no
+    // synchronization beyond atomicity.
+    mutable std::mutex _frameIndexMutex;
+    mutable std::shared_ptr<const std::vector<double>> _frameIndex;
+    mutable std::atomic<size_t> _frameIndexHint;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,87 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/editJournal.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+void
+SdfEditJournal::CreateSpec(
+    const SdfPath& path, SdfSpecType specType, bool inert)
+{
+    _Edit edit;
+    edit.op = _Edit::_CreateSpec;
+    edit.path = path;
+    edit.specType = specType;
+    edit.inert = inert;
+    _edits.push_back(std::move(edit));
+}
+
+void
+SdfEditJournal::SetField(
+    const SdfPath& path, const TfToken& fieldName, const VtValue& value)
+{
+    _Edit edit;
+    edit.op = _Edit::_SetField;
+    edit.path = path;
+    edit.field = fieldName;
+    edit.value = value;
+    _edits.push_back(std::move(edit));
+}
+
+void
+SdfEditJournal::SetTimeSample(
+    const SdfPath& path, double time, const VtValue& value)
+{
+    _Edit edit;
+    edit.op = _Edit::_SetTimeSample;
+    edit.path = path;
+    edit.time = time;
+    edit.value = value;
+    _edits.push_back(std::move(edit));
+}
+
+void
+SdfEditJournal::Append(SdfEditJournal&& journal)
+{
+    if (_edits.empty()) {
+        _edits.swap(journal._edits);
+        return;
+    }
+
+    _edits.insert(
+        _edits.end(),
+        std::make_move_iterator(journal._edits.begin()),
+        std::make_move_iterator(journal._edits.end()));
+    journal._edits.clear();
+}
+
+void
+SdfEditJournal::Clear()
+{
+    _edits.clear();
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,138 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef SDF_EDIT_JOURNAL_H
+#define SDF_EDIT_JOURNAL_H
+
+/// \file sdf/editJournal.h
+
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/api.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/sdf/types.h"
+#include "pxr/base/tf/token.h"
+#include "pxr/base/vt/value.h"
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class SdfEditJournal
+///
+/// A recorded sequence of layer edits that can be applied to a layer
+/// later via SdfLayer::Apply(const SdfEditJournal&).
+///
+/// Authoring through the Sdf API mutates layer data and queues change
+/// notification, both of which require external serialization.  An edit
+/// journal lets clients that generate scene description from many
+/// threads record their edits without touching any layer: each thread
+/// assembles its own journal concurrently, the journals are merged with
+/// Append(), and the result is applied to the layer in one pass on a
+/// single thread.  Application happens inside one SdfChangeBlock, so
+/// downstream consumers (e.g. UsdStage) see a single batch of change
+/// notification and perform a single recompose pass.
+///
+/// A journal object itself is not thread-safe; the intended pattern is
+/// one journal per thread.  Edits are applied in the order they were
+/// recorded, so a spec's creation must be recorded before fields on it.
+/// Journal application performs the same per-edit validation as the
+/// corresponding SdfLayer authoring calls.
+///
+class SdfEditJournal
+{
+public:
+    /// Record creation of a spec of type \p specType at \p path.
+    /// Required fields (e.g. the specifier for prim specs) must be
+    /// recorded with SetField() after the spec's creation.
+    SDF_API
+    void CreateSpec(const SdfPath& path, SdfSpecType specType,
+                    bool inert = false);
+
+    /// Record setting the field \p fieldName on the spec at \p path
+    /// to \p value.
+    SDF_API
+    void SetField(const SdfPath& path, const TfToken& fieldName,
+                  const VtValue& value);
+
+    /// \overload
+    template <class T>
+    void SetField(const SdfPath& path, const TfToken& fieldName,
+                  const T& value)
+    {
+        SetField(path, fieldName, VtValue(value));
+    }
+
+    /// Record setting the time sample at \p time on the attribute at
+    /// \p path to \p value.
+    SDF_API
+    void SetTimeSample(const SdfPath& path, double time,
+                       const VtValue& value);
+
+    /// \overload
+    template <class T>
+    void SetTimeSample(const SdfPath& path, double time, const T& value)
+    {
+        SetTimeSample(path, time, VtValue(value));
+    }
+
+    /// Move all edits recorded in \p journal to the end of this journal,
+    /// leaving \p journal empty.  This is how per-thread journals are
+    /// merged before application.
+    SDF_API
+    void Append(SdfEditJournal&& journal);
+
+    /// Return true if no edits have been recorded.
+    bool IsEmpty() const {
+        return _edits.empty();
+    }
+
+    /// Return the number of recorded edits.
+    size_t GetSize() const {
+        return _edits.size();
+    }
+
+    /// Discard all recorded edits.
+    SDF_API
+    void Clear();
+
+private:
+    friend class SdfLayer;
+
+    struct _Edit {
+        enum _Op { _CreateSpec, _SetField, _SetTimeSample };
+
+        _Op op;
+        SdfPath path;
+        TfToken field;
+        VtValue value;
+        double time = 0.0;
+        SdfSpecType specType = SdfSpecTypeUnknown;
+        bool inert = false;
+    };
+
+    std::vector<_Edit> _edits;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // SDF_EDIT_JOURNAL_H
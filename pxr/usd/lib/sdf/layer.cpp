@@ -32,7 +32,9 @@
 #include "pxr/usd/sdf/changeManager.h"
 #include "pxr/usd/sdf/childrenPolicies.h"
 #include "pxr/usd/sdf/childrenUtils.h"
+#include "pxr/usd/sdf/copyOnWriteData.h"
 #include "pxr/usd/sdf/debugCodes.h"
+#include "pxr/usd/sdf/editJournal.h"
 #include "pxr/usd/sdf/fileFormat.h"
 #include "pxr/usd/sdf/layerRegistry.h"
 #include "pxr/usd/sdf/layerStateDelegate.h"
@@ -65,6 +67,7 @@
 #include "pxr/base/tf/scopeDescription.h"
 #include "pxr/base/tf/staticData.h"
 #include "pxr/base/tf/stackTrace.h"
+#include "pxr/base/work/detachedTask.h"
 
 #include <tbb/queuing_rw_mutex.h>
 
@@ -121,6 +124,14 @@ TF_DEFINE_ENV_SETTING(
     "against their schema. If the field or spec is not defined in the schema "
     "a coding error will be issued and the authoring operation will fail.");
 
+TF_DEFINE_ENV_SETTING(
+    SDF_LAYER_INCREMENTAL_RELOAD, true,
+    "If enabled, reloading a layer whose data implementation streams data "
+    "on demand (e.g. usdc) diffs the old and new contents and sends "
+    "fine-grained change notification, so dependents only recompose "
+    "objects whose opinions actually differ. If disabled, such reloads "
+    "send a coarse content-replaced change.");
+
 SdfLayer::SdfLayer(
     const SdfFileFormatConstPtr &fileFormat,
     const string &identifier,
@@ -141,6 +152,7 @@ SdfLayer::SdfLayer(
     , _permissionToSave(true)
     , _validateAuthoring(
         validateAuthoring || TfGetEnvSetting<bool>(SDF_LAYER_VALIDATE_AUTHORING))
+    , _reloadingData(false)
 {
     const string realPathFinal = Sdf_CanonicalizeRealPath(realPath);
 
@@ -788,6 +800,17 @@ SdfLayer::FindOrOpen(const string &identifier,
         return TfNullPtr;
     }
 
+    // Consult the registry's sharded identifier table first. If the layer
+    // is already open we can acquire it here without contending on the
+    // global registry mutex with other threads opening unrelated layers.
+    if (SdfLayerRefPtr layer =
+        _layerRegistry->FindAndAcquire(layerInfo.identifier)) {
+        if (layer->_WaitForInitializationAndCheckIfSuccessful()) {
+            return layer;
+        }
+        return TfNullPtr;
+    }
+
     // First see if this layer is already present.
     tbb::queuing_rw_mutex::scoped_lock
         lock(_GetLayerRegistryMutex(), /*write=*/false);
@@ -947,7 +970,16 @@ SdfLayer::_Reload(bool force)
             return _ReloadSkipped;
         }
 
-        if (!_Read(GetIdentifier(), realPath, /* metadataOnly = */ false)) {
+        // Let _SetData() know that the data being installed replaces the
+        // current contents of this same asset, so that streaming data
+        // implementations can be diffed for fine-grained change
+        // notification rather than coarsely invalidated.
+        _reloadingData = true;
+        const bool readSuccess =
+            _Read(GetIdentifier(), realPath, /* metadataOnly = */ false);
+        _reloadingData = false;
+
+        if (!readSuccess) {
             return _ReloadFailed;
         }
 
@@ -1061,6 +1093,15 @@ SdfLayer::Find(const string &identifier,
         return TfNullPtr;
     }
 
+    // Consult the registry's sharded identifier table first to avoid
+    // contending on the global registry mutex in the common case where the
+    // layer is already open.
+    if (SdfLayerRefPtr layer =
+        _layerRegistry->FindAndAcquire(layerInfo.identifier)) {
+        return layer->_WaitForInitializationAndCheckIfSuccessful() ?
+            layer : TfNullPtr;
+    }
+
     // First see if this layer is already present.
     tbb::queuing_rw_mutex::scoped_lock
         lock(_GetLayerRegistryMutex(), /*write=*/false);
@@ -2136,6 +2177,26 @@ _DoEdit(const SdfLayerHandle& layer, const SdfNamespaceEdit& edit)
     }
 }
 
+// Returns true if \p edit removes a prim.
+static bool
+_IsPrimRemoveEdit(const SdfNamespaceEdit& edit)
+{
+    return edit.currentPath.IsPrimPath() && edit.newPath.IsEmpty();
+}
+
+// Returns true if \p edit moves a prim under a different parent and
+// appends it to that parent's children.  (For a reparenting edit both
+// Same and AtEnd mean "append at the end".)
+static bool
+_IsPrimReparentAppendEdit(const SdfNamespaceEdit& edit)
+{
+    return edit.currentPath.IsPrimPath() &&
+           edit.newPath.IsPrimPath() &&
+           edit.newPath.GetParentPath() != edit.currentPath.GetParentPath() &&
+           (edit.index == SdfNamespaceEdit::AtEnd ||
+            edit.index == SdfNamespaceEdit::Same);
+}
+
 SdfNamespaceEditDetail::Result
 SdfLayer::CanApply(
     const SdfBatchNamespaceEdit& edits,
@@ -2173,8 +2234,146 @@ SdfLayer::Apply(const SdfBatchNamespaceEdit& edits)
     }
 
     SdfChangeBlock block;
-    for (const auto& edit : final) {
+
+    // Apply the edits.  Runs of consecutive edits that remove prims from
+    // one parent, or reparent prims from one parent to the end of another
+    // parent's children, are applied as a group so that each affected
+    // children list is rewritten once per run instead of once per edit.
+    // Rewriting a long sibling list for every edit makes reorganizing a
+    // large flat set of prims quadratic in the number of siblings.
+    for (size_t i = 0, n = final.size(); i != n; ) {
+        const SdfNamespaceEdit& edit = final[i];
+        size_t j = i + 1;
+
+        if (_IsPrimRemoveEdit(edit)) {
+            const SdfPath parentPath = edit.currentPath.GetParentPath();
+            while (j != n && _IsPrimRemoveEdit(final[j]) &&
+                   final[j].currentPath.GetParentPath() == parentPath) {
+                ++j;
+            }
+            if (j - i > 1) {
+                std::vector<TfToken> keys;
+                keys.reserve(j - i);
+                for (size_t k = i; k != j; ++k) {
+                    keys.push_back(final[k].currentPath.GetNameToken());
+                }
+                Sdf_ChildrenUtils<Sdf_PrimChildPolicy>::
+                    RemoveChildrenForBatchNamespaceEdit(
+                        self, parentPath, keys);
+                i = j;
+                continue;
+            }
+        }
+        else if (_IsPrimReparentAppendEdit(edit)) {
+            const SdfPath oldParentPath = edit.currentPath.GetParentPath();
+            const SdfPath newParentPath = edit.newPath.GetParentPath();
+            while (j != n && _IsPrimReparentAppendEdit(final[j]) &&
+                   final[j].currentPath.GetParentPath() == oldParentPath &&
+                   final[j].newPath.GetParentPath() == newParentPath) {
+                ++j;
+            }
+            if (j - i > 1) {
+                // Earlier edits in the run only remove other children
+                // from the old parent, so it's safe to look up all of
+                // the moved prims before applying any of the edits.
+                std::vector<SdfPrimSpecHandle> values;
+                std::vector<TfToken> newNames;
+                values.reserve(j - i);
+                newNames.reserve(j - i);
+                for (size_t k = i; k != j; ++k) {
+                    values.push_back(GetPrimAtPath(final[k].currentPath));
+                    newNames.push_back(final[k].newPath.GetNameToken());
+                }
+                Sdf_ChildrenUtils<Sdf_PrimChildPolicy>::
+                    MoveChildrenForBatchNamespaceEdit(
+                        self, newParentPath, values, newNames);
+                i = j;
+                continue;
+            }
+        }
+
         _DoEdit(self, edit);
+        ++i;
+    }
+
+    return true;
+}
+
+// Creates a spec recorded in an edit journal, dispatching to the
+// children utils for the appropriate child policy so that the parent's
+// children field is updated along with the spec itself.
+static bool
+_CreateJournaledSpec(
+    const SdfLayerHandle& layer, const SdfPath& path,
+    SdfSpecType specType, bool inert)
+{
+    switch (specType) {
+    case SdfSpecTypePrim:
+        return Sdf_ChildrenUtils<Sdf_PrimChildPolicy>::CreateSpec(
+            layer, path, specType, inert);
+    case SdfSpecTypeAttribute:
+        return Sdf_ChildrenUtils<Sdf_AttributeChildPolicy>::CreateSpec(
+            layer, path, specType, inert);
+    case SdfSpecTypeRelationship:
+        return Sdf_ChildrenUtils<Sdf_RelationshipChildPolicy>::CreateSpec(
+            layer, path, specType, inert);
+    case SdfSpecTypeVariantSet:
+        return Sdf_ChildrenUtils<Sdf_VariantSetChildPolicy>::CreateSpec(
+            layer, path, specType, inert);
+    case SdfSpecTypeVariant:
+        return Sdf_ChildrenUtils<Sdf_VariantChildPolicy>::CreateSpec(
+            layer, path, specType, inert);
+    case SdfSpecTypeConnection:
+        return Sdf_ChildrenUtils<Sdf_AttributeConnectionChildPolicy>::
+            CreateSpec(layer, path, specType, inert);
+    case SdfSpecTypeRelationshipTarget:
+        return Sdf_ChildrenUtils<Sdf_RelationshipTargetChildPolicy>::
+            CreateSpec(layer, path, specType, inert);
+    case SdfSpecTypeMapper:
+        return Sdf_ChildrenUtils<Sdf_MapperChildPolicy>::CreateSpec(
+            layer, path, specType, inert);
+    case SdfSpecTypeMapperArg:
+        return Sdf_ChildrenUtils<Sdf_MapperArgChildPolicy>::CreateSpec(
+            layer, path, specType, inert);
+    case SdfSpecTypeExpression:
+        return Sdf_ChildrenUtils<Sdf_ExpressionChildPolicy>::CreateSpec(
+            layer, path, specType, inert);
+    default:
+        TF_CODING_ERROR(
+            "Cannot create journaled spec of type %s at <%s>",
+            TfEnum::GetName(specType).c_str(), path.GetText());
+        return false;
+    }
+}
+
+bool
+SdfLayer::Apply(const SdfEditJournal& journal)
+{
+    if (!PermissionToEdit()) {
+        TF_CODING_ERROR("Cannot apply edit journal: layer @%s@ is not "
+                        "editable", GetIdentifier().c_str());
+        return false;
+    }
+
+    SdfLayerHandle self(this);
+
+    // Replay the journal in recorded order inside one change block so
+    // that the resulting notification goes out as a single batch.
+    SdfChangeBlock block;
+    for (const SdfEditJournal::_Edit& edit : journal._edits) {
+        switch (edit.op) {
+        case SdfEditJournal::_Edit::_CreateSpec:
+            _CreateJournaledSpec(self, edit.path, edit.specType, edit.inert);
+            break;
+        case SdfEditJournal::_Edit::_SetField:
+            SetField(SdfAbstractDataSpecId(&edit.path), edit.field,
+                     edit.value);
+            break;
+        case SdfEditJournal::_Edit::_SetTimeSample:
+            SetTimeSample(SdfAbstractDataSpecId(&edit.path), edit.time,
+                          edit.value);
+            break;
+        }
     }
 
     return true;
@@ -2795,14 +2994,36 @@ SdfLayer::TransferContent(const SdfLayerHandle& layer)
     // multiple layers to be sharing the same data object, so we
     // have to make a copy of the data here.
     //
+    // When both layers stream their data we avoid that copy entirely:
+    // each layer is given an Sdf_CopyOnWriteData wrapper over the same
+    // underlying data, so the transfer is zero-copy and the first edit
+    // on either layer detaches it into data created by its own format.
 
     bool notify = _ShouldNotify();
     bool isStreamingLayer = _data->StreamsData();
     SdfAbstractDataRefPtr newData;
 
     if (!notify || isStreamingLayer) {
-        newData = GetFileFormat()->InitData(GetFileFormatArguments());
-        newData->CopyFrom(layer->_data);
+        if (isStreamingLayer && layer->_data->StreamsData()) {
+            // If the source data is already a copy-on-write wrapper,
+            // share what it wraps rather than stacking wrappers.
+            SdfAbstractDataRefPtr sharedData = layer->_data;
+            if (Sdf_CopyOnWriteDataRefPtr cowData =
+                TfDynamic_cast<Sdf_CopyOnWriteDataRefPtr>(sharedData)) {
+                sharedData = cowData->GetUnderlyingData();
+            }
+            newData = TfCreateRefPtr(new Sdf_CopyOnWriteData(
+                sharedData, GetFileFormat(), GetFileFormatArguments()));
+            // Re-wrap the source layer over the same data so that edits
+            // to it also detach instead of bleeding into this layer.
+            layer->_data = TfCreateRefPtr(new Sdf_CopyOnWriteData(
+                sharedData, layer->GetFileFormat(),
+                layer->GetFileFormatArguments()));
+        }
+        else {
+            newData = GetFileFormat()->InitData(GetFileFormatArguments());
+            newData->CopyFrom(layer->_data);
+        }
     }
     else {
         newData = layer->_data;
@@ -3112,6 +3333,12 @@ SdfLayer::ListFields(const SdfAbstractDataSpecId& id) const
     return _data->List(id);
 }
 
+size_t
+SdfLayer::GetSpecContentsHash(const SdfPath& path) const
+{
+    return _data->GetSpecContentsHash(SdfAbstractDataSpecId(&path));
+}
+
 bool
 SdfLayer::HasField(const SdfAbstractDataSpecId& id, const TfToken& fieldName,
                    VtValue *value) const
@@ -3205,6 +3432,56 @@ SdfLayer::GetField(const SdfAbstractDataSpecId& id,
     return result;
 }
 
+std::vector<VtValue>
+SdfLayer::GetFields(const SdfAbstractDataSpecId& id,
+                    const std::vector<TfToken>& fieldNames) const
+{
+    std::vector<VtValue> values(fieldNames.size());
+    if (fieldNames.empty()) {
+        return values;
+    }
+
+    _data->GetFields(id, fieldNames.data(), values.data(), fieldNames.size());
+
+    // As in GetField, fields with no authored value fall back to the
+    // required field fallback, if one applies.
+    for (size_t i = 0, n = fieldNames.size(); i != n; ++i) {
+        if (values[i].IsEmpty()) {
+            if (SdfSchema::FieldDefinition const *def =
+                _GetRequiredFieldDef(id, fieldNames[i])) {
+                values[i] = def->GetFallbackValue();
+            }
+        }
+    }
+    return values;
+}
+
+std::vector<VtValue>
+SdfLayer::GetFieldForPaths(const SdfPathVector& paths,
+                           const TfToken& fieldName) const
+{
+    std::vector<VtValue> values(paths.size());
+    if (paths.empty()) {
+        return values;
+    }
+
+    _data->GetFieldForPaths(
+        paths.data(), paths.size(), fieldName, values.data());
+
+    // As in GetField, fields with no authored value fall back to the
+    // required field fallback, if one applies.
+    for (size_t i = 0, n = paths.size(); i != n; ++i) {
+        if (values[i].IsEmpty()) {
+            const SdfAbstractDataSpecId id(&paths[i]);
+            if (SdfSchema::FieldDefinition const *def =
+                _GetRequiredFieldDef(id, fieldName)) {
+                values[i] = def->GetFallbackValue();
+            }
+        }
+    }
+    return values;
+}
+
 VtValue
 SdfLayer::GetFieldDictValueByKey(const SdfAbstractDataSpecId& id,
                                  const TfToken& fieldName,
@@ -3427,12 +3704,20 @@ SdfLayer::_SetData(const SdfAbstractDataPtr &newData)
     // of Sd.  Do all this in a single changeblock.
     SdfChangeBlock block;
 
-    // If this layer streams its data on demand, we cannot perform 
-    // fine-grained change notification because that would cause all of 
-    // the data in the layer to be streamed in from disk.
-    // So, all we can do is move the new data into place and
-    // notify the world that this layer may have changed arbitrarily.
-    if (_data->StreamsData()) {
+    // If this layer streams its data on demand, fine-grained change
+    // notification would cause all of the data in the layer to be
+    // streamed in from disk.  That cost is unjustifiable for operations
+    // like muting or transferring content, so for those we just move the
+    // new data into place and notify the world that this layer may have
+    // changed arbitrarily.  On reload, however, streaming in both sides
+    // to diff them is typically far cheaper than the recomposition of
+    // everything depending on this layer that a coarse invalidation
+    // triggers, so there we fall through to the fine-grained path.
+    // (This relies on the old data remaining readable, which holds for
+    // the usual save-then-rename write pattern.)
+    if (_data->StreamsData() &&
+        !(_reloadingData &&
+          TfGetEnvSetting(SDF_LAYER_INCREMENTAL_RELOAD))) {
         _data = newData;
         Sdf_ChangeManager::Get()
             .DidReplaceLayerContent(SdfCreateHandle(this));
@@ -4239,6 +4524,72 @@ SdfLayer::Save(bool force) const
     return _Save(force);
 }
 
+bool
+SdfLayer::SaveSnapshot()
+{
+    TRACE_FUNCTION();
+
+    if (IsMuted()) {
+        TF_CODING_ERROR("Cannot save muted layer @%s@",
+                        GetIdentifier().c_str());
+        return false;
+    }
+
+    if (IsAnonymous()) {
+        TF_CODING_ERROR("Cannot save anonymous layer @%s@",
+            GetIdentifier().c_str());
+        return false;
+    }
+
+    string path(GetRealPath());
+    if (path.empty())
+        return false;
+
+    if (!PermissionToSave()) {
+        TF_RUNTIME_ERROR("Cannot save layer @%s@, saving not allowed",
+                         path.c_str());
+        return false;
+    }
+
+    // Skip scheduling a write if the file exists and the layer is clean.
+    if (!IsDirty() && TfPathExists(path))
+        return true;
+
+    // Atomically capture a copy-on-write reference to the current data
+    // and leave this layer holding a copy-on-write wrapper around it.
+    // Subsequent edits to this layer detach it from the shared data
+    // rather than mutating it, so the background write serializes a
+    // stable snapshot of the contents as of this call.
+    SdfAbstractDataRefPtr sharedData = _data;
+    if (Sdf_CopyOnWriteDataRefPtr cowData =
+        TfDynamic_cast<Sdf_CopyOnWriteDataRefPtr>(sharedData)) {
+        sharedData = cowData->GetUnderlyingData();
+    }
+    _data = TfCreateRefPtr(new Sdf_CopyOnWriteData(
+        sharedData, GetFileFormat(), GetFileFormatArguments()));
+
+    // Build a transient layer around the snapshot data to serialize
+    // from.  The snapshot layer shares the data; it is never edited and
+    // is dropped when the write completes.
+    SdfLayerRefPtr snapshot = CreateAnonymous(
+        GetDisplayName(), GetFileFormat(), GetFileFormatArguments());
+    SdfAbstractDataRefPtr snapshotData = sharedData;
+    snapshot->_SwapData(snapshotData);
+
+    const SdfFileFormatConstPtr fileFormat = GetFileFormat();
+    const FileFormatArguments args = GetFileFormatArguments();
+    WorkRunDetachedTask(
+        [snapshot, fileFormat, path, args]() {
+            if (!snapshot->_WriteToFile(path, std::string(),
+                                        fileFormat, args)) {
+                TF_RUNTIME_ERROR(
+                    "Failed to write layer snapshot to @%s@", path.c_str());
+            }
+        });
+
+    return true;
+}
+
 bool
 SdfLayer::_Save(bool force) const
 {
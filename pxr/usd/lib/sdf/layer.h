@@ -55,6 +55,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 TF_DECLARE_WEAK_PTRS(SdfFileFormat);
 TF_DECLARE_WEAK_AND_REF_PTRS(SdfLayerStateDelegateBase);
 
+class SdfEditJournal;
 struct Sdf_AssetInfo;
 
 /// \class SdfLayer 
@@ -291,6 +292,27 @@ public:
     SDF_API
     bool Save(bool force = false) const;
 
+    /// Saves a snapshot of the layer's current contents to its file on a
+    /// background thread.
+    ///
+    /// The layer's data is captured atomically on the calling thread by
+    /// taking a copy-on-write reference, so this call returns without
+    /// waiting for serialization.  The layer remains editable while the
+    /// write is in flight;  the first edit after the snapshot detaches
+    /// the layer from the shared data, and edits are never included in
+    /// the saved file.  This is intended for autosave, where blocking
+    /// the calling thread for the full serialization is unacceptable.
+    ///
+    /// Returns \c true if the snapshot was captured and the write was
+    /// scheduled, \c false if the layer cannot be saved.  Write errors
+    /// on the background thread are reported as runtime errors.  Unlike
+    /// Save(), this does not mark the layer clean, update the recorded
+    /// asset modification timestamp, or send LayerDidSaveLayerToFile;
+    /// a subsequent Save() will do so and is cheap if no edits were
+    /// made since the snapshot.
+    SDF_API
+    bool SaveSnapshot();
+
     /// Exports this layer to a file.
     /// Returns \c true if successful, \c false if an error occurred.
     ///
@@ -597,6 +619,26 @@ public:
     VtValue GetField(const SdfAbstractDataSpecId& id,
                      const TfToken& fieldName) const;
 
+    /// Return the value of each field named in \a fieldNames for the spec
+    /// at \a id, in the same order.  Fields with no value yield an empty
+    /// value.  Equivalent to calling GetField() once per name, but
+    /// resolves all of the fields with a single query of the underlying
+    /// data, which is substantially cheaper when fetching many fields.
+    SDF_API
+    std::vector<VtValue> GetFields(
+        const SdfAbstractDataSpecId& id,
+        const std::vector<TfToken>& fieldNames) const;
+
+    /// Return the value of the field named \a fieldName for the spec at
+    /// each path in \a paths, in the same order.  Specs with no value for
+    /// the field yield an empty value.  Equivalent to calling GetField()
+    /// once per path, but resolves all of the values with a single query
+    /// of the underlying data.
+    SDF_API
+    std::vector<VtValue> GetFieldForPaths(
+        const SdfPathVector& paths,
+        const TfToken& fieldName) const;
+
     /// Return the value for the given \a id and \a fieldName. Returns the
     /// provided \a defaultValue value if none is set.
     template <class T>
@@ -690,6 +732,15 @@ public:
     SDF_API
     std::vector<TfToken> ListFields(const SdfPath& path) const;
 
+    /// Return a hash of the contents of the spec at \p path: its spec type
+    /// and the names and values of all of its fields.  Returns zero if no
+    /// spec exists at \p path.  The hash is independent of how the layer's
+    /// data is stored, so it may be compared across layers of different
+    /// file formats.
+    /// \sa SdfAbstractData::GetSpecContentsHash
+    SDF_API
+    size_t GetSpecContentsHash(const SdfPath& path) const;
+
     template <class T>
     bool HasField(const SdfPath& path,
                   const TfToken& fieldName, T* value) const;
@@ -1305,6 +1356,17 @@ public:
     SDF_API
     bool Apply(const SdfBatchNamespaceEdit&);
 
+    /// Applies the edits recorded in \p journal to this layer, in the
+    /// order they were recorded, inside a single SdfChangeBlock.  The
+    /// change block coalesces the resulting change notification into one
+    /// batch, so downstream consumers process the edits in a single pass.
+    /// Returns \c true on success; returns \c false and performs no edits
+    /// if this layer does not permit editing.
+    ///
+    /// \sa SdfEditJournal
+    SDF_API
+    bool Apply(const SdfEditJournal& journal);
+
     /// @}
     /// \name Layer state
     /// @{
@@ -1772,6 +1834,11 @@ private:
     // Whether layer edits are validated.
     bool _validateAuthoring;
 
+    // True while _Reload() is installing freshly read data.  This lets
+    // _SetData() diff data implementations that stream data on demand
+    // instead of sending a coarse content-replaced change.  See _SetData().
+    bool _reloadingData;
+
     // Allow access to _ValidateAuthoring() and _IsInert().
     friend class SdfSpec;
     friend class SdfPropertySpec;
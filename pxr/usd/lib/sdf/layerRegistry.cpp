@@ -34,6 +34,7 @@
 #include "pxr/usd/ar/resolver.h"
 #include "pxr/base/trace/trace.h"
 #include "pxr/base/tf/pathUtils.h"
+#include "pxr/base/tf/weakPtr.h"
 #include "pxr/base/tf/registryManager.h"
 #include "pxr/base/tf/staticData.h"
 #include <boost/format.hpp>
@@ -114,6 +115,68 @@ Sdf_LayerRegistry::Sdf_LayerRegistry()
 {
 }
 
+Sdf_LayerRegistry::_Shard&
+Sdf_LayerRegistry::_GetShard(
+    const string& identifier) const
+{
+    return _shards[TfHash()(identifier) % _NumShards];
+}
+
+void
+Sdf_LayerRegistry::_InsertOrUpdateSharded(
+    const SdfLayerHandle& layer)
+{
+    const string identifier = layer->GetIdentifier();
+
+    _ShardKeyMap::iterator keyIt = _shardKeys.find(layer);
+    if (keyIt != _shardKeys.end()) {
+        if (keyIt->second == identifier) {
+            // The layer is already filed under its current identifier.
+            return;
+        }
+
+        // The layer has been re-keyed (e.g. by SetIdentifier); remove the
+        // entry filed under the old identifier. Only erase the entry if it
+        // still refers to this layer -- it may have been overwritten by
+        // another layer sharing the old identifier.
+        _Shard& oldShard = _GetShard(keyIt->second);
+        {
+            tbb::spin_rw_mutex::scoped_lock lock(oldShard.mutex);
+            _ShardMap::iterator it = oldShard.layers.find(keyIt->second);
+            if (it != oldShard.layers.end() && it->second == layer) {
+                oldShard.layers.erase(it);
+            }
+        }
+        keyIt->second = identifier;
+    } else {
+        _shardKeys.insert(std::make_pair(layer, identifier));
+    }
+
+    _Shard& shard = _GetShard(identifier);
+    tbb::spin_rw_mutex::scoped_lock lock(shard.mutex);
+    shard.layers[identifier] = layer;
+}
+
+void
+Sdf_LayerRegistry::_EraseSharded(
+    const SdfLayerHandle& layer)
+{
+    _ShardKeyMap::iterator keyIt = _shardKeys.find(layer);
+    if (keyIt == _shardKeys.end()) {
+        return;
+    }
+
+    _Shard& shard = _GetShard(keyIt->second);
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(shard.mutex);
+        _ShardMap::iterator it = shard.layers.find(keyIt->second);
+        if (it != shard.layers.end() && it->second == layer) {
+            shard.layers.erase(it);
+        }
+    }
+    _shardKeys.erase(keyIt);
+}
+
 struct update_index_only {
     void operator()(const SdfLayerHandle&) { }
 };
@@ -153,8 +216,12 @@ Sdf_LayerRegistry::InsertOrUpdate(
                 Sdf_LayerDebugRepr(layer).c_str(),
                 existingLayer->GetFileFormat()->GetFormatId().GetText(),
                 Sdf_LayerDebugRepr(existingLayer).c_str());
+            return;
         }
     }
+
+    // Keep the sharded identifier table in sync with the identifier index.
+    _InsertOrUpdateSharded(layer);
 }
 
 void
@@ -162,6 +229,7 @@ Sdf_LayerRegistry::Erase(
     const SdfLayerHandle& layer)
 {
     bool erased = _layers.erase(layer);
+    _EraseSharded(layer);
 
     TF_DEBUG(SDF_LAYER).Msg(
         "Sdf_LayerRegistry::Erase(%s) => %s\n",
@@ -223,6 +291,48 @@ Sdf_LayerRegistry::Find(
     return foundLayer;
 }
 
+SdfLayerRefPtr
+Sdf_LayerRegistry::FindAndAcquire(
+    const string &inputLayerPath) const
+{
+    TRACE_FUNCTION();
+
+    string layerPath = inputLayerPath;
+    if (!Sdf_IsAnonLayerIdentifier(layerPath)) {
+        // Mirror the identifier lookups in Find(): normalize the path and,
+        // if it is relative, anchor it to the current working directory.
+        ArResolver& resolver = ArGetResolver();
+        layerPath = resolver.ComputeNormalizedPath(layerPath);
+        if (resolver.IsRelativePath(layerPath)) {
+            layerPath = TfNormPath(TfAbsPath(layerPath));
+        }
+    }
+
+    SdfLayerRefPtr foundLayer;
+
+    _Shard& shard = _GetShard(layerPath);
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(shard.mutex, /*write=*/false);
+        _ShardMap::const_iterator it = shard.layers.find(layerPath);
+        if (it != shard.layers.end()) {
+            // Holding the shard lock for reading protects the layer from
+            // destruction during the promotion: ~SdfLayer erases the
+            // layer's shard entry, which requires the shard lock for
+            // writing, before the TfRefBase is destroyed. If the layer is
+            // expiring (ref-count already zero) this returns null and the
+            // caller falls back to Find() under the registry lock.
+            foundLayer = TfCreateRefPtrFromProtectedWeakPtr(it->second);
+        }
+    }
+
+    TF_DEBUG(SDF_LAYER).Msg(
+        "Sdf_LayerRegistry::FindAndAcquire('%s') => %s\n",
+        inputLayerPath.c_str(),
+        foundLayer ? "Found" : "Not Found");
+
+    return foundLayer;
+}
+
 SdfLayerHandle
 Sdf_LayerRegistry::FindByIdentifier(
     const string& layerPath) const
@@ -29,12 +29,15 @@
 #include "pxr/pxr.h"
 #include "pxr/usd/sdf/declareHandles.h"
 #include "pxr/base/tf/hash.h"
+#include "pxr/base/tf/hashmap.h"
 
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/identity.hpp>
 #include <boost/noncopyable.hpp>
 
+#include <tbb/spin_rw_mutex.h>
+
 #include <string>
 #include <iosfwd>
 
@@ -70,6 +73,16 @@ public:
     SdfLayerHandle Find(const std::string &layerPath,
                         const std::string &resolvedPath=std::string()) const;
 
+    /// Returns a layer from the registry with an ownership stake, consulting
+    /// only the sharded identifier table. Unlike the other lookup functions,
+    /// this may be called without holding the global registry lock, and does
+    /// not contend with concurrent calls for other identifiers. Returns a
+    /// null ref pointer if no layer is registered under \p layerPath, if the
+    /// registered layer is expiring, or if the layer is registered under a
+    /// repository or real path that differs from its identifier; callers
+    /// must fall back to Find() under the registry lock in those cases.
+    SdfLayerRefPtr FindAndAcquire(const std::string &layerPath) const;
+
     /// Returns a layer from the registry, consulting the by_identifier index
     /// with the \p layerPath as provided.
     SdfLayerHandle FindByIdentifier(const std::string& layerPath) const;
@@ -157,7 +170,42 @@ private:
     // Repository path index.
     typedef _Layers::index<by_repository_path>::type _LayersByRepositoryPath;
 
+    // In addition to the identifier index above, layers are filed by
+    // identifier into a table sharded by identifier hash, so that
+    // FindAndAcquire() calls for different layers do not contend on a
+    // single lock. Each shard's map is guarded by its own reader-writer
+    // mutex; the maps are only mutated by InsertOrUpdate() and Erase(),
+    // whose callers serialize against each other with the global registry
+    // lock.
+    static const size_t _NumShards = 32;
+
+    typedef TfHashMap<std::string, SdfLayerHandle, TfHash> _ShardMap;
+    struct _Shard {
+        tbb::spin_rw_mutex mutex;
+        _ShardMap layers;
+    };
+
+    // Returns the shard in which \p identifier is filed.
+    _Shard& _GetShard(const std::string& identifier) const;
+
+    // Files \p layer in the sharded identifier table under its current
+    // identifier, removing any entry filed under a previous identifier.
+    void _InsertOrUpdateSharded(const SdfLayerHandle& layer);
+
+    // Removes \p layer from the sharded identifier table. The shard lock
+    // is held for writing while the entry is erased, which is what makes
+    // the weak-to-ref promotion in FindAndAcquire() safe; see there.
+    void _EraseSharded(const SdfLayerHandle& layer);
+
     _Layers _layers;
+
+    mutable _Shard _shards[_NumShards];
+
+    // Maps each registered layer to the identifier under which it is
+    // currently filed in _shards. Like _layers, only accessed with the
+    // global registry lock held for writing.
+    typedef TfHashMap<SdfLayerHandle, std::string, TfHash> _ShardKeyMap;
+    _ShardKeyMap _shardKeys;
 };
 
 std::ostream&
@@ -34,6 +34,10 @@
 #include "pxr/usd/ar/resolver.h"
 #include "pxr/base/tf/pathUtils.h"
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
+
+#include <algorithm>
+#include <iterator>
 
 using std::string;
 
@@ -226,4 +230,68 @@ SdfFindOrOpenRelativeToLayer(
     return SdfLayer::FindOrOpen(*layerPath, args);
 }
 
+static std::vector<SdfPath>
+_CollectSpecPaths(const SdfLayerHandle& layer)
+{
+    std::vector<SdfPath> paths;
+    layer->Traverse(SdfPath::AbsoluteRootPath(),
+                    [&paths](const SdfPath& path) {
+                        paths.push_back(path);
+                    });
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+SdfPathVector
+SdfComputeDifferingSpecPaths(
+    const SdfLayerHandle& baseline,
+    const SdfLayerHandle& comparison)
+{
+    TRACE_FUNCTION();
+
+    if (!baseline || !comparison) {
+        TF_CODING_ERROR("Invalid layer");
+        return SdfPathVector();
+    }
+
+    const std::vector<SdfPath> baselinePaths = _CollectSpecPaths(baseline);
+    const std::vector<SdfPath> comparisonPaths = _CollectSpecPaths(comparison);
+
+    // Paths with a spec in only one layer differ by definition.
+    SdfPathVector differingPaths;
+    std::set_symmetric_difference(
+        baselinePaths.begin(), baselinePaths.end(),
+        comparisonPaths.begin(), comparisonPaths.end(),
+        std::back_inserter(differingPaths));
+
+    // Paths with a spec in both layers differ when their content hashes
+    // do.  The hash computations are independent, so fan them out.
+    std::vector<SdfPath> commonPaths;
+    std::set_intersection(
+        baselinePaths.begin(), baselinePaths.end(),
+        comparisonPaths.begin(), comparisonPaths.end(),
+        std::back_inserter(commonPaths));
+
+    std::vector<char> specDiffers(commonPaths.size(), 0);
+    WorkParallelForN(commonPaths.size(),
+        [&baseline, &comparison, &commonPaths, &specDiffers](
+            size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                if (baseline->GetSpecContentsHash(commonPaths[i]) !=
+                    comparison->GetSpecContentsHash(commonPaths[i])) {
+                    specDiffers[i] = 1;
+                }
+            }
+        });
+
+    for (size_t i = 0; i != commonPaths.size(); ++i) {
+        if (specDiffers[i]) {
+            differingPaths.push_back(commonPaths[i]);
+        }
+    }
+
+    std::sort(differingPaths.begin(), differingPaths.end());
+    return differingPaths;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
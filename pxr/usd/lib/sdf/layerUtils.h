@@ -60,13 +60,28 @@ SdfComputeAssetPathRelativeToLayer(
 /// If the \p anchor layer is invalid, the \p layerPath pointer is invalid, or
 /// \p layerPath contains an empty string, a coding error is raised and a null
 /// layer is returned.
-SDF_API SdfLayerRefPtr 
+SDF_API SdfLayerRefPtr
 SdfFindOrOpenRelativeToLayer(
     const SdfLayerHandle& anchor,
     std::string* layerPath,
-    const SdfLayer::FileFormatArguments& args 
+    const SdfLayer::FileFormatArguments& args
         = SdfLayer::FileFormatArguments());
 
+/// Compares the scene description in \p baseline and \p comparison and
+/// returns the sorted set of spec paths whose content differs: paths with
+/// a spec in only one of the two layers, and paths whose spec content
+/// hashes differ between them.  Content hashes for specs present in both
+/// layers are computed in parallel, and matching specs are never
+/// materialized as text, which makes this suitable for comparing large
+/// binary layers directly.  Returns an empty vector when the layers'
+/// contents match.
+///
+/// \sa SdfLayer::GetSpecContentsHash
+SDF_API SdfPathVector
+SdfComputeDifferingSpecPaths(
+    const SdfLayerHandle& baseline,
+    const SdfLayerHandle& comparison);
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif // SDF_LAYER_UTILS_H
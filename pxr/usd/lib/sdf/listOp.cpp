@@ -311,6 +311,12 @@ template <typename T>
 boost::optional<SdfListOp<T>>
 SdfListOp<T>::ApplyOperations(const SdfListOp<T> &inner) const
 {
+    if (!HasKeys()) {
+        // No opinions of our own, so the composition is just the weaker
+        // op.  Notably, this composes over weaker added or ordered items,
+        // which the general paths below cannot represent.
+        return inner;
+    }
     if (IsExplicit()) {
         // Explicit list-op replaces the result entirely.
         return *this;
@@ -330,32 +336,103 @@ SdfListOp<T>::ApplyOperations(const SdfListOp<T> &inner) const
              ItemVector pre = inner.GetPrependedItems();
              ItemVector app = inner.GetAppendedItems();
 
-             // Apply deletes
-             for (const auto &x: GetDeletedItems()) {
-                pre.erase(std::remove(pre.begin(), pre.end(), x), pre.end());
-                app.erase(std::remove(app.begin(), app.end(), x), app.end());
-                if (std::find(del.begin(), del.end(), x) == del.end()) {
-                    del.push_back(x);
-                }
-             }
-             // Apply prepends
-             for (const auto &x: GetPrependedItems()) {
-                del.erase(std::remove(del.begin(), del.end(), x), del.end());
-                pre.erase(std::remove(pre.begin(), pre.end(), x), pre.end());
-                app.erase(std::remove(app.begin(), app.end(), x), app.end());
+             const size_t numOps = GetDeletedItems().size() +
+                 GetPrependedItems().size() + GetAppendedItems().size();
+             const size_t numItems = del.size() + pre.size() + app.size();
+
+             if (numOps + numItems > 128) {
+                 // The item-by-item scans below are quadratic; for large
+                 // lists (collection-heavy relationship targets), compose
+                 // with set-assisted single passes over each list instead.
+                 // These produce exactly the results of the sequential
+                 // edits in the branch below.
+                 typedef std::set<ItemType, _ItemComparator> _ItemSet;
+                 const _ItemSet sDel(GetDeletedItems().begin(),
+                                     GetDeletedItems().end());
+                 const _ItemSet sPre(GetPrependedItems().begin(),
+                                     GetPrependedItems().end());
+                 const _ItemSet sApp(GetAppendedItems().begin(),
+                                     GetAppendedItems().end());
+                 const _ItemSet innerDel(del.begin(), del.end());
+
+                 // A stronger prepend or append overrides any delete, and
+                 // relocates the item, so drop such items everywhere first.
+                 const auto readded = [&sPre, &sApp](const ItemType &x) {
+                     return sPre.count(x) || sApp.count(x);
+                 };
+                 const auto removedOrReadded =
+                     [&sDel, &readded](const ItemType &x) {
+                         return sDel.count(x) || readded(x);
+                     };
+                 del.erase(std::remove_if(del.begin(), del.end(), readded),
+                           del.end());
+                 pre.erase(std::remove_if(pre.begin(), pre.end(),
+                                          removedOrReadded), pre.end());
+                 app.erase(std::remove_if(app.begin(), app.end(),
+                                          removedOrReadded), app.end());
+
+                 // Append our deletes not already deleted by the weaker op
+                 // (and not overridden by our own prepends or appends),
+                 // each at most once, as in the sequential edits.
+                 _ItemSet appendedDel;
+                 for (const auto &x: GetDeletedItems()) {
+                     if (!innerDel.count(x) && !readded(x) &&
+                         appendedDel.insert(x).second) {
+                         del.push_back(x);
+                     }
+                 }
+                 // Our prepends go in front; an item both prepended and
+                 // appended by us ends up appended, as in the edits below.
+                 ItemVector newPre;
+                 newPre.reserve(GetPrependedItems().size() + pre.size());
+                 for (const auto &x: GetPrependedItems()) {
+                     if (!sApp.count(x)) {
+                         newPre.push_back(x);
+                     }
+                 }
+                 newPre.insert(newPre.end(), pre.begin(), pre.end());
+                 pre.swap(newPre);
+                 // And our appends go at the end.
+                 app.insert(app.end(),
+                            GetAppendedItems().begin(),
+                            GetAppendedItems().end());
              }
-             pre.insert(pre.begin(),
-                        GetPrependedItems().begin(),
-                        GetPrependedItems().end());
-             // Apply appends
-             for (const auto &x: GetAppendedItems()) {
-                del.erase(std::remove(del.begin(), del.end(), x), del.end());
-                pre.erase(std::remove(pre.begin(), pre.end(), x), pre.end());
-                app.erase(std::remove(app.begin(), app.end(), x), app.end());
+             else {
+                 // Apply deletes
+                 for (const auto &x: GetDeletedItems()) {
+                    pre.erase(std::remove(pre.begin(), pre.end(), x),
+                              pre.end());
+                    app.erase(std::remove(app.begin(), app.end(), x),
+                              app.end());
+                    if (std::find(del.begin(), del.end(), x) == del.end()) {
+                        del.push_back(x);
+                    }
+                 }
+                 // Apply prepends
+                 for (const auto &x: GetPrependedItems()) {
+                    del.erase(std::remove(del.begin(), del.end(), x),
+                              del.end());
+                    pre.erase(std::remove(pre.begin(), pre.end(), x),
+                              pre.end());
+                    app.erase(std::remove(app.begin(), app.end(), x),
+                              app.end());
+                 }
+                 pre.insert(pre.begin(),
+                            GetPrependedItems().begin(),
+                            GetPrependedItems().end());
+                 // Apply appends
+                 for (const auto &x: GetAppendedItems()) {
+                    del.erase(std::remove(del.begin(), del.end(), x),
+                              del.end());
+                    pre.erase(std::remove(pre.begin(), pre.end(), x),
+                              pre.end());
+                    app.erase(std::remove(app.begin(), app.end(), x),
+                              app.end());
+                 }
+                 app.insert(app.end(),
+                            GetAppendedItems().begin(),
+                            GetAppendedItems().end());
              }
-             app.insert(app.end(),
-                        GetAppendedItems().begin(),
-                        GetAppendedItems().end());
 
             SdfListOp<T> r;
             r.SetDeletedItems(del);
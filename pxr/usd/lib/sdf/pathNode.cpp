@@ -31,6 +31,7 @@
 #include "pxr/base/tf/hash.h"
 #include "pxr/base/tf/iterator.h"
 #include "pxr/base/tf/mallocTag.h"
+#include "pxr/base/tf/smallVector.h"
 #include "pxr/base/tf/staticData.h"
 #include "pxr/base/tf/stl.h"
 
@@ -59,7 +60,7 @@ static_assert(sizeof(Sdf_PrimPropertyPathNode) == 3 * sizeof(void *), "");
 struct Sdf_PathNodePrivateAccess
 {
     template <class Handle>
-    static inline tbb::atomic<unsigned int> &
+    static inline std::atomic<unsigned int> &
     GetRefCount(Handle h) {
         Sdf_PathNode const *p =
             reinterpret_cast<Sdf_PathNode const *>(h.GetPtr());
@@ -172,7 +173,8 @@ _FindOrCreate(Table &table,
 {
     typename Table::Type::accessor accessor;
     if (table.map.insert(accessor, _MakeParentAnd(parent, args...)) ||
-        Access::GetRefCount(accessor->second).fetch_and_increment() == 0) {
+        Access::GetRefCount(accessor->second).fetch_add(
+            1, std::memory_order_relaxed) == 0) {
         // Either there was no entry in the table, or there was but it had begun
         // dying (another client dropped its refcount to 0).  We have to create
         // a new entry in the table.  When the client that is killing the other
@@ -393,7 +395,9 @@ Sdf_PathNode::_CreatePathToken(Sdf_PathNode const *primPart,
                                        Sdf_PathNode::GetAbsoluteRootNode() : 
                                        Sdf_PathNode::GetRelativeRootNode());
     
-    std::vector<const Sdf_PathNode *> nodes;
+    // Paths are typically short, so walk the nodes into local storage to
+    // avoid a heap allocation in the common case.
+    TfSmallVector<const Sdf_PathNode *, 32> nodes;
     nodes.reserve(primPart->GetElementCount() +
                   (propPart ? propPart->GetElementCount() : 0));
     
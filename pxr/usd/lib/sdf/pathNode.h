@@ -32,7 +32,7 @@
 #include <boost/noncopyable.hpp>
 #include <boost/intrusive_ptr.hpp>
 
-#include <tbb/atomic.h>
+#include <atomic>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -215,7 +215,9 @@ public:
 
     // Return the current ref-count.
     // Meant for diagnostic use.
-    unsigned int GetCurrentRefCount() const { return _refCount; }
+    unsigned int GetCurrentRefCount() const {
+        return _refCount.load(std::memory_order_relaxed);
+    }
 
 protected:
     Sdf_PathNode(Sdf_PathNode const *parent, NodeType nodeType)
@@ -282,7 +284,10 @@ private:
     // Instance variables.  PathNode's size is important to keep small.  Please
     // be mindful of that when making any changes here.
     const Sdf_PathNodeConstRefPtr _parent;
-    mutable tbb::atomic<unsigned int> _refCount;
+    // Ref counts are manipulated with relaxed increments and a
+    // release/acquire decrement rather than fully fenced operations --
+    // path copies are frequent enough that the fences show up in profiles.
+    mutable std::atomic<unsigned int> _refCount;
 
     const short _elementCount;
     const unsigned char _nodeType;
@@ -715,11 +720,17 @@ Sdf_PathNode::GetElement() const
 SDF_API void Sdf_DumpPathStats();
 
 inline void intrusive_ptr_add_ref(const PXR_NS::Sdf_PathNode* p) {
-    ++p->_refCount;
+    // Acquiring a reference to an already-owned node needs no ordering;
+    // the owning reference keeps the node alive.
+    p->_refCount.fetch_add(1, std::memory_order_relaxed);
 }
 inline void intrusive_ptr_release(const PXR_NS::Sdf_PathNode* p) {
-    if (p->_refCount.fetch_and_decrement() == 1)
+    // The release/acquire pair ensures all prior accesses to the node
+    // happen-before its destruction.
+    if (p->_refCount.fetch_sub(1, std::memory_order_release) == 1) {
+        std::atomic_thread_fence(std::memory_order_acquire);
         p->_Destroy();
+    }
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
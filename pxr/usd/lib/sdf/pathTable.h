@@ -28,6 +28,8 @@
 #include "pxr/usd/sdf/api.h"
 #include "pxr/usd/sdf/path.h"
 #include "pxr/base/tf/pointerAndBits.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/threadLimits.h"
 
 #include <boost/iterator/iterator_facade.hpp>
 #include <boost/noncopyable.hpp>
@@ -484,6 +486,193 @@ public:
         return insert(value_type(path, mapped_type())).first->second;
     }
 
+    /// Insert all elements of \a sortedValues, building the tree linkage in
+    /// parallel by subtree partition.  \a sortedValues must be sorted by key
+    /// with SdfPath's less-than, so that ancestor paths precede descendant
+    /// paths and each subtree is contiguous.  This is semantically
+    /// equivalent to insert()-ing each element in order -- default entries
+    /// are created for absent ancestral paths, and elements whose paths are
+    /// already present (or duplicated in \a sortedValues) leave the
+    /// existing values unchanged -- but is substantially faster for bulk
+    /// population of large tables.
+    void InsertInParallel(std::vector<value_type> const &sortedValues) {
+        // Parallel construction assumes it is building every node from
+        // scratch and only pays off for large inputs, so fall back to
+        // one-at-a-time insertion otherwise.
+        static const size_t minParallelSize = 1024;
+        if (!empty() || sortedValues.size() < minParallelSize) {
+            for (value_type const &value : sortedValues)
+                insert(value);
+            return;
+        }
+
+        SdfPath const &absRoot = SdfPath::AbsoluteRootPath();
+        size_t const numValues = sortedValues.size();
+
+        // Partition the input into contiguous chunks, splitting only
+        // between distinct paths so that duplicated input paths stay
+        // within one chunk.  Since subtrees are contiguous in the input,
+        // each chunk covers a set of whole subtrees plus at most a few
+        // subtree tails cut off by its leading boundary.
+        size_t const numChunks = std::max<size_t>(
+            1, std::min<size_t>(WorkGetConcurrencyLimit(),
+                                numValues / (minParallelSize / 2)));
+        std::vector<size_t> starts;
+        starts.reserve(numChunks + 1);
+        starts.push_back(0);
+        for (size_t c = 1; c != numChunks; ++c) {
+            size_t i = c * numValues / numChunks;
+            while (i < numValues &&
+                   sortedValues[i].first == sortedValues[i-1].first) {
+                ++i;
+            }
+            if (i < numValues && i > starts.back())
+                starts.push_back(i);
+        }
+        starts.push_back(numValues);
+
+        // Build each chunk's entries and tree linkage in parallel.  A
+        // chunk walks its paths keeping a stack of the current ancestor
+        // chain, creating default entries for absent ancestors down to the
+        // children of the absolute root.  Ancestors whose subtrees span a
+        // chunk boundary may be created by more than one chunk; the serial
+        // stitching pass below merges such duplicates.
+        std::vector<std::vector<_Entry *> > chunkEntries(starts.size() - 1);
+        WorkParallelForN(
+            chunkEntries.size(),
+            [this, &sortedValues, &starts, &chunkEntries, &absRoot](
+                size_t begin, size_t end) {
+                std::vector<_Entry *> stack;
+                std::vector<SdfPath> ancestors;
+                for (size_t chunk = begin; chunk != end; ++chunk) {
+                    std::vector<_Entry *> &entries = chunkEntries[chunk];
+                    entries.reserve(starts[chunk+1] - starts[chunk]);
+                    stack.clear();
+                    for (size_t i = starts[chunk], e = starts[chunk+1];
+                         i != e; ++i) {
+                        SdfPath const &path = sortedValues[i].first;
+                        // The root entry is created serially below, and
+                        // duplicated paths keep their first value, as with
+                        // insert().
+                        if (path == absRoot ||
+                            (i != starts[chunk] &&
+                             path == sortedValues[i-1].first)) {
+                            continue;
+                        }
+                        // Pop the stack back to the nearest ancestor.
+                        while (!stack.empty() &&
+                               !path.HasPrefix(stack.back()->value.first)) {
+                            stack.pop_back();
+                        }
+                        // Create default entries for ancestors between the
+                        // stack top (or the root) and path.
+                        ancestors.clear();
+                        SdfPath const &nearest = stack.empty()
+                            ? absRoot : stack.back()->value.first;
+                        for (SdfPath parent = _GetParentPath(path);
+                             parent != nearest;
+                             parent = _GetParentPath(parent)) {
+                            ancestors.push_back(parent);
+                        }
+                        for (typename std::vector<SdfPath>::reverse_iterator
+                                 anc = ancestors.rbegin(),
+                                 ancEnd = ancestors.rend();
+                             anc != ancEnd; ++anc) {
+                            _Entry *entry = new _Entry(
+                                value_type(*anc, mapped_type()), 0);
+                            if (!stack.empty())
+                                stack.back()->AddChild(entry);
+                            entries.push_back(entry);
+                            stack.push_back(entry);
+                        }
+                        _Entry *entry = new _Entry(sortedValues[i], 0);
+                        if (!stack.empty())
+                            stack.back()->AddChild(entry);
+                        entries.push_back(entry);
+                        stack.push_back(entry);
+                    }
+                }
+            });
+
+        TfAutoMallocTag2 tag2("Sdf", "SdfPathTable::InsertInParallel");
+
+        // Size the hash table for the full element count up front.
+        size_t newSize = 1;
+        for (size_t chunk = 0; chunk != chunkEntries.size(); ++chunk)
+            newSize += chunkEntries[chunk].size();
+        while (_mask + 1 < newSize)
+            _Grow();
+
+        // Create the root entry, taking its value from the input if
+        // present (the root sorts first).
+        _InsertInTable(sortedValues.front().first == absRoot ?
+                       sortedValues.front() :
+                       value_type(absRoot, mapped_type()));
+
+        // Serially stitch the chunk-built entries into the hash table, in
+        // order.  A path encountered twice is an absent ancestor created
+        // by more than one chunk: move the duplicate's children onto the
+        // entry already in the table and discard it.  Duplicates always
+        // carry default values, since an input value for a path sorts
+        // before that path's descendants and so is stitched in first.
+        for (size_t chunk = 0; chunk != chunkEntries.size(); ++chunk) {
+            for (size_t i = 0, n = chunkEntries[chunk].size(); i != n; ++i) {
+                _Entry *&entry = chunkEntries[chunk][i];
+                _Entry **bucketHead = &_buckets[_Hash(entry->value.first)];
+                _Entry *existing = 0;
+                for (_Entry *e = *bucketHead; e; e = e->next) {
+                    if (e->value.first == entry->value.first) {
+                        existing = e;
+                        break;
+                    }
+                }
+                if (existing) {
+                    // Chunks stitch parents before children, so if this
+                    // duplicate was linked under a parent, that parent (or
+                    // the entry it was merged into) is already in the
+                    // table; unlink the duplicate from it before
+                    // discarding.
+                    if (entry->nextSiblingOrParent.Get()) {
+                        iterator parIter =
+                            find(_GetParentPath(entry->value.first));
+                        parIter._entry->RemoveChild(entry);
+                    }
+                    for (_Entry *child = entry->firstChild; child;) {
+                        _Entry *next = child->GetNextSibling();
+                        existing->AddChild(child);
+                        child = next;
+                    }
+                    delete entry;
+                    entry = 0;
+                }
+                else {
+                    entry->next = *bucketHead;
+                    *bucketHead = entry;
+                    ++_size;
+                }
+            }
+        }
+
+        // Finally, link each still-unparented subtree root to its parent.
+        // Chunks link children to the parents they create themselves;
+        // entries cut off by a chunk boundary and children of the root are
+        // linked here.  Every parent is guaranteed present: chunks create
+        // ancestor chains down to the root's children, and the root was
+        // inserted above.  An entry lacks a parent link exactly when its
+        // nextSiblingOrParent pointer was never set, since AddChild always
+        // stores a non-null sibling or parent.
+        for (size_t chunk = 0; chunk != chunkEntries.size(); ++chunk) {
+            for (size_t i = 0, n = chunkEntries[chunk].size(); i != n; ++i) {
+                _Entry *entry = chunkEntries[chunk][i];
+                if (entry && !entry->nextSiblingOrParent.Get()) {
+                    iterator parIter =
+                        find(_GetParentPath(entry->value.first));
+                    parIter._entry->AddChild(entry);
+                }
+            }
+        }
+    }
+
     /// Remove all elements from the table, leaving size() == 0.  Note that this
     /// function will not shrink the number of buckets used for the hash table.
     /// To do that, swap this instance with a default constructed instance.
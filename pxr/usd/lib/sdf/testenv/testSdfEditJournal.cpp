@@ -0,0 +1,177 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/attributeSpec.h"
+#include "pxr/usd/sdf/editJournal.h"
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/sdf/notice.h"
+#include "pxr/usd/sdf/primSpec.h"
+#include "pxr/usd/sdf/schema.h"
+#include "pxr/base/tf/notice.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/tf/weakBase.h"
+
+#include <thread>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Counts the batches of change notification sent by a layer.
+class _NoticeCounter : public TfWeakBase
+{
+public:
+    explicit _NoticeCounter(const SdfLayerHandle& layer)
+        : _noticeCount(0)
+    {
+        TfNotice::Register(
+            TfCreateWeakPtr(this), &_NoticeCounter::_OnChange, layer);
+    }
+
+    size_t GetNoticeCount() const { return _noticeCount; }
+
+private:
+    void _OnChange(const SdfNotice::LayersDidChange& n,
+                   const SdfLayerHandle& layer)
+    {
+        ++_noticeCount;
+    }
+
+    size_t _noticeCount;
+};
+
+// Records the creation of a prim with an attribute holding a default
+// value and a couple of time samples.
+static void
+_RecordPrim(SdfEditJournal* journal, const std::string& primName)
+{
+    const SdfPath primPath =
+        SdfPath::AbsoluteRootPath().AppendChild(TfToken(primName));
+    journal->CreateSpec(primPath, SdfSpecTypePrim, /* inert = */ false);
+    journal->SetField(primPath, SdfFieldKeys->Specifier, SdfSpecifierDef);
+
+    const SdfPath attrPath = primPath.AppendProperty(TfToken("x"));
+    journal->CreateSpec(attrPath, SdfSpecTypeAttribute, /* inert = */ true);
+    journal->SetField(attrPath, SdfFieldKeys->TypeName,
+                      TfToken("double"));
+    journal->SetField(attrPath, SdfFieldKeys->Custom, false);
+    journal->SetField(attrPath, SdfFieldKeys->Variability,
+                      SdfVariabilityVarying);
+    journal->SetField(attrPath, SdfFieldKeys->Default, 1.0);
+    journal->SetTimeSample(attrPath, 1.0, 10.0);
+    journal->SetTimeSample(attrPath, 2.0, 20.0);
+}
+
+static void
+_VerifyPrim(const SdfLayerRefPtr& layer, const std::string& primName)
+{
+    const SdfPath primPath =
+        SdfPath::AbsoluteRootPath().AppendChild(TfToken(primName));
+    SdfPrimSpecHandle prim = layer->GetPrimAtPath(primPath);
+    TF_AXIOM(prim);
+    TF_AXIOM(prim->GetSpecifier() == SdfSpecifierDef);
+
+    const SdfPath attrPath = primPath.AppendProperty(TfToken("x"));
+    TF_AXIOM(layer->GetAttributeAtPath(attrPath));
+    TF_AXIOM(layer->GetField(attrPath, SdfFieldKeys->Default) ==
+             VtValue(1.0));
+
+    VtValue sample;
+    TF_AXIOM(layer->QueryTimeSample(attrPath, 1.0, &sample));
+    TF_AXIOM(sample == VtValue(10.0));
+    TF_AXIOM(layer->QueryTimeSample(attrPath, 2.0, &sample));
+    TF_AXIOM(sample == VtValue(20.0));
+}
+
+// Verify basic single-threaded record-and-apply, and that application
+// sends exactly one batch of change notification.
+static void
+_TestBasicApply()
+{
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous();
+    _NoticeCounter counter(layer);
+
+    SdfEditJournal journal;
+    TF_AXIOM(journal.IsEmpty());
+    _RecordPrim(&journal, "Basic");
+    TF_AXIOM(!journal.IsEmpty());
+
+    // Recording must not touch the layer.
+    TF_AXIOM(!layer->GetPrimAtPath(SdfPath("/Basic")));
+    TF_AXIOM(counter.GetNoticeCount() == 0);
+
+    TF_AXIOM(layer->Apply(journal));
+    _VerifyPrim(layer, "Basic");
+    TF_AXIOM(counter.GetNoticeCount() == 1);
+
+    journal.Clear();
+    TF_AXIOM(journal.IsEmpty());
+}
+
+// Verify the intended concurrent-authoring pattern: each thread records
+// into its own journal, the journals are merged, and the merged journal
+// is applied once.
+static void
+_TestThreadedRecording()
+{
+    static const size_t numThreads = 8;
+
+    std::vector<SdfEditJournal> journals(numThreads);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i != numThreads; ++i) {
+        threads.emplace_back(
+            [&journals, i]() {
+                _RecordPrim(&journals[i], TfStringPrintf("Prim_%zu", i));
+            });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    SdfEditJournal merged;
+    size_t totalEdits = 0;
+    for (auto& journal : journals) {
+        totalEdits += journal.GetSize();
+        merged.Append(std::move(journal));
+        TF_AXIOM(journal.IsEmpty());
+    }
+    TF_AXIOM(merged.GetSize() == totalEdits);
+
+    SdfLayerRefPtr layer = SdfLayer::CreateAnonymous();
+    _NoticeCounter counter(layer);
+
+    TF_AXIOM(layer->Apply(merged));
+    for (size_t i = 0; i != numThreads; ++i) {
+        _VerifyPrim(layer, TfStringPrintf("Prim_%zu", i));
+    }
+    TF_AXIOM(counter.GetNoticeCount() == 1);
+}
+
+int
+main(int argc, char **argv)
+{
+    _TestBasicApply();
+    _TestThreadedRecording();
+
+    return 0;
+}
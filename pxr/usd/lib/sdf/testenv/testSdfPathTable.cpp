@@ -230,6 +230,55 @@ static void DoUnitTest()
     TF_AXIOM(table.empty());
     TF_AXIOM(table.size() == 0);
 
+    // Bulk parallel insertion builds the same table as one-at-a-time
+    // insertion.  Use enough leaf paths (with ancestors absent from the
+    // input) that InsertInParallel takes its parallel path rather than
+    // falling back to insert().
+    {
+        vector<Table::value_type> values;
+        for (char ch='a'; ch<='z'; ++ch) {
+            for (char n='0'; n<='9'; ++n) {
+                for (char m='0'; m<='9'; ++m) {
+                    char p[] = { '/', ch, n, '/', ch, m, '/', ch, n, '\0' };
+                    values.push_back(
+                        Table::value_type(SdfPath(p), string(1, ch)));
+                }
+            }
+        }
+
+        Table serialTable, parallelTable;
+        for (const auto& value : values) {
+            serialTable.insert(value);
+        }
+        parallelTable.InsertInParallel(values);
+
+        TF_AXIOM(parallelTable.size() == values.size() + 1 + 26*10*11);
+        TF_AXIOM(parallelTable.size() == serialTable.size());
+        for (Table::iterator i = serialTable.begin(), e = serialTable.end();
+             i != e; ++i) {
+            Table::iterator j = parallelTable.find(i->first);
+            TF_AXIOM(j != parallelTable.end());
+            TF_AXIOM(j->second == i->second);
+        }
+
+        // Preorder iteration visits every element exactly once, and
+        // subtree ranges agree, verifying the tree linkage.
+        TF_AXIOM(static_cast<size_t>(
+                     std::distance(parallelTable.begin(),
+                                   parallelTable.end()))
+                 == parallelTable.size());
+        pair<Table::iterator, Table::iterator>
+            sRange = serialTable.FindSubtreeRange(SdfPath("/m5")),
+            pRange = parallelTable.FindSubtreeRange(SdfPath("/m5"));
+        TF_AXIOM(std::distance(pRange.first, pRange.second) ==
+                 std::distance(sRange.first, sRange.second));
+
+        // Inserting into a non-empty table falls back to insert()
+        // semantics: existing values are left unchanged.
+        parallelTable.InsertInParallel(values);
+        TF_AXIOM(parallelTable.size() == serialTable.size());
+    }
+
     // build a table and then clear it in parallel
     for (char ch='a'; ch<='z'; ++ch) {
         std::string value(1, ch);
@@ -26,6 +26,7 @@
 
 #include "pxr/pxr.h"
 #include "pxr/usd/sdf/textFileFormat.h"
+#include "pxr/usd/sdf/textFileFormatParallel.h"
 #include "pxr/usd/sdf/fileIO.h"
 #include "pxr/usd/sdf/fileIO_Common.h"
 #include "pxr/usd/sdf/layer.h"
@@ -38,9 +39,12 @@
 #include "pxr/base/tf/registryManager.h"
 #include "pxr/base/tf/staticData.h"
 #include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/work/loops.h"
 
 #include <boost/assign.hpp>
+#include <algorithm>
 #include <ostream>
+#include <sstream>
 
 using std::string;
 
@@ -158,6 +162,18 @@ SdfTextFileFormat::Read(
     }
 
     SdfAbstractDataRefPtr data = InitData(layer->GetFileFormatArguments());
+
+    // Try the parallel parsing fast path for large layers.  It declines or
+    // fails without touching 'data', in which case we fall through to the
+    // serial parser below.
+    if (!metadataOnly &&
+        Sdf_ParseMenvaInParallel(
+            resolvedPath, asset, GetFormatId(), GetVersionString(),
+            TfDynamic_cast<SdfDataRefPtr>(data))) {
+        _SetLayerData(layer, data);
+        return true;
+    }
+
     if (!Sdf_ParseMenva(
             resolvedPath, asset, GetFormatId(), GetVersionString(), 
             metadataOnly, TfDynamic_cast<SdfDataRefPtr>(data))) {
@@ -279,11 +295,33 @@ _WriteLayerToMenva(
         _Write(out, 0, "\n");
     }
         
-    // Root prims
-    TF_FOR_ALL(i, l->GetRootPrims())
-    {
-        _Write(out, 0,"\n");
-        (*i)->WriteToStream(out, 0);
+    // Root prims.  Each root prim subtree serializes independently of the
+    // others, so format them into in-memory buffers concurrently and stitch
+    // the buffers into the output stream in order.  Buffers are produced and
+    // drained in bounded windows so that peak memory scales with the window
+    // size rather than with the full size of the layer.
+    const SdfPrimSpecHandleVector rootPrims =
+        l->GetRootPrims().values_as<SdfPrimSpecHandleVector>();
+
+    static const size_t maxPrimsPerWindow = 128;
+    for (size_t start = 0; start < rootPrims.size();
+         start += maxPrimsPerWindow) {
+        const size_t numPrims =
+            std::min(maxPrimsPerWindow, rootPrims.size() - start);
+        std::vector<std::string> buffers(numPrims);
+        WorkParallelForN(
+            numPrims,
+            [&rootPrims, &buffers, start](size_t begin, size_t end) {
+                for (size_t i = begin; i != end; ++i) {
+                    std::ostringstream buf;
+                    _Write(buf, 0, "\n");
+                    rootPrims[start + i]->WriteToStream(buf, 0);
+                    buffers[i] = buf.str();
+                }
+            });
+        for (const std::string& buffer : buffers) {
+            out.write(buffer.data(), buffer.size());
+        }
     }
 
     _Write(out, 0,"\n");
@@ -0,0 +1,543 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+///
+/// \file Sdf/textFileFormatParallel.cpp
+
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/textFileFormatParallel.h"
+#include "pxr/usd/sdf/abstractData.h"
+#include "pxr/usd/sdf/debugCodes.h"
+#include "pxr/usd/sdf/schema.h"
+#include "pxr/usd/ar/asset.h"
+
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/errorMark.h"
+#include "pxr/base/trace/trace.h"
+#include "pxr/base/work/dispatcher.h"
+#include "pxr/base/work/threadLimits.h"
+
+#include <atomic>
+#include <cstring>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Our interface to the YACC menva parser, from textFileFormat.yy.
+extern bool Sdf_ParseMenvaFromString(
+    const std::string& menvaString,
+    const std::string& token,
+    const std::string& version,
+    PXR_NS::SdfDataRefPtr data);
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    SDF_TEXTFILE_PARALLEL_PARSING, true,
+    "Enables parallel parsing of large menva text layers.");
+
+TF_DEFINE_ENV_SETTING(
+    SDF_TEXTFILE_PARALLEL_PARSING_MIN_SIZE, 8 * 1024 * 1024,
+    "Minimum menva text layer size, in bytes, for parallel parsing to be "
+    "considered.");
+
+namespace {
+
+// Returns true if the text at [p, end) begins with a keyword that starts
+// a top-level statement in the menva grammar.
+bool
+_StartsTopLevelStatement(const char* p, const char* end)
+{
+    static const char* const keywords[] = {
+        "class", "def", "over", "reorder"
+    };
+
+    for (const char* keyword : keywords) {
+        const size_t n = strlen(keyword);
+        if (static_cast<size_t>(end - p) > n &&
+            strncmp(p, keyword, n) == 0) {
+            // The keyword must be a complete token; 'def' must not match
+            // the start of an identifier like 'default'.
+            const char next = p[n];
+            if (!isalnum(next) && next != '_' && next != ':') {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Scans menva text in [offset, size) and appends to *statements the byte
+// offset of the start of every line that begins a top-level prim statement.
+//
+// This mirrors the lexer in textFileFormat.ll just enough to know whether
+// a given line begins outside of any comment, quoted string, asset
+// reference, path reference, or bracketed construct; only then can a
+// leading 'def', 'over', 'class' or 'reorder' keyword start a new
+// statement.  The scan is deliberately lenient about malformed text --
+// in the worst case it produces a bad split, the chunk parse fails, and
+// the caller falls back to the serial parser.
+void
+_FindTopLevelStatements(const char* buf, size_t size, size_t offset,
+                        std::vector<size_t>* statements)
+{
+    enum _State {
+        _Normal,
+        _LineComment,        // # ... or // ...
+        _BlockComment,       // /* ... */
+        _SingleQuoteString,  // '...'
+        _DoubleQuoteString,  // "..."
+        _TripleSingleString, // '''...'''
+        _TripleDoubleString, // """..."""
+        _AssetRef,           // @...@
+        _TripleAssetRef,     // @@@...@@@
+        _PathRef             // <...>
+    };
+
+    _State state = _Normal;
+    int depth = 0;
+    size_t lineStart = offset;
+    bool onlyBlanksOnLine = true;
+
+    for (size_t i = offset; i < size; ++i) {
+        const char c = buf[i];
+
+        // Newlines are significant to every state except the multi-line
+        // string and comment states, which simply span them.
+        if (c == '\n' || c == '\r') {
+            if (state != _BlockComment &&
+                state != _TripleSingleString &&
+                state != _TripleDoubleString) {
+                // Single-line constructs cannot contain a newline; if we
+                // are still in one, the text is malformed and we recover
+                // the same way the lexer does, by ending the token.
+                state = _Normal;
+            }
+            lineStart = i + 1;
+            onlyBlanksOnLine = true;
+            continue;
+        }
+
+        switch (state) {
+        case _Normal:
+            if (c == ' ' || c == '\t') {
+                break;
+            }
+            if (onlyBlanksOnLine && depth == 0 &&
+                _StartsTopLevelStatement(buf + i, buf + size)) {
+                statements->push_back(lineStart);
+            }
+            onlyBlanksOnLine = false;
+
+            switch (c) {
+            case '#':
+                state = _LineComment;
+                break;
+            case '/':
+                if (i + 1 < size && buf[i + 1] == '/') {
+                    state = _LineComment;
+                    ++i;
+                }
+                else if (i + 1 < size && buf[i + 1] == '*') {
+                    state = _BlockComment;
+                    ++i;
+                }
+                break;
+            case '\'':
+                if (i + 2 < size &&
+                    buf[i + 1] == '\'' && buf[i + 2] == '\'') {
+                    state = _TripleSingleString;
+                    i += 2;
+                }
+                else if (i + 1 < size && buf[i + 1] == '\'') {
+                    // Empty string.
+                    ++i;
+                }
+                else {
+                    state = _SingleQuoteString;
+                }
+                break;
+            case '"':
+                if (i + 2 < size &&
+                    buf[i + 1] == '"' && buf[i + 2] == '"') {
+                    state = _TripleDoubleString;
+                    i += 2;
+                }
+                else if (i + 1 < size && buf[i + 1] == '"') {
+                    // Empty string.
+                    ++i;
+                }
+                else {
+                    state = _DoubleQuoteString;
+                }
+                break;
+            case '@':
+                if (i + 2 < size &&
+                    buf[i + 1] == '@' && buf[i + 2] == '@') {
+                    state = _TripleAssetRef;
+                    i += 2;
+                }
+                else {
+                    state = _AssetRef;
+                }
+                break;
+            case '<':
+                state = _PathRef;
+                break;
+            case '(': case '[': case '{':
+                ++depth;
+                break;
+            case ')': case ']': case '}':
+                if (depth > 0) {
+                    --depth;
+                }
+                break;
+            default:
+                break;
+            }
+            break;
+
+        case _LineComment:
+            // Terminated by the newline handling above.
+            break;
+
+        case _BlockComment:
+            if (c == '*' && i + 1 < size && buf[i + 1] == '/') {
+                state = _Normal;
+                onlyBlanksOnLine = false;
+                ++i;
+            }
+            break;
+
+        case _SingleQuoteString:
+            if (c == '\\') {
+                ++i;
+            }
+            else if (c == '\'') {
+                state = _Normal;
+            }
+            break;
+
+        case _DoubleQuoteString:
+            if (c == '\\') {
+                ++i;
+            }
+            else if (c == '"') {
+                state = _Normal;
+            }
+            break;
+
+        case _TripleSingleString:
+            if (c == '\\') {
+                ++i;
+            }
+            else if (c == '\'' && i + 2 < size &&
+                     buf[i + 1] == '\'' && buf[i + 2] == '\'') {
+                state = _Normal;
+                onlyBlanksOnLine = false;
+                i += 2;
+            }
+            break;
+
+        case _TripleDoubleString:
+            if (c == '\\') {
+                ++i;
+            }
+            else if (c == '"' && i + 2 < size &&
+                     buf[i + 1] == '"' && buf[i + 2] == '"') {
+                state = _Normal;
+                onlyBlanksOnLine = false;
+                i += 2;
+            }
+            break;
+
+        case _AssetRef:
+            if (c == '@') {
+                state = _Normal;
+            }
+            break;
+
+        case _TripleAssetRef:
+            if (c == '\\' && i + 3 < size &&
+                buf[i + 1] == '@' && buf[i + 2] == '@' && buf[i + 3] == '@') {
+                i += 3;
+            }
+            else if (c == '@' && i + 2 < size &&
+                     buf[i + 1] == '@' && buf[i + 2] == '@') {
+                state = _Normal;
+                onlyBlanksOnLine = false;
+                i += 2;
+            }
+            break;
+
+        case _PathRef:
+            if (c == '>') {
+                state = _Normal;
+            }
+            break;
+        }
+    }
+}
+
+// Copies every spec from one data object into another.  Specs from
+// different chunks never collide because each chunk owns a disjoint set of
+// root prims; the pseudo-root is the one spec every chunk contributes to,
+// so its name children are appended and its remaining fields are merged
+// first-writer-wins.
+class _SpecCopier : public SdfAbstractDataSpecVisitor
+{
+public:
+    explicit _SpecCopier(SdfAbstractData* to) : _to(to) { }
+
+    virtual bool VisitSpec(const SdfAbstractData& from,
+                           const SdfAbstractDataSpecId& id)
+    {
+        if (id.GetFullSpecPath() == SdfPath::AbsoluteRootPath()) {
+            _MergePseudoRoot(from, id);
+            return true;
+        }
+
+        TF_VERIFY(!_to->HasSpec(id),
+                  "Duplicate spec <%s> while merging parsed chunks",
+                  id.GetString().c_str());
+
+        _to->CreateSpec(id, from.GetSpecType(id));
+        for (const TfToken& field : from.List(id)) {
+            _to->Set(id, field, from.Get(id, field));
+        }
+        return true;
+    }
+
+    virtual void Done(const SdfAbstractData&)
+    {
+        // Do nothing
+    }
+
+private:
+    void _MergePseudoRoot(const SdfAbstractData& from,
+                          const SdfAbstractDataSpecId& id)
+    {
+        if (!_to->HasSpec(id)) {
+            _to->CreateSpec(id, SdfSpecTypePseudoRoot);
+        }
+
+        for (const TfToken& field : from.List(id)) {
+            if (field == SdfChildrenKeys->PrimChildren) {
+                std::vector<TfToken> names;
+                VtValue existing = _to->Get(id, field);
+                if (existing.IsHolding<std::vector<TfToken>>()) {
+                    names = existing.UncheckedGet<std::vector<TfToken>>();
+                }
+                const VtValue value = from.Get(id, field);
+                if (value.IsHolding<std::vector<TfToken>>()) {
+                    const std::vector<TfToken>& chunkNames =
+                        value.UncheckedGet<std::vector<TfToken>>();
+                    names.insert(names.end(),
+                                 chunkNames.begin(), chunkNames.end());
+                }
+                _to->Set(id, field, VtValue::Take(names));
+            }
+            else if (!_to->Has(id, field)) {
+                _to->Set(id, field, from.Get(id, field));
+            }
+        }
+    }
+
+    SdfAbstractData* _to;
+};
+
+// Returns the root prim names recorded on the pseudo-root of \p data.
+std::vector<TfToken>
+_GetRootPrimNames(const SdfDataRefPtr& data)
+{
+    const SdfPath path = SdfPath::AbsoluteRootPath();
+    const VtValue value = data->Get(
+        SdfAbstractDataSpecId(&path), SdfChildrenKeys->PrimChildren);
+    if (value.IsHolding<std::vector<TfToken>>()) {
+        return value.UncheckedGet<std::vector<TfToken>>();
+    }
+    return std::vector<TfToken>();
+}
+
+} // end anonymous namespace
+
+bool
+Sdf_ParseMenvaInParallel(
+    const std::string& fileContext,
+    const std::shared_ptr<ArAsset>& asset,
+    const std::string& magicId,
+    const std::string& versionString,
+    SdfDataRefPtr data)
+{
+    if (!TfGetEnvSetting(SDF_TEXTFILE_PARALLEL_PARSING) ||
+        WorkGetConcurrencyLimit() <= 1) {
+        return false;
+    }
+
+    const size_t size = asset->GetSize();
+    if (size < static_cast<size_t>(
+            TfGetEnvSetting(SDF_TEXTFILE_PARALLEL_PARSING_MIN_SIZE))) {
+        return false;
+    }
+
+    // Prefer the asset's buffer, which for file-backed assets is a
+    // read-only mapping of the file; chunk boundaries can then be found
+    // without reading the whole file up front.
+    std::shared_ptr<const char> buffer = asset->GetBuffer();
+    if (!buffer) {
+        return false;
+    }
+
+    TRACE_FUNCTION();
+
+    const char* buf = buffer.get();
+
+    // The first line holds the magic cookie; it is prepended to every
+    // chunk so that each one is a complete menva document.
+    const char* firstNewline =
+        static_cast<const char*>(memchr(buf, '\n', size));
+    if (!firstNewline) {
+        return false;
+    }
+    const size_t bodyStart = firstNewline - buf + 1;
+    const std::string cookieLine(buf, bodyStart);
+
+    std::vector<size_t> statements;
+    {
+        TRACE_SCOPE("Sdf_ParseMenvaInParallel (find chunk boundaries)");
+        _FindTopLevelStatements(buf, size, bodyStart, &statements);
+    }
+    if (statements.size() < 2) {
+        // Nothing to parallelize.
+        return false;
+    }
+
+    // Group consecutive top-level statements into chunks of roughly equal
+    // size, aiming for a couple of chunks per worker thread so that an
+    // unusually expensive chunk does not serialize the whole parse.
+    std::vector<std::pair<size_t, size_t>> chunks;
+    {
+        const size_t primBytes = size - statements.front();
+        const size_t targetBytes = std::max<size_t>(
+            primBytes / (2 * WorkGetConcurrencyLimit()), 1);
+
+        size_t chunkStart = statements.front();
+        for (size_t i = 1; i != statements.size(); ++i) {
+            if (statements[i] - chunkStart >= targetBytes) {
+                chunks.push_back({chunkStart, statements[i]});
+                chunkStart = statements[i];
+            }
+        }
+        chunks.push_back({chunkStart, size});
+    }
+    if (chunks.size() < 2) {
+        return false;
+    }
+
+    TF_DEBUG(SDF_FILE_FORMAT).Msg(
+        "Sdf_ParseMenvaInParallel('%s'): parsing %zu bytes "
+        "as %zu chunks\n", fileContext.c_str(), size, chunks.size());
+
+    // Parse the preamble (cookie and layer metadata) and each chunk into
+    // its own data object.  Chunk parse errors are cleared rather than
+    // reported: their line numbers are chunk-relative, so the caller's
+    // serial reparse is left to produce the authoritative diagnostics.
+    SdfDataRefPtr preambleData = TfCreateRefPtr(new SdfData);
+    std::vector<SdfDataRefPtr> chunkData(chunks.size());
+    for (SdfDataRefPtr& chunk : chunkData) {
+        chunk = TfCreateRefPtr(new SdfData);
+    }
+
+    std::atomic<bool> failed(false);
+    {
+        TRACE_SCOPE("Sdf_ParseMenvaInParallel (parse chunks)");
+
+        WorkDispatcher dispatcher;
+        dispatcher.Run([&]() {
+            TfErrorMark m;
+            if (!Sdf_ParseMenvaFromString(
+                    std::string(buf, statements.front()),
+                    magicId, versionString, preambleData) ||
+                !m.IsClean()) {
+                m.Clear();
+                failed = true;
+            }
+        });
+        for (size_t i = 0; i != chunks.size(); ++i) {
+            dispatcher.Run([&, i]() {
+                TfErrorMark m;
+                std::string text = cookieLine;
+                text.append(buf + chunks[i].first,
+                            chunks[i].second - chunks[i].first);
+                if (!Sdf_ParseMenvaFromString(
+                        text, magicId, versionString, chunkData[i]) ||
+                    !m.IsClean()) {
+                    m.Clear();
+                    failed = true;
+                }
+            });
+        }
+        dispatcher.Wait();
+    }
+    if (failed) {
+        TF_DEBUG(SDF_FILE_FORMAT).Msg(
+            "Sdf_ParseMenvaInParallel('%s'): chunk parse failed, "
+            "falling back to serial parsing\n", fileContext.c_str());
+        return false;
+    }
+
+    // A root prim defined twice lands in two different chunks, which the
+    // per-chunk duplicate check cannot see; detect that here, before any
+    // specs are published, and let the serial parser report the error.
+    {
+        std::set<TfToken> seen;
+        for (const SdfDataRefPtr& chunk : chunkData) {
+            for (const TfToken& name : _GetRootPrimNames(chunk)) {
+                if (!seen.insert(name).second) {
+                    TF_DEBUG(SDF_FILE_FORMAT).Msg(
+                        "Sdf_ParseMenvaInParallel('%s'): duplicate root "
+                        "prim '%s', falling back to serial parsing\n",
+                        fileContext.c_str(), name.GetText());
+                    return false;
+                }
+            }
+        }
+    }
+
+    // Merge the per-chunk results, in file order so that the root prim
+    // names on the pseudo-root end up in the order they were authored.
+    {
+        TRACE_SCOPE("Sdf_ParseMenvaInParallel (merge chunks)");
+
+        _SpecCopier copier(boost::get_pointer(data));
+        preambleData->VisitSpecs(&copier);
+        for (const SdfDataRefPtr& chunk : chunkData) {
+            chunk->VisitSpecs(&copier);
+        }
+    }
+
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,62 @@
+//
+// Copyright 2019 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef SDF_TEXT_FILE_FORMAT_PARALLEL_H
+#define SDF_TEXT_FILE_FORMAT_PARALLEL_H
+
+/// \file sdf/textFileFormatParallel.h
+
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/data.h"
+
+#include <memory>
+#include <string>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class ArAsset;
+
+/// Attempt to parse the menva-formatted \p asset in parallel.
+///
+/// Large text layers are split at top-level prim statement boundaries and
+/// the resulting chunks are handed to the reentrant menva parser on worker
+/// threads; the per-chunk results are then merged into \p data.
+///
+/// This is strictly a fast path.  It declines (without raising errors) if
+/// parallel parsing is disabled, the asset is below the size threshold, no
+/// concurrency is available, or the text cannot be split into more than one
+/// chunk.  It also fails if any chunk does not parse cleanly; chunk parse
+/// errors are discarded since their line numbers are chunk-relative.  In
+/// all of these cases \p data is left untouched and false is returned, and
+/// the caller is expected to fall back to the serial parser, which will
+/// report any errors with correct file positions.
+bool Sdf_ParseMenvaInParallel(
+    const std::string& fileContext,
+    const std::shared_ptr<ArAsset>& asset,
+    const std::string& magicId,
+    const std::string& versionString,
+    SdfDataRefPtr data);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // SDF_TEXT_FILE_FORMAT_PARALLEL_H
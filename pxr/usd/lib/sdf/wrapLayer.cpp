@@ -500,6 +500,11 @@ void wrapLayer()
         ( arg("anchor"),
           arg("assetPath")));
 
+    def("ComputeDifferingSpecPaths", &SdfComputeDifferingSpecPaths,
+        ( arg("baseline"),
+          arg("comparison")),
+        return_value_policy<TfPySequenceToList>());
+
     scope s = class_<This,
                      ThisHandle,
                      boost::noncopyable>("Layer", no_init)
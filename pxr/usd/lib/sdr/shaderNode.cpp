@@ -68,14 +68,65 @@ SdrShaderNode::SdrShaderNode(
             dynamic_cast<SdrShaderPropertyConstPtr>(output.second);
     }
 
-    _InitializePrimvars();
     _PostProcessProperties();
 
-    // Tokenize metadata
-    _label = TokenVal(SdrNodeMetadata->Label, _metadata);
-    _category = TokenVal(SdrNodeMetadata->Category, _metadata);
-    _departments = TokenVecVal(SdrNodeMetadata->Departments, _metadata);
-    _pages = _ComputePages();
+    // The tokenized metadata and the aggregate page/primvar information
+    // are computed lazily in _ParseMetadata(); material translation
+    // typically only consumes identifiers, types and default values.
+}
+
+void
+SdrShaderNode::_ParseMetadata() const
+{
+    std::call_once(_parseMetadataOnce, [this]() {
+        _label = TokenVal(SdrNodeMetadata->Label, _metadata);
+        _category = TokenVal(SdrNodeMetadata->Category, _metadata);
+        _departments = TokenVecVal(SdrNodeMetadata->Departments, _metadata);
+        _pages = _ComputePages();
+        _InitializePrimvars();
+    });
+}
+
+const TfToken&
+SdrShaderNode::GetLabel() const
+{
+    _ParseMetadata();
+    return _label;
+}
+
+const TfToken&
+SdrShaderNode::GetCategory() const
+{
+    _ParseMetadata();
+    return _category;
+}
+
+const NdrTokenVec&
+SdrShaderNode::GetDepartments() const
+{
+    _ParseMetadata();
+    return _departments;
+}
+
+const NdrTokenVec&
+SdrShaderNode::GetPages() const
+{
+    _ParseMetadata();
+    return _pages;
+}
+
+const NdrTokenVec&
+SdrShaderNode::GetPrimvars() const
+{
+    _ParseMetadata();
+    return _primvars;
+}
+
+const NdrTokenVec&
+SdrShaderNode::GetAdditionalPrimvarProperties() const
+{
+    _ParseMetadata();
+    return _primvarNamingProperties;
 }
 
 void
@@ -223,7 +274,7 @@ SdrShaderNode::GetAllVstructNames() const
 }
 
 void
-SdrShaderNode::_InitializePrimvars()
+SdrShaderNode::_InitializePrimvars() const
 {
     NdrTokenVec primvars;
     NdrTokenVec primvarNamingProperties;
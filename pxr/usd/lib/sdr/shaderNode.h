@@ -33,6 +33,8 @@
 #include "pxr/usd/ndr/node.h"
 #include "pxr/usd/sdr/declare.h"
 
+#include <mutex>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // Note: Metadata keys that are generated by parsers should start with
@@ -126,12 +128,12 @@ public:
     /// returned from `GetName()`. In the context of a UI, the label value
     /// might be used as the display name for the node instead of the name.
     SDR_API
-    const TfToken& GetLabel() const { return _label; }
+    const TfToken& GetLabel() const;
 
     /// The category assigned to this node, if any. Distinct from the family
     /// returned from `GetFamily()`.
     SDR_API
-    const TfToken& GetCategory() const { return _category; }
+    const TfToken& GetCategory() const;
 
     /// Returns the role of this node. This is used to annotate the role that 
     /// the shader node plays inside a shader network. Example roles include 
@@ -145,7 +147,7 @@ public:
 
     /// The departments this node is associated with, if any.
     SDR_API
-    const NdrTokenVec& GetDepartments() const { return _departments; }
+    const NdrTokenVec& GetDepartments() const;
 
     /// Gets the pages on which the node's properties reside (an aggregate of
     /// the unique `SdrShaderProperty::GetPage()` values for all of the node's
@@ -153,21 +155,19 @@ public:
     /// scenario, properties might be divided into two pages, 'Simple' and
     /// 'Advanced'.
     SDR_API
-    const NdrTokenVec& GetPages() const { return _pages; };
+    const NdrTokenVec& GetPages() const;
 
     /// The list of primvars that this node uses (note that additional primvars
     /// may also be present on specific input properties' values; the properties
     /// that primvars are provided on can be determined via
     /// `GetAdditionalPrimvarProperties()`).
     SDR_API
-    const NdrTokenVec& GetPrimvars() const { return _primvars; }
+    const NdrTokenVec& GetPrimvars() const;
 
     /// The list of string input properties whose values provide the names of
     /// additional primvars consumed by this node.
     SDR_API
-    const NdrTokenVec& GetAdditionalPrimvarProperties() const {
-        return _primvarNamingProperties;
-    }
+    const NdrTokenVec& GetAdditionalPrimvarProperties() const;
 
     /// Returns the implementation name of this node.  The name of the node
     /// is how to refer to the node in shader networks.  The label is how to
@@ -213,21 +213,28 @@ protected:
     // consumed by this node, whereas `_primvarNamingProperties` contains the
     // names of string input properties whose values provide the names of
     // additional primvars consumed by this node.
-    NdrTokenVec _primvars;
-    NdrTokenVec _primvarNamingProperties;
-
-    // Tokenized metadata
-    TfToken _label;
-    TfToken _category;
-    NdrTokenVec _departments;
-    NdrTokenVec _pages;
+    // Computed lazily on first access along with the other derived
+    // metadata below; mutable so the accessors can stay const.
+    mutable NdrTokenVec _primvars;
+    mutable NdrTokenVec _primvarNamingProperties;
+
+    // Tokenized metadata, also computed lazily on first access
+    mutable std::once_flag _parseMetadataOnce;
+    mutable TfToken _label;
+    mutable TfToken _category;
+    mutable NdrTokenVec _departments;
+    mutable NdrTokenVec _pages;
 
     SdrPropertyMap _shaderInputs;
     SdrPropertyMap _shaderOutputs;
 
 private:
+    // Parses the tokenized and aggregate metadata above on first use;
+    // safe to call concurrently from multiple threads.
+    void _ParseMetadata() const;
+
     // Initializes `_primvars` and `_primvarNamingProperties`
-    void _InitializePrimvars();
+    void _InitializePrimvars() const;
 
     // Determines which pages are present on the node's properties
     NdrTokenVec _ComputePages() const;
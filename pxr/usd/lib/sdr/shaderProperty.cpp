@@ -200,16 +200,67 @@ SdrShaderProperty::SdrShaderProperty(
     // Indicate a "default" widget if one was not assigned
     _metadata.insert({SdrPropertyMetadata->Widget, "default"});
 
-    // Tokenize metadata
-    _label = TokenVal(SdrPropertyMetadata->Label, _metadata);
-    _page = TokenVal(SdrPropertyMetadata->Page, _metadata);
-    _widget = TokenVal(SdrPropertyMetadata->Widget, _metadata);
-    _vstructMemberOf = TokenVal(
-        SdrPropertyMetadata->VstructMemberOf, _metadata);
-    _vstructMemberName = TokenVal(
-        SdrPropertyMetadata->VstructMemberName, _metadata);
-    _validConnectionTypes = TokenVecVal(
-        SdrPropertyMetadata->ValidConnectionTypes, _metadata);
+    // The remaining metadata (label, page, widget, vstruct and connection
+    // hints) is tokenized lazily in _TokenizeMetadata(); most properties
+    // are only ever consumed for their identifier, type and default value.
+}
+
+void
+SdrShaderProperty::_TokenizeMetadata() const
+{
+    std::call_once(_tokenizeMetadataOnce, [this]() {
+        _label = TokenVal(SdrPropertyMetadata->Label, _metadata);
+        _page = TokenVal(SdrPropertyMetadata->Page, _metadata);
+        _widget = TokenVal(SdrPropertyMetadata->Widget, _metadata);
+        _vstructMemberOf = TokenVal(
+            SdrPropertyMetadata->VstructMemberOf, _metadata);
+        _vstructMemberName = TokenVal(
+            SdrPropertyMetadata->VstructMemberName, _metadata);
+        _validConnectionTypes = TokenVecVal(
+            SdrPropertyMetadata->ValidConnectionTypes, _metadata);
+    });
+}
+
+const TfToken&
+SdrShaderProperty::GetLabel() const
+{
+    _TokenizeMetadata();
+    return _label;
+}
+
+const TfToken&
+SdrShaderProperty::GetPage() const
+{
+    _TokenizeMetadata();
+    return _page;
+}
+
+const TfToken&
+SdrShaderProperty::GetWidget() const
+{
+    _TokenizeMetadata();
+    return _widget;
+}
+
+const TfToken&
+SdrShaderProperty::GetVStructMemberOf() const
+{
+    _TokenizeMetadata();
+    return _vstructMemberOf;
+}
+
+const TfToken&
+SdrShaderProperty::GetVStructMemberName() const
+{
+    _TokenizeMetadata();
+    return _vstructMemberName;
+}
+
+const NdrTokenVec&
+SdrShaderProperty::GetValidConnectionTypes() const
+{
+    _TokenizeMetadata();
+    return _validConnectionTypes;
 }
 
 const std::string&
@@ -36,6 +36,8 @@
 #include "pxr/usd/ndr/property.h"
 #include "pxr/usd/sdr/shaderNode.h"
 
+#include <mutex>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // If additional types are added here, it's also worth trying to add a mapping
@@ -110,7 +112,7 @@ public:
     /// returned from `GetName()`. In the context of a UI, the label value
     /// might be used as the display name for the property instead of the name.
     SDR_API
-    const TfToken& GetLabel() const { return _label; }
+    const TfToken& GetLabel() const;
 
     /// The help message assigned to this property, if any.
     SDR_API
@@ -118,13 +120,13 @@ public:
 
     /// The page (group), eg "Advanced", this property appears on, if any.
     SDR_API
-    const TfToken& GetPage() const { return _page; }
+    const TfToken& GetPage() const;
 
     /// The widget "hint" that indicates the widget that can best display the
     /// type of data contained in this property, if any. Examples of this value
     /// could include "number", "slider", etc.
     SDR_API
-    const TfToken& GetWidget() const { return _widget; }
+    const TfToken& GetWidget() const;
 
     /// Any UI "hints" that are associated with this property. "Hints" are
     /// simple key/value pairs.
@@ -155,15 +157,11 @@ public:
 
     /// If this field is part of a vstruct, this is the name of the struct.
     SDR_API
-    const TfToken& GetVStructMemberOf() const {
-        return _vstructMemberOf;
-    }
+    const TfToken& GetVStructMemberOf() const;
 
     /// If this field is part of a vstruct, this is its name in the struct.
     SDR_API
-    const TfToken& GetVStructMemberName() const {
-        return _vstructMemberName;
-    }
+    const TfToken& GetVStructMemberName() const;
 
     /// Returns true if this field is part of a vstruct.
     SDR_API
@@ -190,9 +188,7 @@ public:
     /// `NdrProperty::GetType()` can be used as a fallback, or you can use the
     /// connectability test in `CanConnectTo()`.
     SDR_API
-    const NdrTokenVec& GetValidConnectionTypes() const {
-        return _validConnectionTypes;
-    }
+    const NdrTokenVec& GetValidConnectionTypes() const;
 
     /// Determines if this property can be connected to the specified property.
     SDR_API
@@ -244,13 +240,22 @@ protected:
     const NdrTokenMap _hints;
     const NdrOptionVec _options;
 
-    // Tokenized metadata
-    NdrTokenVec _validConnectionTypes;
-    TfToken _label;
-    TfToken _page;
-    TfToken _widget;
-    TfToken _vstructMemberOf;
-    TfToken _vstructMemberName;
+    // Tokenized metadata; only materialized when one of the corresponding
+    // accessors is called, since most properties are consumed for their
+    // identifier, type and default value only. Mutable so the accessors
+    // can stay const.
+    mutable std::once_flag _tokenizeMetadataOnce;
+    mutable NdrTokenVec _validConnectionTypes;
+    mutable TfToken _label;
+    mutable TfToken _page;
+    mutable TfToken _widget;
+    mutable TfToken _vstructMemberOf;
+    mutable TfToken _vstructMemberName;
+
+private:
+    // Parses the tokenized metadata above on first use; safe to call
+    // concurrently from multiple threads.
+    void _TokenizeMetadata() const;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
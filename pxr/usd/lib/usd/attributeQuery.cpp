@@ -27,11 +27,15 @@
 #include "pxr/usd/usd/stage.h"
 #include "pxr/usd/usd/valueUtils.h"
 
+#include "pxr/usd/ar/resolverScopedCache.h"
 #include "pxr/usd/sdf/types.h"
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
 
 #include <boost/preprocessor/seq/for_each.hpp>
 
+#include <atomic>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
@@ -51,11 +55,22 @@ std::vector<UsdAttributeQuery>
 UsdAttributeQuery::CreateQueries(
     const UsdPrim& prim, const TfTokenVector& attrNames)
 {
-    std::vector<UsdAttributeQuery> rval;
-    rval.reserve(attrNames.size());
-    for (const auto& attrName : attrNames) {
-        rval.push_back(UsdAttributeQuery(prim, attrName));
-    }
+    TRACE_FUNCTION();
+
+    std::vector<UsdAttributeQuery> rval(attrNames.size());
+
+    // Bind a single resolver cache over the whole batch so any asset
+    // resolution performed while computing resolve info is shared across
+    // the attributes, then fan the independent per-attribute resolves
+    // out in parallel.
+    ArResolverScopedCache resolverCache;
+
+    WorkParallelForN(attrNames.size(),
+        [&prim, &attrNames, &rval](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                rval[i] = UsdAttributeQuery(prim, attrNames[i]);
+            }
+        });
 
     return rval;
 }
@@ -139,7 +154,68 @@ UsdAttributeQuery::Get(VtValue* value, UsdTimeCode time) const
     return foundValue;
 }
 
-bool 
+bool
+UsdAttributeQuery::GetValues(const std::vector<UsdAttributeQuery>& queries,
+                             std::vector<VtValue>* values,
+                             UsdTimeCode time)
+{
+    values->clear();
+    values->resize(queries.size());
+
+    return GetValues(queries.data(), queries.size(), values->data(), time);
+}
+
+bool
+UsdAttributeQuery::GetValues(const UsdAttributeQuery* queries,
+                             size_t numQueries,
+                             VtValue* values,
+                             UsdTimeCode time)
+{
+    TRACE_FUNCTION();
+
+    std::atomic<bool> foundAllValues(true);
+    WorkParallelForN(numQueries,
+        [queries, values, time, &foundAllValues](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                if (!queries[i] ||
+                    !queries[i].Get(&values[i], time)) {
+                    foundAllValues = false;
+                }
+            }
+        });
+
+    return foundAllValues;
+}
+
+bool
+UsdAttributeQuery::GetValueSeries(const double* times, size_t numTimes,
+                                  VtValue* values) const
+{
+    TRACE_FUNCTION();
+
+    if (!IsValid()) {
+        for (size_t i = 0; i != numTimes; ++i) {
+            values[i] = VtValue();
+        }
+        return false;
+    }
+
+    // Bind one resolver cache across the whole series so that any asset
+    // path resolution triggered while reading samples (e.g. opening clip
+    // layers) is shared between time codes.
+    ArResolverScopedCache resolverCache;
+
+    bool foundAllValues = true;
+    for (size_t i = 0; i != numTimes; ++i) {
+        if (!Get(&values[i], times[i])) {
+            foundAllValues = false;
+        }
+    }
+
+    return foundAllValues;
+}
+
+bool
 UsdAttributeQuery::GetTimeSamples(std::vector<double>* times) const
 {
     return _attr._GetStage()->_GetTimeSamplesInIntervalFromResolveInfo(
@@ -82,6 +82,10 @@ public:
     /// Construct new queries for the attributes named in \p attrNames under
     /// the prim \p prim. The objects in the returned vector will line up
     /// 1-to-1 with \p attrNames.
+    ///
+    /// The per-attribute resolve-info computations are performed as a
+    /// batch, in parallel, which can substantially outperform constructing
+    /// the queries one at a time when there are many attributes.
     USD_API
     static std::vector<UsdAttributeQuery> CreateQueries(
         const UsdPrim& prim, const TfTokenVector& attrNames);
@@ -130,9 +134,53 @@ public:
     /// Type-erased access, often not as efficient as typed access.
     USD_API
     bool Get(VtValue* value, UsdTimeCode time = UsdTimeCode::Default()) const;
-    
-    /// Populates a vector with authored sample times. 
-    /// Returns false only on error. 
+
+    /// Fetch values for all \p queries at \p time into \p values, which is
+    /// resized to line up 1-to-1 with \p queries.  The queries are resolved
+    /// in parallel, which can substantially outperform individual Get()
+    /// calls when sampling many attributes at the same time code, e.g.
+    /// during playback.
+    ///
+    /// Returns true if every query produced a value, false otherwise.
+    /// Invalid queries and queries with no authored value or fallback
+    /// produce an empty VtValue.
+    USD_API
+    static bool GetValues(const std::vector<UsdAttributeQuery>& queries,
+                          std::vector<VtValue>* values,
+                          UsdTimeCode time = UsdTimeCode::Default());
+
+    /// \overload
+    /// As above, but writes the resolved values into the caller-provided
+    /// buffer \p values, which must hold at least \p numQueries elements.
+    /// This form avoids any allocation in the sampling loop when the
+    /// caller reuses its buffers across time codes.
+    USD_API
+    static bool GetValues(const UsdAttributeQuery* queries,
+                          size_t numQueries,
+                          VtValue* values,
+                          UsdTimeCode time = UsdTimeCode::Default());
+
+    /// Resolve the value of the attribute associated with this query at
+    /// each of the \p numTimes time codes in \p times, writing the results
+    /// into \p values, which must hold at least \p numTimes elements.
+    ///
+    /// This is the preferred entry point for playback and cache-export
+    /// style sampling, where a fixed attribute is read at many times with
+    /// no authoring in between: the opinion source is pinned by this
+    /// query, so per-call value resolution is skipped, and a single
+    /// resolver cache is bound across the whole series.  \p times should
+    /// be sorted in increasing order; the strongest layer's sample
+    /// storage is then read sequentially, which is cache-friendly.
+    ///
+    /// Returns true if a value was produced at every time code, false
+    /// otherwise.  Times with no authored value or fallback produce an
+    /// empty VtValue.
+    USD_API
+    bool GetValueSeries(const double* times, size_t numTimes,
+                        VtValue* values) const;
+
+    /// Populates a vector with authored sample times.
+    /// Returns false only on error.
     //
     /// Behaves identically to UsdAttribute::GetTimeSamples()
     ///
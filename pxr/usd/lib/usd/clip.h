@@ -254,6 +254,20 @@ public:
     /// open, it will generally be kept open for the life of the stage.
     SdfLayerHandle GetLayerIfOpen() const;
 
+    /// Return true if an attempt has been made to open the layer for this
+    /// clip, whether or not it succeeded, false otherwise.
+    bool HasOpenedLayer() const {
+        return _hasLayer;
+    }
+
+    /// Open (if necessary) and return the layer associated with this clip.
+    /// Opening is the high-latency step that GetLayerIfOpen avoids; this
+    /// is exposed so clients can open batches of clip layers in parallel,
+    /// or open upcoming clips ahead of use.
+    SdfLayerRefPtr GetLayer() const {
+        return _GetLayerForClip();
+    }
+
     /// Layer stack, prim spec path, and index of layer where this clip
     /// was introduced.
     PcpLayerStackPtr sourceLayerStack;
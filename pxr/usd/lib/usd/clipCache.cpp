@@ -39,6 +39,9 @@
 #include "pxr/base/gf/vec2d.h"
 #include "pxr/base/tf/mallocTag.h"
 #include "pxr/base/tf/ostreamMethods.h"
+#include "pxr/base/trace/trace.h"
+#include "pxr/base/work/detachedTask.h"
+#include "pxr/base/work/loops.h"
 
 #include <string>
 
@@ -53,6 +56,77 @@ Usd_ClipCache::~Usd_ClipCache()
 {
 }
 
+void
+Usd_ClipCache::Clips::OpenClipLayers() const
+{
+    bool anyClosed = false;
+    for (const Usd_ClipRefPtr& clip : valueClips) {
+        if (!clip->HasOpenedLayer()) {
+            anyClosed = true;
+            break;
+        }
+    }
+    if (!anyClosed) {
+        return;
+    }
+
+    TRACE_FUNCTION();
+
+    WorkParallelForN(valueClips.size(),
+        [this](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                valueClips[i]->GetLayer();
+            }
+        });
+}
+
+void
+Usd_ClipCache::Clips::PrefetchAdjacentClip(Usd_Clip::ExternalTime time) const
+{
+    if (valueClips.size() < 2) {
+        return;
+    }
+
+    // Find the clip active at the given time; valueClips is ordered by
+    // start time.
+    size_t activeIndex = 0;
+    for (size_t i = 0, n = valueClips.size(); i != n; ++i) {
+        if (time >= valueClips[i]->startTime &&
+            time < valueClips[i]->endTime) {
+            activeIndex = i;
+            break;
+        }
+    }
+
+    // Guess the playback direction from where the time falls within the
+    // active clip: queries in the latter half are most likely headed
+    // toward the next clip, queries in the first half toward the
+    // previous one.  Interior clips always have finite start and end
+    // times, so the midpoint is well-defined whenever a neighbor exists.
+    const Usd_ClipRefPtr& active = valueClips[activeIndex];
+    const bool forward =
+        time >= (active->startTime + (active->endTime - active->startTime) / 2);
+
+    if (forward && activeIndex + 1 >= valueClips.size()) {
+        return;
+    }
+    if (!forward && activeIndex == 0) {
+        return;
+    }
+
+    const Usd_ClipRefPtr neighbor =
+        valueClips[forward ? activeIndex + 1 : activeIndex - 1];
+    if (neighbor->HasOpenedLayer()) {
+        return;
+    }
+
+    // Open the neighboring clip's layer in the background; the clip is
+    // kept alive by the copied shared pointer.  If the detached open
+    // loses the race with a foreground query, _GetLayerForClip's own
+    // locking ensures only one layer is installed.
+    WorkRunDetachedTask([neighbor]() { neighbor->GetLayer(); });
+}
+
 struct Usd_ClipEntry {
 public:
     double startTime;
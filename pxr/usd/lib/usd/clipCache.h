@@ -74,6 +74,21 @@ public:
             std::swap(valueClips, rhs.valueClips);
         }
 
+        /// Open the layers for all value clips in this set as one
+        /// parallel batch.  When no manifest is present, value
+        /// resolution must examine every clip layer to determine which
+        /// attributes hold time samples; opening the layers up front
+        /// avoids paying that latency serially on first touch.  Does
+        /// nothing if every layer has already been opened.
+        void OpenClipLayers() const;
+
+        /// Open the layer for the clip adjacent to the clip active at
+        /// \p time in the background, choosing the neighbor on the side
+        /// of \p time's position within the active clip's range.  This
+        /// hides the open latency at clip boundaries during playback.
+        /// Does nothing if the neighboring clip's layer is already open.
+        void PrefetchAdjacentClip(Usd_Clip::ExternalTime time) const;
+
         PcpLayerStackPtr sourceLayerStack;
         SdfPath sourcePrimPath;
         size_t sourceLayerIndex;
@@ -304,6 +304,8 @@ PXR_NAMESPACE_CLOSE_SCOPE
 
 #include "pxr/usd/usd/primRange.h"
 
+#include "pxr/base/work/loops.h"
+
 #include <boost/functional/hash.hpp>
 
 #include <set>
@@ -1076,6 +1078,114 @@ UsdCollectionAPI::MembershipQuery::_MergeMembershipQuery(
     }
 }
 
+UsdCollectionAPI::CompiledMembershipQuery::CompiledMembershipQuery(
+    const MembershipQuery &query,
+    const UsdPrim &root,
+    const Usd_PrimFlagsPredicate &pred)
+    : _query(query)
+{
+    TRACE_FUNCTION();
+
+    if (!root) {
+        TF_CODING_ERROR("Invalid root prim");
+        return;
+    }
+    _root = root.GetPath();
+
+    // UsdPrimRange visits parents before children, so each prim's effective
+    // expansion-rule can be resolved from its parent's already-resolved rule
+    // with a single lookup.  Only the subtree root needs the full ancestor
+    // walk.
+    for (const UsdPrim &prim : UsdPrimRange(root, pred)) {
+        const SdfPath &path = prim.GetPath();
+        TfToken rule = UsdTokens->exclude;
+        if (path == _root) {
+            if (prim.IsPseudoRoot()) {
+                // The pseudo-root cannot itself be a collection member,
+                // but includeRoot authors a rule at </> that descendants
+                // must inherit.
+                const MembershipQuery::PathExpansionRuleMap ruleMap =
+                    _query.GetAsPathExpansionRuleMap();
+                const auto rootEntry = ruleMap.find(path);
+                if (rootEntry != ruleMap.end()) {
+                    rule = rootEntry->second;
+                }
+            } else {
+                _query.IsPathIncluded(path, &rule);
+            }
+        } else {
+            const auto parentEntry =
+                _resolvedRules.find(path.GetParentPath());
+            if (TF_VERIFY(parentEntry != _resolvedRules.end())) {
+                _query.IsPathIncluded(path, parentEntry->second, &rule);
+            }
+        }
+        _resolvedRules[path] = rule;
+    }
+}
+
+bool
+UsdCollectionAPI::CompiledMembershipQuery::IsPathIncluded(
+    const SdfPath &path,
+    TfToken *expansionRule) const
+{
+    // Only prims and properties can belong to a collection.
+    if (!path.IsPrimPath() && !path.IsPropertyPath())
+        return false;
+
+    const auto entry = _resolvedRules.find(path.GetPrimPath());
+    if (entry == _resolvedRules.end()) {
+        // Outside the compiled subtree; fall back to the ancestor walk.
+        return _query.IsPathIncluded(path, expansionRule);
+    }
+
+    if (path.IsPrimPath()) {
+        if (expansionRule) {
+            *expansionRule = entry->second;
+        }
+        return entry->second != UsdTokens->exclude;
+    }
+
+    // Property paths may have direct entries in the rule map, so resolve
+    // them against the owning prim's rule as the inherited rule.
+    return _query.IsPathIncluded(path, entry->second, expansionRule);
+}
+
+SdfPathVector
+UsdCollectionAPI::CompiledMembershipQuery::GetIncludedPrimPaths() const
+{
+    SdfPathVector result;
+    for (const auto &pathAndExpansionRule : _resolvedRules) {
+        // The pseudo-root carries an inheritable rule when includeRoot is
+        // set, but is never itself a collection member.
+        if (pathAndExpansionRule.second != UsdTokens->exclude &&
+            pathAndExpansionRule.first != SdfPath::AbsoluteRootPath()) {
+            result.push_back(pathAndExpansionRule.first);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+/* static */
+std::vector<UsdCollectionAPI::CompiledMembershipQuery>
+UsdCollectionAPI::ComputeCompiledMembershipQueries(
+    const std::vector<UsdCollectionAPI> &collections,
+    const UsdPrim &root)
+{
+    TRACE_FUNCTION();
+
+    std::vector<CompiledMembershipQuery> result(collections.size());
+    WorkParallelForN(collections.size(),
+        [&collections, &root, &result](size_t start, size_t end) {
+            for (size_t i = start; i != end; ++i) {
+                result[i] = CompiledMembershipQuery(
+                    collections[i].ComputeMembershipQuery(), root);
+            }
+        });
+    return result;
+}
+
 size_t
 UsdCollectionAPI::MembershipQuery::Hash::operator()( MembershipQuery const& q)
     const
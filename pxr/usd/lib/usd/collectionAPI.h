@@ -536,6 +536,64 @@ public:
         bool _hasExcludes=false;
     };
 
+    /// Represents a compiled form of a MembershipQuery, specialized for a
+    /// subtree of the stage namespace. Compiling resolves the effective
+    /// expansion-rule for every prim beneath the given root in a single
+    /// pass, so IsPathIncluded() answers with a single map lookup instead
+    /// of the ancestor walk the uncompiled query performs. Use this when
+    /// issuing many membership queries against the same collection, e.g.
+    /// when classifying every prim in a scene.
+    ///
+    /// Like MembershipQuery, a compiled query is a snapshot; it must be
+    /// recomputed if the collection or the stage namespace changes.
+    class CompiledMembershipQuery {
+    public:
+        /// Default constructor, creates an empty CompiledMembershipQuery
+        /// object that includes nothing.
+        CompiledMembershipQuery() {}
+
+        /// Compiles \p query over the subtree of the stage namespace rooted
+        /// at \p root. The set of prims that is compiled is determined by
+        /// \p pred, exactly as in ComputeIncludedPaths().
+        USD_API
+        CompiledMembershipQuery(
+            const MembershipQuery &query,
+            const UsdPrim &root,
+            const Usd_PrimFlagsPredicate &pred=UsdPrimDefaultPredicate);
+
+        /// Returns whether the given path is included in the collection.
+        ///
+        /// For paths at or beneath the compiled root this is a constant-time
+        /// lookup; paths outside the compiled subtree fall back to the
+        /// uncompiled query's ancestor walk.
+        ///
+        /// If \p expansionRule is not NULL, it is set exactly as in
+        /// MembershipQuery::IsPathIncluded().
+        USD_API
+        bool IsPathIncluded(const SdfPath &path,
+                            TfToken *expansionRule=nullptr) const;
+
+        /// Returns the sorted list of prim paths in the compiled subtree
+        /// that are included in the collection. This classifies the entire
+        /// subtree in one sweep over the compiled table, without consulting
+        /// the stage.
+        USD_API
+        SdfPathVector GetIncludedPrimPaths() const;
+
+    private:
+        friend class UsdCollectionAPI;
+
+        // The uncompiled query, retained for direct property-path entries
+        // and for answering queries outside the compiled subtree.
+        MembershipQuery _query;
+
+        SdfPath _root;
+
+        // Effective expansion-rule for every prim in the compiled subtree.
+        // A prim maps to UsdTokens->exclude if it is not included.
+        MembershipQuery::PathExpansionRuleMap _resolvedRules;
+    };
+
     /// Returns the canonical path that represents this collection. 
     /// This points to a property named "collection:{collectionName}" on the 
     /// prim defining the collection (which won't really exist as a property 
@@ -559,10 +617,21 @@ public:
     USD_API
     MembershipQuery ComputeMembershipQuery() const; 
 
-    /// Populates the MembershipQuery object with data from this collection, so 
+    /// Populates the MembershipQuery object with data from this collection, so
     /// it can be used to query inclusion or exclusion of paths.
     USD_API
-    void ComputeMembershipQuery(MembershipQuery *query) const; 
+    void ComputeMembershipQuery(MembershipQuery *query) const;
+
+    /// Computes and compiles membership queries for all of the given
+    /// \p collections over the subtree rooted at \p root, in parallel.
+    /// The result vector is indexed like \p collections.
+    ///
+    /// \sa CompiledMembershipQuery
+    USD_API
+    static std::vector<CompiledMembershipQuery>
+    ComputeCompiledMembershipQueries(
+        const std::vector<UsdCollectionAPI> &collections,
+        const UsdPrim &root);
 
     /// Returns true if the collection has nothing included in it.
     /// This requires both that the includes relationship have no
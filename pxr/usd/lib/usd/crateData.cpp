@@ -23,6 +23,7 @@
 //
 #include "pxr/pxr.h"
 #include "pxr/usd/usd/crateData.h"
+#include "pxr/usd/usd/debugCodes.h"
 
 #include "crateFile.h"
 
@@ -37,6 +38,7 @@
 
 #include "pxr/base/work/arenaDispatcher.h"
 #include "pxr/base/work/utils.h"
+#include "pxr/base/work/detachedTask.h"
 #include "pxr/base/work/loops.h"
 
 #include "pxr/usd/sdf/payload.h"
@@ -49,8 +51,11 @@
 #include <boost/iterator/transform_iterator.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
@@ -98,15 +103,66 @@ _GetBracketingTimes(const vector<double> &times,
     return true;
 }
 
+// Like _GetBracketingTimes, but with a bracket hint. During monotonically
+// advancing playback, successive queries tend to fall in the same bracket
+// as the previous one or in an adjacent bracket, so check the remembered
+// bracket before binary searching. The hint is validated before use, so a
+// stale value only costs us the fast path.
+static inline bool
+_GetBracketingTimesWithHint(const vector<double> &times,
+                            const double time, std::atomic<size_t> *hint,
+                            double *tLower, double *tUpper)
+{
+    if (times.empty()) {
+        // No samples.
+        return false;
+    }
+
+    size_t lowerIndex = hint->load(std::memory_order_relaxed);
+    if (!(lowerIndex + 1 < times.size() &&
+          times[lowerIndex] <= time && time <= times[lowerIndex + 1])) {
+        // The hint does not identify the containing bracket; binary search.
+        if (time <= times.front()) {
+            // Time is at-or-before the first sample.
+            *tLower = *tUpper = times.front();
+            hint->store(0, std::memory_order_relaxed);
+            return true;
+        }
+        if (time >= times.back()) {
+            // Time is at-or-after the last sample.
+            *tLower = *tUpper = times.back();
+            hint->store(times.size() - 1, std::memory_order_relaxed);
+            return true;
+        }
+        lowerIndex = std::upper_bound(times.begin(), times.end(), time) -
+            times.begin() - 1;
+        hint->store(lowerIndex, std::memory_order_relaxed);
+    }
+
+    if (time == times[lowerIndex]) {
+        // Time is exactly on the bracket's lower sample.
+        *tLower = *tUpper = times[lowerIndex];
+    } else if (time == times[lowerIndex + 1]) {
+        // Time is exactly on the bracket's upper sample.
+        *tLower = *tUpper = times[lowerIndex + 1];
+    } else {
+        // Time is in-between samples; return the bracketing times.
+        *tLower = times[lowerIndex];
+        *tUpper = times[lowerIndex + 1];
+    }
+    return true;
+}
+
 class Usd_CrateDataImpl
 {
     friend class Usd_CrateData;
 
 public:
 
-    Usd_CrateDataImpl() 
+    Usd_CrateDataImpl()
         : _flatLastSet(nullptr)
         , _hashLastSet(nullptr)
+        , _frameIndexHint(0)
         , _crateFile(CrateFile::CreateNew()) {}
     
     ~Usd_CrateDataImpl() {
@@ -190,6 +246,11 @@ public:
         return false;
     }
 
+    void PrefetchValueRanges(vector<SdfPath> const &paths,
+                             double startTime, double endTime) const {
+        _crateFile->PrefetchValueRanges(paths, startTime, endTime);
+    }
+
     bool Open(string const &assetPath) {
         TfAutoMallocTag tag("Usd_CrateDataImpl::Open");
 
@@ -279,6 +340,7 @@ public:
                 _flatTypes.erase(_flatTypes.begin() + index);
             }
         }
+        _InvalidateFrameIndex();
     }
 
     inline void MoveSpec(const SdfAbstractDataSpecId& oldId,
@@ -382,55 +444,56 @@ public:
 
 
 
-    inline void _VisitSpecs(SdfAbstractData const &data,
-                            SdfAbstractDataSpecVisitor* visitor) const {
-
-        // A helper function for spoofing target & connection spec existence --
-        // we don't actually store those specs since we don't support fields on
-        // them.
-        auto doTargetAndConnectionSpecs =
-            [this, &data, visitor](SdfPath const &path, SdfSpecType specType) {
-            // Spoof existence of target & connection specs.
-            if (specType == SdfSpecTypeAttribute ||
-                specType == SdfSpecTypeRelationship) {
-                SdfPathListOp listOp;
-                SdfPathVector specs;
-                if (_GetTargetOrConnectionListOp(path, &listOp)) {
-                    if (listOp.IsExplicit()) {
-                        specs = listOp.GetExplicitItems();
-                    }
-                    else {
-                        auto const &added = listOp.GetAddedItems();
-                        auto const &prepended = listOp.GetPrependedItems();
-                        auto const &appended = listOp.GetAppendedItems();
-                        specs.resize(
-                            added.size() + prepended.size() + appended.size());
-                        using std::copy;
-                        copy(appended.begin(), appended.end(),
-                             copy(prepended.begin(), prepended.end(),
-                                  copy(added.begin(), added.end(),
-                                       specs.begin())));
-                        std::sort(specs.begin(), specs.end());
-                        specs.erase(std::unique(specs.begin(), specs.end()),
-                                    specs.end());
-                    }
-                    for (auto const &p: specs) {
-                        SdfPath tp = path.AppendTarget(p);
-                        if (!visitor->VisitSpec(
-                                data, SdfAbstractDataSpecId(&tp))) {
-                            return false;
-                        }
+    // A helper for spoofing target & connection spec existence -- we don't
+    // actually store those specs since we don't support fields on them.
+    bool _DoTargetAndConnectionSpecs(SdfAbstractData const &data,
+                                     SdfAbstractDataSpecVisitor* visitor,
+                                     SdfPath const &path,
+                                     SdfSpecType specType) const {
+        // Spoof existence of target & connection specs.
+        if (specType == SdfSpecTypeAttribute ||
+            specType == SdfSpecTypeRelationship) {
+            SdfPathListOp listOp;
+            SdfPathVector specs;
+            if (_GetTargetOrConnectionListOp(path, &listOp)) {
+                if (listOp.IsExplicit()) {
+                    specs = listOp.GetExplicitItems();
+                }
+                else {
+                    auto const &added = listOp.GetAddedItems();
+                    auto const &prepended = listOp.GetPrependedItems();
+                    auto const &appended = listOp.GetAppendedItems();
+                    specs.resize(
+                        added.size() + prepended.size() + appended.size());
+                    using std::copy;
+                    copy(appended.begin(), appended.end(),
+                         copy(prepended.begin(), prepended.end(),
+                              copy(added.begin(), added.end(),
+                                   specs.begin())));
+                    std::sort(specs.begin(), specs.end());
+                    specs.erase(std::unique(specs.begin(), specs.end()),
+                                specs.end());
+                }
+                for (auto const &p: specs) {
+                    SdfPath tp = path.AppendTarget(p);
+                    if (!visitor->VisitSpec(
+                            data, SdfAbstractDataSpecId(&tp))) {
+                        return false;
                     }
                 }
             }
-            return true;
-        };
-        
+        }
+        return true;
+    }
+
+    inline void _VisitSpecs(SdfAbstractData const &data,
+                            SdfAbstractDataSpecVisitor* visitor) const {
         if (_hashData) {
             for (auto const &p: *_hashData) {
                 SdfAbstractDataSpecId specId(&p.first);
                 if (!visitor->VisitSpec(data, specId) ||
-                    !doTargetAndConnectionSpecs(p.first, p.second.specType)) {
+                    !_DoTargetAndConnectionSpecs(
+                        data, visitor, p.first, p.second.specType)) {
                     return;
                 }
             }
@@ -442,13 +505,41 @@ public:
                     return;
                 }
                 SdfSpecType specType = _flatTypes[index++].type;
-                if (!doTargetAndConnectionSpecs(p.first, specType)) {
+                if (!_DoTargetAndConnectionSpecs(
+                        data, visitor, p.first, specType)) {
                     return;
                 }
             }
         }
     }
 
+    // Parallel visitation over the flat tables that come straight off
+    // disk.  Returns false without visiting anything if the spec set has
+    // been mutated into the hash table representation, in which case the
+    // caller should fall back to the generic implementation.
+    inline bool _VisitSpecsParallel(SdfAbstractData const &data,
+                                    SdfAbstractDataSpecVisitor* visitor) const {
+        if (_hashData) {
+            return false;
+        }
+
+        std::atomic<bool> stop(false);
+        WorkParallelForN(
+            _flatData.size(),
+            [this, &data, visitor, &stop](size_t begin, size_t end) {
+                auto iter = _flatData.begin() + begin;
+                for (size_t i = begin; i != end && !stop; ++i, ++iter) {
+                    SdfAbstractDataSpecId specId(&iter->first);
+                    if (!visitor->VisitSpec(data, specId) ||
+                        !_DoTargetAndConnectionSpecs(
+                            data, visitor, iter->first, _flatTypes[i].type)) {
+                        stop = true;
+                    }
+                }
+            });
+        return true;
+    }
+
     inline bool Has(const SdfAbstractDataSpecId& id,
                     const TfToken & field,
                     SdfAbstractDataValue* value) const {
@@ -505,6 +596,60 @@ public:
         return result;
     }
 
+    template <class Data>
+    inline void _GetFieldsHelper(Data const &d,
+                                 SdfAbstractDataSpecId const &id,
+                                 TfToken const *fieldNames,
+                                 VtValue *values,
+                                 size_t numFields) const {
+        auto i = d.find(id.GetFullSpecPath());
+        for (size_t k = 0; k != numFields; ++k) {
+            values[k] = VtValue();
+            if (i == d.end()) {
+                continue;
+            }
+            auto const &fields = i->second.fields.Get();
+            for (size_t j=0, jEnd = fields.size(); j != jEnd; ++j) {
+                if (fields[j].first == fieldNames[k]) {
+                    values[k] = _DetachValue(fields[j].second);
+                    if (fieldNames[k] == SdfDataTokens->TimeSamples) {
+                        // Special case, convert internal TimeSamples to
+                        // SdfTimeSampleMap.
+                        values[k] = _MakeTimeSampleMap(values[k]);
+                    } else if (fieldNames[k] == SdfFieldKeys->Payload) {
+                        // Special case, see Has().
+                        values[k] = _ToPayloadListOpValue(values[k]);
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    // Batched field access: resolve all of the named fields with a single
+    // lookup of the spec's field list, rather than one lookup per field.
+    inline void GetFields(const SdfAbstractDataSpecId& id,
+                          const TfToken *fieldNames,
+                          VtValue *values,
+                          size_t numFields) const {
+        _hashData ?
+            _GetFieldsHelper(*_hashData, id, fieldNames, values, numFields) :
+            _GetFieldsHelper(_flatData, id, fieldNames, values, numFields);
+    }
+
+    // Batched field access: resolve the same field for many paths in one
+    // call, amortizing the virtual dispatch from the layer.
+    inline void GetFieldForPaths(const SdfPath *paths,
+                                 size_t numPaths,
+                                 const TfToken &fieldName,
+                                 VtValue *values) const {
+        for (size_t i = 0; i != numPaths; ++i) {
+            const SdfAbstractDataSpecId id(&paths[i]);
+            values[i] = VtValue();
+            Has(id, fieldName, &values[i]);
+        }
+    }
+
     template <class Data>
     inline void _ListHelper(Data const &d, SdfAbstractDataSpecId const &id,
                             vector<TfToken> &out) const {
@@ -589,6 +734,9 @@ public:
                             fieldName.GetText(), TfStringify(value).c_str());
             return;
         }
+        if (fieldName == SdfDataTokens->TimeSamples) {
+            _InvalidateFrameIndex();
+        }
         _hashData ?
             _SetHelper(*_hashData, id, _hashLastSet, fieldName, value) :
             _SetHelper(_flatData, id, _flatLastSet, fieldName, value);
@@ -623,6 +771,9 @@ public:
     }
 
     inline void Erase(const SdfAbstractDataSpecId& id, const TfToken & field) {
+        if (field == SdfDataTokens->TimeSamples) {
+            _InvalidateFrameIndex();
+        }
         _hashData ?
             _EraseHelper(*_hashData, id, field) :
             _EraseHelper(_flatData, id, field);
@@ -630,8 +781,8 @@ public:
 
     inline std::set<double>
     ListAllTimeSamples() const {
-        auto times = _ListAllTimeSamples();
-        return std::set<double>(times.begin(), times.end());
+        auto times = _GetFrameIndex();
+        return std::set<double>(times->begin(), times->end());
     }
 
     inline std::set<double>
@@ -642,7 +793,9 @@ public:
 
     inline bool GetBracketingTimeSamples(
         double time, double* tLower, double* tUpper) const {
-        return _GetBracketingTimes(_ListAllTimeSamples(), time, tLower, tUpper);
+        auto times = _GetFrameIndex();
+        return _GetBracketingTimesWithHint(
+            *times, time, &_frameIndexHint, tLower, tUpper);
     }
 
     inline size_t
@@ -716,6 +869,9 @@ public:
             newSamples.times.GetMutable().
                 insert(newSamples.times.GetMutable().begin() + index, time);
             newSamples.values.insert(newSamples.values.begin() + index, value);
+            // Introducing a new sample time invalidates the frame index;
+            // overwriting the value at an existing time does not.
+            _InvalidateFrameIndex();
         } else {
             // Make the values mutable, then modify.
             _crateFile->MakeTimeSampleValuesMutable(newSamples);
@@ -759,8 +915,9 @@ public:
             newSamples.times.GetMutable().erase(
                 newSamples.times.GetMutable().begin() + index);
             newSamples.values.erase(newSamples.values.begin() + index);
-            
+
             fieldValue->UncheckedSwap(newSamples);
+            _InvalidateFrameIndex();
         }
     }
 
@@ -771,6 +928,7 @@ private:
 
         // Ensure we start from a clean slate.
         _ClearSpecData();
+        _InvalidateFrameIndex();
 
         WorkArenaDispatcher dispatcher;
 
@@ -948,6 +1106,30 @@ private:
             _ListAllTimeSamplesHelper(_flatData);
     }
 
+    inline std::shared_ptr<const vector<double>> _GetFrameIndex() const {
+        {
+            std::lock_guard<std::mutex> lock(_frameIndexMutex);
+            if (_frameIndex) {
+                return _frameIndex;
+            }
+        }
+
+        // Build the index outside the lock. Concurrent builders race
+        // benignly; the first to publish wins.
+        auto index = std::make_shared<vector<double>>(_ListAllTimeSamples());
+
+        std::lock_guard<std::mutex> lock(_frameIndexMutex);
+        if (!_frameIndex) {
+            _frameIndex = std::move(index);
+        }
+        return _frameIndex;
+    }
+
+    inline void _InvalidateFrameIndex() {
+        std::lock_guard<std::mutex> lock(_frameIndexMutex);
+        _frameIndex.reset();
+    }
+
     inline VtValue _MakeTimeSampleMap(VtValue const &val) const {
         if (val.IsHolding<TimeSamples>()) {
             SdfTimeSampleMap result;
@@ -1165,6 +1347,16 @@ private:
     };
     std::vector<_SpecType> _flatTypes;
 
+    // Cached frame index: a lazily-built sorted array of every sample time
+    // in the layer, shared out under _frameIndexMutex so the whole-layer
+    // time-sample queries need not walk every spec per call, plus the
+    // bracket found by the most recent GetBracketingTimeSamples() query.
+    // The hint is validated against the index before use, so it needs no
+    // synchronization beyond atomicity.
+    mutable std::mutex _frameIndexMutex;
+    mutable std::shared_ptr<const vector<double>> _frameIndex;
+    mutable std::atomic<size_t> _frameIndexHint;
+
     // Underlying file.
     std::unique_ptr<CrateFile> _crateFile;
 };
@@ -1208,11 +1400,36 @@ Usd_CrateData::Save(string const &fileName)
         return _impl->Save(fileName);
     }
     else {
-        // We copy to a temporary data and save that.
-        Usd_CrateData tmp;
-        tmp.CopyFrom(SdfAbstractDataConstPtr(this));
-        return tmp.Save(fileName);
+        return Compact(fileName);
+    }
+}
+
+bool
+Usd_CrateData::Compact(string const &fileName)
+{
+    if (fileName.empty()) {
+        TF_CODING_ERROR("Tried to save to empty fileName");
+        return false;
     }
+
+    // We copy to a temporary data and save that; since the temporary has
+    // never read from fileName it always packs a fresh, compact file.
+    Usd_CrateData tmp;
+    tmp.CopyFrom(SdfAbstractDataConstPtr(this));
+    return tmp.Save(fileName);
+}
+
+void
+Usd_CrateData::PrefetchValueRanges(const std::vector<SdfPath> &paths,
+                                   double startTime, double endTime)
+{
+    // Issue the advisory reads from a detached task so callers (say, a
+    // playback loop) are never blocked on them; the captured ref keeps this
+    // object (and so the underlying crate file) alive until they are done.
+    TfRefPtr<Usd_CrateData> self(this);
+    WorkRunDetachedTask([self, paths, startTime, endTime]() {
+            self->_impl->PrefetchValueRanges(paths, startTime, endTime);
+        });
 }
 
 bool
@@ -1231,6 +1448,77 @@ Usd_CrateData::StreamsData() const
     return _impl->StreamsData();
 }
 
+void
+Usd_CrateData::CopyFrom(const SdfAbstractDataConstPtr &source)
+{
+    if (!source) {
+        return;
+    }
+
+    TRACE_FUNCTION();
+
+    // Collect the spec paths up front so the field reads can be batched.
+    struct _SpecCollector : public SdfAbstractDataSpecVisitor {
+        virtual bool VisitSpec(SdfAbstractData const &,
+                               SdfAbstractDataSpecId const &id) {
+            paths.push_back(id.GetFullSpecPath());
+            return true;
+        }
+        virtual void Done(SdfAbstractData const &) {}
+        SdfPathVector paths;
+    };
+    _SpecCollector collector;
+    source->VisitSpecs(&collector);
+
+    struct _SpecContents {
+        SdfSpecType specType;
+        std::vector<TfToken> fields;
+        std::vector<VtValue> values;
+    };
+
+    // Stream the specs across in bounded batches: the reads from the
+    // source (which may parse or decompress values) only perform const
+    // queries and run in parallel, while the writes into this object
+    // stay serial.  The batch size bounds the transient memory used for
+    // in-flight values.
+    static const size_t batchSize = 4096;
+    const size_t numSpecs = collector.paths.size();
+    std::vector<_SpecContents> batch;
+
+    for (size_t start = 0; start < numSpecs; start += batchSize) {
+        const size_t n = std::min(batchSize, numSpecs - start);
+        batch.clear();
+        batch.resize(n);
+
+        WorkParallelForN(n,
+            [&source, &collector, &batch, start](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    SdfAbstractDataSpecId id(&collector.paths[start + i]);
+                    _SpecContents &spec = batch[i];
+                    spec.specType = source->GetSpecType(id);
+                    spec.fields = source->List(id);
+                    spec.values.reserve(spec.fields.size());
+                    for (TfToken const &field : spec.fields) {
+                        spec.values.push_back(source->Get(id, field));
+                    }
+                }
+            });
+
+        for (size_t i = 0; i < n; ++i) {
+            SdfAbstractDataSpecId id(&collector.paths[start + i]);
+            _SpecContents const &spec = batch[i];
+            CreateSpec(id, spec.specType);
+            for (size_t f = 0; f != spec.fields.size(); ++f) {
+                Set(id, spec.fields[f], spec.values[f]);
+            }
+        }
+
+        TF_DEBUG(USD_CRATE_COPY).Msg(
+            "Copied %zu/%zu specs\n",
+            std::min(start + n, numSpecs), numSpecs);
+    }
+}
+
 bool
 Usd_CrateData::HasSpec(const SdfAbstractDataSpecId &id) const
 {
@@ -1268,6 +1556,16 @@ Usd_CrateData::_VisitSpecs(SdfAbstractDataSpecVisitor* visitor) const
     _impl->_VisitSpecs(*this, visitor);
 }
 
+void
+Usd_CrateData::_VisitSpecsParallel(SdfAbstractDataSpecVisitor* visitor) const
+{
+    if (!_impl->_VisitSpecsParallel(*this, visitor)) {
+        // The spec set has been mutated into hashed storage; fall back to
+        // the generic collect-and-fan-out implementation.
+        SdfAbstractData::_VisitSpecsParallel(visitor);
+    }
+}
+
 bool
 Usd_CrateData::Has(const SdfAbstractDataSpecId& id,
                    const TfToken & field,
@@ -1290,6 +1588,24 @@ Usd_CrateData::Get(const SdfAbstractDataSpecId& id, const TfToken & field) const
     return _impl->Get(id, field);
 }
 
+void
+Usd_CrateData::GetFields(const SdfAbstractDataSpecId& id,
+                         const TfToken *fieldNames,
+                         VtValue *values,
+                         size_t numFields) const
+{
+    _impl->GetFields(id, fieldNames, values, numFields);
+}
+
+void
+Usd_CrateData::GetFieldForPaths(const SdfPath *paths,
+                                size_t numPaths,
+                                const TfToken &fieldName,
+                                VtValue *values) const
+{
+    _impl->GetFieldForPaths(paths, numPaths, fieldName, values);
+}
+
 std::vector<TfToken>
 Usd_CrateData::List(const SdfAbstractDataSpecId& id) const
 {
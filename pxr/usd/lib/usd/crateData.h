@@ -51,10 +51,30 @@ public:
 
     static bool CanRead(const std::string &assetPath);
     bool Save(const std::string &fileName);
+    // Like Save(), but always rewrite the entire file compactly, reclaiming
+    // the space that incremental and append-based saves leave behind.
+    bool Compact(const std::string &fileName);
     bool Open(const std::string &assetPath);
 
+    // Hint to the operating system that the value data for specs at or
+    // under \p paths will be needed soon, so it may begin reading ahead.
+    // For time-sampled fields, only samples with times in [startTime,
+    // endTime] are considered.  The hints are issued from a detached
+    // background task that keeps this object alive; this call returns
+    // immediately.  Purely advisory -- useful for staying ahead of the
+    // read head during playback from slow storage.
+    void PrefetchValueRanges(const std::vector<SdfPath> &paths,
+                             double startTime, double endTime);
+
     virtual bool StreamsData() const;
-    virtual void CreateSpec(const SdfAbstractDataSpecId &id, 
+
+    // Streaming override of the generic spec-by-spec copy: reads fields
+    // from \p source in parallel, in bounded batches, while the writes
+    // into this object stay serial.  Used when converting other formats
+    // to crate.  The USD_CRATE_COPY debug flag reports progress.
+    virtual void CopyFrom(const SdfAbstractDataConstPtr &source);
+
+    virtual void CreateSpec(const SdfAbstractDataSpecId &id,
                             SdfSpecType specType);
     virtual bool HasSpec(const SdfAbstractDataSpecId &id) const;
     virtual void EraseSpec(const SdfAbstractDataSpecId &id);
@@ -66,8 +86,16 @@ public:
                      SdfAbstractDataValue* value) const;
     virtual bool Has(const SdfAbstractDataSpecId& id, const TfToken& fieldName,
                      VtValue *value=NULL) const;
-    virtual VtValue Get(const SdfAbstractDataSpecId& id, 
+    virtual VtValue Get(const SdfAbstractDataSpecId& id,
                         const TfToken& fieldName) const;
+    virtual void GetFields(const SdfAbstractDataSpecId& id,
+                           const TfToken* fieldNames,
+                           VtValue* values,
+                           size_t numFields) const;
+    virtual void GetFieldForPaths(const SdfPath* paths,
+                                  size_t numPaths,
+                                  const TfToken& fieldName,
+                                  VtValue* values) const;
     virtual void Set(const SdfAbstractDataSpecId& id, const TfToken& fieldName,
                      const VtValue& value);
     virtual void Set(const SdfAbstractDataSpecId& id, const TfToken& fieldName,
@@ -116,6 +144,8 @@ private:
 
     // SdfAbstractData overrides
     virtual void _VisitSpecs(SdfAbstractDataSpecVisitor* visitor) const;
+    virtual void _VisitSpecsParallel(
+        SdfAbstractDataSpecVisitor* visitor) const;
 
     friend class Usd_CrateDataImpl;
     std::unique_ptr<class Usd_CrateDataImpl> _impl;
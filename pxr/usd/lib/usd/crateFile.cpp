@@ -29,6 +29,7 @@
 #include "pxr/base/arch/demangle.h"
 #include "pxr/base/arch/errno.h"
 #include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/arch/hash.h"
 #include "pxr/base/arch/regex.h"
 #include "pxr/base/arch/systemInfo.h"
 #include "pxr/base/gf/half.h"
@@ -58,6 +59,7 @@
 #include "pxr/base/tf/mallocTag.h"
 #include "pxr/base/tf/ostreamMethods.h"
 #include "pxr/base/tf/safeOutputFile.h"
+#include "pxr/base/tf/staticData.h"
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/tf/token.h"
 #include "pxr/base/trace/trace.h"
@@ -84,6 +86,8 @@
 
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <tuple>
 #include <type_traits>
 
@@ -131,6 +135,70 @@ TF_DEFINE_ENV_SETTING(
     "optimization, we create VtArrays that point directly into the memory "
     "mapped region rather than copying the data to heap buffers.");
 
+TF_DEFINE_ENV_SETTING(
+    USDC_MMAP_ADVISE, "normal",
+    "Memory advice applied to the mapped region of crate files once their "
+    "structural sections have been read.  One of 'normal', 'random', or "
+    "'willneed'.  'random' avoids large OS read-ahead, which can be "
+    "expensive on network filesystems; 'willneed' asks the OS to read the "
+    "whole file ahead of use.  Ignored when USDC_MMAP_PREFETCH_KB is set.");
+
+TF_DEFINE_ENV_SETTING(
+    USDC_MMAP_HUGE_PAGES, false,
+    "Hint to the OS that crate file mappings should be backed by huge pages "
+    "(e.g. Linux transparent huge pages) where supported.  Reduces minor "
+    "faults and TLB pressure when many large crate files are mapped, at the "
+    "cost of potentially higher memory use.");
+
+TF_DEFINE_ENV_SETTING(
+    USDC_MMAP_POPULATE, false,
+    "Eagerly populate crate file mappings at map time instead of faulting "
+    "pages in on first access.  Useful on fast local storage when files are "
+    "known to be fully consumed; avoid on network filesystems, where it "
+    "forces a full read of every opened file.");
+
+TF_DEFINE_ENV_SETTING(
+    USDC_COMPRESSION_CODEC, "lz4",
+    "Codec used for the compressed sections of newly written crate files.  "
+    "One of 'lz4' or 'zstd'.  'zstd' typically produces noticeably smaller "
+    "files, requires a build with zstd support, and produces files that "
+    "require crate version 0.9.0 or newer to read.");
+
+TF_DEFINE_ENV_SETTING(
+    USDC_USE_APPEND_SAVE, false,
+    "When saving edits to an existing crate file, append the new data and a "
+    "new table of contents at the end of the file instead of rewriting the "
+    "structural sections in place.  Prior file contents are never "
+    "overwritten, so an interrupted save cannot destroy sections that an "
+    "existing reader of the file may be using, at the cost of the file "
+    "growing with every save.  Exporting with the usdc file format argument "
+    "'compact' rewrites a grown file compactly.");
+
+TF_DEFINE_ENV_SETTING(
+    USDC_ENABLE_SHARED_TOKEN_TABLES, true,
+    "Share parsed token tables between crate files with identical tokens "
+    "sections.  Sets of layers written by the same pipeline tend to repeat "
+    "the same property-name vocabularies; with this enabled the decompress "
+    "and tokenize cost for a given table is paid once per process rather "
+    "than once per file.  Shared tables are retained for the life of the "
+    "process.");
+
+TF_DEFINE_ENV_SETTING(
+    USDC_USE_SHARED_READONLY_MMAP, false,
+    "Map crate files with shared read-only mappings instead of private "
+    "copy-on-write mappings.  Shared read-only mappings are backed directly "
+    "by the filesystem page cache, so every process on a host that opens "
+    "the same crate file references a single physical copy of its pages.  "
+    "Useful when many processes on one machine read the same set of "
+    "stages.  Disables the zero-copy array optimization, which requires "
+    "copy-on-write pages.");
+
+static bool _UseSharedReadOnlyMmap()
+{
+    static bool useShared = TfGetEnvSetting(USDC_USE_SHARED_READONLY_MMAP);
+    return useShared;
+}
+
 static int _GetMMapPrefetchKB()
 {
     auto getKB = []() {
@@ -146,6 +214,23 @@ static int _GetMMapPrefetchKB()
     return kb;
 }
 
+// Return the ArchMapFlags to use for crate file mappings, as configured by
+// the USDC_MMAP_HUGE_PAGES and USDC_MMAP_POPULATE settings.
+static int _GetMMapFlags()
+{
+    static int flags = []() {
+        int f = ArchMapFlagDefault;
+        if (TfGetEnvSetting(USDC_MMAP_HUGE_PAGES)) {
+            f |= ArchMapFlagHugePages;
+        }
+        if (TfGetEnvSetting(USDC_MMAP_POPULATE)) {
+            f |= ArchMapFlagPopulate;
+        }
+        return f;
+    }();
+    return flags;
+}
+
 // Write nbytes bytes to fd at pos.
 static inline int64_t
 WriteToFd(FILE *file, void const *bytes, int64_t nbytes, int64_t pos) {
@@ -278,6 +363,8 @@ using std::unordered_map;
 using std::vector;
 
 // Version history:
+// 0.9.0: Compressed sections may be written with the zstd codec in addition
+//        to LZ4.
 // 0.8.0: Added support for SdfPayloadListOp values and SdfPayload values with
 //        layer offsets.
 // 0.7.0: Array sizes written as 64 bit ints.
@@ -291,7 +378,7 @@ using std::vector;
 //        See _PathItemHeader_0_0_1.
 // 0.0.1: Initial release.
 constexpr uint8_t USDC_MAJOR = 0;
-constexpr uint8_t USDC_MINOR = 8;
+constexpr uint8_t USDC_MINOR = 9;
 constexpr uint8_t USDC_PATCH = 0;
 
 struct CrateFile::Version
@@ -380,6 +467,28 @@ GetVersionForNewlyCreatedFiles() {
     return ver;
 }
 
+static TfFastCompression::Codec
+_GetCompressionCodecForNewFiles() {
+    string setting = TfGetEnvSetting(USDC_COMPRESSION_CODEC);
+    if (setting == "zstd") {
+        if (TfFastCompression::HasZstdSupport()) {
+            return TfFastCompression::CodecZstd;
+        }
+        TF_WARN("USDC_COMPRESSION_CODEC=zstd requires a build with zstd "
+                "support - falling back to 'lz4'");
+    } else if (setting != "lz4") {
+        TF_WARN("Invalid value '%s' for USDC_COMPRESSION_CODEC - "
+                "falling back to 'lz4'", setting.c_str());
+    }
+    return TfFastCompression::CodecLZ4;
+}
+
+static TfFastCompression::Codec
+GetCompressionCodecForNewFiles() {
+    static TfFastCompression::Codec codec = _GetCompressionCodecForNewFiles();
+    return codec;
+}
+
 constexpr char const *USDC_IDENT = "PXR-USDC"; // 8 chars.
 
 struct _PathItemHeader_0_0_1 {
@@ -592,6 +701,12 @@ struct _MmapStream {
             _mapping->GetMapStart() + offset, size, ArchMemAdviceWillNeed);
     }
 
+    // Shared read-only mappings cannot serve zero-copy arrays, so this must
+    // also be checked at runtime.
+    bool CanZeroCopy() const {
+        return _mapping->SupportsZeroCopy();
+    }
+
     Vt_ArrayForeignDataSource *
     CreateZeroCopyDataSource(void *addr, size_t numBytes) {
         return _mapping->AddRangeReference(addr, numBytes);
@@ -847,19 +962,39 @@ struct CrateFile::_PackingContext
         , writeVersion(crate->_assetPath.empty() ?
                        GetVersionForNewlyCreatedFiles() :
                        Version(crate->_boot))
+        , writeCodec(GetCompressionCodecForNewFiles())
+        , appendMode(!crate->_assetPath.empty() &&
+                     TfGetEnvSetting(USDC_USE_APPEND_SAVE))
         , bufferedOutput(outFile.Get())
         , safeOutputFile(std::move(outFile)) {
+
+        // Using any codec other than LZ4 requires a version that knows to
+        // negotiate the codec from the compressed data.
+        if (writeCodec != TfFastCompression::CodecLZ4) {
+            RequestWriteVersionUpgrade(
+                Version(0, 9, 0),
+                "The zstd compression codec was requested via "
+                "USDC_COMPRESSION_CODEC, which requires crate version "
+                "0.9.0.");
+        }
         
         // Populate this context with everything we need from \p crate in order
         // to do deduplication, etc.
         WorkArenaDispatcher wd;
 
-        // Read in any unknown sections so we can rewrite them later.
+        // Read in any unknown sections so we can rewrite them later.  In
+        // append mode the old sections stay where they are, so we just
+        // record their TOC entries for the new generation instead.
         wd.Run([this, crate]() {
                 for (auto const &sec: crate->_toc.sections) {
                     if (!_IsKnownSection(sec.name)) {
-                        unknownSections.emplace_back(
-                            sec.name, _ReadSectionBytes(sec, crate), sec.size);
+                        if (appendMode) {
+                            preservedSections.push_back(sec);
+                        } else {
+                            unknownSections.emplace_back(
+                                sec.name, _ReadSectionBytes(sec, crate),
+                                sec.size);
+                        }
                     }
                 }
             });
@@ -904,8 +1039,16 @@ struct CrateFile::_PackingContext
                         crate->GetString(StringIndex(i))] = StringIndex(i);
             });
 
-        // Set file pos to start of the structural sections in the current TOC.
-        bufferedOutput.Seek(crate->_toc.GetMinimumSectionStart());
+        // Set file pos to the point where the new data will be written: the
+        // start of the structural sections in the current TOC, or in append
+        // mode the (aligned) end of the file, leaving everything the current
+        // TOC refers to in place.
+        if (appendMode) {
+            bufferedOutput.Seek(
+                (ArchGetFileLength(safeOutputFile.Get()) + 7) & ~7);
+        } else {
+            bufferedOutput.Seek(crate->_toc.GetMinimumSectionStart());
+        }
         wd.Wait();
     }
 
@@ -954,10 +1097,19 @@ struct CrateFile::_PackingContext
     // Unknown sections we're moving to the new structural area.
     vector<tuple<string, RawDataPtr, size_t>> unknownSections;
 
+    // Unknown sections we're leaving in place in append mode; their old
+    // TOC entries carry over to the new TOC unchanged.
+    vector<_Section> preservedSections;
+
     // Filename we're writing to.
     std::string fileName;
     // Version we're writing.
     Version writeVersion;
+    // Codec used for compressed sections we write.
+    TfFastCompression::Codec writeCodec;
+    // Whether new data is appended at the end of the file, leaving the
+    // prior contents untouched, rather than rewritten in place.
+    bool appendMode;
     // BufferedOutput helper.
     _BufferedOutput bufferedOutput;
     // Output destination.
@@ -1554,7 +1706,8 @@ _WriteCompressedInts(Writer w, Int const *begin, size_t size)
     std::unique_ptr<char[]> compBuffer(
         new char[Compressor::GetCompressedBufferSize(size)]);
     size_t compSize =
-        Compressor::CompressToBuffer(begin, size, compBuffer.get());
+        Compressor::CompressToBuffer(begin, size, compBuffer.get(),
+                                     w.crate->GetWriteCodec());
     w.template WriteAs<uint64_t>(compSize);
     w.WriteContiguous(compBuffer.get(), compSize);
 }
@@ -1708,6 +1861,7 @@ _ReadUncompressedArray(
     size_t numBytes = sizeof(T) * size;
     static constexpr size_t MinZeroCopyArrayBytes = 2048; // Half a page?
     if (zeroCopyEnabled &&
+        /* mapping supports it? */reader.src.CanZeroCopy() &&
         /* size reasonable? */numBytes >= MinZeroCopyArrayBytes &&
         /*    alignment ok? */
         (reinterpret_cast<uintptr_t>(
@@ -1834,6 +1988,25 @@ _ReadPossiblyCompressedArray(
     }
 }
 
+// Hasher for the array dedup tables.  For bitwise-copyable element types,
+// hash the raw bytes with ArchHash64; this is considerably faster than
+// combining per-element hashes, and the dedup tables hash every array
+// payload written.  Other element types (strings, tokens, paths...) fall
+// back to the generic hasher.
+template <class T, class Enable = void>
+struct _ArrayHasher : _Hasher {};
+
+template <class T>
+struct _ArrayHasher<
+    T, typename std::enable_if<_IsBitwiseReadWrite<T>::value>::type>
+{
+    inline size_t operator()(VtArray<T> const &array) const {
+        return ArchHash64(
+            reinterpret_cast<char const *>(array.cdata()),
+            array.size() * sizeof(T));
+    }
+};
+
 // Array handler for types that support arrays -- does deduplication.
 template <class T>
 struct CrateFile::_ArrayValueHandlerBase<
@@ -1850,6 +2023,21 @@ struct CrateFile::_ArrayValueHandlerBase<
         if (!_arrayDedup) {
             _arrayDedup.reset(
                 new typename decltype(_arrayDedup)::element_type);
+            _arrayPtrDedup.reset(
+                new typename decltype(_arrayPtrDedup)::element_type);
+        }
+
+        // Arrays authored by copy share their copy-on-write buffer (held
+        // poses, repeated topology), so consult a pointer-keyed table
+        // first: a hit dedups the occurrence without hashing or comparing
+        // contents at all.  The table retains a reference to each array,
+        // which both keeps the buffer address from being recycled and
+        // forces any later writer to detach, so a matching pointer
+        // guarantees matching contents.
+        auto ptrResult = _arrayPtrDedup->emplace(
+            array.cdata(), std::make_pair(array, result));
+        if (!ptrResult.second) {
+            return ptrResult.first->second.second;
         }
 
         auto iresult = _arrayDedup->emplace(array, result);
@@ -1868,6 +2056,7 @@ struct CrateFile::_ArrayValueHandlerBase<
                     w, array, w.crate->_packCtx->writeVersion, 0);
             }
         }
+        ptrResult.first->second.second = target;
         return target;
     }
 
@@ -1912,10 +2101,15 @@ struct CrateFile::_ArrayValueHandlerBase<
         // Invoke base implementation to clear scalar table.
         _ScalarValueHandlerBase<T>::Clear();
         _arrayDedup.reset();
+        _arrayPtrDedup.reset();
     }
-    
+
     std::unique_ptr<
-        std::unordered_map<VtArray<T>, ValueRep, _Hasher>> _arrayDedup;
+        std::unordered_map<
+            VtArray<T>, ValueRep, _ArrayHasher<T>>> _arrayDedup;
+    std::unique_ptr<
+        std::unordered_map<
+            void const *, std::pair<VtArray<T>, ValueRep>>> _arrayPtrDedup;
 };
 
 // _ValueHandler derives _ArrayValueHandlerBase, which in turn derives
@@ -1975,7 +2169,13 @@ CrateFile::_MmapAsset(char const *assetPath, ArAssetSharedPtr const &asset)
     FILE *file; size_t offset;
     std::tie(file, offset) = asset->GetFileUnsafe();
     auto mapping = _FileMappingIPtr(
-        new _FileMapping(ArchMapFileReadWrite(file), offset, asset->GetSize()));
+        _UseSharedReadOnlyMmap() ?
+        new _FileMapping(
+            ArchMapFileReadOnly(file, /*errMsg=*/nullptr, _GetMMapFlags()),
+            offset, asset->GetSize()) :
+        new _FileMapping(
+            ArchMapFileReadWrite(file, /*errMsg=*/nullptr, _GetMMapFlags()),
+            offset, asset->GetSize()));
     if (!mapping->GetMapStart()) {
         TF_RUNTIME_ERROR("Couldn't map asset '%s'", assetPath);
         mapping.reset();
@@ -1988,7 +2188,11 @@ CrateFile::_FileMappingIPtr
 CrateFile::_MmapFile(char const *fileName, FILE *file)
 {
     auto mapping = _FileMappingIPtr(
-        new _FileMapping(ArchMapFileReadWrite(file)));
+        _UseSharedReadOnlyMmap() ?
+        new _FileMapping(
+            ArchMapFileReadOnly(file, /*errMsg=*/nullptr, _GetMMapFlags())) :
+        new _FileMapping(
+            ArchMapFileReadWrite(file, /*errMsg=*/nullptr, _GetMMapFlags())));
     if (!mapping->GetMapStart()) {
         TF_RUNTIME_ERROR("Couldn't map file '%s'", fileName);
         mapping.reset();
@@ -2057,6 +2261,12 @@ CrateFile::GetFileVersionToken() const
     return TfToken(Version(_boot).AsString());
 }
 
+TfFastCompression::Codec
+CrateFile::GetWriteCodec() const
+{
+    return _packCtx ? _packCtx->writeCodec : TfFastCompression::CodecLZ4;
+}
+
 CrateFile::CrateFile(bool useMmap)
     : _useMmap(useMmap)
 {
@@ -2113,10 +2323,23 @@ CrateFile::_InitMMap() {
         if (!m.IsClean())
             _assetPath.clear();
 
-        // Restore default prefetch behavior if we're not doing custom prefetch.
+        // Restore the configured advice if we're not doing custom prefetch.
         if (!_GetMMapPrefetchKB()) {
-            ArchMemAdvise(
-                _mmapSrc->GetMapStart(), mapSize, ArchMemAdviceNormal);
+            static ArchMemAdvice advice = []() {
+                string setting = TfGetEnvSetting(USDC_MMAP_ADVISE);
+                if (setting == "random") {
+                    return ArchMemAdviceRandomAccess;
+                }
+                if (setting == "willneed") {
+                    return ArchMemAdviceWillNeed;
+                }
+                if (setting != "normal") {
+                    TF_WARN("Invalid value '%s' for USDC_MMAP_ADVISE; "
+                            "using 'normal'", setting.c_str());
+                }
+                return ArchMemAdviceNormal;
+            }();
+            ArchMemAdvise(_mmapSrc->GetMapStart(), mapSize, advice);
         }
     } else {
         _assetPath.clear();
@@ -2382,6 +2605,128 @@ CrateFile::Packer::~Packer()
         _crate->_packCtx.reset();
 }
 
+void
+CrateFile::PrefetchValueRanges(vector<SdfPath> const &paths,
+                               double startTime, double endTime) const
+{
+    TfAutoMallocTag tag("Usd_CrateFile::CrateFile::PrefetchValueRanges");
+    TRACE_FUNCTION();
+
+    // Advisory reads are only possible for mmap and pread sources.
+    if (!_mmapSrc && !_preadSrc.file) {
+        return;
+    }
+
+    // Collect the payload offsets of every non-inlined value reachable from
+    // the specs at or under \p paths.
+    vector<int64_t> offsets;
+    for (auto const &spec: _specs) {
+        SdfPath const &specPath = GetPath(spec.pathIndex);
+        bool included = false;
+        for (auto const &path: paths) {
+            if (specPath.HasPrefix(path)) {
+                included = true;
+                break;
+            }
+        }
+        if (!included) {
+            continue;
+        }
+
+        for (size_t fsi = spec.fieldSetIndex.value;
+             fsi != _fieldSets.size() && _fieldSets[fsi] != FieldIndex();
+             ++fsi) {
+            ValueRep rep = _fields[_fieldSets[fsi].value].valueRep;
+            if (rep.IsInlined() || !rep.GetPayload()) {
+                continue;
+            }
+            if (rep.GetType() == TypeEnum::TimeSamples) {
+                _CollectTimeSampleOffsets(rep, startTime, endTime, &offsets);
+            } else {
+                offsets.push_back(rep.GetPayload());
+            }
+        }
+    }
+    if (offsets.empty()) {
+        return;
+    }
+
+    // Coalesce the offsets into ranges.  Value sizes are not recorded in the
+    // file, so we use the distance to the next collected offset as a bound
+    // and extend the final range of each run by a fixed window; hinting a
+    // few extra pages is harmless for an advisory call.
+    std::sort(offsets.begin(), offsets.end());
+    offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+
+    constexpr int64_t maxGap = 1024 * 1024;
+    constexpr int64_t tailBytes = 256 * 1024;
+
+    int64_t rangeStart = offsets.front();
+    int64_t prev = offsets.front();
+    for (size_t i = 1; i <= offsets.size(); ++i) {
+        if (i == offsets.size() || offsets[i] - prev > maxGap) {
+            _PrefetchRange(rangeStart, prev + tailBytes - rangeStart);
+            if (i != offsets.size()) {
+                rangeStart = prev = offsets[i];
+            }
+        } else {
+            prev = offsets[i];
+        }
+    }
+}
+
+void
+CrateFile::_CollectTimeSampleOffsets(ValueRep rep,
+                                     double startTime, double endTime,
+                                     vector<int64_t> *offsets) const
+{
+    VtValue val = UnpackValue(rep);
+    if (!val.IsHolding<TimeSamples>()) {
+        return;
+    }
+    auto const &ts = val.UncheckedGet<TimeSamples>();
+    if (ts.IsInMemory() || !ts.valuesFileOffset) {
+        return;
+    }
+
+    // Find the range of samples with times inside [startTime, endTime].
+    auto const &times = ts.times.Get();
+    auto lo = std::lower_bound(times.begin(), times.end(), startTime);
+    auto hi = std::upper_bound(times.begin(), times.end(), endTime);
+    if (lo == hi) {
+        return;
+    }
+    size_t const index = lo - times.begin();
+    size_t const count = hi - lo;
+
+    // Read the per-sample reps to find each sample's payload.
+    vector<ValueRep> reps(count);
+    _ReadRawBytes(ts.valuesFileOffset + index * sizeof(ValueRep),
+                  count * sizeof(ValueRep),
+                  reinterpret_cast<char *>(reps.data()));
+    for (ValueRep sampleRep: reps) {
+        if (!sampleRep.IsInlined() && sampleRep.GetPayload()) {
+            offsets->push_back(sampleRep.GetPayload());
+        }
+    }
+}
+
+void
+CrateFile::_PrefetchRange(int64_t start, int64_t size) const
+{
+    if (_useMmap && _mmapSrc) {
+        int64_t const mapSize = _mmapSrc->GetLength();
+        if (start < mapSize) {
+            ArchMemAdvise(_mmapSrc->GetMapStart() + start,
+                          std::min(size, mapSize - start),
+                          ArchMemAdviceWillNeed);
+        }
+    } else if (_preadSrc.file) {
+        ArchFileAdvise(_preadSrc.file, _preadSrc.startOffset + start, size,
+                       ArchFileAdviceWillNeed);
+    }
+}
+
 vector<tuple<string, int64_t, int64_t>>
 CrateFile::GetSectionsNameStartSize() const
 {
@@ -2462,6 +2807,12 @@ CrateFile::_Write()
 
     _TableOfContents toc;
 
+    // In append mode, sections we don't understand were left in place;
+    // carry their old TOC entries over to the new TOC.
+    for (auto const &s: _packCtx->preservedSections) {
+        toc.sections.push_back(s);
+    }
+
     // Write out the sections we don't know about that the packing context
     // captured.
     using std::get;
@@ -2621,7 +2972,8 @@ CrateFile::_WriteFields(_Writer &w)
                      GetCompressedBufferSize(tokenIndexVals.size())]);
 
         size_t tokenIndexesSize = Usd_IntegerCompression::CompressToBuffer(
-            tokenIndexVals.data(), tokenIndexVals.size(), compBuffer.get());
+            tokenIndexVals.data(), tokenIndexVals.size(), compBuffer.get(),
+            _packCtx->writeCodec);
         w.WriteAs<uint64_t>(tokenIndexesSize);
         w.WriteContiguous(compBuffer.get(), tokenIndexesSize);
 
@@ -2636,7 +2988,8 @@ CrateFile::_WriteFields(_Writer &w)
                      GetCompressedBufferSize(reps.size() * sizeof(reps[0]))]);
         uint64_t repsSize = TfFastCompression::CompressToBuffer(
             reinterpret_cast<char *>(reps.data()),
-            compBuffer2.get(), reps.size() * sizeof(reps[0]));
+            compBuffer2.get(), reps.size() * sizeof(reps[0]),
+            _packCtx->writeCodec);
         w.WriteAs<uint64_t>(repsSize);
         w.WriteContiguous(compBuffer2.get(), repsSize);
     }
@@ -2661,7 +3014,8 @@ CrateFile::_WriteFieldSets(_Writer &w)
         w.WriteAs<uint64_t>(fieldSetsVals.size());
 
         size_t fsetsSize = Usd_IntegerCompression::CompressToBuffer(
-            fieldSetsVals.data(), fieldSetsVals.size(), compBuffer.get());
+            fieldSetsVals.data(), fieldSetsVals.size(), compBuffer.get(),
+            _packCtx->writeCodec);
         w.WriteAs<uint64_t>(fsetsSize);
         w.WriteContiguous(compBuffer.get(), fsetsSize);
     }
@@ -2724,7 +3078,7 @@ CrateFile::_WriteSpecs(_Writer &w)
         std::transform(_specs.begin(), _specs.end(), tmp.begin(),
                        [](Spec const &s) { return s.pathIndex.value; });
         size_t pathIndexesSize = Usd_IntegerCompression::CompressToBuffer(
-            tmp.data(), tmp.size(), compBuffer.get());
+            tmp.data(), tmp.size(), compBuffer.get(), _packCtx->writeCodec);
         w.WriteAs<uint64_t>(pathIndexesSize);
         w.WriteContiguous(compBuffer.get(), pathIndexesSize);
         
@@ -2732,7 +3086,7 @@ CrateFile::_WriteSpecs(_Writer &w)
         std::transform(_specs.begin(), _specs.end(), tmp.begin(),
                        [](Spec const &s) { return s.fieldSetIndex.value; });
         size_t fsetIndexesSize = Usd_IntegerCompression::CompressToBuffer(
-            tmp.data(), tmp.size(), compBuffer.get());
+            tmp.data(), tmp.size(), compBuffer.get(), _packCtx->writeCodec);
         w.WriteAs<uint64_t>(fsetIndexesSize);
         w.WriteContiguous(compBuffer.get(), fsetIndexesSize);
         
@@ -2740,7 +3094,7 @@ CrateFile::_WriteSpecs(_Writer &w)
         std::transform(_specs.begin(), _specs.end(), tmp.begin(),
                        [](Spec const &s) { return s.specType; });
         size_t specTypesSize = Usd_IntegerCompression::CompressToBuffer(
-            tmp.data(), tmp.size(), compBuffer.get());
+            tmp.data(), tmp.size(), compBuffer.get(), _packCtx->writeCodec);
         w.WriteAs<uint64_t>(specTypesSize);
         w.WriteContiguous(compBuffer.get(), specTypesSize);
     }
@@ -2930,20 +3284,21 @@ CrateFile::_WriteCompressedPathData(_Writer &w, Container const &pathVec)
 
     // pathIndexes.
     uint64_t pathIndexesSize = Usd_IntegerCompression::CompressToBuffer(
-        pathIndexes.data(), pathIndexes.size(), compBuffer.get());
+        pathIndexes.data(), pathIndexes.size(), compBuffer.get(),
+        _packCtx->writeCodec);
     w.WriteAs<uint64_t>(pathIndexesSize);
     w.WriteContiguous(compBuffer.get(), pathIndexesSize);
 
     // elementTokenIndexes.
     uint64_t elemToksSize = Usd_IntegerCompression::CompressToBuffer(
         elementTokenIndexes.data(), elementTokenIndexes.size(),
-        compBuffer.get());
+        compBuffer.get(), _packCtx->writeCodec);
     w.WriteAs<uint64_t>(elemToksSize);
     w.WriteContiguous(compBuffer.get(), elemToksSize);
 
     // jumps.
     uint64_t jumpsSize = Usd_IntegerCompression::CompressToBuffer(
-        jumps.data(), jumps.size(), compBuffer.get());
+        jumps.data(), jumps.size(), compBuffer.get(), _packCtx->writeCodec);
     w.WriteAs<uint64_t>(jumpsSize);
     w.WriteContiguous(compBuffer.get(), jumpsSize);
 }
@@ -2975,7 +3330,8 @@ CrateFile::_WriteTokens(_Writer &w) {
         std::unique_ptr<char[]> compressed(
             new char[TfFastCompression::GetCompressedBufferSize(tokenData.size())]);
         uint64_t compressedSize = TfFastCompression::CompressToBuffer(
-            tokenData.data(), compressed.get(), tokenData.size());
+            tokenData.data(), compressed.get(), tokenData.size(),
+            _packCtx->writeCodec);
         w.WriteAs<uint64_t>(compressedSize);
         w.WriteContiguous(compressed.get(), compressedSize);
     }
@@ -2989,12 +3345,25 @@ CrateFile::_ReadStructuralSections(Reader reader, int64_t fileSize)
     _boot = _ReadBootStrap(reader.src, fileSize);
     if (m.IsClean()) _toc = _ReadTOC(reader, _boot);
     if (m.IsClean()) _PrefetchStructuralSections(reader);
-    if (m.IsClean()) _ReadTokens(reader);
-    if (m.IsClean()) _ReadStrings(reader);
-    if (m.IsClean()) _ReadFields(reader);
-    if (m.IsClean()) _ReadFieldSets(reader);
-    if (m.IsClean()) _ReadPaths(reader);
-    if (m.IsClean()) _ReadSpecs(reader);
+    if (m.IsClean()) {
+        // The structural sections decode independently of one another,
+        // with one exception: paths construction consumes the token
+        // table.  Decode them concurrently, ordering tokens before paths
+        // in the same task.  Each task gets its own copy of the reader,
+        // since Seek() mutates it; the dispatcher transports any errors
+        // raised on worker threads back to this thread at Wait().
+        WorkArenaDispatcher wd;
+        wd.Run([this, reader]() mutable {
+            TfErrorMark m;
+            _ReadTokens(reader);
+            if (m.IsClean()) _ReadPaths(reader);
+        });
+        wd.Run([this, reader]() mutable { _ReadStrings(reader); });
+        wd.Run([this, reader]() mutable { _ReadFields(reader); });
+        wd.Run([this, reader]() mutable { _ReadFieldSets(reader); });
+        wd.Run([this, reader]() mutable { _ReadSpecs(reader); });
+        wd.Wait();
+    }
 }
 
 template <class ByteStream>
@@ -3156,44 +3525,61 @@ CrateFile::_ReadSpecs(Reader reader)
             auto numSpecs = reader.template Read<uint64_t>();
             _specs.resize(numSpecs);
 
-            // Create temporary space for decompressing.
-            std::unique_ptr<char[]> compBuffer(
-                new char[Usd_IntegerCompression::
-                         GetCompressedBufferSize(numSpecs)]);
-            vector<uint32_t> tmp(_specs.size());
-            std::unique_ptr<char[]> workingSpace(
-                new char[Usd_IntegerCompression::
-                         GetDecompressionWorkingSpaceSize(numSpecs)]);
-
-            // pathIndexes.
-            auto pathIndexesSize = reader.template Read<uint64_t>();
-            reader.ReadContiguous(compBuffer.get(), pathIndexesSize);
-            Usd_IntegerCompression::DecompressFromBuffer(
-                compBuffer.get(), pathIndexesSize, tmp.data(), numSpecs,
-                workingSpace.get());
-            for (size_t i = 0; i != numSpecs; ++i) {
-                _specs[i].pathIndex.value = tmp[i];
-            }
-
-            // fieldSetIndexes.
-            auto fsetIndexesSize = reader.template Read<uint64_t>();
-            reader.ReadContiguous(compBuffer.get(), fsetIndexesSize);
-            Usd_IntegerCompression::DecompressFromBuffer(
-                compBuffer.get(), fsetIndexesSize, tmp.data(), numSpecs,
-                workingSpace.get());
-            for (size_t i = 0; i != numSpecs; ++i) {
-                _specs[i].fieldSetIndex.value = tmp[i];
-            }
-            
-            // specTypes.
-            auto specTypesSize = reader.template Read<uint64_t>();
-            reader.ReadContiguous(compBuffer.get(), specTypesSize);
-            Usd_IntegerCompression::DecompressFromBuffer(
-                compBuffer.get(), specTypesSize, tmp.data(), numSpecs,
-                workingSpace.get());
-            for (size_t i = 0; i != numSpecs; ++i) {
-                _specs[i].specType = static_cast<SdfSpecType>(tmp[i]);
-            }
+            // The three streams (pathIndexes, fieldSetIndexes, specTypes)
+            // are framed back-to-back, so read their compressed bytes
+            // serially, then decompress and scatter them in parallel;
+            // decompression dominates the cost.
+            auto readStream = [&reader](std::unique_ptr<char[]> *buf) {
+                auto size = reader.template Read<uint64_t>();
+                buf->reset(new char[size]);
+                reader.ReadContiguous(buf->get(), size);
+                return size;
+            };
+            std::unique_ptr<char[]> pathIndexesBuffer;
+            std::unique_ptr<char[]> fsetIndexesBuffer;
+            std::unique_ptr<char[]> specTypesBuffer;
+            uint64_t const pathIndexesSize = readStream(&pathIndexesBuffer);
+            uint64_t const fsetIndexesSize = readStream(&fsetIndexesBuffer);
+            uint64_t const specTypesSize = readStream(&specTypesBuffer);
+
+            auto decompressAndScatter =
+                [this, numSpecs](char const *comp, uint64_t compSize,
+                                 auto &&scatter) {
+                vector<uint32_t> tmp(numSpecs);
+                std::unique_ptr<char[]> workingSpace(
+                    new char[Usd_IntegerCompression::
+                             GetDecompressionWorkingSpaceSize(numSpecs)]);
+                Usd_IntegerCompression::DecompressFromBuffer(
+                    comp, compSize, tmp.data(), numSpecs,
+                    workingSpace.get());
+                for (size_t i = 0; i != numSpecs; ++i) {
+                    scatter(_specs[i], tmp[i]);
+                }
+            };
+
+            WorkArenaDispatcher wd;
+            wd.Run([&]() {
+                decompressAndScatter(
+                    pathIndexesBuffer.get(), pathIndexesSize,
+                    [](Spec &spec, uint32_t v) {
+                        spec.pathIndex.value = v;
+                    });
+            });
+            wd.Run([&]() {
+                decompressAndScatter(
+                    fsetIndexesBuffer.get(), fsetIndexesSize,
+                    [](Spec &spec, uint32_t v) {
+                        spec.fieldSetIndex.value = v;
+                    });
+            });
+            wd.Run([&]() {
+                decompressAndScatter(
+                    specTypesBuffer.get(), specTypesSize,
+                    [](Spec &spec, uint32_t v) {
+                        spec.specType = static_cast<SdfSpecType>(v);
+                    });
+            });
+            wd.Wait();
         }
     }
 }
@@ -3209,6 +3595,39 @@ CrateFile::_ReadStrings(Reader reader)
     }
 }
 
+namespace {
+
+// Process-wide pool of parsed crate token tables, keyed by a hash of the
+// raw (possibly compressed) tokens-section data.  Crate files written by
+// the same pipeline tend to repeat largely identical property-name
+// vocabularies, so when many such files are open at once, sharing the
+// parsed tables means the decompress-and-tokenize cost is paid once per
+// unique table instead of once per file.  Pooled tables are immutable
+// and retained for the life of the process.
+struct _SharedTokenTablePool
+{
+    std::shared_ptr<const vector<TfToken>> Find(uint64_t key) const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto const iter = _tables.find(key);
+        return iter == _tables.end() ? nullptr : iter->second;
+    }
+
+    void Insert(uint64_t key,
+                std::shared_ptr<const vector<TfToken>> table) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tables.emplace(key, std::move(table));
+    }
+
+private:
+    mutable std::mutex _mutex;
+    std::unordered_map<
+        uint64_t, std::shared_ptr<const vector<TfToken>>> _tables;
+};
+
+TfStaticData<_SharedTokenTablePool> _sharedTokenTables;
+
+} // anon
+
 template <class Reader>
 void
 CrateFile::_ReadTokens(Reader reader)
@@ -3224,25 +3643,54 @@ CrateFile::_ReadTokens(Reader reader)
     // Read number of tokens.
     auto numTokens = reader.template Read<uint64_t>();
 
+    const bool useSharedTables =
+        TfGetEnvSetting(USDC_ENABLE_SHARED_TOKEN_TABLES);
+
     RawDataPtr chars;
-    
+    RawDataPtr compressed;
+    uint64_t charsNumBytes = 0;
+    uint64_t compressedSize = 0;
+    uint64_t uncompressedSize = 0;
+
     Version fileVer(_boot);
     if (fileVer < Version(0,4,0)) {
         // XXX: To support pread(), we need to read the whole thing into memory
         // to make tokens out of it.  This is a pessimization vs mmap, from
         // which we can just construct from the chars directly.
-        auto tokensNumBytes = reader.template Read<uint64_t>();
-        chars.reset(new char[tokensNumBytes]);
-        reader.ReadContiguous(chars.get(), tokensNumBytes);
+        charsNumBytes = reader.template Read<uint64_t>();
+        chars.reset(new char[charsNumBytes]);
+        reader.ReadContiguous(chars.get(), charsNumBytes);
     } else {
         // Compressed token data.
-        uint64_t uncompressedSize = reader.template Read<uint64_t>();
-        uint64_t compressedSize = reader.template Read<uint64_t>();
-        chars.reset(new char[uncompressedSize]);
-        RawDataPtr compressed(new char[compressedSize]);
+        uncompressedSize = reader.template Read<uint64_t>();
+        compressedSize = reader.template Read<uint64_t>();
+        compressed.reset(new char[compressedSize]);
         reader.ReadContiguous(compressed.get(), compressedSize);
+    }
+
+    // Check the shared table pool before decompressing or tokenizing;
+    // hashing the raw section data (compressed, when available) lets a
+    // pool hit skip both steps.  The token count is folded into the key
+    // as a cheap guard against hashing differently framed sections alike.
+    uint64_t poolKey = 0;
+    if (useSharedTables) {
+        poolKey = compressed
+            ? ArchHash64(compressed.get(), compressedSize, numTokens)
+            : ArchHash64(chars.get(), charsNumBytes, numTokens);
+        if (auto const table = _sharedTokenTables->Find(poolKey)) {
+            if (TF_VERIFY(table->size() == numTokens)) {
+                _tokens = *table;
+                WorkSwapDestroyAsync(compressed ? compressed : chars);
+                return;
+            }
+        }
+    }
+
+    if (compressed) {
+        chars.reset(new char[uncompressedSize]);
         TfFastCompression::DecompressFromBuffer(
             compressed.get(), chars.get(), compressedSize, uncompressedSize);
+        WorkSwapDestroyAsync(compressed);
     }
 
     // Now we read that many null-terminated strings into _tokens.
@@ -3264,6 +3712,11 @@ CrateFile::_ReadTokens(Reader reader)
     }
     wd.Wait();
 
+    if (useSharedTables) {
+        _sharedTokenTables->Insert(
+            poolKey, std::make_shared<const vector<TfToken>>(_tokens));
+    }
+
     WorkSwapDestroyAsync(chars);
 }
 
@@ -31,6 +31,7 @@
 #include "crateValueInliners.h"
 
 #include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/tf/fastCompression.h"
 #include "pxr/base/tf/token.h"
 #include "pxr/base/vt/array.h"
 #include "pxr/base/vt/value.h"
@@ -392,7 +393,25 @@ private:
             , _start(_mapping.get() + offset)
             , _length(length == -1 ?
                       ArchGetFileMappingLength(_mapping) : length) {}
-        
+
+        // As above, but hold a shared read-only mapping.  Pages of a shared
+        // read-only mapping are backed directly by the filesystem page
+        // cache, so every process on the host that maps the same file
+        // references a single physical copy.  Zero-copy arrays cannot be
+        // served from such a mapping, since detaching them from the file
+        // requires writing to the pages.
+        explicit _FileMapping(ArchConstFileMapping mapping, int64_t offset=0,
+                              int64_t length=-1)
+            : _refCount(0)
+            , _roMapping(std::move(mapping))
+            , _start(const_cast<char *>(_roMapping.get()) + offset)
+            , _length(length == -1 ?
+                      ArchGetFileMappingLength(_roMapping) : length) {}
+
+        // Return true if zero-copy array sources may reference this mapping
+        // (i.e. the mapping is private copy-on-write, not shared read-only).
+        bool SupportsZeroCopy() const { return static_cast<bool>(_mapping); }
+
         // Add an an externally referenced page range.
         ZeroCopySource *
         AddRangeReference(void *addr, size_t numBytes);
@@ -430,6 +449,7 @@ private:
 
         mutable std::atomic<size_t> _refCount { 0 };
         ArchMutableFileMapping _mapping;
+        ArchConstFileMapping _roMapping;
         char *_start;
         int64_t _length;
         tbb::concurrent_unordered_set<ZeroCopySource> _outstandingRanges;
@@ -568,6 +588,10 @@ public:
     static TfToken const &GetSoftwareVersionToken();
     TfToken GetFileVersionToken() const;
 
+    // Return the compression codec used for compressed sections while packing.
+    // Only meaningful between StartPacking() and the packer's completion.
+    TfFastCompression::Codec GetWriteCodec() const;
+
     static std::unique_ptr<CrateFile> CreateNew();
 
     // Return nullptr on failure.
@@ -686,6 +710,16 @@ public:
         return ret;
     }
 
+    /// Hint to the operating system that the value data for specs at or
+    /// under \p paths will be needed soon, so that it may begin reading
+    /// ahead.  For time-sampled fields, only samples with times in
+    /// [\p startTime, \p endTime] are considered.  This is purely advisory:
+    /// value sizes are not recorded in the file, so the hinted ranges are
+    /// estimated from neighboring value offsets, and nothing is done for
+    /// assets that are not memory-mapped or file-backed.
+    void PrefetchValueRanges(vector<SdfPath> const &paths,
+                             double startTime, double endTime) const;
+
     std::type_info const &GetTypeid(ValueRep rep) const;
 
 private:
@@ -783,6 +817,15 @@ private:
 
     void _ReadRawBytes(int64_t start, int64_t size, char *buf) const;
 
+    // Append to \p offsets the payload offsets of the samples of the
+    // TimeSamples value at \p rep with times in [startTime, endTime].
+    void _CollectTimeSampleOffsets(ValueRep rep,
+                                   double startTime, double endTime,
+                                   vector<int64_t> *offsets) const;
+
+    // Advise the OS that the given file range will be needed soon.
+    void _PrefetchRange(int64_t start, int64_t size) const;
+
     PathIndex _AddPath(const SdfPath &path);
     FieldSetIndex _AddFieldSet(const std::vector<FieldIndex> &fieldIndexes);
     FieldIndex _AddField(const FieldValuePair &fv);
@@ -35,6 +35,8 @@ TF_REGISTRY_FUNCTION(TfDebug)
     TF_DEBUG_ENVIRONMENT_SYMBOL(USD_CHANGES, "Usd change processing");
     TF_DEBUG_ENVIRONMENT_SYMBOL(USD_CLIPS, "Usd clip details");
     TF_DEBUG_ENVIRONMENT_SYMBOL(USD_COMPOSITION, "Usd composition details");
+    TF_DEBUG_ENVIRONMENT_SYMBOL(USD_CRATE_COPY, "Usd crate data copy progress "
+                                "during format conversion");
     TF_DEBUG_ENVIRONMENT_SYMBOL(USD_DATA_BD, "Usd BD file format traces");
     TF_DEBUG_ENVIRONMENT_SYMBOL(USD_DATA_BD_TRY, "Usd BD call traces. Prints names, errors and results.");
     TF_DEBUG_ENVIRONMENT_SYMBOL(USD_INSTANCING, "Usd instancing diagnostics");
@@ -35,6 +35,7 @@ TF_DEBUG_CODES(
     USD_CHANGES,
     USD_CLIPS,
     USD_COMPOSITION,
+    USD_CRATE_COPY,
     USD_DATA_BD,
     USD_DATA_BD_TRY,
     USD_INSTANCING,
@@ -29,6 +29,7 @@
 
 #include "pxr/base/tf/envSetting.h"
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
 
 #include <utility>
 
@@ -59,8 +60,8 @@ Usd_InstanceCache::RegisterInstancePrimIndex(const PcpPrimIndex& index)
         return false;
     }
 
-    // Make sure we compute the key for this index before we grab
-    // the mutex to minimize the time we hold the lock.
+    // Compute the key for this index before touching the pending table
+    // so that we hold its bucket lock as briefly as possible.
     const Usd_InstanceKey key(index);
 
     // Check whether a master for this prim index already exists
@@ -72,16 +73,17 @@ Usd_InstanceCache::RegisterInstancePrimIndex(const PcpPrimIndex& index)
         (keyToMasterIt != _instanceKeyToMasterMap.end());
 
     {
-        tbb::spin_mutex::scoped_lock lock(_mutex);
-
-        _PrimIndexPaths& pendingIndexes = _pendingAddedPrimIndexes[key];
-        pendingIndexes.push_back(index.GetPath());
+        // The pending table is a concurrent hash map, so concurrent
+        // registrations only contend when they share an instance key.
+        _PendingAddedPrimIndexesMap::accessor accessor;
+        _pendingAddedPrimIndexes.insert(accessor, key);
+        accessor->second.push_back(index.GetPath());
 
         // A new master must be created for this instance if one doesn't
         // already exist and this instance is the first one registered for
         // this key.
-        const bool needsNewMaster = 
-            (!masterAlreadyExists && pendingIndexes.size() == 1);
+        const bool needsNewMaster =
+            (!masterAlreadyExists && accessor->second.size() == 1);
         if (needsNewMaster) {
             return true;
         }
@@ -129,6 +131,30 @@ Usd_InstanceCache::ProcessChanges(Usd_InstanceChanges* changes)
     TRACE_FUNCTION();
     TfAutoMallocTag tag("InstanceCache::ProcessChanges");
 
+    // Sort each pending list of newly-registered prim indexes up front,
+    // in parallel across instance keys;  the bookkeeping below relies on
+    // sorted order.  Record each list's first-registered index before
+    // sorting:  that index must be selected as a new master's source
+    // index, because the consumer was told it required a new master via
+    // RegisterInstancePrimIndex.
+    std::vector<_PendingAddedPrimIndexesMap::value_type*> pendingAdded;
+    pendingAdded.reserve(_pendingAddedPrimIndexes.size());
+    for (_PendingAddedPrimIndexesMap::value_type& v:
+             _pendingAddedPrimIndexes) {
+        pendingAdded.push_back(&v);
+    }
+    std::vector<SdfPath> firstRegisteredPaths(pendingAdded.size());
+    WorkParallelForN(
+        pendingAdded.size(),
+        [&pendingAdded, &firstRegisteredPaths](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                _PrimIndexPaths& primIndexes = pendingAdded[i]->second;
+                if (!primIndexes.empty()) {
+                    firstRegisteredPaths[i] = primIndexes.front();
+                    std::sort(primIndexes.begin(), primIndexes.end());
+                }
+            }
+        });
 
     // Remove unregistered prim indexes from the cache.
     std::unordered_map<SdfPath, SdfPath, SdfPath::Hash>
@@ -140,14 +166,13 @@ Usd_InstanceCache::ProcessChanges(Usd_InstanceChanges* changes)
 
         // Ignore any unregistered prim index that was subsequently
         // re-registered.
-        _InstanceKeyToPrimIndexesMap::const_iterator registeredIt = 
-            _pendingAddedPrimIndexes.find(key);
-        if (registeredIt != _pendingAddedPrimIndexes.end()) {
-            _PrimIndexPaths registered = registeredIt->second;
+        _PendingAddedPrimIndexesMap::const_accessor registeredAccessor;
+        if (_pendingAddedPrimIndexes.find(registeredAccessor, key)) {
+            // The registered indexes were already sorted above.
+            const _PrimIndexPaths& registered = registeredAccessor->second;
             _PrimIndexPaths unregistered;
             unregistered.swap(primIndexes);
 
-            std::sort(registered.begin(), registered.end());
             std::sort(unregistered.begin(), unregistered.end());
             std::set_difference(unregistered.begin(), unregistered.end(),
                                 registered.begin(), registered.end(),
@@ -164,30 +189,28 @@ Usd_InstanceCache::ProcessChanges(Usd_InstanceChanges* changes)
         // determines the name of the master prims assigned to instances.
         // We need to iterate over the hash map in a fixed ordering to
         // ensure we have a consistent assignment of instances to masters.
-        typedef std::map<SdfPath, Usd_InstanceKey> _PrimIndexPathToKey;
-        std::map<SdfPath, Usd_InstanceKey> keysToProcess;
-        for (_InstanceKeyToPrimIndexesMap::value_type& v:
-                 _pendingAddedPrimIndexes) {
-            const Usd_InstanceKey& key = v.first;
-            const _PrimIndexPaths& primIndexes = v.second;
-            if (TF_VERIFY(!primIndexes.empty())) {
+        typedef std::map<SdfPath, size_t> _PrimIndexPathToEntry;
+        _PrimIndexPathToEntry entriesToProcess;
+        for (size_t i = 0; i != pendingAdded.size(); ++i) {
+            if (TF_VERIFY(!pendingAdded[i]->second.empty())) {
                 TF_VERIFY(
-                    keysToProcess.emplace(primIndexes.front(), key).second);
+                    entriesToProcess.emplace(
+                        firstRegisteredPaths[i], i).second);
             }
         }
 
-        for (const _PrimIndexPathToKey::value_type& v: keysToProcess) {
-            const Usd_InstanceKey& key = v.second;
-            _PrimIndexPaths& primIndexes = _pendingAddedPrimIndexes[key];
-            _CreateOrUpdateMasterForInstances(key, &primIndexes, changes,
-                                              masterToOldSourceIndexPath);
+        for (const _PrimIndexPathToEntry::value_type& v: entriesToProcess) {
+            const size_t i = v.second;
+            _CreateOrUpdateMasterForInstances(
+                pendingAdded[i]->first, &pendingAdded[i]->second,
+                firstRegisteredPaths[i], changes, masterToOldSourceIndexPath);
         }
     }
     else {
-        for(_InstanceKeyToPrimIndexesMap::value_type& v:
-                _pendingAddedPrimIndexes) {
-            _CreateOrUpdateMasterForInstances(v.first, &v.second, changes,
-                                              masterToOldSourceIndexPath);
+        for (size_t i = 0; i != pendingAdded.size(); ++i) {
+            _CreateOrUpdateMasterForInstances(
+                pendingAdded[i]->first, &pendingAdded[i]->second,
+                firstRegisteredPaths[i], changes, masterToOldSourceIndexPath);
         }
     }
 
@@ -205,6 +228,7 @@ void
 Usd_InstanceCache::_CreateOrUpdateMasterForInstances(
     const Usd_InstanceKey& key,
     _PrimIndexPaths* primIndexPaths,
+    const SdfPath& sourcePrimIndexPath,
     Usd_InstanceChanges* changes,
     std::unordered_map<SdfPath, SdfPath, SdfPath::Hash> const &
     masterToOldSourceIndexPath)
@@ -227,7 +251,6 @@ Usd_InstanceCache::_CreateOrUpdateMasterForInstances(
         result.first->second = newMasterPath;
         _masterToInstanceKeyMap[newMasterPath] = key;
 
-        const SdfPath sourcePrimIndexPath = primIndexPaths->front();
         _sourcePrimIndexToMasterMap[sourcePrimIndexPath] = newMasterPath;
         _masterToSourcePrimIndexMap[newMasterPath] = sourcePrimIndexPath;
 
@@ -247,10 +270,9 @@ Usd_InstanceCache::_CreateOrUpdateMasterForInstances(
         // the last instance of a master has been removed and a new 
         // instance of the master has been added in the same round of changes.
         const SdfPath& masterPath = result.first->second;
-        const bool assignNewPrimIndexForMaster = 
+        const bool assignNewPrimIndexForMaster =
             (_masterToSourcePrimIndexMap.count(masterPath) == 0);
         if (assignNewPrimIndexForMaster) {
-            const SdfPath sourcePrimIndexPath = primIndexPaths->front();
             _sourcePrimIndexToMasterMap[sourcePrimIndexPath] = masterPath;
             _masterToSourcePrimIndexMap[masterPath] = sourcePrimIndexPath;
 
@@ -287,9 +309,8 @@ Usd_InstanceCache::_CreateOrUpdateMasterForInstances(
         changes->associatedIndexNew.end(),
         primIndexPaths->size(), _masterToSourcePrimIndexMap[masterPath]);
 
+    // primIndexPaths was already sorted in parallel by ProcessChanges.
     _PrimIndexPaths& primIndexesForMaster = _masterToPrimIndexesMap[masterPath];
-    std::sort(primIndexPaths->begin(), primIndexPaths->end());
-
     if (primIndexesForMaster.empty()) {
         primIndexesForMaster.swap(*primIndexPaths);
     }
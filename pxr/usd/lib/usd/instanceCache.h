@@ -30,7 +30,7 @@
 #include "pxr/usd/sdf/path.h"
 #include "pxr/base/tf/hashmap.h"
 
-#include <tbb/mutex.h>
+#include <tbb/concurrent_hash_map.h>
 #include <map>
 #include <unordered_map>
 #include <vector>
@@ -234,6 +234,7 @@ private:
     void _CreateOrUpdateMasterForInstances(
         const Usd_InstanceKey& instanceKey,
         _PrimIndexPaths* primIndexPaths,
+        const SdfPath& sourcePrimIndexPath,
         Usd_InstanceChanges* changes,
         std::unordered_map<SdfPath, SdfPath, SdfPath::Hash> const &
         masterToOldSourceIndexPath);
@@ -254,10 +255,8 @@ private:
         std::vector<SdfPath>* masterPaths = NULL) const;
 
     SdfPath _GetNextMasterPath(const Usd_InstanceKey& key);
-    
-private:
-    tbb::spin_mutex _mutex;
 
+private:
     // Mapping from instance key <-> master prim path.
     // This stores the path of the master prim that should be used
     // for all instanceable prim indexes with the given instance key.
@@ -285,12 +284,29 @@ private:
     _PrimIndexToMasterMap _primIndexToMasterMap;
 
     // Map from instance key -> list of prim index paths
-    // These maps contain lists of pending changes and are the only containers 
+    // These maps contain lists of pending changes and are the only containers
     // that should be modified during registration and unregistration.
+    //
+    // The added map is a concurrent hash map because registration runs
+    // concurrently during composition;  aggregation is sharded by hash
+    // bucket so threads registering instances with different keys do
+    // not contend on a single lock.
+    struct _InstanceKeyHashCompare {
+        static size_t hash(const Usd_InstanceKey& key) {
+            return hash_value(key);
+        }
+        static bool equal(const Usd_InstanceKey& lhs,
+                          const Usd_InstanceKey& rhs) {
+            return lhs == rhs;
+        }
+    };
+    typedef tbb::concurrent_hash_map<
+        Usd_InstanceKey, _PrimIndexPaths, _InstanceKeyHashCompare>
+        _PendingAddedPrimIndexesMap;
     typedef TfHashMap<
-        Usd_InstanceKey, _PrimIndexPaths, boost::hash<Usd_InstanceKey> > 
+        Usd_InstanceKey, _PrimIndexPaths, boost::hash<Usd_InstanceKey> >
         _InstanceKeyToPrimIndexesMap;
-    _InstanceKeyToPrimIndexesMap _pendingAddedPrimIndexes;
+    _PendingAddedPrimIndexesMap _pendingAddedPrimIndexes;
     _InstanceKeyToPrimIndexesMap _pendingRemovedPrimIndexes;
 
     // Index of last master prim created. Used to create
@@ -22,6 +22,7 @@
 // language governing permissions and limitations under the Apache License.
 //
 #include "pxr/pxr.h"
+#include "pxr/base/arch/defines.h"
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/fastCompression.h"
 #include "pxr/usd/usd/integerCoding.h"
@@ -32,6 +33,10 @@
 #include <memory>
 #include <unordered_map>
 
+#if defined(ARCH_CPU_INTEL) && defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 /*
@@ -281,6 +286,82 @@ void _DecodeNHelper(
     }
 }
 
+#if defined(ARCH_CPU_INTEL) && defined(__SSSE3__)
+
+// Stream-vbyte style vectorized decode for the 32-bit codec.  Each code
+// byte describes four values, so a 256-entry table indexed by the code
+// byte supplies everything needed to turn the variable-width bytes into
+// four 32-bit lanes with a single shuffle: the pshufb mask, a sign-bit
+// constant for sign-extending the 8- and 16-bit cases (pshufb can only
+// zero-fill), a mask selecting the lanes that take the common value, and
+// the number of variable bytes consumed.
+struct _DecodeEntry
+{
+    alignas(16) uint8_t shuffle[16];
+    alignas(16) uint8_t signBit[16];
+    alignas(16) uint8_t commonMask[16];
+    uint8_t consumed;
+};
+
+struct _DecodeTable
+{
+    _DecodeTable() {
+        for (int code = 0; code != 256; ++code) {
+            _DecodeEntry &e = entries[code];
+            int offset = 0;
+            for (int lane = 0; lane != 4; ++lane) {
+                int c = (code >> (2 * lane)) & 3;
+                int width = (c == 0) ? 0 : (c == 3) ? 4 : c;
+                for (int b = 0; b != 4; ++b) {
+                    e.shuffle[lane*4 + b] = (b < width)
+                        ? static_cast<uint8_t>(offset + b) : 0x80;
+                    e.signBit[lane*4 + b] = (width && b == width - 1 &&
+                                             width != 4) ? 0x80 : 0;
+                    e.commonMask[lane*4 + b] = (c == 0) ? 0xff : 0;
+                }
+                offset += width;
+            }
+            e.consumed = static_cast<uint8_t>(offset);
+        }
+    }
+    _DecodeEntry entries[256];
+};
+
+static _DecodeTable const _decodeTable;
+
+// Decode the four values described by \p codeByte into \p output.  The
+// 16-byte load from \p vintsIn requires at least 16 readable bytes, which
+// the working-space buffer guarantees whenever four or more integers
+// remain (it is sized for the maximal encoding of the full sequence).
+inline void
+_DecodeQuad(uint8_t codeByte, char const *&vintsIn,
+            int32_t commonValue, int32_t &prevVal, int32_t *output)
+{
+    _DecodeEntry const &e = _decodeTable.entries[codeByte];
+    __m128i raw = _mm_loadu_si128(
+        reinterpret_cast<__m128i const *>(vintsIn));
+    __m128i sign = _mm_load_si128(
+        reinterpret_cast<__m128i const *>(e.signBit));
+    __m128i v = _mm_shuffle_epi8(raw, _mm_load_si128(
+        reinterpret_cast<__m128i const *>(e.shuffle)));
+    // Sign-extend the narrow lanes: (v ^ signBit) - signBit.
+    v = _mm_sub_epi32(_mm_xor_si128(v, sign), sign);
+    // Fill the common-value lanes.
+    v = _mm_add_epi32(v, _mm_and_si128(
+        _mm_load_si128(reinterpret_cast<__m128i const *>(e.commonMask)),
+        _mm_set1_epi32(commonValue)));
+    // Inclusive prefix sum across the four delta lanes, then rebase on
+    // the running value.
+    v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+    v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+    v = _mm_add_epi32(v, _mm_set1_epi32(prevVal));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output), v);
+    prevVal = _mm_cvtsi128_si32(_mm_shuffle_epi32(v, _MM_SHUFFLE(3,3,3,3)));
+    vintsIn += e.consumed;
+}
+
+#endif // ARCH_CPU_INTEL && __SSSE3__
+
 template <class Int>
 size_t
 _EncodeIntegers(Int const *begin, size_t numInts, char *output)
@@ -351,6 +432,25 @@ size_t _DecodeIntegers(char const *data, size_t numInts, Int *result)
 
     SInt prevVal = 0;
     auto intsLeft = numInts;
+
+#if defined(ARCH_CPU_INTEL) && defined(__SSSE3__)
+    // Use the shuffle-table decoder for full groups of four when the
+    // value type is 32 bits wide; the 64-bit codec stays on the scalar
+    // path.  (The branch is resolved at compile time.)
+    if (sizeof(Int) == 4) {
+        int32_t prev = static_cast<int32_t>(prevVal);
+        int32_t *out = reinterpret_cast<int32_t *>(result);
+        while (intsLeft >= 4) {
+            _DecodeQuad(static_cast<uint8_t>(*codesIn++), vintsIn,
+                        static_cast<int32_t>(commonValue), prev, out);
+            out += 4;
+            intsLeft -= 4;
+        }
+        result = reinterpret_cast<Int *>(out);
+        prevVal = static_cast<SInt>(prev);
+    }
+#endif
+
     while (intsLeft >= 4) {
         _DecodeNHelper<4>(codesIn, vintsIn, commonValue, prevVal, result);
         intsLeft -= 4;
@@ -370,7 +470,8 @@ size_t _DecodeIntegers(char const *data, size_t numInts, Int *result)
 
 template <class Int>
 size_t
-_CompressIntegers(Int const *begin, size_t numInts, char *output)
+_CompressIntegers(Int const *begin, size_t numInts, char *output,
+                  TfFastCompression::Codec codec)
 {
     // Working space.
     std::unique_ptr<char[]>
@@ -381,7 +482,7 @@ _CompressIntegers(Int const *begin, size_t numInts, char *output)
 
     // Then compress.
     return TfFastCompression::CompressToBuffer(
-        encodeBuffer.get(), output, encodedSize);
+        encodeBuffer.get(), output, encodedSize, codec);
 }
 
 template <class Int>
@@ -427,16 +528,18 @@ Usd_IntegerCompression::GetDecompressionWorkingSpaceSize(size_t numInts)
 
 size_t
 Usd_IntegerCompression::CompressToBuffer(
-    int32_t const *ints, size_t numInts, char *compressed)
+    int32_t const *ints, size_t numInts, char *compressed,
+    TfFastCompression::Codec codec)
 {
-    return _CompressIntegers(ints, numInts, compressed);
+    return _CompressIntegers(ints, numInts, compressed, codec);
 }
 
 size_t
 Usd_IntegerCompression::CompressToBuffer(
-    uint32_t const *ints, size_t numInts, char *compressed)
+    uint32_t const *ints, size_t numInts, char *compressed,
+    TfFastCompression::Codec codec)
 {
-    return _CompressIntegers(ints, numInts, compressed);
+    return _CompressIntegers(ints, numInts, compressed, codec);
 }
 
 size_t
@@ -475,16 +578,18 @@ Usd_IntegerCompression64::GetDecompressionWorkingSpaceSize(size_t numInts)
 
 size_t
 Usd_IntegerCompression64::CompressToBuffer(
-    int64_t const *ints, size_t numInts, char *compressed)
+    int64_t const *ints, size_t numInts, char *compressed,
+    TfFastCompression::Codec codec)
 {
-    return _CompressIntegers(ints, numInts, compressed);
+    return _CompressIntegers(ints, numInts, compressed, codec);
 }
 
 size_t
 Usd_IntegerCompression64::CompressToBuffer(
-    uint64_t const *ints, size_t numInts, char *compressed)
+    uint64_t const *ints, size_t numInts, char *compressed,
+    TfFastCompression::Codec codec)
 {
-    return _CompressIntegers(ints, numInts, compressed);
+    return _CompressIntegers(ints, numInts, compressed, codec);
 }
 
 size_t
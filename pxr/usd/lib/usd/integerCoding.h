@@ -26,6 +26,7 @@
 
 #include "pxr/pxr.h"
 #include "pxr/usd/usd/api.h"
+#include "pxr/base/tf/fastCompression.h"
 
 #include <cstdint>
 #include <memory>
@@ -51,7 +52,8 @@ public:
     // of bytes written to \p compressed.
     USD_API
     static size_t CompressToBuffer(
-        int32_t const *ints, size_t numInts, char *compressed);
+        int32_t const *ints, size_t numInts, char *compressed,
+        TfFastCompression::Codec codec = TfFastCompression::CodecLZ4);
 
     // Compress \p numInts ints from \p ints to \p compressed.  The
     // \p compressed space must point to at least
@@ -59,7 +61,8 @@ public:
     // of bytes written to \p compressed.
     USD_API
     static size_t CompressToBuffer(
-        uint32_t const *ints, size_t numInts, char *compressed);
+        uint32_t const *ints, size_t numInts, char *compressed,
+        TfFastCompression::Codec codec = TfFastCompression::CodecLZ4);
 
     // Decompress \p compressedSize bytes from \p compressed to produce
     // \p numInts 32-bit integers into \p ints.  Clients may supply
@@ -103,7 +106,8 @@ public:
     // of bytes written to \p compressed.
     USD_API
     static size_t CompressToBuffer(
-        int64_t const *ints, size_t numInts, char *compressed);
+        int64_t const *ints, size_t numInts, char *compressed,
+        TfFastCompression::Codec codec = TfFastCompression::CodecLZ4);
 
     // Compress \p numInts ints from \p ints to \p compressed.  The
     // \p compressed space must point to at least
@@ -111,7 +115,8 @@ public:
     // of bytes written to \p compressed.
     USD_API
     static size_t CompressToBuffer(
-        uint64_t const *ints, size_t numInts, char *compressed);
+        uint64_t const *ints, size_t numInts, char *compressed,
+        TfFastCompression::Codec codec = TfFastCompression::CodecLZ4);
 
     // Decompress \p compressedSize bytes from \p compressed to produce
     // \p numInts 64-bit integers into \p ints.  Clients may supply
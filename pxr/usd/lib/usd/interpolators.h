@@ -30,6 +30,14 @@
 #include "pxr/usd/usd/valueUtils.h"
 #include "pxr/usd/sdf/layer.h"
 #include "pxr/base/gf/math.h"
+#include "pxr/base/gf/vec2d.h"
+#include "pxr/base/gf/vec2f.h"
+#include "pxr/base/gf/vec3d.h"
+#include "pxr/base/gf/vec3f.h"
+#include "pxr/base/gf/vec4d.h"
+#include "pxr/base/gf/vec4f.h"
+
+#include <type_traits>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -176,6 +184,120 @@ Usd_Lerp(double alpha, const GfQuatd &lower, const GfQuatd &upper)
     return GfSlerp(alpha, lower, upper);
 }
 
+// Traits identifying value types whose linear interpolation is equivalent to
+// independently interpolating a contiguous span of floating point scalars.
+// For these types the array interpolation loop can run over the flattened
+// scalar data, which compilers are able to auto-vectorize, instead of
+// invoking Usd_Lerp element by element.
+template <class T>
+struct Usd_LinearInterpolationSpanTraits
+{
+    static const size_t dimension = 0;
+};
+
+template <>
+struct Usd_LinearInterpolationSpanTraits<float>
+{
+    typedef float ScalarType;
+    static const size_t dimension = 1;
+};
+
+template <>
+struct Usd_LinearInterpolationSpanTraits<double>
+{
+    typedef double ScalarType;
+    static const size_t dimension = 1;
+};
+
+template <>
+struct Usd_LinearInterpolationSpanTraits<GfVec2f>
+{
+    typedef float ScalarType;
+    static const size_t dimension = 2;
+};
+
+template <>
+struct Usd_LinearInterpolationSpanTraits<GfVec3f>
+{
+    typedef float ScalarType;
+    static const size_t dimension = 3;
+};
+
+template <>
+struct Usd_LinearInterpolationSpanTraits<GfVec4f>
+{
+    typedef float ScalarType;
+    static const size_t dimension = 4;
+};
+
+template <>
+struct Usd_LinearInterpolationSpanTraits<GfVec2d>
+{
+    typedef double ScalarType;
+    static const size_t dimension = 2;
+};
+
+template <>
+struct Usd_LinearInterpolationSpanTraits<GfVec3d>
+{
+    typedef double ScalarType;
+    static const size_t dimension = 3;
+};
+
+template <>
+struct Usd_LinearInterpolationSpanTraits<GfVec4d>
+{
+    typedef double ScalarType;
+    static const size_t dimension = 4;
+};
+
+// Interpolate a contiguous span of scalars in place:
+// result[i] = lerp(alpha, result[i], upper[i]).  The blend is carried out
+// in double precision, matching GfLerp's arithmetic, in a flat loop the
+// compiler can vectorize with whatever SIMD width the target provides.
+template <class Scalar>
+inline void
+Usd_LerpSpan(double alpha, const Scalar *upper, Scalar *result,
+             size_t numScalars)
+{
+    const double beta = 1.0 - alpha;
+    for (size_t i = 0; i != numScalars; ++i) {
+        result[i] = static_cast<Scalar>(beta * result[i] + alpha * upper[i]);
+    }
+}
+
+// Interpolate array elements in place: *result becomes
+// lerp(alpha, *result, upper).  Array sizes must match.  Element types
+// that are flat spans of scalars go through the vectorizable kernel
+// above; everything else (e.g. quaternions, GfHalf) interpolates element
+// by element with Usd_Lerp.
+template <class T>
+inline typename std::enable_if<
+    Usd_LinearInterpolationSpanTraits<T>::dimension != 0>::type
+Usd_LerpArrayInPlace(double alpha, const VtArray<T> &upper, VtArray<T> *result)
+{
+    typedef Usd_LinearInterpolationSpanTraits<T> Traits;
+    typedef typename Traits::ScalarType Scalar;
+    static_assert(sizeof(T) == Traits::dimension * sizeof(Scalar),
+                  "Span-interpolable types must be contiguous scalars");
+    Usd_LerpSpan(alpha,
+                 reinterpret_cast<const Scalar *>(upper.cdata()),
+                 reinterpret_cast<Scalar *>(result->data()),
+                 result->size() * Traits::dimension);
+}
+
+template <class T>
+inline typename std::enable_if<
+    Usd_LinearInterpolationSpanTraits<T>::dimension == 0>::type
+Usd_LerpArrayInPlace(double alpha, const VtArray<T> &upper, VtArray<T> *result)
+{
+    T *rptr = result->data();
+    const T *uptr = upper.cdata();
+    for (size_t i = 0, j = result->size(); i != j; ++i) {
+        rptr[i] = Usd_Lerp(alpha, rptr[i], uptr[i]);
+    }
+}
+
 /// \class Usd_LinearInterpolator
 ///
 /// Object implementing linear interpolation for attribute values.
@@ -313,10 +435,7 @@ private:
         }
         else {
             // must actually calculate interpolated values.
-            T *rptr = _result->data();
-            for (size_t i = 0, j = _result->size(); i != j; ++i) {
-                rptr[i] = Usd_Lerp(parametricTime, rptr[i], upperValue[i]);
-            }
+            Usd_LerpArrayInPlace(parametricTime, upperValue, _result);
         }
 
         return true;
@@ -1183,6 +1183,7 @@ private:
     friend class Usd_PrimFlagsPredicate;
     friend struct UsdPrim_RelTargetFinder;
     friend struct UsdPrim_AttrConnectionFinder;
+    friend struct Usd_PrimRangeParallelTask;
 
     // Prim constructor.
     UsdPrim(const Usd_PrimDataHandle &primData,
@@ -282,6 +282,15 @@ private:
         _firstChild = child;
     };
 
+    // Usd_PrimData instances are carved from slabs shared by all stages
+    // so that prims allocated in composition order land near each other
+    // in memory, and so that 10M-prim stages don't pay the general heap
+    // allocator per prim.  Freed slots are recycled.  See primData.cpp.
+    USD_API
+    static void *operator new(size_t size);
+    USD_API
+    static void operator delete(void *ptr);
+
     // Set the dead bit on this prim data object.
     void _MarkDead() {
         _flags[Usd_PrimDeadFlag] = true;
@@ -28,9 +28,73 @@
 #include "pxr/usd/usd/stage.h"
 
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/work/dispatcher.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+// Task that visits one prim for UsdPrimRange::ParallelTraverse, then spawns
+// a task for each of the prim's children that passes the predicate.  The
+// dispatcher, predicate and callback live on the frame of the traversal
+// entry point, which does not return until all tasks have completed.
+struct Usd_PrimRangeParallelTask
+{
+    Usd_PrimRangeParallelTask(
+        WorkDispatcher *dispatcher,
+        const Usd_PrimFlagsPredicate *predicate,
+        const std::function<bool (const UsdPrim &)> *callback,
+        Usd_PrimDataConstPtr prim,
+        const SdfPath &proxyPrimPath)
+        : dispatcher(dispatcher)
+        , predicate(predicate)
+        , callback(callback)
+        , prim(prim)
+        , proxyPrimPath(proxyPrimPath)
+    {
+    }
+
+    void operator()() const
+    {
+        if (!(*callback)(UsdPrim(prim, proxyPrimPath))) {
+            // The callback pruned this prim's children.
+            return;
+        }
+        SpawnChildTasks(dispatcher, predicate, callback, prim, proxyPrimPath);
+    }
+
+    static void SpawnChildTasks(
+        WorkDispatcher *dispatcher,
+        const Usd_PrimFlagsPredicate *predicate,
+        const std::function<bool (const UsdPrim &)> *callback,
+        Usd_PrimDataConstPtr prim,
+        const SdfPath &proxyPrimPath)
+    {
+        // Enumerate the children of \p prim that pass \p predicate with the
+        // same helpers the serial iterator uses, so instancing and instance
+        // proxies behave identically to UsdPrimRange.
+        Usd_PrimDataConstPtr child = prim;
+        SdfPath childProxyPrimPath = proxyPrimPath;
+        if (!Usd_MoveToChild(child, childProxyPrimPath,
+                             Usd_PrimDataConstPtr(nullptr), *predicate)) {
+            return;
+        }
+        for (;;) {
+            dispatcher->Run(Usd_PrimRangeParallelTask(
+                dispatcher, predicate, callback, child, childProxyPrimPath));
+            if (Usd_MoveToNextSiblingOrParent(
+                    child, childProxyPrimPath,
+                    Usd_PrimDataConstPtr(nullptr), *predicate)) {
+                break;
+            }
+        }
+    }
+
+    WorkDispatcher *dispatcher;
+    const Usd_PrimFlagsPredicate *predicate;
+    const std::function<bool (const UsdPrim &)> *callback;
+    Usd_PrimDataConstPtr prim;
+    SdfPath proxyPrimPath;
+};
+
 
 UsdPrimRange
 UsdPrimRange::Stage(const UsdStagePtr &stage,
@@ -49,6 +113,72 @@ UsdPrimRange::Stage(const UsdStagePtr &stage,
     return ret;
 }
 
+void
+UsdPrimRange::ParallelTraverse(
+    const UsdPrim &start,
+    const Usd_PrimFlagsPredicate &predicate,
+    const std::function<bool (const UsdPrim &)> &callback)
+{
+    Usd_PrimDataConstPtr p = get_pointer(start._Prim());
+    if (!p) {
+        return;
+    }
+
+    const SdfPath proxyPrimPath = start._ProxyPrimPath();
+    const Usd_PrimFlagsPredicate pred =
+        Usd_CreatePredicateForTraversal(p, proxyPrimPath, predicate);
+
+    // As with the serial ranges, if the start prim itself does not pass the
+    // predicate, nothing is visited.
+    if (!Usd_EvalPredicate(pred, p, proxyPrimPath)) {
+        return;
+    }
+
+    WorkDispatcher dispatcher;
+    dispatcher.Run(Usd_PrimRangeParallelTask(
+        &dispatcher, &pred, &callback, p, proxyPrimPath));
+    dispatcher.Wait();
+}
+
+void
+UsdPrimRange::ParallelTraverse(
+    const UsdPrim &start,
+    const std::function<bool (const UsdPrim &)> &callback)
+{
+    ParallelTraverse(start, UsdPrimDefaultPredicate, callback);
+}
+
+void
+UsdPrimRange::ParallelTraverseStage(
+    const UsdStagePtr &stage,
+    const Usd_PrimFlagsPredicate &predicate,
+    const std::function<bool (const UsdPrim &)> &callback)
+{
+    Usd_PrimDataConstPtr pseudoRoot =
+        get_pointer(stage->GetPseudoRoot()._Prim());
+    if (!pseudoRoot || !pseudoRoot->GetFirstChild()) {
+        return;
+    }
+
+    // Like UsdPrimRange::Stage(), visit the pseudo-root's children and their
+    // descendants, but not the pseudo-root itself.
+    const Usd_PrimFlagsPredicate pred = Usd_CreatePredicateForTraversal(
+        pseudoRoot->GetFirstChild(), SdfPath(), predicate);
+
+    WorkDispatcher dispatcher;
+    Usd_PrimRangeParallelTask::SpawnChildTasks(
+        &dispatcher, &pred, &callback, pseudoRoot, SdfPath());
+    dispatcher.Wait();
+}
+
+void
+UsdPrimRange::ParallelTraverseStage(
+    const UsdStagePtr &stage,
+    const std::function<bool (const UsdPrim &)> &callback)
+{
+    ParallelTraverseStage(stage, UsdPrimDefaultPredicate, callback);
+}
+
 void
 UsdPrimRange::iterator::PruneChildren()
 {
@@ -30,6 +30,7 @@
 #include "pxr/usd/usd/prim.h"
 #include "pxr/usd/usd/primFlags.h"
 
+#include <functional>
 #include <vector>
 #include <iterator>
 
@@ -306,6 +307,49 @@ public:
     Stage(const UsdStagePtr &stage,
           const Usd_PrimFlagsPredicate &predicate = UsdPrimDefaultPredicate);
 
+    /// Visit \p start and all of its descendants that pass \p predicate in
+    /// parallel, invoking \p callback on each visited prim.  The set of prims
+    /// visited is the same as that of `UsdPrimRange(start, predicate)`, but
+    /// the visitation order is unspecified, except that every prim is visited
+    /// after its parent.  If \p callback returns false the children of that
+    /// prim are not visited, as with iterator::PruneChildren().
+    ///
+    /// \p callback is invoked concurrently from multiple threads and so must
+    /// be thread-safe; it must not author to the stage being traversed.
+    USD_API
+    static void
+    ParallelTraverse(const UsdPrim &start,
+                     const Usd_PrimFlagsPredicate &predicate,
+                     const std::function<bool (const UsdPrim &)> &callback);
+
+    /// \overload
+    /// Visits prims that pass the default predicate (as defined by
+    /// #UsdPrimDefaultPredicate).
+    USD_API
+    static void
+    ParallelTraverse(const UsdPrim &start,
+                     const std::function<bool (const UsdPrim &)> &callback);
+
+    /// Visit all the prims on \p stage that pass \p predicate in parallel,
+    /// invoking \p callback on each visited prim.  This is the parallel
+    /// analogue of `UsdPrimRange::Stage(stage, predicate)`; see
+    /// ParallelTraverse() for the callback and ordering contract.
+    USD_API
+    static void
+    ParallelTraverseStage(
+        const UsdStagePtr &stage,
+        const Usd_PrimFlagsPredicate &predicate,
+        const std::function<bool (const UsdPrim &)> &callback);
+
+    /// \overload
+    /// Visits prims that pass the default predicate (as defined by
+    /// #UsdPrimDefaultPredicate).
+    USD_API
+    static void
+    ParallelTraverseStage(
+        const UsdStagePtr &stage,
+        const std::function<bool (const UsdPrim &)> &callback);
+
     /// Return an iterator to the start of this range.
     iterator begin() const {
         return iterator(this, _begin, _initProxyPrimPath, _initDepth);
@@ -39,8 +39,11 @@
 #include "pxr/usd/sdf/relationshipSpec.h"
 #include "pxr/usd/sdf/schema.h"
 
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/fileUtils.h"
 #include "pxr/base/tf/instantiateSingleton.h"
+#include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/tf/registryManager.h"
 #include "pxr/base/tf/token.h"
 #include "pxr/base/tf/type.h"
@@ -71,8 +74,17 @@ TF_DEFINE_PRIVATE_TOKENS(
     _tokens,
     (appliedAPISchemas)
     (multipleApplyAPISchemas)
+    (schemaCacheFingerprint)
 );
 
+TF_DEFINE_ENV_SETTING(
+    USD_SCHEMA_CACHE_PATH, "",
+    "If set, names a crate (.usdc) file used to cache the composed schema "
+    "registry. When the file exists and matches the installed schema "
+    "plugins it is loaded (and mmap'd) in place of recomposing every "
+    "plugin's generatedSchema.usda; otherwise it is (re)written after "
+    "composition.");
+
 template <class T>
 static void
 _CopySpec(const T &srcSpec, const T &dstSpec, 
@@ -137,6 +149,112 @@ _GetGeneratedSchema(const PlugPluginPtr &plugin)
     return layer;
 }
 
+static string
+_ComputeSchemaCacheFingerprint(const std::vector<PlugPluginPtr> &plugins)
+{
+    // The cache is only valid for the exact set of schema plugins it was
+    // built from, so fold each plugin's identity and the size and timestamp
+    // of its generated schema file into the fingerprint.  \p plugins is
+    // already sorted, so the fingerprint is stable across runs.
+    string fingerprint;
+    for (const PlugPluginPtr &plugin : plugins) {
+        const string fname = TfStringCatPaths(plugin->GetResourcePath(),
+                                              "generatedSchema.usda");
+        double mtime = 0;
+        ArchGetModificationTime(fname.c_str(), &mtime);
+        fingerprint += TfStringPrintf(
+            "%s:%s:%lld:%.0f;",
+            plugin->GetName().c_str(), fname.c_str(),
+            static_cast<long long>(ArchGetFileLength(fname.c_str())), mtime);
+    }
+    return fingerprint;
+}
+
+bool
+UsdSchemaRegistry::_TryLoadSchematicsFromCache(const std::string &cachePath,
+                                               const std::string &fingerprint)
+{
+    if (!TfIsFile(cachePath)) {
+        return false;
+    }
+
+    SdfLayerRefPtr cache = SdfLayer::OpenAsAnonymous(cachePath);
+    if (!cache) {
+        return false;
+    }
+
+    const VtDictionary customDataDict = cache->GetCustomLayerData();
+    if (!VtDictionaryIsHolding<string>(
+            customDataDict, _tokens->schemaCacheFingerprint) ||
+        VtDictionaryGet<string>(
+            customDataDict, _tokens->schemaCacheFingerprint) != fingerprint) {
+        TF_DEBUG(USD_SCHEMA_REGISTRATION).Msg(
+            "Schema cache at %s is stale; recomposing schemas.\n",
+            cachePath.c_str());
+        return false;
+    }
+
+    if (VtDictionaryIsHolding<VtStringArray>(customDataDict,
+                                             _tokens->appliedAPISchemas)) {
+        for (const auto &apiSchemaName : VtDictionaryGet<VtStringArray>(
+                 customDataDict, _tokens->appliedAPISchemas)) {
+            _appliedAPISchemaNames.insert(TfToken(apiSchemaName));
+        }
+    }
+
+    if (VtDictionaryIsHolding<VtStringArray>(
+            customDataDict, _tokens->multipleApplyAPISchemas)) {
+        for (const auto &apiSchemaName : VtDictionaryGet<VtStringArray>(
+                 customDataDict, _tokens->multipleApplyAPISchemas)) {
+            _multipleApplyAPISchemaNames.insert(TfToken(apiSchemaName));
+        }
+    }
+
+    TF_DEBUG(USD_SCHEMA_REGISTRATION).Msg(
+        "Loaded schema registry from cache at %s.\n", cachePath.c_str());
+
+    _schematics = cache;
+    return true;
+}
+
+void
+UsdSchemaRegistry::_WriteSchematicsCache(const std::string &cachePath,
+                                         const std::string &fingerprint) const
+{
+    // Stash everything a later process needs to skip composition in the
+    // cache layer's custom data: the fingerprint the cache is valid for
+    // and the merged API schema name lists.  The names are sorted so the
+    // cache contents are deterministic.
+    const auto sortedNames = [](const TfToken::HashSet &names) {
+        VtStringArray result;
+        result.reserve(names.size());
+        for (const TfToken &name : names) {
+            result.push_back(name.GetString());
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    VtDictionary customDataDict;
+    customDataDict[_tokens->schemaCacheFingerprint] = fingerprint;
+    customDataDict[_tokens->appliedAPISchemas] =
+        sortedNames(_appliedAPISchemaNames);
+    customDataDict[_tokens->multipleApplyAPISchemas] =
+        sortedNames(_multipleApplyAPISchemaNames);
+
+    SdfLayerRefPtr cache = SdfLayer::CreateAnonymous("schemaCache.usdc");
+    cache->TransferContent(_schematics);
+    cache->SetCustomLayerData(customDataDict);
+
+    if (cache->Export(cachePath)) {
+        TF_DEBUG(USD_SCHEMA_REGISTRATION).Msg(
+            "Wrote schema registry cache to %s.\n", cachePath.c_str());
+    } else {
+        TF_WARN("Failed to write schema registry cache to %s.",
+                cachePath.c_str());
+    }
+}
+
 void
 UsdSchemaRegistry::_BuildPrimTypePropNameToSpecIdMap(
     const TfToken &typeName, const SdfPath &primPath)
@@ -187,55 +305,74 @@ UsdSchemaRegistry::_FindAndAddPluginSchema()
         }
     }
     
-    // For each plugin, if it has generated schema, add it to the schematics.
-    std::vector<SdfLayerRefPtr> generatedSchemas(plugins.size());
-    {
-        WorkArenaDispatcher dispatcher;
-        dispatcher.Run([&plugins, &generatedSchemas]() {
-            WorkParallelForN(
-                plugins.size(), 
-                [&plugins, &generatedSchemas](size_t begin, size_t end) {
-                    for (; begin != end; ++begin) {
-                        generatedSchemas[begin] = 
-                            _GetGeneratedSchema(plugins[begin]);
-                    }
-                });
-            });
+    // If a schema cache location is configured, try to load the previously
+    // composed schematics rather than recomposing them here.
+    const string cachePath = TfGetEnvSetting(USD_SCHEMA_CACHE_PATH);
+    string cacheFingerprint;
+    if (!cachePath.empty()) {
+        cacheFingerprint = _ComputeSchemaCacheFingerprint(plugins);
     }
 
-    // Get list of disallowed fields in schemas and sort them so that
-    // helper functions in _AddSchema can binary search through them.
-    std::vector<TfToken> disallowedFields = GetDisallowedFields();
-    std::sort(disallowedFields.begin(), disallowedFields.end(),
-              TfTokenFastArbitraryLessThan());
-
-    SdfChangeBlock block;
-    for (const SdfLayerRefPtr& generatedSchema : generatedSchemas) {
-        if (generatedSchema) {
-            VtDictionary customDataDict = generatedSchema->GetCustomLayerData();
-
-            if (VtDictionaryIsHolding<VtStringArray>(customDataDict, 
-                    _tokens->appliedAPISchemas)) {
-                        
-                const VtStringArray &appliedAPISchemas = 
-                        VtDictionaryGet<VtStringArray>(customDataDict, 
-                            _tokens->appliedAPISchemas);
-                for (const auto &apiSchemaName : appliedAPISchemas) {
-                    _appliedAPISchemaNames.insert(TfToken(apiSchemaName));
+    if (cachePath.empty() ||
+        !_TryLoadSchematicsFromCache(cachePath, cacheFingerprint)) {
+
+        // For each plugin, if it has generated schema, add it to the
+        // schematics.
+        std::vector<SdfLayerRefPtr> generatedSchemas(plugins.size());
+        {
+            WorkArenaDispatcher dispatcher;
+            dispatcher.Run([&plugins, &generatedSchemas]() {
+                WorkParallelForN(
+                    plugins.size(),
+                    [&plugins, &generatedSchemas](size_t begin, size_t end) {
+                        for (; begin != end; ++begin) {
+                            generatedSchemas[begin] =
+                                _GetGeneratedSchema(plugins[begin]);
+                        }
+                    });
+                });
+        }
+
+        // Get list of disallowed fields in schemas and sort them so that
+        // helper functions in _AddSchema can binary search through them.
+        std::vector<TfToken> disallowedFields = GetDisallowedFields();
+        std::sort(disallowedFields.begin(), disallowedFields.end(),
+                  TfTokenFastArbitraryLessThan());
+
+        SdfChangeBlock block;
+        for (const SdfLayerRefPtr& generatedSchema : generatedSchemas) {
+            if (generatedSchema) {
+                VtDictionary customDataDict =
+                    generatedSchema->GetCustomLayerData();
+
+                if (VtDictionaryIsHolding<VtStringArray>(customDataDict,
+                        _tokens->appliedAPISchemas)) {
+
+                    const VtStringArray &appliedAPISchemas =
+                            VtDictionaryGet<VtStringArray>(customDataDict,
+                                _tokens->appliedAPISchemas);
+                    for (const auto &apiSchemaName : appliedAPISchemas) {
+                        _appliedAPISchemaNames.insert(TfToken(apiSchemaName));
+                    }
                 }
-            }
 
-            if (VtDictionaryIsHolding<VtStringArray>(customDataDict, 
-                    _tokens->multipleApplyAPISchemas)) {
-                const VtStringArray &multipleApplyAPISchemas = 
-                        VtDictionaryGet<VtStringArray>(customDataDict, 
-                            _tokens->multipleApplyAPISchemas);
-                for (const auto &apiSchemaName : multipleApplyAPISchemas) {
-                    _multipleApplyAPISchemaNames.insert(TfToken(apiSchemaName));
+                if (VtDictionaryIsHolding<VtStringArray>(customDataDict,
+                        _tokens->multipleApplyAPISchemas)) {
+                    const VtStringArray &multipleApplyAPISchemas =
+                            VtDictionaryGet<VtStringArray>(customDataDict,
+                                _tokens->multipleApplyAPISchemas);
+                    for (const auto &apiSchemaName : multipleApplyAPISchemas) {
+                        _multipleApplyAPISchemaNames.insert(
+                            TfToken(apiSchemaName));
+                    }
                 }
+
+                _AddSchema(generatedSchema, _schematics, disallowedFields);
             }
+        }
 
-            _AddSchema(generatedSchema, _schematics, disallowedFields);
+        if (!cachePath.empty()) {
+            _WriteSchematicsCache(cachePath, cacheFingerprint);
         }
     }
 
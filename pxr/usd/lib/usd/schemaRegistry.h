@@ -231,6 +231,17 @@ private:
 
     void _FindAndAddPluginSchema();
 
+    // Try to initialize the schematics and API schema name sets from the
+    // schema cache file at \p cachePath, returning true on success.  The
+    // cache is only used if it records the same \p fingerprint.
+    bool _TryLoadSchematicsFromCache(const std::string &cachePath,
+                                     const std::string &fingerprint);
+
+    // Write the composed schematics and API schema name sets to the schema
+    // cache file at \p cachePath, recording \p fingerprint for validation.
+    void _WriteSchematicsCache(const std::string &cachePath,
+                               const std::string &fingerprint) const;
+
     void _BuildPrimTypePropNameToSpecIdMap(const TfToken &typeName,
                                            const SdfPath &primPath);
 
@@ -48,6 +48,7 @@
 
 #include "pxr/usd/pcp/changes.h"
 #include "pxr/usd/pcp/errors.h"
+#include "pxr/usd/pcp/layerPrefetchRequest.h"
 #include "pxr/usd/pcp/layerStack.h"
 #include "pxr/usd/pcp/layerStackIdentifier.h"
 #include "pxr/usd/pcp/site.h"
@@ -78,6 +79,7 @@
 #include "pxr/base/plug/registry.h"
 #include "pxr/base/tf/enum.h"
 #include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/hashmap.h"
 #include "pxr/base/tf/hashset.h"
 #include "pxr/base/tf/mallocTag.h"
 #include "pxr/base/tf/ostreamMethods.h"
@@ -87,6 +89,7 @@
 #include "pxr/base/tf/stl.h"
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/work/arenaDispatcher.h"
+#include "pxr/base/work/detachedTask.h"
 #include "pxr/base/work/loops.h"
 #include "pxr/base/work/utils.h"
 
@@ -118,6 +121,12 @@ using std::vector;
 // Composes a prim's typeName, with special consideration for __AnyType__.
 static TfToken _ComposeTypeName(const PcpPrimIndex &primIndex);
 
+TF_DEFINE_ENV_SETTING(
+    USD_ENABLE_PAYLOAD_PREFETCH, true,
+    "If enabled, UsdStage::LoadAndUnload opens the layers targeted by "
+    "pending payloads in one parallel batch before recomposing, rather "
+    "than letting composition open each one on demand.");
+
 // ------------------------------------------------------------------------- //
 // UsdStage Helpers
 // ------------------------------------------------------------------------- //
@@ -429,6 +438,8 @@ UsdStage::UsdStage(const SdfLayerRefPtr& rootLayer,
     , _instanceCache(new Usd_InstanceCache)
     , _interpolationType(UsdInterpolationTypeLinear)
     , _lastChangeSerialNumber(0)
+    , _noticeBatchingDepth(0)
+    , _dispatcherResolverCache(nullptr)
     , _initialLoadSet(load)
     , _populationMask(mask)
     , _isClosingStage(false)
@@ -832,6 +843,33 @@ UsdStage::Open(const std::string& filePath,
     return Open(rootLayer, pathResolverContext, load);
 }
 
+/* static */
+std::future<UsdStageRefPtr>
+UsdStage::OpenAsync(const std::string& filePath, InitialLoadSet load)
+{
+    auto promise = std::make_shared<std::promise<UsdStageRefPtr>>();
+    std::future<UsdStageRefPtr> result = promise->get_future();
+    WorkRunDetachedTask([promise, filePath, load]() {
+        promise->set_value(UsdStage::Open(filePath, load));
+    });
+    return result;
+}
+
+/* static */
+std::future<UsdStageRefPtr>
+UsdStage::OpenAsync(const std::string& filePath,
+                    const ArResolverContext& pathResolverContext,
+                    InitialLoadSet load)
+{
+    auto promise = std::make_shared<std::promise<UsdStageRefPtr>>();
+    std::future<UsdStageRefPtr> result = promise->get_future();
+    WorkRunDetachedTask([promise, filePath, pathResolverContext, load]() {
+        promise->set_value(
+            UsdStage::Open(filePath, pathResolverContext, load));
+    });
+    return result;
+}
+
 /* static */
 UsdStageRefPtr
 UsdStage::OpenMasked(const std::string& filePath,
@@ -2055,10 +2093,9 @@ UsdStage::LoadAndUnload(const SdfPathSet &loadSet,
         return;
     }
 
-    UsdStageWeakPtr self(this);
     SdfPathVector pathsToRecomposeVec;
 
-    pathsToRecomposeVec.insert(pathsToRecomposeVec.begin(), 
+    pathsToRecomposeVec.insert(pathsToRecomposeVec.begin(),
                                aggregateLoads.begin(), aggregateLoads.end());
     pathsToRecomposeVec.insert(pathsToRecomposeVec.begin(),
                                aggregateUnloads.begin(), aggregateUnloads.end());
@@ -2069,9 +2106,7 @@ UsdStage::LoadAndUnload(const SdfPathSet &loadSet,
         resyncChanges[p];
     }
 
-    UsdNotice::ObjectsChanged(self, &resyncChanges, &infoChanges).Send(self);
-
-    UsdNotice::StageContentsChanged(self).Send(self);
+    _SendObjectsChanged(&resyncChanges, &infoChanges);
 }
 
 void
@@ -2170,6 +2205,20 @@ UsdStage::_LoadAndUnload(const SdfPathSet &loadSet,
 
     ArResolverScopedCache resolverCache;
 
+    // Pre-fetch the layers targeted by the payloads we're about to
+    // include.  Composition would otherwise discover and open these
+    // layers serially, one nesting level at a time, during prim
+    // indexing; opening them up front as a single parallel fan-out
+    // overlaps the per-layer resolve and read latency.  The request
+    // retains the opened layers, so it must stay alive until after
+    // _Recompose().  Payloads nested inside these payloads are picked
+    // up by the prefetch in each recursive call below.
+    PcpLayerPrefetchRequest payloadPrefetch;
+    if (!finalLoadSet.empty() &&
+        TfGetEnvSetting(USD_ENABLE_PAYLOAD_PREFETCH)) {
+        _cache->PrefetchPayloads(finalLoadSet, &payloadPrefetch);
+    }
+
     // Send include/exclude sets to the PcpCache.
     PcpChanges changes;
     _cache->RequestPayloads(finalLoadSet, finalUnloadSet, &changes);
@@ -2253,11 +2302,39 @@ UsdStage::FindLoadable(const SdfPath& rootPath)
 void
 UsdStage::SetPopulationMask(UsdStagePopulationMask const &mask)
 {
-    // For now just set the mask and recompose everything.
+    UsdStagePopulationMask const oldMask = _populationMask;
     _populationMask = mask;
 
     PcpChanges changes;
-    changes.DidChangeSignificantly(_cache.get(), SdfPath::AbsoluteRootPath());
+    if (mask.Includes(oldMask)) {
+        // The new mask includes everything the old mask did, so all
+        // currently populated prims remain populated and compose
+        // identically; the mask only ever prunes recursion into
+        // masked-out children.  Recompose just the newly included
+        // subtrees, splicing them into the existing prim tree.
+        for (auto const &path : mask.GetPaths()) {
+            if (oldMask.IncludesSubtree(path)) {
+                continue;
+            }
+            // Resync the topmost ancestor that the old mask did not
+            // include, since that is where population stopped; resyncing
+            // deeper would ask to recompose a subtree whose parent prim
+            // has not been populated yet.
+            SdfPath resyncPath = path;
+            for (SdfPath p = path;
+                 p != SdfPath::AbsoluteRootPath() && !oldMask.Includes(p);
+                 p = p.GetParentPath()) {
+                resyncPath = p;
+            }
+            changes.DidChangeSignificantly(_cache.get(), resyncPath);
+        }
+    }
+    else {
+        // The mask was narrowed or otherwise changed arbitrarily;
+        // recompose everything.
+        changes.DidChangeSignificantly(
+            _cache.get(), SdfPath::AbsoluteRootPath());
+    }
     _Recompose(changes);
 }
 
@@ -2813,7 +2890,12 @@ UsdStage::_ComposeSubtreesInParallel(
 
     _primMapMutex = boost::in_place();
     _dispatcher = boost::in_place();
-    
+
+    // Install a resolver cache scope shared by all the composition tasks,
+    // so that identical asset paths are only resolved once across threads.
+    ArResolverScopedCache resolverCache;
+    _dispatcherResolverCache = &resolverCache;
+
     for (size_t i = 0; i != prims.size(); ++i) {
         Usd_PrimDataPtr p = prims[i];
         _dispatcher->Run(
@@ -2823,6 +2905,7 @@ UsdStage::_ComposeSubtreesInParallel(
     }
 
     _dispatcher = boost::none;
+    _dispatcherResolverCache = nullptr;
     _primMapMutex = boost::none;
 }
 
@@ -2852,7 +2935,15 @@ UsdStage::_ComposeSubtreeImpl(
 {
     TfAutoMallocTag2 tag("Usd", _mallocTagID);
 
-    const SdfPath primIndexPath = 
+    // When composing in parallel, bind the cache scope shared by all the
+    // composition tasks so any asset resolution done on this thread (e.g.
+    // while populating clips) hits the shared cache.
+    boost::optional<ArResolverScopedCache> taskResolverCache;
+    if (_dispatcherResolverCache) {
+        taskResolverCache = boost::in_place(_dispatcherResolverCache);
+    }
+
+    const SdfPath primIndexPath =
         (inPrimIndexPath.IsEmpty() ? prim->GetPath() : inPrimIndexPath);
 
     // Compute the prim's PcpPrimIndex.
@@ -3266,6 +3357,43 @@ UsdStage::RemovePrim(const SdfPath& path)
     return _RemovePrim(path);
 }
 
+std::vector<std::pair<SdfPath, VtDictionary> >
+UsdStage::GatherAssetInfoForSubtree(const UsdPrim &root) const
+{
+    TRACE_FUNCTION();
+
+    std::vector<std::pair<SdfPath, VtDictionary> > result;
+    if (!root) {
+        TF_CODING_ERROR("Invalid root prim");
+        return result;
+    }
+
+    // Collect the subtree's prims, then compose each prim's assetInfo in
+    // parallel through the stage's composed-metadata cache.
+    std::vector<UsdPrim> prims;
+    for (const UsdPrim &prim : UsdPrimRange(root)) {
+        prims.push_back(prim);
+    }
+
+    std::vector<VtValue> values(prims.size());
+    WorkParallelForN(
+        prims.size(),
+        [this, &prims, &values](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                _ComposeDictionaryMetadataViaCache(
+                    prims[i], SdfFieldKeys->AssetInfo, &values[i]);
+            }
+        });
+
+    for (size_t i = 0; i != prims.size(); ++i) {
+        if (values[i].IsHolding<VtDictionary>()) {
+            result.emplace_back(prims[i].GetPath(),
+                                values[i].UncheckedGet<VtDictionary>());
+        }
+    }
+    return result;
+}
+
 const UsdEditTarget &
 UsdStage::GetEditTarget() const
 {
@@ -3423,11 +3551,7 @@ UsdStage::MuteAndUnmuteLayers(const std::vector<std::string> &muteLayers,
     _PathsToChangesMap resyncChanges, infoChanges;
     _Recompose(changes, &resyncChanges);
 
-    UsdStageWeakPtr self(this);
-
-    UsdNotice::ObjectsChanged(self, &resyncChanges, &infoChanges)
-        .Send(self);
-    UsdNotice::StageContentsChanged(self).Send(self);
+    _SendObjectsChanged(&resyncChanges, &infoChanges);
 }
 
 const std::vector<std::string>&
@@ -3670,6 +3794,12 @@ UsdStage::_HandleLayersDidChange(
 
     TF_DEBUG(USD_CHANGES).Msg("\nHandleLayersDidChange received\n");
 
+    // Any authored change can move attribute value sources around, so all
+    // cached resolve info is suspect.  The same goes for cached composed
+    // dictionary metadata, which any metadata edit can affect.
+    _ClearResolveInfoCache();
+    _dictionaryMetadataCache.clear();
+
     // Keep track of paths to USD objects that need to be recomposed or
     // have otherwise changed.
     using _PathsToChangesMap = UsdNotice::ObjectsChanged::_PathsToChangesMap;
@@ -3844,16 +3974,96 @@ UsdStage::_HandleLayersDidChange(
     // prefixed by elements in recomposeChanges or beneath instances.
     _MergeAndRemoveDescendentEntries(&recomposeChanges, &otherInfoChanges);
 
-    UsdStageWeakPtr self(this);
+    // Notify about changed objects; receivers can refresh their caches...
+    // or just dirty them.
+    _SendObjectsChanged(&recomposeChanges, &otherInfoChanges);
+}
 
-    // Notify about changed objects.
-    UsdNotice::ObjectsChanged(
-        self, &recomposeChanges, &otherInfoChanges).Send(self);
+// Accumulated change notification while one or more NoticeBatchingBlocks
+// exist for the stage.  Only the affected paths are retained: the per-field
+// change entries attached to each path point into change lists owned by the
+// round of change processing that produced them, and do not outlive it.
+struct UsdStage::_PendingBatchedChanges
+{
+    using _PathsToChangesMap = UsdNotice::ObjectsChanged::_PathsToChangesMap;
+    _PathsToChangesMap resyncChanges;
+    _PathsToChangesMap infoChanges;
+};
 
-    // Receivers can now refresh their caches... or just dirty them
+template <class ChangedPaths>
+void
+UsdStage::_SendObjectsChanged(ChangedPaths *resyncChanges,
+                              ChangedPaths *infoChanges)
+{
+    if (_noticeBatchingDepth > 0) {
+        // Union the affected paths into the pending batch; the notification
+        // is delivered when the outermost NoticeBatchingBlock is destroyed.
+        if (!_pendingBatchedChanges) {
+            _pendingBatchedChanges.reset(new _PendingBatchedChanges);
+        }
+        for (const auto &entry : *resyncChanges) {
+            _pendingBatchedChanges->resyncChanges[entry.first];
+        }
+        for (const auto &entry : *infoChanges) {
+            _pendingBatchedChanges->infoChanges[entry.first];
+        }
+        return;
+    }
+
+    UsdStageWeakPtr self(this);
+    UsdNotice::ObjectsChanged(self, resyncChanges, infoChanges).Send(self);
     UsdNotice::StageContentsChanged(self).Send(self);
 }
 
+void
+UsdStage::_BeginNoticeBatching()
+{
+    ++_noticeBatchingDepth;
+}
+
+void
+UsdStage::_EndNoticeBatching()
+{
+    if (!TF_VERIFY(_noticeBatchingDepth > 0)) {
+        return;
+    }
+    if (--_noticeBatchingDepth > 0 || !_pendingBatchedChanges) {
+        return;
+    }
+
+    // Take the pending changes first: listeners may author further changes,
+    // and those must begin a new round rather than mutate the maps being
+    // delivered.
+    std::unique_ptr<_PendingBatchedChanges> pending =
+        std::move(_pendingBatchedChanges);
+
+    // Reduce the unioned paths to minimal form, dropping resync paths
+    // covered by other resync paths and info changes covered by resyncs,
+    // mirroring what a single round of change processing would report.
+    _RemoveDescendentEntries(&pending->resyncChanges);
+    _MergeAndRemoveDescendentEntries(
+        &pending->resyncChanges, &pending->infoChanges);
+
+    _SendObjectsChanged(&pending->resyncChanges, &pending->infoChanges);
+}
+
+UsdStage::NoticeBatchingBlock::NoticeBatchingBlock(const UsdStageWeakPtr &stage)
+    : _stage(stage)
+{
+    if (_stage) {
+        _stage->_BeginNoticeBatching();
+    } else {
+        TF_CODING_ERROR("Invalid stage");
+    }
+}
+
+UsdStage::NoticeBatchingBlock::~NoticeBatchingBlock()
+{
+    if (_stage) {
+        _stage->_EndNoticeBatching();
+    }
+}
+
 void 
 UsdStage::_Recompose(const PcpChanges &changes)
 {
@@ -3870,6 +4080,17 @@ UsdStage::_Recompose(const PcpChanges &changes,
     T *pathsToRecompose = initialPathsToRecompose ?
         initialPathsToRecompose : &newPathsToRecompose;
 
+    // Recomposition invalidates cached resolve info, which may point at
+    // nodes in prim indexes that are about to be recomputed. This also
+    // covers recompositions that do not arrive via layer change notices,
+    // like load/unload and layer muting.
+    _ClearResolveInfoCache();
+
+    // Likewise discard cached composed dictionary metadata.  Change
+    // processing is never concurrent with other stage access, so the
+    // non-concurrent clear() is safe.
+    _dictionaryMetadataCache.clear();
+
     _RecomposePrims(changes, pathsToRecompose);
 
     // Update layer change notice listeners if changes may affect
@@ -5399,6 +5620,98 @@ UsdStage
 // Metadata Resolution
 // --------------------------------------------------------------------- //
 
+// Returns true for dictionary-valued prim metadata fields whose composed
+// values are cached on the stage.
+static bool
+_IsCachedDictionaryMetadataField(const TfToken &fieldName)
+{
+    return fieldName == SdfFieldKeys->AssetInfo ||
+           fieldName == SdfFieldKeys->CustomData;
+}
+
+bool
+UsdStage::_ComposeDictionaryMetadataViaCache(const UsdObject &obj,
+                                             const TfToken &fieldName,
+                                             VtValue *result) const
+{
+    // Instances and their masters resolve through the same prim index,
+    // so keying by prim index path shares cache entries between them.
+    const std::pair<SdfPath, TfToken> cacheKey(
+        obj._Prim()->GetPrimIndex().GetPath(), fieldName);
+
+    _DictionaryMetadataCache::const_iterator it =
+        _dictionaryMetadataCache.find(cacheKey);
+    if (it == _dictionaryMetadataCache.end()) {
+        // Compose the full dictionary.  An empty VtValue is cached when
+        // there are no opinions so that misses also hit the cache.
+        VtValue value;
+        StrongestValueComposer<VtValue *> composer(&value);
+        if (!_GetMetadataImpl(
+                obj, fieldName, TfToken(), /*useFallbacks=*/true, &composer)) {
+            value = VtValue();
+        }
+        it = _dictionaryMetadataCache.insert(
+            std::make_pair(cacheKey, value)).first;
+    }
+
+    *result = it->second;
+    return !result->IsEmpty();
+}
+
+// Store a cached composed value into the result storage, reporting
+// whether the value could be stored (the abstract-data form fails on a
+// held-type mismatch, matching the uncached resolution behavior).
+static bool
+_StoreComposedValue(VtValue *result, const VtValue &value)
+{
+    *result = value;
+    return true;
+}
+static bool
+_StoreComposedValue(SdfAbstractDataValue *result, const VtValue &value)
+{
+    return result->StoreValue(value);
+}
+
+// Serves dictionary-valued prim metadata from the stage's cache if
+// applicable, returning true if it handled the query and writing whether
+// a value was found to \p found.  Pipeline scans query assetInfo and
+// customData on every prim, which otherwise re-runs the full
+// dictionary-merge machinery each time.
+template <class Storage>
+bool
+UsdStage::_GetDictionaryMetadataFromCache(const UsdObject &obj,
+                                          const TfToken &fieldName,
+                                          const TfToken &keyPath,
+                                          bool useFallbacks,
+                                          Storage result, bool *found) const
+{
+    if (!useFallbacks || !obj.Is<UsdPrim>() ||
+        !_IsCachedDictionaryMetadataField(fieldName)) {
+        return false;
+    }
+
+    VtValue value;
+    if (!_ComposeDictionaryMetadataViaCache(obj, fieldName, &value)) {
+        *found = false;
+        return true;
+    }
+
+    if (keyPath.IsEmpty()) {
+        *found = _StoreComposedValue(result, value);
+        return true;
+    }
+
+    if (!value.IsHolding<VtDictionary>()) {
+        *found = false;
+        return true;
+    }
+    const VtValue *entry =
+        value.UncheckedGet<VtDictionary>().GetValueAtPath(keyPath.GetString());
+    *found = entry && _StoreComposedValue(result, *entry);
+    return true;
+}
+
 bool
 UsdStage::_GetMetadata(const UsdObject &obj, const TfToken &fieldName,
                        const TfToken &keyPath, bool useFallbacks,
@@ -5423,6 +5736,12 @@ UsdStage::_GetMetadata(const UsdObject &obj, const TfToken &fieldName,
         }
     }
 
+    bool found = false;
+    if (_GetDictionaryMetadataFromCache(
+            obj, fieldName, keyPath, useFallbacks, result, &found)) {
+        return found;
+    }
+
     StrongestValueComposer<VtValue *> composer(result);
     return _GetMetadataImpl(obj, fieldName, keyPath, useFallbacks, &composer);
 }
@@ -5452,6 +5771,12 @@ UsdStage::_GetMetadata(const UsdObject &obj,
         }
     }
 
+    bool found = false;
+    if (_GetDictionaryMetadataFromCache(
+            obj, fieldName, keyPath, useFallbacks, result, &found)) {
+        return found;
+    }
+
     StrongestValueComposer<SdfAbstractDataValue *> composer(result);
     return _GetMetadataImpl(obj, fieldName, keyPath, useFallbacks, &composer);
 }
@@ -6062,6 +6387,13 @@ _GetClipsThatApplyToNode(
                     continue;
                 }
             }
+            else {
+                // With no manifest, value resolution must examine every
+                // clip layer to find out whether the attribute has
+                // samples; open any still-closed layers as one parallel
+                // batch rather than serially on first touch.
+                localClips.OpenClipLayers();
+            }
 
             relevantClips.push_back(&localClips);
         }
@@ -6244,12 +6576,26 @@ UsdStage::_GetValueImpl(UsdTimeCode time, const UsdAttribute &attr,
     }
 
     UsdResolveInfo resolveInfo;
+
+    // If an earlier query cached resolve info for this attribute, go straight
+    // from it to the value source instead of re-running the strongest-opinion
+    // search. During repeated sampling (e.g. animation playback) this is the
+    // common case.
+    if (_GetResolveInfoFromCache(attr, &resolveInfo)) {
+        return _GetValueFromResolveInfoImpl(
+            resolveInfo, time, attr, interpolator, result);
+    }
+
     _ExtraResolveInfo<T> extraResolveInfo;
     extraResolveInfo.defaultOrFallbackValue = result;
 
     TfErrorMark m;
     _GetResolveInfo(attr, &resolveInfo, &time, &extraResolveInfo);
 
+    if (m.IsClean()) {
+        _CacheResolveInfo(attr, resolveInfo);
+    }
+
     if (resolveInfo._source == UsdResolveInfoSourceTimeSamples) {
         return UsdStage_ResolveInfoAccess::_GetTimeSampleValue(
             time, attr, resolveInfo, 
@@ -6635,13 +6981,62 @@ UsdStage::_GetResolvedValueImpl(const UsdProperty &prop,
 }
 
 void
-UsdStage::_GetResolveInfo(const UsdAttribute &attr, 
+UsdStage::_GetResolveInfo(const UsdAttribute &attr,
                           UsdResolveInfo *resolveInfo,
                           const UsdTimeCode *time) const
 {
     _GetResolveInfo<SdfAbstractDataValue>(attr, resolveInfo, time);
 }
 
+bool
+UsdStage::_GetResolveInfoFromCache(const UsdAttribute &attr,
+                                   UsdResolveInfo *resolveInfo) const
+{
+    _ResolveInfoCache::const_iterator it =
+        _resolveInfoCache.find(attr.GetPath());
+    if (it == _resolveInfoCache.end()) {
+        return false;
+    }
+
+    *resolveInfo = it->second;
+    return true;
+}
+
+void
+UsdStage::_CacheResolveInfo(const UsdAttribute &attr,
+                            const UsdResolveInfo &resolveInfo) const
+{
+    // Resolve info computed at one time is only valid at other times if the
+    // value source cannot vary over time. Layer time samples, defaults and
+    // fallbacks resolve to the same source at every time; clip-based sources
+    // do not. We skip attributes on prims that may have opinions in clips
+    // entirely, since a clip may provide a stronger opinion at a time other
+    // than the one the info was computed at.
+    if (attr._Prim()->MayHaveOpinionsInClips()) {
+        return;
+    }
+
+    switch (resolveInfo._source) {
+    case UsdResolveInfoSourceTimeSamples:
+    case UsdResolveInfoSourceDefault:
+    case UsdResolveInfoSourceFallback:
+    case UsdResolveInfoSourceNone:
+        _resolveInfoCache.insert(std::make_pair(attr.GetPath(), resolveInfo));
+        break;
+    default:
+        break;
+    }
+}
+
+void
+UsdStage::_ClearResolveInfoCache()
+{
+    // This is only called during change processing, which the Usd threading
+    // model guarantees is never concurrent with other stage access, so the
+    // non-concurrent clear() is safe here.
+    _resolveInfoCache.clear();
+}
+
 template <class T>
 bool 
 UsdStage::_GetValueFromResolveInfoImpl(const UsdResolveInfo &info,
@@ -6702,12 +7097,17 @@ UsdStage::_GetValueFromResolveInfoImpl(const UsdResolveInfo &info,
                     continue;
                 }
 
+                // Kick off a background open of the neighboring clip in
+                // the likely playback direction, so sampling across the
+                // upcoming clip boundary doesn't stall on layer opening.
+                clipAffectingPrim.PrefetchAdjacentClip(localTime);
+
                 double upper = 0.0;
                 double lower = 0.0;
                 if (clip->GetBracketingTimeSamplesForPath(
                         specId, localTime, &lower, &upper)) {
                     return UsdStage_ResolveInfoAccess::_GetClipValue(
-                        time, attr, info, clip, lower, upper, interpolator, 
+                        time, attr, info, clip, lower, upper, interpolator,
                         result);
                 }
             }
@@ -6987,11 +7387,22 @@ UsdStage::_GetBracketingTimeSamples(const UsdAttribute &attr,
     const UsdTimeCode time(desiredTime);
 
     UsdResolveInfo resolveInfo;
+
+    // As with _GetValueImpl, cached resolve info lets us go straight to the
+    // owning layer's time samples without re-resolving.
+    if (_GetResolveInfoFromCache(attr, &resolveInfo)) {
+        return _GetBracketingTimeSamplesFromResolveInfo(
+            resolveInfo, attr, desiredTime, requireAuthored, lower, upper,
+            hasSamples);
+    }
+
     _ExtraResolveInfo<SdfAbstractDataValue> extraInfo;
 
     _GetResolveInfo<SdfAbstractDataValue>(
         attr, &resolveInfo, &time, &extraInfo);
 
+    _CacheResolveInfo(attr, resolveInfo);
+
     if (resolveInfo._source == UsdResolveInfoSourceTimeSamples) {
         // In the time samples case, we bail out early to avoid another
         // call to SdfLayer::GetBracketingTimeSamples. _GetResolveInfo will 
@@ -34,9 +34,10 @@
 #include "pxr/usd/usd/schemaRegistry.h"
 #include "pxr/usd/usd/stagePopulationMask.h"
 #include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/resolveInfo.h"
 
 #include "pxr/base/tf/declarePtrs.h"
-#include "pxr/base/tf/hashmap.h"
+#include "pxr/base/tf/flatHashMap.h"
 #include "pxr/base/tf/weakBase.h"
 
 #include "pxr/usd/sdf/declareHandles.h"
@@ -44,16 +45,19 @@
 #include "pxr/usd/sdf/path.h"
 #include "pxr/usd/sdf/types.h"
 #include "pxr/usd/pcp/cache.h"
+#include "pxr/base/vt/dictionary.h"
 #include "pxr/base/vt/value.h"
 #include "pxr/base/work/arenaDispatcher.h"
 
 #include <boost/optional.hpp>
 
 #include <tbb/concurrent_vector.h>
+#include <tbb/concurrent_unordered_map.h>
 #include <tbb/concurrent_unordered_set.h>
 #include <tbb/spin_rw_mutex.h>
 
 #include <functional>
+#include <future>
 #include <string>
 #include <memory>
 #include <unordered_map>
@@ -63,6 +67,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 
 class ArResolverContext;
+class ArResolverScopedCache;
 class GfInterval;
 class SdfAbstractDataValue;
 class Usd_ClipCache;
@@ -269,6 +274,24 @@ public:
          const ArResolverContext& pathResolverContext,
          InitialLoadSet load = LoadAll);
 
+    /// Attempt to find or open a stage as Open() does, but on a background
+    /// thread, returning a future that yields the resulting stage.
+    ///
+    /// This lets callers overlap the I/O- and composition-bound work of
+    /// opening a stage with other application work.  As with Open(), the
+    /// future yields a null stage if the stage could not be opened; any
+    /// errors are reported through the usual diagnostic channels.  The
+    /// stage must not be accessed until the future is ready.
+    USD_API
+    static std::future<UsdStageRefPtr>
+    OpenAsync(const std::string& filePath, InitialLoadSet load = LoadAll);
+    /// \overload
+    USD_API
+    static std::future<UsdStageRefPtr>
+    OpenAsync(const std::string& filePath,
+              const ArResolverContext& pathResolverContext,
+              InitialLoadSet load = LoadAll);
+
     /// Create a new stage and recursively compose prims defined within and
     /// referenced by the layer at \p filePath which must already exist, subject
     /// to \p mask.
@@ -892,6 +915,20 @@ public:
     USD_API
     bool RemovePrim(const SdfPath& path);
 
+    /// Compose the assetInfo dictionary for \p root and every descendant
+    /// prim and return (path, dictionary) pairs for the prims that have
+    /// any assetInfo opinions, in no particular order.
+    ///
+    /// The per-prim results are computed in parallel and feed the
+    /// stage's composed-metadata cache, so subsequent per-prim assetInfo
+    /// queries on the same prims are cache hits.  This is intended for
+    /// pipeline scans that need assetInfo for entire subtrees and is
+    /// substantially faster than calling UsdPrim::GetAssetInfo() on each
+    /// prim in turn.
+    USD_API
+    std::vector<std::pair<SdfPath, VtDictionary> >
+    GatherAssetInfoForSubtree(const UsdPrim &root) const;
+
     /// @}
 
     // --------------------------------------------------------------------- //
@@ -1502,6 +1539,51 @@ public:
 
     /// @}
 
+    // --------------------------------------------------------------------- //
+    /// \anchor Usd_noticeBatching
+    /// \name Batched Change Notification
+    /// @{
+    // --------------------------------------------------------------------- //
+
+    /// \class NoticeBatchingBlock
+    ///
+    /// While one or more of these blocks exist for a stage, the
+    /// UsdNotice::ObjectsChanged and UsdNotice::StageContentsChanged notices
+    /// the stage would send for each round of authored changes are
+    /// aggregated instead: the resynced and changed-info paths from every
+    /// round are unioned and reduced to a minimal set, and a single
+    /// ObjectsChanged notice (followed by a single StageContentsChanged
+    /// notice) is sent when the last block is destroyed.
+    ///
+    /// This lets clients performing bursts of micro-edits -- interactive
+    /// manipulation, for example -- arrange for downstream caches to process
+    /// invalidation once per batch (e.g. once per frame, by closing and
+    /// reopening a block) rather than once per edit.  The stage itself still
+    /// recomposes after every round of changes as usual; only notification
+    /// is deferred, so stage queries made between rounds see up-to-date
+    /// results.
+    ///
+    /// Note that the per-field change entries carried by ObjectsChanged do
+    /// not outlive the round that produced them, so the aggregated notice
+    /// reports the affected paths but no changed fields;
+    /// ObjectsChanged::HasChangedFields() returns false for all paths.
+    ///
+    /// Blocks must be created and destroyed on the thread performing the
+    /// edits, like the edits themselves.
+    class NoticeBatchingBlock {
+    public:
+        USD_API explicit NoticeBatchingBlock(const UsdStageWeakPtr &stage);
+        USD_API ~NoticeBatchingBlock();
+
+        NoticeBatchingBlock(const NoticeBatchingBlock &) = delete;
+        NoticeBatchingBlock &operator=(const NoticeBatchingBlock &) = delete;
+
+    private:
+        UsdStageWeakPtr _stage;
+    };
+
+    /// @}
+
 private:
     struct _IncludeNewlyDiscoveredPayloadsPredicate;
 
@@ -1724,6 +1806,19 @@ private:
     // Update stage contents in response to changes in scene description.
     void _HandleLayersDidChange(const SdfNotice::LayersDidChangeSentPerLayer &);
 
+    // Deliver the standard post-change notification (ObjectsChanged followed
+    // by StageContentsChanged), or accumulate the affected paths into
+    // _pendingBatchedChanges when notice batching is active.  See
+    // NoticeBatchingBlock.
+    template <class ChangedPaths>
+    void _SendObjectsChanged(ChangedPaths *resyncChanges,
+                             ChangedPaths *infoChanges);
+
+    // Open/close a round of notice batching; called by NoticeBatchingBlock.
+    // Closing the outermost block delivers the accumulated notification.
+    void _BeginNoticeBatching();
+    void _EndNoticeBatching();
+
     // Remove scene description for the prim at \p fullPath in the current edit
     // target.
     bool _RemovePrim(const SdfPath& fullPath);
@@ -1842,6 +1937,24 @@ private:
                       bool useFallbacks,
                       SdfAbstractDataValue* result) const;
 
+    // Compose the full dictionary value for the given dictionary-valued
+    // prim metadata field, serving repeated queries from the stage's
+    // composed-metadata cache.  Returns false if there is no opinion.
+    bool _ComposeDictionaryMetadataViaCache(const UsdObject &obj,
+                                            const TfToken &fieldName,
+                                            VtValue *result) const;
+
+    // Serve a dictionary-valued prim metadata query from the stage's
+    // composed-metadata cache if applicable;  returns true if the query
+    // was handled, writing whether a value was produced to \p found.
+    template <class Storage>
+    bool _GetDictionaryMetadataFromCache(const UsdObject &obj,
+                                         const TfToken &fieldName,
+                                         const TfToken &keyPath,
+                                         bool useFallbacks,
+                                         Storage result,
+                                         bool *found) const;
+
     template <class T>
     bool _GetMetadataImpl(const UsdObject &obj, const TfToken& fieldName, 
                           T* value) const;
@@ -1942,11 +2055,28 @@ private:
     template <class T> struct _ExtraResolveInfo;
 
     template <class T>
-    void _GetResolveInfo(const UsdAttribute &attr, 
+    void _GetResolveInfo(const UsdAttribute &attr,
                          UsdResolveInfo *resolveInfo,
                          const UsdTimeCode *time = nullptr,
                          _ExtraResolveInfo<T> *extraInfo = nullptr) const;
 
+    // Look up cached resolve info for \p attr. Returns true and fills in
+    // \p resolveInfo if an entry exists, false otherwise.
+    bool _GetResolveInfoFromCache(const UsdAttribute &attr,
+                                  UsdResolveInfo *resolveInfo) const;
+
+    // Record \p resolveInfo for \p attr in the stage's resolve info cache
+    // if the info's value source is time-independent. Infos for attributes
+    // that may be affected by value clips are never cached, since their
+    // value source can vary over time.
+    void _CacheResolveInfo(const UsdAttribute &attr,
+                           const UsdResolveInfo &resolveInfo) const;
+
+    // Drop all cached resolve info. Called during change processing, since
+    // any authoring or recomposition may change where attribute values
+    // come from.
+    void _ClearResolveInfoCache();
+
     template <class T> struct _ResolveInfoResolver;
     struct _PropertyStackResolver;
 
@@ -2059,12 +2189,42 @@ private:
     std::unique_ptr<Usd_ClipCache> _clipCache;
     std::unique_ptr<Usd_InstanceCache> _instanceCache;
 
-    // A map from Path to Prim, for fast random access.
-    typedef TfHashMap<
+    // A map from Path to Prim, for fast random access.  An open-addressing
+    // table: lookups here are frequently misses (e.g. instance proxy and
+    // expired-prim checks) and the flat layout keeps probe sequences in
+    // cache.  The prim data objects themselves are stable heap allocations;
+    // only iterators and map entries are invalidated by mutation, and all
+    // mutation happens under _primMapMutex when it is engaged.
+    typedef TfFlatHashMap<
         SdfPath, Usd_PrimDataIPtr, SdfPath::Hash> PathToNodeMap;
     PathToNodeMap _primMap;
     mutable boost::optional<tbb::spin_rw_mutex> _primMapMutex;
 
+    // A map from attribute path to cached resolve info, used to avoid
+    // re-running the strongest-opinion search on every value query during
+    // repeated sampling (e.g. animation playback). Entries are populated
+    // lazily during value resolution and discarded wholesale during change
+    // processing.
+    typedef tbb::concurrent_unordered_map<
+        SdfPath, UsdResolveInfo, SdfPath::Hash> _ResolveInfoCache;
+    mutable _ResolveInfoCache _resolveInfoCache;
+
+    // A map from (prim index path, field) to composed dictionary-valued
+    // prim metadata (assetInfo and customData), which otherwise runs the
+    // full dictionary-merge machinery on every query.  Keying by prim
+    // index path shares entries between instances and their masters,
+    // which resolve through the same prim index.  Entries are populated
+    // lazily and discarded wholesale during change processing.
+    struct _DictionaryMetadataCacheKeyHash {
+        size_t operator()(const std::pair<SdfPath, TfToken> &key) const {
+            return SdfPath::Hash()(key.first) + key.second.Hash();
+        }
+    };
+    typedef tbb::concurrent_unordered_map<
+        std::pair<SdfPath, TfToken>, VtValue, _DictionaryMetadataCacheKeyHash>
+        _DictionaryMetadataCache;
+    mutable _DictionaryMetadataCache _dictionaryMetadataCache;
+
     // The interpolation type used for all attributes on the stage.
     UsdInterpolationType _interpolationType;
 
@@ -2073,8 +2233,20 @@ private:
     _LayerAndNoticeKeyVec _layersAndNoticeKeys;
     size_t _lastChangeSerialNumber;
 
+    // Change notification accumulated while one or more NoticeBatchingBlocks
+    // exist for this stage; null when no changes are pending.  See
+    // NoticeBatchingBlock.
+    struct _PendingBatchedChanges;
+    std::unique_ptr<_PendingBatchedChanges> _pendingBatchedChanges;
+    size_t _noticeBatchingDepth;
+
     boost::optional<WorkArenaDispatcher> _dispatcher;
 
+    // When parallel subtree composition is in flight, points to a resolver
+    // cache scope shared by all composition tasks, so that identical asset
+    // paths are only resolved once across threads.  Null otherwise.
+    const ArResolverScopedCache *_dispatcherResolverCache;
+
     // To provide useful aggregation of malloc stats, we bill everything
     // for this stage - from all access points - to this tag.
     char const *_mallocTagID;
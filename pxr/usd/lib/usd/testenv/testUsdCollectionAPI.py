@@ -359,10 +359,41 @@ class TestUsdCollectionAPI(unittest.TestCase):
         self.assertEqual(len(incObjects), 1)
 
         allIncObjects = Usd.CollectionAPI.ComputeIncludedObjects(
-                excludeInstanceGeomMquery, stage, 
+                excludeInstanceGeomMquery, stage,
                 predicate=Usd.TraverseInstanceProxies())
         self.assertEqual(len(allIncObjects), 2)
 
+    def test_CompiledMembershipQuery(self):
+        # A compiled query must agree with the uncompiled query for every
+        # prim and property in the compiled subtree.
+        for collName in ["leafGeom", "allGeom", "allGeomProperties",
+                         "hasRelationships", "includesCollection",
+                         "excludeInstanceGeom"]:
+            coll = Usd.CollectionAPI(testPrim, collName)
+            mquery = coll.ComputeMembershipQuery()
+            cquery = Usd.CollectionAPI.CompiledMembershipQuery(
+                    mquery, stage.GetPseudoRoot())
+
+            for prim in stage.Traverse():
+                self.assertEqual(cquery.IsPathIncluded(prim.GetPath()),
+                                 mquery.IsPathIncluded(prim.GetPath()))
+                for prop in prim.GetProperties():
+                    self.assertEqual(cquery.IsPathIncluded(prop.GetPath()),
+                                     mquery.IsPathIncluded(prop.GetPath()))
+
+            # The bulk classification must match the prim paths computed by
+            # ComputeIncludedPaths.
+            includedPrimPaths = set(
+                    p for p in Usd.CollectionAPI.ComputeIncludedPaths(
+                        mquery, stage)
+                    if p.IsPrimPath())
+            self.assertEqual(set(cquery.GetIncludedPrimPaths()),
+                             includedPrimPaths)
+
+        # An empty compiled query includes nothing.
+        emptyQuery = Usd.CollectionAPI.CompiledMembershipQuery()
+        self.assertFalse(emptyQuery.IsPathIncluded(geom.GetPath()))
+
     def test_invalidCollections(self):
         invalidCollectionNames = ["invalidExpansionRule", 
             "invalidExcludesExplicitOnly",
@@ -0,0 +1,135 @@
+#!/pxrpythonsubst
+#
+# Copyright 2019 Pixar
+#
+# Licensed under the Apache License, Version 2.0 (the "Apache License")
+# with the following modification; you may not use this file except in
+# compliance with the Apache License and the following modification to it:
+# Section 6. Trademarks. is deleted and replaced with:
+#
+# 6. Trademarks. This License does not grant permission to use the trade
+#    names, trademarks, service marks, or product names of the Licensor
+#    and its affiliates, except as required to comply with Section 4(c) of
+#    the License and to reproduce the content of the NOTICE file.
+#
+# You may obtain a copy of the Apache License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the Apache License with the above modification is
+# distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied. See the Apache License for the specific
+# language governing permissions and limitations under the Apache License.
+
+import unittest
+from pxr import Sdf, Usd, Tf
+
+# Reloading a layer should send fine-grained change notification, so
+# that only objects whose opinions actually changed are recomposed.
+# This matters most for streaming formats like usdc, which previously
+# sent a coarse content-replaced change resyncing the whole stage.
+allFormats = ['usd' + x for x in 'ac']
+
+
+class TestUsdIncrementalReload(unittest.TestCase):
+    def setUp(self):
+        self._resyncedPaths = []
+        self._changedInfoPaths = []
+
+    def OnObjectsChanged(self, notice, sender):
+        self._resyncedPaths.extend(notice.GetResyncedPaths())
+        self._changedInfoPaths.extend(notice.GetChangedInfoOnlyPaths())
+
+    def _Reset(self):
+        self._resyncedPaths = []
+        self._changedInfoPaths = []
+
+    @staticmethod
+    def _MakeStage(path):
+        stage = Usd.Stage.CreateNew(path)
+        for i in range(5):
+            prim = stage.DefinePrim('/World/Prim_%d' % i, 'Scope')
+            attr = prim.CreateAttribute('x', Sdf.ValueTypeNames.Double)
+            attr.Set(1.0)
+        stage.GetRootLayer().Save()
+        return stage
+
+    @staticmethod
+    def _OverwriteOnDisk(srcLayer, path):
+        # Simulate an external process (e.g. a DCC save) replacing the
+        # asset on disk.
+        srcLayer.Export(path)
+
+    def test_ValueChangeDoesNotResync(self):
+        for fmt in allFormats:
+            path = 'incrementalReloadValue.' + fmt
+            stage = self._MakeStage(path)
+            layer = stage.GetRootLayer()
+
+            # Author a single changed default on an external copy and
+            # write it over the original asset.
+            external = Sdf.Layer.CreateAnonymous('.' + fmt)
+            external.TransferContent(layer)
+            external.GetAttributeAtPath('/World/Prim_3.x').default = 42.0
+            self._OverwriteOnDisk(external, path)
+
+            key = Tf.Notice.RegisterGlobally(
+                Usd.Notice.ObjectsChanged, self.OnObjectsChanged)
+            self._Reset()
+            self.assertTrue(layer.Reload(force=True))
+            key.Revoke()
+
+            # A single default change must not resync any prims; only the
+            # changed attribute reports changed info.
+            self.assertEqual(self._resyncedPaths, [])
+            self.assertIn(Sdf.Path('/World/Prim_3.x'), self._changedInfoPaths)
+            self.assertEqual(
+                stage.GetAttributeAtPath('/World/Prim_3.x').Get(), 42.0)
+
+    def test_AddedPrimResyncsOnlyThatPrim(self):
+        for fmt in allFormats:
+            path = 'incrementalReloadAdd.' + fmt
+            stage = self._MakeStage(path)
+            layer = stage.GetRootLayer()
+
+            external = Sdf.Layer.CreateAnonymous('.' + fmt)
+            external.TransferContent(layer)
+            Sdf.PrimSpec(external.GetPrimAtPath('/World'), 'NewPrim',
+                         Sdf.SpecifierDef, 'Scope')
+            self._OverwriteOnDisk(external, path)
+
+            key = Tf.Notice.RegisterGlobally(
+                Usd.Notice.ObjectsChanged, self.OnObjectsChanged)
+            self._Reset()
+            self.assertTrue(layer.Reload(force=True))
+            key.Revoke()
+
+            # Only the added prim should be resynced, not the whole stage.
+            self.assertNotIn(Sdf.Path('/'), self._resyncedPaths)
+            self.assertIn(Sdf.Path('/World/NewPrim'), self._resyncedPaths)
+            self.assertTrue(stage.GetPrimAtPath('/World/NewPrim'))
+
+    def test_UnchangedReloadIsQuiet(self):
+        for fmt in allFormats:
+            path = 'incrementalReloadNoop.' + fmt
+            stage = self._MakeStage(path)
+            layer = stage.GetRootLayer()
+
+            # Rewrite identical content, then force a reload; nothing
+            # should be resynced.
+            external = Sdf.Layer.CreateAnonymous('.' + fmt)
+            external.TransferContent(layer)
+            self._OverwriteOnDisk(external, path)
+
+            key = Tf.Notice.RegisterGlobally(
+                Usd.Notice.ObjectsChanged, self.OnObjectsChanged)
+            self._Reset()
+            self.assertTrue(layer.Reload(force=True))
+            key.Revoke()
+
+            self.assertEqual(self._resyncedPaths, [])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -221,11 +221,73 @@ class NoticeTester(unittest.TestCase):
 
             del objectsChanged
 
+    def NoticeBatchingBlock(self):
+        resyncedPaths = []
+        infoPaths = []
+        def OnObjectsChanged(notice, stage):
+            self._objectsCount += 1
+            resyncedPaths.extend(notice.GetResyncedPaths())
+            infoPaths.extend(notice.GetChangedInfoOnlyPaths())
+
+        for fmt in allFormats:
+            self._ResetCounters()
+            del resyncedPaths[:]
+            del infoPaths[:]
+
+            s = Usd.Stage.CreateInMemory('NoticeBatchingBlock.'+fmt)
+            contentsChanged = Tf.Notice.Register(
+                Usd.Notice.StageContentsChanged,
+                self.OnStageContentsChanged, s)
+            objectsChanged = Tf.Notice.Register(
+                Usd.Notice.ObjectsChanged, OnObjectsChanged, s)
+
+            # While a block is open, each edit still recomposes the stage,
+            # but notification is deferred and coalesced.
+            with Usd.Stage.NoticeBatchingBlock(s):
+                foo = s.DefinePrim("/Foo")
+                self.assertTrue(foo)
+                s.DefinePrim("/Foo/Child")
+                s.DefinePrim("/Bar")
+                foo.SetMetadata("comment", "x")
+                self.assertEqual(self._objectsCount, 0)
+                self.assertEqual(self._contentsCount, 0)
+
+            # One aggregated ObjectsChanged and one StageContentsChanged,
+            # with unioned, minimal resync paths; /Foo/Child is covered by
+            # /Foo, and /Foo's info change is covered by its resync.
+            self.assertEqual(self._objectsCount, 1)
+            self.assertEqual(self._contentsCount, 1)
+            self.assertEqual(set(resyncedPaths),
+                             set([Sdf.Path("/Foo"), Sdf.Path("/Bar")]))
+            self.assertEqual(infoPaths, [])
+
+            # Nested blocks defer notification until the outermost block
+            # is closed.
+            self._ResetCounters()
+            with Usd.Stage.NoticeBatchingBlock(s):
+                s.DefinePrim("/Baz")
+                with Usd.Stage.NoticeBatchingBlock(s):
+                    s.DefinePrim("/Qux")
+                self.assertEqual(self._objectsCount, 0)
+            self.assertEqual(self._objectsCount, 1)
+            self.assertEqual(self._contentsCount, 1)
+
+            # A block with no edits sends nothing.
+            self._ResetCounters()
+            with Usd.Stage.NoticeBatchingBlock(s):
+                pass
+            self.assertEqual(self._objectsCount, 0)
+            self.assertEqual(self._contentsCount, 0)
+
+            del contentsChanged
+            del objectsChanged
+
     def test_Basic(self):
         self.Basics()
         self.ObjectsChangedNotice()
         self.ObjectsChangedNoticeForAttributes()
         self.ObjectsChangedNoticeForRelationships()
+        self.NoticeBatchingBlock()
 
 if __name__ == "__main__":
     unittest.main()
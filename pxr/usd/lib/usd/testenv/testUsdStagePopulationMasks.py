@@ -368,5 +368,45 @@ class TestUsdStagePopulationMask(unittest.TestCase):
         assert master.GetChild('geom')
         assert master.GetChild('shading')
 
+    def test_IncrementalExpansion(self):
+        # Widening the population mask composes only the newly included
+        # subtrees and splices them into the existing prim tree.
+        stage = Usd.Stage.CreateInMemory()
+        for p in ('/A/x', '/A/y', '/B/x', '/C/x/deep'):
+            stage.DefinePrim(p)
+
+        masked = Usd.Stage.OpenMasked(
+            stage.GetRootLayer(), Usd.StagePopulationMask(['/A']))
+        assert masked.GetPrimAtPath('/A/x')
+        assert not masked.GetPrimAtPath('/B')
+
+        # Add a sibling subtree.
+        masked.SetPopulationMask(Usd.StagePopulationMask(['/A', '/B']))
+        assert masked.GetPrimAtPath('/A/x')
+        assert masked.GetPrimAtPath('/A/y')
+        assert masked.GetPrimAtPath('/B/x')
+        assert not masked.GetPrimAtPath('/C')
+
+        # Add a deep mask path whose unpopulated ancestors must be
+        # populated as part of the expansion.
+        masked.SetPopulationMask(
+            Usd.StagePopulationMask(['/A', '/B', '/C/x/deep']))
+        assert masked.GetPrimAtPath('/C')
+        assert masked.GetPrimAtPath('/C/x/deep')
+
+        # Widen a mask path to an ancestor of an existing mask path.
+        masked2 = Usd.Stage.OpenMasked(
+            stage.GetRootLayer(), Usd.StagePopulationMask(['/C/x/deep']))
+        assert masked2.GetPrimAtPath('/C/x/deep')
+        masked2.SetPopulationMask(Usd.StagePopulationMask(['/C']))
+        assert masked2.GetPrimAtPath('/C/x')
+        assert masked2.GetPrimAtPath('/C/x/deep')
+
+        # Narrowing still recomposes to drop the excluded subtrees.
+        masked.SetPopulationMask(Usd.StagePopulationMask(['/B']))
+        assert not masked.GetPrimAtPath('/A')
+        assert not masked.GetPrimAtPath('/C')
+        assert masked.GetPrimAtPath('/B/x')
+
 if __name__ == '__main__':
     unittest.main()
@@ -109,11 +109,18 @@ UsdUsdcFileFormat::WriteToFile(const SdfLayer& layer,
 {
     SdfAbstractDataConstPtr dataSource = _GetLayerData(layer);
 
+    // A full compacting rewrite may be requested via the 'compact' file
+    // format argument (e.g. by SdfLayer::Export to the layer's own path);
+    // this reclaims the space accumulated by incremental saves.
+    auto compactIt = args.find(UsdUsdcFileFormatTokens->CompactArg.GetString());
+    const bool compact = compactIt != args.end() && compactIt->second == "true";
+
     // XXX: WBN to avoid const-cast -- saving can't be non-mutating in general.
     if (auto const *constCrateData =
         dynamic_cast<Usd_CrateData const *>(get_pointer(dataSource))) {
         auto *crateData = const_cast<Usd_CrateData *>(constCrateData);
-        return crateData->Save(filePath);
+        return compact ?
+            crateData->Compact(filePath) : crateData->Save(filePath);
     }
 
     // Otherwise we're dealing with some arbitrary data object, just copy the
@@ -33,7 +33,8 @@
 PXR_NAMESPACE_OPEN_SCOPE
 
 #define USD_USDC_FILE_FORMAT_TOKENS   \
-    ((Id,      "usdc"))
+    ((Id,      "usdc"))               \
+    ((CompactArg, "compact"))
 
 TF_DECLARE_PUBLIC_TOKENS(UsdUsdcFileFormatTokens, USD_API, USD_USDC_FILE_FORMAT_TOKENS);
 
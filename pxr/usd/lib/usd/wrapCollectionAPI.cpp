@@ -177,13 +177,20 @@ static bool _WrapIsPathIncluded_1(
 }
 
 static bool _WrapIsPathIncluded_2(
-    const UsdCollectionAPI::MembershipQuery &query, 
+    const UsdCollectionAPI::MembershipQuery &query,
     const SdfPath &path,
     const TfToken &parentExpansionRule)
 {
     return query.IsPathIncluded(path, parentExpansionRule);
 }
 
+static bool _WrapCompiledIsPathIncluded(
+    const UsdCollectionAPI::CompiledMembershipQuery &query,
+    const SdfPath &path)
+{
+    return query.IsPathIncluded(path);
+}
+
 WRAP_CUSTOM {
 
     scope s_query = _class;
@@ -204,6 +211,18 @@ WRAP_CUSTOM {
         .def(self != self)
         ;
 
+    using CMQuery = UsdCollectionAPI::CompiledMembershipQuery;
+
+    scope scope_cmQuery = class_<CMQuery>("CompiledMembershipQuery")
+        .def(init<>())
+        .def(init<const MQuery &, const UsdPrim &,
+                  optional<const Usd_PrimFlagsPredicate &> >(
+             (arg("query"), arg("root"), arg("predicate"))))
+        .def("IsPathIncluded", _WrapCompiledIsPathIncluded, arg("path"))
+        .def("GetIncludedPrimPaths", &CMQuery::GetIncludedPrimPaths,
+             return_value_policy<TfPySequenceToList>())
+        ;
+
     using This = UsdCollectionAPI;
 
     MQuery (This::*_ComputeMembershipQuery)() const = 
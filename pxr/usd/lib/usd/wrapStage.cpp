@@ -31,6 +31,7 @@
 #include "pxr/usd/pcp/pyUtils.h"
 #include "pxr/usd/sdf/pyUtils.h"
 
+#include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/weakPtr.h"
 #include "pxr/base/tf/pyContainerConversions.h"
 #include "pxr/base/tf/pyEnum.h"
@@ -175,7 +176,44 @@ _ExpandPopulationMask(UsdStage &self,
     return self.ExpandPopulationMask(relPred, attrPred);
 }
 
-static object 
+// This allows UsdStage::NoticeBatchingBlocks to be used in an RAII fashion
+// in Python with the 'with' statement, like Sdf.ChangeBlock.
+class Usd_PythonNoticeBatchingBlock {
+public:
+    explicit Usd_PythonNoticeBatchingBlock(const UsdStagePtr &stage)
+        : _stage(stage), _block(0)
+    {
+        // Do nothing.
+    }
+
+    ~Usd_PythonNoticeBatchingBlock()
+    {
+        delete _block;
+    }
+
+    void Open()
+    {
+        if (!TF_VERIFY(_block == 0)) {
+            return;
+        }
+        _block = new UsdStage::NoticeBatchingBlock(_stage);
+    }
+
+    void Close(object, object, object)
+    {
+        if (!TF_VERIFY(_block != 0)) {
+            return;
+        }
+        delete _block;
+        _block = 0;
+    }
+
+private:
+    UsdStagePtr _stage;
+    UsdStage::NoticeBatchingBlock *_block;
+};
+
+static object
 _GetColorConfigFallbacks()
 {
     SdfAssetPath colorConfiguration;
@@ -547,6 +585,13 @@ void wrapUsdStage()
         .def("_GetPcpCache", &Usd_PcpCacheAccess::GetPcpCache,
              return_internal_reference<>())
         ;
+
+    // Wrapped under the Usd.Stage scope to mirror the C++ nesting.
+    class_<Usd_PythonNoticeBatchingBlock, boost::noncopyable>
+        ("NoticeBatchingBlock", init<const UsdStagePtr &>(arg("stage")))
+        .def("__enter__", &Usd_PythonNoticeBatchingBlock::Open)
+        .def("__exit__", &Usd_PythonNoticeBatchingBlock::Close)
+        ;
 }
 
 TF_REFPTR_CONST_VOLATILE_GET(UsdStage)
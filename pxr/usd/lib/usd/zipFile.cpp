@@ -31,11 +31,13 @@
 #include "pxr/base/tf/errorMark.h"
 #include "pxr/base/tf/pathUtils.h"
 #include "pxr/base/tf/safeOutputFile.h"
+#include "pxr/base/work/loops.h"
 
 #include <boost/crc.hpp>
 
 #include <cstdint>
 #include <ctime>
+#include <unordered_map>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -130,6 +132,36 @@ private:
     FILE* _f;
 };
 
+// Output stream that writes to a caller-specified offset in a file via
+// pwrite, advancing the offset with each write. Unlike _OutputStream,
+// this does not touch the file position, so multiple threads may write
+// disjoint regions of the same file concurrently.
+struct _OffsetOutputStream
+{
+    _OffsetOutputStream(FILE* f, int64_t offset)
+        : _f(f), _offset(offset) { }
+
+    template <class T>
+    inline void Write(const T& value)
+    {
+        static_assert(_IsBitwiseReadWrite<T>::value,
+                      "Cannot write non-trivially-copyable type");
+        Write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    inline void Write(const char* buffer, size_t numBytes)
+    {
+        const int64_t numWritten = ArchPWrite(_f, buffer, numBytes, _offset);
+        if (numWritten > 0) {
+            _offset += numWritten;
+        }
+    }
+
+private:
+    FILE* _f;
+    int64_t _offset;
+};
+
 // ------------------------------------------------------------
 
 // Local file header for each file in the zip archive.
@@ -236,8 +268,9 @@ _ReadLocalFileHeader(_InputStream& src)
 }
 
 // Write given _LocalFileHeader to given output stream.
+template <class OutputStream>
 void
-_WriteLocalFileHeader(_OutputStream& out, const _LocalFileHeader& h)
+_WriteLocalFileHeader(OutputStream& out, const _LocalFileHeader& h)
 {
     out.Write(h.f.signature);
     out.Write(h.f.versionForExtract);
@@ -466,7 +499,22 @@ public:
         : storage(std::move(buffer_))
         , buffer(storage.get())
         , size(size_)
-    { }
+    {
+        // Build the file path -> local file header offset index used by
+        // Find().  Members of a package are looked up individually (and
+        // often concurrently) as they are opened during stage load, so a
+        // linear scan of the archive per lookup gets expensive for
+        // packages with many members.
+        size_t offset = 0;
+        _InputStream src(buffer, size);
+        _LocalFileHeader h = _ReadLocalFileHeader(src);
+        while (h.IsValid()) {
+            pathToOffsetMap.emplace(
+                std::string(h.filenameStart, h.f.filenameLength), offset);
+            offset = src.Tell();
+            h = _ReadLocalFileHeader(src);
+        }
+    }
 
     std::shared_ptr<const char> storage;
 
@@ -474,6 +522,11 @@ public:
     // code so they don't have to call storage.get() all the time.
     const char* buffer;
     size_t size;
+
+    // Index of file path to offset of the corresponding local file header
+    // in buffer.  Duplicate paths keep the first occurrence, matching what
+    // a linear scan would find.
+    std::unordered_map<std::string, size_t> pathToOffsetMap;
 };
 
 UsdZipFile
@@ -539,7 +592,9 @@ UsdZipFile::DumpContents() const
 UsdZipFile::Iterator
 UsdZipFile::Find(const std::string& path) const
 {
-    return std::find(begin(), end(), path);
+    const auto it = _impl->pathToOffsetMap.find(path);
+    return it == _impl->pathToOffsetMap.end() ?
+        end() : Iterator(_impl.get(), it->second);
 }
 
 UsdZipFile::Iterator 
@@ -560,9 +615,9 @@ UsdZipFile::Iterator::Iterator()
 {
 }
 
-UsdZipFile::Iterator::Iterator(const _Impl* impl)
+UsdZipFile::Iterator::Iterator(const _Impl* impl, size_t offset)
     : _impl(impl)
-    , _offset(0)
+    , _offset(offset)
 {
     _InputStream src(_impl->buffer, _impl->size, _offset);
     if (!_ReadLocalFileHeader(src).IsValid()) {
@@ -726,12 +781,25 @@ public:
 
     TfSafeOutputFile outputFile;
 
-    // Record for each file added to the zip file:
-    //  - File path in zip file
-    //  - Fixed portion of local file header
-    //  - Offset from beginning of zip file to start of local file header
-    using _Record = 
-        std::tuple<std::string, _LocalFileHeader::Fixed, uint32_t>;
+    // Record for each file added to the zip file.  AddFile() just maps the
+    // source file and records it here; checksumming and writing are
+    // deferred to Save() so that the CRC32 computations, which dominate
+    // package assembly time, can run in parallel across files.
+    struct _Record
+    {
+        // File path in zip file.
+        std::string zipFilePath;
+        // Path to the source file on disk.
+        std::string sourceFilePath;
+        // Read-only mapping of the source file.
+        ArchConstFileMapping mapping;
+        // CRC32 checksum of the source file, computed during Save().
+        uint32_t crc32 = 0;
+        // Fixed portion of the local file header and its offset from the
+        // beginning of the zip file, filled in as Save() writes the file.
+        _LocalFileHeader::Fixed localHeader;
+        uint32_t localHeaderOffset = 0;
+    };
     std::vector<_Record> addedFiles;
 };
 
@@ -795,18 +863,16 @@ UsdZipFileWriter::AddFile(
     // it follows zip file specifications.
     const std::string zipFilePath = _ZipFilePath(filePathInArchive);
 
-    // Check if this file has already been written to this zip archive; if so, 
+    // Check if this file has already been written to this zip archive; if so,
     // just skip it.
     if (std::find_if(
             _impl->addedFiles.begin(), _impl->addedFiles.end(),
-            [&zipFilePath](const _Impl::_Record& r) { 
-                return std::get<0>(r) == zipFilePath; 
+            [&zipFilePath](const _Impl::_Record& r) {
+                return r.zipFilePath == zipFilePath;
             }) != _impl->addedFiles.end()) {
         return zipFilePath;
     }
 
-    _OutputStream outStream(_impl->outputFile.Get());
-
     std::string err;
     ArchConstFileMapping mapping = ArchMapFileReadOnly(filePath, &err);
     if (!mapping) {
@@ -815,33 +881,13 @@ UsdZipFileWriter::AddFile(
         return std::string();
     }
 
-    // Set up local file header
-    _LocalFileHeader h;
-    h.f.signature = _LocalFileHeader::Signature;
-    h.f.versionForExtract = 10; // Default value
-    h.f.bits = 0;
-    h.f.compressionMethod = 0; // No compression
-    std::tie(h.f.lastModTime, h.f.lastModDate) = _ModTimeAndDate(filePath);
-    h.f.crc32 = _Crc32(mapping);
-    h.f.compressedSize = ArchGetFileMappingLength(mapping);
-    h.f.uncompressedSize = ArchGetFileMappingLength(mapping);
-    h.f.filenameLength = zipFilePath.length();
-    
-    const uint32_t offset = outStream.Tell();
-    const size_t dataOffset = 
-        offset + _LocalFileHeader::FixedSize + h.f.filenameLength;
-    h.f.extraFieldLength = _ComputeExtraFieldPaddingSize(dataOffset);
-
-    h.filenameStart = zipFilePath.data();
-
-    char extraFieldBuffer[_PaddingBufferSize] = { 0 };
-    h.extraFieldStart = _PrepareExtraFieldPadding(
-        extraFieldBuffer, h.f.extraFieldLength);
-
-    h.dataStart = mapping.get();
-
-    _WriteLocalFileHeader(outStream, h);
-    _impl->addedFiles.emplace_back(zipFilePath, h.f, offset);
+    // Record the mapped source file; checksumming and writing happen
+    // in Save().
+    _Impl::_Record record;
+    record.zipFilePath = zipFilePath;
+    record.sourceFilePath = filePath;
+    record.mapping = std::move(mapping);
+    _impl->addedFiles.push_back(std::move(record));
 
     return zipFilePath;
 }
@@ -854,15 +900,80 @@ UsdZipFileWriter::Save()
         return false;
     }
 
-    _OutputStream outStream(_impl->outputFile.Get());
+    // Compute member checksums in parallel.  The CRC32 over each mapped
+    // source file is the bulk of the work in assembling a package, and each
+    // file's checksum is independent of the others.
+    WorkParallelForN(
+        _impl->addedFiles.size(),
+        [this](size_t begin, size_t end) {
+            for (; begin != end; ++begin) {
+                _Impl::_Record& record = _impl->addedFiles[begin];
+                record.crc32 = _Crc32(record.mapping);
+            }
+        });
+
+    // Lay out the local file header and data for each file added to the
+    // zip archive.  Each record's position in the file depends only on the
+    // sizes of the records before it, so the entire layout can be computed
+    // up front, allowing the (much more expensive) writes below to proceed
+    // in parallel.
+    uint32_t offset = 0;
+    for (_Impl::_Record& record : _impl->addedFiles) {
+        _LocalFileHeader::Fixed& h = record.localHeader;
+        h.signature = _LocalFileHeader::Signature;
+        h.versionForExtract = 10; // Default value
+        h.bits = 0;
+        h.compressionMethod = 0; // No compression
+        std::tie(h.lastModTime, h.lastModDate) =
+            _ModTimeAndDate(record.sourceFilePath);
+        h.crc32 = record.crc32;
+        h.compressedSize = ArchGetFileMappingLength(record.mapping);
+        h.uncompressedSize = ArchGetFileMappingLength(record.mapping);
+        h.filenameLength = record.zipFilePath.length();
+
+        const size_t dataOffset =
+            offset + _LocalFileHeader::FixedSize + h.filenameLength;
+        h.extraFieldLength = _ComputeExtraFieldPaddingSize(dataOffset);
+
+        record.localHeaderOffset = offset;
+        offset = dataOffset + h.extraFieldLength + h.compressedSize;
+    }
+
+    // Write the local file header and data for each file at the offset
+    // computed above.  The records occupy disjoint regions of the output
+    // file, so they may be written concurrently.
+    FILE* const outputFile = _impl->outputFile.Get();
+    WorkParallelForN(
+        _impl->addedFiles.size(),
+        [this, outputFile](size_t begin, size_t end) {
+            for (; begin != end; ++begin) {
+                const _Impl::_Record& record = _impl->addedFiles[begin];
+
+                _LocalFileHeader h;
+                h.f = record.localHeader;
+                h.filenameStart = record.zipFilePath.data();
+
+                char extraFieldBuffer[_PaddingBufferSize] = { 0 };
+                h.extraFieldStart = _PrepareExtraFieldPadding(
+                    extraFieldBuffer, h.f.extraFieldLength);
+
+                h.dataStart = record.mapping.get();
+
+                _OffsetOutputStream outStream(
+                    outputFile, record.localHeaderOffset);
+                _WriteLocalFileHeader(outStream, h);
+            }
+        });
 
     // Write central directory headers for each file added to the zip archive.
-    const long centralDirectoryStart = outStream.Tell();
+    const long centralDirectoryStart = offset;
+    fseek(outputFile, centralDirectoryStart, SEEK_SET);
+    _OutputStream outStream(outputFile);
 
     for (const _Impl::_Record& record : _impl->addedFiles) {
-        const std::string& fileToZip = std::get<0>(record);
-        const _LocalFileHeader::Fixed& localHeader = std::get<1>(record);
-        uint32_t offset = std::get<2>(record);
+        const std::string& fileToZip = record.zipFilePath;
+        const _LocalFileHeader::Fixed& localHeader = record.localHeader;
+        uint32_t offset = record.localHeaderOffset;
 
         _CentralDirectoryHeader h;
         h.f.signature = _CentralDirectoryHeader::Signature;
@@ -166,7 +166,7 @@ public:
 
     private:
         friend class UsdZipFile;
-        Iterator(const _Impl* impl);
+        Iterator(const _Impl* impl, size_t offset = 0);
 
         const _Impl* _impl;
         size_t _offset;
@@ -604,6 +604,53 @@ UsdGeomBBoxCache::Clear()
     _bboxCache.clear();
 }
 
+void
+UsdGeomBBoxCache::Invalidate(const SdfPath& subtreeRootPath)
+{
+    const SdfPath primPath = subtreeRootPath.GetPrimPath();
+    if (primPath == SdfPath::AbsoluteRootPath()) {
+        Clear();
+        return;
+    }
+
+    TF_DEBUG(USDGEOM_BBOX).Msg("[BBox Cache] INVALIDATED %s\n",
+                               primPath.GetText());
+
+    // Erase entries in the invalidated subtree, entries for ancestors of
+    // the subtree (whose bounds aggregate the subtree), and entries whose
+    // prims have expired, e.g. due to recomposition.
+    std::vector<UsdPrim> entriesToErase;
+    TF_FOR_ALL(it, _bboxCache) {
+        const UsdPrim& cachedPrim = it->first;
+        if (!cachedPrim) {
+            entriesToErase.push_back(cachedPrim);
+            continue;
+        }
+        const SdfPath& cachedPath = cachedPrim.GetPath();
+        if (cachedPath.HasPrefix(primPath) || primPath.HasPrefix(cachedPath)) {
+            entriesToErase.push_back(cachedPrim);
+        }
+    }
+    for (const UsdPrim& prim : entriesToErase) {
+        _bboxCache.erase(prim);
+    }
+
+    // Transforms in the subtree may have changed as well. These are cheap
+    // to recompute relative to bounds, so just clear them wholesale.
+    _ctmCache.Clear();
+}
+
+void
+UsdGeomBBoxCache::Invalidate(const UsdNotice::ObjectsChanged& notice)
+{
+    for (const SdfPath& path : notice.GetResyncedPaths()) {
+        Invalidate(path);
+    }
+    for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+        Invalidate(path);
+    }
+}
+
 void
 UsdGeomBBoxCache::SetIncludedPurposes(const TfTokenVector& includedPurposes)
 {
@@ -29,6 +29,7 @@
 #include "pxr/usd/usdGeom/xformCache.h"
 #include "pxr/usd/usdGeom/pointInstancer.h"
 #include "pxr/usd/usd/attributeQuery.h"
+#include "pxr/usd/usd/notice.h"
 #include "pxr/base/gf/bbox3d.h"
 #include "pxr/base/tf/hashmap.h"
 #include "pxr/base/work/arenaDispatcher.h"
@@ -77,7 +78,8 @@ class UsdGeomModelAPI;
 ///  * This class should only be used with valid UsdPrim objects.
 ///
 ///  * This cache does not listen for change notifications; the user is
-///    responsible for clearing the cache when changes occur.
+///    responsible for clearing the cache when changes occur, either
+///    wholesale via Clear() or per-subtree via Invalidate().
 ///
 ///  * Thread safety: instances of this class may not be used concurrently.
 ///
@@ -301,6 +303,26 @@ public:
     USDGEOM_API
     void Clear();
 
+    /// Clears the pre-cached values for the subtree rooted at
+    /// \p subtreeRootPath, along with the cached values of its ancestors,
+    /// whose bounds aggregate the subtree.  All other cached values are
+    /// retained, making this much cheaper than Clear() when only part of
+    /// the stage has changed.  If \p subtreeRootPath is a property path,
+    /// its prim's subtree is invalidated.
+    ///
+    /// Note that cached transforms are cleared wholesale, as they are
+    /// inexpensive to recompute relative to bounds.
+    USDGEOM_API
+    void Invalidate(const SdfPath& subtreeRootPath);
+
+    /// \overload
+    /// Invalidates the cached values for every path resynced or changed
+    /// by \p notice.  This cache does not listen for change notification
+    /// itself; clients should call this from their own
+    /// UsdNotice::ObjectsChanged listener.
+    USDGEOM_API
+    void Invalidate(const UsdNotice::ObjectsChanged& notice);
+
     /// Indicate the set of \p includedPurposes to use when resolving child
     /// bounds. Each child's purpose must match one of the elements of this set
     /// to be included in the computation; if it does not, child is excluded.
@@ -219,6 +219,28 @@ public:
                                          const GfMatrix4d &transform,
                                          VtVec3fArray *extent);
 
+    /// Compute extents for all of the Boundable prims in \p boundables at
+    /// time \p time, invoking the registered extent computations in
+    /// parallel.  \p extents is resized to match \p boundables; the i'th
+    /// entry holds the extent computed for the i'th boundable, and is
+    /// empty if that computation failed.
+    ///
+    /// Returns \c true if an extent was successfully computed for every
+    /// given boundable, \c false otherwise.
+    ///
+    /// This is equivalent to, but more efficient than, calling
+    /// ComputeExtentFromPlugins on each prim in turn, and is intended for
+    /// clients such as exporters that author extents for many prims at
+    /// once.
+    ///
+    /// \note This function may load plugins in order to access the extent
+    /// computation for a prim type.
+    USDGEOM_API
+    static bool ComputeExtentsFromPlugins(
+        const std::vector<UsdGeomBoundable> &boundables,
+        const UsdTimeCode &time,
+        std::vector<VtVec3fArray> *extents);
+
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -33,8 +33,11 @@
 #include "pxr/base/tf/instantiateSingleton.h"
 #include "pxr/base/tf/singleton.h"
 #include "pxr/base/tf/weakBase.h"
+#include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
 
 #include <tbb/queuing_rw_mutex.h>
+#include <atomic>
 #include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -243,6 +246,59 @@ UsdGeomBoundable::ComputeExtentFromPlugins(
     return _ComputeExtentFromPlugins(boundable, time, nullptr, extent);
 }
 
+bool
+UsdGeomBoundable::ComputeExtentsFromPlugins(
+    const std::vector<UsdGeomBoundable>& boundables,
+    const UsdTimeCode& time,
+    std::vector<VtVec3fArray>* extents)
+{
+    TRACE_FUNCTION();
+
+    if (!extents) {
+        TF_CODING_ERROR("'extents' pointer is NULL.");
+        return false;
+    }
+    extents->clear();
+    extents->resize(boundables.size());
+
+    // Resolve the compute functions serially up front; this may load
+    // plugins, and once resolved the functions are cached in the registry
+    // so repeated lookups are cheap.  The functions themselves are
+    // required to be thread-safe, so the computations can then run
+    // concurrently.
+    _FunctionRegistry& registry = _FunctionRegistry::GetInstance();
+
+    std::vector<UsdGeomComputeExtentFunction> fns(boundables.size(), nullptr);
+    std::atomic<bool> success(true);
+    for (size_t i = 0; i < boundables.size(); ++i) {
+        if (!boundables[i]) {
+            TF_CODING_ERROR(
+                "Invalid UsdGeomBoundable %s",
+                UsdDescribe(boundables[i].GetPrim()).c_str());
+            success = false;
+            continue;
+        }
+        fns[i] = registry.GetComputeFunction(boundables[i].GetPrim());
+        if (!fns[i]) {
+            success = false;
+        }
+    }
+
+    WorkParallelForN(boundables.size(),
+        [&boundables, &fns, &extents, &time, &success](
+            size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                if (fns[i] &&
+                    !(*fns[i])(boundables[i], time, nullptr, &(*extents)[i])) {
+                    (*extents)[i].clear();
+                    success = false;
+                }
+            }
+        });
+
+    return success;
+}
+
 void
 UsdGeomRegisterComputeExtentFunction(
     const TfType& primType,
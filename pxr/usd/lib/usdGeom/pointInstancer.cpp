@@ -301,6 +301,7 @@ PXR_NAMESPACE_CLOSE_SCOPE
 
 #include "pxr/base/tf/enum.h"
 #include "pxr/base/tf/envSetting.h"
+#include "pxr/base/gf/quatd.h"
 #include "pxr/base/gf/transform.h"
 #include "pxr/usd/usdGeom/bboxCache.h"
 #include "pxr/usd/usdGeom/debugCodes.h"
@@ -1309,36 +1310,53 @@ UsdGeomPointInstancer::ComputeInstanceTransformsAtTime(
                 continue;
             }
 
-            GfTransform instanceTransform;
-
-            if (!scales.empty()) {
-                instanceTransform.SetScale(scales[instanceId]);
-            }
+            // Compose scale * rotate * translate directly rather than
+            // going through GfTransform, which builds and multiplies
+            // several intermediate matrices to support pivots that this
+            // computation never uses.
+            GfMatrix4d instanceXform(1.0);
 
             if (!orientations.empty()) {
-                GfRotation rotation = GfRotation(orientations[instanceId]);
                 if (angularVelocities.size() != 0) {
+                    GfRotation rotation = GfRotation(orientations[instanceId]);
                     GfVec3f angularVelocity = angularVelocities[instanceId];
                     rotation *= GfRotation(
                         angularVelocity,
-                        angularVelocityMultiplier * 
+                        angularVelocityMultiplier *
                             angularVelocity.GetLength());
+                    instanceXform.SetRotate(rotation);
+                } else {
+                    // Convert the quaternion directly; going through
+                    // GfRotation would round-trip through axis/angle.
+                    GfQuatd orientation(orientations[instanceId]);
+                    orientation.Normalize();
+                    instanceXform.SetRotate(orientation);
+                }
+            }
+
+            if (!scales.empty()) {
+                // Scale the rotation basis vectors in place; this is
+                // equivalent to multiplying by a scale matrix on the left
+                // without the cost of a 4x4 matrix product.
+                const GfVec3f& scale = scales[instanceId];
+                for (int j = 0; j < 3; ++j) {
+                    instanceXform[0][j] *= scale[0];
+                    instanceXform[1][j] *= scale[1];
+                    instanceXform[2][j] *= scale[2];
                 }
-                instanceTransform.SetRotation(rotation);
             }
 
             GfVec3f translation = positions[instanceId];
             if (velocities.size() != 0) {
                 translation += velocityMultiplier * velocities[instanceId];
             }
-            instanceTransform.SetTranslation(translation);
+            instanceXform.SetTranslateOnly(GfVec3d(translation));
 
             const int protoIndex = protoIndices[instanceId];
-            const GfMatrix4d &protoXform = (protoPaths.size() != 0) ? 
+            const GfMatrix4d &protoXform = (protoPaths.size() != 0) ?
                 protoXforms[protoIndex] : identity;
 
-            (*xforms)[instanceId] = protoXform * 
-                                    instanceTransform.GetMatrix();
+            (*xforms)[instanceId] = protoXform * instanceXform;
         }
     };
 
@@ -28,7 +28,9 @@
 #include "pxr/usd/usdGeom/api.h"
 #include "pxr/usd/usd/attribute.h"
 #include "pxr/usd/usdGeom/tokens.h"
+#include "pxr/base/work/loops.h"
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -569,12 +571,18 @@ public:
     
     /// Computes the flattened value of the primvar at \p time. 
     /// 
-    /// If the primvar is not indexed or if the value type of this primvar is 
-    /// a scalar, this returns the authored value, which is the same as 
-    /// \ref Get(). Hence, it's safe to call ComputeFlattened() on non-indexed 
+    /// If the primvar is not indexed or if the value type of this primvar is
+    /// a scalar, this returns the authored value, which is the same as
+    /// \ref Get(). Hence, it's safe to call ComputeFlattened() on non-indexed
     /// primvars.
+    ///
+    /// When the primvar is not indexed, or its indices are the identity
+    /// mapping over the authored values, the returned array shares the
+    /// authored array's storage rather than copying it, following VtArray's
+    /// copy-on-write semantics.  Large indexed primvars are expanded in
+    /// parallel.
     template <typename ScalarType>
-    bool ComputeFlattened(VtArray<ScalarType> * value, 
+    bool ComputeFlattened(VtArray<ScalarType> * value,
                           UsdTimeCode time = UsdTimeCode::Default()) const;
 
     /// \overload
@@ -776,9 +784,50 @@ UsdGeomPrimvar::_ComputeFlattenedHelper(const VtArray<ScalarType> &authored,
                                         const VtIntArray &indices,
                                         VtArray<ScalarType> *value) const
 {
+    // If the indices are the identity mapping over the authored values,
+    // share the authored array instead of expanding it; VtArray's
+    // copy-on-write semantics make this a zero-copy view.
+    if (indices.size() == authored.size()) {
+        bool isIdentity = true;
+        for (size_t i = 0; i < indices.size(); ++i) {
+            if (indices[i] != static_cast<int>(i)) {
+                isIdentity = false;
+                break;
+            }
+        }
+        if (isIdentity) {
+            *value = authored;
+            return true;
+        }
+    }
+
     value->resize(indices.size());
     bool success = true;
 
+    // Expand large primvars in parallel. If any invalid indices are found,
+    // fall through to the serial loop below, which collects their positions
+    // for the warning.
+    static const size_t parallelThreshold = 4096;
+    if (indices.size() >= parallelThreshold) {
+        std::atomic<size_t> numInvalidIndices(0);
+        WorkParallelForN(
+            indices.size(),
+            [&authored, &indices, value, &numInvalidIndices](
+                size_t start, size_t end) {
+                for (size_t i = start; i != end; ++i) {
+                    int index = indices[i];
+                    if (index >= 0 && (size_t)index < authored.size()) {
+                        (*value)[i] = authored[index];
+                    } else {
+                        ++numInvalidIndices;
+                    }
+                }
+            });
+        if (numInvalidIndices == 0) {
+            return true;
+        }
+    }
+
     std::vector<size_t> invalidIndexPositions;
     for (size_t i=0; i < indices.size(); i++) {
         int index = indices[i];
@@ -392,22 +392,33 @@ UsdGeomSubset::GetUnassignedIndices(
     const size_t elementCount,
     const UsdTimeCode &time /* UsdTimeCode::EarliestTime() */)
 {
-    std::set<int> assignedIndices;
+    // Track membership with a bitset rather than a sorted set; for large
+    // meshes this is linear in the number of indices instead of
+    // n-log-n, and the complement falls out of a single scan.
+    std::vector<bool> assignedIndices(elementCount, false);
+    size_t numAssigned = 0;
     for (const auto &subset : subsets) {
         VtIntArray indices;
         subset.GetIndicesAttr().Get(&indices, time);
-        assignedIndices.insert(indices.begin(), indices.end());
+        for (const int index : indices) {
+            // Indices outside [0, elementCount) can never unassign an
+            // element, so they are simply ignored here, as they were by
+            // the set-difference this replaces.
+            if (index >= 0 && static_cast<size_t>(index) < elementCount &&
+                !assignedIndices[index]) {
+                assignedIndices[index] = true;
+                ++numAssigned;
+            }
+        }
     }
-    std::vector<int> allIndices;
-    allIndices.reserve(elementCount);
-    for (size_t idx = 0 ; idx < elementCount ; ++idx) 
-        allIndices.push_back(idx);
 
     VtIntArray result;
-    result.reserve(elementCount - assignedIndices.size());
-    std::set_difference(allIndices.begin(), allIndices.end(), 
-        assignedIndices.begin(), assignedIndices.end(), 
-        std::back_inserter(result));
+    result.reserve(elementCount - numAssigned);
+    for (size_t idx = 0 ; idx < elementCount ; ++idx) {
+        if (!assignedIndices[idx]) {
+            result.push_back(idx);
+        }
+    }
 
     return result;
 }
@@ -454,15 +465,30 @@ UsdGeomSubset::ValidateSubsets(
 
     bool valid = true;
     for (const UsdTimeCode &t : allTimeCodes) {
-        std::set<int> indicesInFamily;
+        // Membership across the family is tracked with a bitset, which is
+        // linear in the number of indices; the rare indices outside
+        // [0, elementCount) go into a small sorted set on the side.
+        std::vector<bool> indicesInFamily(elementCount, false);
+        std::set<int> outOfRangeIndices;
+        size_t numUniqueIndices = 0;
 
         for (const UsdGeomSubset &subset : subsets) {
             VtIntArray subsetIndices;
             subset.GetIndicesAttr().Get(&subsetIndices, t);
 
             for (const int index : subsetIndices) {
-                if (!indicesInFamily.insert(index).second &&
-                    familyType != UsdGeomTokens->unrestricted) 
+                bool inserted = false;
+                if (index >= 0 &&
+                    static_cast<size_t>(index) < elementCount) {
+                    if (!indicesInFamily[index]) {
+                        indicesInFamily[index] = true;
+                        ++numUniqueIndices;
+                        inserted = true;
+                    }
+                } else {
+                    inserted = outOfRangeIndices.insert(index).second;
+                }
+                if (!inserted && familyType != UsdGeomTokens->unrestricted)
                 {
                     valid = false;
                     if (reason) {
@@ -476,26 +502,27 @@ UsdGeomSubset::ValidateSubsets(
 
         // Make sure every index appears exactly once if it's a partition.
         if (familyType == UsdGeomTokens->partition &&
-            indicesInFamily.size() != elementCount) {
+            numUniqueIndices + outOfRangeIndices.size() != elementCount) {
             valid = false;
             if (reason) {
                 *reason += TfStringPrintf("Number of unique indices at time %s "
-                    "does not match the element count %ld.", 
+                    "does not match the element count %ld.",
                     TfStringify(t).c_str(), elementCount);
             }
         }
 
-        // Ensure that the indices are in the range [0, faceCount).
-        if (elementCount > 0 && 
-            static_cast<size_t>(*indicesInFamily.rbegin()) >= elementCount) {
+        // Ensure that the indices are in the range [0, elementCount). By
+        // construction, only out-of-range indices can violate this.
+        if (elementCount > 0 && !outOfRangeIndices.empty() &&
+            *outOfRangeIndices.rbegin() >= 0) {
             valid = false;
             if (reason) {
                 *reason += TfStringPrintf("Found one or more indices that are "
-                    "greater than the element count %ld at time %s.\n", 
+                    "greater than the element count %ld at time %s.\n",
                     elementCount, TfStringify(t).c_str());
             }
         }
-        if (*indicesInFamily.begin() < 0) {
+        if (!outOfRangeIndices.empty() && *outOfRangeIndices.begin() < 0) {
             valid = false;
             if (reason) {
                 *reason += TfStringPrintf("Found one or more indices that are "
@@ -563,52 +590,63 @@ UsdGeomSubset::ValidateFamily(
     }
 
     for (const UsdTimeCode &t : allTimeCodes) {
-        std::set<int> indicesInFamily;
+        // As in ValidateSubsets(), track membership with a bitset and keep
+        // the rare out-of-range indices in a small sorted set on the side.
+        std::vector<bool> indicesInFamily(faceCount, false);
+        std::set<int> outOfRangeIndices;
+        size_t numUniqueIndices = 0;
 
         for (const UsdGeomSubset &subset : familySubsets) {
             VtIntArray subsetIndices;
             subset.GetIndicesAttr().Get(&subsetIndices, t);
-            if (!familyIsRestricted) {
-                indicesInFamily.insert(subsetIndices.begin(), subsetIndices.end());
-            } else {
-                for (const int index : subsetIndices) {
-                    if (!indicesInFamily.insert(index).second) {
-                        valid = false;
-                        if (reason) {
-                            *reason += TfStringPrintf("Found duplicate index %d "
-                                "in GeomSubset at path <%s>.\n", index,
-                                subset.GetPath().GetText());
-                        }
+            for (const int index : subsetIndices) {
+                bool inserted = false;
+                if (index >= 0 && static_cast<size_t>(index) < faceCount) {
+                    if (!indicesInFamily[index]) {
+                        indicesInFamily[index] = true;
+                        ++numUniqueIndices;
+                        inserted = true;
+                    }
+                } else {
+                    inserted = outOfRangeIndices.insert(index).second;
+                }
+                if (!inserted && familyIsRestricted) {
+                    valid = false;
+                    if (reason) {
+                        *reason += TfStringPrintf("Found duplicate index %d "
+                            "in GeomSubset at path <%s>.\n", index,
+                            subset.GetPath().GetText());
                     }
                 }
             }
         }
 
         // Make sure every index appears exactly once if it's a partition.
-        if (familyType == UsdGeomTokens->partition && 
-            indicesInFamily.size() != faceCount) 
+        if (familyType == UsdGeomTokens->partition &&
+            numUniqueIndices + outOfRangeIndices.size() != faceCount)
         {
             valid = false;
             if (reason) {
                 *reason += TfStringPrintf("Number of unique indices at time %s "
-                    "does not match the face count %ld.", 
+                    "does not match the face count %ld.",
                     TfStringify(t).c_str(), faceCount);
             }
         }
 
         // Make sure the indices are valid and don't exceed the faceCount.
-        if (faceCount > 0 && 
-            static_cast<size_t>(*indicesInFamily.rbegin()) >= faceCount) {
+        // By construction, only out-of-range indices can violate this.
+        if (faceCount > 0 && !outOfRangeIndices.empty() &&
+            *outOfRangeIndices.rbegin() >= 0) {
             valid = false;
             if (reason) {
                 *reason += TfStringPrintf("Found one or more indices that are "
-                    "greater than the face-count %ld at time %s.\n", 
+                    "greater than the face-count %ld at time %s.\n",
                     faceCount, TfStringify(t).c_str());
             }
         }
 
         // Ensure there are no negative indices.
-        if (*indicesInFamily.begin() < 0) {
+        if (!outOfRangeIndices.empty() && *outOfRangeIndices.begin() < 0) {
             valid = false;
             if (reason) {
                 *reason += TfStringPrintf("Found one or more indices that are "
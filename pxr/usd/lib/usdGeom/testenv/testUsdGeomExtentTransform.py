@@ -373,6 +373,30 @@ class TestUsdGeomExtentTransform(unittest.TestCase):
              (5.236589431762695, 4.420092582702637, 2.4111881256103516)],
             STRANGE_TRANSFORM)
 
+    def test_ComputeExtentsFromPlugins(self):
+        stage = Usd.Stage.CreateInMemory()
+
+        sphere = UsdGeom.Sphere.Define(stage, "/Sphere")
+        sphere.CreateRadiusAttr(2.0)
+        cube = UsdGeom.Cube.Define(stage, "/Cube")
+        cube.CreateSizeAttr(3.0)
+        points = UsdGeom.Points.Define(stage, "/Points")
+        points.CreatePointsAttr(
+            Vt.Vec3fArray([(0, 0, 0), (1, 2, 3), (-1, -2, -3)]))
+
+        boundables = [UsdGeom.Boundable(p.GetPrim())
+                      for p in (sphere, cube, points)]
+        extents = UsdGeom.Boundable.ComputeExtentsFromPlugins(
+            boundables, Usd.TimeCode.Default())
+
+        # The bulk computation must match per-prim computation.
+        self.assertEqual(len(extents), len(boundables))
+        for boundable, extent in zip(boundables, extents):
+            self.assertExtentsEqual(
+                extent,
+                UsdGeom.Boundable.ComputeExtentFromPlugins(
+                    boundable, Usd.TimeCode.Default()))
+
 
 if __name__ == "__main__":
     unittest.main()
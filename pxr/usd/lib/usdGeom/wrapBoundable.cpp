@@ -133,6 +133,23 @@ _ComputeExtentFromPlugins(
     return object(extent);
 }
 
+static object
+_ComputeExtentsFromPlugins(
+    const std::vector<UsdGeomBoundable> &boundables,
+    const UsdTimeCode &time)
+{
+    std::vector<VtVec3fArray> extents;
+    UsdGeomBoundable::ComputeExtentsFromPlugins(boundables, time, &extents);
+
+    // A successfully computed extent always has two elements, so report
+    // failed entries as None.
+    boost::python::list result;
+    for (const VtVec3fArray &extent : extents) {
+        result.append(extent.empty() ? object() : object(extent));
+    }
+    return result;
+}
+
 static object
 _ComputeExtentFromPluginsWithTransform(
     const UsdGeomBoundable &boundable,
@@ -156,7 +173,13 @@ WRAP_CUSTOM {
         .def("ComputeExtentFromPlugins", &_ComputeExtentFromPluginsWithTransform,
              (arg("boundable"), arg("time"), arg("transform")))
         .staticmethod("ComputeExtentFromPlugins")
+
+        .def("ComputeExtentsFromPlugins", &_ComputeExtentsFromPlugins,
+             (arg("boundables"), arg("time")))
+        .staticmethod("ComputeExtentsFromPlugins")
     ;
+
+    TfPyRegisterStlSequencesFromPython<UsdGeomBoundable>();
 }
 
 } // anonymous namespace 
@@ -28,6 +28,10 @@
 #include "pxr/base/trace/trace.h"
 
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/hashset.h"
+#include "pxr/base/work/loops.h"
+
+#include <algorithm>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -57,7 +61,84 @@ UsdGeomXformCache::GetParentToWorldTransform(const UsdPrim& prim)
     return *_GetCtm(prim.GetParent());
 }
 
-bool 
+void
+UsdGeomXformCache::ComputeLocalToWorldTransforms(
+    const std::vector<UsdPrim>& prims,
+    std::vector<GfMatrix4d>* xforms)
+{
+    TRACE_FUNCTION();
+
+    if (!xforms) {
+        TF_CODING_ERROR("'xforms' pointer is null.");
+        return;
+    }
+
+    // Gather the prims whose ctms are not yet cached, along with their
+    // uncached ancestors. Entries must be created serially, since the
+    // cache map is not concurrent; entry pointers remain stable across
+    // subsequent insertions.
+    struct _WorkItem {
+        UsdPrim prim;
+        _Entry* entry;
+        GfMatrix4d localXform;
+        bool resetsXformStack;
+    };
+    std::vector<_WorkItem> workItems;
+    TfHashSet<UsdPrim, boost::hash<UsdPrim> > seenPrims;
+    for (const UsdPrim& requestedPrim : prims) {
+        for (UsdPrim p = requestedPrim; p; p = p.GetParent()) {
+            if (!seenPrims.insert(p).second) {
+                break;
+            }
+            _Entry* entry = _GetCacheEntryForPrim(p);
+            if (entry->ctmIsValid) {
+                break;
+            }
+            workItems.push_back({p, entry, GfMatrix4d(1.), false});
+            if (entry->query.GetResetXformStack()) {
+                // Ancestor transforms do not contribute to this subtree.
+                break;
+            }
+        }
+    }
+
+    // Evaluate the local transformations in parallel. This reads attribute
+    // values but does not touch the cache map.
+    WorkParallelForN(
+        workItems.size(),
+        [this, &workItems](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                _WorkItem& item = workItems[i];
+                item.entry->query.GetLocalTransformation(
+                    &item.localXform, _time);
+                item.resetsXformStack =
+                    item.entry->query.GetResetXformStack();
+            }
+        });
+
+    // Combine local transformations in depth order so that each prim's
+    // parent ctm has been cached by the time the prim is processed.
+    std::sort(workItems.begin(), workItems.end(),
+              [](const _WorkItem& a, const _WorkItem& b) {
+                  return a.prim.GetPath().GetPathElementCount() <
+                         b.prim.GetPath().GetPathElementCount();
+              });
+
+    for (_WorkItem& item : workItems) {
+        item.entry->ctm = item.resetsXformStack
+            ? item.localXform
+            : item.localXform * (*_GetCtm(item.prim.GetParent()));
+        item.entry->ctmIsValid = true;
+    }
+
+    // All requested ctms are now cached.
+    xforms->resize(prims.size());
+    for (size_t i = 0, n = prims.size(); i != n; ++i) {
+        (*xforms)[i] = *_GetCtm(prims[i]);
+    }
+}
+
+bool
 UsdGeomXformCache::TransformMightBeTimeVarying(const UsdPrim &prim)
 {
     // Get or create an entry for the prim in the CTM cache. 
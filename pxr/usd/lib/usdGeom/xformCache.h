@@ -82,6 +82,22 @@ public:
     USDGEOM_API
     GfMatrix4d GetParentToWorldTransform(const UsdPrim& prim);
 
+    /// Compute the local-to-world transformation matrices for all of the
+    /// prims in \p prims, filling \p xforms such that (*xforms)[i] holds
+    /// the transform for prims[i].
+    ///
+    /// This produces the same results as calling GetLocalToWorldTransform()
+    /// on each prim in turn, but evaluates the local transformations of all
+    /// uncached prims and their ancestors in parallel before combining them
+    /// in depth order, which is substantially faster for large batches.
+    /// All intermediate values are cached, as with the one-at-a-time API.
+    ///
+    /// \note This method mutates internal cache state and is not thread
+    /// safe.
+    USDGEOM_API
+    void ComputeLocalToWorldTransforms(const std::vector<UsdPrim>& prims,
+                                       std::vector<GfMatrix4d>* xforms);
+
     /// Returns the local transformation of the prim. Uses the cached 
     /// XformQuery to compute the result quickly. The \p resetsXformStack
     /// pointer must be valid. It will be set to true if \p prim resets
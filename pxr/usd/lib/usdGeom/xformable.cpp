@@ -142,6 +142,7 @@ PXR_NAMESPACE_CLOSE_SCOPE
 // --(BEGIN CUSTOM CODE)--
 
 #include "pxr/base/tf/envSetting.h"
+#include "pxr/base/work/loops.h"
 
 #include <algorithm>
 
@@ -520,19 +521,79 @@ UsdGeomXformable::_GetOrderedXformOps(bool *resetsXformStack,
     return result;
 }
 
+static bool
+_AreInverseXformOps(const UsdGeomXformOp &a, const UsdGeomXformOp &b);
+
 UsdGeomXformable::XformQuery::XformQuery(const UsdGeomXformable &xformable):
     _resetsXformStack(false)
 {
     _xformOps = xformable._GetOrderedXformOps(
         &_resetsXformStack, /*withAttributeQueries=*/true);
+
+    // Bake the execution plan: the ops in application order, with pairs of
+    // ops that are inverses of each other elided, so that evaluation doesn't
+    // have to re-examine the op order on every call.
+    _evalPlan.reserve(_xformOps.size());
+    for (size_t i = _xformOps.size(); i-- > 0; ) {
+        if (i > 0 && _AreInverseXformOps(_xformOps[i], _xformOps[i-1])) {
+            --i;
+            continue;
+        }
+        _evalPlan.push_back(i);
+    }
 }
 
-bool 
+// Evaluates a baked execution plan produced by XformQuery's constructor.
+static GfMatrix4d
+_EvaluatePlan(
+    const vector<UsdGeomXformOp> &xformOps,
+    const vector<size_t> &evalPlan,
+    const UsdTimeCode time)
+{
+    GfMatrix4d xform(1.);
+    for (size_t opIndex : evalPlan) {
+        GfMatrix4d opTransform = xformOps[opIndex].GetOpTransform(time);
+        // Avoid multiplying by the identity matrix when possible.
+        if (opTransform != *_IDENTITY) {
+            xform *= opTransform;
+        }
+    }
+    return xform;
+}
+
+bool
 UsdGeomXformable::XformQuery::GetLocalTransformation(
     GfMatrix4d *transform,
-    const UsdTimeCode time) const 
+    const UsdTimeCode time) const
+{
+    if (!transform) {
+        TF_CODING_ERROR("'transform' pointer is NULL.");
+        return false;
+    }
+    *transform = _EvaluatePlan(_xformOps, _evalPlan, time);
+    return true;
+}
+
+bool
+UsdGeomXformable::XformQuery::GetLocalTransformations(
+    vector<GfMatrix4d> *transforms,
+    const std::vector<UsdTimeCode> &times) const
 {
-    return UsdGeomXformable::GetLocalTransformation(transform, _xformOps, time);
+    TRACE_FUNCTION();
+
+    if (!transforms) {
+        TF_CODING_ERROR("'transforms' pointer is NULL.");
+        return false;
+    }
+    transforms->resize(times.size());
+    WorkParallelForN(times.size(),
+        [this, transforms, &times](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                (*transforms)[i] = _EvaluatePlan(_xformOps, _evalPlan,
+                                                 times[i]);
+            }
+        });
+    return true;
 }
 
 static
@@ -392,6 +392,16 @@ public:
             bool GetLocalTransformation(GfMatrix4d *transform,
                                         const UsdTimeCode time) const;
 
+            /// Computes the transform value at each time in \p times,
+            /// resizing \p transforms to match. The samples are evaluated
+            /// in parallel, so this is more efficient than calling
+            /// GetLocalTransformation() once per time when evaluating many
+            /// samples (e.g., when exporting a clip or baking animation).
+            USDGEOM_API
+            bool GetLocalTransformations(std::vector<GfMatrix4d> *transforms,
+                                         const std::vector<UsdTimeCode> &times)
+                                         const;
+
             /// Returns whether the xformable resets its parent's transformation.
             bool GetResetXformStack() const { 
                 return _resetsXformStack;
@@ -426,6 +436,12 @@ public:
             // Cached copy of the vector of ordered xform ops.
             std::vector<UsdGeomXformOp> _xformOps;
 
+            // Indices into _xformOps in application order, with pairs of
+            // ops that cancel each other out elided. Baked once at
+            // construction so that evaluation is a flat loop that doesn't
+            // have to re-examine the op order.
+            std::vector<size_t> _evalPlan;
+
             // Cache whether the xformable has !resetsXformStack! in its
             // xformOpOrder.
             bool _resetsXformStack;
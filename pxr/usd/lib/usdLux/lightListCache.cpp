@@ -0,0 +1,116 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/usd/usdLux/lightListCache.h"
+
+#include "pxr/usd/usdLux/listAPI.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/trace/trace.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+UsdLuxLightListCache::UsdLuxLightListCache(const UsdStageWeakPtr &stage)
+    : _stage(stage)
+{
+    if (!stage) {
+        TF_CODING_ERROR("Invalid stage");
+        return;
+    }
+    _objectsChangedNoticeKey =
+        TfNotice::Register(TfCreateWeakPtr(this),
+                           &UsdLuxLightListCache::_OnObjectsChanged, stage);
+    // Everything is dirty until the first query.
+    _dirtySubtrees.push_back(SdfPath::AbsoluteRootPath());
+}
+
+UsdLuxLightListCache::~UsdLuxLightListCache()
+{
+    TfNotice::Revoke(_objectsChangedNoticeKey);
+}
+
+void
+UsdLuxLightListCache::_OnObjectsChanged(
+    const UsdNotice::ObjectsChanged &notice,
+    const UsdStageWeakPtr &sender)
+{
+    // Only resyncs can add or remove lights; info-only changes cannot
+    // affect which prims exist or their types.  A resynced property
+    // conservatively dirties its owning prim's subtree.
+    for (const SdfPath &path: notice.GetResyncedPaths()) {
+        _dirtySubtrees.push_back(path.GetPrimPath());
+    }
+}
+
+bool
+UsdLuxLightListCache::_IsSubtreeReachable(const UsdPrim &prim) const
+{
+    // Mirror the traversal predicate used by ComputeLightList(): a
+    // subtree is only discovered if the prim and all of its ancestors
+    // are active, non-abstract, and defined.
+    for (UsdPrim p = prim; p && !p.IsPseudoRoot(); p = p.GetParent()) {
+        if (!p.IsActive() || p.IsAbstract() || !p.IsDefined()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const SdfPathSet &
+UsdLuxLightListCache::ComputeLightList()
+{
+    TRACE_FUNCTION();
+
+    if (!_stage) {
+        _lightList.clear();
+        return _lightList;
+    }
+    if (_dirtySubtrees.empty()) {
+        return _lightList;
+    }
+
+    SdfPathVector dirty;
+    dirty.swap(_dirtySubtrees);
+    SdfPath::RemoveDescendentPaths(&dirty);
+
+    for (const SdfPath &path: dirty) {
+        // Drop cached entries at or below the dirty subtree.
+        auto it = _lightList.lower_bound(path);
+        while (it != _lightList.end() && it->HasPrefix(path)) {
+            it = _lightList.erase(it);
+        }
+        // Re-traverse the subtree if it still exists and is reachable
+        // from the pseudo-root.
+        UsdPrim prim = (path == SdfPath::AbsoluteRootPath())
+            ? _stage->GetPseudoRoot()
+            : _stage->GetPrimAtPath(path);
+        if (prim && _IsSubtreeReachable(prim)) {
+            SdfPathSet subtreeLights = UsdLuxListAPI(prim)
+                .ComputeLightList(UsdLuxListAPI::ComputeModeIgnoreCache);
+            _lightList.insert(subtreeLights.begin(), subtreeLights.end());
+        }
+    }
+    return _lightList;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
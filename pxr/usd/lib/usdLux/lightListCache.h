@@ -0,0 +1,94 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef USDLUX_LIGHT_LIST_CACHE_H
+#define USDLUX_LIGHT_LIST_CACHE_H
+
+/// \file usdLux/lightListCache.h
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usdLux/api.h"
+#include "pxr/usd/usd/notice.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/base/tf/notice.h"
+#include "pxr/base/tf/weakBase.h"
+
+#include <boost/noncopyable.hpp>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdLuxLightListCache
+///
+/// Maintains the set of paths to light and light filter prims on a
+/// stage, so that clients that need the light list repeatedly do not
+/// have to re-walk the stage each time they need it.
+///
+/// The cached list matches what
+/// UsdLuxListAPI::ComputeLightList(ComputeModeIgnoreCache) returns when
+/// invoked on the stage's pseudo-root.  The cache listens for
+/// UsdNotice::ObjectsChanged; resynced subtrees are marked dirty and
+/// re-traversed, in parallel, on the next call to ComputeLightList().
+/// Unchanged portions of the stage are not revisited.
+///
+/// This class is not safe to use concurrently from multiple threads.
+///
+class UsdLuxLightListCache : public TfWeakBase, boost::noncopyable
+{
+public:
+    /// Construct a cache for the given stage.  The cache registers for
+    /// change notification and remains valid for the stage's lifetime.
+    USDLUX_API
+    explicit UsdLuxLightListCache(const UsdStageWeakPtr &stage);
+
+    USDLUX_API
+    ~UsdLuxLightListCache();
+
+    /// Returns the stage whose light list this cache maintains.
+    UsdStageWeakPtr GetStage() const { return _stage; }
+
+    /// Returns the paths to all lights and light filters on the stage,
+    /// updating any portions of the cached list invalidated by changes
+    /// since the last call.  The returned reference is valid until the
+    /// next call to ComputeLightList() or the cache is destroyed.
+    USDLUX_API
+    const SdfPathSet &ComputeLightList();
+
+private:
+    // Notice listener; records resynced subtrees for lazy recompute.
+    void _OnObjectsChanged(const UsdNotice::ObjectsChanged &notice,
+                           const UsdStageWeakPtr &sender);
+
+    // Returns true if a stage traversal rooted at the pseudo-root
+    // would reach \p prim.
+    bool _IsSubtreeReachable(const UsdPrim &prim) const;
+
+    UsdStageWeakPtr _stage;
+    TfNotice::Key _objectsChangedNoticeKey;
+    SdfPathSet _lightList;
+    SdfPathVector _dirtySubtrees;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
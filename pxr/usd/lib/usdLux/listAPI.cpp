@@ -171,6 +171,9 @@ PXR_NAMESPACE_CLOSE_SCOPE
 #include "pxr/usd/usd/primRange.h"
 #include "pxr/usd/usdLux/light.h"
 #include "pxr/usd/usdLux/lightFilter.h"
+#include "pxr/base/work/dispatcher.h"
+
+#include <tbb/concurrent_vector.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -185,7 +188,8 @@ TF_REGISTRY_FUNCTION(TfEnum)
 static void
 _Traverse(const UsdPrim &prim,
           UsdLuxListAPI::ComputeMode mode,
-          SdfPathSet *lights)
+          WorkDispatcher *dispatcher,
+          tbb::concurrent_vector<SdfPath> *lights)
 {
     // If requested, check lightList cache.
     if (mode == UsdLuxListAPI::ComputeModeConsultModelHierarchyCache &&
@@ -199,7 +203,7 @@ _Traverse(const UsdPrim &prim,
                 UsdRelationship rel = listAPI.GetLightListRel();
                 SdfPathVector targets;
                 rel.GetForwardedTargets(&targets);
-                lights->insert(targets.begin(), targets.end());
+                lights->grow_by(targets.begin(), targets.end());
                 if (cacheBehavior == UsdLuxTokens->consumeAndHalt) {
                     return;
                 }
@@ -208,9 +212,9 @@ _Traverse(const UsdPrim &prim,
     }
     // Accumulate discovered prims.
     if (prim.IsA<UsdLuxLight>() || prim.IsA<UsdLuxLightFilter>()) {
-        lights->insert(prim.GetPath());
+        lights->push_back(prim.GetPath());
     }
-    // Traverse descendants.
+    // Traverse descendants, dispatching a task per child subtree.
     auto flags = UsdPrimIsActive && !UsdPrimIsAbstract && UsdPrimIsDefined;
     if (mode == UsdLuxListAPI::ComputeModeConsultModelHierarchyCache) {
         // When consulting the cache we only traverse model hierarchy.
@@ -218,16 +222,23 @@ _Traverse(const UsdPrim &prim,
     }
     for (const UsdPrim &child:
          prim.GetFilteredChildren(UsdTraverseInstanceProxies(flags))) {
-        _Traverse(child, mode, lights);
+        dispatcher->Run([child, mode, dispatcher, lights]() {
+            _Traverse(child, mode, dispatcher, lights);
+        });
     }
 }
 
 SdfPathSet
 UsdLuxListAPI::ComputeLightList(UsdLuxListAPI::ComputeMode mode) const
 {
-    SdfPathSet result;
-    _Traverse(GetPrim(), mode, &result);
-    return result;
+    // Light discovery only reads the stage, so each subtree can be
+    // traversed concurrently; gather into an unordered concurrent
+    // vector and sort the results into a set afterwards.
+    tbb::concurrent_vector<SdfPath> lights;
+    WorkDispatcher dispatcher;
+    _Traverse(GetPrim(), mode, &dispatcher, &lights);
+    dispatcher.Wait();
+    return SdfPathSet(lights.begin(), lights.end());
 }
 
 void
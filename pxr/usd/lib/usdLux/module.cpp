@@ -52,4 +52,6 @@ TF_WRAP_MODULE
     TF_WRAP(UsdLuxShadowAPI);
     TF_WRAP(UsdLuxLightFilter);
     TF_WRAP(UsdLuxLightPortal);
+
+    TF_WRAP(UsdLuxLightListCache);
 }
@@ -97,5 +97,44 @@ class TestUsdLuxListAPI(unittest.TestCase):
         # discard changes
         stage.Reload()
 
+    def test_LightListCache(self):
+        stage = Usd.Stage.CreateInMemory()
+        cache = UsdLux.LightListCache(stage)
+        self.assertEqual(cache.GetStage(), stage)
+        ignore = UsdLux.ListAPI.ComputeModeIgnoreCache
+
+        def checkCache():
+            expected = UsdLux.ListAPI(
+                stage.GetPseudoRoot()).ComputeLightList(ignore)
+            self.assertEqual(set(cache.ComputeLightList()), set(expected))
+
+        # empty stage
+        checkCache()
+
+        # populate lights and a light filter
+        UsdGeom.Xform.Define(stage, '/World')
+        UsdLux.SphereLight.Define(stage, '/World/Sphere')
+        UsdLux.LightFilter.Define(stage, '/World/Filter')
+        UsdLux.DomeLight.Define(stage, '/Env/Dome')
+        checkCache()
+        self.assertEqual(len(cache.ComputeLightList()), 3)
+
+        # add a light under a subtree the cache has already visited
+        UsdLux.RectLight.Define(stage, '/World/Rect')
+        checkCache()
+
+        # deactivating a subtree drops its lights from the list
+        stage.GetPrimAtPath('/World').SetActive(False)
+        checkCache()
+        self.assertEqual(set(cache.ComputeLightList()),
+                         set([Sdf.Path('/Env/Dome')]))
+        stage.GetPrimAtPath('/World').SetActive(True)
+        checkCache()
+
+        # removing a light is tracked
+        stage.RemovePrim('/Env/Dome')
+        checkCache()
+        self.assertEqual(len(cache.ComputeLightList()), 3)
+
 if __name__ == "__main__":
     unittest.main()
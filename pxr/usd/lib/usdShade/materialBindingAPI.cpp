@@ -122,9 +122,15 @@ PXR_NAMESPACE_CLOSE_SCOPE
 // ===================================================================== //
 // --(BEGIN CUSTOM CODE)--
 
+#include "pxr/usd/usd/primRange.h"
+
 #include "pxr/base/tf/envSetting.h"
+#include "pxr/base/work/dispatcher.h"
 #include "pxr/base/work/loops.h"
 
+#include <algorithm>
+#include <memory>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_PRIVATE_TOKENS(
@@ -815,14 +821,14 @@ UsdShadeMaterialBindingAPI::ComputeBoundMaterials(
     // MembershipQuery object is only constructed once.
     CollectionQueryCache collQueryCache;
 
-    WorkParallelForN(prims.size(), 
+    WorkParallelForN(prims.size(),
         [&](size_t start, size_t end) {
             for (size_t i = start; i < end; ++i) {
                 const UsdPrim &prim = prims[i];
-                UsdRelationship *bindingRel = 
+                UsdRelationship *bindingRel =
                         bindingRels ? &((*bindingRels)[i]) : nullptr;
                 materials[i] = UsdShadeMaterialBindingAPI(prim).
-                    ComputeBoundMaterial(&bindingsCache, &collQueryCache, 
+                    ComputeBoundMaterial(&bindingsCache, &collQueryCache,
                                          materialPurpose, bindingRel);
             }
         });
@@ -830,6 +836,313 @@ UsdShadeMaterialBindingAPI::ComputeBoundMaterials(
     return materials;
 }
 
+namespace {
+
+// The bindings authored at one ancestor prim that are relevant to a single
+// material purpose, carried down the subtree walk performed by
+// ComputeBoundMaterialsForSubtree.  Each collection binding also carries
+// the membership rule of the prim currently being visited, resolved
+// incrementally from the parent prim's rule.
+struct _AncestorCollBinding {
+    const UsdShadeMaterialBindingAPI::CollectionBinding *binding;
+    const UsdCollectionAPI::MembershipQuery *membershipQuery;
+    TfToken resolvedRule;
+    bool strongerThanDescendants;
+};
+
+struct _AncestorBindings {
+    const UsdShadeMaterialBindingAPI::DirectBinding *directBinding = nullptr;
+    bool directStrongerThanDescendants = false;
+
+    // In native property order; the earlier bindings are stronger.
+    std::vector<_AncestorCollBinding> collBindings;
+};
+
+// The binding state inherited by a prim for one purpose: the relevant
+// bindings at each ancestor (and the prim itself), root-most first.
+struct _PurposeBindingStack {
+    TfToken purpose;
+    std::vector<_AncestorBindings> levels;
+};
+
+using _BindingState = std::vector<_PurposeBindingStack>;
+
+// Resolves bound materials for a whole subtree top-down, spawning one
+// dispatcher task per prim.  Each prim inherits its parent's binding state
+// and only has to inspect its own binding properties and update the
+// membership rule of each inherited collection binding, both of which are
+// constant-time; the per-prim ancestor walk that ComputeBoundMaterial
+// performs is never repeated.
+class _SubtreeBindingResolver {
+public:
+    _SubtreeBindingResolver(
+        UsdShadeMaterialBindingAPI::BindingsCache *bindingsCache,
+        UsdShadeMaterialBindingAPI::CollectionQueryCache *collectionQueryCache,
+        UsdShadeMaterialBindingAPI::BoundMaterialMap *boundMaterials,
+        const TfToken &materialPurpose,
+        const Usd_PrimFlagsPredicate &predicate)
+        : _bindingsCache(bindingsCache)
+        , _collectionQueryCache(collectionQueryCache)
+        , _boundMaterials(boundMaterials)
+        , _materialPurpose(materialPurpose)
+        , _predicate(predicate)
+    {
+        _materialPurposes.push_back(materialPurpose);
+        if (materialPurpose != UsdShadeTokens->allPurpose) {
+            _materialPurposes.push_back(UsdShadeTokens->allPurpose);
+        }
+    }
+
+    void Run(const UsdPrim &root) {
+        // Honor the predicate for the root itself, like UsdPrimRange does.
+        if (!root.IsPseudoRoot() && UsdPrimRange(root, _predicate).empty()) {
+            return;
+        }
+        auto seedState =
+            std::make_shared<const _BindingState>(_MakeSeedState(root));
+        _dispatcher.Run([this, root, seedState]() {
+            _Resolve(root, seedState);
+        });
+        _dispatcher.Wait();
+    }
+
+private:
+    const UsdShadeMaterialBindingAPI::BindingsAtPrim &
+    _GetBindingsAtPrim(const UsdPrim &prim) {
+        auto bindingsIt = _bindingsCache->find(prim.GetPath());
+        if (bindingsIt == _bindingsCache->end()) {
+            std::unique_ptr<UsdShadeMaterialBindingAPI::BindingsAtPrim>
+                bindingsAtP(new UsdShadeMaterialBindingAPI::BindingsAtPrim(
+                    prim, _materialPurpose));
+
+            // XXX: emplace does not work here due to a tbb bug.
+            // see https://software.intel.com/en-us/forums/
+            // intel-threading-building-blocks/topic/671548
+            bindingsIt = _bindingsCache->insert(std::make_pair(
+                prim.GetPath(), std::move(bindingsAtP))).first;
+        }
+        return *bindingsIt->second;
+    }
+
+    const UsdCollectionAPI::MembershipQuery *
+    _GetMembershipQuery(
+        const UsdShadeMaterialBindingAPI::CollectionBinding &collBinding) {
+        const SdfPath &collectionPath = collBinding.GetCollectionPath();
+        auto collIt = _collectionQueryCache->find(collectionPath);
+        if (collIt == _collectionQueryCache->end()) {
+            std::unique_ptr<UsdCollectionAPI::MembershipQuery> mQuery(
+                new UsdCollectionAPI::MembershipQuery);
+            collBinding.GetCollection().ComputeMembershipQuery(mQuery.get());
+
+            // XXX: emplace does not work here due to a tbb bug.
+            // see https://software.intel.com/en-us/forums/
+            // intel-threading-building-blocks/topic/671548
+            collIt = _collectionQueryCache->insert(std::make_pair(
+                collectionPath, std::move(mQuery))).first;
+        }
+        return collIt->second.get();
+    }
+
+    // Appends the purpose-relevant bindings authored on \p prim to
+    // \p state, resolving each collection binding's membership rule at
+    // \p pathForRules with the full ancestor walk.
+    void _AppendBindingsAtPrim(const UsdPrim &prim,
+                               const SdfPath &pathForRules,
+                               _BindingState *state) {
+        const UsdShadeMaterialBindingAPI::BindingsAtPrim &bindingsAtPrim =
+            _GetBindingsAtPrim(prim);
+
+        for (_PurposeBindingStack &stack : *state) {
+            _AncestorBindings level;
+
+            const UsdShadeMaterialBindingAPI::DirectBindingPtr
+                &directBindingPtr = bindingsAtPrim.directBinding;
+            if (directBindingPtr &&
+                directBindingPtr->GetMaterialPurpose() == stack.purpose) {
+                level.directBinding = directBindingPtr.get();
+                level.directStrongerThanDescendants =
+                    UsdShadeMaterialBindingAPI::GetMaterialBindingStrength(
+                        directBindingPtr->GetBindingRel()) ==
+                    UsdShadeTokens->strongerThanDescendants;
+            }
+
+            const UsdShadeMaterialBindingAPI::CollectionBindingVector
+                &collBindings =
+                    stack.purpose == UsdShadeTokens->allPurpose
+                    ? bindingsAtPrim.allPurposeCollBindings
+                    : bindingsAtPrim.restrictedPurposeCollBindings;
+            for (const UsdShadeMaterialBindingAPI::CollectionBinding
+                     &collBinding : collBindings) {
+                const UsdCollectionAPI::MembershipQuery *membershipQuery =
+                    _GetMembershipQuery(collBinding);
+                TfToken resolvedRule = UsdTokens->exclude;
+                membershipQuery->IsPathIncluded(pathForRules, &resolvedRule);
+                level.collBindings.push_back({
+                    &collBinding, membershipQuery, resolvedRule,
+                    UsdShadeMaterialBindingAPI::GetMaterialBindingStrength(
+                        collBinding.GetBindingRel()) ==
+                    UsdShadeTokens->strongerThanDescendants});
+            }
+
+            if (level.directBinding || !level.collBindings.empty()) {
+                stack.levels.push_back(std::move(level));
+            }
+        }
+    }
+
+    // Builds the binding state inherited by \p root from its ancestors.
+    // This is the only place the ancestor chain is walked, and it is
+    // walked exactly once per subtree resolution.
+    _BindingState _MakeSeedState(const UsdPrim &root) {
+        _BindingState state;
+        state.reserve(_materialPurposes.size());
+        for (const TfToken &purpose : _materialPurposes) {
+            state.push_back({purpose, {}});
+        }
+
+        std::vector<UsdPrim> ancestors;
+        for (UsdPrim p = root.GetParent(); p && !p.IsPseudoRoot();
+             p = p.GetParent()) {
+            ancestors.push_back(p);
+        }
+        std::reverse(ancestors.begin(), ancestors.end());
+
+        // Seed rules are resolved at the root's parent path; _Resolve
+        // advances them to the root itself.
+        const SdfPath parentPath = root.GetPath().GetParentPath();
+        for (const UsdPrim &ancestor : ancestors) {
+            _AppendBindingsAtPrim(ancestor, parentPath, &state);
+        }
+        return state;
+    }
+
+    void _Resolve(const UsdPrim &prim,
+                  const std::shared_ptr<const _BindingState> &parentState) {
+        std::shared_ptr<const _BindingState> childState = parentState;
+
+        // The pseudo-root cannot bind materials and is never resolved;
+        // bindings are only considered from the prims below it.
+        if (!prim.IsPseudoRoot()) {
+            auto state = std::make_shared<_BindingState>(*parentState);
+            const SdfPath &path = prim.GetPath();
+
+            // Advance the membership rule of every inherited collection
+            // binding from the parent prim's path to this prim's path.
+            for (_PurposeBindingStack &stack : *state) {
+                for (_AncestorBindings &level : stack.levels) {
+                    for (_AncestorCollBinding &coll : level.collBindings) {
+                        TfToken rule = UsdTokens->exclude;
+                        coll.membershipQuery->IsPathIncluded(
+                            path, coll.resolvedRule, &rule);
+                        coll.resolvedRule = rule;
+                    }
+                }
+            }
+
+            _AppendBindingsAtPrim(prim, path, state.get());
+            (*_boundMaterials)[path] = _ComputeWinningMaterial(*state);
+
+            childState = state;
+        }
+
+        for (const UsdPrim &child : prim.GetFilteredChildren(_predicate)) {
+            _dispatcher.Run([this, child, childState]() {
+                _Resolve(child, childState);
+            });
+        }
+    }
+
+    // Mirrors the resolution order of ComputeBoundMaterial: at each level
+    // the first matching collection binding beats the direct binding; the
+    // nearest level with a candidate wins, unless a candidate closer to
+    // the root is marked strongerThanDescendants, in which case the
+    // root-most such candidate wins.  The first purpose that resolves to
+    // a valid material wins overall.
+    UsdShadeMaterial _ComputeWinningMaterial(const _BindingState &state) {
+        struct _Candidate {
+            const UsdShadeMaterialBindingAPI::DirectBinding *direct = nullptr;
+            const UsdShadeMaterialBindingAPI::CollectionBinding *coll =
+                nullptr;
+            bool stronger = false;
+
+            explicit operator bool() const { return direct || coll; }
+        };
+
+        for (const _PurposeBindingStack &stack : state) {
+            _Candidate strongest, nearest;
+            for (const _AncestorBindings &level : stack.levels) {
+                _Candidate candidate;
+                for (const _AncestorCollBinding &coll : level.collBindings) {
+                    if (coll.resolvedRule != UsdTokens->exclude) {
+                        candidate = {nullptr, coll.binding,
+                                     coll.strongerThanDescendants};
+                        break;
+                    }
+                }
+                if (!candidate && level.directBinding) {
+                    candidate = {level.directBinding, nullptr,
+                                 level.directStrongerThanDescendants};
+                }
+                if (candidate) {
+                    nearest = candidate;
+                    if (candidate.stronger && !strongest) {
+                        strongest = candidate;
+                    }
+                }
+            }
+
+            const _Candidate &winner = strongest ? strongest : nearest;
+            UsdShadeMaterial boundMaterial;
+            if (winner.coll) {
+                boundMaterial = winner.coll->GetMaterial();
+            } else if (winner.direct) {
+                boundMaterial = winner.direct->GetMaterial();
+            }
+            if (boundMaterial) {
+                return boundMaterial;
+            }
+        }
+        return UsdShadeMaterial();
+    }
+
+    UsdShadeMaterialBindingAPI::BindingsCache *_bindingsCache;
+    UsdShadeMaterialBindingAPI::CollectionQueryCache *_collectionQueryCache;
+    UsdShadeMaterialBindingAPI::BoundMaterialMap *_boundMaterials;
+    TfToken _materialPurpose;
+    std::vector<TfToken> _materialPurposes;
+    Usd_PrimFlagsPredicate _predicate;
+    WorkDispatcher _dispatcher;
+};
+
+} // anonymous namespace
+
+/* static */
+void
+UsdShadeMaterialBindingAPI::ComputeBoundMaterialsForSubtree(
+    const UsdPrim &root,
+    BindingsCache *bindingsCache,
+    CollectionQueryCache *collectionQueryCache,
+    BoundMaterialMap *boundMaterials,
+    const TfToken &materialPurpose,
+    const Usd_PrimFlagsPredicate &predicate)
+{
+    TRACE_FUNCTION();
+
+    if (!root) {
+        TF_CODING_ERROR("Invalid root prim (%s)", UsdDescribe(root).c_str());
+        return;
+    }
+    if (!boundMaterials) {
+        TF_CODING_ERROR("Invalid boundMaterials pointer");
+        return;
+    }
+
+    _SubtreeBindingResolver resolver(bindingsCache, collectionQueryCache,
+                                     boundMaterials, materialPurpose,
+                                     predicate);
+    resolver.Run(root);
+}
+
 UsdGeomSubset 
 UsdShadeMaterialBindingAPI::CreateMaterialBindSubset(
     const TfToken &subsetName,
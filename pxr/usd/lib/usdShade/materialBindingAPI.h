@@ -752,10 +752,44 @@ public:
     /// relationships.
     USDSHADE_API
     static std::vector<UsdShadeMaterial> ComputeBoundMaterials(
-        const std::vector<UsdPrim> &prims, 
+        const std::vector<UsdPrim> &prims,
         const TfToken &materialPurpose=UsdShadeTokens->allPurpose,
         std::vector<UsdRelationship> *bindingRels=nullptr);
 
+    /// An unordered map of prim paths to the materials they resolve to.
+    /// An invalid material at a path means binding resolution ran for the
+    /// prim and found no bound material.
+    using BoundMaterialMap = tbb::concurrent_unordered_map<SdfPath,
+            UsdShadeMaterial, SdfPath::Hash>;
+
+    /// Static API for resolving the bound materials of every prim in the
+    /// subtree rooted at \p root in a single parallel top-down pass.
+    ///
+    /// Resolved bindings for all visited prims are recorded in
+    /// \p boundMaterials; existing entries for revisited paths are
+    /// overwritten.  The set of prims visited is determined by
+    /// \p predicate, exactly as in UsdPrimRange.
+    ///
+    /// The ancestor binding state (the bindings authored on each ancestor,
+    /// and each bound collection's membership rule at the current prim) is
+    /// carried down the traversal and shared between siblings, so each prim
+    /// costs a constant amount of work rather than the full ancestor walk
+    /// that per-prim ComputeBoundMaterial() performs.  The resulting
+    /// materials are identical to calling ComputeBoundMaterial() on every
+    /// prim with the same caches.
+    ///
+    /// When the goal is to resolve bindings for all (or most) prims under a
+    /// common root, this is substantially faster than mapping
+    /// ComputeBoundMaterial() over the prims.
+    USDSHADE_API
+    static void ComputeBoundMaterialsForSubtree(
+        const UsdPrim &root,
+        BindingsCache *bindingsCache,
+        CollectionQueryCache *collectionQueryCache,
+        BoundMaterialMap *boundMaterials,
+        const TfToken &materialPurpose=UsdShadeTokens->allPurpose,
+        const Usd_PrimFlagsPredicate &predicate=UsdPrimDefaultPredicate);
+
     /// @}
         
     // --------------------------------------------------------------------- //
@@ -647,6 +647,73 @@ class TestUsdShadeMaterialBinding(unittest.TestCase):
             materialPurpose=UsdShade.Tokens.full).GetPath(), 
             redMat.GetPath())
 
+    def test_ComputeBoundMaterialsForSubtree(self):
+        s = Usd.Stage.CreateInMemory()
+
+        matA = UsdShade.Material.Define(s, "/Materials/MatA")
+        matB = UsdShade.Material.Define(s, "/Materials/MatB")
+        matC = UsdShade.Material.Define(s, "/Materials/MatC")
+        matD = UsdShade.Material.Define(s, "/Materials/MatD")
+
+        world = s.DefinePrim("/World")
+        chars = s.DefinePrim("/World/Chars")
+        bob = s.DefinePrim("/World/Chars/Bob")
+        belt = s.DefinePrim("/World/Chars/Bob/Geom/Belt")
+        buckle = s.DefinePrim("/World/Chars/Bob/Geom/Belt/Buckle")
+        shirt = s.DefinePrim("/World/Chars/Bob/Geom/Shirt")
+        props = s.DefinePrim("/World/Props")
+        hammer = s.DefinePrim("/World/Props/Hammer")
+
+        # Direct bindings at several depths, including a
+        # stronger-than-descendants override and a restricted-purpose
+        # binding beneath it.
+        UsdShade.MaterialBindingAPI(world).Bind(matA)
+        UsdShade.MaterialBindingAPI(belt).Bind(matB)
+        UsdShade.MaterialBindingAPI(props).Bind(
+            matC, UsdShade.Tokens.strongerThanDescendants)
+        UsdShade.MaterialBindingAPI(hammer).Bind(
+            matB, materialPurpose=UsdShade.Tokens.preview)
+
+        # Collection binding on Bob covering the belt and shirt subtrees.
+        beltColl = Usd.CollectionAPI.ApplyCollection(bob, "beltStuff")
+        beltColl.CreateIncludesRel().AddTarget(belt.GetPath())
+        beltColl.GetIncludesRel().AddTarget(shirt.GetPath())
+        UsdShade.MaterialBindingAPI(bob).Bind(beltColl, matD, "beltStuff")
+
+        # The bulk resolution must agree with per-prim resolution for
+        # every purpose and every choice of subtree root.
+        for purpose in [UsdShade.Tokens.allPurpose, UsdShade.Tokens.preview,
+                        UsdShade.Tokens.full]:
+            for root in [world, bob, belt, s.GetPseudoRoot()]:
+                boundMaterials = \
+                    UsdShade.MaterialBindingAPI.ComputeBoundMaterialsForSubtree(
+                        root, purpose)
+                for prim in Usd.PrimRange(root):
+                    if prim.IsPseudoRoot():
+                        continue
+                    self.assertTrue(prim.GetPath() in boundMaterials)
+                    bulkMat = boundMaterials[prim.GetPath()]
+                    perPrimMat = UsdShade.MaterialBindingAPI(
+                        prim).ComputeBoundMaterial(purpose)[0]
+                    self.assertEqual(bool(bulkMat), bool(perPrimMat))
+                    if perPrimMat:
+                        self.assertEqual(bulkMat.GetPath(),
+                                         perPrimMat.GetPath())
+
+        # Spot-check a few interesting resolutions.
+        allBound = \
+            UsdShade.MaterialBindingAPI.ComputeBoundMaterialsForSubtree(world)
+        # Nearest direct binding wins over an ancestor collection binding,
+        # and also applies to its descendants.
+        self.assertEqual(allBound[belt.GetPath()].GetPath(), matB.GetPath())
+        self.assertEqual(allBound[buckle.GetPath()].GetPath(), matB.GetPath())
+        # The collection binding covers included prims with no nearer binding.
+        self.assertEqual(allBound[shirt.GetPath()].GetPath(), matD.GetPath())
+        # Prims outside the collection inherit the root direct binding.
+        self.assertEqual(allBound[bob.GetPath()].GetPath(), matA.GetPath())
+        # The stronger-than-descendants binding overrides deeper bindings.
+        self.assertEqual(allBound[hammer.GetPath()].GetPath(), matC.GetPath())
+
     def test_BlockingOnOver(self):
         stage = Usd.Stage.CreateInMemory()
         over = stage.OverridePrim('/World/over')
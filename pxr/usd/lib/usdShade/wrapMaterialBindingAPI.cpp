@@ -120,15 +120,33 @@ _WrapComputeBoundMaterial(const UsdShadeMaterialBindingAPI &bindingAPI,
 }
 
 static object
-_WrapComputeBoundMaterials(const std::vector<UsdPrim> &prims, 
+_WrapComputeBoundMaterials(const std::vector<UsdPrim> &prims,
                            const TfToken &materialPurpose)
 {
-    std::vector<UsdRelationship> bindingRels; 
+    std::vector<UsdRelationship> bindingRels;
     auto materials = UsdShadeMaterialBindingAPI::ComputeBoundMaterials(prims,
         materialPurpose, &bindingRels);
     return boost::python::make_tuple(materials, bindingRels);
 }
 
+static boost::python::dict
+_WrapComputeBoundMaterialsForSubtree(const UsdPrim &root,
+                                     const TfToken &materialPurpose)
+{
+    UsdShadeMaterialBindingAPI::BindingsCache bindingsCache;
+    UsdShadeMaterialBindingAPI::CollectionQueryCache collQueryCache;
+    UsdShadeMaterialBindingAPI::BoundMaterialMap boundMaterials;
+    UsdShadeMaterialBindingAPI::ComputeBoundMaterialsForSubtree(
+        root, &bindingsCache, &collQueryCache, &boundMaterials,
+        materialPurpose);
+
+    boost::python::dict result;
+    for (const auto &pathAndMaterial : boundMaterials) {
+        result[pathAndMaterial.first] = pathAndMaterial.second;
+    }
+    return result;
+}
+
 WRAP_CUSTOM {
 
     using This = UsdShadeMaterialBindingAPI;
@@ -236,6 +254,12 @@ WRAP_CUSTOM {
         .def("ComputeBoundMaterial", &_WrapComputeBoundMaterial,
              arg("materialPurpose")=UsdShadeTokens->allPurpose)
 
+        .def("ComputeBoundMaterialsForSubtree",
+            &_WrapComputeBoundMaterialsForSubtree,
+            (arg("root"),
+             arg("materialPurpose")=UsdShadeTokens->allPurpose))
+            .staticmethod("ComputeBoundMaterialsForSubtree")
+
         .def("ComputeBoundMaterials", &_WrapComputeBoundMaterials,
              (arg("prims"), arg("materialPurpose")=UsdShadeTokens->allPurpose))
             .staticmethod("ComputeBoundMaterials")
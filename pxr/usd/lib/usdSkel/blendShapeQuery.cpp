@@ -31,6 +31,7 @@
 #include "pxr/usd/usdSkel/utils.h"
 
 #include <algorithm>
+#include <atomic>
 
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -391,6 +392,66 @@ UsdSkelBlendShapeQuery::ComputeDeformedPoints(
 }
 
 
+bool
+UsdSkelBlendShapeQuery::ComputeDeformedPointsUsingPackedTable(
+    const TfSpan<const float> subShapeWeights,
+    const TfSpan<const GfVec4f> packedOffsets,
+    const TfSpan<const GfVec2i> packedRanges,
+    TfSpan<GfVec3f> points) const
+{
+    TRACE_FUNCTION();
+
+    // The packed table is sized to the number of points the shapes refer
+    // to, which may be smaller than the point array being deformed.
+    const size_t numPoints =
+        std::min(static_cast<size_t>(packedRanges.size()),
+                 static_cast<size_t>(points.size()));
+
+    // Flag for marking error state from within threads.
+    std::atomic_bool errors(false);
+
+    WorkParallelForN(
+        numPoints,
+        [&](size_t start, size_t end)
+        {
+            for (size_t pi = start; pi < end; ++pi) {
+                const GfVec2i range = packedRanges[pi];
+                if (range[0] < 0 || range[0] > range[1] ||
+                    static_cast<size_t>(range[1]) > packedOffsets.size()) {
+                    errors = true;
+                    return;
+                }
+
+                GfVec3f p = points[pi];
+                for (int oi = range[0]; oi < range[1]; ++oi) {
+                    const GfVec4f& offset = packedOffsets[oi];
+                    const int subShapeIndex = static_cast<int>(offset[3]);
+                    if (subShapeIndex < 0 ||
+                        static_cast<size_t>(subShapeIndex) >=
+                            subShapeWeights.size()) {
+                        errors = true;
+                        return;
+                    }
+                    const float w = subShapeWeights[subShapeIndex];
+                    if (w != 0.0f) {
+                        p += GfVec3f(offset[0], offset[1], offset[2])*w;
+                    }
+                }
+                points[pi] = p;
+            }
+        });
+
+    if (errors) {
+        TF_WARN("Found invalid ranges or sub-shape indices in the packed "
+                "shape table; expected a table computed by "
+                "ComputePackedShapeTable() with weights computed by "
+                "ComputeFlattenedSubShapeWeights().");
+        return false;
+    }
+    return true;
+}
+
+
 namespace {
 
 
@@ -31,7 +31,9 @@
 #include "pxr/usd/usdSkel/blendShape.h"
 #include "pxr/usd/usdSkel/inbetweenShape.h"
 
+#include "pxr/base/gf/vec2i.h"
 #include "pxr/base/gf/vec3f.h"
+#include "pxr/base/gf/vec4f.h"
 #include "pxr/base/tf/span.h"
 #include "pxr/base/vt/array.h"
 
@@ -128,6 +130,23 @@ public:
         const std::vector<VtVec3fArray>& subShapePointOffsets,
         TfSpan<GfVec3f> points) const;
 
+    /// Deform \p points using the packed shape table computed by
+    /// ComputePackedShapeTable(). The \p subShapeWeights array holds one
+    /// weight per sub-shape, as computed by
+    /// ComputeFlattenedSubShapeWeights().
+    /// Because the packed table groups the offsets of every sub-shape by
+    /// point, the deformation is applied in a single parallel sweep over
+    /// the point array, rather than one scatter pass per active shape as
+    /// in ComputeDeformedPoints(). The packed table depends only on shape
+    /// topology, so it may be computed once and reused across frames while
+    /// only the weights are animated.
+    USDSKEL_API bool
+    ComputeDeformedPointsUsingPackedTable(
+        const TfSpan<const float> subShapeWeights,
+        const TfSpan<const GfVec4f> packedOffsets,
+        const TfSpan<const GfVec2i> packedRanges,
+        TfSpan<GfVec3f> points) const;
+
 
     /// Compute a packed shape table combining all sub-shapes.
     /// This is intended to help encode blend shapes in a GPU-friendly form.
@@ -35,6 +35,9 @@
 #include "pxr/usd/usdSkel/skinningQuery.h"
 
 #include "pxr/base/arch/hints.h"
+#include "pxr/base/work/loops.h"
+
+#include <atomic>
 
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -87,6 +90,34 @@ UsdSkelCache::Populate(const UsdSkelRoot& root)
 }
 
 
+bool
+UsdSkelCache::Populate(const std::vector<UsdSkelRoot>& roots)
+{
+    TRACE_FUNCTION();
+
+    if (roots.size() == 1) {
+        return Populate(roots.front());
+    }
+
+    std::atomic_bool success(true);
+
+    WorkParallelForN(
+        roots.size(),
+        [&](size_t start, size_t end)
+        {
+            // Each thread holds its own read scope; the underlying
+            // maps support concurrent insertion.
+            UsdSkel_CacheImpl::ReadScope scope(_impl.get());
+            for (size_t i = start; i < end; ++i) {
+                if (!scope.Populate(roots[i])) {
+                    success = false;
+                }
+            }
+        });
+    return success;
+}
+
+
 UsdSkelSkinningQuery
 UsdSkelCache::GetSkinningQuery(const UsdPrim& prim) const
 {
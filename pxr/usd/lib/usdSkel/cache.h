@@ -35,6 +35,7 @@
 #include "pxr/usd/usdSkel/binding.h"
 
 #include <memory>
+#include <vector>
 
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -68,6 +69,13 @@ public:
     USDSKEL_API
     bool Populate(const UsdSkelRoot& root);
 
+    /// \overload
+    /// Populate the cache for the skeletal data beneath each of the
+    /// given \p roots. The individual roots are populated in parallel.
+    /// Returns true if population succeeded for every root.
+    USDSKEL_API
+    bool Populate(const std::vector<UsdSkelRoot>& roots);
+
     /// Get a skel query for computing properties of \p skel.
     /// This does not require Populate() to be called on the cache.
     USDSKEL_API
@@ -23,6 +23,7 @@
 //
 #include "pxr/usd/usdSkel/skeletonQuery.h"
 
+#include "pxr/base/gf/batchTransform.h"
 #include "pxr/base/tf/span.h"
 
 #include "pxr/usd/usd/prim.h"
@@ -33,10 +34,30 @@
 #include "pxr/usd/usdSkel/topology.h"
 #include "pxr/usd/usdSkel/utils.h"
 
+#include <mutex>
+
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 
+/// Single-entry memo of the joint-local transforms computed at the most
+/// recent query time. This is shared across all copies of a query, so that
+/// evaluating many skinnable prims bound to the same skeleton only pulls
+/// on the bound animation once per frame.
+struct UsdSkelSkeletonQuery::_TimeCache
+{
+    std::mutex mutex;
+
+    /// Whether the animation's joint transforms may vary over time.
+    /// If they cannot, the cached entry is valid for any query time.
+    bool animMightBeTimeVarying = true;
+
+    bool valid = false;
+    UsdTimeCode time = UsdTimeCode::Default();
+    VtMatrix4dArray jointLocalXforms;
+};
+
+
 UsdSkelSkeletonQuery::UsdSkelSkeletonQuery(
     const UsdSkel_SkelDefinitionRefPtr& definition,
     const UsdSkelAnimQuery& animQuery)
@@ -45,10 +66,59 @@ UsdSkelSkeletonQuery::UsdSkelSkeletonQuery(
     if (definition && animQuery) {
         _animToSkelMapper = UsdSkelAnimMapper(animQuery.GetJointOrder(),
                                               definition->GetJointOrder());
+        _timeCache = std::make_shared<_TimeCache>();
+        _timeCache->animMightBeTimeVarying =
+            animQuery.JointTransformsMightBeTimeVarying();
     }
 }
 
 
+bool
+UsdSkelSkeletonQuery::_GetCachedJointLocalTransforms(
+    VtArray<GfMatrix4d>* xforms, UsdTimeCode time) const
+{
+    if (_timeCache) {
+        std::lock_guard<std::mutex> lock(_timeCache->mutex);
+        if (_timeCache->valid &&
+            (!_timeCache->animMightBeTimeVarying ||
+             _timeCache->time == time)) {
+            // Copy-on-write: this shares the cached storage.
+            *xforms = _timeCache->jointLocalXforms;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+bool
+UsdSkelSkeletonQuery::_GetCachedJointLocalTransforms(
+    VtArray<GfMatrix4f>* xforms, UsdTimeCode time) const
+{
+    // Single-precision results are not cached.
+    return false;
+}
+
+
+void
+UsdSkelSkeletonQuery::_CacheJointLocalTransforms(
+    const VtArray<GfMatrix4d>& xforms, UsdTimeCode time) const
+{
+    if (_timeCache) {
+        std::lock_guard<std::mutex> lock(_timeCache->mutex);
+        _timeCache->time = time;
+        _timeCache->jointLocalXforms = xforms;
+        _timeCache->valid = true;
+    }
+}
+
+
+void
+UsdSkelSkeletonQuery::_CacheJointLocalTransforms(
+    const VtArray<GfMatrix4f>& xforms, UsdTimeCode time) const
+{}
+
+
 size_t
 hash_value(const UsdSkelSkeletonQuery& query)
 {
@@ -105,6 +175,10 @@ UsdSkelSkeletonQuery::_ComputeJointLocalTransforms(VtArray<Matrix4>* xforms,
         return _definition->GetJointLocalRestTransforms(xforms);
     }
 
+    if (_GetCachedJointLocalTransforms(xforms, time)) {
+        return true;
+    }
+
     if (_animToSkelMapper.IsSparse()) {
         // Animation does not override all values;
         // Need to first fill in bind transforms.
@@ -121,7 +195,11 @@ UsdSkelSkeletonQuery::_ComputeJointLocalTransforms(VtArray<Matrix4>* xforms,
 
     VtArray<Matrix4> animXforms;
     if (_animQuery.ComputeJointLocalTransforms(&animXforms, time)) {
-        return _animToSkelMapper.RemapTransforms(animXforms, xforms);
+        if (_animToSkelMapper.RemapTransforms(animXforms, xforms)) {
+            _CacheJointLocalTransforms(*xforms, time);
+            return true;
+        }
+        return false;
     } else {
         // Failed to compute anim xforms.
         // Fall back to our rest transforms.
@@ -203,11 +281,24 @@ _MultTransforms(TfSpan<const Matrix4> a,
 {
     TF_DEV_AXIOM(a.size() == b.size() && a.size() == out.size());
 
-    for (size_t i = 0; i < out.size(); ++i) {    
+    for (size_t i = 0; i < out.size(); ++i) {
         out[i] = a[i] * b[i];
     }
 }
 
+/// Specialization using the vectorized batch kernel for the common
+/// double-precision case.
+template <>
+void
+_MultTransforms<GfMatrix4d>(TfSpan<const GfMatrix4d> a,
+                            TfSpan<const GfMatrix4d> b,
+                            TfSpan<GfMatrix4d> out)
+{
+    TF_DEV_AXIOM(a.size() == b.size() && a.size() == out.size());
+
+    GfMultiplyMatrices(a.data(), b.data(), out.data(), out.size());
+}
+
 } // namespace
 
 
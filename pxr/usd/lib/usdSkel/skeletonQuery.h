@@ -37,6 +37,8 @@
 #include "pxr/usd/usdSkel/animMapper.h"
 #include "pxr/usd/usdSkel/animQuery.h"
 
+#include <memory>
+
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -135,6 +137,15 @@ public:
     /// from the rest pose as a fallback value.
     /// If valid transforms cannot be computed for the animation source, the
     /// \p xforms are instead set to the rest transforms.
+    ///
+    /// The double-precision result of the most recent query time is cached
+    /// internally, and is shared across all copies of this query -- such as
+    /// the copies returned by UsdSkelCache::GetSkelQuery(). When many
+    /// skinnable prims are bound to the same skeleton, the bound animation
+    /// is therefore only evaluated once per frame. If the animation's joint
+    /// transforms cannot vary over time, the cached result is reused for
+    /// any query time. The cache is discarded along with the queries
+    /// themselves, on UsdSkelCache::Clear().
     template <typename Matrix4>
     USDSKEL_API
     bool ComputeJointLocalTransforms(VtArray<Matrix4>* xforms,
@@ -220,11 +231,26 @@ private:
     bool _ComputeSkinningTransforms(VtArray<Matrix4>* xforms,
                                     UsdTimeCode time) const;
 
+    bool _GetCachedJointLocalTransforms(VtArray<GfMatrix4d>* xforms,
+                                        UsdTimeCode time) const;
+    bool _GetCachedJointLocalTransforms(VtArray<GfMatrix4f>* xforms,
+                                        UsdTimeCode time) const;
+
+    void _CacheJointLocalTransforms(const VtArray<GfMatrix4d>& xforms,
+                                    UsdTimeCode time) const;
+    void _CacheJointLocalTransforms(const VtArray<GfMatrix4f>& xforms,
+                                    UsdTimeCode time) const;
+
 private:
     UsdSkel_SkelDefinitionRefPtr _definition;
     UsdSkelAnimQuery _animQuery;
     UsdSkelAnimMapper _animToSkelMapper;
 
+    /// Time-keyed cache of computed joint-local transforms, shared
+    /// across all copies of this query.
+    struct _TimeCache;
+    std::shared_ptr<_TimeCache> _timeCache;
+
     friend class UsdSkel_CacheImpl;
 };
 
@@ -24,6 +24,7 @@
 #include "pxr/usd/usdSkel/utils.h"
 
 #include "pxr/base/arch/hints.h"
+#include "pxr/base/gf/batchTransform.h"
 #include "pxr/base/gf/matrix3f.h"
 #include "pxr/base/gf/range3f.h"
 #include "pxr/base/gf/rotation.h"
@@ -1489,18 +1490,36 @@ UsdSkel_SkinTransformLBS(const Matrix4& geomBindTransform,
     }
 
     // Early-out for the common case where an object is rigidly
-    // bound to a single joint.
-    if (influencesFn.size() == 1 &&
+    // bound to a single joint. Influence lists are often padded out to a
+    // fixed element size, so this also covers the case where all weights
+    // past the first are zero. Out-of-range indices on the zero-weight
+    // padding fall through to the full path below so that the usual
+    // validation warnings are still emitted.
+    if (influencesFn.size() >= 1 &&
         GfIsClose(influencesFn.GetWeight(0), 1.0f, 1e-6)) {
-        const int jointIdx = influencesFn.GetIndex(0);
-        if (jointIdx >= 0 &&
-            static_cast<size_t>(jointIdx) < jointXforms.size()) {
-            *xform = geomBindTransform*jointXforms[jointIdx];
-            return true;
-        } else {
-            TF_WARN("Out of range joint index %d at index 0"
-                    " (num joints = %zu).", jointIdx, jointXforms.size());
-            return false;
+
+        bool isRigidlyBound = true;
+        for (size_t wi = 1; wi < influencesFn.size(); ++wi) {
+            const int paddingJointIdx = influencesFn.GetIndex(wi);
+            if (influencesFn.GetWeight(wi) != 0.0f ||
+                paddingJointIdx < 0 ||
+                static_cast<size_t>(paddingJointIdx) >= jointXforms.size()) {
+                isRigidlyBound = false;
+                break;
+            }
+        }
+
+        if (isRigidlyBound) {
+            const int jointIdx = influencesFn.GetIndex(0);
+            if (jointIdx >= 0 &&
+                static_cast<size_t>(jointIdx) < jointXforms.size()) {
+                *xform = geomBindTransform*jointXforms[jointIdx];
+                return true;
+            } else {
+                TF_WARN("Out of range joint index %d at index 0"
+                        " (num joints = %zu).", jointIdx, jointXforms.size());
+                return false;
+            }
         }
     }
 
@@ -2063,9 +2082,8 @@ _BakeSkinnedPoints(const UsdPrim& prim,
             GfMatrix4d skelToGprimXf =
                 skelLocalToWorld*gprimLocalToWorld.GetInverse();
 
-            for (auto& pt : skinnedPoints) {
-                pt = skelToGprimXf.Transform(pt);
-            }
+            GfTransformPoints(skelToGprimXf, skinnedPoints.data(),
+                              skinnedPoints.size());
        }
 
         pointsAttr.Set(skinnedPoints, time);
@@ -29,6 +29,7 @@
 
 #include "pxr/usd/ar/packageUtils.h"
 #include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/resolverScopedCache.h"
 #include "pxr/usd/sdf/assetPath.h"
 #include "pxr/usd/sdf/fileFormat.h"
 #include "pxr/usd/sdf/layerUtils.h"
@@ -49,8 +50,10 @@
 #include "pxr/base/tf/pathUtils.h"
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
 
 #include <stack>
+#include <unordered_set>
 #include <vector>
 
 #include <boost/get_pointer.hpp>
@@ -848,8 +851,167 @@ private:
         _PathType *pathType);
 };
 
-std::string 
-_AssetLocalizer::_RemapAssetPath(const std::string &refPath, 
+// Walks the asset dependency graph rooted at the given asset breadth-first,
+// one "level" of the graph at a time. All of the files discovered in the
+// previous level are opened and analyzed in parallel, and the asset paths
+// they reference are resolved as a single batch, before the newly discovered
+// files are queued up for the next level. Unlike _AssetLocalizer, this never
+// modifies the layers it visits, which is what makes the parallel analysis
+// safe; it is purely a dependency finder.
+class _ParallelDependencyWalker {
+public:
+    explicit _ParallelDependencyWalker(const SdfAssetPath &assetPath)
+    {
+        auto &resolver = ArGetResolver();
+
+        // Ensure repeated resolves of the same discovered paths hit a cache.
+        ArResolverScopedCache resolverCache;
+
+        std::string rootFilePath = resolver.Resolve(assetPath.GetAssetPath());
+
+        // Ensure that the resolved path is not empty and can be localized to
+        // a physical location on disk.
+        if (rootFilePath.empty() ||
+            !resolver.FetchToLocalResolvedPath(assetPath.GetAssetPath(),
+                                               rootFilePath)) {
+            return;
+        }
+
+        // Set of all seen files. We maintain this set to avoid redundant
+        // dependency analysis of already seen files. It is only touched
+        // in the serial discovery phase between levels.
+        std::unordered_set<std::string> seenFiles;
+        seenFiles.insert(rootFilePath);
+
+        std::vector<std::string> currentLevel(1, rootFilePath);
+
+        struct _AnalyzedFile {
+            SdfLayerRefPtr layer;
+            std::string filePath;
+            std::vector<std::string> dependencies;
+        };
+
+        while (!currentLevel.empty()) {
+            // Open and analyze this level's files in parallel. Each file's
+            // analysis only appends to its own dependency list, so no
+            // synchronization is needed.
+            std::vector<_AnalyzedFile> analyzedFiles(currentLevel.size());
+            WorkParallelForN(currentLevel.size(),
+                [&currentLevel, &analyzedFiles](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i != end; ++i) {
+                        _AnalyzedFile &analyzedFile = analyzedFiles[i];
+                        analyzedFile.filePath = currentLevel[i];
+
+                        _FileAnalyzer analyzer(currentLevel[i],
+                            _ReferenceTypesToInclude::All,
+                            /*remapPathFunc*/ {},
+                            [&analyzedFile](const std::string &assetPath,
+                                            const _DepType &depType)
+                            {
+                                analyzedFile.dependencies.push_back(assetPath);
+                            });
+                        analyzedFile.layer = analyzer.GetLayer();
+                    }
+                });
+            currentLevel.clear();
+
+            for (const _AnalyzedFile &analyzedFile : analyzedFiles) {
+                if (!analyzedFile.layer) {
+                    _assets.push_back(analyzedFile.filePath);
+                    continue;
+                }
+
+                _layers.push_back(analyzedFile.layer);
+
+                // Anchor all of the layer's references up front, then
+                // resolve them as a single batch.
+                std::vector<std::string> refs = analyzedFile.dependencies;
+                std::vector<std::string> refAssetPaths(refs.size());
+                for (size_t i = 0; i < refs.size(); ++i) {
+                    // If this is a package-relative path, then simply record
+                    // the package itself.
+                    // Note: recursive search for dependencies ends here.
+                    if (ArIsPackageRelativePath(refs[i])) {
+                        refs[i] = ArSplitPackageRelativePathOuter(
+                            refs[i]).first;
+                    }
+
+                    refAssetPaths[i] = SdfComputeAssetPathRelativeToLayer(
+                        analyzedFile.layer, refs[i]);
+                }
+
+                std::vector<std::string> resolvedRefFilePaths;
+                resolver.ResolveBatch(refAssetPaths, &resolvedRefFilePaths);
+
+                for (size_t i = 0; i < refs.size(); ++i) {
+                    const std::string &refAssetPath = refAssetPaths[i];
+                    const std::string &resolvedRefFilePath =
+                        resolvedRefFilePaths[i];
+
+                    if (resolvedRefFilePath.empty()) {
+                        TF_WARN("Failed to resolve reference @%s@ with "
+                                "computed asset path @%s@ found in layer "
+                                "@%s@.",
+                                refs[i].c_str(),
+                                refAssetPath.c_str(),
+                                analyzedFile.filePath.c_str());
+
+                        _unresolvedAssetPaths.push_back(refAssetPath);
+                        continue;
+                    }
+
+                    // Ensure that the resolved path can be fetched to a
+                    // physical location on disk.
+                    if (!resolver.FetchToLocalResolvedPath(
+                            refAssetPath, resolvedRefFilePath)) {
+                        TF_WARN("Failed to fetch-to-local resolved path for "
+                            "asset @%s@ : '%s'. Skipping dependency.",
+                            refAssetPath.c_str(),
+                            resolvedRefFilePath.c_str());
+                        continue;
+                    }
+
+                    // We should only have to analyze every resolved file
+                    // once.
+                    if (!seenFiles.insert(resolvedRefFilePath).second) {
+                        continue;
+                    }
+
+                    // XXX: We don't localize directory references.
+                    if (TfIsDir(resolvedRefFilePath)) {
+                        continue;
+                    }
+
+                    currentLevel.push_back(resolvedRefFilePath);
+                }
+            }
+        }
+    }
+
+    // Get the list of all layers in the dependency graph.
+    const std::vector<SdfLayerRefPtr> &GetLayers() const {
+        return _layers;
+    }
+
+    // Get the list of all non-layer dependencies in the dependency graph.
+    const std::vector<std::string> &GetAssets() const {
+        return _assets;
+    }
+
+    // Returns the list of all unresolved references.
+    const std::vector<std::string> &GetUnresolvedAssetPaths() const {
+        return _unresolvedAssetPaths;
+    }
+
+private:
+    std::vector<SdfLayerRefPtr> _layers;
+    std::vector<std::string> _assets;
+    std::vector<std::string> _unresolvedAssetPaths;
+};
+
+std::string
+_AssetLocalizer::_RemapAssetPath(const std::string &refPath,
                                  const SdfLayerRefPtr &layer,
                                  std::string origRootFilePath,
                                  std::string rootFilePath, 
@@ -1280,27 +1442,15 @@ UsdUtilsComputeAllDependencies(const SdfAssetPath &assetPath,
                                std::vector<std::string> *assets,
                                std::vector<std::string> *unresolvedPaths)
 {
-    // We are not interested in localizing here, hence pass in the empty string
-    // for destination directory.
-    _AssetLocalizer localizer(assetPath, /* destDir */ std::string());
-
-    // Clear the vectors before we start.
-    layers->clear();
-    assets->clear();
-    
-    // Reserve space in the vectors.
-    layers->reserve(localizer.GetLayerExportMap().size());
-    assets->reserve(localizer.GetFileCopyMap().size());
-
-    for (auto &layerAndDestPath : localizer.GetLayerExportMap()) {
-        layers->push_back(layerAndDestPath.first);
-    }
+    TRACE_FUNCTION();
 
-    for (auto &srcAndDestPath : localizer.GetFileCopyMap()) {
-        assets->push_back(srcAndDestPath.first);
-    }
+    // We are not interested in localizing here, so use the parallel,
+    // non-mutating walker rather than _AssetLocalizer.
+    _ParallelDependencyWalker walker(assetPath);
 
-    *unresolvedPaths = localizer.GetUnresolvedAssetPaths();
+    *layers = walker.GetLayers();
+    *assets = walker.GetAssets();
+    *unresolvedPaths = walker.GetUnresolvedAssetPaths();
 
     // Return true if one or more layers or assets were added  to the results.
     return !layers->empty() || !assets->empty();
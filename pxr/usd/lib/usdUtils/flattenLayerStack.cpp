@@ -27,6 +27,7 @@
 #include "pxr/usd/sdf/layer.h"
 #include "pxr/usd/sdf/assetPath.h"
 #include "pxr/usd/sdf/changeBlock.h"
+#include "pxr/usd/sdf/copyUtils.h"
 #include "pxr/usd/sdf/layerUtils.h"
 #include "pxr/usd/sdf/primSpec.h"
 #include "pxr/usd/sdf/attributeSpec.h"
@@ -42,7 +43,10 @@
 #include "pxr/usd/usd/stage.h"
 #include "pxr/usd/usd/tokens.h"
 #include "pxr/usd/ar/resolverContextBinder.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/staticData.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/threadLimits.h"
 
 #include <algorithm>
 #include <functional>
@@ -50,6 +54,12 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    USDUTILS_FLATTEN_LAYER_STACK_PARALLEL_SUBTREES, true,
+    "Flatten the top-level namespace subtrees of a layer stack in parallel, "
+    "merging each completed subtree into the output layer as it finishes. "
+    "Set to false to restore the serial, single-threaded flattening.");
+
 ////////////////////////////////////////////////////////////////////////
 // UsdUtilsFlattenLayerStack
 //
@@ -612,6 +622,68 @@ _FlattenSpec(const PcpLayerStackRefPtr &layerStack,
     }
 }
 
+// Flattens the top-level namespace subtrees of the layer stack in parallel.
+// Each subtree is flattened into its own anonymous layer, so no two threads
+// ever author to the same layer; completed subtrees are then copied into
+// the output layer in namespace order and released. Subtrees are processed
+// in batches of roughly one per worker thread, so peak memory holds the
+// output layer plus at most one batch of flattened subtrees, rather than
+// a second full copy of the result.
+static void
+_FlattenSubtreesInParallel(
+    const PcpLayerStackRefPtr &layerStack,
+    const SdfLayerRefPtr &outputLayer,
+    const UsdUtilsResolveAssetPathFn& resolveAssetPathFn)
+{
+    TfTokenVector nameOrder;
+    PcpTokenSet nameSet;
+    PcpComposeSiteChildNames(layerStack->GetLayers(),
+                             SdfPath::AbsoluteRootPath(),
+                             SdfChildrenKeys->PrimChildren,
+                             &nameOrder, &nameSet,
+                             &SdfFieldKeys->PrimOrder);
+
+    const size_t batchSize = std::max<size_t>(WorkGetConcurrencyLimit(), 1);
+
+    for (size_t begin = 0; begin < nameOrder.size(); begin += batchSize) {
+        const size_t end = std::min(begin + batchSize, nameOrder.size());
+
+        std::vector<SdfLayerRefPtr> subtreeLayers(end - begin);
+        WorkParallelForN(end - begin,
+            [&layerStack, &resolveAssetPathFn, &nameOrder, &subtreeLayers,
+             begin](size_t i0, size_t i1)
+            {
+                for (size_t i = i0; i != i1; ++i) {
+                    SdfLayerRefPtr subtreeLayer =
+                        SdfLayer::CreateAnonymous(".usda");
+                    SdfChangeBlock changeBlock;
+                    // Use SdfSpecifierDef as a placeholder specifier; it
+                    // will be fixed up when we _FlattenFields().
+                    if (SdfPrimSpecHandle child = SdfPrimSpec::New(
+                            subtreeLayer->GetPseudoRoot(),
+                            nameOrder[begin + i], SdfSpecifierDef)) {
+                        _FlattenFields(layerStack, child, resolveAssetPathFn);
+                        _FlattenSpec(layerStack, child, resolveAssetPathFn);
+                        subtreeLayers[i] = subtreeLayer;
+                    }
+                }
+            });
+
+        // Merge the completed subtrees into the output layer in namespace
+        // order, releasing each one as soon as it has been copied.
+        for (size_t i = 0; i < subtreeLayers.size(); ++i) {
+            if (subtreeLayers[i]) {
+                const SdfPath childPath =
+                    SdfPath::AbsoluteRootPath().AppendChild(
+                        nameOrder[begin + i]);
+                SdfCopySpec(SdfLayerHandle(subtreeLayers[i]), childPath,
+                            SdfLayerHandle(outputLayer), childPath);
+                subtreeLayers[i] = TfNullPtr;
+            }
+        }
+    }
+}
+
 SdfLayerRefPtr
 UsdUtils_FlattenLayerStack(const PcpLayerStackRefPtr &layerStack,
                            const UsdUtilsResolveAssetPathFn& resolveAssetPathFn,
@@ -628,7 +700,13 @@ UsdUtils_FlattenLayerStack(const PcpLayerStackRefPtr &layerStack,
     SdfChangeBlock changeBlock;
     SdfLayerRefPtr outputLayer = SdfLayer::CreateAnonymous(tag);
     _FlattenFields(layerStack, outputLayer->GetPseudoRoot(), resolveAssetPathFn);
-    _FlattenSpec(layerStack, outputLayer->GetPseudoRoot(), resolveAssetPathFn);
+    if (TfGetEnvSetting(USDUTILS_FLATTEN_LAYER_STACK_PARALLEL_SUBTREES)) {
+        _FlattenSubtreesInParallel(layerStack, outputLayer,
+                                   resolveAssetPathFn);
+    } else {
+        _FlattenSpec(layerStack, outputLayer->GetPseudoRoot(),
+                     resolveAssetPathFn);
+    }
     return outputLayer;
 }
 
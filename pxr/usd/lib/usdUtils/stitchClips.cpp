@@ -51,10 +51,12 @@
 
 #include <tbb/parallel_reduce.h>
 
+#include <algorithm>
 #include <set>
 #include <string>
 #include <limits>
 #include <tuple>
+#include <utility>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -64,6 +66,12 @@ namespace {
     using _SdfAssetArray = VtArray<SdfAssetPath>;
     using _ClipFileVector = std::vector<std::string>;
 
+    // (identifier, realPath) pairs recorded for each clip layer, so that
+    // asset paths can be normalized after the layers themselves have
+    // been released.
+    using _ClipPathInfoVector = std::vector<std::pair<std::string,
+                                                      std::string>>;
+
     // constants
     // ------------------------------------------------------------------------
     constexpr double TIME_MAX = std::numeric_limits<double>::max();
@@ -71,6 +79,12 @@ namespace {
     // We insert the topology layer as the strongest
     constexpr size_t TOPOLOGY_SUBLAYER_STRENGTH = 0;
 
+    // Number of clip layers held open at once while stitching.
+    // Clips are streamed through in batches of this size, bounding peak
+    // memory when stitching long frame ranges, while still permitting
+    // parallel opening and aggregation within each batch.
+    constexpr size_t CLIP_BATCH_SIZE = 128;
+
     // Convenience function for wrapping up nice error message
     // when checking os permissions of a layers backing file.
     bool
@@ -214,17 +228,17 @@ namespace {
     // in from the current assetPaths in the root layer(note that this
     // is to be called after parallel stitching). This difference shows
     // us how many asset paths need to be normalized.
-    void 
-    _NormalizeClipAssetPaths(const SdfLayerHandle& resultLayer, 
-                             const SdfLayerRefPtrVector& clipLayers,
+    void
+    _NormalizeClipAssetPaths(const SdfLayerHandle& resultLayer,
+                             const _ClipPathInfoVector& clipPathInfo,
                              const SdfPath& clipPath,
-                             const TfToken& clipSet) 
+                             const TfToken& clipSet)
     {
-        const auto currentAssetPaths 
-            = _GetUnboxedValue<_SdfAssetArray>(resultLayer, clipPath, 
+        const auto currentAssetPaths
+            = _GetUnboxedValue<_SdfAssetArray>(resultLayer, clipPath,
                                                UsdClipsAPIInfoKeys->assetPaths,
                                                clipSet);
-        const auto diff = currentAssetPaths.size() - clipLayers.size();
+        const auto diff = currentAssetPaths.size() - clipPathInfo.size();
 
         _SdfAssetArray result;
         result.reserve(currentAssetPaths.size());
@@ -238,10 +252,10 @@ namespace {
 
         // update newly added clip paths which need normalizing
         for (size_t i = 0; i < currentAssetPaths.size() - diff; ++i) {
-            const auto path 
-                = _GetRelativePathIfPossible(clipLayers[i]->GetIdentifier(),
-                                             clipLayers[i]->GetRealPath(),
-                                             resultPath); 
+            const auto path
+                = _GetRelativePathIfPossible(clipPathInfo[i].first,
+                                             clipPathInfo[i].second,
+                                             resultPath);
             result.push_back(SdfAssetPath(path));
         }
 
@@ -657,29 +671,109 @@ namespace {
         return result;
     }
 
+    // Opens the clip layer files in the subrange [\p begin, \p end) of
+    // \p clipLayerFiles in parallel, placing the resulting handles in
+    // \p clipLayers. Returns false if any of the layers failed to open.
+    bool
+    _OpenClipLayersInRange(SdfLayerRefPtrVector* clipLayers,
+                           const _ClipFileVector& clipLayerFiles,
+                           const size_t begin,
+                           const size_t end)
+    {
+        TfErrorMark errorMark;
+
+        // Pre-allocate our destination vector for the clip layer handles
+        clipLayers->resize(end - begin);
+
+        // Open the clip layer files in parallel and place them into the vector
+        WorkParallelForN(end - begin,
+            [&clipLayers, &clipLayerFiles, begin](size_t i0, size_t i1)
+            {
+                for (size_t i = i0; i != i1; ++i) {
+                    (*clipLayers)[i]
+                        = SdfLayer::FindOrOpen(clipLayerFiles[begin + i]);
+                }
+            });
+
+        for (size_t i = 0; i < clipLayers->size(); ++i) {
+            if (!(*clipLayers)[i]) {
+                TF_CODING_ERROR("Failed to open layer %s\n",
+                                clipLayerFiles[begin + i].c_str());
+                return false;
+            }
+        }
+
+        return errorMark.IsClean();
+    }
+
     // Stitches a manifest file, containing the clip meta data aggregated
-    // from the input \p clipLayers. These include clipPrimPath, clipTimes, 
-    // clipManifestAssetPath clipActive and clipAssetPaths as well as an 
+    // from the input \p clipLayerFiles. These include clipPrimPath, clipTimes,
+    // clipManifestAssetPath clipActive and clipAssetPaths as well as an
     // authored reference to the \p topologyLayer
-    // Stitches a topology file in \p topologyLayer, based on the aggregate 
-    // topology of \p clipLayers at the specified \p clipPath. 
-    void
+    // Stitches a topology file in \p topologyLayer, based on the aggregate
+    // topology of the clip layers at the specified \p clipPath.
+    //
+    // The clip layers are streamed through in batches of CLIP_BATCH_SIZE:
+    // each batch is opened in parallel, aggregated into a running result,
+    // and released before the next batch is opened, so that peak memory
+    // does not hold every clip layer open simultaneously.
+    bool
     _StitchLayers(const SdfLayerHandle& resultLayer,
                   const SdfLayerRefPtr& topologyLayer,
-                  const SdfLayerRefPtrVector& clipLayers,
+                  const _ClipFileVector& clipLayerFiles,
                   const SdfPath& clipPath,
                   const TfToken& clipSet)
     {
-        auto result = _AggregateDataFromClips(
-            topologyLayer, clipLayers, clipPath, clipSet);
+        // Running aggregate of the per-batch reductions.
+        _StitchLayersResult result(clipPath, clipSet);
+
+        _ClipPathInfoVector clipPathInfo;
+        clipPathInfo.reserve(clipLayerFiles.size());
+
+        bool somePrimContainsPath = false;
+
+        for (size_t begin = 0; begin < clipLayerFiles.size();
+             begin += CLIP_BATCH_SIZE) {
+            const size_t end = std::min(begin + CLIP_BATCH_SIZE,
+                                        clipLayerFiles.size());
+
+            SdfLayerRefPtrVector clipLayers;
+            if (!_OpenClipLayersInRange(&clipLayers, clipLayerFiles,
+                                        begin, end)) {
+                return false;
+            }
+
+            for (const auto& layer : clipLayers) {
+                if (layer->GetPrimAtPath(clipPath)) {
+                    somePrimContainsPath = true;
+                }
+                clipPathInfo.emplace_back(layer->GetIdentifier(),
+                                          layer->GetRealPath());
+            }
+
+            auto batchResult = _AggregateDataFromClips(
+                topologyLayer, clipLayers, clipPath, clipSet);
+            result.join(batchResult);
+
+            // The batch's clip layers are released here, bounding
+            // peak memory.
+        }
+
+        // if no clipLayers contain the primPath we want
+        if (!somePrimContainsPath) {
+            TF_CODING_ERROR("Invalid clip path specified <%s>",
+                            clipPath.GetString().c_str());
+            return false;
+        }
+
         _StitchLayersIgnoringTimeSamples(topologyLayer, result.topology);
 
-        // if the rootLayer has no clip-metadata authored 
+        // if the rootLayer has no clip-metadata authored
         if (!resultLayer->GetPrimAtPath(clipPath)) {
             // we need to run traditional stitching to add the prim structure
             _StitchLayersIgnoringTimeSamples(resultLayer, result.root);
         } else {
-            _MergeRootLayerMetadata(resultLayer, result.root, 
+            _MergeRootLayerMetadata(resultLayer, result.root,
                                     clipPath, clipSet);
         }
 
@@ -687,109 +781,74 @@ namespace {
         // may be aggregated in parallel, and thus will have clipActives
         // which are out of sync with one another.
         _RetimeClipActive(resultLayer, clipPath, clipSet);
-        _NormalizeClipAssetPaths(resultLayer, clipLayers, clipPath, clipSet);
+        _NormalizeClipAssetPaths(resultLayer, clipPathInfo, clipPath, clipSet);
 
         // set the topology reference and manifest path because we
         // use anonymous layers during parallel reduction
         _StitchClipManifest(resultLayer, topologyLayer, clipPath, clipSet);
-        
+
         // fetch the rootPrim from the topology layer
         if (topologyLayer->GetRootPrims().empty()) {
             TF_CODING_ERROR("Failed to generate topology.");
         } else {
-            const std::string topologyId 
+            const std::string topologyId
                 = _GetRelativePathIfPossible(topologyLayer->GetIdentifier(),
                                              topologyLayer->GetRealPath(),
                                              resultLayer->GetRealPath());
 
-            _StitchClipsTopologySubLayerPath(resultLayer, topologyId); 
+            _StitchClipsTopologySubLayerPath(resultLayer, topologyId);
         }
+        return true;
     }
 
     bool
     _UsdUtilsStitchClipsTopologyImpl(const SdfLayerRefPtr& topologyLayer,
-                                     const SdfLayerRefPtrVector& clipLayers)
+                                     const _ClipFileVector& clipLayerFiles)
     {
         TfErrorMark errorMark;
 
-        // Note that we don't specify a unique clipPath since we're only
-        // interested in aggregating topology. 
-        auto result  = _AggregateDataFromClips(topologyLayer, clipLayers);
-        _StitchLayersIgnoringTimeSamples(topologyLayer, result.topology);
+        // Stream the clip layers through in batches, so that we don't
+        // hold them all open at once.
+        for (size_t begin = 0; begin < clipLayerFiles.size();
+             begin += CLIP_BATCH_SIZE) {
+            const size_t end = std::min(begin + CLIP_BATCH_SIZE,
+                                        clipLayerFiles.size());
+
+            SdfLayerRefPtrVector clipLayers;
+            if (!_OpenClipLayersInRange(&clipLayers, clipLayerFiles,
+                                        begin, end)) {
+                return false;
+            }
+
+            // Note that we don't specify a unique clipPath since we're only
+            // interested in aggregating topology.
+            auto result = _AggregateDataFromClips(topologyLayer, clipLayers);
+            _StitchLayersIgnoringTimeSamples(topologyLayer, result.topology);
+        }
 
         return errorMark.IsClean();
     }
 
-    bool 
-    _UsdUtilsStitchClipsImpl(const SdfLayerHandle& resultLayer, 
+    bool
+    _UsdUtilsStitchClipsImpl(const SdfLayerHandle& resultLayer,
                              const SdfLayerRefPtr& topologyLayer,
-                             const SdfLayerRefPtrVector& clipLayers,
-                             const SdfPath& clipPath, 
+                             const _ClipFileVector& clipLayerFiles,
+                             const SdfPath& clipPath,
                              const double startTimeCode,
                              const double endTimeCode,
                              const TfToken& clipSet)
     {
         TfErrorMark errorMark;
 
-        _StitchLayers(resultLayer, topologyLayer, 
-                      clipLayers, clipPath, clipSet);
-        _SetTimeCodeRange(resultLayer, clipPath, 
+        if (!_StitchLayers(resultLayer, topologyLayer,
+                           clipLayerFiles, clipPath, clipSet)) {
+            return false;
+        }
+        _SetTimeCodeRange(resultLayer, clipPath,
                           startTimeCode, endTimeCode, clipSet);
 
         return errorMark.IsClean();
     }
-
-    bool 
-    _ClipLayersAreValid(const SdfLayerRefPtrVector& clipLayers,
-                        const _ClipFileVector& clipLayerFiles,
-                        const SdfPath& clipPath) 
-    {
-        bool somePrimContainsPath = false;
-        
-        for (size_t i = 0; i < clipLayerFiles.size(); i++) { 
-            const auto& layer = clipLayers[i];
-            if (!layer) {
-                TF_CODING_ERROR("Failed to open layer %s\n",
-                                clipLayerFiles[i].c_str());
-                return false;
-            } else if (layer->GetPrimAtPath(clipPath)) {
-                somePrimContainsPath = true;
-            }
-        }
-
-        // if no clipLayers contain the primPath we want
-        if (!somePrimContainsPath) {
-            TF_CODING_ERROR("Invalid clip path specified <%s>", 
-                            clipPath.GetString().c_str());
-            return false;
-        } 
-
-        return true;
-    }
-
-
-    bool
-    _OpenClipLayers(SdfLayerRefPtrVector* clipLayers,
-                    const _ClipFileVector& clipLayerFiles,
-                    const SdfPath& clipPath)
-    {
-        TfErrorMark errorMark;
-
-        // Pre-allocate our destination vector for the clip layer handles
-        clipLayers->resize(clipLayerFiles.size());
-
-        // Open the clip layer files in parallel and place them into the vector
-        WorkParallelForN(clipLayerFiles.size(),
-            [&clipLayers, &clipLayerFiles](size_t begin, size_t end) 
-            {
-                for (size_t i = begin; i != end; ++i) {
-                    (*clipLayers)[i] = SdfLayer::FindOrOpen(clipLayerFiles[i]);
-                }
-            });
-
-        return errorMark.IsClean() 
-               && _ClipLayersAreValid(*clipLayers, clipLayerFiles, clipPath);
-    }
 }
 
 // public facing API
@@ -810,13 +869,8 @@ UsdUtilsStitchClipsTopology(const SdfLayerHandle& topologyLayer,
         topologyLayer->Clear();
     }
 
-    // Open all clip layers and validate clipPath
-    SdfLayerRefPtrVector clipLayers;
-    const bool clipLayersAreValid = _OpenClipLayers(&clipLayers, 
-        clipLayerFiles, SdfPath::AbsoluteRootPath());
-
-    if (!clipLayersAreValid
-        || !_UsdUtilsStitchClipsTopologyImpl(topologyLayer, clipLayers)) {
+    // Clip layers are opened and validated in batches by the impl.
+    if (!_UsdUtilsStitchClipsTopologyImpl(topologyLayer, clipLayerFiles)) {
         return false;
     }
 
@@ -859,16 +913,11 @@ UsdUtilsStitchClips(const SdfLayerHandle& resultLayer,
         topologyLayer->Clear();
     }
 
-    // Open all clip layers and validate clipPath
-    SdfLayerRefPtrVector clipLayers;
-    const bool clipLayersAreValid 
-        = _OpenClipLayers(&clipLayers, clipLayerFiles, clipPath);
-
-    if (!clipLayersAreValid
-        || !_UsdUtilsStitchClipsImpl(resultLayer, topologyLayer, 
-                                     clipLayers, clipPath, 
-                                     startTimeCode, endTimeCode,
-                                     clipSet)) {
+    // Clip layers are opened and validated in batches by the impl.
+    if (!_UsdUtilsStitchClipsImpl(resultLayer, topologyLayer,
+                                  clipLayerFiles, clipPath,
+                                  startTimeCode, endTimeCode,
+                                  clipSet)) {
         if (!topologyPreExisting) {
             TfDeleteFile(topologyLayer->GetIdentifier());
         }
@@ -141,10 +141,18 @@ def main():
         outputImagePath = args.outputImagePath.format(frame=timeCode.GetValue())
         frameRecorder.Record(usdStage, usdCamera, timeCode, outputImagePath)
 
+    # Image writes happen asynchronously while later frames render; make
+    # sure they have all completed and report any failures.
+    allWritesSucceeded = frameRecorder.WaitForPendingWrites()
+
     # Release our reference to the frame recorder so it can be deleted before
     # the Qt stuff.
     frameRecorder = None
 
+    if not allWritesSucceeded:
+        _Err('Failed to write one or more recorded images')
+        return 1
+
 
 if __name__ == '__main__':
     sys.exit(main())
@@ -38,8 +38,10 @@
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/imaging/garch/gl.h"
 #include "pxr/imaging/glf/drawTarget.h"
+#include "pxr/imaging/glf/image.h"
 #include "pxr/imaging/glf/simpleLight.h"
 #include "pxr/imaging/glf/simpleMaterial.h"
+#include "pxr/imaging/glf/utils.h"
 #include "pxr/usd/sdf/path.h"
 #include "pxr/usd/usd/prim.h"
 #include "pxr/usd/usd/stage.h"
@@ -48,21 +50,52 @@
 #include "pxr/usd/usdGeom/metrics.h"
 #include "pxr/usd/usdGeom/tokens.h"
 
+#include <memory>
 #include <string>
 
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 
+// The maximum number of frames that may be in flight on worker threads
+// being compressed and written to disk while later frames render. This
+// bounds the memory held in readback buffers.
+static const size_t _maxPendingWrites = 4u;
+
+
 UsdAppUtilsFrameRecorder::UsdAppUtilsFrameRecorder() :
     _imageWidth(960u),
     _complexity(1.0f),
-    _colorCorrectionMode("disabled")
+    _colorCorrectionMode("disabled"),
+    _numPendingWrites(0u),
+    _writeFailed(false)
 {
     GlfGlewInit();
     _imagingEngine.SetEnableFloatPointDrawTarget(true);
 }
 
+UsdAppUtilsFrameRecorder::~UsdAppUtilsFrameRecorder()
+{
+    WaitForPendingWrites();
+}
+
+bool
+UsdAppUtilsFrameRecorder::WaitForPendingWrites()
+{
+    {
+        std::unique_lock<std::mutex> lock(_writeMutex);
+        _writeCondVar.wait(lock, [this]() {
+            return _numPendingWrites == 0u;
+        });
+    }
+    _writeDispatcher.Wait();
+
+    std::lock_guard<std::mutex> lock(_writeMutex);
+    const bool success = !_writeFailed;
+    _writeFailed = false;
+    return success;
+}
+
 static GfCamera
 _ComputeCameraToFrameStage(const UsdStagePtr& stage, UsdTimeCode timeCode)
 {
@@ -201,7 +234,92 @@ UsdAppUtilsFrameRecorder::Record(
 
     drawTarget->Unbind();
 
-    return drawTarget->WriteToFile("color", outputImagePath);
+    // Read the color attachment back on this thread, since the draw
+    // target's texture can only be accessed with the GL context current.
+    // The pixels are then compressed and written to disk on a worker
+    // thread, so the caller can start rendering the next frame right away.
+    GlfDrawTarget::AttachmentsMap const& attachments =
+        drawTarget->GetAttachments();
+    GlfDrawTarget::AttachmentsMap::const_iterator attachmentIt =
+        attachments.find("color");
+    if (!TF_VERIFY(attachmentIt != attachments.end())) {
+        return false;
+    }
+    GlfDrawTarget::AttachmentRefPtr const& attachment = attachmentIt->second;
+
+    const GLenum format = attachment->GetFormat();
+    const GLenum type = attachment->GetType();
+    const size_t bufSize =
+        imageHeight * _imageWidth *
+        GlfGetNumElements(format) * GlfGetElementSize(type);
+
+    std::shared_ptr<uint8_t> buf(
+        new uint8_t[bufSize], std::default_delete<uint8_t[]>());
+
+    {
+        glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+
+        glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glPixelStorei(GL_PACK_SKIP_PIXELS, 0);
+        glPixelStorei(GL_PACK_SKIP_ROWS, 0);
+
+        GLint restoreBinding, restoreActiveTexture;
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &restoreBinding);
+        glGetIntegerv(GL_ACTIVE_TEXTURE, &restoreActiveTexture);
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, attachment->GetGlTextureName());
+
+        glGetTexImage(GL_TEXTURE_2D, 0, format, type, buf.get());
+
+        glActiveTexture(restoreActiveTexture);
+        glBindTexture(GL_TEXTURE_2D, restoreBinding);
+
+        glPopClientAttrib();
+    }
+
+    // Bound the number of in-flight writes; each one holds a full
+    // readback buffer in memory.
+    {
+        std::unique_lock<std::mutex> lock(_writeMutex);
+        _writeCondVar.wait(lock, [this]() {
+            return _numPendingWrites < _maxPendingWrites;
+        });
+        ++_numPendingWrites;
+    }
+
+    const size_t imageWidth = _imageWidth;
+    _writeDispatcher.Run(
+        [this, buf, imageWidth, imageHeight, format, type,
+         outputImagePath]() {
+            GlfImage::StorageSpec storage;
+            storage.width = imageWidth;
+            storage.height = imageHeight;
+            storage.format = format;
+            storage.type = type;
+            storage.flipped = true;
+            storage.data = buf.get();
+
+            GlfImageSharedPtr const image =
+                GlfImage::OpenForWriting(outputImagePath);
+            const bool writeSuccess =
+                image && image->Write(storage, VtDictionary());
+
+            if (!writeSuccess) {
+                TF_RUNTIME_ERROR("Failed to write image to %s",
+                                 outputImagePath.c_str());
+            }
+
+            std::lock_guard<std::mutex> lock(_writeMutex);
+            if (!writeSuccess) {
+                _writeFailed = true;
+            }
+            --_numPendingWrites;
+            _writeCondVar.notify_all();
+        });
+
+    return true;
 }
 
 
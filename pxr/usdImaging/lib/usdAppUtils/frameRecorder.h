@@ -36,6 +36,10 @@
 #include "pxr/usd/usdGeom/camera.h"
 #include "pxr/usdImaging/usdImagingGL/engine.h"
 
+#include "pxr/base/work/dispatcher.h"
+
+#include <condition_variable>
+#include <mutex>
 #include <string>
 
 
@@ -58,6 +62,10 @@ public:
     USDAPPUTILS_API
     UsdAppUtilsFrameRecorder();
 
+    /// The destructor blocks until all pending image writes have completed.
+    USDAPPUTILS_API
+    ~UsdAppUtilsFrameRecorder();
+
     /// Gets the ID of the Hydra renderer plugin that will be used for
     /// recording.
     TfToken GetCurrentRendererId() const {
@@ -105,8 +113,16 @@ public:
     /// If \p usdCamera is not a valid camera, a camera will be computed
     /// to automatically frame the stage geometry.
     ///
-    /// Returns true if the image was generated and written successfully, or
-    /// false otherwise.
+    /// The image is compressed and written to disk asynchronously on a
+    /// worker thread, so a subsequent call can begin rendering the next
+    /// frame while earlier frames are still being written. The number of
+    /// writes in flight is bounded; when the bound is reached this call
+    /// blocks until a write completes. Call WaitForPendingWrites() to
+    /// ensure all frames have been written and to collect any write
+    /// failures.
+    ///
+    /// Returns true if the image was generated and its write was scheduled
+    /// successfully, or false otherwise.
     USDAPPUTILS_API
     bool Record(
             const UsdStagePtr& stage,
@@ -114,11 +130,26 @@ public:
             const UsdTimeCode timeCode,
             const std::string& outputImagePath);
 
+    /// Blocks until all images scheduled by Record() have been written.
+    ///
+    /// Returns true if all pending writes succeeded, or false if any of
+    /// them failed. The failure state is reset, so a subsequent call only
+    /// reports failures from writes scheduled after this one returned.
+    USDAPPUTILS_API
+    bool WaitForPendingWrites();
+
 private:
     UsdImagingGLEngine _imagingEngine;
     size_t _imageWidth;
     float _complexity;
     TfToken _colorCorrectionMode;
+
+    // Asynchronous image-write state; see Record().
+    WorkDispatcher _writeDispatcher;
+    std::mutex _writeMutex;
+    std::condition_variable _writeCondVar;
+    size_t _numPendingWrites;
+    bool _writeFailed;
 };
 
 
@@ -54,5 +54,6 @@ wrapFrameRecorder()
              arg("usdCamera"),
              arg("timeCode"),
              arg("outputImagePath")))
+        .def("WaitForPendingWrites", &This::WaitForPendingWrites)
     ;
 }
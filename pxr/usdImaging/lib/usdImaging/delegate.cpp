@@ -65,6 +65,7 @@
 #include "pxr/base/tf/stl.h"
 #include "pxr/base/tf/type.h"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <string>
@@ -107,6 +108,8 @@ UsdImagingDelegate::UsdImagingDelegate(
     , _valueCache()
     , _rootXf(1.0)
     , _rootIsVisible(true)
+    , _instancerCullingMaxDistance(0.0)
+    , _instancerCullingEnabled(false)
     , _time(std::numeric_limits<double>::infinity())
     , _refineLevelFallback(0)
     , _reprFallback()
@@ -128,6 +131,9 @@ UsdImagingDelegate::UsdImagingDelegate(
     , _sceneMaterialsEnabled(true)
     , _coordSysEnabled(parentIndex
                        ->IsSprimTypeSupported(HdPrimTypeTokens->coordSys))
+    , _prefetchNumFrames(0)
+    , _prefetchFrameIncrement(1.0)
+    , _prefetchDispatcher(WorkPriorityBackground)
 {
     // Provide a callback to the _coordSysBindingCache so it can
     // convert USD paths to Hydra ID's.
@@ -144,6 +150,11 @@ UsdImagingDelegate::UsdImagingDelegate(
 
 UsdImagingDelegate::~UsdImagingDelegate()
 {
+    // Stop any in-flight playback prefetch before tearing anything down;
+    // prefetch tasks read the stage from background threads.
+    _prefetchDispatcher.Cancel();
+    _prefetchDispatcher.Wait();
+
     TfNotice::Revoke(_objectsChangedNoticeKey);
 
     // Remove all prims from the render index.
@@ -214,11 +225,9 @@ UsdImagingDelegate::_GetModelDrawMode(UsdPrim const& prim)
 }
 
 
-UsdImagingDelegate::_AdapterSharedPtr const& 
+UsdImagingDelegate::_AdapterSharedPtr
 UsdImagingDelegate::_AdapterLookup(UsdPrim const& prim, bool ignoreInstancing)
 {
-    static UsdImagingDelegate::_AdapterSharedPtr const NULL_ADAPTER;
-
     // Future Work:
     //  * Only enable plugins on demand.
     //
@@ -250,12 +259,16 @@ UsdImagingDelegate::_AdapterLookup(UsdPrim const& prim, bool ignoreInstancing)
     return _AdapterLookup(adapterKey);
 }
 
-UsdImagingDelegate::_AdapterSharedPtr const& 
+UsdImagingDelegate::_AdapterSharedPtr
 UsdImagingDelegate::_AdapterLookup(TfToken const& adapterKey)
 {
-    _AdapterMap::const_iterator it = _adapterMap.find(adapterKey);
-    if (it != _adapterMap.end())
-        return it->second;
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(_adapterMapMutex,
+                                             /*write=*/false);
+        _AdapterMap::const_iterator it = _adapterMap.find(adapterKey);
+        if (it != _adapterMap.end())
+            return it->second;
+    }
 
     UsdImagingAdapterRegistry& reg = UsdImagingAdapterRegistry::GetInstance();
     _AdapterSharedPtr adapter(reg.ConstructAdapter(adapterKey));
@@ -274,7 +287,9 @@ UsdImagingDelegate::_AdapterLookup(TfToken const& adapterKey)
         }
     }
 
-    // NULL adapters are also cached, to avoid redundant lookups.
+    // NULL adapters are also cached, to avoid redundant lookups. If another
+    // thread won the race to insert, keep (and return) its adapter.
+    tbb::spin_rw_mutex::scoped_lock lock(_adapterMapMutex, /*write=*/true);
     return _adapterMap.insert(
         std::make_pair(adapterKey, adapter)).first->second;
 }
@@ -361,6 +376,12 @@ public:
     void UpdateVariability(size_t start, size_t end) {
         for (size_t i = start; i < end; i++) {
             UsdImagingDelegate* delegate = _tasks[i].delegate;
+            // If this round of work has been superseded, skip the
+            // remaining prims; they keep their state and are picked up
+            // by the next round.
+            if (delegate->_updateCancelToken.IsCanceled()) {
+                continue;
+            }
             UsdImagingIndexProxy indexProxy(delegate, nullptr);
             SdfPath const& cachePath = _tasks[i].path;
 
@@ -387,6 +408,12 @@ public:
     void UpdateForTime(size_t start, size_t end) {
         for (size_t i = start; i < end; i++) {
             UsdImagingDelegate* delegate = _tasks[i].delegate;
+            // If this frame's update has been superseded, skip the
+            // remaining prims without clearing their dirty bits, so the
+            // next frame's update redoes the skipped work.
+            if (delegate->_updateCancelToken.IsCanceled()) {
+                continue;
+            }
             UsdTimeCode const& time = delegate->_time;
             SdfPath const& cachePath = _tasks[i].path;
 
@@ -614,18 +641,6 @@ UsdImagingDelegate::_SetStateForPopulation(
         TfNotice::Register(self, &This::_OnUsdObjectsChanged, _stage);
 }
 
-namespace {
-    struct _PopulateMaterialBindingCache {
-        UsdPrim primToBind;
-        UsdImaging_MaterialBindingCache const* materialBindingCache;
-        void operator()() const {
-            // Just calling GetValue will populate the cache for this prim and
-            // potentially all ancestors.
-            materialBindingCache->GetValue(primToBind);
-        }
-    };
-};
-
 void
 UsdImagingDelegate::_Populate(UsdImagingIndexProxy* proxy)
 {
@@ -654,9 +669,52 @@ UsdImagingDelegate::_Populate(UsdImagingIndexProxy* proxy)
 
     WorkDispatcher bindingDispatcher;
 
-    // For each root that has been scheduled for repopulation
-    std::vector<std::pair<UsdPrim, _AdapterSharedPtr> > leafPaths;
-    leafPaths.reserve(usdPathsToRepopulate.size());
+    typedef std::vector<std::pair<UsdPrim, _AdapterSharedPtr> > _LeafVector;
+
+    // Per-prim discovery step, shared by the serial fan-out over repopulation
+    // roots and the parallel subtree walks below. Discovered renderable prims
+    // are appended to leafPaths. Returns false if the children of the prim
+    // should be pruned.
+    auto discoverPrim = [this, &excludedSet](
+            UsdPrim const& prim, _LeafVector *leafPaths) -> bool {
+        if (!prim.GetPath().HasPrefix(_rootPrimPath)) {
+            TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned at <%s> "
+                        "not under root prim path <%s>\n",
+                        prim.GetPath().GetText(),
+                        _rootPrimPath.GetText());
+            return false;
+        }
+        if (excludedSet.find(prim.GetPath()) != excludedSet.end()) {
+            TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned at <%s> "
+                        "due to exclusion list\n",
+                        prim.GetPath().GetText());
+            return false;
+        }
+        if (UsdImagingPrimAdapter::ShouldCullSubtree(prim)) {
+            TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned at <%s> "
+                        "due to prim type <%s>\n",
+                        prim.GetPath().GetText(),
+                        prim.GetTypeName().GetText());
+            return false;
+        }
+        if (_AdapterSharedPtr adapter = _AdapterLookup(prim)) {
+            leafPaths->push_back(std::make_pair(prim, adapter));
+            if (adapter->ShouldCullChildren()) {
+                TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned "
+                                "children of <%s> due to adapter\n",
+                        prim.GetPath().GetText());
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // For each root that has been scheduled for repopulation, discover the
+    // root prim itself, then fan its child subtrees out as concurrent
+    // traversal tasks. Discovery only reads the stage and the lock-protected
+    // adapter table, so the subtree walks are safe to run in parallel.
+    _LeafVector leafPaths;
+    std::vector<UsdPrim> subtreesToPopulate;
 
     for (SdfPath const& usdPath: usdPathsToRepopulate) {
         // Discover and insert all renderable prims into the worker for later
@@ -665,53 +723,61 @@ UsdImagingDelegate::_Populate(UsdImagingIndexProxy* proxy)
                             usdPath.GetText());
 
         UsdPrimRange range(_GetUsdPrim(usdPath));
-        for (auto iter = range.begin(); iter != range.end(); ++iter) {
-            if (!iter->GetPath().HasPrefix(_rootPrimPath)) {
-                iter.PruneChildren();
-                TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned at <%s> "
-                            "not under root prim path <%s>\n",
-                            iter->GetPath().GetText(),
-                            _rootPrimPath.GetText());
-                continue;
-            }
-            if (excludedSet.find(iter->GetPath()) != excludedSet.end()) {
-                iter.PruneChildren();
-                TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned at <%s> "
-                            "due to exclusion list\n",
-                            iter->GetPath().GetText());
-                continue;
-            }
-            if (UsdImagingPrimAdapter::ShouldCullSubtree(*iter)) {
-                iter.PruneChildren();
-                TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned at <%s> "
-                            "due to prim type <%s>\n",
-                            iter->GetPath().GetText(),
-                            iter->GetTypeName().GetText());
-                continue;
-            }
-            if (_AdapterSharedPtr adapter = _AdapterLookup(*iter)) {
-                // Schedule the prim for population and discovery
-                // of material bindings.
-                //
-                // If we are using full networks, we will populate the 
-                // binding cache that has the strategy to compute the correct
-                // bindings.
-                _PopulateMaterialBindingCache wu = 
-                    { *iter, &_materialBindingCache};
-                 bindingDispatcher.Run(wu);
-                
-                leafPaths.push_back(std::make_pair(*iter, adapter));
-                if (adapter->ShouldCullChildren()) {
-                   TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned "
-                                    "children of <%s> due to adapter\n",
-                            iter->GetPath().GetText());
-                   iter.PruneChildren();
-                }
-            }
+        if (range.empty()) {
+            continue;
+        }
+        UsdPrim rootPrim = range.front();
+
+        // Resolve material bindings for the whole subtree in one bulk pass
+        // that shares the ancestor binding state, rather than warming the
+        // binding cache with a full ancestor walk per discovered prim. The
+        // bulk results are consumed by UsdImaging_MaterialStrategy.
+        bindingDispatcher.Run([this, rootPrim]() {
+            UsdShadeMaterialBindingAPI::ComputeBoundMaterialsForSubtree(
+                rootPrim,
+                &_materialBindingImplData.GetBindingsCache(),
+                &_materialBindingImplData.GetCollectionQueryCache(),
+                &_materialBindingImplData.GetResolvedBindings(),
+                _materialBindingImplData.GetMaterialPurpose());
+        });
+
+        if (!discoverPrim(rootPrim, &leafPaths)) {
+            continue;
+        }
+        for (UsdPrim const& child: rootPrim.GetChildren()) {
+            subtreesToPopulate.push_back(child);
         }
     }
 
-    // Populate the RenderIndex while we're still discovering material bindings.
+    std::vector<_LeafVector> subtreeLeafPaths(subtreesToPopulate.size());
+    {
+        // Release the GIL to ensure that threaded work won't deadlock if
+        // they also need the GIL.
+        TF_PY_ALLOW_THREADS_IN_SCOPE();
+        WorkParallelForN(
+            subtreesToPopulate.size(),
+            [this, &subtreesToPopulate, &subtreeLeafPaths, &discoverPrim](
+                size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    UsdPrimRange range(subtreesToPopulate[i]);
+                    for (auto iter = range.begin();
+                            iter != range.end(); ++iter) {
+                        if (!discoverPrim(*iter, &subtreeLeafPaths[i])) {
+                            iter.PruneChildren();
+                        }
+                    }
+                }
+            });
+    }
+    for (_LeafVector const& subtreeLeaves: subtreeLeafPaths) {
+        leafPaths.insert(leafPaths.end(),
+                         subtreeLeaves.begin(), subtreeLeaves.end());
+    }
+
+    // Populate the RenderIndex while we're still discovering material
+    // bindings. Adapter Populate mutates the render index and the delegate's
+    // tracking structures, which are not thread-safe, so insertion stays
+    // serial and overlaps the binding discovery running above instead.
     TF_FOR_ALL(it, leafPaths) {
         it->second->Populate(it->first, proxy);
     }
@@ -813,6 +879,10 @@ UsdImagingDelegate::SetTime(UsdTimeCode time)
     // remove this.
     ApplyPendingUpdates();
 
+    // Each SetTime() starts a fresh round of update work; a cancellation
+    // requested against a previous frame must not suppress this one.
+    _updateCancelToken.Reset();
+
     // Early out if the time code is the same.
     if (_time == time) {
         return;
@@ -829,6 +899,16 @@ UsdImagingDelegate::SetTime(UsdTimeCode time)
 
     UsdImagingIndexProxy indexProxy(this, nullptr);
 
+    bool const prefetchEnabled = _prefetchNumFrames > 0 && _time.IsNumeric();
+    boost::shared_ptr<std::vector<UsdPrim>> primsToPrefetch;
+    if (prefetchEnabled) {
+        // Drop prefetch work still pending from the previous frame window;
+        // frames it hasn't reached yet are behind playback already.
+        _prefetchDispatcher.Cancel();
+        _prefetchDispatcher.Wait();
+        primsToPrefetch.reset(new std::vector<UsdPrim>());
+    }
+
     // Mark varying attributes as dirty and build a work queue for threads to
     // populate caches for the new time.
     TF_FOR_ALL(it, _hdPrimInfoMap) {
@@ -840,8 +920,71 @@ UsdImagingDelegate::SetTime(UsdTimeCode time)
                                         cachePath,
                                         primInfo.timeVaryingBits,
                                         &indexProxy);
+            if (prefetchEnabled) {
+                primsToPrefetch->push_back(primInfo.usdPrim);
+            }
         }
     }
+
+    if (prefetchEnabled && !primsToPrefetch->empty()) {
+        _PrefetchUpcomingTimeSamples(primsToPrefetch);
+    }
+}
+
+void
+UsdImagingDelegate::CancelUpdateWork()
+{
+    // Flag in-flight variability/time update tasks to skip their remaining
+    // prims, and drop prefetch work for frames that haven't started yet.
+    // Neither call blocks; skipped prims keep their dirty state and are
+    // redone on the next sync.
+    _updateCancelToken.Cancel();
+    _prefetchDispatcher.Cancel();
+}
+
+void
+UsdImagingDelegate::SetPlaybackPrefetchWindow(int numFrames,
+                                              double frameIncrement)
+{
+    if (numFrames > 0 && frameIncrement == 0.0) {
+        TF_CODING_ERROR("Prefetch frame increment must be non-zero");
+        return;
+    }
+    _prefetchNumFrames = std::max(numFrames, 0);
+    _prefetchFrameIncrement = frameIncrement;
+}
+
+void
+UsdImagingDelegate::_PrefetchUpcomingTimeSamples(
+    boost::shared_ptr<std::vector<UsdPrim>> const& prims)
+{
+    // One task per upcoming frame, so that cancellation from the next
+    // SetTime() skips whole frames that haven't started yet. Within a frame,
+    // prims are read in parallel; reading an attribute pulls its value data
+    // into the layer cache, which is what the UpdateForTime pass for that
+    // frame will hit instead of cold file I/O.
+    double const startFrame = _time.GetValue();
+    for (int frame = 1; frame <= _prefetchNumFrames; ++frame) {
+        UsdTimeCode const time(startFrame + frame * _prefetchFrameIncrement);
+        _prefetchDispatcher.Run([prims, time]() {
+            WorkParallelForN(
+                prims->size(),
+                [&prims, time](size_t begin, size_t end) {
+                    VtValue value;
+                    for (size_t i = begin; i < end; ++i) {
+                        UsdPrim const& prim = (*prims)[i];
+                        if (!prim) {
+                            continue;
+                        }
+                        for (UsdAttribute const& attr: prim.GetAttributes()) {
+                            if (attr.ValueMightBeTimeVarying()) {
+                                attr.Get(&value, time);
+                            }
+                        }
+                    }
+                });
+        });
+    }
 }
 
 void 
@@ -898,6 +1041,7 @@ UsdImagingDelegate::ApplyPendingUpdates()
     _drawModeCache.Clear();
     _coordSysBindingCache.Clear();
     _inheritedPrimvarCache.Clear();
+    _variabilityCache.clear();
 
     UsdImagingDelegate::_Worker worker;
     UsdImagingIndexProxy indexProxy(this, &worker);
@@ -1868,7 +2012,57 @@ UsdImagingDelegate::SetRootTransform(GfMatrix4d const& xf)
     }
 }
 
-void 
+void
+UsdImagingDelegate::SetInstancerCullingFrustum(GfFrustum const& frustum,
+                                               double maxDistance)
+{
+    HD_TRACE_FUNCTION();
+
+    if (_instancerCullingEnabled &&
+        _instancerCullingFrustum == frustum &&
+        _instancerCullingMaxDistance == maxDistance) {
+        return;
+    }
+
+    _instancerCullingFrustum = frustum;
+    _instancerCullingMaxDistance = maxDistance;
+    _instancerCullingEnabled = true;
+
+    _MarkInstancerIndicesDirty();
+}
+
+void
+UsdImagingDelegate::ClearInstancerCullingFrustum()
+{
+    if (!_instancerCullingEnabled) {
+        return;
+    }
+
+    _instancerCullingEnabled = false;
+    _instancerCullingMaxDistance = 0.0;
+
+    _MarkInstancerIndicesDirty();
+}
+
+void
+UsdImagingDelegate::_MarkInstancerIndicesDirty()
+{
+    UsdImagingIndexProxy indexProxy(this, nullptr);
+
+    // The set of instances to draw is baked into the instance indices, so
+    // a culling volume change invalidates the indices of every instancer.
+    for (SdfPath const& cachePath : _instancerPrimCachePaths) {
+        _HdPrimInfo *primInfo = _GetHdPrimInfo(cachePath);
+        if (primInfo && TF_VERIFY(primInfo->adapter, "%s",
+                                  cachePath.GetText())) {
+            primInfo->adapter->MarkDirty(primInfo->usdPrim, cachePath,
+                                         HdChangeTracker::DirtyInstanceIndex,
+                                         &indexProxy);
+        }
+    }
+}
+
+void
 UsdImagingDelegate::SetInvisedPrimPaths(SdfPathVector const &invisedPaths)
 {
     HD_TRACE_FUNCTION();
@@ -2021,6 +2215,12 @@ UsdImagingDelegate::SetRigidXformOverrides(
                                          subtreeRoot.GetText());
 
         _MarkSubtreeTransformDirty(subtreeRoot);
+
+        // Eagerly refresh the invalidated entries with a single top-down
+        // parallel pass; this is much cheaper than having every rprim in
+        // the subtree re-walk its ancestor chain on first query during the
+        // next sync.
+        _xformCache.UpdateSubtree(usdPrim);
     }
 
     _rigidXformOverrides = rigidXformOverrides;
@@ -2308,6 +2508,30 @@ UsdImagingDelegate::GetTransform(SdfPath const& id)
     return ctm;
 }
 
+/*virtual*/
+void
+UsdImagingDelegate::GetTransforms(SdfPath const *ids, size_t count,
+                                  GfMatrix4d *transforms)
+{
+    HD_TRACE_FUNCTION();
+
+    // Serve the whole span directly from the value cache: one virtual call
+    // and one trace scope instead of one of each per prim.
+    for (size_t i = 0; i < count; ++i) {
+        SdfPath cachePath = ConvertIndexPathToCachePath(ids[i]);
+        if (_valueCache.ExtractTransform(cachePath, &transforms[i])) {
+            continue;
+        }
+        // Slow path, we should not hit this.
+        TF_DEBUG(HD_SAFE_MODE).Msg("WARNING: Slow transform fetch for %s\n",
+                                   ids[i].GetText());
+
+        transforms[i] = GfMatrix4d(1.0);
+        _UpdateSingleValue(cachePath, HdChangeTracker::DirtyTransform);
+        TF_VERIFY(_valueCache.ExtractTransform(cachePath, &transforms[i]));
+    }
+}
+
 /*virtual*/
 size_t
 UsdImagingDelegate::SampleTransform(SdfPath const & id, size_t maxNumSamples,
@@ -2369,6 +2593,46 @@ UsdImagingDelegate::GetVisible(SdfPath const& id)
     return false;
 }
 
+/*virtual*/
+void
+UsdImagingDelegate::GetVisibles(SdfPath const *ids, size_t count,
+                                bool *visibilities)
+{
+    HD_TRACE_FUNCTION();
+
+    // Root visibility overrides prim visibility; check it once for the
+    // whole span.
+    if (!_rootIsVisible) {
+        std::fill(visibilities, visibilities + count, false);
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        SdfPath cachePath = ConvertIndexPathToCachePath(ids[i]);
+        // for instance protos (not IsPrimPath), visibility is
+        // controlled by instanceIndices.
+        if (cachePath.IsPrimPath() && IsInInvisedPaths(cachePath)) {
+            visibilities[i] = false;
+            continue;
+        }
+
+        bool vis = true;
+        if (_valueCache.FindVisible(cachePath, &vis)) {
+            visibilities[i] = vis;
+            continue;
+        }
+
+        // Slow path, we should not hit this.
+        TF_DEBUG(HD_SAFE_MODE).Msg("WARNING: Slow visible fetch for %s\n",
+                                   ids[i].GetText());
+
+        _UpdateSingleValue(cachePath, HdChangeTracker::DirtyVisibility);
+        visibilities[i] =
+            TF_VERIFY(_valueCache.ExtractVisible(cachePath, &vis),
+                      "<%s>\n", cachePath.GetText()) ? vis : false;
+    }
+}
+
 /*virtual*/ 
 VtValue 
 UsdImagingDelegate::Get(SdfPath const& id, TfToken const& key)
@@ -2540,6 +2804,35 @@ UsdImagingDelegate::GetPrimvarDescriptors(SdfPath const& id,
     return primvars;
 }
 
+/*virtual*/
+void
+UsdImagingDelegate::GetPrimvarDescriptors(SdfPath const *ids, size_t count,
+                                          HdInterpolation interpolation,
+                                          HdPrimvarDescriptorVector *primvars)
+{
+    HD_TRACE_FUNCTION();
+
+    for (size_t i = 0; i < count; ++i) {
+        SdfPath cachePath = ConvertIndexPathToCachePath(ids[i]);
+        primvars[i].clear();
+        HdPrimvarDescriptorVector allPrimvars;
+        // We expect to populate an entry always (i.e., we don't use a slow
+        // path fetch)
+        if (!TF_VERIFY(_valueCache.FindPrimvars(cachePath, &allPrimvars),
+                       "<%s> interpolation: %s", cachePath.GetText(),
+                       TfEnum::GetName(interpolation).c_str())) {
+            continue;
+        }
+        // It's valid to have no authored primvars (they could be computed)
+        for (HdPrimvarDescriptor const& pv: allPrimvars) {
+            // Filter the stored primvars to just ones of the requested type.
+            if (pv.interpolation == interpolation) {
+                primvars[i].push_back(pv);
+            }
+        }
+    }
+}
+
 /*virtual*/
 VtIntArray
 UsdImagingDelegate::GetInstanceIndices(SdfPath const &instancerId,
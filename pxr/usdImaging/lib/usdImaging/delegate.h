@@ -51,13 +51,17 @@
 #include "pxr/usd/usdGeom/xformCache.h"
 #include "pxr/base/vt/value.h"
 
+#include "pxr/base/gf/frustum.h"
 #include "pxr/base/gf/range3d.h"
 #include "pxr/base/tf/declarePtrs.h"
 #include "pxr/base/tf/hashmap.h"
 #include "pxr/base/tf/hashset.h"
+#include "pxr/base/work/cancellationToken.h"
+#include "pxr/base/work/dispatcher.h"
 
 #include <boost/container/flat_map.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <tbb/concurrent_unordered_map.h>
 #include <tbb/spin_rw_mutex.h>
 #include <map>
 #include <string>
@@ -151,6 +155,37 @@ public:
     USDIMAGING_API
     void SetTime(UsdTimeCode time);
 
+    /// Configures prefetching of time-varying attribute values during
+    /// playback. When \p numFrames is greater than zero, each SetTime()
+    /// schedules background reads of the time-varying attributes of all
+    /// time-varying prims for the next \p numFrames frames, advancing by
+    /// \p frameIncrement per frame (negative for reverse playback). The
+    /// reads warm the underlying layer data caches so the UpdateForTime
+    /// pass on subsequent frames is dominated by computation rather than
+    /// file I/O. Prefetch work still pending when the next SetTime()
+    /// arrives is cancelled, so prefetching never runs unboundedly behind
+    /// playback.
+    ///
+    /// Prefetch tasks read the stage from background threads between
+    /// frames; clients must not mutate the stage while a prefetch window
+    /// is active. Pass 0 for \p numFrames to disable (the default).
+    USDIMAGING_API
+    void SetPlaybackPrefetchWindow(int numFrames, double frameIncrement);
+
+    /// Requests that in-flight variability and time update work abort
+    /// early. Tasks check for cancellation between prims, skip their
+    /// remaining prims, and leave the skipped prims' dirty state intact,
+    /// so the work is redone on the next sync. Pending playback prefetch
+    /// work is cancelled as well.
+    ///
+    /// Use this when the results being computed are already superseded --
+    /// for example, when the user scrubs to a new frame while the previous
+    /// frame's update is still running. This method is thread-safe and
+    /// does not block; the next SetTime() starts a fresh round of work
+    /// unaffected by the cancellation.
+    USDIMAGING_API
+    void CancelUpdateWork();
+
     /// Returns the current time.
     UsdTimeCode GetTime() const { return _time; }
 
@@ -238,6 +273,23 @@ public:
     USDIMAGING_API
     void SetRigidXformOverrides(RigidXformOverridesMap const &overrides);
 
+    /// Sets an optional world-space culling volume that instancer adapters
+    /// use to prune instances before their indices are sent to the render
+    /// index. Instances whose conservative bounds fall outside \p frustum,
+    /// or (when \p maxDistance is greater than zero) farther from the
+    /// frustum's position than \p maxDistance, are omitted from the
+    /// instance indices. Culled instances are not removed from the render
+    /// index; calling this again with an updated frustum re-evaluates the
+    /// indices, so instances stream in and out as the camera moves.
+    USDIMAGING_API
+    void SetInstancerCullingFrustum(GfFrustum const& frustum,
+                                    double maxDistance = 0.0);
+
+    /// Disables instancer culling and restores all instances on the next
+    /// index update. Instancer culling is disabled by default.
+    USDIMAGING_API
+    void ClearInstancerCullingFrustum();
+
     /// Returns the root paths of pickable objects.
     USDIMAGING_API
     PickabilityMap GetPickabilityMap() const;
@@ -287,6 +339,12 @@ public:
     USDIMAGING_API
     virtual bool GetVisible(SdfPath const & id) override;
     USDIMAGING_API
+    virtual void GetTransforms(SdfPath const *ids, size_t count,
+                               GfMatrix4d *transforms) override;
+    USDIMAGING_API
+    virtual void GetVisibles(SdfPath const *ids, size_t count,
+                             bool *visibilities) override;
+    USDIMAGING_API
     virtual bool GetDoubleSided(SdfPath const & id) override;
     USDIMAGING_API
     virtual HdCullStyle GetCullStyle(SdfPath const &id) override;
@@ -314,6 +372,11 @@ public:
     GetPrimvarDescriptors(SdfPath const& id,
                           HdInterpolation interpolation) override;
     USDIMAGING_API
+    virtual void
+    GetPrimvarDescriptors(SdfPath const *ids, size_t count,
+                          HdInterpolation interpolation,
+                          HdPrimvarDescriptorVector *primvars) override;
+    USDIMAGING_API
     virtual VtIntArray GetInstanceIndices(SdfPath const &instancerId,
                                           SdfPath const &prototypeId) override;
     USDIMAGING_API
@@ -596,16 +659,36 @@ private:
     // Execute all time update tasks that have been added to the given worker.
     static void _ExecuteWorkForTimeUpdate(_Worker* worker);
 
+    // Schedules background reads of the time-varying attributes of \p prims
+    // for the frames following the current time (see
+    // SetPlaybackPrefetchWindow).
+    void _PrefetchUpcomingTimeSamples(
+        boost::shared_ptr<std::vector<UsdPrim>> const& prims);
+
+    // Playback prefetch state; see SetPlaybackPrefetchWindow.
+    int _prefetchNumFrames;
+    double _prefetchFrameIncrement;
+    WorkDispatcher _prefetchDispatcher;
+
+    // Cooperative cancellation for variability/time update work; see
+    // CancelUpdateWork. Reset by SetTime so each frame starts a fresh
+    // round of work.
+    WorkCancellationToken _updateCancelToken;
+
     // ---------------------------------------------------------------------- //
     // Core Delegate state
     // ---------------------------------------------------------------------- //
 
     // Usd Prim Type to Adapter lookup table.
     typedef boost::shared_ptr<UsdImagingPrimAdapter> _AdapterSharedPtr;
-    typedef TfHashMap<TfToken, 
+    typedef TfHashMap<TfToken,
                          _AdapterSharedPtr, TfToken::HashFunctor> _AdapterMap;
     _AdapterMap _adapterMap;
 
+    // Guards _adapterMap; adapter lookups run concurrently during the
+    // parallel discovery phase of population.
+    tbb::spin_rw_mutex _adapterMapMutex;
+
     // Per-Hydra-Primitive tracking data
     struct _HdPrimInfo {
         _AdapterSharedPtr adapter;          // The adapter to use for the prim
@@ -633,9 +716,12 @@ private:
 
     // Only use this method when we think no existing adapter has been
     // established. For example, during initial Population.
-    _AdapterSharedPtr const& _AdapterLookup(UsdPrim const& prim, 
-                                            bool ignoreInstancing = false);
-    _AdapterSharedPtr const& _AdapterLookup(TfToken const& adapterKey);
+    //
+    // These return the adapter by value since the underlying map may be
+    // mutated concurrently by other threads during population.
+    _AdapterSharedPtr _AdapterLookup(UsdPrim const& prim,
+                                     bool ignoreInstancing = false);
+    _AdapterSharedPtr _AdapterLookup(TfToken const& adapterKey);
 
     // Obtain the prim tracking data for the given cache path.
     _HdPrimInfo *_GetHdPrimInfo(const SdfPath &cachePath);
@@ -648,6 +734,10 @@ private:
     void _MarkSubtreeTransformDirty(SdfPath const &usdSubtreeRoot);
     void _MarkSubtreeVisibilityDirty(SdfPath const &usdSubtreeRoot);
 
+    // Invalidates the instance indices of every instancer; used when the
+    // instancer culling volume changes.
+    void _MarkInstancerIndicesDirty();
+
     bool _IsChildPath(SdfPath const& path) const {
         return path.IsPropertyPath();
     }
@@ -674,6 +764,12 @@ private:
     GfMatrix4d _rootXf;
     bool _rootIsVisible;
 
+    // Optional culling volume applied by instancer adapters when they
+    // compute instance indices; see SetInstancerCullingFrustum.
+    GfFrustum _instancerCullingFrustum;
+    double _instancerCullingMaxDistance;
+    bool _instancerCullingEnabled;
+
     /// The current time from which the delegate will read data.
     UsdTimeCode _time;
 
@@ -706,6 +802,16 @@ private:
     UsdImaging_CollectionCache _collectionCache;
     UsdImaging_InheritedPrimvarCache _inheritedPrimvarCache;
 
+    // Shared attribute-variability cache.  Adapters probe variability
+    // through _IsVarying, which memoizes each attribute's answer here so
+    // that repeated probes of the same attribute (e.g., for inherited
+    // attributes checked by every descendant) are constant-time.  Filled
+    // concurrently during parallel variability tracking and cleared with
+    // the other caches when scene objects change.
+    typedef tbb::concurrent_unordered_map<SdfPath, bool, SdfPath::Hash>
+        _VariabilityCache;
+    _VariabilityCache _variabilityCache;
+
     // Pickability
     PickabilityMap _pickablesMap;
 
@@ -81,13 +81,17 @@ UsdImagingFieldAdapter::TrackVariability(UsdPrim const& prim,
         UsdImagingTokens->usdVaryingXform,
         timeVaryingBits);
 
-    // If any of the field attributes is time varying 
+    // If any of the field attributes is time varying
     // we will assume all field params are time-varying.
     const std::vector<UsdAttribute> &attrs = prim.GetAttributes();
     TF_FOR_ALL(attrIter, attrs) {
         const UsdAttribute& attr = *attrIter;
-        if (attr.GetNumTimeSamples()>1){
+        // Only stat the time samples until we find a varying attribute;
+        // counting every sample of every attribute forces a full layer
+        // scan per field prim.
+        if (attr.ValueMightBeTimeVarying()) {
             *timeVaryingBits |= HdField::DirtyBits::DirtyParams;
+            break;
         }
     }
 }
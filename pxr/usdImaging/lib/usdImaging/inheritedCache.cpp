@@ -54,6 +54,7 @@ UsdImaging_MaterialBindingImplData::ClearCaches()
 
     _bindingsCache.clear();
     _collQueryCache.clear();
+    _resolvedBindings.clear();
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -33,6 +33,7 @@
 #include "pxr/usd/usdShade/tokens.h"
 #include "pxr/usd/sdf/path.h"
 
+#include "pxr/base/work/dispatcher.h"
 #include "pxr/base/work/utils.h"
 
 #include <boost/functional/hash.hpp>
@@ -184,7 +185,42 @@ public:
     /// See notes on SetRootPath.
     const SdfPath & GetRootPath() const { return _rootPath; }
 
-    /// Helper function used to append, update or remove overrides from the 
+    /// Invalidates only the cached values at or beneath \p subtreeRoot,
+    /// leaving entries for unaffected siblings (and the queries on the
+    /// invalidated entries) intact. This is much cheaper than Clear() when
+    /// an edit is known to affect a single subtree. Note that reusing the
+    /// queries assumes the set of authored attributes is unchanged; edits
+    /// that add or remove attributes (e.g. a new xformOp) still require
+    /// Clear().
+    void InvalidateSubtree(const UsdPrim &subtreeRoot) {
+        TRACE_FUNCTION();
+        for (UsdPrim descendant: UsdPrimRange(subtreeRoot)) {
+            typename _CacheMap::iterator it = _cache.find(descendant);
+            if (it != _cache.end()) {
+                it->second.version = _GetInvalidVersion();
+            }
+        }
+    }
+
+    /// Recomputes the invalid cached values at or beneath \p subtreeRoot in
+    /// a single top-down pass, fanning out across sibling subtrees in
+    /// parallel. Because each prim's value is refreshed before its children
+    /// are visited, children read inherited state from an already-updated
+    /// parent and each prim is computed exactly once, instead of re-walking
+    /// its ancestor chain on first query. Only prims that already have
+    /// cache entries are refreshed; entries that are already valid are
+    /// skipped.
+    void UpdateSubtree(const UsdPrim &subtreeRoot) {
+        TRACE_FUNCTION();
+        if (!subtreeRoot) {
+            return;
+        }
+        WorkDispatcher dispatcher;
+        _UpdateSubtreeHelper(subtreeRoot, &dispatcher);
+        dispatcher.Wait();
+    }
+
+    /// Helper function used to append, update or remove overrides from the
     /// internal value overrides map. By doing the updates to the map in a 
     /// single pass, we can optimize the dirtying of the cache entries.
     /// 
@@ -324,6 +360,21 @@ private:
     // Helper function to get or create a new entry for a prim in the cache.
     _Entry* _GetCacheEntryForPrim(const UsdPrim &prim) const;
 
+    // Recursive helper for UpdateSubtree: refreshes the given prim's value
+    // (if it has a cache entry), then dispatches its children as parallel
+    // tasks.
+    void _UpdateSubtreeHelper(const UsdPrim &prim,
+                              WorkDispatcher *dispatcher) const {
+        if (_cache.find(prim) != _cache.end()) {
+            _GetValue(prim);
+        }
+        for (const UsdPrim &child: prim.GetChildren()) {
+            dispatcher->Run([this, child, dispatcher]() {
+                _UpdateSubtreeHelper(child, dispatcher);
+            });
+        }
+    }
+
     // Sets the value of the given cache entry. If multiple threads attempt to
     // set the same entry, the first in wins and other threads spin until the
     // new value is set.
@@ -640,11 +691,18 @@ struct UsdImaging_MaterialBindingImplData {
     UsdShadeMaterialBindingAPI::BindingsCache & GetBindingsCache() 
     { return _bindingsCache; }
 
-    /// Returns the BindingsCache object to be used when computing resolved 
+    /// Returns the BindingsCache object to be used when computing resolved
     /// material bindings.
     UsdShadeMaterialBindingAPI::CollectionQueryCache & GetCollectionQueryCache()
     { return _collQueryCache; }
 
+    /// Returns the map of bindings that have already been resolved in bulk
+    /// via UsdShadeMaterialBindingAPI::ComputeBoundMaterialsForSubtree().
+    /// Prims with an entry here are served from the map instead of
+    /// re-resolving their ancestor chain.
+    UsdShadeMaterialBindingAPI::BoundMaterialMap & GetResolvedBindings()
+    { return _resolvedBindings; }
+
     /// Clears all of the held caches.
     void ClearCaches();
 
@@ -652,6 +710,7 @@ private:
     const TfToken _materialPurpose;
     UsdShadeMaterialBindingAPI::BindingsCache _bindingsCache;
     UsdShadeMaterialBindingAPI::CollectionQueryCache _collQueryCache;
+    UsdShadeMaterialBindingAPI::BoundMaterialMap _resolvedBindings;
 };
 
 struct UsdImaging_MaterialStrategy;
@@ -672,11 +731,20 @@ struct UsdImaging_MaterialStrategy {
 
     static
     query_type MakeQuery(
-        UsdPrim prim, 
-        ImplData *implData) 
+        UsdPrim prim,
+        ImplData *implData)
     {
+        // Prefer bindings that were already resolved in bulk during
+        // population over re-walking the prim's ancestor chain.
+        const UsdShadeMaterialBindingAPI::BoundMaterialMap &resolvedBindings =
+            implData->GetResolvedBindings();
+        const auto it = resolvedBindings.find(prim.GetPath());
+        if (it != resolvedBindings.end()) {
+            return it->second;
+        }
+
         return UsdShadeMaterialBindingAPI(prim).ComputeBoundMaterial(
-                &implData->GetBindingsCache(), 
+                &implData->GetBindingsCache(),
                 &implData->GetCollectionQueryCache(),
                 implData->GetMaterialPurpose());
     }
@@ -705,12 +773,9 @@ struct UsdImaging_MaterialStrategy {
     static
     value_type
     ComputeMaterialPath(UsdPrim const& prim, ImplData *implData) {
-        // We don't need to walk up the namespace here since 
+        // We don't need to walk up the namespace here since
         // ComputeBoundMaterial does it for us.
-        if (UsdShadeMaterial mat = UsdShadeMaterialBindingAPI(prim).
-                    ComputeBoundMaterial(&implData->GetBindingsCache(), 
-                                         &implData->GetCollectionQueryCache(),
-                                         implData->GetMaterialPurpose())) {
+        if (UsdShadeMaterial mat = MakeQuery(prim, implData)) {
             return mat.GetPath();
         }
         return value_type();
@@ -40,6 +40,10 @@
 
 #include "pxr/base/gf/matrix4f.h"
 
+#include "pxr/base/work/loops.h"
+
+#include "pxr/base/tf/pyLock.h"
+
 #include "pxr/base/tf/type.h"
 
 #include <limits>
@@ -699,8 +703,9 @@ struct UsdImagingInstanceAdapter::_ComputeInstanceTransformFn
     { }
 
     void Initialize(size_t numInstances)
-    { 
+    {
         result.resize(numInstances);
+        instanceContexts.resize(numInstances);
     }
 
     bool operator()(
@@ -708,26 +713,48 @@ struct UsdImagingInstanceAdapter::_ComputeInstanceTransformFn
     {
         if (!TF_VERIFY(instanceIdx < result.size())) {
             result.resize(instanceIdx + 1);
+            instanceContexts.resize(instanceIdx + 1);
         }
 
-        // Ignore root transform when computing each instance's transform
-        // to avoid a double transformation when applying the instancer 
-        // transform.
-        static const bool ignoreRootTransform = true;
-
-        GfMatrix4d xform(1.0);
-        TF_FOR_ALL(instanceIt, instanceContext) {
-            xform = xform 
-                * adapter->GetTransform(*instanceIt, time, ignoreRootTransform);
-        }
-
-        result[instanceIdx] = xform;
+        // Just record the instancing context here; composing the
+        // transform requires value resolution on every prim in the
+        // context, which dominates the cost of this visitor for large
+        // instance counts, so that happens in parallel in
+        // ComputeTransforms once all contexts have been gathered.
+        instanceContexts[instanceIdx] = instanceContext;
         return true;
     }
 
+    void ComputeTransforms()
+    {
+        // Each instance's transform depends only on its own instancing
+        // context, so the composition can run over all instances in
+        // parallel. GetTransform is safe to call concurrently; it only
+        // performs const queries against the xform cache and the stage.
+        WorkParallelForN(instanceContexts.size(),
+            [this](size_t begin, size_t end) {
+                // Ignore root transform when computing each instance's
+                // transform to avoid a double transformation when applying
+                // the instancer transform.
+                static const bool ignoreRootTransform = true;
+
+                for (size_t instanceIdx = begin; instanceIdx < end;
+                     ++instanceIdx) {
+                    GfMatrix4d xform(1.0);
+                    TF_FOR_ALL(instanceIt, instanceContexts[instanceIdx]) {
+                        xform = xform
+                            * adapter->GetTransform(*instanceIt, time,
+                                                    ignoreRootTransform);
+                    }
+                    result[instanceIdx] = xform;
+                }
+            });
+    }
+
     const UsdImagingInstanceAdapter* adapter;
     UsdTimeCode time;
     VtMatrix4dArray result;
+    std::vector<std::vector<UsdPrim>> instanceContexts;
 };
 
 bool
@@ -736,8 +763,11 @@ UsdImagingInstanceAdapter::_ComputeInstanceTransforms(
     VtMatrix4dArray* outTransforms,
     UsdTimeCode time) const
 {
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
     _ComputeInstanceTransformFn computeXform(this, time);
     _RunForAllInstancesToDraw(instancer, &computeXform);
+    computeXform.ComputeTransforms();
     outTransforms->swap(computeXform.result);
     return true;
 }
@@ -32,8 +32,14 @@
 #include "pxr/usd/usdShade/material.h"
 #include "pxr/usd/usdShade/shader.h"
 
+#include <boost/functional/hash.hpp>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+static
+size_t _ComputeNetworkFingerprint(HdMaterialNetworkMap const& networkMap,
+                                  SdfPath const& materialPath);
+
 TF_REGISTRY_FUNCTION(TfType)
 {
     typedef UsdImagingMaterialAdapter Adapter;
@@ -108,7 +114,18 @@ UsdImagingMaterialAdapter::UpdateForTime(UsdPrim const& prim,
         HdMaterialNetworkMap materialNetworkMap;
         _GetMaterialNetworkMap(prim, &materialNetworkMap);
 
-        valueCache->GetMaterialResource(cachePath) = materialNetworkMap;
+        // Share translated networks between materials: if a network with the
+        // same fingerprint has already been translated, reuse the stored
+        // value rather than keeping another copy alive in the value cache.
+        // Duplicated materials then present byte-identical resources to the
+        // render delegate, letting backends that hash the resource share
+        // shaders across them.
+        const size_t fingerprint =
+            _ComputeNetworkFingerprint(materialNetworkMap, prim.GetPath());
+        const auto res = _translatedNetworks.insert(
+            std::make_pair(fingerprint, VtValue(materialNetworkMap)));
+
+        valueCache->GetMaterialResource(cachePath) = res.first->second;
 
         // Compute union of primvars from all networks
         std::vector<TfToken> primvars;
@@ -321,6 +338,45 @@ void _WalkGraph(UsdShadeShader const & shadeNode,
     materialNetwork->nodes.push_back(node);
 }
 
+// Compute a fingerprint of a translated material network: a hash of its
+// nodes, connections and parameter values. Node paths are hashed relative
+// to the enclosing material so that identical networks authored under
+// different material prims produce the same fingerprint. As with the
+// hash-keyed instance registries in Hd, fingerprint collisions trade a
+// vanishingly unlikely false share for not having to deep-compare networks.
+static
+size_t _ComputeNetworkFingerprint(HdMaterialNetworkMap const& networkMap,
+                                  SdfPath const& materialPath)
+{
+    size_t hash = 0;
+    for (auto const& entry: networkMap.map) {
+        boost::hash_combine(hash, entry.first.Hash());
+
+        HdMaterialNetwork const& network = entry.second;
+        for (HdMaterialNode const& node: network.nodes) {
+            boost::hash_combine(hash,
+                node.path.MakeRelativePath(materialPath).GetHash());
+            boost::hash_combine(hash, node.identifier.Hash());
+            for (auto const& param: node.parameters) {
+                boost::hash_combine(hash, param.first.Hash());
+                boost::hash_combine(hash, param.second.GetHash());
+            }
+        }
+        for (HdMaterialRelationship const& rel: network.relationships) {
+            boost::hash_combine(hash,
+                rel.inputId.MakeRelativePath(materialPath).GetHash());
+            boost::hash_combine(hash, rel.inputName.Hash());
+            boost::hash_combine(hash,
+                rel.outputId.MakeRelativePath(materialPath).GetHash());
+            boost::hash_combine(hash, rel.outputName.Hash());
+        }
+        for (TfToken const& primvar: network.primvars) {
+            boost::hash_combine(hash, primvar.Hash());
+        }
+    }
+    return hash;
+}
+
 void 
 UsdImagingMaterialAdapter::_GetMaterialNetworkMap(UsdPrim const &usdPrim, 
     HdMaterialNetworkMap *materialNetworkMap) const
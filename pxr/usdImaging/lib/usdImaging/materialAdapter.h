@@ -28,6 +28,9 @@
 
 #include "pxr/pxr.h"
 #include "pxr/usdImaging/usdImaging/primAdapter.h"
+#include "pxr/base/vt/value.h"
+
+#include <tbb/concurrent_unordered_map.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -106,8 +109,18 @@ protected:
                              UsdImagingIndexProxy* index) final;
 
 private:
-    void _GetMaterialNetworkMap(UsdPrim const &prim, 
+    void _GetMaterialNetworkMap(UsdPrim const &prim,
                                 HdMaterialNetworkMap *materialNetworkMap) const;
+
+    // Cache of translated material networks, keyed by a fingerprint of the
+    // network's nodes, connections and parameter values. Identical networks
+    // authored under different material prims -- a common result of
+    // duplicating assets -- share a single stored value, so the value cache
+    // holds one payload per unique network rather than one per material.
+    // The cache is bounded by the number of unique networks encountered.
+    typedef tbb::concurrent_unordered_map<size_t, VtValue>
+        _TranslatedNetworkCache;
+    mutable _TranslatedNetworkCache _translatedNetworks;
 };
 
 
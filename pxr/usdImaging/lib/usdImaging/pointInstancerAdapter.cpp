@@ -35,6 +35,7 @@
 #include "pxr/imaging/hd/renderIndex.h"
 #include "pxr/usd/sdf/schema.h"
 #include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usdGeom/bboxCache.h"
 #include "pxr/usd/usdGeom/imageable.h"
 #include "pxr/usd/usdGeom/pointInstancer.h"
 #include "pxr/usd/usdGeom/primvarsAPI.h"
@@ -44,8 +45,11 @@
 #include "pxr/base/tf/staticTokens.h"
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/tf/type.h"
+#include "pxr/base/gf/frustum.h"
 #include "pxr/base/gf/quath.h"
 
+#include "pxr/base/work/loops.h"
+
 #include <limits>
 #include <atomic>
 
@@ -1494,18 +1498,104 @@ UsdImagingPointInstancerAdapter::_UpdateInstanceMap(
     // If no value is available, mask will be ignored below.
     std::vector<bool> mask = instancer.ComputeMaskAtTime(time);
 
+    // If the client has provided a culling volume, evaluate each instance
+    // position against it and drop instances that cannot contribute to the
+    // image. Culled instances are not removed from the render index; they
+    // are simply left out of the indices accumulated below, so they come
+    // back whenever the culling volume is updated and the instance indices
+    // are recomputed.
+    std::vector<uint8_t> culled;
+    GfFrustum cullFrustum;
+    double cullMaxDistance = 0.0;
+    if (_GetInstancerCullingState(&cullFrustum, &cullMaxDistance)) {
+        VtVec3fArray positions;
+        if (instancer.GetPositionsAttr().Get(&positions, time) &&
+            positions.size() == indices.size()) {
+            culled.assign(indices.size(), 0);
+
+            // Instance positions are authored in the instancer's space;
+            // the culling volume is in world space.
+            GfMatrix4d const instancerXf = GetTransform(instancerPrim, time);
+            double const instancerScale = std::max(
+                instancerXf.GetRow3(0).GetLength(),
+                std::max(instancerXf.GetRow3(1).GetLength(),
+                         instancerXf.GetRow3(2).GetLength()));
+
+            // Conservative bounding radius per prototype, so that large
+            // prototypes whose anchor point sits outside the frustum are
+            // still kept when their extents may reach into view.
+            UsdGeomBBoxCache bboxCache(time,
+                TfTokenVector{UsdGeomTokens->default_,
+                              UsdGeomTokens->render,
+                              UsdGeomTokens->proxy});
+            std::vector<double> protoRadius(prototypes.size(), 0.0);
+            for (size_t i = 0; i < prototypes.size(); ++i) {
+                UsdPrim const protoRoot =
+                    _GetPrim(prototypes[i]->protoRootPath);
+                if (protoRoot) {
+                    GfRange3d const range = bboxCache
+                        .ComputeUntransformedBound(protoRoot)
+                        .ComputeAlignedRange();
+                    if (!range.IsEmpty()) {
+                        protoRadius[i] = range.GetSize().GetLength() * 0.5;
+                    }
+                }
+            }
+
+            // Per-instance scales grow the conservative bounds too.
+            VtVec3fArray scales;
+            instancer.GetScalesAttr().Get(&scales, time);
+
+            GfVec3d const viewPosition = cullFrustum.GetPosition();
+            WorkParallelForN(indices.size(),
+                [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    size_t const protoIndex = indices[i];
+                    if (protoIndex > prototypes.size() - 1) {
+                        continue;
+                    }
+
+                    GfVec3d const center =
+                        instancerXf.Transform(GfVec3d(positions[i]));
+                    double radius = protoRadius[protoIndex] * instancerScale;
+                    if (i < scales.size()) {
+                        GfVec3f const& scale = scales[i];
+                        radius *= std::max(fabsf(scale[0]),
+                                   std::max(fabsf(scale[1]),
+                                            fabsf(scale[2])));
+                    }
+
+                    if (cullMaxDistance > 0.0 &&
+                        (center - viewPosition).GetLength() - radius >
+                            cullMaxDistance) {
+                        culled[i] = 1;
+                        continue;
+                    }
+
+                    GfBBox3d const bounds(
+                        GfRange3d(center - GfVec3d(radius),
+                                  center + GfVec3d(radius)));
+                    if (!cullFrustum.Intersects(bounds)) {
+                        culled[i] = 1;
+                    }
+                }
+            });
+        }
+    }
+
     for (size_t instanceId = 0; instanceId < indices.size(); ++instanceId) {
         size_t protoIndex = indices[instanceId];
 
         if (protoIndex > prototypes.size() - 1) {
             TF_WARN("Invalid index (%lu) found in <%s.%s> for time (%s)\n",
-                    protoIndex, instancer.GetPath().GetText(), 
+                    protoIndex, instancer.GetPath().GetText(),
                     indicesAttr.GetName().GetText(),
                     TfStringify(time).c_str());
             continue;
         }
 
-        if (mask.size() == 0 || mask[instanceId]) {
+        if ((mask.size() == 0 || mask[instanceId]) &&
+            (culled.empty() || !culled[instanceId])) {
             prototypes[protoIndex]->indices.push_back(instanceId);
         }
     }
@@ -421,6 +421,18 @@ UsdImagingPrimAdapter::GetRootTransform() const
     return _delegate->GetRootTransform();
 }
 
+bool
+UsdImagingPrimAdapter::_GetInstancerCullingState(GfFrustum* frustum,
+                                                 double* maxDistance) const
+{
+    if (!_delegate->_instancerCullingEnabled) {
+        return false;
+    }
+    *frustum = _delegate->_instancerCullingFrustum;
+    *maxDistance = _delegate->_instancerCullingMaxDistance;
+    return true;
+}
+
 UsdPrim
 UsdImagingPrimAdapter::_GetPrim(SdfPath const& usdPath) const
 {
@@ -668,13 +680,32 @@ UsdImagingPrimAdapter::_IsVarying(UsdPrim prim,
         *exists = false;
     }
 
+    UsdImagingDelegate::_VariabilityCache &varCache =
+        _delegate->_variabilityCache;
+
     do {
         UsdAttribute attr = prim.GetAttribute(attrName);
 
         if (attr && exists != nullptr) {
             *exists = true;
         }
-        if (attr.ValueMightBeTimeVarying()){
+
+        // Variability probing computes resolve info, which is relatively
+        // expensive, and inherited attributes are re-probed by every
+        // descendant, so memoize each attribute's answer in the
+        // delegate's shared cache.
+        bool varying;
+        const SdfPath attrPath = prim.GetPath().AppendProperty(attrName);
+        UsdImagingDelegate::_VariabilityCache::const_iterator it =
+            varCache.find(attrPath);
+        if (it != varCache.end()) {
+            varying = it->second;
+        } else {
+            varying = attr.ValueMightBeTimeVarying();
+            varCache[attrPath] = varying;
+        }
+
+        if (varying) {
             (*dirtyFlags) |= dirtyFlag;
             HD_PERF_COUNTER_INCR(perfToken);
             return true;
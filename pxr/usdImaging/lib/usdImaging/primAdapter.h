@@ -49,6 +49,7 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class GfFrustum;
 class UsdPrim;
 
 // Forward declaration for nested class.
@@ -448,6 +449,13 @@ protected:
     USDIMAGING_API
     UsdPrim _GetPrim(SdfPath const& usdPath) const;
 
+    // Returns true and fills in the given frustum and distance budget if
+    // the delegate has an instancer culling volume set; see
+    // UsdImagingDelegate::SetInstancerCullingFrustum.
+    USDIMAGING_API
+    bool _GetInstancerCullingState(GfFrustum* frustum,
+                                   double* maxDistance) const;
+
     // Returns the prim adapter for the given \p prim, or an invalid pointer if
     // no adapter exists. If \p prim is an instance and \p ignoreInstancing
     // is \c true, the instancing adapter will be ignored and an adapter will
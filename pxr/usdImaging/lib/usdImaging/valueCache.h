@@ -79,6 +79,12 @@ public:
             return !(*this == rhs);
         }
 
+        // Hash of the prim path only; used to select the map shard so that
+        // all values cached for one prim land in the same shard.
+        inline size_t GetPathHash() const {
+            return _path.GetHash();
+        }
+
         struct Hash {
             inline size_t operator()(Key const& key) const {
                 size_t hash = key._path.GetHash();
@@ -216,8 +222,27 @@ private:
         typedef typename _MapType::const_iterator                      _MapConstIt;
         typedef tbb::concurrent_queue<_MapIt>                          _QueueType;
 
-        _MapType   _map;
-        _QueueType _deferredDeleteQueue;
+        // The map is sharded by prim path hash so that threads working on
+        // different prims during parallel UpdateForTime contend on different
+        // containers. Each shard keeps its own deferred delete queue so
+        // queued iterators are erased from the shard they came from.
+        static size_t const _numShards = 16;
+
+        _MapType   _maps[_numShards];
+        _QueueType _deferredDeleteQueues[_numShards];
+
+        size_t _GetShardIndex(Key const& key) const {
+            return key.GetPathHash() & (_numShards - 1);
+        }
+        _MapType& _GetMap(Key const& key) {
+            return _maps[_GetShardIndex(key)];
+        }
+        _MapType const& _GetMap(Key const& key) const {
+            return _maps[_GetShardIndex(key)];
+        }
+        _QueueType& _GetDeferredDeleteQueue(Key const& key) {
+            return _deferredDeleteQueues[_GetShardIndex(key)];
+        }
     };
 
 
@@ -230,8 +255,9 @@ private:
         Cache_t *cache = nullptr;
 
         _GetCache(&cache);
-        typename Cache_t::_MapConstIt it = cache->_map.find(key);
-        if (it == cache->_map.end()) {
+        typename Cache_t::_MapType const& map = cache->_GetMap(key);
+        typename Cache_t::_MapConstIt it = map.find(key);
+        if (it == map.end()) {
             return false;
         }
         *value = it->second;
@@ -255,15 +281,16 @@ private:
         Cache_t *cache = nullptr;
 
         _GetCache(&cache);
-        typename Cache_t::_MapIt it = cache->_map.find(key);
+        typename Cache_t::_MapType& map = cache->_GetMap(key);
+        typename Cache_t::_MapIt it = map.find(key);
 
-        if (it == cache->_map.end()) {
+        if (it == map.end()) {
             return false;
         }
 
         // If we're going to erase the old value, swap to avoid a copy.
         std::swap(it->second, *value);
-        cache->_deferredDeleteQueue.push(it);
+        cache->_GetDeferredDeleteQueue(key).push(it);
         return true;
     }
 
@@ -281,7 +308,7 @@ private:
 
         Cache_t *cache = nullptr;
         _GetCache(&cache);
-        cache->_map.unsafe_erase(key);
+        cache->_GetMap(key).unsafe_erase(key);
     }
 
     /// Returns a reference to the held value for \p key. Note that the entry
@@ -296,7 +323,7 @@ private:
 
         // With concurrent_unordered_map, multi-threaded insertion is safe.
         std::pair<typename Cache_t::_MapIt, bool> res =
-                                cache->_map.insert(std::make_pair(key, T()));
+                    cache->_GetMap(key).insert(std::make_pair(key, T()));
 
         return res.first->second;
     }
@@ -310,8 +337,10 @@ private:
 
         typename Cache_t::_MapIt it;
 
-        while (cache._deferredDeleteQueue.try_pop(it)) {
-            cache._map.unsafe_erase(it);
+        for (size_t i = 0; i < Cache_t::_numShards; ++i) {
+            while (cache._deferredDeleteQueues[i].try_pop(it)) {
+                cache._maps[i].unsafe_erase(it);
+            }
         }
     }
 
@@ -702,6 +731,29 @@ public:
         return _Extract(Key::ExtComputationKernel(path), value);
     }
 
+    /// Bulk extraction of all cached primvar values for \p path. Populates
+    /// \p descriptors with the prim's primvar descriptors and \p values with
+    /// the corresponding cached value for each descriptor; a primvar with no
+    /// cached value leaves an empty VtValue in its slot. Returns false if no
+    /// primvar descriptors are cached for \p path.
+    ///
+    /// This replaces one Extract call per primvar with a single call per
+    /// prim; since all of a prim's values live in one shard, the lookups it
+    /// performs stay within that shard.
+    bool ExtractPrimvarValues(SdfPath const& path,
+                              HdPrimvarDescriptorVector* descriptors,
+                              std::vector<VtValue>* values) {
+        if (!_Extract(Key::Primvars(path), descriptors)) {
+            return false;
+        }
+        values->clear();
+        values->resize(descriptors->size());
+        for (size_t i = 0; i < descriptors->size(); ++i) {
+            _Extract(Key(path, (*descriptors)[i].name), &(*values)[i]);
+        }
+        return true;
+    }
+
     /// Remove any items from the cache that are marked for defered deletion.
     void GarbageCollect()
     {
@@ -217,11 +217,24 @@ UsdImagingGLEngine::PrepareBatch(
     TF_VERIFY(_delegate);
 
     if (_CanPrepareBatch(root, params)) {
+        // If the batch root comes from a different stage than the one we
+        // populated from (e.g. the client reopened the scene into a new
+        // stage), replace only the usd imaging delegate and repopulate
+        // against the live render index. Unchanged topology, buffer data
+        // and compiled shaders are then re-matched by hash in the
+        // resource registry instead of being recreated from scratch.
+        // Edits within the same stage are diffed incrementally by the
+        // delegate's change tracking and don't take this path.
+        if (_isPopulated && _stage != root.GetStage()) {
+            _RebuildDelegate();
+        }
+
         if (!_isPopulated) {
             _delegate->SetUsdDrawModesEnabled(params.enableUsdDrawModes);
             _delegate->Populate(root.GetStage()->GetPrimAtPath(_rootPath),
                                _excludedPrimPaths);
             _delegate->SetInvisedPrimPaths(_invisedPrimPaths);
+            _stage = root.GetStage();
             _isPopulated = true;
         }
 
@@ -1335,6 +1348,34 @@ UsdImagingGLEngine::_DeleteHydraResources()
     }
 }
 
+void
+UsdImagingGLEngine::_RebuildDelegate()
+{
+    TF_VERIFY(_renderIndex);
+
+    // Pull state that lives on the delegate.
+    GfMatrix4d rootTransform = GfMatrix4d(1.0);
+    bool isVisible = true;
+    if (_delegate != nullptr) {
+        rootTransform = _delegate->GetRootTransform();
+        isVisible = _delegate->GetRootVisibility();
+        delete _delegate;
+        _delegate = nullptr;
+    }
+
+    // Only the delegate is replaced: the render index, the render delegate
+    // and the task controller survive, and with them the resource registry
+    // caches. Deleting the old delegate removes its prims, but the backing
+    // registry entries stay alive until the next garbage collection, which
+    // runs after repopulation has re-registered the ones still in use.
+    _delegate = new UsdImagingDelegate(_renderIndex, _delegateID);
+    _delegate->SetRootVisibility(isVisible);
+    _delegate->SetRootTransform(rootTransform);
+
+    _stage = UsdStageWeakPtr();
+    _isPopulated = false;
+}
+
 /* static */
 TfToken
 UsdImagingGLEngine::_GetDefaultRendererPluginId()
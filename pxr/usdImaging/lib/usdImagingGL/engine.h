@@ -47,6 +47,7 @@
 #include "pxr/imaging/glf/simpleMaterial.h"
 
 #include "pxr/usd/sdf/path.h"
+#include "pxr/usd/usd/common.h"
 #include "pxr/usd/usd/timeCode.h"
 
 #include "pxr/base/gf/frustum.h"
@@ -432,6 +433,14 @@ protected:
     // the task controller, and the usd imaging delegate.
     void _DeleteHydraResources();
 
+    // Replaces only the usd imaging delegate, keeping the render index,
+    // the render delegate and the task controller alive. Used when the
+    // batch root comes from a different stage than the one we populated
+    // from; repopulating against the live render index lets the resource
+    // registry re-match unchanged buffer data, textures and compiled
+    // shaders by hash instead of recreating them.
+    void _RebuildDelegate();
+
     static TfToken _GetDefaultRendererPluginId();
 
     // Creates and binds the internal draw-target that Hydra draws into.
@@ -465,6 +474,10 @@ protected:
     SdfPathVector _invisedPrimPaths;
     bool _isPopulated;
 
+    // The stage the delegate was last populated from, used to detect when
+    // a batch root comes from a different stage.
+    UsdStageWeakPtr _stage;
+
     GfVec4i _restoreViewport;
     bool _useFloatPointDrawTarget;
     HdxCompositor _compositor;
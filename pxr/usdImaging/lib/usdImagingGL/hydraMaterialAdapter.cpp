@@ -535,7 +535,8 @@ UsdImagingGLHydraMaterialAdapter::_GetShaderSource(
                         TF_DEBUG(USDIMAGING_SHADERS).Msg(
                             "Loading UsdShade preview surface %s\n", 
                             glslfxPath.c_str());
-                        return getGLSLFXSource(HioGlslfx(glslfxPath));
+                        return getGLSLFXSource(*HioGlslfx::GetShared(
+                                                   glslfxPath));
                     }
                 }
             }
@@ -546,7 +547,8 @@ UsdImagingGLHydraMaterialAdapter::_GetShaderSource(
                 std::string resolvedSrcAsset = 
                     ArGetResolver().Resolve(sourceAsset.GetAssetPath());
                 if (!resolvedSrcAsset.empty()) {
-                    return getGLSLFXSource(HioGlslfx(resolvedSrcAsset));
+                    return getGLSLFXSource(*HioGlslfx::GetShared(
+                                               resolvedSrcAsset));
                 }
             }
         } else if (implSource == UsdShadeTokens->sourceCode) {
@@ -596,8 +598,7 @@ UsdImagingGLHydraMaterialAdapter::_GetShaderSource(
         filePath = asset.GetAssetPath();
     }
 
-    HioGlslfx gfx(filePath);
-    return getGLSLFXSource(gfx);
+    return getGLSLFXSource(*HioGlslfx::GetShared(filePath));
 }
 
 VtValue
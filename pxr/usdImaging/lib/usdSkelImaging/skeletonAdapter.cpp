@@ -491,6 +491,19 @@ UsdSkelImagingSkeletonAdapter::MarkDirty(const UsdPrim& prim,
                 "computation %s for skinned prim %s as Dirty (bits = 0x%x\n",
                 cachePath.GetText(), prim.GetPath().GetText(), dirty);
 
+        if (dirty & HdExtComputation::DirtySceneInput) {
+            // Scene inputs include the shared skinning transforms and
+            // blend shape weights; drop the per-skeleton memo so they are
+            // requeried rather than served from stale cache.
+            if (const _SkinnedPrimData* skinnedPrimData =
+                    _GetSkinnedPrimData(cachePath.GetParentPath())) {
+                if (_SkelData* skelData =
+                        _GetSkelData(skinnedPrimData->skelPath)) {
+                    skelData->InvalidateAnimData();
+                }
+            }
+        }
+
         index->MarkSprimDirty(cachePath, dirty);
     
     } else {
@@ -1287,55 +1300,36 @@ _GetInfluences(const UsdSkelBindingAPI& binding,
 
 
 bool
-_ComputeSkinningTransforms(const UsdSkelSkeletonQuery& skelQuery,
-                           const UsdSkelAnimMapper& jointMapper,
-                           UsdTimeCode time,
-                           VtMatrix4fArray* xforms)
+_RemapSkinningTransforms(const VtMatrix4fArray& xformsInSkelOrder,
+                         const UsdSkelAnimMapper& jointMapper,
+                         VtMatrix4fArray* xforms)
 {
     HD_TRACE_FUNCTION();
 
-    // PERFORMANCE:
-    // Would be better to query skinning transforms only once per
-    // skeleton, and share the results across each skinned prim.
-    VtMatrix4fArray xformsInSkelOrder;
-    if (skelQuery.ComputeSkinningTransforms(&xformsInSkelOrder, time)) {
-
-        // Each skinned prim may specify its own ordering of joints.
-        // (eg., because only a subset set of joints may apply to the prim).
-        // Return the remapped results.
-        return jointMapper.RemapTransforms(xformsInSkelOrder, xforms);
-    }
-    return false;
+    // Each skinned prim may specify its own ordering of joints.
+    // (eg., because only a subset set of joints may apply to the prim).
+    // Return the remapped results.
+    return jointMapper.RemapTransforms(xformsInSkelOrder, xforms);
 }
                
 
 bool
-_ComputeSubShapeWeights(const UsdSkelSkeletonQuery& skelQuery,
+_ComputeSubShapeWeights(const VtFloatArray& weightsInAnimOrder,
                         const UsdSkelBlendShapeQuery& blendShapeQuery,
                         const UsdSkelAnimMapper& blendShapeMapper,
-                        UsdTimeCode time,
                         VtFloatArray* subShapeWeights)
 {
     HD_TRACE_FUNCTION();
 
-    // PERFORMANCE:
-    // It is better to compute the initial weight values from the skel query,
-    // and then share the results across each skinned prim!
-    VtFloatArray weights;
-    if (const UsdSkelAnimQuery& animQuery = skelQuery.GetAnimQuery()) {
-        if (animQuery.ComputeBlendShapeWeights(&weights, time)) {
-
-            // Each skinned prim may specify its own ordering of blend shapes   
-            // (eg., because only a subset of blend shapes may apply to
-            // the prim). Remap them.
-            VtFloatArray weightsInPrimOrder;
-            const float defaultValue = 0.0f;
-            if (blendShapeMapper.Remap(weights, &weightsInPrimOrder,
-                                       /*elementSize*/ 1, &defaultValue)) {
-                return blendShapeQuery.ComputeFlattenedSubShapeWeights(
-                    weightsInPrimOrder, subShapeWeights);
-            }
-        }
+    // Each skinned prim may specify its own ordering of blend shapes
+    // (eg., because only a subset of blend shapes may apply to
+    // the prim). Remap them.
+    VtFloatArray weightsInPrimOrder;
+    const float defaultValue = 0.0f;
+    if (blendShapeMapper.Remap(weightsInAnimOrder, &weightsInPrimOrder,
+                               /*elementSize*/ 1, &defaultValue)) {
+        return blendShapeQuery.ComputeFlattenedSubShapeWeights(
+            weightsInPrimOrder, subShapeWeights);
     }
     return false;
 }
@@ -1563,16 +1557,25 @@ UsdSkelImagingSkeletonAdapter::_UpdateSkinningComputationForTime(
                 return;
             }
                 
-            const _SkelData* skelData = _GetSkelData(skinnedPrimData->skelPath);
+            _SkelData* skelData = _GetSkelData(skinnedPrimData->skelPath);
             if (!TF_VERIFY(skelData)) {
                 return;
             }
 
+            // The skeleton-ordered transforms and animation-ordered blend
+            // shape weights are queried once per skeleton per time and
+            // shared across all of its skinned prims; only the remapping
+            // into this prim's ordering is per-prim work.
+            VtMatrix4fArray xformsInSkelOrder;
+            const bool haveSkelXforms =
+                skinnedPrimData->hasJointInfluences &&
+                skelData->ComputeSkinningTransforms(time, &xformsInSkelOrder);
+
             VtMatrix4fArray skinningXforms;
-            if (!skinnedPrimData->hasJointInfluences ||
-                !_ComputeSkinningTransforms(skelData->skelQuery,
-                                            skinnedPrimData->jointMapper,
-                                            time, &skinningXforms)) {
+            if (!haveSkelXforms ||
+                !_RemapSkinningTransforms(xformsInSkelOrder,
+                                          skinnedPrimData->jointMapper,
+                                          &skinningXforms)) {
                 skinningXforms.assign(skinnedPrimData->jointMapper.size(),
                                       GfMatrix4f(1));
             }
@@ -1580,12 +1583,17 @@ UsdSkelImagingSkeletonAdapter::_UpdateSkinningComputationForTime(
             valueCache->GetExtComputationInput(
                 computationPath, _tokens->skinningXforms) = skinningXforms;
 
+            VtFloatArray weightsInAnimOrder;
+            const bool haveAnimWeights =
+                skinnedPrimData->blendShapeQuery &&
+                skelData->ComputeBlendShapeWeights(time, &weightsInAnimOrder);
+
             VtFloatArray weights;
-            if (!skinnedPrimData->blendShapeQuery ||
-                !_ComputeSubShapeWeights(skelData->skelQuery,
+            if (!haveAnimWeights ||
+                !_ComputeSubShapeWeights(weightsInAnimOrder,
                                          *skinnedPrimData->blendShapeQuery,
                                          skinnedPrimData->blendShapeMapper,
-                                         time, &weights)) {
+                                         &weights)) {
                 if (skinnedPrimData->blendShapeQuery) {
                     weights.assign(
                         skinnedPrimData->blendShapeQuery->GetNumSubShapes(),
@@ -2038,6 +2046,56 @@ UsdSkelImagingSkeletonAdapter::_SkelData::ComputePurpose() const
 }
 
 
+bool
+UsdSkelImagingSkeletonAdapter::_SkelData::ComputeSkinningTransforms(
+    UsdTimeCode time,
+    VtMatrix4fArray* xforms)
+{
+    std::lock_guard<std::mutex> lock(_animDataMutex);
+    if (!_skinningXformsCached || _skinningXformsTime != time) {
+        _skinningXformsValid =
+            skelQuery.ComputeSkinningTransforms(&_skinningXforms, time);
+        _skinningXformsTime = time;
+        _skinningXformsCached = true;
+    }
+    if (_skinningXformsValid) {
+        *xforms = _skinningXforms;
+    }
+    return _skinningXformsValid;
+}
+
+
+bool
+UsdSkelImagingSkeletonAdapter::_SkelData::ComputeBlendShapeWeights(
+    UsdTimeCode time,
+    VtFloatArray* weights)
+{
+    std::lock_guard<std::mutex> lock(_animDataMutex);
+    if (!_blendShapeWeightsCached || _blendShapeWeightsTime != time) {
+        _blendShapeWeightsValid = false;
+        if (const UsdSkelAnimQuery& animQuery = skelQuery.GetAnimQuery()) {
+            _blendShapeWeightsValid =
+                animQuery.ComputeBlendShapeWeights(&_blendShapeWeights, time);
+        }
+        _blendShapeWeightsTime = time;
+        _blendShapeWeightsCached = true;
+    }
+    if (_blendShapeWeightsValid) {
+        *weights = _blendShapeWeights;
+    }
+    return _blendShapeWeightsValid;
+}
+
+
+void
+UsdSkelImagingSkeletonAdapter::_SkelData::InvalidateAnimData()
+{
+    std::lock_guard<std::mutex> lock(_animDataMutex);
+    _skinningXformsCached = false;
+    _blendShapeWeightsCached = false;
+}
+
+
 // ---------------------------------------------------------------------- //
 /// _SkinnedPrimData
 // ---------------------------------------------------------------------- //
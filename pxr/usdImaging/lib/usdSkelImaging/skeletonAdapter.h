@@ -37,6 +37,7 @@
 #include "pxr/usd/usdSkel/skeletonQuery.h"
 
 #include <boost/unordered_map.hpp>
+#include <mutex>
 #include <unordered_map>
 
 
@@ -294,12 +295,42 @@ private:
 
         TfToken ComputePurpose() const;
 
+        /// Compute the skinning transforms (in skeleton order) at \p time,
+        /// sharing one query result across every skinned prim bound to
+        /// this skeleton; each prim remaps the shared array through its
+        /// own joint mapper.  Returns false if the transforms could not
+        /// be computed.
+        bool ComputeSkinningTransforms(UsdTimeCode time,
+                                       VtMatrix4fArray* xforms);
+
+        /// Compute the blend shape weights (in animation order) at
+        /// \p time, shared across skinned prims in the same way.
+        bool ComputeBlendShapeWeights(UsdTimeCode time,
+                                      VtFloatArray* weights);
+
+        /// Drop the memoized per-frame animation data, forcing the next
+        /// query to recompute it.
+        void InvalidateAnimData();
+
     private:
         // Cache of a mesh for a skeleton (at rest)
         // TODO: Dedupe this infromation across UsdSkelSkeleton instances.
         VtVec3fArray    _boneMeshPoints;
         VtIntArray      _boneMeshJointIndices;
         size_t          _numJoints;
+
+        // Memoized per-frame animation data.  Skinned prims update in
+        // parallel, so access is serialized; the arrays are handed out
+        // by value, which shares their storage.
+        std::mutex      _animDataMutex;
+        UsdTimeCode     _skinningXformsTime;
+        VtMatrix4fArray _skinningXforms;
+        bool            _skinningXformsCached = false;
+        bool            _skinningXformsValid = false;
+        UsdTimeCode     _blendShapeWeightsTime;
+        VtFloatArray    _blendShapeWeights;
+        bool            _blendShapeWeightsCached = false;
+        bool            _blendShapeWeightsValid = false;
     };
 
     _SkelData*  _GetSkelData(const SdfPath& cachePath) const;
@@ -23,7 +23,10 @@
 //
 #include "pxr/usdImaging/usdviewq/utils.h"
 #include "pxr/base/plug/registry.h"
+#include "pxr/base/tf/patternMatcher.h"
+#include "pxr/base/tf/pyLock.h"
 #include "pxr/base/tf/staticTokens.h"
+#include "pxr/base/work/loops.h"
 
 #include "pxr/usd/usd/attribute.h"
 #include "pxr/usd/usd/attributeQuery.h"
@@ -127,5 +130,123 @@ UsdviewqUtils::GetPrimInfo(const UsdPrim &prim, const UsdTimeCode time)
     return PrimInfo(prim, time);
 }
 
+/*static*/
+std::vector<UsdviewqUtils::PrimInfo>
+UsdviewqUtils::GetChildrenPrimInfos(const UsdPrim &prim,
+                                    const UsdTimeCode time)
+{
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    std::vector<UsdPrim> children;
+    for (const UsdPrim &child: prim.GetFilteredChildren(
+             UsdTraverseInstanceProxies(UsdPrimAllPrimsPredicate))) {
+        children.push_back(child);
+    }
+
+    // Each record only performs const queries against the stage, so they
+    // can all be computed in parallel.
+    std::vector<PrimInfo> result(children.size());
+    WorkParallelForN(children.size(),
+        [&children, &result, time](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                result[i] = PrimInfo(children[i], time);
+            }
+        });
+
+    return result;
+}
+
+/*static*/
+SdfPathVector
+UsdviewqUtils::FindPrims(UsdStagePtr const &stage, const FindFilter &filter,
+                         size_t maxResults, SdfPath const &resumeAfterPath)
+{
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    if (!stage) {
+        return SdfPathVector();
+    }
+
+    // Resolve the type filter once up front.
+    TfType schemaType;
+    if (!filter.typeName.empty()) {
+        schemaType = PlugRegistry::FindDerivedTypeByName<UsdSchemaBase>(
+            filter.typeName);
+        if (schemaType.IsUnknown()) {
+            // An unknown type can't match anything.
+            return SdfPathVector();
+        }
+    }
+
+    TfPatternMatcher nameMatcher(filter.namePattern, filter.caseSensitive,
+                                 /* isGlob = */ true);
+    // Force pattern compilation now; Match() compiles lazily and the
+    // matcher is shared by the worker threads below.
+    nameMatcher.IsValid();
+
+    const TfToken attributeName(filter.attributeName);
+
+    // Flatten the traversal so the prims can be tested in parallel.
+    std::vector<UsdPrim> prims;
+    for (UsdPrim const &prim : UsdPrimRange::Stage(stage,
+             UsdTraverseInstanceProxies(UsdPrimAllPrimsPredicate))) {
+        prims.push_back(prim);
+    }
+
+    // Skip everything up to and including the resume point so repeated
+    // calls hand back results in batches.
+    size_t first = 0;
+    if (!resumeAfterPath.IsEmpty()) {
+        for (size_t i = 0; i < prims.size(); ++i) {
+            if (prims[i].GetPath() == resumeAfterPath) {
+                first = i + 1;
+                break;
+            }
+        }
+    }
+
+    // Each test only performs const queries against the stage, so the
+    // prims can all be filtered in parallel.
+    const size_t numToTest = prims.size() - first;
+    std::vector<unsigned char> matches(numToTest, 0);
+    WorkParallelForN(numToTest,
+        [&prims, &matches, &filter, &nameMatcher, &schemaType,
+         &attributeName, first](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                UsdPrim const &prim = prims[first + i];
+                if (filter.onlyActive && !prim.IsActive()) {
+                    continue;
+                }
+                if (filter.onlyLoaded && !prim.IsLoaded()) {
+                    continue;
+                }
+                if (!filter.namePattern.empty() &&
+                    !nameMatcher.Match(prim.GetName().GetString())) {
+                    continue;
+                }
+                if (!schemaType.IsUnknown() && !_IsA(prim, schemaType)) {
+                    continue;
+                }
+                if (!attributeName.IsEmpty() &&
+                    !prim.HasAttribute(attributeName)) {
+                    continue;
+                }
+                matches[i] = 1;
+            }
+        });
+
+    SdfPathVector result;
+    for (size_t i = 0; i < numToTest; ++i) {
+        if (matches[i]) {
+            result.push_back(prims[first + i].GetPath());
+            if (maxResults > 0 && result.size() == maxResults) {
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -44,6 +44,7 @@ class UsdviewqUtils {
 public:
 
     struct PrimInfo {
+        PrimInfo() = default;
         PrimInfo(const UsdPrim &prim, const UsdTimeCode time);
 
         bool hasCompositionArcs;  
@@ -75,8 +76,52 @@ public:
     /// population.  Takes a time argument so that we can evaluate the prim's
     /// visibiity if it is imageable.
     USDVIEWQ_API
-    static UsdviewqUtils::PrimInfo GetPrimInfo(const UsdPrim &prim, 
+    static UsdviewqUtils::PrimInfo GetPrimInfo(const UsdPrim &prim,
                                                const UsdTimeCode time);
+
+    /// Fetch PrimInfo for every child of \p prim in a single call. The
+    /// records are computed with a parallel traversal and returned in
+    /// children order, so expanding a scope with very many children costs
+    /// one Python round-trip instead of one per child. All children are
+    /// returned, including inactive, undefined, and abstract prims and
+    /// instance proxies; clients filter on the returned flags, which is
+    /// much cheaper than re-querying each prim.
+    USDVIEWQ_API
+    static std::vector<UsdviewqUtils::PrimInfo>
+    GetChildrenPrimInfos(const UsdPrim &prim, const UsdTimeCode time);
+
+    /// Search criteria for FindPrims(). Empty string fields match
+    /// everything.
+    struct FindFilter {
+        FindFilter()
+            : caseSensitive(false)
+            , onlyActive(false)
+            , onlyLoaded(false)
+        { }
+
+        /// Glob pattern matched against prim names (e.g. "chair*").
+        std::string namePattern;
+        /// Schema type name; prims whose type derives from it also match.
+        std::string typeName;
+        /// Name of an attribute that must be present on the prim.
+        std::string attributeName;
+        bool caseSensitive;
+        bool onlyActive;
+        bool onlyLoaded;
+    };
+
+    /// Finds the prims on \p stage matching \p filter, testing prims in
+    /// parallel, and returns their paths in traversal order. When
+    /// \p maxResults is nonzero at most that many paths are returned;
+    /// passing the last returned path back as \p resumeAfterPath continues
+    /// the search from there, so a UI can populate results progressively
+    /// in batches. Instance proxies and inactive prims are included in the
+    /// traversal; the filter decides what matches.
+    USDVIEWQ_API
+    static SdfPathVector FindPrims(UsdStagePtr const &stage,
+                                   const FindFilter &filter,
+                                   size_t maxResults = 0,
+                                   SdfPath const &resumeAfterPath = SdfPath());
 };
 
 
@@ -44,10 +44,8 @@ namespace {
 // python clients to extract the information 40% faster than if we were
 // to wrap out UsdviewqUtils::PrimInfo directly.
 static tuple
-_GetPrimInfo(UsdPrim const &prim, UsdTimeCode time)
+_PrimInfoToTuple(UsdviewqUtils::PrimInfo const &info)
 {
-    UsdviewqUtils::PrimInfo info = UsdviewqUtils::GetPrimInfo(prim, time);
-    
     return boost::python::make_tuple(info.hasCompositionArcs,
                                      info.isActive,
                                      info.isImageable,
@@ -62,9 +60,49 @@ _GetPrimInfo(UsdPrim const &prim, UsdTimeCode time)
                                      info.typeName);
 }
 
-} // anonymous namespace 
+static tuple
+_GetPrimInfo(UsdPrim const &prim, UsdTimeCode time)
+{
+    return _PrimInfoToTuple(UsdviewqUtils::GetPrimInfo(prim, time));
+}
+
+static list
+_GetChildrenPrimInfos(UsdPrim const &prim, UsdTimeCode time)
+{
+    list result;
+    for (UsdviewqUtils::PrimInfo const &info:
+             UsdviewqUtils::GetChildrenPrimInfos(prim, time)) {
+        result.append(_PrimInfoToTuple(info));
+    }
+    return result;
+}
 
-void wrapUtils() {    
+static std::vector<SdfPath>
+_FindPrims(UsdStagePtr const &stage,
+           std::string const &namePattern,
+           std::string const &typeName,
+           std::string const &attributeName,
+           bool caseSensitive,
+           bool onlyActive,
+           bool onlyLoaded,
+           size_t maxResults,
+           SdfPath const &resumeAfterPath)
+{
+    UsdviewqUtils::FindFilter filter;
+    filter.namePattern = namePattern;
+    filter.typeName = typeName;
+    filter.attributeName = attributeName;
+    filter.caseSensitive = caseSensitive;
+    filter.onlyActive = onlyActive;
+    filter.onlyLoaded = onlyLoaded;
+
+    return UsdviewqUtils::FindPrims(stage, filter, maxResults,
+                                    resumeAfterPath);
+}
+
+} // anonymous namespace
+
+void wrapUtils() {
     typedef UsdviewqUtils This;
 
     scope utilsScope = class_<This> ("Utils")
@@ -76,5 +114,23 @@ void wrapUtils() {
         .def("GetPrimInfo",
              _GetPrimInfo)
             .staticmethod("GetPrimInfo")
+
+        .def("GetChildrenPrimInfos",
+             _GetChildrenPrimInfos)
+            .staticmethod("GetChildrenPrimInfos")
+
+        .def("FindPrims",
+             _FindPrims,
+             (arg("stage"),
+              arg("namePattern") = std::string(),
+              arg("typeName") = std::string(),
+              arg("attributeName") = std::string(),
+              arg("caseSensitive") = false,
+              arg("onlyActive") = false,
+              arg("onlyLoaded") = false,
+              arg("maxResults") = size_t(0),
+              arg("resumeAfterPath") = SdfPath()),
+             return_value_policy<TfPySequenceToList>())
+            .staticmethod("FindPrims")
         ;
 }